@@ -22,7 +22,7 @@ macro(CheckInterModuleDependencies)
     REQUIRES_MODS(BUILD_DRAFT              BUILD_SKETCHER BUILD_TECHDRAW)
     REQUIRES_MODS(BUILD_DRAWING            BUILD_PART BUILD_SPREADSHEET)
     REQUIRES_MODS(BUILD_FEM                BUILD_PART)
-    REQUIRES_MODS(BUILD_IMPORT             BUILD_PART BUILD_PART_DESIGN)
+    REQUIRES_MODS(BUILD_IMPORT             BUILD_MESH BUILD_PART BUILD_PART_DESIGN)
     REQUIRES_MODS(BUILD_INSPECTION         BUILD_MESH BUILD_POINTS BUILD_PART)
     REQUIRES_MODS(BUILD_JTREADER           BUILD_MESH)
     REQUIRES_MODS(BUILD_MESH_PART          BUILD_PART BUILD_MESH)
@@ -122,6 +122,7 @@ class NETGENPLUGIN_EXPORT NETGENPlugin_Mesher
   void SetParameters(const NETGENPlugin_Hypothesis*          hyp);
   void SetParameters(const NETGENPlugin_SimpleHypothesis_2D* hyp);
   void SetViscousLayers2DAssigned(bool isAssigned) { _isViscousLayers2D = isAssigned; }
+  void SetParallelMeshing(bool toMeshInParallel, int nbThreads);
 
   bool Compute();
 
@@ -204,6 +205,8 @@ class NETGENPLUGIN_EXPORT NETGENPlugin_Mesher
   bool                 _optimize;
   int                  _fineness;
   bool                 _isViscousLayers2D;
+  bool                 _parallelMeshing;
+  int                  _nbThreads;
 #if NETGEN_VERSION < NETGEN_VERSION_STRING(6,0,0)
   netgen::Mesh*        _ngMesh;
 #else
@@ -135,6 +135,7 @@ namespace netgen {
 }
 
 #include <vector>
+#include <algorithm>
 #include <limits>
 
 #ifdef WIN32
@@ -163,6 +164,36 @@ std::map<int,double> VertexId2LocalSize;
 std::map<int,double> EdgeId2LocalSize;
 std::map<int,double> FaceId2LocalSize;
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Runs the netgen task manager while in scope, netgen only meshes in
+   *        parallel from inside it
+   */
+  //================================================================================
+
+  struct NETGENPlugin_TaskManager
+  {
+#if NETGEN_VERSION >= NETGEN_VERSION_STRING(6,2,2204)
+    int _nbThreads;
+
+    NETGENPlugin_TaskManager( int nbThreads )
+    {
+      ngcore::TaskManager::SetNumThreads( nbThreads );
+      _nbThreads = nbThreads > 1 ? ngcore::EnterTaskManager() : 0;
+    }
+    ~NETGENPlugin_TaskManager()
+    {
+      if ( _nbThreads > 0 )
+        ngcore::ExitTaskManager( _nbThreads );
+    }
+#else
+    NETGENPlugin_TaskManager( int ) {}
+#endif
+  };
+}
+
 //=============================================================================
 /*!
  *
@@ -178,6 +209,8 @@ NETGENPlugin_Mesher::NETGENPlugin_Mesher (SMESH_Mesh*         mesh,
     _optimize(true),
     _fineness(NETGENPlugin_Hypothesis::GetDefaultFineness()),
     _isViscousLayers2D(false),
+    _parallelMeshing(false),
+    _nbThreads(1),
     _ngMesh(NULL),
     _occgeom(NULL),
     _curShapeIndex(-1),
@@ -2469,6 +2502,19 @@ namespace
   const double volOptimizeTime = 0.77;
 }
 
+//=============================================================================
+/*!
+ * Let netgen mesh the volumes of the solids concurrently once the surface mesh
+ * shared by all of them exists, with netgen 6.2.2204 or newer
+ */
+//=============================================================================
+
+void NETGENPlugin_Mesher::SetParallelMeshing(bool toMeshInParallel, int nbThreads)
+{
+  _parallelMeshing = toMeshInParallel;
+  _nbThreads       = std::max( 1, nbThreads );
+}
+
 //=============================================================================
 /*!
  * Here we are going to use the NETGEN mesher
@@ -2480,6 +2526,11 @@ bool NETGENPlugin_Mesher::Compute()
   NETGENPlugin_NetgenLibWrapper ngLib;
 
   netgen::MeshingParameters& mparams = netgen::mparam;
+#if NETGEN_VERSION >= NETGEN_VERSION_STRING(6,2,2204)
+  mparams.parallel_meshing = _parallelMeshing;
+  mparams.nthreads         = _nbThreads;
+#endif
+  NETGENPlugin_TaskManager taskManager( _parallelMeshing ? _nbThreads : 1 );
   MESSAGE("Compute with:\n"
           " max size = " << mparams.maxh << "\n"
           " segments per edge = " << mparams.segmentsperedge);
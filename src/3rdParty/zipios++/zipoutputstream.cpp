@@ -64,6 +64,12 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
 }
 
 
+void ZipOutputStream::putRawEntry( const std::string &entryName, StorageMethod method,
+                                   const char *data, uint32 compressed_size,
+                                   uint32 crc, uint32 size ) {
+  ozf->putRawEntry( ZipCDirEntry( entryName ), method, data, compressed_size, crc, size ) ;
+}
+
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
 }
@@ -49,6 +49,20 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry whose data has already been compressed.
+      Closes the current entry (if one is open) and writes the local
+      header followed by the given data.
+      @param entry the entry to write.
+      @param method the method that has been used to compress the data,
+      either STORED or DEFLATED (raw deflate stream without zlib header).
+      @param data the compressed data.
+      @param compressed_size the size of data in bytes.
+      @param crc the crc32 of the uncompressed data.
+      @param size the size of the uncompressed data. */
+  void putRawEntry( const ZipCDirEntry &entry, StorageMethod method,
+                    const char *data, uint32 compressed_size,
+                    uint32 crc, uint32 size ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -68,6 +82,7 @@ protected:
 
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
+  static int currentDosTime() ;
 
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
@@ -49,6 +49,7 @@
 # include <list>
 # include <algorithm>
 # include <iostream>
+# include <iterator>
 # include <map>
 # include <tuple>
 # include <vector>
@@ -87,6 +88,7 @@
 #include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
+#include <Base/Parallel.h>
 #include <Base/QuantityPy.h>
 #include <Base/Parameter.h>
 #include <Base/Persistence.h>
@@ -96,6 +98,7 @@
 #include <Base/RotationPy.h>
 #include <Base/UniqueNameManager.h>
 #include <Base/TimeInfo.h>
+#include <Base/Stream.h>
 #include <Base/SystemHandler.h>
 #include <Base/Tools.h>
 #include <Base/Translate.h>
@@ -769,12 +772,18 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
     _pendingDocsReopen.clear();
     _pendingDocMap.clear();
     _docReloadAttempts.clear();
+    _prefetchedDocs.clear();
 
     signalStartOpenDocument();
 
     ParameterGrp::handle hGrp = GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     _allowPartial = !hGrp->GetBool("NoPartialLoading",false);
 
+    // Maximum size in MB of the project files that are read ahead at a time, 0 to disable
+    std::size_t prefetchLimit = static_cast<std::size_t>(
+        std::max<long>(hGrp->GetInt("PrefetchSize", 512), 0)) << 20;
+    std::set<std::string> prefetched;
+
     for (auto &name : filenames)
         _pendingDocs.emplace_back(name.c_str());
 
@@ -788,6 +797,28 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
     do {
         std::set<DocumentT> newDocs;
         for (std::size_t count=0;; ++count) {
+            // The project files of the pending documents, e.g. all the external documents
+            // linked by the document restored last, don't depend on each other. So read them
+            // concurrently before restoring the documents one after another.
+            if (prefetchLimit > 0 && !prefetched.contains(_pendingDocs.front())) {
+                std::vector<std::string> files;
+                std::size_t size = 0;
+                for (std::size_t i = 0; i < _pendingDocs.size() && size < prefetchLimit; ++i) {
+                    if (!prefetched.insert(_pendingDocs[i]).second)
+                        continue;
+                    std::string path = _pendingDocs[i];
+                    if (pass == 0 && count + i < filenames.size() && paths
+                            && paths->size() > count + i)
+                        path = (*paths)[count + i];
+                    Base::FileInfo fi(path);
+                    if (!fi.isFile() || getDocumentByPath(fi.filePath().c_str()))
+                        continue;
+                    size += fi.size();
+                    files.push_back(fi.filePath());
+                }
+                prefetchDocuments(files);
+            }
+
             std::string name = std::move(_pendingDocs.front());
             _pendingDocs.pop_front();
             bool isMainDoc = (pass == 0 && count < filenames.size());
@@ -856,6 +887,7 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
                     _pendingDocs.clear();
                     _pendingDocsReopen.clear();
                     _pendingDocMap.clear();
+                    _prefetchedDocs.clear();
                     throw;
                 }
             }
@@ -950,6 +982,7 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
         Base::Console().log("%s restore time: %f\n", doc.getDocumentName(), timing.d1.count());
         Base::Console().log("%s postprocess time: %f\n", doc.getDocumentName(), timing.d2.count());
     }
+    _prefetchedDocs.clear();
     PropertyLinkBase::updateAllElementReferences();
     _isRestoring = false;
 
@@ -957,6 +990,39 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
     return res;
 }
 
+void Application::prefetchDocuments(const std::vector<std::string> &files)
+{
+    std::vector<std::string> contents(files.size());
+    Base::parallelFor(files.size(), [&](std::size_t i) {
+        // Any error is left to Document::restore(), which reads the file again
+        try {
+            Base::ifstream file(Base::FileInfo(files[i]), std::ios::in | std::ios::binary);
+            std::string content((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+            if (file.good() || file.eof())
+                contents[i] = std::move(content);
+        }
+        catch (...) {
+            contents[i].clear();
+        }
+    });
+
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        if (!contents[i].empty())
+            _prefetchedDocs[files[i]] = std::move(contents[i]);
+    }
+}
+
+bool Application::takePrefetchedDocument(const std::string &filePath, std::string &content)
+{
+    auto it = _prefetchedDocs.find(filePath);
+    if (it == _prefetchedDocs.end())
+        return false;
+    content = std::move(it->second);
+    _prefetchedDocs.erase(it);
+    return true;
+}
+
 Document* Application::openDocumentPrivate(const char * FileName,
         const char *propFileName, const char *label,
         bool isMainDoc, DocumentInitFlags initFlags,
@@ -2209,6 +2275,8 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     ("get-config", boost::program_options::value<std::string>(), "Prints the value of the requested configuration key")
     ("set-config", boost::program_options::value< std::vector<std::string> >()->multitoken(), "Sets the value of a configuration key")
     ("keep-deprecated-paths", "If set then config files are kept on the old location")
+    ("log-startup", "Prints the time spent initializing each module at startup")
+    ("server", "Keeps running and executes the jobs read from the standard input (console only)")
     ;
 
     // Declare a group of options that will be
@@ -2468,6 +2536,10 @@ void processProgramOptions(const boost::program_options::variables_map& vm, std:
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.contains("server")) {
+        mConfig["Server"] = "1";
+    }
+
     if (vm.contains("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
@@ -2570,6 +2642,10 @@ void Application::initConfig(int argc, char ** argv)
         mConfig["SafeMode"] = "1";
     }
 
+    if (vm.contains("log-startup")) {
+        mConfig["LogStartup"] = "1";
+    }
+
     // extract home paths
     _appDirs = std::make_unique<ApplicationDirectories>(mConfig);
 
@@ -2710,6 +2786,11 @@ void Application::initConfig(int argc, char ** argv)
         mConfig["AppTempPath"] = tmpPath + PATHSEP;
     }
 
+    // Number of threads used by parallel algorithms, 0 means one per hardware thread
+    long maxThreads =
+        _pcUserParamMngr->GetGroup("BaseApp/Preferences/General")->GetInt("MaxThreads", 0);
+    Base::setMaxThreads(static_cast<unsigned>(std::max(0L, maxThreads)));
+
 
     // capture python variables
     SaveEnv("PYTHONPATH");
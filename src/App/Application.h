@@ -927,6 +927,10 @@ private:
 
     App::Document* openDocumentPrivate(const char * FileName, const char *propFileName,
             const char *label, bool isMainDoc, DocumentInitFlags initFlags, std::vector<std::string> &&objNames);
+    // Reads the given project files concurrently, Document::restore() then takes the content
+    // with takePrefetchedDocument() instead of reading the file itself
+    void prefetchDocuments(const std::vector<std::string> &files);
+    bool takePrefetchedDocument(const std::string &filePath, std::string &content);
 
     void setActiveDocumentNoSignal(App::Document* pDoc);
 
@@ -993,6 +997,9 @@ private:
     // missing object
     std::map<std::string,std::set<std::string> > _docReloadAttempts;
 
+    // Content of the project files read ahead while opening documents
+    std::map<std::string,std::string> _prefetchedDocs;
+
     bool _isRestoring{false};
     bool _allowPartial{false};
     bool _isClosingAll{false};
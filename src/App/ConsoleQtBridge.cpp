@@ -98,6 +98,21 @@ public:
             Qt::QueuedConnection
         );
     }
+
+    void postFlush() const override
+    {
+        QCoreApplication* app = QCoreApplication::instance();
+        if (!app) {
+            Base::Console().flush();
+            return;
+        }
+
+        QMetaObject::invokeMethod(
+            app,
+            []() { Base::Console().flush(); },
+            Qt::QueuedConnection
+        );
+    }
 };
 
 void deliverConsoleMessage(
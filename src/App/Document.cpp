@@ -23,18 +23,24 @@
  ***************************************************************************/
 
 #include <bitset>
+#include <chrono>
 #include <stack>
 #include <deque>
 #include <iostream>
 #include <utility>
 #include <set>
+#include <sstream>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <string>
+#include <thread>
 #include <map>
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <numeric>
+#include <optional>
 #include <filesystem>
 #include <format>
 
@@ -50,6 +56,7 @@
 
 #include <QCryptographicHash>
 #include <QCoreApplication>
+#include <QtConcurrentMap>
 
 #include <FCConfig.h>
 
@@ -111,6 +118,23 @@ namespace App
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
 
+namespace
+{
+// Property changes of an object that is recomputed in a worker thread. They
+// are replayed in the main thread once the object is done.
+struct ConcurrentRecomputeJob
+{
+    DocumentObject* object;
+    int result;
+    std::vector<std::pair<DocumentObject*, const Property*>> changes;
+};
+
+thread_local ConcurrentRecomputeJob* concurrentRecomputeJob = nullptr;
+
+// guards the transaction while objects are recomputed concurrently
+std::mutex concurrentRecomputeMutex;
+}  // namespace
+
 DocumentP::DocumentP()
 {
     static std::random_device rd;
@@ -123,6 +147,7 @@ DocumentP::DocumentP()
     StatusBits.set((size_t)Document::Closable, true);
     StatusBits.set((size_t)Document::KeepTrailingDigits, true);
     StatusBits.set((size_t)Document::Restoring, false);
+    recomputeStart = std::chrono::steady_clock::now();
 }
 
 }  // namespace App
@@ -594,6 +619,7 @@ bool Document::_commitTransaction(const bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        _applyUndoLimit();
         signalCommitTransaction(*this);
 
         // commitTransaction() may call again _commitTransaction()
@@ -704,9 +730,12 @@ void Document::clearDocument() // NOLINT
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->topoSortCacheValid = false;
+    d->objectLabelIndexValid = false;
     d->objectMap.clear();
     d->objectNameManager.clear();
     d->objectIdMap.clear();
+    d->clearTypeBuckets();
     d->lastObjectId = 0;
 }
 
@@ -800,14 +829,55 @@ int Document::getUndoMode() const
     return d->iUndoMode;
 }
 
-unsigned int Document::getUndoMemSize() const
+std::size_t Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = 0;
+    for (auto transaction : mUndoTransactions) {
+        size += transaction->getMemSize();
+    }
+    for (auto transaction : mRedoTransactions) {
+        size += transaction->getMemSize();
+    }
+    return size;
 }
 
-void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
+void Document::setUndoLimit(const std::size_t UndoMemSize) // NOLINT
 {
     d->UndoMemSize = UndoMemSize;
+    _applyUndoLimit();
+}
+
+std::size_t Document::getUndoLimit() const
+{
+    return d->UndoMemSize;
+}
+
+void Document::_applyUndoLimit()
+{
+    if (d->UndoMemSize == 0 || mUndoTransactions.empty()) {
+        return;
+    }
+
+    std::size_t size = getUndoMemSize();
+    if (size <= d->UndoMemSize) {
+        return;
+    }
+
+    // First move the data of older transactions to files, but keep the
+    // latest transaction in memory as it is the most likely one to be undone
+    auto last = std::prev(mUndoTransactions.end());
+    for (auto it = mUndoTransactions.begin(); it != last && size > d->UndoMemSize; ++it) {
+        size -= std::min(size, (*it)->spill());
+    }
+
+    // Then remove the oldest transactions
+    while (size > d->UndoMemSize && mUndoTransactions.size() > 1) {
+        Transaction* transaction = mUndoTransactions.front();
+        size -= std::min(size, static_cast<std::size_t>(transaction->getMemSize()));
+        mUndoMap.erase(transaction->getID());
+        delete transaction;
+        mUndoTransactions.pop_front();
+    }
 }
 
 void Document::setMaxUndoStackSize(const unsigned int UndoMaxStackSize) // NOLINT
@@ -892,7 +962,13 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
-    if (Who->isDerivedFrom<DocumentObject>()) {
+    std::unique_lock<std::mutex> lock(concurrentRecomputeMutex, std::defer_lock);
+    if (concurrentRecomputeJob) {
+        // observers are not notified before a change when the object is
+        // recomputed concurrently, only the transaction is recorded
+        lock.lock();
+    }
+    else if (Who->isDerivedFrom<DocumentObject>()) {
         signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
     }
     if (!d->rollback && !globalIsRelabeling) {
@@ -905,9 +981,51 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (concurrentRecomputeJob) {
+        concurrentRecomputeJob->changes.emplace_back(const_cast<DocumentObject*>(Who), What);
+        return;
+    }
+    if (d->batchUpdateDepth > 0 && What->getName()) {
+        // Remember object and property by ID and name, both may be removed
+        // before the batch is closed
+        std::pair<long, std::string> change(Who->getID(), What->getName());
+        if (d->batchedChangeSet.insert(change).second) {
+            d->batchedChanges.push_back(std::move(change));
+        }
+        return;
+    }
     signalChangedObject(*Who, *What);
 }
 
+void Document::openBatchUpdate()
+{
+    ++d->batchUpdateDepth;
+}
+
+void Document::closeBatchUpdate()
+{
+    if (d->batchUpdateDepth <= 0 || --d->batchUpdateDepth > 0) {
+        return;
+    }
+    auto changes = std::move(d->batchedChanges);
+    d->batchedChanges.clear();
+    d->batchedChangeSet.clear();
+    for (const auto& change : changes) {
+        auto obj = getObjectByID(change.first);
+        if (!obj) {
+            continue;
+        }
+        if (auto prop = obj->getPropertyByName(change.second.c_str())) {
+            signalChangedObject(*obj, *prop);
+        }
+    }
+}
+
+bool Document::isBatchUpdating() const
+{
+    return d->batchUpdateDepth > 0;
+}
+
 void Document::setTransactionMode(const int iMode) // NOLINT
 {
     d->iTransactionMode = iMode;
@@ -1002,6 +1120,17 @@ Document::Document(const char* documentName)
                       0,
                       PropertyType(Prop_Hidden),
                       "Whether to use hasher on topological naming");
+    static const char* ShapeFormatEnums[] = {"Text", "Binary", "Auto", nullptr};
+    ADD_PROPERTY_TYPE(ShapeFormat,
+                      (0L),
+                      0,
+                      Prop_None,
+                      "Format of the shape files written when saving the document.\n"
+                      "'Text': text BREP, readable by any OCCT based application\n"
+                      "'Binary': binary BREP, faster to load and smaller\n"
+                      "'Auto': binary BREP for solids and compounds, text BREP for\n"
+                      "simple shapes like wires and edges");
+    ShapeFormat.setEnums(ShapeFormatEnums);
 
     // this creates and sets 'TransientDir' in onChanged()
     ADD_PROPERTY_TYPE(TransientDir,
@@ -1813,7 +1942,7 @@ unsigned int Document::getMemSize() const
     size += PropertyContainer::getMemSize();
 
     // Undo Redo size
-    size += getUndoMemSize();
+    size += static_cast<unsigned int>(getUndoMemSize());
 
     return size;
 }
@@ -1984,11 +2113,17 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        // thumbnails are already compressed
+        writer.setLevel("png", 0);
+        writer.setParallelCompression(hGrp->GetBool("ParallelCompression", true));
         writer.putNextEntry("Document.xml");
 
-        if (hGrp->GetBool("SaveBinaryBrep", false)) {
+        if (ShapeFormat.isValue("Binary") || hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        else if (ShapeFormat.isValue("Auto")) {
+            writer.setMode("BinaryBrepAuto");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << '\n'
                         << "<!--" << '\n'
@@ -2053,6 +2188,7 @@ bool Document::saveToFile(const char* filename) const
 
 void Document::registerLabel(const std::string& newLabel)
 {
+    d->objectLabelIndexValid = false;
     if (!newLabel.empty()) {
         d->objectLabelManager.addExactName(newLabel);
     }
@@ -2060,6 +2196,7 @@ void Document::registerLabel(const std::string& newLabel)
 
 void Document::unregisterLabel(const std::string& oldLabel)
 {
+    d->objectLabelIndexValid = false;
     if (!oldLabel.empty()) {
         d->objectLabelManager.removeExactName(oldLabel);
     }
@@ -2107,9 +2244,12 @@ void Document::restore(const char* filename,
     d->clearRecomputeLog();
     d->objectLabelManager.clear();
     d->objectArray.clear();
+    d->topoSortCacheValid = false;
+    d->objectLabelIndexValid = false;
     d->objectNameManager.clear();
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->clearTypeBuckets();
     d->lastObjectId = 0;
 
     if (signal) {
@@ -2123,15 +2263,26 @@ void Document::restore(const char* filename,
         filename = FileName.getValue();
     }
     Base::FileInfo fi(filename);
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    std::streambuf* buf = file.rdbuf();
+    // Application::openDocuments() may have read the file already
+    Base::ifstream file;
+    std::istringstream prefetched;
+    std::istream* input = &file;
+    std::string content;
+    if (GetApplication().takePrefetchedDocument(fi.filePath(), content)) {
+        prefetched.str(std::move(content));
+        input = &prefetched;
+    }
+    else {
+        file.open(fi, std::ios::in | std::ios::binary);
+    }
+    std::streambuf* buf = input->rdbuf();
     std::streamoff size = buf->pubseekoff(0, std::ios::end, std::ios::in);
     buf->pubseekoff(0, std::ios::beg, std::ios::in);
     if (size < 22) {  // an empty zip archive has 22 bytes
         throw Base::FileException("Invalid project file", filename);
     }
 
-    zipios::ZipInputStream zipstream(file);
+    zipios::ZipInputStream zipstream(*input);
     Base::XMLReader reader(filename, zipstream);
 
     if (!reader.isValid()) {
@@ -2161,6 +2312,10 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    reader.setStatus(Base::XMLReader::ConcurrentFileReading, hGrp->GetBool("ParallelRestore", true));
+    reader.setStatus(Base::XMLReader::LazyFileReading, hGrp->GetBool("LazyRestore", false));
     reader.readFiles(zipstream);
 
     DocumentP::checkStringHasher(reader);
@@ -2766,6 +2921,49 @@ void Document::setPreRecomputeHook(const PreRecomputeHook& hook)
      d->_preRecomputeHook = hook;
 }
 
+namespace
+{
+// Stable sort of a topologically sorted list by dependency level, so that
+// independent objects end up next to each other. Returns the level of each
+// object in the reordered list.
+std::vector<int> sortByDependencyLevel(std::vector<DocumentObject*>& objs)
+{
+    std::unordered_map<const DocumentObject*, size_t> indices;
+    indices.reserve(objs.size());
+    for (size_t i = 0; i < objs.size(); ++i) {
+        indices.emplace(objs[i], i);
+    }
+
+    std::vector<int> levels(objs.size(), 0);
+    for (size_t i = 0; i < objs.size(); ++i) {
+        for (auto dep : objs[i]->getOutList()) {
+            auto it = indices.find(dep);
+            // ignore back edges of cyclic dependencies
+            if (it != indices.end() && it->second < i) {
+                levels[i] = std::max(levels[i], levels[it->second] + 1);
+            }
+        }
+    }
+
+    std::vector<size_t> order(objs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&levels](size_t a, size_t b) {
+        return levels[a] < levels[b];
+    });
+
+    std::vector<DocumentObject*> sortedObjs;
+    std::vector<int> sortedLevels;
+    sortedObjs.reserve(objs.size());
+    sortedLevels.reserve(objs.size());
+    for (auto i : order) {
+        sortedObjs.push_back(objs[i]);
+        sortedLevels.push_back(levels[i]);
+    }
+    objs.swap(sortedObjs);
+    return sortedLevels;
+}
+}  // namespace
+
 int Document::recompute(const std::vector<DocumentObject*>& objs,
                         bool force,
                         bool* hasError,
@@ -2802,6 +3000,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
 
     // delete recompute log
     d->clearRecomputeLog();
+    d->clearRecomputeStats();
 
     Base::TimeTracker tracker("Document::recompute");
 
@@ -2845,10 +3044,19 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
 
+    // Dependency level of each object, only used for parallel recompute.
+    // Objects of the same level do not depend on each other.
+    std::vector<int> levels;
+    if (hGrp->GetBool("ParallelRecompute", false) && topoSortedObjects.size() > 1) {
+        levels = sortByDependencyLevel(topoSortedObjects);
+    }
+
     tracker.checkpoint("pre-recompute & topo sort");
 
     try {
         std::set<DocumentObject*> filter;
+        std::map<DocumentObject*, int> batchResults;
+        size_t batchEnd = 0;
         size_t idx = 0;
         // maximum two passes to allow some form of dependency inversion
         for (int passes = 0; passes < 2 && idx < topoSortedObjects.size(); ++passes) {
@@ -2858,17 +3066,24 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            batchEnd = 0;
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
                     continue;
                 }
+                if (!levels.empty() && idx >= batchEnd) {
+                    batchEnd =
+                        _recomputeConcurrently(topoSortedObjects, levels, idx, filter, batchResults);
+                }
+                auto batchIt = idx < batchEnd ? batchResults.find(obj) : batchResults.end();
                 // ask the object if it should be recomputed
                 bool doRecompute = false;
-                if (obj->mustRecompute()) {
+                if (batchIt != batchResults.end() || obj->mustRecompute()) {
                     doRecompute = true;
                     ++objectCount;
-                    int res = _recomputeFeature(obj);
+                    int res =
+                        batchIt != batchResults.end() ? batchIt->second : _recomputeFeature(obj);
                     if (res != 0) {
                         if (hasError) {
                             *hasError = true;
@@ -2887,10 +3102,16 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                 if (obj->isTouched() || doRecompute) {
                     signalRecomputedObject(*obj);
                     obj->purgeTouched();
-                    // set all dependent object touched to force recompute
-                    for (auto inObjIt : obj->getInList()) {
-                        inObjIt->enforceRecompute();
+                    // set all dependent object touched to force recompute, unless the
+                    // recompute reproduced the output and nothing else has changed
+                    if (!doRecompute || !obj->testStatus(ObjectStatus::OutputUnchanged)
+                        || obj->testStatus(ObjectStatus::PropertyChanged)) {
+                        for (auto inObjIt : obj->getInList()) {
+                            inObjIt->enforceRecompute();
+                        }
                     }
+                    obj->setStatus(ObjectStatus::OutputUnchanged, false);
+                    obj->setStatus(ObjectStatus::PropertyChanged, false);
                 }
                 if (seq) {
                     seq->next(true);
@@ -2966,6 +3187,65 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     return objectCount;
 }
 
+bool Document::_isConcurrentRecomputeThread()
+{
+    return concurrentRecomputeJob != nullptr;
+}
+
+size_t Document::_recomputeConcurrently(const std::vector<DocumentObject*>& objs,
+                                        const std::vector<int>& levels,
+                                        size_t idx,
+                                        const std::set<DocumentObject*>& filter,
+                                        std::map<DocumentObject*, int>& results)
+{
+    results.clear();
+    if (!objs[idx]->allowConcurrentRecompute()) {
+        return idx + 1;
+    }
+
+    size_t end = idx;
+    std::vector<ConcurrentRecomputeJob> jobs;
+    for (; end < objs.size() && levels[end] == levels[idx]; ++end) {
+        auto obj = objs[end];
+        if (!obj->allowConcurrentRecompute()) {
+            break;
+        }
+        if (obj->isAttachedToDocument() && !filter.contains(obj) && obj->mustRecompute()) {
+            jobs.push_back({obj, 0, {}});
+        }
+    }
+    if (jobs.size() < 2) {
+        // nothing to gain, let the caller recompute the objects serially
+        return end;
+    }
+
+    FC_LOG("Recompute " << jobs.size() << " objects concurrently");
+    {
+        // worker threads may need to acquire the GIL, e.g. for logging
+        std::optional<Base::PyGILStateRelease> release;
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            release.emplace();
+        }
+        QtConcurrent::blockingMap(jobs, [this](ConcurrentRecomputeJob& job) {
+            concurrentRecomputeJob = &job;
+            job.result = _recomputeFeature(job.object);
+            concurrentRecomputeJob = nullptr;
+        });
+    }
+
+    // notify observers in the main thread and in the original order
+    for (auto& job : jobs) {
+        for (auto& change : job.changes) {
+            if (change.first->isAttachedToDocument()) {
+                signalChangedObject(*change.first, *change.second);
+                change.first->signalChanged(*change.first, *change.second);
+            }
+        }
+        results.emplace(job.object, job.result);
+    }
+    return end;
+}
+
 /*!
   Does almost the same as topologicalSort() until no object with an input degree of zero
   can be found. It then searches for objects with an output degree of zero until neither
@@ -3086,7 +3366,9 @@ DocumentP::topologicalSort(const std::vector<DocumentObject*>& objects) const
     // https://de.wikipedia.org/wiki/Topologische_Sortierung#Algorithmus_f.C3.BCr_das_Topologische_Sortieren
     std::vector<DocumentObject*> ret;
     ret.reserve(objects.size());
-    std::map<DocumentObject*, int> countMap;
+    std::unordered_map<DocumentObject*, int> countMap;
+    countMap.reserve(objects.size());
+    std::deque<DocumentObject*> roots;
 
     for (auto objectIt : objects) {
         // We now support externally linked objects
@@ -3099,41 +3381,32 @@ DocumentP::topologicalSort(const std::vector<DocumentObject*>& objects) const
         std::sort(in.begin(), in.end());
         in.erase(std::unique(in.begin(), in.end()), in.end());
 
-        countMap[objectIt] = in.size();
+        if (countMap.emplace(objectIt, static_cast<int>(in.size())).second && in.empty()) {
+            roots.push_back(objectIt);
+        }
     }
 
-    auto rootObjeIt = std::find_if(countMap.begin(),
-                                   countMap.end(),
-                                   [](std::pair<DocumentObject*, int> count) -> bool {
-                                       return count.second == 0;
-                                   });
-
-    if (rootObjeIt == countMap.end()) {
+    if (roots.empty()) {
         std::cerr << "Document::topologicalSort: cyclic dependency detected (no root object)" << '\n';
         return ret;
     }
 
-    while (rootObjeIt != countMap.end()) {
-        rootObjeIt->second = rootObjeIt->second - 1;
+    while (!roots.empty()) {
+        auto root = roots.front();
+        roots.pop_front();
 
         // we need outlist with unique entries
-        auto out = rootObjeIt->first->getOutList();
+        auto out = root->getOutList();
         std::sort(out.begin(), out.end());
         out.erase(std::unique(out.begin(), out.end()), out.end());
 
         for (auto outListIt : out) {
             auto outListMapIt = countMap.find(outListIt);
-            if (outListMapIt != countMap.end()) {
-                outListMapIt->second = outListMapIt->second - 1;
+            if (outListMapIt != countMap.end() && --outListMapIt->second == 0) {
+                roots.push_back(outListIt);
             }
         }
-        ret.push_back(rootObjeIt->first);
-
-        rootObjeIt = find_if(countMap.begin(),
-                             countMap.end(),
-                             [](std::pair<DocumentObject*, int> count) -> bool {
-                                 return count.second == 0;
-                             });
+        ret.push_back(root);
     }
 
     return ret;
@@ -3141,7 +3414,16 @@ DocumentP::topologicalSort(const std::vector<DocumentObject*>& objects) const
 
 std::vector<DocumentObject*> Document::topologicalSort() const
 {
-    return d->topologicalSort(d->objectArray);
+    if (!d->topoSortCacheValid) {
+        d->topoSortCache = d->topologicalSort(d->objectArray);
+        d->topoSortCacheValid = true;
+    }
+    return d->topoSortCache;
+}
+
+void Document::_invalidateTopologicalSort() const
+{
+    d->topoSortCacheValid = false;
 }
 
 const char* Document::getErrorDescription(const DocumentObject* Obj) const
@@ -3150,10 +3432,142 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
 }
 
 // call the recompute of the Feature and handle the exceptions and errors.
+namespace
+{
+/// Returns the names of the touched properties or why else the object is recomputed
+std::string getRecomputeReason(const DocumentObject* obj)
+{
+    std::vector<Property*> props;
+    obj->getPropertyList(props);
+    std::string reason;
+    for (auto prop : props) {
+        if (prop->isTouched()) {
+            if (!reason.empty()) {
+                reason += ", ";
+            }
+            reason += prop->getName();
+        }
+    }
+    if (reason.empty()) {
+        reason = obj->testStatus(ObjectStatus::Enforce) ? "Enforced" : "Must execute";
+    }
+    return reason;
+}
+
+/// Adds the timing of an object's recompute to DocumentP::recomputeStats
+class RecomputeStatRecorder
+{
+public:
+    RecomputeStatRecorder(DocumentP* d, DocumentObject* obj)
+        : d(d)
+        , obj(obj)
+        , reason(getRecomputeReason(obj))
+        , start(std::chrono::steady_clock::now())
+    {}
+
+    int finish(int result)
+    {
+        auto end = std::chrono::steady_clock::now();
+
+        RecomputeStat stat;
+        stat.Name = obj->getNameInDocument() ? obj->getNameInDocument() : "";
+        stat.TypeName = obj->getTypeId().getName();
+        stat.Reason = std::move(reason);
+        stat.Duration = std::chrono::duration<double>(end - start).count();
+        stat.Result = result;
+        auto geo = freecad_cast<GeoFeature*>(obj);
+        if (auto prop = geo ? geo->getPropertyOfGeometry() : nullptr) {
+            stat.OutputSize = prop->getMemSize();
+        }
+
+        std::lock_guard<std::mutex> lock(d->recomputeStatsMutex);
+        stat.Start = std::chrono::duration<double>(start - d->recomputeStart).count();
+        auto id = std::this_thread::get_id();
+        auto it = d->recomputeThreads.find(id);
+        if (it == d->recomputeThreads.end()) {
+            it = d->recomputeThreads.emplace(id, static_cast<int>(d->recomputeThreads.size()))
+                     .first;
+        }
+        stat.Thread = it->second;
+        d->recomputeStats.push_back(std::move(stat));
+        return result;
+    }
+
+private:
+    DocumentP* d;
+    DocumentObject* obj;
+    std::string reason;
+    std::chrono::steady_clock::time_point start;
+};
+
+/// Writes a string as quoted JSON string
+void writeJsonString(std::ostream& out, const std::string& str)
+{
+    out << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << std::format("\\u{:04x}", static_cast<int>(c));
+                }
+                else {
+                    out << c;
+                }
+                break;
+        }
+    }
+    out << '"';
+}
+}  // namespace
+
+std::vector<RecomputeStat> Document::getRecomputeStats() const
+{
+    std::lock_guard<std::mutex> lock(d->recomputeStatsMutex);
+    return d->recomputeStats;
+}
+
+void Document::writeRecomputeTrace(std::ostream& out) const
+{
+    auto stats = getRecomputeStats();
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& stat : stats) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        // timestamps of the trace event format are in microseconds
+        out << "{\"name\":";
+        writeJsonString(out, stat.Name);
+        out << ",\"cat\":";
+        writeJsonString(out, stat.TypeName);
+        out << std::format(",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}",
+                           stat.Start * 1e6,
+                           stat.Duration * 1e6,
+                           stat.Thread);
+        out << ",\"args\":{\"reason\":";
+        writeJsonString(out, stat.Reason);
+        out << ",\"outputSize\":" << stat.OutputSize << ",\"result\":" << stat.Result << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    RecomputeStatRecorder stat(d, Feat);
+
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
@@ -3169,29 +3583,29 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
         e.reportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
         d->addRecomputeLog("User abort", Feat);
-        return -1;
+        return stat.finish(-1);
     }
     catch (const Base::MemoryException& e) {
         FC_ERR("Memory exception in " << Feat->getFullName() << " thrown: " << e.what());
         d->addRecomputeLog("Out of memory exception", Feat);
-        return 1;
+        return stat.finish(1);
     }
     catch (Base::Exception& e) {
         e.reportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
         d->addRecomputeLog(e.what(), Feat);
-        return 1;
+        return stat.finish(1);
     }
     catch (std::exception& e) {
         FC_ERR("Exception in " << Feat->getFullName() << " thrown: " << e.what());
         d->addRecomputeLog(e.what(), Feat);
-        return 1;
+        return stat.finish(1);
     }
 #ifndef FC_DEBUG
     catch (...) {
         FC_ERR("Unknown exception in " << Feat->getFullName() << " thrown");
         d->addRecomputeLog("Unknown exception!", Feat);
-        return 1;
+        return stat.finish(1);
     }
 #endif
 
@@ -3202,9 +3616,9 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
         returnCode->Which = Feat;
         d->addRecomputeLog(returnCode);
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << returnCode->Why);
-        return 1;
+        return stat.finish(1);
     }
-    return 0;
+    return stat.finish(0);
 }
 
 bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
@@ -3283,6 +3697,12 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         return objects;
     }
 
+    // Grow the containers once and report property changes of setupObject() once at the end
+    d->objectArray.reserve(d->objectArray.size() + objects.size());
+    d->objectMap.reserve(d->objectMap.size() + objects.size());
+    d->objectIdMap.reserve(d->objectIdMap.size() + objects.size());
+    BatchUpdate batch(this);
+
     for (auto it = objects.begin(); it != objects.end(); ++it) {
         size_t index = std::distance(objects.begin(), it);
         DocumentObject* pcObject = *it;
@@ -3337,6 +3757,9 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addTypeBucket(pcObject);
+    d->topoSortCacheValid = false;
+    d->objectLabelIndexValid = false;
 
      // do no transactions if we do a rollback!
     if (!d->rollback) {
@@ -3501,6 +3924,9 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
          ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
+            d->removeTypeBucket(pcObject);
+            d->topoSortCacheValid = false;
+            d->objectLabelIndexValid = false;
             break;
         }
     }
@@ -3735,6 +4161,33 @@ DocumentObject* Document::getObject(const char* Name) const
     return pos != d->objectMap.end() ?pos->second:nullptr;
 }
 
+std::vector<DocumentObject*> Document::getObjectsByLabel(const std::string& label) const
+{
+    // expressions may be evaluated by several recompute threads
+    std::lock_guard<std::mutex> lock(d->objectLabelIndexMutex);
+    auto find = [this, &label]() -> const std::vector<DocumentObject*>* {
+        if (!d->objectLabelIndexValid) {
+            d->objectLabelIndex.clear();
+            for (auto obj : d->objectArray) {
+                d->objectLabelIndex[obj->Label.getStrValue()].push_back(obj);
+            }
+            d->objectLabelIndexValid = true;
+        }
+        auto it = d->objectLabelIndex.find(label);
+        return it != d->objectLabelIndex.end() ? &it->second : nullptr;
+    };
+
+    auto objs = find();
+    if (objs && std::ranges::any_of(*objs, [&label](DocumentObject* obj) {
+            return obj->Label.getStrValue() != label;
+        })) {
+        // a label was changed without notifying the document
+        d->objectLabelIndexValid = false;
+        objs = find();
+    }
+    return objs ? *objs : std::vector<DocumentObject*>();
+}
+
 DocumentObject* Document::getObjectByID(const long id) const
 {
     const auto it = d->objectIdMap.find(id);
@@ -3804,29 +4257,88 @@ const std::vector<DocumentObject*>& Document::getObjects() const
     return d->objectArray;
 }
 
-std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
+void DocumentP::addTypeBucket(DocumentObject* obj)
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            Objects.push_back(it);
-        }
+    auto [it, inserted] = typeBuckets.try_emplace(obj->getTypeId().getKey());
+    if (inserted) {
+        // a new type may be derived from any of the cached queries
+        std::lock_guard<std::mutex> lock(typeClosuresMutex);
+        typeClosures.clear();
     }
-    return Objects;
+    it->second.emplace_back(++objectSequence, obj);
 }
 
-std::vector<DocumentObject*> Document::getObjectsOfType(const std::vector<Base::Type>& types) const
+void DocumentP::removeTypeBucket(DocumentObject* obj)
 {
-    std::vector<DocumentObject*> Objects;
-    for (auto it : d->objectArray) {
-        for (auto& typeId : types) {
-            if (it->isDerivedFrom(typeId)) {
-                Objects.push_back(it);
-                break; // Prevent adding several times the same object.
+    auto it = typeBuckets.find(obj->getTypeId().getKey());
+    if (it == typeBuckets.end()) {
+        return;
+    }
+    auto& bucket = it->second;
+    auto pos = std::find_if(bucket.begin(), bucket.end(), [obj](const auto& entry) {
+        return entry.second == obj;
+    });
+    if (pos != bucket.end()) {
+        bucket.erase(pos);
+    }
+}
+
+void DocumentP::clearTypeBuckets()
+{
+    typeBuckets.clear();
+    std::lock_guard<std::mutex> lock(typeClosuresMutex);
+    typeClosures.clear();
+}
+
+std::vector<DocumentObject*>
+DocumentP::getObjectsOfTypes(const std::vector<Base::Type>& types) const
+{
+    // The buckets hold distinct objects, so collecting the union of the
+    // matching bucket types avoids adding the same object several times.
+    std::set<Base::Type::TypeId> keys;
+    std::lock_guard<std::mutex> lock(typeClosuresMutex);
+    for (const auto& typeId : types) {
+        auto it = typeClosures.find(typeId.getKey());
+        if (it == typeClosures.end()) {
+            std::vector<Base::Type::TypeId> closure;
+            for (const auto& [key, bucket] : typeBuckets) {
+                if (Base::Type::fromKey(key).isDerivedFrom(typeId)) {
+                    closure.push_back(key);
+                }
             }
+            it = typeClosures.emplace(typeId.getKey(), std::move(closure)).first;
         }
+        keys.insert(it->second.begin(), it->second.end());
     }
-    return Objects;
+
+    std::vector<std::pair<std::size_t, DocumentObject*>> entries;
+    for (auto key : keys) {
+        const auto& bucket = typeBuckets.at(key);
+        entries.insert(entries.end(), bucket.begin(), bucket.end());
+    }
+    if (keys.size() > 1) {
+        // restore the creation order of the objects as in objectArray
+        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+    }
+
+    std::vector<DocumentObject*> objects;
+    objects.reserve(entries.size());
+    for (const auto& entry : entries) {
+        objects.push_back(entry.second);
+    }
+    return objects;
+}
+
+std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
+{
+    return d->getObjectsOfTypes({typeId});
+}
+
+std::vector<DocumentObject*> Document::getObjectsOfType(const std::vector<Base::Type>& types) const
+{
+    return d->getObjectsOfTypes(types);
 }
 
 std::vector<DocumentObject*> Document::getObjectsWithExtension(const Base::Type& typeId,
@@ -3860,21 +4372,19 @@ Document::findObjects(const Base::Type& typeId, const char* objname, const char*
 
     std::vector<DocumentObject*> Objects;
     DocumentObject* found = nullptr;
-    for (const auto it : d->objectArray) {
-        if (it->isDerivedFrom(typeId)) {
-            found = it;
+    for (const auto it : getObjectsOfType(typeId)) {
+        found = it;
 
-            if (!rx_name.empty() && !boost::regex_search(it->getNameInDocument(), what, rx_name)) {
-                found = nullptr;
-            }
+        if (!rx_name.empty() && !boost::regex_search(it->getNameInDocument(), what, rx_name)) {
+            found = nullptr;
+        }
 
-            if (!rx_label.empty() && !boost::regex_search(it->Label.getValue(), what, rx_label)) {
-                found = nullptr;
-            }
+        if (!rx_label.empty() && !boost::regex_search(it->Label.getValue(), what, rx_label)) {
+            found = nullptr;
+        }
 
-            if (found) {
-                Objects.push_back(found);
-            }
+        if (found) {
+            Objects.push_back(found);
         }
     }
     return Objects;
@@ -3882,9 +4392,7 @@ Document::findObjects(const Base::Type& typeId, const char* objname, const char*
 
 int Document::countObjectsOfType(const Base::Type& typeId) const
 {
-    return std::count_if(d->objectMap.begin(), d->objectMap.end(), [&](const auto& it) {
-        return it.second->isDerivedFrom(typeId);
-    });
+    return static_cast<int>(d->getObjectsOfTypes({typeId}).size());
 }
 
 int Document::countObjectsOfType(const char* typeName) const
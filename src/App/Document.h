@@ -40,7 +40,9 @@
 #include <map>
 #include <vector>
 #include <utility>
+#include <iosfwd>
 #include <list>
+#include <set>
 #include <string>
 
 namespace Base
@@ -87,6 +89,32 @@ class Transaction;
 class StringHasher;
 using StringHasherRef = Base::Reference<StringHasher>;
 
+/**
+ * @brief Timing information about the recomputation of a single object.
+ *
+ * The statistics of the last recompute of a document can be queried with
+ * Document::getRecomputeStats().
+ */
+struct RecomputeStat
+{
+    /// The internal name of the object.
+    std::string Name;
+    /// The type name of the object.
+    std::string TypeName;
+    /// The names of the touched properties or why else the object was recomputed.
+    std::string Reason;
+    /// The start time in seconds relative to the start of the recompute.
+    double Start {0.0};
+    /// The wall time of the object's recompute in seconds.
+    double Duration {0.0};
+    /// The memory size of the object's geometry after the recompute in bytes.
+    std::size_t OutputSize {0};
+    /// The index of the thread the object was recomputed in, 0 is the main thread.
+    int Thread {0};
+    /// 0 if succeeded, 1 if failed, -1 if aborted by user.
+    int Result {0};
+};
+
 /**
  * @brief A class that represents a FreeCAD document.
  *
@@ -190,6 +218,8 @@ public:
     PropertyBool ShowHidden;
     /// Whether to use hasher on topological naming.
     PropertyBool UseHasher;
+    /// Format of the shape files written when saving: Text, Binary or Auto.
+    PropertyEnumeration ShapeFormat;
     /// @}
 
     /** @name Signals of the document
@@ -385,6 +415,28 @@ public:
      */
     void exportGraphviz(std::ostream& out) const;
 
+    /**
+     * @brief Write the dependency graph of this document as JSON.
+     *
+     * Unlike exportGraphviz() the graph is streamed in a single pass over the
+     * out lists of the objects, so it scales to very large documents. The
+     * output has the form:
+     * @code
+     * {"document":"Name","objects":[
+     *   {"id":1,"name":"Box","type":"Part::Box","out":[2],"external":["Doc#Obj"]},
+     *   ...]}
+     * @endcode
+     * where "out" holds the IDs of the linked objects in this document and
+     * "external" the linked objects of other documents.
+     *
+     * @param[in, out] out: The output stream to write to.
+     * @param[in] groupDepth: If not negative, objects nested deeper than this
+     * number of geo feature groups are collapsed into their group at that
+     * depth, i.e. 0 collapses every group into its top level group. The
+     * dependencies of collapsed objects are merged into the group.
+     */
+    void exportDependencies(std::ostream& out, int groupDepth = -1) const;
+
     /**
      * @brief Import objects from a stream.
      *
@@ -493,9 +545,12 @@ public:
      * property.
      *
      * @param[in] sType       The type of created object
-     * @param[in] objectNames A list of object names
+     * @param[in] objectNames A list of object names, empty names are generated from the type
      * @param[in] isNew If false don't call the DocumentObject::setupObject()
      * callback (default is true)
+     *
+     * The property changes made while adding the objects are notified once, as in a
+     * BatchUpdate, and only the last object is activated.
      */
     std::vector<DocumentObject*>
     addObjects(const char* sType, const std::vector<std::string>& objectNames, bool isNew = true);
@@ -585,6 +640,18 @@ public:
      */
     DocumentObject* getObject(const char* Name) const;
 
+    /**
+     * @brief Get the objects with the given label.
+     *
+     * The objects are looked up in an index that is rebuilt after objects or
+     * labels changed, instead of searching all objects.
+     *
+     * @param[in] label The label of the objects to get.
+     *
+     * @return The objects with the label in creation order.
+     */
+    std::vector<DocumentObject*> getObjectsByLabel(const std::string& label) const;
+
     /**
      * @brief Get the object with the given id.
      *
@@ -748,6 +815,48 @@ public:
     /// Get all touched objects.
     std::vector<DocumentObject*> getTouched() const;
 
+    /**
+     * @brief Start coalescing property change notifications.
+     *
+     * Until the matching closeBatchUpdate(), signalChangedObject is not
+     * emitted for each property change. Instead, the changes are collected
+     * and emitted once per changed property of each object when the
+     * outermost batch is closed, in the order of their first change. Calls
+     * can be nested.
+     *
+     * Only the document signal used by observers such as the GUI is
+     * deferred, the objects themselves are notified immediately.
+     *
+     * @see BatchUpdate
+     */
+    void openBatchUpdate();
+
+    /// End a batch started with openBatchUpdate() and emit the collected changes.
+    void closeBatchUpdate();
+
+    /// Check whether a batch of property changes is open.
+    bool isBatchUpdating() const;
+
+    /// Helper class to open a batch of property changes for its lifetime.
+    class BatchUpdate
+    {
+    public:
+        explicit BatchUpdate(Document* doc)
+            : doc(doc)
+        {
+            doc->openBatchUpdate();
+        }
+        ~BatchUpdate()
+        {
+            doc->closeBatchUpdate();
+        }
+        BatchUpdate(const BatchUpdate&) = delete;
+        BatchUpdate& operator=(const BatchUpdate&) = delete;
+
+    private:
+        Document* doc;
+    };
+
     /**
      * @brief Set the document to be closable.
      *
@@ -793,6 +902,26 @@ public:
      */
     bool recomputeFeature(DocumentObject* Feat, bool recursive = false);
 
+    /**
+     * @brief Get the timing of the objects of the last recompute.
+     *
+     * The statistics are reset at the beginning of every recompute() and are
+     * always collected, independent of the profiler the application is built with.
+     *
+     * @return One entry per recomputed object in the order the objects finished.
+     */
+    std::vector<RecomputeStat> getRecomputeStats() const;
+
+    /**
+     * @brief Write the statistics of the last recompute as Chrome trace.
+     *
+     * The output is in the JSON trace event format that can be loaded
+     * into chrome://tracing or https://ui.perfetto.dev.
+     *
+     * @param[in,out] out The stream to write to.
+     */
+    void writeRecomputeTrace(std::ostream& out) const;
+
     /**
      * @brief Get the text of the error for a specified object.
      * @param[in] Obj The object to get the error text for.
@@ -928,15 +1057,23 @@ public:
 
     /**
      * @brief Set the undo limit.
-     * @param[in] UndoMemSize The maximum memory in bytes.
+     *
+     * If the undo and redo stacks use more memory, large property copies of
+     * older transactions are moved to temporary files. If this is not enough
+     * the oldest transactions are removed.
+     *
+     * @param[in] UndoMemSize The maximum memory in bytes, 0 means no limit.
      */
-    void setUndoLimit(unsigned int UndoMemSize = 0);
+    void setUndoLimit(std::size_t UndoMemSize = 0);
+
+    /// Get the undo limit in bytes.
+    std::size_t getUndoLimit() const;
 
     /**
      * @brief Get the undo memory size.
-     * @return The memory used by the undo stack in bytes.
+     * @return The memory used by the undo and redo stacks in bytes.
      */
-    unsigned int getUndoMemSize() const;
+    std::size_t getUndoMemSize() const;
 
     /**
      * @brief Set the Undo limit as stack size.
@@ -1121,6 +1258,9 @@ public:
      * For more information on topological sorting see
      * https://en.wikipedia.org/wiki/Topological_sorting.
      *
+     * The result is cached and only rebuilt after objects were added or
+     * removed, or after a link of an object of this document has changed.
+     *
      * @return A list of the topologically sorted objects of this document.
      */
     std::vector<DocumentObject*> topologicalSort() const;
@@ -1395,9 +1535,39 @@ protected:
      */
     int _recomputeFeature(DocumentObject* Feat);
 
+    /**
+     * @brief Recompute a batch of independent objects in worker threads.
+     *
+     * The batch starts at @p idx and contains all consecutive objects of the
+     * same dependency level that allow a concurrent recompute.
+     *
+     * @param[in] objs The objects sorted by dependency level.
+     * @param[in] levels The dependency level of each object in @p objs.
+     * @param[in] idx The index of the first object of the batch.
+     * @param[in] filter Objects that must be skipped.
+     * @param[out] results The return value of _recomputeFeature() for each
+     * recomputed object.
+     *
+     * @return The index past the last object of the batch.
+     */
+    size_t _recomputeConcurrently(const std::vector<DocumentObject*>& objs,
+                                  const std::vector<int>& levels,
+                                  size_t idx,
+                                  const std::set<DocumentObject*>& filter,
+                                  std::map<DocumentObject*, int>& results);
+
+    /// Check if the calling thread recomputes an object for a concurrent recompute.
+    static bool _isConcurrentRecomputeThread();
+
+    /// Invalidate the cached topological order after the object graph has changed.
+    void _invalidateTopologicalSort() const;
+
     /// Clear the redos.
     void _clearRedos();
 
+    /// Reduce the memory of the undo stack to the limit set by setUndoLimit().
+    void _applyUndoLimit();
+
     /**
      * @brief Get the name of the transient directory for a given UUID and filename.
      *
@@ -160,6 +160,17 @@ class Document(PropertyContainer):
         """
         ...
 
+    def exportDependencies(self, path: str = None, groupDepth: int = -1, /) -> str | None:
+        """
+        Export the dependencies of the objects as JSON.
+
+        The export is streamed in a single pass and scales to very large documents.
+        If groupDepth is not negative, objects nested deeper than groupDepth geo
+        feature groups are collapsed into their group at that depth.
+        If path is passed, the graph is written to it. if not a string is returned.
+        """
+        ...
+
     def openTransaction(self, name: str, /) -> None:
         """
         Open a new Undo/Redo transaction.
@@ -184,6 +195,23 @@ class Document(PropertyContainer):
         """
         ...
 
+    def openBatchUpdate(self) -> None:
+        """
+        Start coalescing property change notifications.
+
+        Until the matching closeBatchUpdate(), observers such as the GUI are
+        not notified of each property change. Instead, each changed property is
+        reported once when the outermost batch is closed. Calls can be nested.
+        Use try/finally to make sure the batch is closed.
+        """
+        ...
+
+    def closeBatchUpdate(self) -> None:
+        """
+        End a batch started with openBatchUpdate() and notify the collected changes.
+        """
+        ...
+
     def addObject(
         self,
         type: str,
@@ -209,6 +237,31 @@ class Document(PropertyContainer):
         """
         ...
 
+    def addObjects(
+        self,
+        type: str,
+        names: int | Sequence[str],
+        properties: dict | Sequence[dict] = None,
+    ) -> list[DocumentObject]:
+        """
+        Add many objects of the same type to the document at once.
+
+        This is much faster than calling addObject() in a loop. Property changes are
+        notified once at the end, as with openBatchUpdate(), and only the last object
+        is activated.
+
+        Args:
+            type: the type of the document objects to create.
+            names: the number of objects to create with names generated from the type,
+                   or a list of names where empty names are generated from the type.
+            properties: a dict of property values set on every object, or a list with
+                        one such dict per object.
+
+        Returns:
+            The list of new objects.
+        """
+        ...
+
     def addProperty(
         self,
         type: str,
@@ -361,6 +414,24 @@ class Document(PropertyContainer):
         """
         ...
 
+    def getRecomputeStats(self) -> list[dict]:
+        """
+        Returns the timing of the objects recomputed by the last recompute.
+
+        Each entry is a dictionary with the keys Name, TypeId, Reason, Start,
+        Duration, OutputSize, Thread and Result. Start and Duration are in
+        seconds, OutputSize is the memory size of the object's geometry in bytes.
+        """
+        ...
+
+    def saveRecomputeTrace(self, filename: str, /) -> None:
+        """
+        Saves the timing of the last recompute as Chrome trace JSON file.
+
+        The file can be opened with chrome://tracing or https://ui.perfetto.dev.
+        """
+        ...
+
     def mustExecute(self) -> bool:
         """
         Check if any object must be recomputed
@@ -23,12 +23,17 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <stack>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <set>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 #include <string>
+#include <boost/functional/hash.hpp>
 
 #include <Base/Console.h>
 #include <Base/Matrix.h>
@@ -64,9 +69,46 @@ DocumentObjectExecReturn* DocumentObject::StdReturn = nullptr;
 // DocumentObject
 //===========================================================================
 
+namespace
+{
+// Cache of DocumentObject::getSubObjectCached(). Instead of tracking which
+// changes affect which subname, the whole cache is dropped on any property
+// change or object creation/deletion, as these are rare compared to lookups.
+using SubObjectKey = std::tuple<const DocumentObject*, std::string, bool>;
+
+struct SubObjectKeyHasher
+{
+    std::size_t operator()(const SubObjectKey& key) const
+    {
+        std::size_t seed = std::hash<const void*>()(std::get<0>(key));
+        boost::hash_combine(seed, std::get<1>(key));
+        boost::hash_combine(seed, std::get<2>(key));
+        return seed;
+    }
+};
+
+struct SubObjectValue
+{
+    DocumentObject* obj;
+    Base::Matrix4D mat;
+};
+
+constexpr std::size_t subObjectCacheLimit = 100000;
+std::atomic<std::size_t> subObjectEpoch {1};
+std::mutex subObjectCacheMutex;
+std::size_t subObjectCacheEpoch {0};
+std::unordered_map<SubObjectKey, SubObjectValue, SubObjectKeyHasher> subObjectCache;
+
+void invalidateSubObjectCache()
+{
+    ++subObjectEpoch;
+}
+}  // namespace
+
 DocumentObject::DocumentObject()
     : ExpressionEngine()
 {
+    invalidateSubObjectCache();
     // define Label of type 'Output' to avoid being marked as touched after relabeling
     ADD_PROPERTY_TYPE(Label, ("Unnamed"), "Base", Prop_Output, "User name of the object (UTF8)");
     ADD_PROPERTY_TYPE(Label2, (""), "Base", Prop_Hidden, "User description of the object (UTF8)");
@@ -85,6 +127,7 @@ DocumentObject::DocumentObject()
 
 DocumentObject::~DocumentObject()
 {
+    invalidateSubObjectCache();
     if (!PythonObject.is(Py::_None())) {
         Base::PyGILStateLocker lock;
         // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
@@ -767,7 +810,9 @@ void DocumentObject::onBeforeChange(const Property* prop)
         onBeforeChangeProperty(_pDoc, prop);
     }
 
-    signalBeforeChange(*this, *prop);
+    if (!Document::_isConcurrentRecomputeThread()) {
+        signalBeforeChange(*this, *prop);
+    }
 }
 
 std::vector<std::pair<Property*, std::unique_ptr<Property>>>
@@ -858,6 +903,9 @@ void DocumentObject::onEarlyChange(const Property* prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    invalidateSubObjectCache();
+    StatusBits.set(ObjectStatus::PropertyChanged);
+
     if (prop == &Label && _pDoc && _pDoc->containsObject(this) && oldLabel != Label.getStrValue()) {
         _pDoc->unregisterLabel(oldLabel);
         _pDoc->registerLabel(Label.getStrValue());
@@ -911,7 +959,10 @@ void DocumentObject::onChanged(const Property* prop)
         _pDoc->onChangedProperty(this, prop);
     }
 
-    signalChanged(*this, *prop);
+    // when recomputed in a worker thread the document replays the signal later
+    if (!Document::_isConcurrentRecomputeThread()) {
+        signalChanged(*this, *prop);
+    }
 }
 
 void DocumentObject::clearOutListCache() const
@@ -919,6 +970,9 @@ void DocumentObject::clearOutListCache() const
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    if (_pDoc) {
+        _pDoc->_invalidateTopologicalSort();
+    }
 }
 
 PyObject* DocumentObject::getPyObject()
@@ -989,6 +1043,47 @@ DocumentObject* DocumentObject::getSubObject(const char* subname,
     return ret;
 }
 
+DocumentObject* DocumentObject::getSubObjectCached(const char* subname,
+                                                   Base::Matrix4D* mat,
+                                                   bool transform) const
+{
+    if (!subname || !*subname) {
+        return getSubObject(subname, nullptr, mat, transform);
+    }
+    SubObjectKey key(this, subname, transform);
+    {
+        std::lock_guard<std::mutex> lock(subObjectCacheMutex);
+        if (subObjectCacheEpoch != subObjectEpoch || subObjectCache.size() > subObjectCacheLimit) {
+            subObjectCache.clear();
+            subObjectCacheEpoch = subObjectEpoch;
+        }
+        auto it = subObjectCache.find(key);
+        if (it != subObjectCache.end()) {
+            if (mat) {
+                *mat *= it->second.mat;
+            }
+            return it->second.obj;
+        }
+    }
+
+    // The transformation accumulated along the path does not depend on the
+    // input one, so resolve with identity and apply the result afterwards.
+    std::size_t epoch = subObjectEpoch;
+    Base::Matrix4D subMat;
+    auto obj = getSubObject(subname, nullptr, &subMat, transform);
+    {
+        std::lock_guard<std::mutex> lock(subObjectCacheMutex);
+        // do not cache anything resolved while some object was changing
+        if (epoch == subObjectEpoch && subObjectCacheEpoch == epoch) {
+            subObjectCache.emplace(std::move(key), SubObjectValue {obj, subMat});
+        }
+    }
+    if (mat) {
+        *mat *= subMat;
+    }
+    return obj;
+}
+
 namespace
 {
 std::vector<DocumentObject*>
@@ -1267,6 +1362,9 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     if (it != _inList.end()) {
         _inList.erase(it);
     }
+    if (_pDoc) {
+        _pDoc->_invalidateTopologicalSort();
+    }
 }
 
 void App::DocumentObject::_addBackLink(DocumentObject* newObj)
@@ -1276,6 +1374,9 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    if (_pDoc) {
+        _pDoc->_invalidateTopologicalSort();
+    }
 }
 
 int DocumentObject::setElementVisible(const char* element, bool visible)
@@ -1329,7 +1430,8 @@ DocumentObject* DocumentObject::resolve(const char* subname,
         *subElement = nullptr;
     }
 
-    auto obj = getSubObject(subname, pyObj, pmat, transform, depth);
+    auto obj = (!pyObj && depth == 0) ? getSubObjectCached(subname, pmat, transform)
+                                      : getSubObject(subname, pyObj, pmat, transform, depth);
     if (!obj || !subname || *subname == 0) {
         return self;
     }
@@ -80,6 +80,8 @@ enum ObjectStatus
     RecomputeExtension = 19, ///< Whether the extensions of this object should be recomputed.
     TouchOnColorChange = 20, ///< Whether the object should be touched on color change.
     Freeze = 21, ///< Whether the object is frozen and is excluded from recomputation.
+    PropertyChanged = 22, ///< Whether a property of the object has changed since its last recompute.
+    OutputUnchanged = 23, ///< Whether the last recompute of the object reproduced its previous output.
 };
 // clang-format on
 
@@ -794,6 +796,26 @@ public:
                                          bool transform = true,
                                          int depth = 0) const;
 
+    /**
+     * @brief Get the sub object by name, using a cache.
+     *
+     * This is the same as getSubObject() without a Python object, but the
+     * resolved object and the transformation accumulated along @p subname are
+     * cached. The cache is invalidated whenever a property of any object
+     * changes, or an object is created or deleted. Use it in hot paths that
+     * repeatedly resolve the same subnames, e.g. for preselection.
+     *
+     * @param[in] subname A dot separated name to refer to a sub object.
+     * @param[in,out] mat If not null, the accumulated transformation is
+     * multiplied to it, like in getSubObject().
+     * @param[in] transform If false, do not apply the object's own placement.
+     *
+     * @return The last document object referred in subname, or @c nullptr.
+     */
+    DocumentObject* getSubObjectCached(const char* subname,
+                                       Base::Matrix4D* mat = nullptr,
+                                       bool transform = true) const;
+
     /**
      * @brief Get a list of objects referenced by a given subname.
      *
@@ -938,6 +960,25 @@ public:
         return false;
     }
 
+    /**
+     * @brief Check whether this object may be recomputed in a worker thread.
+     *
+     * When parallel recompute is enabled for a document, objects that are
+     * independent of each other and return true here are executed
+     * concurrently. Property change notifications emitted during such an
+     * execution are deferred and replayed in the main thread once the
+     * object has finished.
+     *
+     * Objects that need the Python interpreter, the GUI or any other shared
+     * state during execute() must return false, which is the default.
+     *
+     * @return true if the object can be recomputed concurrently, false otherwise.
+     */
+    virtual bool allowConcurrentRecompute() const
+    {
+        return false;
+    }
+
     /**
      * @brief Called when a new label for the document object is proposed.
      *
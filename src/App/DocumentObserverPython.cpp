@@ -22,8 +22,11 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <functional>
 
+#include <QCoreApplication>
+
 #include <CXX/Objects.hxx>
 #include "Application.h"
 #include "Document.h"
@@ -37,6 +40,26 @@ namespace sp = std::placeholders;
 
 std::vector<DocumentObserverPython*> DocumentObserverPython::_instances;
 
+namespace
+{
+void readNames(const Py::Object& obj, const char* attr, std::set<std::string, std::less<>>& names)
+{
+    if (!obj.hasAttr(attr)) {
+        return;
+    }
+    try {
+        Py::Sequence seq(obj.getAttr(attr));
+        for (const auto& item : seq) {
+            names.insert(Py::String(item).as_std_string("utf-8"));
+        }
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.reportException();
+    }
+}
+}  // namespace
+
 void DocumentObserverPython::addObserver(const Py::Object& obj)
 {
     _instances.push_back(new DocumentObserverPython(obj));
@@ -117,6 +140,15 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj)
     FC_PY_ELEMENT_ARG2(BeforeAddingDynamicExtension, BeforeAddingDynamicExtension)
     FC_PY_ELEMENT_ARG2(AddedDynamicExtension, AddedDynamicExtension)
     // NOLINTEND
+
+    FC_PY_GetCallable(obj.ptr(), "slotChangedObjects", pyChangedObjects.py);
+    if (!pyChangedObjects.py.isNone() && pyChangedObject.py.isNone()) {
+        pyChangedObjects.slot = App::GetApplication().signalChangedObject.connect(
+            std::bind(&DocumentObserverPython::slotChangedObject, this, sp::_1, sp::_2));
+    }
+
+    readNames(obj, "observedObjects", observedObjects);
+    readNames(obj, "observedProperties", observedProperties);
 }
 
 DocumentObserverPython::~DocumentObserverPython() = default;
@@ -328,9 +360,82 @@ void DocumentObserverPython::slotDeletedObject(const App::DocumentObject& Obj)
     }
 }
 
+bool DocumentObserverPython::isObserved(const App::DocumentObject& Obj,
+                                        const char* propName) const
+{
+    if (!propName) {
+        return false;
+    }
+    if (!observedProperties.empty() && !observedProperties.contains(propName)) {
+        return false;
+    }
+    if (!observedObjects.empty()) {
+        const char* objName = Obj.getNameInDocument();
+        return objName && observedObjects.contains(objName);
+    }
+    return true;
+}
+
+void DocumentObserverPython::queueChangedObject(const App::DocumentObject& Obj,
+                                                const char* propName)
+{
+    if (!changedObjectSet.emplace(&Obj, propName).second) {
+        return;
+    }
+    {
+        Base::PyGILStateLocker lock;
+        changedObjects.emplace_back(
+            Py::asObject(const_cast<App::DocumentObject&>(Obj).getPyObject()),
+            propName);
+    }
+    if (changedObjects.size() > 1) {
+        return;  // already scheduled
+    }
+
+    QCoreApplication* app = QCoreApplication::instance();
+    if (!app) {
+        flushChangedObjects();
+        return;
+    }
+    QMetaObject::invokeMethod(
+        app,
+        [this]() {
+            // the observer may have been removed in the meantime
+            if (std::ranges::find(_instances, this) != _instances.end()) {
+                flushChangedObjects();
+            }
+        },
+        Qt::QueuedConnection);
+}
+
+void DocumentObserverPython::flushChangedObjects()
+{
+    Base::PyGILStateLocker lock;
+    auto changes = std::move(changedObjects);
+    changedObjects.clear();
+    changedObjectSet.clear();
+
+    try {
+        Py::List list;
+        for (const auto& change : changes) {
+            list.append(Py::TupleN(change.first, Py::String(change.second)));
+        }
+        Py::Tuple args(1);
+        args.setItem(0, list);
+        Base::pyCall(pyChangedObjects.ptr(), args.ptr());
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.reportException();
+    }
+}
+
 void DocumentObserverPython::slotBeforeChangeObject(const App::DocumentObject& Obj,
                                                     const App::Property& Prop)
 {
+    if (!isObserved(Obj, Obj.getPropertyName(&Prop))) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
@@ -352,6 +457,16 @@ void DocumentObserverPython::slotBeforeChangeObject(const App::DocumentObject& O
 void DocumentObserverPython::slotChangedObject(const App::DocumentObject& Obj,
                                                const App::Property& Prop)
 {
+    const char* propName = Obj.getPropertyName(&Prop);
+    if (!isObserved(Obj, propName)) {
+        return;
+    }
+    if (!pyChangedObjects.py.isNone()) {
+        queueChangedObject(Obj, propName);
+        if (pyChangedObject.py.isNone()) {
+            return;
+        }
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
@@ -28,7 +28,9 @@
 #include <FCGlobal.h>
 #include <fastsignals/signal.h>
 #include <CXX/Objects.hxx>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace App
@@ -44,6 +46,12 @@ class Property;
  * whenever something happens to a document, like creation, destruction, adding or
  * removing objects or when property changes.
  *
+ * Only the slots the Python instance implements are connected. Property changes can be
+ * restricted with the optional attributes observedObjects and observedProperties, lists of
+ * object and property names, which are checked before the Python interpreter is locked.
+ * A slotChangedObjects(changes) method receives the changes collected during one event loop
+ * iteration as a list of (object, property name) tuples, each pair reported once.
+ *
  * @author Werner Mayer
  */
 class AppExport DocumentObserverPython
@@ -117,6 +125,12 @@ private:
     /** Called when an object gets a dynamic extension added*/
     void slotAddedDynamicExtension(const App::ExtensionContainer&, std::string extension);
 
+    /// Returns false if the property change is filtered out by observedObjects/Properties
+    bool isObserved(const App::DocumentObject& Obj, const char* propName) const;
+    /// Collects a change for slotChangedObjects
+    void queueChangedObject(const App::DocumentObject& Obj, const char* propName);
+    /// Calls slotChangedObjects with the collected changes
+    void flushChangedObjects();
 
 private:
     Py::Object inst;
@@ -161,6 +175,13 @@ private:
     Connection pyChangePropertyEditor;
     Connection pyBeforeAddingDynamicExtension;
     Connection pyAddedDynamicExtension;
+    Connection pyChangedObjects;
+
+    std::set<std::string, std::less<>> observedObjects;
+    std::set<std::string, std::less<>> observedProperties;
+    // changes collected for slotChangedObjects, by object identity and property name
+    std::vector<std::pair<Py::Object, std::string>> changedObjects;
+    std::set<std::pair<const void*, std::string>> changedObjectSet;
 };
 
 }  // namespace App
@@ -313,6 +313,29 @@ PyObject* DocumentPy::exportGraphviz(PyObject* args)
     }
 }
 
+PyObject* DocumentPy::exportDependencies(PyObject* args)
+{
+    char* fn = nullptr;
+    int groupDepth = -1;
+    if (!PyArg_ParseTuple(args, "|zi", &fn, &groupDepth)) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        if (fn) {
+            Base::FileInfo fi(fn);
+            Base::ofstream str(fi);
+            getDocumentPtr()->exportDependencies(str, groupDepth);
+            str.close();
+            Py_Return;
+        }
+        std::stringstream str;
+        getDocumentPtr()->exportDependencies(str, groupDepth);
+        return PyUnicode_FromString(str.str().c_str());
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
 {
     char *sType, *sName = nullptr, *sViewType = nullptr;
@@ -409,6 +432,94 @@ PyObject* DocumentPy::addObject(PyObject* args, PyObject* kwd)
     return pcFtr->getPyObject();
 }
 
+PyObject* DocumentPy::addObjects(PyObject* args, PyObject* kwd)
+{
+    char* sType {};
+    PyObject* names {};
+    PyObject* properties = Py_None;
+    static const std::array<const char*, 4> kwlist {"type", "names", "properties", nullptr};
+    if (!Base::Wrapped_ParseTupleAndKeywords(args,
+                                             kwd,
+                                             "sO|O",
+                                             kwlist,
+                                             &sType,
+                                             &names,
+                                             &properties)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        std::vector<std::string> objectNames;
+        if (PyLong_Check(names)) {
+            long count = PyLong_AsLong(names);
+            if (count < 0) {
+                throw Py::ValueError("The number of objects must not be negative");
+            }
+            objectNames.resize(count);
+        }
+        else {
+            Py::Sequence seq(names);
+            objectNames.reserve(seq.size());
+            for (const auto& item : seq) {
+                objectNames.push_back(Py::String(item).as_std_string("utf-8"));
+            }
+        }
+
+        // either one dict for all objects or one per object
+        std::vector<Py::Object> values;
+        if (PyDict_Check(properties)) {
+            values.emplace_back(properties);
+        }
+        else if (properties != Py_None) {
+            Py::Sequence seq(properties);
+            if (seq.size() != static_cast<Py_ssize_t>(objectNames.size())) {
+                throw Py::ValueError("Expected one property dict per object");
+            }
+            for (const auto& item : seq) {
+                if (!PyDict_Check(item.ptr())) {
+                    throw Py::TypeError("Expected a dict of property values");
+                }
+                values.emplace_back(item);
+            }
+        }
+
+        Document* doc = getDocumentPtr();
+        Document::BatchUpdate batch(doc);
+        std::vector<DocumentObject*> objects = doc->addObjects(sType, objectNames);
+        if (objects.size() != objectNames.size()) {
+            std::stringstream str;
+            str << "No document object found of type '" << sType << "'";
+            throw Py::TypeError(str.str());
+        }
+
+        Py::List list(static_cast<Py_ssize_t>(objects.size()));
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            DocumentObject* obj = objects[i];
+            if (!values.empty()) {
+                PyObject* dict = values[values.size() == 1 ? 0 : i].ptr();
+                PyObject* key {};
+                PyObject* value {};
+                Py_ssize_t pos = 0;
+                while (PyDict_Next(dict, &pos, &key, &value)) {
+                    const char* name = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : nullptr;
+                    Property* prop = name ? obj->getPropertyByName(name) : nullptr;
+                    if (!prop) {
+                        std::stringstream str;
+                        str << "Object '" << obj->getNameInDocument() << "' has no property '"
+                            << (name ? name : "") << "'";
+                        throw Py::AttributeError(str.str());
+                    }
+                    prop->setPyObject(value);
+                }
+            }
+            list.setItem(static_cast<Py_ssize_t>(i), Py::asObject(obj->getPyObject()));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::removeObject(PyObject* args)
 {
     char* sName {};
@@ -613,6 +724,28 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::openBatchUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->openBatchUpdate();
+    Py_Return;
+}
+
+PyObject* DocumentPy::closeBatchUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->closeBatchUpdate();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
@@ -753,6 +886,56 @@ PyObject* DocumentPy::recompute(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::getRecomputeStats(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        Py::List ret;
+        for (const auto& stat : getDocumentPtr()->getRecomputeStats()) {
+            Py::Dict dict;
+            dict.setItem("Name", Py::String(stat.Name));
+            dict.setItem("TypeId", Py::String(stat.TypeName));
+            dict.setItem("Reason", Py::String(stat.Reason));
+            dict.setItem("Start", Py::Float(stat.Start));
+            dict.setItem("Duration", Py::Float(stat.Duration));
+            dict.setItem("OutputSize", Py::Long(static_cast<unsigned long>(stat.OutputSize)));
+            dict.setItem("Thread", Py::Long(stat.Thread));
+            dict.setItem("Result", Py::Long(stat.Result));
+            ret.append(dict);
+        }
+        return Py::new_reference_to(ret);
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::saveRecomputeTrace(PyObject* args)
+{
+    char* fn {};
+    if (!PyArg_ParseTuple(args, "et", "utf-8", &fn)) {
+        return nullptr;
+    }
+
+    std::string utf8Name = fn;
+    PyMem_Free(fn);
+
+    PY_TRY
+    {
+        Base::FileInfo fi(utf8Name);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary);
+        if (!str) {
+            PyErr_Format(PyExc_IOError, "Cannot open file '%s'", utf8Name.c_str());
+            return nullptr;
+        }
+        getDocumentPtr()->writeRecomputeTrace(str);
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 PyObject* DocumentPy::mustExecute(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -817,12 +1000,8 @@ PyObject* DocumentPy::getObjectsByLabel(PyObject* args)
     }
 
     Py::List list;
-    std::string name = sName;
-    std::vector<DocumentObject*> objs = getDocumentPtr()->getObjects();
-    for (auto obj : objs) {
-        if (name == obj->Label.getValue()) {
-            list.append(Py::asObject(obj->getPyObject()));
-        }
+    for (auto obj : getDocumentPtr()->getObjectsByLabel(sName)) {
+        list.append(Py::asObject(obj->getPyObject()));
     }
 
     return Py::new_reference_to(list);
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -386,6 +387,7 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         stream >> std::hex;
 
         indices.names.resize(outerCount);
+        this->mappedNames.reserve(this->mappedNames.size() + outerCount);
         for (int j = 0; j < outerCount; ++j) {
             idx.setIndex(j);
             auto* ref = &indices.names[j];
@@ -1078,8 +1080,14 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
         }
     }
 
-    for (auto& mappedName : this->mappedNames) {
-        addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
+    // Walk the names in index order rather than hash order to keep the
+    // postfix numbering of the saved map stable.
+    for (auto& indexedName : this->indexedNames) {
+        for (auto& ref : indexedName.second.names) {
+            for (auto* nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
+                addPostfix(nameRef->name.constPostfix(), postfixMap, postfixes);
+            }
+        }
     }
 
     childMaps.push_back(this);
@@ -1312,6 +1320,9 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    std::sort(ret.begin(), ret.end(), [](const MappedElement& lhs, const MappedElement& rhs) {
+        return lhs.name < rhs.name;
+    });
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
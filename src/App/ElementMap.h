@@ -36,6 +36,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 
 namespace Data
@@ -75,7 +76,9 @@ typedef std::function<bool(const MappedName&, int, long, long)> TraceCallback;
  * - `indexedNames` maps a string to both a name queue and children.  Each of
  * those children store an IndexedName, offset details, postfix, ids, and
  * possibly a recursive elementmap.
- * - `mappedNames` maps a MappedName to a specific IndexedName.
+ * - `mappedNames` maps a MappedName to a specific IndexedName. It is a hash
+ * table, because reverse lookups by name are by far the most frequent
+ * operation during topological naming. Use getAll() for a sorted listing.
  */
 class AppExport ElementMap
     : public std::enable_shared_from_this<ElementMap>  // TODO can remove shared_from_this?
@@ -399,7 +402,7 @@ private:
 
     std::map<const char*, IndexedElements, CStringComp> indexedNames;
 
-    std::map<MappedName, IndexedName, std::less<>> mappedNames;
+    std::unordered_map<MappedName, IndexedName, MappedName::Hasher> mappedNames;
 
     struct ChildMapInfo
     {
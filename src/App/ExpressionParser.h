@@ -650,6 +650,9 @@ AppExport bool isModuleImported(PyObject*);
 
 /**
  * @brief The semantic_type class encapsulates the value in the parse tree during parsing.
+ *
+ * The parser keeps a stack of a few hundred of these values, which is constructed on each
+ * call. So only add members that the grammar uses and that don't allocate on construction.
  */
 
 class semantic_type
@@ -663,7 +666,6 @@ public:
     Expression::Component* component {nullptr};
     Expression* expr {nullptr};
     ObjectIdentifier path;
-    std::deque<ObjectIdentifier::Component> components;
     long long int ivalue {0};
     double fvalue {0};
     struct
@@ -672,7 +674,6 @@ public:
         double fvalue = 0;
     } constant;
     std::vector<Expression*> arguments;
-    std::vector<Expression*> list;
     std::string string;
     std::pair<FunctionExpression::Function, std::string> func;
     ObjectIdentifier::String string_or_identifier;
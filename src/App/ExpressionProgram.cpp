@@ -0,0 +1,478 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#include <App/Application.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+
+#include "ExpressionProgram.h"
+#include "ExpressionParser.h"
+
+
+using namespace App;
+
+namespace
+{
+std::atomic<std::size_t> programEpoch {1};
+
+// Integer results close to or outside of the range of long cannot be converted
+// back by pyObjectToAny() and are left to the interpreter. The limit is half
+// the range to be safe against rounding of the double used for the check.
+constexpr double maxLong = static_cast<double>(std::numeric_limits<long>::max()) / 2;
+
+// Python divides integers with correct rounding, which matches a plain
+// double division only as long as both operands are exactly representable
+constexpr double maxExactInt = 9007199254740992.0;  // 2^53
+
+bool exceedsLong(double value)
+{
+    return std::fabs(value) >= maxLong;
+}
+
+void connectInvalidation()
+{
+    // may be called from the worker threads of a concurrent recompute
+    static const bool inited = [] {
+        auto invalidate = [](auto&&...) {
+            ExpressionProgram::invalidateAll();
+        };
+        auto& app = GetApplication();
+        app.signalNewDocument.connect(invalidate);
+        app.signalDeleteDocument.connect(invalidate);
+        app.signalRelabelDocument.connect(invalidate);
+        app.signalRenameDocument.connect(invalidate);
+        app.signalNewObject.connect(invalidate);
+        app.signalDeletedObject.connect(invalidate);
+        app.signalRelabelObject.connect(invalidate);
+        app.signalAppendDynamicProperty.connect(invalidate);
+        app.signalRemoveDynamicProperty.connect(invalidate);
+        app.signalRenameDynamicProperty.connect(invalidate);
+        return true;
+    }();
+    (void)inited;
+}
+
+bool isConstant(const Expression* expr)
+{
+    Base::Type type = expr->getTypeId();
+    return type == NumberExpression::getClassTypeId()
+        || type == UnitExpression::getClassTypeId();
+}
+}  // namespace
+
+std::size_t ExpressionProgram::currentEpoch()
+{
+    connectInvalidation();
+    return programEpoch;
+}
+
+void ExpressionProgram::invalidateAll()
+{
+    ++programEpoch;
+}
+
+std::unique_ptr<ExpressionProgram> ExpressionProgram::compile(const Expression* expr)
+{
+    if (!expr) {
+        return {};
+    }
+
+    std::unique_ptr<ExpressionProgram> program(new ExpressionProgram());
+    try {
+        program->result = program->compileNode(expr);
+    }
+    catch (...) {
+        return {};
+    }
+    if (program->result < 0) {
+        return {};
+    }
+    return program;
+}
+
+int ExpressionProgram::addRegister(Kind kind)
+{
+    kinds.push_back(kind);
+    registers.emplace_back();
+    return static_cast<int>(kinds.size()) - 1;
+}
+
+int ExpressionProgram::convert(int reg, Kind kind)
+{
+    if (reg < 0 || kinds[reg] == kind) {
+        return reg;
+    }
+
+    OpCode op {};
+    if (kinds[reg] == Kind::Int && kind == Kind::Float) {
+        op = OpCode::IntToFloat;
+    }
+    else if (kinds[reg] == Kind::Int && kind == Kind::Quantity) {
+        op = OpCode::IntToQuantity;
+    }
+    else if (kinds[reg] == Kind::Float && kind == Kind::Quantity) {
+        op = OpCode::FloatToQuantity;
+    }
+    else {
+        return -1;
+    }
+
+    int dst = addRegister(kind);
+    code.push_back({op, dst, reg, reg, nullptr});
+    return dst;
+}
+
+int ExpressionProgram::compileNode(const Expression* expr)
+{
+    // Components like '.x' or '[0]' are applied to Python objects
+    if (expr->hasComponent()) {
+        return -1;
+    }
+
+    Base::Type type = expr->getTypeId();
+    if (isConstant(expr)
+        || (type == ConstantExpression::getClassTypeId()
+            && static_cast<const ConstantExpression*>(expr)->isNumber())) {
+        // Same conversion as pyFromQuantity()
+        const Base::Quantity& quantity = static_cast<const UnitExpression*>(expr)->getQuantity();
+        if (!quantity.isDimensionless()) {
+            int reg = addRegister(Kind::Quantity);
+            registers[reg].q = quantity;
+            return reg;
+        }
+        double value = quantity.getValue();
+        double intpart {};
+        if (std::modf(value, &intpart) != 0.0) {
+            int reg = addRegister(Kind::Float);
+            registers[reg].d = value;
+            return reg;
+        }
+        if (intpart < std::numeric_limits<int>::min() || intpart > std::numeric_limits<int>::max()) {
+            return -1;
+        }
+        int reg = addRegister(Kind::Int);
+        registers[reg].i = static_cast<long>(intpart);
+        return reg;
+    }
+
+    if (type == VariableExpression::getClassTypeId()) {
+        ObjectIdentifier path = static_cast<const VariableExpression*>(expr)->getPath();
+        if (path.numSubComponents() != 0) {
+            return -1;
+        }
+        int ptype = 0;
+        const Property* prop = path.getProperty(&ptype);
+        if (!prop || ptype != 0) {
+            return -1;
+        }
+
+        // Same types as returned by getPyObject() of the property
+        Kind kind {};
+        OpCode op {};
+        if (prop->isDerivedFrom<PropertyQuantity>()) {
+            kind = Kind::Quantity;
+            op = OpCode::LoadQuantity;
+        }
+        else if (prop->isDerivedFrom<PropertyFloat>()) {
+            kind = Kind::Float;
+            op = OpCode::LoadFloat;
+        }
+        else if (prop->isDerivedFrom<PropertyInteger>()) {
+            kind = Kind::Int;
+            op = OpCode::LoadInt;
+        }
+        else {
+            return -1;
+        }
+        int dst = addRegister(kind);
+        code.push_back({op, dst, dst, dst, prop});
+        return dst;
+    }
+
+    if (type != OperatorExpression::getClassTypeId()) {
+        return -1;
+    }
+
+    auto opExpr = static_cast<const OperatorExpression*>(expr);
+    int lhs = compileNode(opExpr->getLeft());
+    if (lhs < 0) {
+        return -1;
+    }
+
+    switch (opExpr->getOperator()) {
+        case OperatorExpression::POS:
+            return lhs;
+        case OperatorExpression::NEG: {
+            static const OpCode ops[] = {OpCode::NegInt, OpCode::NegFloat, OpCode::NegQuantity};
+            Kind kind = kinds[lhs];
+            int dst = addRegister(kind);
+            code.push_back({ops[static_cast<int>(kind)], dst, lhs, lhs, nullptr});
+            return dst;
+        }
+        case OperatorExpression::ADD:
+        case OperatorExpression::SUB:
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+        case OperatorExpression::DIV:
+        case OperatorExpression::POW:
+            break;
+        default:
+            return -1;
+    }
+
+    int rhs = compileNode(opExpr->getRight());
+    if (rhs < 0) {
+        return -1;
+    }
+
+    Kind lk = kinds[lhs];
+    Kind rk = kinds[rhs];
+    Kind kind = std::max(lk, rk);
+
+    OpCode op {};
+    switch (opExpr->getOperator()) {
+        case OperatorExpression::ADD: {
+            static const OpCode ops[] = {OpCode::AddInt, OpCode::AddFloat, OpCode::AddQuantity};
+            op = ops[static_cast<int>(kind)];
+            break;
+        }
+        case OperatorExpression::SUB: {
+            static const OpCode ops[] = {OpCode::SubInt, OpCode::SubFloat, OpCode::SubQuantity};
+            op = ops[static_cast<int>(kind)];
+            break;
+        }
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT: {
+            static const OpCode ops[] = {OpCode::MulInt, OpCode::MulFloat, OpCode::MulQuantity};
+            op = ops[static_cast<int>(kind)];
+            break;
+        }
+        case OperatorExpression::DIV: {
+            static const OpCode ops[] = {OpCode::DivInt, OpCode::DivFloat, OpCode::DivQuantity};
+            op = ops[static_cast<int>(kind)];
+            break;
+        }
+        case OperatorExpression::POW:
+            if (lk == Kind::Quantity) {
+                if (rk == Kind::Quantity) {
+                    op = OpCode::PowQuantity;
+                }
+                else {
+                    op = OpCode::PowQuantityNumber;
+                    rhs = convert(rhs, Kind::Float);
+                }
+                int dst = addRegister(Kind::Quantity);
+                code.push_back({op, dst, lhs, rhs, nullptr});
+                return dst;
+            }
+            if (rk == Kind::Quantity) {
+                // Python rejects a number raised to a quantity
+                return -1;
+            }
+            if (kind == Kind::Int) {
+                // The result of int ** int is only an int for a non-negative exponent
+                if (!isConstant(opExpr->getRight())) {
+                    return -1;
+                }
+                kind = registers[rhs].i < 0 ? Kind::Float : Kind::Int;
+            }
+            op = kind == Kind::Int ? OpCode::PowInt : OpCode::PowFloat;
+            break;
+        default:
+            return -1;
+    }
+
+    // Python's int / int gives a float
+    Kind resultKind = op == OpCode::DivInt ? Kind::Float : kind;
+    lhs = convert(lhs, kind);
+    rhs = convert(rhs, kind);
+    if (lhs < 0 || rhs < 0) {
+        return -1;
+    }
+    int dst = addRegister(resultKind);
+    code.push_back({op, dst, lhs, rhs, nullptr});
+    return dst;
+}
+
+bool ExpressionProgram::evaluate(App::any& value) const
+{
+    if (result < 0) {
+        return false;
+    }
+
+    try {
+        for (const auto& ins : code) {
+            Register& dst = registers[ins.dst];
+            const Register& lhs = registers[ins.lhs];
+            const Register& rhs = registers[ins.rhs];
+            switch (ins.op) {
+                case OpCode::LoadInt:
+                    dst.i = static_cast<const PropertyInteger*>(ins.prop)->getValue();
+                    break;
+                case OpCode::LoadFloat:
+                    dst.d = static_cast<const PropertyFloat*>(ins.prop)->getValue();
+                    break;
+                case OpCode::LoadQuantity: {
+                    auto prop = static_cast<const PropertyQuantity*>(ins.prop);
+                    dst.q = Base::Quantity(prop->getValue(), prop->getUnit());
+                    break;
+                }
+                case OpCode::IntToFloat:
+                    dst.d = static_cast<double>(lhs.i);
+                    break;
+                case OpCode::IntToQuantity:
+                    dst.q = Base::Quantity(static_cast<double>(lhs.i));
+                    break;
+                case OpCode::FloatToQuantity:
+                    dst.q = Base::Quantity(lhs.d);
+                    break;
+                case OpCode::NegInt:
+                    if (lhs.i == std::numeric_limits<long>::min()) {
+                        return false;
+                    }
+                    dst.i = -lhs.i;
+                    break;
+                case OpCode::NegFloat:
+                    dst.d = -lhs.d;
+                    break;
+                case OpCode::NegQuantity:
+                    dst.q = lhs.q * -1.0;
+                    break;
+                case OpCode::AddInt:
+                    if (exceedsLong(static_cast<double>(lhs.i) + static_cast<double>(rhs.i))) {
+                        return false;
+                    }
+                    dst.i = lhs.i + rhs.i;
+                    break;
+                case OpCode::SubInt:
+                    if (exceedsLong(static_cast<double>(lhs.i) - static_cast<double>(rhs.i))) {
+                        return false;
+                    }
+                    dst.i = lhs.i - rhs.i;
+                    break;
+                case OpCode::MulInt:
+                    if (exceedsLong(static_cast<double>(lhs.i) * static_cast<double>(rhs.i))) {
+                        return false;
+                    }
+                    dst.i = lhs.i * rhs.i;
+                    break;
+                case OpCode::DivInt:
+                    if (rhs.i == 0 || std::fabs(static_cast<double>(lhs.i)) > maxExactInt
+                        || std::fabs(static_cast<double>(rhs.i)) > maxExactInt) {
+                        return false;
+                    }
+                    dst.d = static_cast<double>(lhs.i) / static_cast<double>(rhs.i);
+                    break;
+                case OpCode::PowInt: {
+                    double res = std::pow(static_cast<double>(lhs.i), static_cast<double>(rhs.i));
+                    if (exceedsLong(res)) {
+                        return false;
+                    }
+                    long ires = 1;
+                    if (lhs.i == 0 || lhs.i == 1 || lhs.i == -1) {
+                        ires = static_cast<long>(res);
+                    }
+                    else {
+                        // at most 62 iterations, otherwise the check above fails
+                        for (long exp = rhs.i; exp > 0; --exp) {
+                            ires *= lhs.i;
+                        }
+                    }
+                    dst.i = ires;
+                    break;
+                }
+                case OpCode::AddFloat:
+                    dst.d = lhs.d + rhs.d;
+                    break;
+                case OpCode::SubFloat:
+                    dst.d = lhs.d - rhs.d;
+                    break;
+                case OpCode::MulFloat:
+                    dst.d = lhs.d * rhs.d;
+                    break;
+                case OpCode::DivFloat:
+                    // ZeroDivisionError
+                    if (rhs.d == 0.0) {
+                        return false;
+                    }
+                    dst.d = lhs.d / rhs.d;
+                    break;
+                case OpCode::PowFloat: {
+                    // ZeroDivisionError or a complex result
+                    double intpart {};
+                    if ((lhs.d == 0.0 && rhs.d < 0.0)
+                        || (lhs.d < 0.0 && std::modf(rhs.d, &intpart) != 0.0)) {
+                        return false;
+                    }
+                    dst.d = std::pow(lhs.d, rhs.d);
+                    // OverflowError
+                    if (!std::isfinite(dst.d) && std::isfinite(lhs.d) && std::isfinite(rhs.d)) {
+                        return false;
+                    }
+                    break;
+                }
+                case OpCode::AddQuantity:
+                    dst.q = lhs.q + rhs.q;
+                    break;
+                case OpCode::SubQuantity:
+                    dst.q = lhs.q - rhs.q;
+                    break;
+                case OpCode::MulQuantity:
+                    dst.q = lhs.q * rhs.q;
+                    break;
+                case OpCode::DivQuantity:
+                    dst.q = lhs.q / rhs.q;
+                    break;
+                case OpCode::PowQuantity:
+                    dst.q = lhs.q.pow(rhs.q);
+                    break;
+                case OpCode::PowQuantityNumber:
+                    dst.q = lhs.q.pow(rhs.d);
+                    break;
+            }
+        }
+    }
+    catch (Base::Exception&) {
+        // e.g. a unit mismatch, let the interpreter report it
+        return false;
+    }
+
+    const Register& res = registers[result];
+    switch (kinds[result]) {
+        case Kind::Int:
+            value = res.i;
+            break;
+        case Kind::Float:
+            value = res.d;
+            break;
+        case Kind::Quantity:
+            value = res.q;
+            break;
+    }
+    return true;
+}
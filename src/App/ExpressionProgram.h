@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <App/ObjectIdentifier.h>
+#include <Base/Quantity.h>
+
+
+namespace App
+{
+
+class Expression;
+class Property;
+
+/**
+ * @brief An expression compiled into a flat, register-based program.
+ *
+ * Evaluating an Expression walks its tree, resolves every ObjectIdentifier
+ * and computes with Python objects. Arithmetic expressions made of numbers,
+ * units, references to integer, float and quantity properties and the
+ * operators `+ - * / ^` can instead be compiled once into a list of
+ * instructions working on plain doubles and quantities. The referenced
+ * properties are resolved at compile time.
+ *
+ * The program gives exactly the same result as Expression::getValueAsAny().
+ * Whenever it can't, e.g. on an integer overflow or a division by zero,
+ * evaluate() returns false and the caller has to use the expression itself,
+ * which then also reports the error.
+ *
+ * Compiled programs become invalid when documents, objects or dynamic
+ * properties are added, removed or renamed, because this may change what
+ * the identifiers of an expression refer to. See currentEpoch().
+ */
+class AppExport ExpressionProgram
+{
+public:
+    /**
+     * @brief Compile an expression.
+     *
+     * @param[in] expr The expression to compile.
+     *
+     * @return The program, or `nullptr` if the expression contains anything
+     * other than supported arithmetic.
+     */
+    static std::unique_ptr<ExpressionProgram> compile(const Expression* expr);
+
+    /**
+     * @brief Evaluate the program.
+     *
+     * @param[out] value The result, of the same type as returned by
+     * Expression::getValueAsAny().
+     *
+     * @return True on success, false if the expression must be evaluated
+     * by the interpreter.
+     */
+    bool evaluate(App::any& value) const;
+
+    /**
+     * @brief Get the current generation of compiled programs.
+     *
+     * A program compiled in an earlier generation may refer to properties
+     * that no longer exist and must be compiled again.
+     */
+    static std::size_t currentEpoch();
+
+    /// Invalidate all compiled programs.
+    static void invalidateAll();
+
+private:
+    ExpressionProgram() = default;
+
+    enum class Kind
+    {
+        Int,
+        Float,
+        Quantity
+    };
+
+    enum class OpCode
+    {
+        LoadInt,
+        LoadFloat,
+        LoadQuantity,
+        IntToFloat,
+        IntToQuantity,
+        FloatToQuantity,
+        NegInt,
+        NegFloat,
+        NegQuantity,
+        AddInt,
+        SubInt,
+        MulInt,
+        DivInt,
+        PowInt,
+        AddFloat,
+        SubFloat,
+        MulFloat,
+        DivFloat,
+        PowFloat,
+        AddQuantity,
+        SubQuantity,
+        MulQuantity,
+        DivQuantity,
+        PowQuantity,
+        PowQuantityNumber
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        int dst;
+        int lhs;
+        int rhs;
+        const Property* prop;
+    };
+
+    struct Register
+    {
+        long i {0};
+        double d {0.0};
+        Base::Quantity q;
+    };
+
+    int compileNode(const Expression* expr);
+    int addRegister(Kind kind);
+    int convert(int reg, Kind kind);
+
+    std::vector<Instruction> code;
+    std::vector<Kind> kinds;
+    mutable std::vector<Register> registers;
+    int result {-1};
+};
+
+}  // namespace App
@@ -320,6 +320,12 @@ public:
         }
     }
 
+    bool allowConcurrentRecompute() const override
+    {
+        // execute() may end up in Python code that requires the GIL
+        return false;
+    }
+
     bool redirectSubName(std::ostringstream& ss,
                          App::DocumentObject* topParent,
                          App::DocumentObject* child) const override
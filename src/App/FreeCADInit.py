@@ -944,6 +944,87 @@ class ModState(IntEnum):
     Loaded = 2
 
 
+class InitScriptCache:
+    """
+    Cache of the compiled Init.py and InitGui.py scripts of the Dir Mods.
+
+    These scripts are executed rather than imported, so Python doesn't keep their byte code.
+    The code objects are stored in the user cache directory and reused as long as the
+    source file is unchanged. Kept in global scope for FreeCADGuiInit.py.
+    """
+
+    directory = Path(App.getUserCachePath()) / "InitScripts"
+
+    @classmethod
+    def load(cls, path: Path) -> types.CodeType:
+        # imported here because the modules are removed from global scope on cleanup
+        import hashlib
+        import importlib.util
+        import marshal
+        import os
+        import struct
+
+        stat = path.stat()
+        key = hashlib.sha1(str(path).encode("utf-8")).hexdigest()
+        cache = cls.directory / f"{key}.pyc"
+        header = importlib.util.MAGIC_NUMBER + struct.pack("<QQ", stat.st_mtime_ns, stat.st_size)
+        try:
+            data = cache.read_bytes()
+            if data.startswith(header):
+                return marshal.loads(data[len(header):])
+        except (OSError, EOFError, ValueError, TypeError):
+            pass
+
+        code = compile(path.read_text(encoding="utf-8"), path, 'exec')
+        try:
+            cls.directory.mkdir(parents=True, exist_ok=True)
+            tmp = cache.with_suffix(f".{os.getpid()}.tmp")
+            tmp.write_bytes(header + marshal.dumps(code))
+            os.replace(tmp, cache)
+        except OSError:
+            pass  # The cache is optional
+        return code
+
+
+class StartupTimer:
+    """
+    Time spent initializing each Mod, reported with the --log-startup command line option.
+    Kept in global scope for FreeCADGuiInit.py.
+    """
+
+    enabled = App.ConfigGet("LogStartup") == "1"
+    entries: list[tuple[str, str, float]] = []
+
+    @staticmethod
+    def now() -> float:
+        import time
+        return time.perf_counter()
+
+    @classmethod
+    def add(cls, step: str, name: str, start: float) -> None:
+        cls.entries.append((step, name, cls.now() - start))
+
+    @classmethod
+    def report(cls, step: str) -> None:
+        if not cls.enabled:
+            return
+
+        entries = sorted((e for e in cls.entries if e[0] == step), key=lambda e: e[2], reverse=True)
+        total = sum(e[2] for e in entries)
+        output = []
+        output.append(f"+-{'--':-<24}-+-{'----':-<10}-+")
+        output.append(f"| {step + ' Mod':<24} | {'Time (ms)':>10} |")
+        output.append(output[0])
+        for _, name, seconds in entries:
+            output.append(f"| {name:<24.24} | {seconds * 1000:>10.1f} |")
+        output.append(output[0])
+        output.append(f"| {'Total':<24} | {total * 1000:>10.1f} |")
+        output.append(output[0])
+
+        for line in output:
+            App.Console.PrintMessage(line + "\n")
+
+
 @transient
 class Mod:
     """
@@ -1002,6 +1083,7 @@ class Mod:
         """
         Load the Mod.
         """
+        start = StartupTimer.now()
         try:
             self.process_metadata(search_paths)
         except Exception as ex:
@@ -1012,6 +1094,7 @@ class Mod:
                 self.run_init()
                 if self.state == ModState.Resolved:
                     self.state = ModState.Loaded
+        StartupTimer.add("Init", self.name, start)
 
 
 @transient
@@ -1208,8 +1291,7 @@ class DirMod(Mod):
             return
 
         try:
-            source = init_py.read_text(encoding="utf-8")
-            code = compile(source, init_py, 'exec')
+            code = InitScriptCache.load(init_py)
             exec(code)
         except Exception as ex:
             Log(f"Init:      Initializing {self.path!s}... failed")
@@ -1536,6 +1618,7 @@ class InitPipeline:
         self.register_macro_sources()
         self.post()
         self.report()
+        StartupTimer.report("Init")
         self.setup_tty()
 
 
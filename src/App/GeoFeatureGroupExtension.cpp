@@ -95,6 +95,9 @@ DocumentObject* GeoFeatureGroupExtension::getGroupOfObject(const DocumentObject*
     // derived from it like OriginGroup. That is needed as we use this function to get all local
     // coordinate systems. Also there is no reason to distinguish between GeoFeatuerGroups, there is
     // only between group/geofeaturegroup
+    if (auto group = getIndexedGroupOfObject(obj, true)) {
+        return group;
+    }
     auto list = obj->getInList();
     for (auto inObj : list) {
 
@@ -25,6 +25,8 @@
 
 #include <boost/graph/graphviz.hpp>
 #include <random>
+#include <set>
+#include <unordered_map>
 
 #include "Application.h"
 #include "Document.h"
@@ -779,3 +781,104 @@ void Document::exportGraphviz(std::ostream& out) const
 
     boost::write_graphviz(out, g.getGraph());
 }
+
+void Document::exportDependencies(std::ostream& out, int groupDepth) const
+{
+    // Maps an object to the object representing it in the output, which is
+    // either itself or the group it is collapsed into.
+    std::unordered_map<const DocumentObject*, DocumentObject*> representatives;
+    auto getGroups = [](DocumentObject* obj) {
+        // ordered from the innermost to the top level group
+        std::vector<DocumentObject*> groups;
+        for (auto grp = GeoFeatureGroupExtension::getGroupOfObject(obj); grp;
+             grp = GeoFeatureGroupExtension::getGroupOfObject(grp)) {
+            groups.push_back(grp);
+        }
+        return groups;
+    };
+    auto getRepresentative = [&](DocumentObject* obj) {
+        if (groupDepth < 0) {
+            return obj;
+        }
+        auto it = representatives.find(obj);
+        if (it != representatives.end()) {
+            return it->second;
+        }
+        auto groups = getGroups(obj);
+        auto res = static_cast<int>(groups.size()) > groupDepth
+            ? groups[groups.size() - 1 - groupDepth]
+            : obj;
+        representatives.emplace(obj, res);
+        return res;
+    };
+    // whether members of the object are collapsed into it
+    auto isCollapsing = [&](DocumentObject* obj) {
+        return groupDepth >= 0 && obj->hasExtension(GeoFeatureGroupExtension::getExtensionClassTypeId())
+            && static_cast<int>(getGroups(obj).size()) == groupDepth;
+    };
+
+    struct Node
+    {
+        std::set<long> out;
+        std::set<std::string> external;
+    };
+    auto writeNode = [&out](const DocumentObject* obj, const Node& node, bool first) {
+        out << (first ? "\n" : ",\n") << "{\"id\":" << obj->getID() << ",\"name\":\""
+            << obj->getNameInDocument() << "\",\"type\":\"" << obj->getTypeId().getName()
+            << "\",\"out\":[";
+        const char* sep = "";
+        for (auto id : node.out) {
+            out << sep << id;
+            sep = ",";
+        }
+        out << "]";
+        if (!node.external.empty()) {
+            out << ",\"external\":[";
+            sep = "";
+            for (const auto& name : node.external) {
+                out << sep << "\"" << name << "\"";
+                sep = ",";
+            }
+            out << "]";
+        }
+        out << "}";
+    };
+
+    out << "{\"document\":\"" << getName() << "\",\"objects\":[";
+
+    // Objects representing themselves are written right away, collapsing
+    // groups are written at the end once all their members are merged.
+    std::map<long, std::pair<const DocumentObject*, Node>> groups;
+    bool first = true;
+    for (auto obj : d->objectArray) {
+        auto rep = getRepresentative(obj);
+        Node single;
+        bool buffered = rep != obj || isCollapsing(obj);
+        Node& node = buffered ? groups[rep->getID()].second : single;
+        if (buffered) {
+            groups[rep->getID()].first = rep;
+        }
+        for (auto link : obj->getOutList()) {
+            if (!link || !link->isAttachedToDocument()) {
+                continue;
+            }
+            if (link->getDocument() != this) {
+                node.external.insert(link->getFullName());
+                continue;
+            }
+            auto target = getRepresentative(link);
+            if (target != rep) {
+                node.out.insert(target->getID());
+            }
+        }
+        if (!buffered) {
+            writeNode(obj, node, first);
+            first = false;
+        }
+    }
+    for (const auto& [id, group] : groups) {
+        writeNode(group.first, group.second, first);
+        first = false;
+    }
+    out << "\n]}" << std::endl;
+}
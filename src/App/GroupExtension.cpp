@@ -44,6 +44,13 @@ EXTENSION_PROPERTY_SOURCE_TEMPLATE(App::GroupExtensionPython, App::GroupExtensio
 template class AppExport ExtensionPythonT<GroupExtensionPythonT<GroupExtension>>;
 }  // namespace App
 
+namespace
+{
+// The group that last added an object to its Group, see GroupExtension::getIndexedGroupOfObject()
+std::unordered_map<const DocumentObject*, GroupExtension*> plainGroupIndex;
+std::unordered_map<const DocumentObject*, GroupExtension*> geoFeatureGroupIndex;
+}  // namespace
+
 GroupExtension::GroupExtension()
 {
     initExtensionType(GroupExtension::getExtensionClassTypeId());
@@ -61,7 +68,17 @@ GroupExtension::GroupExtension()
                                 0);
 }
 
-GroupExtension::~GroupExtension() = default;
+GroupExtension::~GroupExtension()
+{
+    for (auto index : {&plainGroupIndex, &geoFeatureGroupIndex}) {
+        for (auto child : _Children) {
+            auto it = index->find(child);
+            if (it != index->end() && it->second == this) {
+                index->erase(it);
+            }
+        }
+    }
+}
 
 DocumentObject* GroupExtension::addObject(const char* sType, const char* pObjectName)
 {
@@ -324,13 +341,16 @@ DocumentObject* GroupExtension::getGroupOfObject(const DocumentObject* obj)
     // That is important as there are clear differences between groups/geofeature groups (e.g. an
     // object can be in only one group, and only one geofeaturegroup, however, it can be in both at
     // the same time)
+    if (auto group = getIndexedGroupOfObject(obj, false)) {
+        return group;
+    }
     for (auto o : obj->getInList()) {
         Extension* ext = o->getExtension(GroupExtension::getExtensionClassTypeId(), false, true);
         if (!ext) {
             ext = o->getExtension(GroupExtensionPython::getExtensionClassTypeId(), false, true);
         }
         if (ext) {
-            auto grp = static_cast<GroupExtension*>(ext)->Group.getValues();
+            const auto& grp = static_cast<GroupExtension*>(ext)->Group.getValues();
             if (std::find(grp.begin(), grp.end(), obj) != grp.end()) {
                 return o;
             }
@@ -392,6 +412,7 @@ void GroupExtension::extensionOnChanged(const Property* p)
     }
 
     if (p == &Group) {
+        updateChildIndex();
         _Conns.clear();
         for (auto obj : Group.getValue()) {
             if (obj && obj->isAttachedToDocument()) {
@@ -406,6 +427,51 @@ void GroupExtension::extensionOnChanged(const Property* p)
     App::Extension::extensionOnChanged(p);
 }
 
+void GroupExtension::updateChildIndex()
+{
+    std::unordered_map<const DocumentObject*, GroupExtension*>* index = nullptr;
+    Base::Type type = getExtensionTypeId();
+    if (type == GroupExtension::getExtensionClassTypeId()
+        || type == GroupExtensionPython::getExtensionClassTypeId()) {
+        index = &plainGroupIndex;
+    }
+    else if (type.isDerivedFrom(GeoFeatureGroupExtension::getExtensionClassTypeId())) {
+        index = &geoFeatureGroupIndex;
+    }
+
+    const auto& values = Group.getValues();
+    std::unordered_set<const DocumentObject*> children(values.begin(), values.end());
+    children.erase(nullptr);
+    if (index) {
+        for (auto child : _Children) {
+            auto it = index->find(child);
+            if (!children.count(child) && it != index->end() && it->second == this) {
+                index->erase(it);
+            }
+        }
+        for (auto child : children) {
+            (*index)[child] = this;
+        }
+    }
+    _Children.swap(children);
+}
+
+DocumentObject* GroupExtension::getIndexedGroupOfObject(const DocumentObject* obj,
+                                                       bool geoFeatureGroup)
+{
+    const auto& index = geoFeatureGroup ? geoFeatureGroupIndex : plainGroupIndex;
+    auto it = index.find(obj);
+    if (it == index.end()) {
+        return nullptr;
+    }
+    // Groups removed from the document keep their children for undo, but no longer own them
+    DocumentObject* group = it->second->getExtendedObject();
+    if (!group->isAttachedToDocument() || !it->second->_Children.count(obj)) {
+        return nullptr;
+    }
+    return group;
+}
+
 void GroupExtension::slotChildChanged(const DocumentObject& obj, const Property& prop)
 {
     if (&prop == &obj.Visibility) {
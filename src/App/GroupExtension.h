@@ -28,6 +28,7 @@
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectExtension.h>
 #include <App/ExtensionPython.h>
+#include <unordered_set>
 #include <vector>
 
 
@@ -142,7 +143,16 @@ public:
     PropertyLinkList Group;
     PropertyBool _GroupTouched;
 
+protected:
+    /** Returns the group holding \a obj in constant time, or nullptr if it is unknown.
+     * Every group records itself as the parent of its children when Group changes, plain groups
+     * and GeoFeatureGroups separately, because an object can be in one of each.
+     */
+    static DocumentObject* getIndexedGroupOfObject(const DocumentObject* obj,
+                                                   bool geoFeatureGroup);
+
 private:
+    void updateChildIndex();
     void removeObjectFromDocument(DocumentObject*);
     // This function stores the already searched objects to prevent infinite recursion in case of a
     // cyclic group graph It throws an exception of type Base::RuntimeError if a cyclic dependency
@@ -154,6 +164,8 @@ private:
     // for tracking children visibility
     void slotChildChanged(const App::DocumentObject&, const App::Property&);
     std::unordered_map<const App::DocumentObject*, fastsignals::scoped_connection> _Conns;
+    // the objects in Group, for the child to group index
+    std::unordered_set<const App::DocumentObject*> _Children;
 };
 
 
@@ -1114,12 +1114,36 @@ public:
                              bool negative = false,
                              bool recursive = true) const;
 
-    /// Get a hash for this MappedName
+    /**
+     * @brief Get a hash for this MappedName
+     *
+     * The hash is computed over the concatenation of data and postfix, so
+     * that names comparing equal with operator==() hash equally no matter
+     * where the split between data and postfix lies (i.e. before and after
+     * compact()).
+     */
     std::size_t hash() const
     {
-        return qHash(data, qHash(postfix));
+        // FNV-1a
+        std::size_t res = sizeof(std::size_t) > 4 ? 14695981039346656037ULL : 2166136261U;
+        const std::size_t prime = sizeof(std::size_t) > 4 ? 1099511628211ULL : 16777619U;
+        for (const QByteArray* bytes : {&data, &postfix}) {
+            for (char c : *bytes) {
+                res = (res ^ static_cast<unsigned char>(c)) * prime;
+            }
+        }
+        return res;
     }
 
+    /// Hash functor for use of MappedName as key in unordered containers
+    struct Hasher
+    {
+        std::size_t operator()(const MappedName& name) const
+        {
+            return name.hash();
+        }
+    };
+
 private:
     QByteArray data;
     QByteArray postfix;
@@ -486,6 +486,21 @@ public:
      */
     virtual void Paste(const Property& from) = 0;
 
+    /**
+     * @brief Check if a copy of this property can be moved to a file.
+     *
+     * If the undo stack exceeds its memory limit, large property copies of
+     * older transactions are saved with dumpToStream() and restored with
+     * restoreFromStream() when needed. This requires that the property can
+     * be saved and restored without a container.
+     *
+     * @return True if the property can be saved to a file, false otherwise.
+     */
+    virtual bool canSpillToFile() const
+    {
+        return false;
+    }
+
     /**
      * @brief Callback for when a child property has changed value.
      *
@@ -36,6 +36,7 @@
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "ExpressionProgram.h"
 #include "ExpressionVisitors.h"
 
 
@@ -255,6 +256,12 @@ Property* PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    // the expressions may have been modified in place
+    for (auto& e : expressions) {
+        e.second.program.reset();
+        e.second.programEpoch = 0;
+    }
+
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
@@ -717,9 +724,19 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
+            ExpressionInfo& info = expressions[*it];
+            std::shared_ptr<App::Expression> expression = info.expression;
             if (expression) {
-                value = expression->getValueAsAny();
+                // Use the compiled program for plain arithmetic and fall
+                // back to the interpreter for everything else
+                std::size_t epoch = ExpressionProgram::currentEpoch();
+                if (info.programEpoch != epoch) {
+                    info.program = ExpressionProgram::compile(expression.get());
+                    info.programEpoch = epoch;
+                }
+                if (!info.program || !info.program->evaluate(value)) {
+                    value = expression->getValueAsAny();
+                }
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -47,6 +47,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class ExpressionProgram;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer: public App::PropertyXLinkContainer
@@ -147,6 +148,10 @@ public:
     {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
         bool busy;
+        /** The compiled expression, if the expression can be compiled. It is
+         * not copied because its registers must not be shared. */
+        std::shared_ptr<App::ExpressionProgram> program;
+        std::size_t programEpoch {0}; /**< The generation of program, 0 if not compiled */
 
         explicit ExpressionInfo(
             std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>())
@@ -155,9 +160,21 @@ public:
             this->busy = false;
         }
 
-        ExpressionInfo(const ExpressionInfo&) = default;
+        ExpressionInfo(const ExpressionInfo& other)
+            : expression(other.expression)
+            , busy(other.busy)
+        {}
 
-        ExpressionInfo& operator=(const ExpressionInfo&) = default;
+        ExpressionInfo& operator=(const ExpressionInfo& other)
+        {
+            if (this != &other) {
+                expression = other.expression;
+                busy = other.busy;
+                program.reset();
+                programEpoch = 0;
+            }
+            return *this;
+        }
     };
 
     PropertyExpressionEngine();
@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <Base/GeometryPyCXX.h>
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
 #include <Base/Reader.h>
@@ -146,9 +147,9 @@ void PropertyVector::Save(Base::Writer& writer) const
     // clang-format off
     writer.Stream() << writer.ind()
                     << "<PropertyVector"
-                    << " valueX=\"" << _cVec.x << "\""
-                    << " valueY=\"" << _cVec.y << "\""
-                    << " valueZ=\"" << _cVec.z << "\""
+                    << " valueX=\"" << Base::FastDouble {_cVec.x} << "\""
+                    << " valueY=\"" << Base::FastDouble {_cVec.y} << "\""
+                    << " valueZ=\"" << Base::FastDouble {_cVec.z} << "\""
                     << "/>\n";
     // clang-format on
 }
@@ -301,6 +302,25 @@ PyObject* PropertyVectorList::getPyObject()
     return list;
 }
 
+void PropertyVectorList::setPyObject(PyObject* value)
+{
+    std::vector<double> values;
+    if (!Base::getValuesFromBuffer(value, values)) {
+        inherited::setPyObject(value);
+        return;
+    }
+    if (values.size() % 3 != 0) {
+        throw Base::TypeError("Buffer size must be a multiple of 3");
+    }
+
+    std::vector<Base::Vector3d> points;
+    points.reserve(values.size() / 3);
+    for (std::size_t i = 0; i < values.size(); i += 3) {
+        points.emplace_back(values[i], values[i + 1], values[i + 2]);
+    }
+    setValues(points);
+}
+
 Base::Vector3d PropertyVectorList::getPyValue(PyObject* item) const
 {
     PropertyVector val;
@@ -837,21 +857,21 @@ void PropertyPlacement::Save(Base::Writer& writer) const
 {
     // clang-format off
     writer.Stream() << writer.ind() << "<PropertyPlacement";
-    writer.Stream() << " Px=\"" << _cPos.getPosition().x << "\""
-                    << " Py=\"" << _cPos.getPosition().y << "\""
-                    << " Pz=\"" << _cPos.getPosition().z << "\"";
-
-    writer.Stream() << " Q0=\"" << _cPos.getRotation()[0] << "\""
-                    << " Q1=\"" << _cPos.getRotation()[1] << "\""
-                    << " Q2=\"" << _cPos.getRotation()[2] << "\""
-                    << " Q3=\"" << _cPos.getRotation()[3] << "\"";
+    writer.Stream() << " Px=\"" << Base::FastDouble {_cPos.getPosition().x} << "\""
+                    << " Py=\"" << Base::FastDouble {_cPos.getPosition().y} << "\""
+                    << " Pz=\"" << Base::FastDouble {_cPos.getPosition().z} << "\"";
+
+    writer.Stream() << " Q0=\"" << Base::FastDouble {_cPos.getRotation()[0]} << "\""
+                    << " Q1=\"" << Base::FastDouble {_cPos.getRotation()[1]} << "\""
+                    << " Q2=\"" << Base::FastDouble {_cPos.getRotation()[2]} << "\""
+                    << " Q3=\"" << Base::FastDouble {_cPos.getRotation()[3]} << "\"";
     Vector3d axis;
     double rfAngle {};
     _cPos.getRotation().getRawValue(axis, rfAngle);
-    writer.Stream() << " A=\"" << rfAngle << "\""
-                    << " Ox=\"" << axis.x << "\""
-                    << " Oy=\"" << axis.y << "\""
-                    << " Oz=\"" << axis.z << "\"";
+    writer.Stream() << " A=\"" << Base::FastDouble {rfAngle} << "\""
+                    << " Ox=\"" << Base::FastDouble {axis.x} << "\""
+                    << " Oy=\"" << Base::FastDouble {axis.y} << "\""
+                    << " Oz=\"" << Base::FastDouble {axis.z} << "\"";
     writer.Stream() << "/>" << std::endl;
     // clang-format on
 }
@@ -230,6 +230,8 @@ public:
     using inherited::setValue;
 
     PyObject* getPyObject() override;
+    /// Also accepts a buffer of n x 3 floats or doubles, e.g. a numpy array
+    void setPyObject(PyObject* value) override;
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
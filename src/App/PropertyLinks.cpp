@@ -62,6 +62,94 @@ static std::unordered_map<std::string, std::set<PropertyLinkBase*>> _LabelMap;
 static std::unordered_map<App::DocumentObject*, std::unordered_set<PropertyLinkBase*>> _ElementRefMap;
 // clang-format on
 
+namespace
+{
+// How an element reference resolved the last time its property was updated for a feature. It
+// lets updateElementReferences() skip properties whose mapped element names still resolve to
+// the same elements in the new element map of the feature.
+struct ElementRefRecord
+{
+    std::string element;     // mapped element name the reference is resolved with
+    std::string oldElement;  // element name it resolved to, empty if it must be re-resolved
+};
+
+// clang-format off
+std::unordered_map<PropertyLinkBase*,
+                   std::unordered_map<App::DocumentObject*, std::vector<ElementRefRecord>>>
+    _ElementRefRecords;
+// clang-format on
+
+// The property and feature updateElementReferences() is currently recording references of
+PropertyLinkBase* _RecordingProp = nullptr;
+App::DocumentObject* _RecordingFeature = nullptr;
+
+void invalidateElementRefRecords(PropertyLinkBase* prop, App::DocumentObject* geo = nullptr)
+{
+    auto it = _ElementRefRecords.find(prop);
+    if (it == _ElementRefRecords.end()) {
+        return;
+    }
+    if (geo) {
+        it->second.erase(geo);
+    }
+    if (!geo || it->second.empty()) {
+        _ElementRefRecords.erase(it);
+    }
+}
+
+// Records the final state of a reference resolved by _updateElementReference() while its
+// property is being recorded, and invalidates the records of a reference updated any other way.
+class ElementRefRecorder
+{
+public:
+    ElementRefRecorder(PropertyLinkBase* prop,
+                       App::DocumentObject* geo,
+                       bool resolved,
+                       const PropertyLinkBase::ShadowSub& shadow)
+        : prop(prop)
+        , geo(geo)
+        , resolved(resolved)
+        , shadow(shadow)
+    {}
+    ~ElementRefRecorder()
+    {
+        if (!geo) {
+            return;
+        }
+        if (prop != _RecordingProp) {
+            if (resolved) {
+                invalidateElementRefRecords(prop, geo);
+            }
+            return;
+        }
+        if (geo != _RecordingFeature) {
+            return;
+        }
+
+        ElementRefRecord record;
+        const char* element = Data::findElementName(shadow.newName.c_str());
+        if (element && element[0]) {
+            std::size_t prefix = element - shadow.newName.c_str();
+            if (shadow.oldName.compare(0, prefix, shadow.newName, 0, prefix) == 0
+                && !Data::hasMissingElement(shadow.oldName.c_str() + prefix)) {
+                record.element = element;
+                record.oldElement = shadow.oldName.substr(prefix);
+            }
+        }
+        _ElementRefRecords[prop][geo].push_back(std::move(record));
+    }
+
+    ElementRefRecorder(const ElementRefRecorder&) = delete;
+    ElementRefRecorder& operator=(const ElementRefRecorder&) = delete;
+
+private:
+    PropertyLinkBase* prop;
+    App::DocumentObject* geo;
+    bool resolved;
+    const PropertyLinkBase::ShadowSub& shadow;
+};
+}  // namespace
+
 PropertyLinkBase::PropertyLinkBase() = default;
 
 PropertyLinkBase::~PropertyLinkBase()
@@ -91,6 +179,7 @@ void PropertyLinkBase::hasSetValue()
     if (owner) {
         owner->clearOutListCache();
     }
+    invalidateElementRefRecords(this);
     Property::hasSetValue();
 }
 
@@ -131,6 +220,7 @@ void PropertyLinkBase::unregisterElementReference()
         }
     }
     _ElementRefs.clear();
+    invalidateElementRefRecords(this);
 }
 
 void PropertyLinkBase::unregisterLabelReferences()
@@ -281,20 +371,64 @@ void PropertyLinkBase::updateElementReferences(DocumentObject* feature, bool rev
     std::vector<PropertyLinkBase*> props;
     props.reserve(it->second.size());
     props.insert(props.end(), it->second.begin(), it->second.end());
-    for (auto prop : props) {
-        if (prop->getContainer()) {
-            try {
-                prop->updateElementReference(feature, reverse, true);
+
+    // Mapped element names referenced in the feature, each looked up once in its new element map
+    auto geoFeature = freecad_cast<GeoFeature*>(feature);
+    std::unordered_map<std::string, ElementNamePair> elements;
+    auto isUnchanged = [&](PropertyLinkBase* prop) {
+        if (reverse || !geoFeature) {
+            return false;
+        }
+        auto itProp = _ElementRefRecords.find(prop);
+        if (itProp == _ElementRefRecords.end()) {
+            return false;
+        }
+        auto itRecords = itProp->second.find(feature);
+        if (itRecords == itProp->second.end()) {
+            return false;
+        }
+        for (const auto& record : itRecords->second) {
+            if (record.oldElement.empty()) {
+                return false;
             }
-            catch (Base::Exception& e) {
-                e.reportException();
-                FC_ERR("Failed to update element reference of " << propertyName(prop));
+            auto itElement = elements.find(record.element);
+            if (itElement == elements.end()) {
+                auto names = geoFeature->getElementName(record.element.c_str(),
+                                                        GeoFeature::ElementNameType::Export);
+                itElement = elements.emplace(record.element, std::move(names)).first;
             }
-            catch (std::exception& e) {
-                FC_ERR("Failed to update element reference of " << propertyName(prop) << ": "
-                                                                << e.what());
+            if (itElement->second.newName != record.element
+                || itElement->second.oldName != record.oldElement) {
+                return false;
             }
         }
+        return true;
+    };
+
+    for (auto prop : props) {
+        if (!prop->getContainer() || isUnchanged(prop)) {
+            continue;
+        }
+        invalidateElementRefRecords(prop, feature);
+        auto recordingProp = _RecordingProp;
+        auto recordingFeature = _RecordingFeature;
+        if (!reverse) {
+            _RecordingProp = prop;
+            _RecordingFeature = feature;
+        }
+        try {
+            prop->updateElementReference(feature, reverse, true);
+        }
+        catch (Base::Exception& e) {
+            e.reportException();
+            FC_ERR("Failed to update element reference of " << propertyName(prop));
+        }
+        catch (std::exception& e) {
+            FC_ERR("Failed to update element reference of " << propertyName(prop) << ": "
+                                                            << e.what());
+        }
+        _RecordingProp = recordingProp;
+        _RecordingFeature = recordingFeature;
     }
 }
 
@@ -345,6 +479,7 @@ void PropertyLinkBase::_registerElementReference(App::DocumentObject* obj,
         return;
     }
 
+    invalidateElementRefRecords(this, geo);
     if (_ElementRefs.insert(geo).second) {
         _ElementRefMap[geo].insert(this);
     }
@@ -446,6 +581,7 @@ bool PropertyLinkBase::_updateElementReference(DocumentObject* feature,
                                           feature,
                                           &element,
                                           &geo);
+    ElementRefRecorder recorder(this, geo, ret != nullptr, shadow);
     if (!ret || !geo || !element || !element[0]) {
         if (elementName.oldName.size()) {
             shadow.oldName.swap(elementName.oldName);
@@ -36,6 +36,7 @@
 
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
 #include <Base/ProgramVersion.h>
 #include <Base/Reader.h>
@@ -1105,7 +1106,8 @@ void PropertyFloat::setPyObject(PyObject* value)
 
 void PropertyFloat::Save(Base::Writer& writer) const
 {
-    writer.Stream() << writer.ind() << "<Float value=\"" << _dValue << "\"/>" << std::endl;
+    writer.Stream() << writer.ind() << "<Float value=\"" << Base::FastDouble {_dValue} << "\"/>"
+                    << std::endl;
 }
 
 void PropertyFloat::Restore(Base::XMLReader& reader)
@@ -1414,6 +1416,17 @@ PyObject* PropertyFloatList::getPyObject()
     return list;
 }
 
+void PropertyFloatList::setPyObject(PyObject* value)
+{
+    std::vector<double> values;
+    if (Base::getValuesFromBuffer(value, values)) {
+        setValues(values);
+    }
+    else {
+        PropertyListsT<double>::setPyObject(value);
+    }
+}
+
 double PropertyFloatList::getPyValue(PyObject* item) const
 {
     if (PyFloat_Check(item)) {
@@ -1435,7 +1448,8 @@ void PropertyFloatList::Save(Base::Writer& writer) const
         writer.Stream() << writer.ind() << "<FloatList count=\"" << getSize() << "\">" << endl;
         writer.incInd();
         for (int i = 0; i < getSize(); i++) {
-            writer.Stream() << writer.ind() << "<F v=\"" << _lValueList[i] << "\"/>" << endl;
+            writer.Stream() << writer.ind() << "<F v=\"" << Base::FastDouble {_lValueList[i]}
+                            << "\"/>" << endl;
         };
         writer.decInd();
         writer.Stream() << writer.ind() << "</FloatList>" << endl;
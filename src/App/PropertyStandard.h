@@ -728,6 +728,8 @@ public:
     }
 
     PyObject* getPyObject() override;
+    /// Also accepts a buffer of floats or doubles, e.g. a numpy array
+    void setPyObject(PyObject* value) override;
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
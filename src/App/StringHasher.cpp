@@ -24,6 +24,8 @@
 #include <QCryptographicHash>
 #include <QHash>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -82,6 +84,8 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+    /// Guards the table against concurrent getID() calls
+    std::shared_mutex Mutex;
 };
 
 ///////////////////////////////////////////////////////////
@@ -91,6 +95,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
+        std::unique_lock<std::shared_mutex> lock(_hasher->_hashes->Mutex);
         _hasher->_hashes->right.erase(_id);
     }
 }
@@ -243,6 +248,7 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     if (_hashes->right.empty()) {
         return 0;
     }
@@ -277,9 +283,12 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&dataID);
+        if (it != _hashes->left.end()) {
+            return {it->first};
+        }
     }
 
     if (!hashed && !nocopy) {
@@ -294,7 +303,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
+    // The ID is assigned by insert()
+    StringIDRef sid(new StringID(0, dataID._data, flags));
     return {insert(sid)};
 }
 
@@ -321,13 +331,16 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
+        auto it = _hashes->left.find(&tempID);
+        if (it != _hashes->left.end()) {
+            auto res = StringIDRef(it->first);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -348,8 +361,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert, its ID is assigned by insert()
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -437,6 +450,7 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -730,6 +744,12 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 {
     assert(sid && sid._sid->_hasher == nullptr);
     auto& hasher = *sid._sid;
+    std::unique_lock<std::shared_mutex> lock(_hashes->Mutex);
+    if (hasher._id == 0) {
+        // Assign a new ID while holding the lock. If another thread added the same
+        // string in the meantime, the insertion below returns that one instead.
+        hasher._id = _hashes->right.empty() ? 1 : _hashes->right.rbegin()->first + 1;
+    }
     hasher._hasher = this;
     hasher.ref();
     auto res = _hashes->right.insert(_hashes->right.end(),
@@ -771,6 +791,7 @@ void StringHasher::clear()
 
 size_t StringHasher::size() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->Mutex);
     return _hashes->size();
 }
 
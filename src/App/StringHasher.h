@@ -629,6 +629,13 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// The getID() family of functions and size() may be called concurrently from multiple
+/// threads, e.g. when element maps of several features are generated in parallel. Lookups of
+/// existing strings only take a shared lock, and new IDs are assigned while adding the string to
+/// the table, so that concurrent callers get consecutive IDs. All other functions, in particular
+/// compact(), clear(), clearMarks() and the persistence functions, must not run concurrently with
+/// any other access to the same hasher.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
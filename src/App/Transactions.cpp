@@ -26,11 +26,15 @@
 #include <cassert>
 
 #include <atomic>
+#include <memory>
 #include <Base/Console.h>
+#include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "Transactions.h"
+#include "Application.h"
 #include "Document.h"
 #include "DocumentObject.h"
 #include "Property.h"
@@ -109,7 +113,20 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->getMemSize();
+    }
+    return size;
+}
+
+std::size_t Transaction::spill()
+{
+    std::size_t size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->spill();
+    }
+    return size;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -293,6 +310,9 @@ TransactionObject::~TransactionObject()
 	if (data.nameOrig.empty()) {
 	    delete v.second.property;
 	}
+        if (!data.spillFile.empty()) {
+            Base::FileInfo(data.spillFile).deleteFile();
+        }
     }
 }
 
@@ -310,6 +330,10 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
             auto& data = v.second;
             auto prop = const_cast<Property*>(data.propertyOrig);
 
+            if (!loadSpilled(data)) {
+                continue;
+            }
+
             if (!data.nameOrig.empty()) {
                 // This means we are undoing/redoing a rename operation
                 Property* currentProp = pcObj->getDynamicPropertyByName(data.name.c_str());
@@ -448,9 +472,83 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
     }
 }
 
+namespace
+{
+// Smaller property copies are not worth moving to a file
+constexpr unsigned int minSpillSize = 64 * 1024;
+}  // namespace
+
+std::size_t TransactionObject::spill()
+{
+    std::size_t size = 0;
+    for (auto& v : _PropChangeMap) {
+        auto& data = v.second;
+        if (!data.nameOrig.empty() || !data.property || !data.property->canSpillToFile()) {
+            continue;
+        }
+        unsigned int memSize = data.property->getMemSize();
+        if (memSize < minSpillSize) {
+            continue;
+        }
+
+        Base::FileInfo fi(Application::getTempFileName("undo"));
+        try {
+            Base::ofstream str(fi, std::ios::out | std::ios::binary);
+            data.property->dumpToStream(str, 1);
+            str.close();
+            if (str.fail()) {
+                throw Base::FileException("Failed to write undo data", fi);
+            }
+        }
+        catch (const Base::Exception& e) {
+            FC_WARN("Cannot move undo data of property " << data.name << " to file: " << e.what());
+            fi.deleteFile();
+            continue;
+        }
+
+        data.spillFile = fi.filePath();
+        data.spillStatus = data.property->getStatus();
+        delete data.property;
+        data.property = nullptr;
+        size += memSize;
+    }
+    return size;
+}
+
+bool TransactionObject::loadSpilled(PropData& data)
+{
+    if (data.spillFile.empty()) {
+        return true;
+    }
+
+    Base::FileInfo fi(data.spillFile);
+    data.spillFile.clear();
+    try {
+        std::unique_ptr<Property> prop(static_cast<Property*>(data.propertyType.createInstance()));
+        if (!prop) {
+            throw Base::TypeError("Cannot create property");
+        }
+        Base::ifstream str(fi, std::ios::in | std::ios::binary);
+        prop->restoreFromStream(str);
+        prop->setStatusValue(data.spillStatus);
+        data.property = prop.release();
+    }
+    catch (const Base::Exception& e) {
+        FC_ERR("Cannot load undo data of property " << data.name << ": " << e.what());
+    }
+    fi.deleteFile();
+    return data.property != nullptr;
+}
+
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.nameOrig.empty() && v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
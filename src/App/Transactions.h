@@ -88,7 +88,21 @@ public:
     /// The UTF-8 name of the transaction
     std::string Name;
 
+    /**
+     * @brief Get the memory used by the property copies of this transaction.
+     *
+     * Copies that have been moved to a file by spill() are not counted.
+     */
     unsigned int getMemSize() const override;
+
+    /**
+     * @brief Move large property copies to temporary files.
+     *
+     * The copies are loaded back when the transaction is applied.
+     *
+     * @return The number of bytes released.
+     */
+    std::size_t spill();
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
@@ -232,6 +246,14 @@ public:
      */
     void addOrRemoveProperty(const Property* prop, bool add);
 
+    /**
+     * @brief Move large property copies to temporary files.
+     *
+     * @return The number of bytes released.
+     * @see Property::canSpillToFile()
+     */
+    std::size_t spill();
+
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
@@ -254,8 +276,14 @@ protected:
         const Property* propertyOrig = nullptr;
         // for property renaming
         std::string nameOrig;
+        // file of a property copy moved out of memory by spill()
+        std::string spillFile;
+        unsigned long spillStatus = 0;
     };
 
+    /// Load a property copy that has been moved to a file by spill()
+    static bool loadSpilled(PropData& data);
+
     /// A map to maintain the properties of the object.
     std::unordered_map<int64_t, PropData> _PropChangeMap;
 
@@ -28,9 +28,14 @@
 #pragma warning(disable : 4834)
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -77,6 +82,10 @@ struct DocumentP
     std::unordered_map<std::string, DocumentObject*> objectMap;
     Base::UniqueNameManager objectNameManager;
     Base::UniqueNameManager objectLabelManager;
+    // objects by label in creation order, rebuilt on demand after objects or labels changed
+    mutable std::unordered_map<std::string, std::vector<DocumentObject*>> objectLabelIndex;
+    mutable std::atomic<bool> objectLabelIndexValid {false};
+    mutable std::mutex objectLabelIndexMutex;
     std::unordered_map<long, DocumentObject*> objectIdMap;
     std::unordered_map<std::string, bool> partialLoadObjects;
     std::vector<DocumentObjectT> pendingRemove;
@@ -92,7 +101,7 @@ struct DocumentP
     bool opentransaction {false};
     std::bitset<32> StatusBits;
     int iUndoMode {0};
-    unsigned int UndoMemSize {0};
+    std::size_t UndoMemSize {0};
     unsigned int UndoMaxStackSize {20};
     unsigned int TransactionLock {0};
     // Id and name that the next transaction will take
@@ -103,6 +112,28 @@ struct DocumentP
     mutable HasherMap hashers;
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    // guards _RecomputeLog while objects are recomputed concurrently
+    std::mutex recomputeLogMutex;
+    // statistics of the last recompute, see Document::getRecomputeStats()
+    std::vector<RecomputeStat> recomputeStats;
+    std::map<std::thread::id, int> recomputeThreads;
+    std::chrono::steady_clock::time_point recomputeStart;
+    mutable std::mutex recomputeStatsMutex;
+    // property changes collected during Document::openBatchUpdate(), by object ID
+    int batchUpdateDepth {0};
+    std::vector<std::pair<long, std::string>> batchedChanges;
+    std::set<std::pair<long, std::string>> batchedChangeSet;
+    // objects by their exact type in creation order, with the creation
+    // sequence number used to merge buckets, see Document::getObjectsOfType()
+    std::unordered_map<Base::Type::TypeId, std::vector<std::pair<std::size_t, DocumentObject*>>>
+        typeBuckets;
+    // cached types of typeBuckets derived from a queried type
+    mutable std::unordered_map<Base::Type::TypeId, std::vector<Base::Type::TypeId>> typeClosures;
+    mutable std::mutex typeClosuresMutex;
+    std::size_t objectSequence {0};
+    // cached result of Document::topologicalSort()
+    mutable std::vector<DocumentObject*> topoSortCache;
+    mutable bool topoSortCacheValid {false};
     ExportInfo exportInfo;
 
     StringHasherRef Hasher {new StringHasher};
@@ -111,6 +142,11 @@ struct DocumentP
 
     DocumentP();
 
+    void addTypeBucket(DocumentObject* obj);
+    void removeTypeBucket(DocumentObject* obj);
+    void clearTypeBuckets();
+    std::vector<DocumentObject*> getObjectsOfTypes(const std::vector<Base::Type>& types) const;
+
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
     {
         addRecomputeLog(new DocumentObjectExecReturn(why, obj));
@@ -127,6 +163,7 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::mutex> lock(recomputeLogMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
@@ -142,8 +179,19 @@ struct DocumentP
         }
     }
 
+    void clearRecomputeStats()
+    {
+        std::lock_guard<std::mutex> lock(recomputeStatsMutex);
+        recomputeStats.clear();
+        recomputeThreads.clear();
+        recomputeThreads.emplace(std::this_thread::get_id(), 0);
+        recomputeStart = std::chrono::steady_clock::now();
+    }
+
     void clearDocument()
     {
+        topoSortCacheValid = false;
+        objectLabelIndexValid = false;
         objectLabelManager.clear();
         objectArray.clear();
         for (auto& v : objectMap) {
@@ -154,6 +202,7 @@ struct DocumentP
         objectMap.clear();
         objectNameManager.clear();
         objectIdMap.clear();
+        clearTypeBuckets();
     }
 
     const char* findRecomputeLog(const App::DocumentObject* obj)
@@ -32,6 +32,7 @@ These modifications are Copyright (c) 2019 Zheng Lei (realthunder.dev@gmail.com)
 */
 
 #include <array>
+#include <cstdint>
 
 #include "Base64.h"
 
@@ -39,9 +40,47 @@ These modifications are Copyright (c) 2019 Zheng Lei (realthunder.dev@gmail.com)
 // cppcoreguidelines-pro-bounds-constant-array-index, cppcoreguidelines-avoid-magic-numbers,
 // readability-magic-numbers)
 
-static const std::array<char, 65> base64_chars {"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                                "abcdefghijklmnopqrstuvwxyz"
-                                                "0123456789+/"};
+static constexpr std::array<char, 65> base64_chars {"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                                    "abcdefghijklmnopqrstuvwxyz"
+                                                    "0123456789+/"};
+
+namespace
+{
+// The two characters of every 12 bit value, three bytes are encoded with two lookups
+constexpr std::array<std::array<char, 2>, 4096> makeEncodeTable()
+{
+    std::array<std::array<char, 2>, 4096> table {};
+    for (std::size_t i = 0; i < table.size(); i++) {
+        table[i] = {base64_chars[i >> 6], base64_chars[i & 0x3f]};
+    }
+    return table;
+}
+
+constexpr auto encodeTable = makeEncodeTable();
+
+// The decoded bits of a character at each of the four positions of a group, already shifted into
+// place. Characters that are not part of the alphabet, including padding and white space, have
+// the invalid bit set, so that a whole group is checked with one test.
+constexpr std::uint32_t invalidBit = 0x1000000;
+
+constexpr std::array<std::array<std::uint32_t, 256>, 4> makeDecodeTables()
+{
+    std::array<std::array<std::uint32_t, 256>, 4> tables {};
+    for (auto& table : tables) {
+        table.fill(invalidBit);
+    }
+    for (std::uint32_t i = 0; i < 64; i++) {
+        auto c = static_cast<unsigned char>(base64_chars[i]);
+        tables[0][c] = i << 18;
+        tables[1][c] = i << 12;
+        tables[2][c] = i << 6;
+        tables[3][c] = i;
+    }
+    return tables;
+}
+
+constexpr auto decodeTables = makeDecodeTables();
+}  // namespace
 
 
 std::array<const signed char, Base::base64DecodeTableSize> Base::base64_decode_table()
@@ -76,6 +115,21 @@ std::size_t Base::base64_encode(char* out, void const* in, std::size_t in_len)
     std::array<unsigned char, 3> char_array_3 {};
     std::array<unsigned char, 4> char_array_4 {};
 
+    // all complete groups of three bytes
+    for (; in_len >= 3; in_len -= 3) {
+        const std::uint32_t group = (std::uint32_t(bytes_to_encode[0]) << 16)
+            | (std::uint32_t(bytes_to_encode[1]) << 8) | bytes_to_encode[2];
+        const auto& high = encodeTable[group >> 12];
+        const auto& low = encodeTable[group & 0xfff];
+        ret[0] = high[0];
+        ret[1] = high[1];
+        ret[2] = low[0];
+        ret[3] = low[1];
+        ret += 4;
+        bytes_to_encode += 3;
+    }
+
+    // the remaining bytes
     while ((in_len--) != 0U) {
         char_array_3[char3++] = *(bytes_to_encode++);
         if (char3 == 3) {
@@ -125,6 +179,23 @@ std::pair<std::size_t, std::size_t> Base::base64_decode(void* _out, char const*
 
     static auto table = base64_decode_table();
 
+    // complete groups of four characters of the alphabet
+    auto const* chars = reinterpret_cast<unsigned char const*>(in);  // NOLINT
+    for (; in_len >= 4; in_len -= 4) {
+        const std::uint32_t group = decodeTables[0][chars[0]] | decodeTables[1][chars[1]]
+            | decodeTables[2][chars[2]] | decodeTables[3][chars[3]];
+        if ((group & invalidBit) != 0U) {
+            break;
+        }
+        ret[0] = static_cast<unsigned char>(group >> 16);
+        ret[1] = static_cast<unsigned char>(group >> 8);
+        ret[2] = static_cast<unsigned char>(group);
+        ret += 3;
+        chars += 4;
+        in += 4;
+    }
+
+    // padding, white space, invalid characters and an incomplete last group
     while (((in_len--) != 0U) && *in != '=') {
         const signed char lookup = table[static_cast<unsigned char>(*in++)];
         if (lookup < 0) {
@@ -52,10 +52,12 @@ ConsoleSingleton::ConsoleSingleton()
 #else
     : _defaultLogLevel(FC_LOGLEVEL_MSG)
 #endif
+    , _mainThread(std::this_thread::get_id())
 {}
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    flush();
     for (ILogger* Iter : _aclObservers) {  // NOLINT
         delete Iter;
     }
@@ -210,6 +212,93 @@ void ConsoleSingleton::notifyPrivate(
     const std::string& msg
 ) const
 {
+    if (std::this_thread::get_id() != _mainThread) {
+        queueMessage(category, recipient, content, notifiername, msg);
+        return;
+    }
+
+    // keep the order of the messages
+    if (_hasQueued) {
+        flush();
+    }
+    deliver(category, recipient, content, notifiername, msg);
+}
+
+void ConsoleSingleton::queueMessage(
+    const LogStyle category,
+    const IntendedRecipient recipient,
+    const ContentType content,
+    const std::string& notifiername,
+    const std::string& msg
+) const
+{
+    bool first {};
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        if (!_queue.empty()) {
+            PendingMessage& last = _queue.back();
+            if (last.category == category && last.recipient == recipient
+                && last.content == content && last.msg == msg
+                && last.notifiername == notifiername) {
+                ++last.repeated;
+                return;
+            }
+        }
+        first = _queue.empty();
+        _queue.push_back({category, recipient, content, notifiername, msg});
+        _hasQueued = true;
+    }
+
+    // otherwise a flush is already pending
+    if (first) {
+        if (const Bridge* bridge = getBridge()) {
+            bridge->postFlush();
+        }
+        else {
+            flush();
+        }
+    }
+}
+
+void ConsoleSingleton::flush() const
+{
+    std::vector<PendingMessage> messages;
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        messages.swap(_queue);
+        _hasQueued = false;
+    }
+
+    for (const PendingMessage& message : messages) {
+        deliver(
+            message.category,
+            message.recipient,
+            message.content,
+            message.notifiername,
+            message.msg
+        );
+        if (message.repeated > 0) {
+            deliver(
+                message.category,
+                message.recipient,
+                ContentType::Untranslated,
+                message.notifiername,
+                fmt::sprintf("(last message repeated %zu times)\n", message.repeated)
+            );
+        }
+    }
+}
+
+void ConsoleSingleton::deliver(
+    const LogStyle category,
+    const IntendedRecipient recipient,
+    const ContentType content,
+    const std::string& notifiername,
+    const std::string& msg
+) const
+{
+    // observers are not thread-safe
+    std::lock_guard<std::recursive_mutex> lock(_deliverMutex);
     for (ILogger* Iter : _aclObservers) {
         if (Iter->isActive(category)) {
             Iter->sendLog(
@@ -36,6 +36,8 @@
 #include <set>
 #include <string>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <FCGlobal.h>
 
 #include <fmt/printf.h>
@@ -611,6 +613,9 @@ public:
         ) const = 0;
 
         virtual void refresh() const = 0;
+
+        /// Makes the main thread call ConsoleSingleton::flush() soon
+        virtual void postFlush() const = 0;
     };
 
     using PostEventHandler = std::function<
@@ -650,6 +655,14 @@ public:
     void setPostEventHandler(PostEventHandler handler);
     void setRefreshHandler(RefreshHandler handler);
 
+    /** Delivers the messages that were sent from other threads than the main thread.
+     *  Such messages are queued and handed to the observers in batches by the main thread
+     *  once the bridge asks for it. Without a bridge the sending thread delivers them
+     *  itself, one thread at a time. Repeated messages are only delivered once, followed
+     *  by a note how often they were repeated.
+     */
+    void flush() const;
+
     constexpr FreeCAD_ConsoleMsgType getConsoleMsg(LogStyle style);
 
 private:
@@ -691,6 +704,16 @@ public:
     ConsoleSingleton& operator=(ConsoleSingleton&&) = delete;
 
 private:
+    struct PendingMessage
+    {
+        LogStyle category;
+        IntendedRecipient recipient;
+        ContentType content;
+        std::string notifiername;
+        std::string msg;
+        std::size_t repeated {0};
+    };
+
     void postEvent(
         FreeCAD_ConsoleMsgType type,
         IntendedRecipient recipient,
@@ -705,6 +728,20 @@ private:
         const std::string& notifiername,
         const std::string& msg
     ) const;
+    void queueMessage(
+        LogStyle category,
+        IntendedRecipient recipient,
+        ContentType content,
+        const std::string& notifiername,
+        const std::string& msg
+    ) const;
+    void deliver(
+        LogStyle category,
+        IntendedRecipient recipient,
+        ContentType content,
+        const std::string& notifiername,
+        const std::string& msg
+    ) const;
 
     // singleton
     static void Destruct();
@@ -715,6 +752,13 @@ private:
 
     std::map<std::string, int> _logLevels;
     int _defaultLogLevel;
+
+    // messages of other threads
+    std::thread::id _mainThread;
+    mutable std::mutex _queueMutex;
+    mutable std::vector<PendingMessage> _queue;
+    mutable std::atomic<bool> _hasQueued {false};
+    mutable std::recursive_mutex _deliverMutex;
 };
 
 /** Access to the Console
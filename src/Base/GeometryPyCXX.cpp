@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <bit>
+#include <cstring>
 #include <sstream>
 
 #include "GeometryPyCXX.h"
@@ -91,6 +93,62 @@ Base::Vector3d Py::Vector::toVector() const
 namespace Base
 {
 
+bool getValuesFromBuffer(PyObject* py, std::vector<double>& values)
+{
+    if (!PyObject_CheckBuffer(py)) {
+        return false;
+    }
+
+    Py_buffer buf;
+    if (PyObject_GetBuffer(py, &buf, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        PyErr_Clear();
+        return false;
+    }
+
+    // accept the native byte order with or without an explicit prefix
+    std::string format = buf.format ? buf.format : "B";
+    if (format.size() == 2
+        && (format[0] == '@' || format[0] == '='
+            || (format[0] == '<' && std::endian::native == std::endian::little))) {
+        format.erase(0, 1);
+    }
+
+    std::size_t count = buf.len / buf.itemsize;
+    if (format == "d") {
+        values.resize(count);
+        std::memcpy(values.data(), buf.buf, count * sizeof(double));
+    }
+    else if (format == "f") {
+        const auto* data = static_cast<const float*>(buf.buf);
+        values.assign(data, data + count);
+    }
+    else {
+        PyBuffer_Release(&buf);
+        return false;
+    }
+
+    PyBuffer_Release(&buf);
+    return true;
+}
+
+PyObject* createBufferFromValues(const std::vector<double>& values, Py_ssize_t columns)
+{
+    Py::Object bytes(
+        PyBytes_FromStringAndSize(
+            reinterpret_cast<const char*>(values.data()),  // NOLINT
+            static_cast<Py_ssize_t>(values.size() * sizeof(double))
+        ),
+        true
+    );
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    auto rows = static_cast<Py_ssize_t>(values.size()) / columns;
+    if (rows == 0) {
+        // memoryview doesn't support a shape with zero elements
+        return PyObject_CallMethod(view.ptr(), "cast", "s", "d");
+    }
+    return PyObject_CallMethod(view.ptr(), "cast", "s(nn)", "d", rows, columns);
+}
+
 Py::PythonType& Vector2dPy::behaviors()
 {
     return Py::PythonClass<Vector2dPy>::behaviors();
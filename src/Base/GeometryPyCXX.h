@@ -26,6 +26,7 @@
 #pragma once
 
 #include <CXX/Extensions.hxx>
+#include <vector>
 #include <FCGlobal.h>
 
 #include <Base/BoundBoxPy.h>
@@ -59,6 +60,17 @@ inline Vector3<T> getVectorFromTuple(PyObject* py)
     return Vector3<T>(vx, vy, vz);
 }
 
+/** Copies the numbers of a Python object that supports the buffer protocol, e.g. a numpy
+ *  array, into \a values. This avoids creating a Python object for each number.
+ *  Returns false if \a py isn't a C-contiguous buffer of floats or doubles.
+ */
+BaseExport bool getValuesFromBuffer(PyObject* py, std::vector<double>& values);
+
+/** Returns a read-only memoryview of a copy of \a values with the shape (n, \a columns),
+ *  which can be passed to numpy.asarray() without converting each number.
+ */
+BaseExport PyObject* createBufferFromValues(const std::vector<double>& values, Py_ssize_t columns);
+
 class BaseExport Vector2dPy: public Py::PythonClass<Vector2dPy>  // NOLINT
 {
 public:
@@ -45,9 +45,14 @@
 #endif
 
 #include <CXX/Extensions.hxx>
+#include <atomic>
 #include <list>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 #include "Exception.h"
+#include "Parallel.h"
 
 
 // NOLINTBEGIN
@@ -233,6 +238,77 @@ private:
     PyThreadState* state;
 };
 
+/**
+ * Calls \a func for each index in the range [0, \a count) like Base::parallelFor().
+ * The indices for which \a needsPython returns true are processed one after the other
+ * by the calling thread, which must hold the GIL. The other indices are processed by the
+ * worker pool at the same time and must not use Python, the calling thread releases the
+ * GIL and helps with them once it is done with its own ones.
+ *
+ * If \a func throws, the remaining indices are skipped and the first exception is
+ * rethrown in the calling thread.
+ */
+template<typename Func, typename Pred>
+void parallelForWithPython(
+    std::size_t count,
+    Func&& func,
+    Pred&& needsPython,
+    unsigned maxThreads = 0
+)
+{
+    std::vector<std::size_t> pythonTasks;
+    std::vector<std::size_t> otherTasks;
+    for (std::size_t i = 0; i < count; ++i) {
+        (needsPython(i) ? pythonTasks : otherTasks).push_back(i);
+    }
+    if (maxThreads == 0) {
+        maxThreads = getMaxThreads();
+    }
+    auto helpers = static_cast<unsigned>(std::min<std::size_t>(maxThreads - 1, otherTasks.size()));
+
+    std::atomic<std::size_t> next {0};
+    std::atomic<bool> failed {false};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto runTask = [&](std::size_t i) {
+        try {
+            func(i);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+            next = otherTasks.size();
+        }
+    };
+    auto runOtherTasks = [&]() {
+        for (std::size_t j = next++; j < otherTasks.size(); j = next++) {
+            runTask(otherTasks[j]);
+        }
+    };
+
+    std::thread::id caller = std::this_thread::get_id();
+    Detail::runConcurrently(helpers, [&]() {
+        if (std::this_thread::get_id() != caller) {
+            runOtherTasks();
+            return;
+        }
+        for (std::size_t i : pythonTasks) {
+            if (failed) {
+                break;
+            }
+            runTask(i);
+        }
+        PyGILStateRelease release;
+        runOtherTasks();
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 
 /** The Interpreter class
  *  This class manage the python interpreter and hold a lot
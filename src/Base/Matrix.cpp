@@ -32,6 +32,28 @@
 
 using namespace Base;
 
+namespace
+{
+// The coefficients are copied into locals so that the compiler knows that writing the vectors
+// doesn't change them, the loop then has no dependencies between the iterations and is
+// vectorized. The arithmetic is the same as in Matrix4D::multVec.
+template<typename T>
+void multVecs(const Matrix4D& mat, std::span<Vector3<T>> vecs)
+{
+    const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+    const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+    const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+    for (Vector3<T>& vec : vecs) {
+        double sx = static_cast<double>(vec.x);
+        double sy = static_cast<double>(vec.y);
+        double sz = static_cast<double>(vec.z);
+        vec.x = static_cast<T>(m00 * sx + m01 * sy + m02 * sz + m03);
+        vec.y = static_cast<T>(m10 * sx + m11 * sy + m12 * sz + m13);
+        vec.z = static_cast<T>(m20 * sx + m21 * sy + m22 * sz + m23);
+    }
+}
+}  // namespace
+
 // clang-format off
 Matrix4D::Matrix4D()
     : dMtrx4D {{{1., 0., 0., 0.},
@@ -189,6 +211,16 @@ double Matrix4D::determinant3() const
     return det;
 }
 
+void Matrix4D::multVec(std::span<Vector3d> vecs) const
+{
+    multVecs(*this, vecs);
+}
+
+void Matrix4D::multVec(std::span<Vector3f> vecs) const
+{
+    multVecs(*this, vecs);
+}
+
 void Matrix4D::move(const Vector3f& vec)
 {
     move(convertTo<Vector3d>(vec));
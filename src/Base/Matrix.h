@@ -27,6 +27,7 @@
 
 #include <array>
 #include <cmath>
+#include <span>
 #include <string>
 
 #include "Vector3D.h"
@@ -98,6 +99,9 @@ public:
     inline Vector3d operator*(const Vector3d& vec) const;
     inline void multVec(const Vector3d& src, Vector3d& dst) const;
     inline void multVec(const Vector3f& src, Vector3f& dst) const;
+    /// Multiplication matrix with all the vectors in place, same result as multVec on each
+    void multVec(std::span<Vector3d> vecs) const;
+    void multVec(std::span<Vector3f> vecs) const;
     inline Matrix4D operator*(double scalar) const;
     inline Matrix4D& operator*=(double scalar);
     /// Comparison
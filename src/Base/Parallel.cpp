@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+
+#include "Parallel.h"
+
+namespace
+{
+
+// One call of runConcurrently(). Pool threads only start the work while the job is open, and
+// the calling thread waits for the started ones after closing it.
+struct Job
+{
+    explicit Job(const std::function<void()>& work, unsigned helpers)
+        : work(work)
+        , helpers(helpers)
+    {}
+
+    const std::function<void()>& work;
+    unsigned helpers;
+    unsigned running {0};
+    bool closed {false};
+    std::mutex mutex;
+    std::condition_variable finished;
+};
+
+class WorkerPool
+{
+public:
+    static WorkerPool& instance()
+    {
+        // never destroyed, joining threads while the library is unloaded could deadlock
+        static auto* pool = new WorkerPool();  // NOLINT(cppcoreguidelines-owning-memory)
+        return *pool;
+    }
+
+    void post(const std::shared_ptr<Job>& job)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (; numThreads < job->helpers; ++numThreads) {
+            std::thread([this]() { run(); }).detach();
+        }
+        queue.push_back(job);
+        pending.notify_all();
+    }
+
+private:
+    WorkerPool() = default;
+
+    std::shared_ptr<Job> take()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        pending.wait(lock, [this]() { return !queue.empty(); });
+        std::shared_ptr<Job> job = queue.front();
+        if (--job->helpers == 0) {
+            queue.pop_front();
+        }
+        return job;
+    }
+
+    void run()
+    {
+        for (;;) {
+            std::shared_ptr<Job> job = take();
+            {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                if (job->closed) {
+                    continue;
+                }
+                ++job->running;
+            }
+            job->work();
+            std::lock_guard<std::mutex> lock(job->mutex);
+            if (--job->running == 0) {
+                job->finished.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable pending;
+    std::deque<std::shared_ptr<Job>> queue;
+    unsigned numThreads {0};
+};
+
+std::atomic<unsigned> maxThreads {0};
+
+}  // namespace
+
+void Base::setMaxThreads(unsigned count)
+{
+    maxThreads = count;
+}
+
+unsigned Base::getMaxThreads()
+{
+    unsigned count = maxThreads;
+    if (count == 0) {
+        count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    return count;
+}
+
+void Base::Detail::runConcurrently(unsigned helpers, const std::function<void()>& work)
+{
+    if (helpers == 0) {
+        work();
+        return;
+    }
+
+    auto job = std::make_shared<Job>(work, helpers);
+    WorkerPool::instance().post(job);
+    work();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->closed = true;
+    job->finished.wait(lock, [&job]() { return job->running == 0; });
+}
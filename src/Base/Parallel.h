@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <FCGlobal.h>
+
+#include "Exception.h"
+#include "Sequencer.h"
+
+namespace Base
+{
+
+/*!
+ * \brief Sets the number of threads used by parallelFor() when no explicit maximum is given.
+ * With 0 the number of hardware threads is used, with 1 all work is done by the calling thread.
+ */
+BaseExport void setMaxThreads(unsigned count);
+
+/*!
+ * \brief Returns the number of threads used by parallelFor() when no explicit maximum is given.
+ */
+BaseExport unsigned getMaxThreads();
+
+namespace Detail
+{
+/*!
+ * \brief Runs \a work on the calling thread and on up to \a helpers threads of the shared
+ * worker pool at the same time. Returns once \a work has returned on all of them.
+ *
+ * \a work must not throw and must return soon once there is nothing left to do. Pool threads
+ * that only become free after the calling thread has finished \a work don't run it at all,
+ * so that nested calls can't wait for each other.
+ */
+BaseExport void runConcurrently(unsigned helpers, const std::function<void()>& work);
+}  // namespace Detail
+
+/*!
+ * \brief Calls \a func for each index in the range [0, \a count) using worker threads.
+ *
+ * The calling thread takes part in the work and the function returns once all
+ * indices are processed. The indices are handed out one by one so that work items
+ * of different size are balanced. If \a maxThreads is 0 the value of getMaxThreads()
+ * is used. The worker threads are taken from a pool that is shared by all callers.
+ *
+ * If \a func throws, the remaining indices are skipped and the first exception is
+ * rethrown in the calling thread.
+ */
+template<typename Func>
+void parallelFor(std::size_t count, Func&& func, unsigned maxThreads = 0)
+{
+    if (maxThreads == 0) {
+        maxThreads = getMaxThreads();
+    }
+    std::size_t numThreads = std::min<std::size_t>(maxThreads, count);
+    if (numThreads <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next {0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            try {
+                func(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+
+    Detail::runConcurrently(static_cast<unsigned>(numThreads - 1), worker);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/*!
+ * \brief Like parallelFor() but reports the progress to \a seq, which must have been created
+ * with \a count steps.
+ *
+ * The progress is updated by the calling thread only. If the user cancels the operation the
+ * remaining indices are skipped and an AbortException is thrown.
+ */
+template<typename Func>
+void parallelFor(std::size_t count, Func&& func, SequencerLauncher& seq, unsigned maxThreads = 0)
+{
+    std::atomic<std::size_t> done {0};
+    std::thread::id caller = std::this_thread::get_id();
+    parallelFor(
+        count,
+        [&](std::size_t i) {
+            func(i);
+            std::size_t progress = ++done;
+            if (std::this_thread::get_id() == caller) {
+                seq.setProgress(progress);
+                if (seq.wasCanceled()) {
+                    throw AbortException("Aborted by user");
+                }
+            }
+        },
+        maxThreads
+    );
+}
+
+}  // namespace Base
@@ -703,6 +703,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
     DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
     if (pcElem) {
         XStr attr("Value");
+        _SetCachedValue(T, Name, Value);
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
@@ -715,21 +716,65 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
     }
 }
 
+bool ParameterGrp::_GetValue(ParamType Type, const char* Name, std::string& Value) const
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    ValueCache& cache = _Cache[static_cast<std::size_t>(Type)];
+    auto it = cache.find(std::string_view(Name));
+    if (it == cache.end()) {
+        std::optional<std::string> value;
+        if (DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name)) {
+            if (Type == ParamType::FCText) {
+                DOMNode* pcElem2 = pcElem->getFirstChild();
+                value = pcElem2 ? StrXUTF8(pcElem2->getNodeValue()).c_str() : "";
+            }
+            else {
+                value = StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str();
+            }
+        }
+        it = cache.emplace(Name, std::move(value)).first;
+    }
+
+    if (!it->second) {
+        return false;
+    }
+    Value = *it->second;
+    return true;
+}
+
+void ParameterGrp::_SetCachedValue(ParamType Type, const char* Name, const char* Value)
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    ValueCache& cache = _Cache[static_cast<std::size_t>(Type)];
+    std::optional<std::string> value;
+    if (Value) {
+        value = Value;
+    }
+    cache.insert_or_assign(Name, std::move(value));
+}
+
+void ParameterGrp::_ClearCache()
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    for (auto& cache : _Cache) {
+        cache.clear();
+    }
+}
+
 bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
 {
     if (!_pGroupNode) {
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
+    // check if Element in group, if not return preset
+    std::string value;
+    if (!_GetValue(ParamType::FCBool, Name, value)) {
         return bPreset;
     }
 
     // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1") == 0);
+    return value == "1";
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -799,14 +844,13 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
+    // check if Element in group, if not return preset
+    std::string value;
+    if (!_GetValue(ParamType::FCInt, Name, value)) {
         return lPreset;
     }
     // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atol(value.c_str());
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -870,16 +914,15 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
+    // check if Element in group, if not return preset
+    std::string value;
+    if (!_GetValue(ParamType::FCUInt, Name, value)) {
         return lPreset;
     }
 
     // if yes check the value and return
     const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), nullptr, base);
+    return strtoul(value.c_str(), nullptr, base);
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -951,14 +994,13 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
+    // check if Element in group, if not return preset
+    std::string value;
+    if (!_GetValue(ParamType::FCFloat, Name, value)) {
         return dPreset;
     }
     // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return atof(value.c_str());
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1046,12 +1088,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
             DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
+            _SetCachedValue(ParamType::FCText, Name, sValue);
             if (isNew || sValue[0] != 0) {
                 _Notify(ParamType::FCText, Name, sValue);
             }
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
+            _SetCachedValue(ParamType::FCText, Name, sValue);
             _Notify(ParamType::FCText, Name, sValue);
         }
         // trigger observer
@@ -1065,21 +1109,16 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
         return pPreset ? pPreset : "";
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
+    // check if Element in group, if not return preset
+    std::string value;
+    if (!_GetValue(ParamType::FCText, Name, value)) {
         if (!pPreset) {
             return {};
         }
         return {pPreset};
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
-    }
-    return {};
+    // if yes return the value
+    return value;
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1161,6 +1200,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCText, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1182,6 +1222,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCBool, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1204,6 +1245,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCFloat, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1225,6 +1267,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1246,6 +1289,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCachedValue(ParamType::FCUInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1412,6 +1456,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _ClearCache();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1583,6 +1628,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _ClearCache();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1919,6 +1965,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE::InputSource& inpu
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _ClearCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -2046,6 +2093,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache();
 }
 
 void ParameterManager::CheckDocument() const
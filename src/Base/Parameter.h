@@ -48,7 +48,11 @@ using PyObject = struct _object;
 # undef isalnum
 #endif
 
+#include <array>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <vector>
 #include <fastsignals/signal.h>
 #include <xercesc/util/XercesDefs.hpp>
@@ -441,6 +445,14 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /** Gets the value of a parameter from the cache, or from the DOM if it hasn't been
+     *  looked up yet. Returns false if the group has no parameter of this type and name.
+     */
+    bool _GetValue(ParamType Type, const char* Name, std::string& Value) const;
+    /// Updates the cached value after the DOM has been changed, nullptr marks a removed parameter
+    void _SetCachedValue(ParamType Type, const char* Name, const char* Value);
+    void _ClearCache();
+
     XERCES_CPP_NAMESPACE::DOMElement* FindNextElement(
         XERCES_CPP_NAMESPACE::DOMNode* Prev,
         const char* Type
@@ -497,6 +509,14 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+    /** Values of the parameters that have been looked up, indexed by the type and keyed by
+     *  the name. Parameters which don't exist are cached as std::nullopt. This saves walking
+     *  the DOM and transcoding its strings on every read.
+     */
+    using ValueCache = std::map<std::string, std::optional<std::string>, std::less<>>;
+    mutable std::array<ValueCache, 6> _Cache;
+    mutable std::mutex _CacheMutex;
 };
 
 /** The parameter serializer class
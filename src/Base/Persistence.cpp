@@ -78,10 +78,42 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::canReadDocFileConcurrently() const
+{
+    return false;
+}
+
+std::unique_ptr<Persistence::DocFileData> Persistence::readDocFile(Reader& /*reader*/) const
+{
+    return {};
+}
+
+void Persistence::restoreDocFileData(DocFileData& /*data*/)
+{}
+
+bool Persistence::canRestoreDocFileLazily() const
+{
+    return false;
+}
+
+void Persistence::restoreDocFileLazily(std::string&& /*content*/,
+                                       const std::string& /*fileName*/,
+                                       int /*fileVersion*/)
+{}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
+    // most attributes don't need escaping
+    constexpr const char* special = "<\"'&>\r\n\t";
+    std::size_t pos = str.find_first_of(special);
+    if (pos == std::string::npos) {
+        return str;
+    }
+
     std::string tmp;
-    for (char it : str) {
+    tmp.reserve(str.size() + 16);
+    tmp.append(str, 0, pos);
+    for (char it : std::string_view(str).substr(pos)) {
         switch (it) {
             case '<':
                 tmp += "&lt;";
@@ -156,6 +188,14 @@ static constexpr std::array<std::pair<char32_t, char32_t>, 19> discouragedRanges
  */
 std::string Persistence::validateXMLString(const std::string& str)
 {
+    // Printable ASCII, tab and line breaks are always valid
+    const bool plainAscii = std::ranges::all_of(str, [](char c) {
+        return (c >= 0x20 && c < 0x7F) || c == '\t' || c == '\n' || c == '\r';
+    });
+    if (plainAscii) {
+        return str;
+    }
+
     // Decode UTF-8 into code points and filter for XML 1.0 validity, replacing invalid or
     // discouraged code points with '_'.
     std::string out;
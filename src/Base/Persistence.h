@@ -25,6 +25,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -146,6 +149,43 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+
+    /// Base class for the content of a file that was read by readDocFile()
+    class BaseExport DocFileData
+    {
+    public:
+        virtual ~DocFileData() = default;
+    };
+    /** Returns true if readDocFile() and restoreDocFileData() are implemented.
+     * In this case the reader may read the file in a worker thread with
+     * readDocFile() and then pass the result to restoreDocFileData() in the
+     * calling thread instead of calling RestoreDocFile(). The default
+     * implementation returns false.
+     */
+    virtual bool canReadDocFileConcurrently() const;
+    /** This method reads a file written with SaveDocFile() without modifying
+     * this object. It may be called in a worker thread and therefore must not
+     * access any shared data nor register further files to read.
+     */
+    virtual std::unique_ptr<DocFileData> readDocFile(Reader& /*reader*/) const;
+    /** This method applies the content returned by readDocFile(). It's called
+     * in the same thread as RestoreDocFile() and in the order the files are
+     * stored in the archive.
+     */
+    virtual void restoreDocFileData(DocFileData& /*data*/);
+    /** Returns true if restoreDocFileLazily() is implemented. In this case the
+     * reader may pass the raw content of the file to restoreDocFileLazily()
+     * instead of calling RestoreDocFile(). The default implementation returns false.
+     */
+    virtual bool canRestoreDocFileLazily() const;
+    /** This method takes the content of a file written with SaveDocFile()
+     * without reading it. The object must restore its data from the content
+     * when it is accessed the first time.
+     */
+    virtual void restoreDocFileLazily(std::string&& /*content*/,
+                                      const std::string& /*fileName*/,
+                                      int /*fileVersion*/);
+
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
     /// Replaces all characters with '_' that are not allowed in XML
@@ -199,6 +199,24 @@ void Placement::multVec(const Vector3f& src, Vector3f& dst) const
     dst += Base::toVector<float>(this->_pos);
 }
 
+void Placement::multVec(std::span<Vector3d> vecs) const
+{
+    this->_rot.multVec(vecs);
+    const Vector3d pos = this->_pos;
+    for (Vector3d& vec : vecs) {
+        vec += pos;
+    }
+}
+
+void Placement::multVec(std::span<Vector3f> vecs) const
+{
+    this->_rot.multVec(vecs);
+    const Vector3f pos = Base::toVector<float>(this->_pos);
+    for (Vector3f& vec : vecs) {
+        vec += pos;
+    }
+}
+
 Placement Placement::slerp(const Placement& p0, const Placement& p1, double t)
 {
     Rotation rot = Rotation::slerp(p0.getRotation(), p1.getRotation(), t);
@@ -105,6 +105,9 @@ public:
 
     void multVec(const Vector3d& src, Vector3d& dst) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
+    /// Transforms all the vectors in place, same result as multVec on each
+    void multVec(std::span<Vector3d> vecs) const;
+    void multVec(std::span<Vector3f> vecs) const;
     //@}
 
     static Placement slerp(const Placement& p0, const Placement& p1, double t);
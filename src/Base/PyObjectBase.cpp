@@ -238,14 +238,13 @@ PyTypeObject PyObjectBase::Type = {
 
 PyObject* createWeakRef(PyObjectBase* ptr)
 {
-    static bool init = false;
+    // thread-safe initialization, there may be no GIL
+    static const bool init = PyType_Ready(&PyBaseProxyType) >= 0;
     if (!init) {
-       init = true;
-       if (PyType_Ready(&PyBaseProxyType) < 0) {
-           return nullptr;
-        }
+        return nullptr;
     }
 
+    PyObjectLocker lock(ptr);
     PyObject* proxy = ptr->baseProxy;
     if (!proxy) {
         proxy = PyType_GenericAlloc(&PyBaseProxyType, 0);
@@ -304,6 +303,7 @@ PyObject* PyObjectBase::__getattro(PyObject * obj, PyObject *attro)
 
     // This should be the entry in Type
     PyObjectBase* pyObj = static_cast<PyObjectBase*>(obj);
+    PyObjectLocker lock(obj);
     if (!pyObj->isValid()){
         PyErr_Format(PyExc_ReferenceError, "Cannot access attribute '%s' of deleted object", attr);
         return nullptr;
@@ -364,6 +364,8 @@ int PyObjectBase::__setattro(PyObject *obj, PyObject *attro, PyObject *value)
         PyErr_Format(PyExc_AttributeError, "Cannot delete attribute: '%s'", attr);
         return -1;
     }
+
+    PyObjectLocker lock(obj);
     if (!static_cast<PyObjectBase*>(obj)->isValid()){
         PyErr_Format(PyExc_ReferenceError, "Cannot access attribute '%s' of deleted object", attr);
         return -1;
@@ -324,6 +324,41 @@ private:
     PyObject* attrDict{nullptr};
 };
 
+/** Locks a Python object while an instance of this class exists.
+ *  With free-threaded Python builds (PEP 703) there is no GIL that serializes the
+ *  access to an object, so a per-object critical section is used instead. It's
+ *  suspended when the thread blocks, so nested locks can't deadlock. With the GIL
+ *  the class does nothing.
+ */
+class PyObjectLocker
+{
+public:
+#ifdef Py_GIL_DISABLED
+    explicit PyObjectLocker(PyObject* obj)
+    {
+        PyCriticalSection_Begin(&section, obj);
+    }
+    ~PyObjectLocker()
+    {
+        PyCriticalSection_End(&section);
+    }
+#else
+    explicit PyObjectLocker(PyObject* /*obj*/)
+    {}
+    ~PyObjectLocker() = default;
+#endif
+
+    PyObjectLocker(const PyObjectLocker&) = delete;
+    PyObjectLocker(PyObjectLocker&&) = delete;
+    PyObjectLocker& operator=(const PyObjectLocker&) = delete;
+    PyObjectLocker& operator=(PyObjectLocker&&) = delete;
+
+#ifdef Py_GIL_DISABLED
+private:
+    PyCriticalSection section;
+#endif
+};
+
 
 
 
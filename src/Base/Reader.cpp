@@ -25,6 +25,8 @@
 #include <map>
 #include <vector>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <string>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -37,6 +39,7 @@
 #include "Console.h"
 #include "Exception.h"
 #include "InputSource.h"
+#include "Parallel.h"
 #include "Persistence.h"
 #include "Sequencer.h"
 #include "Stream.h"
@@ -102,7 +105,18 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
-    return static_cast<unsigned int>(AttrMap.size());
+    return static_cast<unsigned int>(AttrCount);
+}
+
+const std::string* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    // elements have only a few attributes, a linear search is faster than any lookup table
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        if (Attributes[i].first == AttrName) {
+            return &Attributes[i].second;
+        }
+    }
+    return nullptr;
 }
 
 namespace
@@ -129,17 +143,32 @@ T readerCast(const char* value)
         return std::string_view(value) != "0";
     }
 }
+
+// Element and attribute names and most of the values are ASCII. They are copied directly into
+// the reused string instead of being transcoded into a newly allocated one.
+template<typename Transcoder>
+void assignXMLString(std::string& dst, const XMLCh* const src)
+{
+    dst.clear();
+    for (const XMLCh* it = src; *it != 0; ++it) {
+        if (*it >= 0x80) {
+            dst = Transcoder(src).c_str();
+            return;
+        }
+        dst.push_back(static_cast<char>(*it));
+    }
+}
 }  // anonymous namespace
 
 template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName, T defaultValue) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const std::string* value = findAttribute(AttrName);
+    if (!value) {
         return defaultValue;
     }
-    const char* rawValue = pos->second.c_str();
+    const char* rawValue = value->c_str();
     return readerCast<T>(rawValue);
 }
 
@@ -147,13 +176,13 @@ template<typename T>
     requires Base::XMLReader::instantiated<T>
 T Base::XMLReader::getAttribute(const char* AttrName) const
 {
-    auto pos = AttrMap.find(AttrName);
-    if (pos == AttrMap.end()) {
+    const std::string* value = findAttribute(AttrName);
+    if (!value) {
         // wrong name, use hasAttribute if not sure!
         std::string msg = std::string("XML Attribute: \"") + AttrName + "\" not found";
         throw Base::XMLAttributeError(msg);
     }
-    const char* rawValue = pos->second.c_str();
+    const char* rawValue = value->c_str();
     return readerCast<T>(rawValue);
 }
 
@@ -190,7 +219,7 @@ template BaseExport unsigned long Base::XMLReader::getAttribute<unsigned long>(
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
@@ -452,6 +481,12 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+    // Files of objects that support it are buffered and read in worker threads
+    // once all entries are processed, see readBufferedFiles()
+    std::vector<BufferedFile> buffered;
+    bool concurrent = testStatus(ConcurrentFileReading);
+    bool lazy = testStatus(LazyFileReading);
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -463,7 +498,28 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         }
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
-        if (jt != FileList.end()) {
+        if (jt != FileList.end() && lazy && jt->Object->canRestoreDocFileLazily()) {
+            try {
+                std::string content(std::istreambuf_iterator<char>(zipstream),
+                                    std::istreambuf_iterator<char>{});
+                jt->Object->restoreDocFileLazily(std::move(content), jt->FileName, FileVersion);
+            }
+            catch (...) {
+                Base::Console().error("Reading failed from embedded file: %s\n",
+                                      entry->toString().c_str());
+                FailedFiles.push_back(jt->FileName);
+            }
+            it = jt + 1;
+        }
+        else if (jt != FileList.end() && concurrent && jt->Object->canReadDocFileConcurrently()) {
+            BufferedFile file;
+            file.Entry = &*jt;
+            file.Buffer.assign(std::istreambuf_iterator<char>(zipstream),
+                               std::istreambuf_iterator<char>());
+            buffered.push_back(std::move(file));
+            it = jt + 1;
+        }
+        else if (jt != FileList.end()) {
             try {
                 Base::Reader reader(zipstream, jt->FileName, FileVersion);
                 jt->Object->RestoreDocFile(reader);
@@ -498,6 +554,48 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    readBufferedFiles(buffered);
+}
+
+void Base::XMLReader::readBufferedFiles(std::vector<BufferedFile>& files) const
+{
+    if (files.empty()) {
+        return;
+    }
+
+    Base::parallelFor(files.size(), [this, &files](std::size_t index) {
+        BufferedFile& file = files[index];
+        try {
+            std::istringstream str(file.Buffer);
+            Base::Reader reader(str, file.Entry->FileName, FileVersion);
+            file.Data = file.Entry->Object->readDocFile(reader);
+        }
+        catch (...) {
+            file.Data.reset();
+        }
+        // release the memory as early as possible
+        std::string().swap(file.Buffer);
+    });
+
+    // apply the content in the order of the archive
+    for (auto& file : files) {
+        bool restored = false;
+        if (file.Data) {
+            try {
+                file.Entry->Object->restoreDocFileData(*file.Data);
+                restored = true;
+            }
+            catch (...) {
+                // handled below in the same way as a failed read
+            }
+        }
+        if (!restored) {
+            Base::Console().error("Reading failed from embedded file: %s\n",
+                                  file.Entry->FileName.c_str());
+            FailedFiles.push_back(file.Entry->FileName);
+        }
+    }
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
@@ -568,12 +666,16 @@ void Base::XMLReader::startElement(
 )
 {
     Level++;  // new scope
-    LocalName = StrX(localname).c_str();
+    assignXMLString<StrX>(LocalName, localname);
 
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    // saving attributes of the current scope, overwrite all previously stored ones
+    AttrCount = attrs.getLength();
+    if (Attributes.size() < AttrCount) {
+        Attributes.resize(AttrCount);
+    }
+    for (std::size_t i = 0; i < AttrCount; i++) {
+        assignXMLString<StrX>(Attributes[i].first, attrs.getQName(i));
+        assignXMLString<StrXUTF8>(Attributes[i].second, attrs.getValue(i));
     }
 
     ReadType = StartElement;
@@ -582,7 +684,7 @@ void Base::XMLReader::startElement(
 void Base::XMLReader::endElement(const XMLCh* const /*uri*/, const XMLCh* const localname, const XMLCh* const /*qname*/)
 {
     Level--;  // end of scope
-    LocalName = StrX(localname).c_str();
+    assignXMLString<StrX>(LocalName, localname);
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -604,7 +706,7 @@ void Base::XMLReader::endCDATA()
 
 void Base::XMLReader::characters(const XMLCh* const chars, const XMLSize_t length)
 {
-    Characters = StrX(chars).c_str();
+    assignXMLString<StrX>(Characters, chars);
     ReadType = Chars;
     CharacterCount += length;
 }
@@ -36,6 +36,7 @@
 #include <boost/iostreams/categories.hpp>
 
 #include "FileInfo.h"
+#include "Persistence.h"
 
 
 namespace zipios
@@ -129,7 +130,9 @@ public:
         PartialRestoreInDocumentObject = 1,  // This bit is local to the DocumentObject being read
                                              // indicating a partial restore therein
         PartialRestoreInProperty = 2,        // Local to the Property
-        PartialRestoreInObject = 3           // Local to the object partially restored itself
+        PartialRestoreInObject = 3,          // Local to the object partially restored itself
+        ConcurrentFileReading = 4,  // Read registered files in worker threads where supported
+        LazyFileReading = 5  // Defer reading registered files to their first use where supported
     };
     /// open the file and read the first element
     XMLReader(const char* FileName, std::istream&);
@@ -358,8 +361,11 @@ private:
     unsigned int CharacterCount {0};
     std::streamsize CharacterOffset {-1};
 
-    std::map<std::string, std::string> AttrMap;
-    using AttrMapType = std::map<std::string, std::string>;
+    // The attributes of the current element. The strings are kept for the next elements to avoid
+    // allocating them again, only the first AttrCount entries are valid.
+    std::vector<std::pair<std::string, std::string>> Attributes;
+    std::size_t AttrCount {0};
+    const std::string* findAttribute(const char* AttrName) const;
 
     enum
     {
@@ -390,6 +396,15 @@ public:
     std::vector<FileEntry> FileList;
 
 private:
+    /// A registered file that is read in a worker thread
+    struct BufferedFile
+    {
+        const FileEntry* Entry {nullptr};
+        std::string Buffer;
+        std::unique_ptr<Base::Persistence::DocFileData> Data;
+    };
+    void readBufferedFiles(std::vector<BufferedFile>& files) const;
+
     mutable std::vector<std::string> FailedFiles;
 
     std::bitset<32> StatusBits;
@@ -484,6 +484,52 @@ Vector3f Rotation::multVec(const Vector3f& src) const
     return dst;
 }
 
+namespace
+{
+// The rotation matrix is computed once for all the vectors, with the same arithmetic as in
+// Rotation::multVec, and the loop has no dependencies between the iterations.
+template<typename T>
+void multVecs(const double quat[4], std::span<Vector3<T>> vecs)
+{
+    double x = quat[0];
+    double y = quat[1];
+    double z = quat[2];
+    double w = quat[3];
+    double x2 = x * x;
+    double y2 = y * y;
+    double z2 = z * z;
+    double w2 = w * w;
+
+    const double m00 = x2 + w2 - y2 - z2;
+    const double m01 = 2.0 * (x * y - z * w);
+    const double m02 = 2.0 * (x * z + y * w);
+    const double m10 = 2.0 * (x * y + z * w);
+    const double m11 = w2 - x2 + y2 - z2;
+    const double m12 = 2.0 * (y * z - x * w);
+    const double m20 = 2.0 * (x * z - y * w);
+    const double m21 = 2.0 * (x * w + y * z);
+    const double m22 = w2 - x2 - y2 + z2;
+    for (Vector3<T>& vec : vecs) {
+        double sx = static_cast<double>(vec.x);
+        double sy = static_cast<double>(vec.y);
+        double sz = static_cast<double>(vec.z);
+        vec.x = static_cast<T>(m00 * sx + m01 * sy + m02 * sz);
+        vec.y = static_cast<T>(m10 * sx + m11 * sy + m12 * sz);
+        vec.z = static_cast<T>(m20 * sx + m21 * sy + m22 * sz);
+    }
+}
+}  // namespace
+
+void Rotation::multVec(std::span<Vector3d> vecs) const
+{
+    multVecs(this->quat, vecs);
+}
+
+void Rotation::multVec(std::span<Vector3f> vecs) const
+{
+    multVecs(this->quat, vecs);
+}
+
 void Rotation::scaleAngle(const double scaleFactor)
 {
     Vector3d axis;
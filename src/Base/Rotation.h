@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "Vector3D.h"
 #include <FCGlobal.h>
 
@@ -159,6 +161,9 @@ public:
     Vector3d multVec(const Vector3d& src) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
     Vector3f multVec(const Vector3f& src) const;
+    /// Rotates all the vectors in place, same result as multVec on each
+    void multVec(std::span<Vector3d> vecs) const;
+    void multVec(std::span<Vector3f> vecs) const;
     void scaleAngle(double scaleFactor);
     //@}
 
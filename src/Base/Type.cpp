@@ -57,6 +57,9 @@ struct Base::TypeData
     const Type parent;
     const Type type;
     const Type::instantiationMethod instMethod;
+    /// The type and its parents indexed by their depth in the hierarchy, the root type first.
+    /// A type is derived from another one if that is its ancestor at the other one's depth.
+    std::vector<Type::TypeId> ancestors;
 };
 
 namespace
@@ -64,7 +67,7 @@ namespace
 constexpr const char* BadTypeName = "BadType";
 }
 
-std::map<std::string, unsigned int> Type::typemap;
+std::unordered_map<std::string, Type::TypeId, Type::NameHash, std::equal_to<>> Type::typemap;
 std::vector<TypeData*> Type::typedata;
 std::set<std::string> Type::loadModuleSet;
 
@@ -143,7 +146,13 @@ const Type Type::createType(const Type parent, const char* name, instantiationMe
 
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
-    Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
+    auto data = new TypeData(name, newType, parent, method);
+    // a parent is always created before its children
+    if (!parent.isBad() && parent.index < typedata.size()) {
+        data->ancestors = typedata[parent.index]->ancestors;
+    }
+    data->ancestors.push_back(newType.index);
+    Type::typedata.emplace_back(data);
 
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
@@ -156,6 +165,7 @@ void Type::init()
 {
     assert(Type::typedata.size() == 0 && "Type::init() should only be called once");
     typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
+    typedata.back()->ancestors.push_back(BadTypeIndex);
     typemap[BadTypeName] = 0;
 }
 
@@ -171,7 +181,7 @@ void Type::destruct()
 
 const Type Type::fromName(const char* name)
 {
-    const auto pos = typemap.find(name);
+    const auto pos = typemap.find(std::string_view(name));
     if (pos == typemap.end()) {
         return Type::BadType;
     }
@@ -206,15 +216,13 @@ const Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
+    if (index >= typedata.size() || type.index >= typedata.size()) {
+        return *this == type;
+    }
 
-    return false;
+    const auto& ancestors = typedata[index]->ancestors;
+    const std::size_t depth = typedata[type.index]->ancestors.size() - 1;
+    return depth < ancestors.size() && ancestors[depth] == type.index;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
@@ -27,9 +27,12 @@
 
 // Std. configurations
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <FCGlobal.h>
 
@@ -150,7 +153,17 @@ private:
 
     TypeId index {BadTypeIndex};
 
-    static std::map<std::string, TypeId> typemap;
+    // allows to look up a type name without creating a std::string
+    struct NameHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view> {}(name);
+        }
+    };
+
+    static std::unordered_map<std::string, TypeId, NameHash, std::equal_to<>> typemap;
     static std::vector<TypeData*> typedata;  // use pointer to hide implementation details
     static std::set<std::string> loadModuleSet;
 
@@ -144,52 +144,6 @@ Unit::Unit(
     checkRange();
 }
 
-bool Unit::operator==(const Unit& that) const
-{
-    return _exps == that._exps;
-}
-
-bool Unit::operator!=(const Unit& that) const
-{
-    return _exps != that._exps;
-}
-
-Unit& Unit::operator*=(const Unit& that)
-{
-    *this = *this * that;
-    return *this;
-}
-
-Unit& Unit::operator/=(const Unit& that)
-{
-    *this = *this / that;
-    return *this;
-}
-
-Unit Unit::operator*(const Unit& right) const
-{
-    auto mult = [&](auto leftExponent, auto rightExponent) {
-        return leftExponent + rightExponent;
-    };
-
-    UnitExponents res {};
-    std::transform(_exps.begin(), _exps.end(), right._exps.begin(), res.begin(), mult);
-
-    return Unit {res};
-}
-
-Unit Unit::operator/(const Unit& right) const
-{
-    auto div = [&](auto leftExponent, auto rightExponent) {
-        return leftExponent - rightExponent;
-    };
-
-    UnitExponents res {};
-    std::transform(_exps.begin(), _exps.end(), right._exps.begin(), res.begin(), div);
-
-    return Unit {res};
-}
-
 Unit Unit::root(const uint8_t num) const
 {
     auto apply = [&](auto val) {
@@ -68,12 +68,42 @@ public:
         const int angle = 0
     );
 
-    bool operator==(const Unit&) const;
-    bool operator!=(const Unit& that) const;
-    Unit& operator*=(const Unit& that);
-    Unit& operator/=(const Unit& that);
-    Unit operator*(const Unit&) const;
-    Unit operator/(const Unit&) const;
+    // The unit arithmetic is inline so that Quantity operations on the packed exponents compile
+    // down to a few byte additions instead of calls into the library.
+    constexpr bool operator==(const Unit& that) const
+    {
+        return _exps == that._exps;
+    }
+    constexpr bool operator!=(const Unit& that) const
+    {
+        return _exps != that._exps;
+    }
+    constexpr Unit& operator*=(const Unit& that)
+    {
+        *this = *this * that;
+        return *this;
+    }
+    constexpr Unit& operator/=(const Unit& that)
+    {
+        *this = *this / that;
+        return *this;
+    }
+    constexpr Unit operator*(const Unit& right) const
+    {
+        UnitExponents res {};
+        for (std::size_t i = 0; i < unitNumExponents; ++i) {
+            res[i] = static_cast<int8_t>(_exps[i] + right._exps[i]);
+        }
+        return Unit {res};
+    }
+    constexpr Unit operator/(const Unit& right) const
+    {
+        UnitExponents res {};
+        for (std::size_t i = 0; i < unitNumExponents; ++i) {
+            res[i] = static_cast<int8_t>(_exps[i] - right._exps[i]);
+        }
+        return Unit {res};
+    }
 
     [[nodiscard]] Unit pow(const double exp) const;
     [[nodiscard]] Unit root(const uint8_t num) const;
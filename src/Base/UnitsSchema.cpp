@@ -25,9 +25,11 @@
 #include <algorithm>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 #include <unicode/decimfmt.h>
 #include <unicode/dcfmtsym.h>
@@ -64,17 +66,38 @@ bool useQtLikeGeneralScientific(const double value, const int precision)
     return exponent < -4 || exponent >= precision;
 }
 
-std::string localizeDecimalSeparator(std::string value, const icu::Locale& locale)
+// Creating an ICU number format loads the locale data, which costs far more than formatting
+// the number. The configured formats are therefore kept per thread until the locale changes.
+struct NumberFormatCache
 {
-    UErrorCode status = U_ZERO_ERROR;
-    icu::DecimalFormatSymbols symbols(locale, status);
-    if (!U_SUCCESS(status)) {
-        return value;
+    using Key = std::tuple<int, int, bool>;  // format, precision, omit group separator
+
+    bool initialized {false};
+    std::string localeName;
+    std::string decimalSeparator;
+    std::map<Key, std::unique_ptr<icu::NumberFormat>> formats;
+};
+
+NumberFormatCache& numberFormatCache(const icu::Locale& locale)
+{
+    thread_local NumberFormatCache cache;
+    if (!cache.initialized || cache.localeName != locale.getName()) {
+        cache.initialized = true;
+        cache.localeName = locale.getName();
+        cache.formats.clear();
+
+        UErrorCode status = U_ZERO_ERROR;
+        icu::DecimalFormatSymbols symbols(locale, status);
+        cache.decimalSeparator = U_SUCCESS(status)
+            ? toUtf8(symbols.getSymbol(icu::DecimalFormatSymbols::kDecimalSeparatorSymbol))
+            : std::string(".");
     }
+    return cache;
+}
 
-    const std::string decimal = toUtf8(
-        symbols.getSymbol(icu::DecimalFormatSymbols::kDecimalSeparatorSymbol)
-    );
+std::string localizeDecimalSeparator(std::string value, const icu::Locale& locale)
+{
+    const std::string& decimal = numberFormatCache(locale).decimalSeparator;
     if (decimal == ".") {
         return value;
     }
@@ -99,28 +122,15 @@ std::string formatDefaultScientificLikeQt(
     return localizeDecimalSeparator(out.str(), locale);
 }
 
-std::string formatNumberIcu(const double value, const Base::QuantityFormat& format)
+std::unique_ptr<icu::NumberFormat> createNumberFormat(
+    const Base::QuantityFormat& format,
+    const icu::Locale& locale
+)
 {
     UErrorCode status = U_ZERO_ERROR;
-    icu::Locale locale = icu::Locale::getDefault();
-
     std::unique_ptr<icu::NumberFormat> nf(icu::NumberFormat::createInstance(locale, status));
     if (!U_SUCCESS(status) || !nf) {
-        // Fallback: locale-independent formatting.
-        std::ostringstream out;
-        switch (format.format) {
-            case Base::QuantityFormat::Fixed:
-                out << std::fixed;
-                break;
-            case Base::QuantityFormat::Scientific:
-                out << std::scientific;
-                break;
-            case Base::QuantityFormat::Default:
-            default:
-                break;
-        }
-        out << std::setprecision(format.getPrecision()) << value;
-        return out.str();
+        return {};
     }
 
     if (format.option & Base::QuantityFormat::OmitGroupSeparator) {
@@ -142,9 +152,6 @@ std::string formatNumberIcu(const double value, const Base::QuantityFormat& form
             }
             [[fallthrough]];
         case Base::QuantityFormat::Default:
-            if (useQtLikeGeneralScientific(value, precision)) {
-                return formatDefaultScientificLikeQt(value, format, locale);
-            }
             if (auto* df = dynamic_cast<icu::DecimalFormat*>(nf.get()); precision > 0 && df) {
                 df->setSignificantDigitsUsed(true);
                 df->setMinimumSignificantDigits(1);
@@ -157,6 +164,51 @@ std::string formatNumberIcu(const double value, const Base::QuantityFormat& form
             break;
     }
 
+    return nf;
+}
+
+std::string formatNumberIcu(const double value, const Base::QuantityFormat& format)
+{
+    const icu::Locale& locale = icu::Locale::getDefault();
+    const int precision = format.getPrecision();
+
+    NumberFormatCache& cache = numberFormatCache(locale);
+    const NumberFormatCache::Key key {
+        format.format,
+        precision,
+        (format.option & Base::QuantityFormat::OmitGroupSeparator) != 0
+    };
+    auto it = cache.formats.find(key);
+    if (it == cache.formats.end()) {
+        it = cache.formats.emplace(key, createNumberFormat(format, locale)).first;
+    }
+
+    const icu::NumberFormat* nf = it->second.get();
+    if (!nf) {
+        // Fallback: locale-independent formatting.
+        std::ostringstream out;
+        switch (format.format) {
+            case Base::QuantityFormat::Fixed:
+                out << std::fixed;
+                break;
+            case Base::QuantityFormat::Scientific:
+                out << std::scientific;
+                break;
+            case Base::QuantityFormat::Default:
+            default:
+                break;
+        }
+        out << std::setprecision(precision) << value;
+        return out.str();
+    }
+
+    const bool generalFormat = format.format == Base::QuantityFormat::Default
+        || (format.format == Base::QuantityFormat::Scientific
+            && !dynamic_cast<const icu::DecimalFormat*>(nf));
+    if (generalFormat && useQtLikeGeneralScientific(value, precision)) {
+        return formatDefaultScientificLikeQt(value, format, locale);
+    }
+
     icu::UnicodeString s;
     nf->format(value, s);
     return toUtf8(s);
@@ -179,14 +231,12 @@ std::string UnitsSchema::translate(const Quantity& quant, double& factor, std::s
 {
     // Use defaults without schema-level translation.
     factor = 1.0;
-    unitString = quant.getUnit().getString();
-
-    if (spec.translationSpecs.empty()) {
-        return toLocale(quant, factor, unitString);
-    }
 
-    const auto unitName = quant.getUnit().getTypeString();
-    if (!spec.translationSpecs.contains(unitName)) {
+    const auto translation = spec.translationSpecs.empty()
+        ? spec.translationSpecs.end()
+        : spec.translationSpecs.find(quant.getUnit().getTypeString());
+    if (translation == spec.translationSpecs.end()) {
+        unitString = quant.getUnit().getString();
         return toLocale(quant, factor, unitString);
     }
 
@@ -200,7 +250,7 @@ std::string UnitsSchema::translate(const Quantity& quant, double& factor, std::s
             || row.threshold == 0;  // zero indicates default
     };
 
-    auto unitSpecs = spec.translationSpecs.at(unitName);
+    const auto& unitSpecs = translation->second;
     const auto unitSpec = std::find_if(unitSpecs.begin(), unitSpecs.end(), isSuitable);
     if (unitSpec == unitSpecs.end()) {
         throw RuntimeError(
@@ -209,6 +259,7 @@ std::string UnitsSchema::translate(const Quantity& quant, double& factor, std::s
     }
 
     if (unitSpec->factor == 0) {
+        unitString = quant.getUnit().getString();
         const QuantityFormat& format = quant.getFormat();
         return UnitsSchemasData::runSpecial(
             unitSpec->unitString,
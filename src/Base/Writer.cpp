@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 
+#include <array>
 #include <memory>
 #include <set>
 #include <vector>
@@ -32,11 +33,15 @@
 #include <locale>
 #include <iomanip>
 
+#include <zlib.h>
+#include <fmt/format.h>
+
 #include "Writer.h"
 #include "Base64.h"
 #include "Base64Filter.h"
 #include "Exception.h"
 #include "FileInfo.h"
+#include "Parallel.h"
 #include "Persistence.h"
 #include "Stream.h"
 #include "Tools.h"
@@ -81,6 +86,31 @@ struct cdata_filter
     int state = 0;
 };
 
+std::ostream& Base::operator<<(std::ostream& out, FastDouble value)
+{
+    // only the default format of the stream is the same as the general format
+    constexpr std::ios_base::fmtflags modifiers = std::ios_base::floatfield
+        | std::ios_base::showpoint | std::ios_base::showpos | std::ios_base::uppercase;
+    if ((out.flags() & modifiers) || out.width() != 0) {
+        return out << value.value;
+    }
+
+    std::array<char, 64> buffer {};
+    const auto precision = static_cast<int>(out.precision());
+    const auto result = fmt::format_to_n(
+        buffer.data(),
+        buffer.size(),
+        "{:.{}g}",
+        value.value,
+        precision > 0 ? precision : 1
+    );
+    if (result.size > buffer.size()) {
+        return out << value.value;
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(result.size));
+    return out;
+}
+
 // ---------------------------------------------------------------------------
 //  Writer: Constructors and Destructor
 // ---------------------------------------------------------------------------
@@ -366,8 +396,24 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     Writer::checkErrNo();
 }
 
+void ZipWriter::setLevel(const std::string& extension, int level)
+{
+    ExtensionLevels[extension] = level;
+}
+
+int ZipWriter::getLevel(const std::string& fileName) const
+{
+    auto it = ExtensionLevels.find(FileInfo(fileName).extension());
+    return it != ExtensionLevels.end() ? it->second : Level;
+}
+
 void ZipWriter::writeFiles()
 {
+    if (ParallelCompression) {
+        writeFilesConcurrently();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
@@ -381,6 +427,101 @@ void ZipWriter::writeFiles()
     }
 }
 
+struct ZipWriter::CompressedFile
+{
+    std::string FileName;
+    std::string Data;
+    int Level {Z_DEFAULT_COMPRESSION};
+    zipios::StorageMethod Method {zipios::DEFLATED};
+    uLong Crc {0};
+    uLong Size {0};
+};
+
+namespace
+{
+// Compress to a raw deflate stream as expected by the zip format
+void compressFile(std::string& data, int level)
+{
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("Failed to initialize zlib");
+    }
+
+    std::string out(deflateBound(&zs, static_cast<uLong>(data.size())), '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(data.data());  // NOLINT
+    zs.avail_in = static_cast<uInt>(data.size());
+    zs.next_out = reinterpret_cast<Bytef*>(out.data());  // NOLINT
+    zs.avail_out = static_cast<uInt>(out.size());
+    int ret = deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (ret != Z_STREAM_END) {
+        throw Base::RuntimeError("Failed to compress data");
+    }
+    data.swap(out);
+}
+}  // namespace
+
+void ZipWriter::writeFilesConcurrently()
+{
+    // Limits the memory used for buffering the uncompressed files
+    constexpr std::size_t maxBatchSize = 64 * 1024 * 1024;
+
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        std::vector<CompressedFile> batch;
+        std::size_t batchSize = 0;
+        while (index < FileList.size() && batchSize < maxBatchSize) {
+            FileEntry entry = FileList[index];
+            Writer::putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+
+            std::ostringstream buffer;
+            buffer.imbue(std::locale::classic());
+            buffer.precision(std::numeric_limits<double>::digits10 + 1);
+            buffer.setf(std::ios::fixed, std::ios::floatfield);
+            FileStream = &buffer;
+            entry.Object->SaveDocFile(*this);
+            FileStream = nullptr;
+
+            CompressedFile file;
+            file.FileName = entry.FileName;
+            file.Data = buffer.str();
+            file.Level = getLevel(entry.FileName);
+            batchSize += file.Data.size();
+            batch.push_back(std::move(file));
+            index++;
+        }
+
+        Base::parallelFor(batch.size(), [&batch](std::size_t i) {
+            CompressedFile& file = batch[i];
+            file.Size = static_cast<uLong>(file.Data.size());
+            file.Crc = crc32(0L,
+                             reinterpret_cast<const Bytef*>(file.Data.data()),  // NOLINT
+                             static_cast<uInt>(file.Data.size()));
+            if (file.Level == Z_NO_COMPRESSION) {
+                file.Method = zipios::STORED;
+            }
+            else {
+                compressFile(file.Data, file.Level);
+            }
+        });
+
+        for (const auto& file : batch) {
+            ZipStream.putRawEntry(file.FileName,
+                                  file.Method,
+                                  file.Data.data(),
+                                  static_cast<zipios::uint32>(file.Data.size()),
+                                  static_cast<zipios::uint32>(file.Crc),
+                                  static_cast<zipios::uint32>(file.Size));
+        }
+        Writer::checkErrNo();
+    }
+}
+
 ZipWriter::~ZipWriter()
 {
     ZipStream.close();
@@ -25,6 +25,7 @@
 #pragma once
 
 
+#include <map>
 #include <set>
 #include <string>
 #include <sstream>
@@ -43,6 +44,20 @@ namespace Base
 
 class Persistence;
 
+/** Writes a double to a stream with the same result as writing the double directly with the
+ *  precision of the stream, but formats it with fmt instead of the locale aware stream
+ *  formatting. This matters when saving many values. The writer streams use the classic locale.
+ *  \code
+ *  writer.Stream() << " x=\"" << Base::FastDouble {x} << "\"";
+ *  \endcode
+ */
+struct FastDouble
+{
+    double value;
+};
+
+BaseExport std::ostream& operator<<(std::ostream& out, FastDouble value);
+
 
 /** The Writer class
  * This is an important helper class for the store and retrieval system
@@ -226,12 +241,12 @@ public:
 
     std::ostream& Stream() override
     {
-        return ZipStream;
+        return FileStream ? static_cast<std::ostream&>(*FileStream) : ZipStream;
     }
 
     const std::ostream& Stream() const override
     {
-        return ZipStream;
+        return FileStream ? static_cast<const std::ostream&>(*FileStream) : ZipStream;
     }
 
     void setComment(const char* str)
@@ -240,8 +255,21 @@ public:
     }
     void setLevel(int level)
     {
+        Level = level;
         ZipStream.setLevel(level);
     }
+    /** Sets the compression level for the files written by writeFiles() with the given
+     * file extension. A level of 0 stores the files uncompressed, which is useful for
+     * data that is already compressed like images.
+     */
+    void setLevel(const std::string& extension, int level);
+    /** If enabled writeFiles() compresses the files in worker threads. The files are
+     * still written to the archive in the order they were added.
+     */
+    void setParallelCompression(bool on)
+    {
+        ParallelCompression = on;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -250,7 +278,16 @@ public:
     ZipWriter& operator=(ZipWriter&&) = delete;
 
 private:
+    struct CompressedFile;
+    void writeFilesConcurrently();
+    int getLevel(const std::string& fileName) const;
+
     zipios::ZipOutputStream ZipStream;
+    // buffer for the content of a file that is compressed in a worker thread
+    std::ostringstream* FileStream {nullptr};
+    std::map<std::string, int> ExtensionLevels;
+    int Level {6};
+    bool ParallelCompression {false};
 };
 
 /** The StringWriter class
@@ -20,6 +20,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <limits>
 #include <QApplication>
 #include <QFile>
 #include <QDir>
@@ -31,6 +32,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <Base/Console.h>
+#include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
@@ -138,12 +140,204 @@ void AutoSaver::slotDeleteDocument(const App::Document& Doc)
     }
 }
 
-void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
+namespace Gui
+{
+
+/*!
+ The class RecoverySnapshot takes a snapshot of a document for a compressed recovery file.
+ The XML files are kept as strings and for the data files of properties copies of the
+ properties are created. These share their data with the document until it's modified
+ so that the recovery file can be written by a worker thread.
+ */
+class RecoverySnapshot: public Base::Writer
 {
+public:
+    struct Entry
+    {
+        std::string fileName;
+        std::string data;
+        std::unique_ptr<App::Property> prop;
+    };
+
+    RecoverySnapshot()
+    {
+        buffer.imbue(std::locale::classic());
+        buffer.precision(std::numeric_limits<double>::digits10 + 1);
+        buffer.setf(std::ios::fixed, std::ios::floatfield);
+    }
+
+    std::ostream& Stream() override
+    {
+        return buffer;
+    }
+    const std::ostream& Stream() const override
+    {
+        return buffer;
+    }
+
+    void putNextEntry(const char* filename, const char* objName = nullptr) override
+    {
+        Writer::putNextEntry(filename, objName);
+        closeEntry();
+        entries.emplace_back();
+        entries.back().fileName = filename;
+        entryOpen = true;
+    }
+
+    void writeFiles() override
+    {
+        // use a while loop because it is possible that while
+        // processing the files new ones can be added
+        size_t index = 0;
+        while (index < FileList.size()) {
+            FileEntry entry = FileList[index];
+            if (entry.Object->isDerivedFrom<App::Property>()) {
+                closeEntry();
+                entries.emplace_back();
+                entries.back().fileName = entry.FileName;
+                entries.back().prop.reset(static_cast<const App::Property*>(entry.Object)->Copy());
+            }
+            else {
+                putNextEntry(entry.FileName.c_str());
+                indent = 0;
+                indBuf[0] = 0;
+                entry.Object->SaveDocFile(*this);
+            }
+            index++;
+        }
+        closeEntry();
+    }
+
+    std::vector<Entry> takeEntries()
+    {
+        closeEntry();
+        return std::move(entries);
+    }
+
+private:
+    void closeEntry()
+    {
+        if (entryOpen) {
+            entries.back().data = buffer.str();
+            buffer.str(std::string());
+            entryOpen = false;
+        }
+    }
+
+    std::ostringstream buffer;
+    std::vector<Entry> entries;
+    bool entryOpen {false};
+};
+
+class RecoverySnapshotRunnable: public QRunnable
+{
+public:
+    RecoverySnapshotRunnable(
+        RecoverySnapshot& snapshot,
+        const char* dir,
+        std::shared_ptr<std::atomic<bool>> writing
+    )
+        : entries(snapshot.takeEntries())
+        , modes(snapshot.getModes())
+        , fileVersion(snapshot.getFileVersion())
+        , writing(std::move(writing))
+    {
+        dirName = QString::fromUtf8(dir);
+        fileName = QStringLiteral("fc_recovery_file.fcstd");
+        tmpName = QStringLiteral("%1.tmp%2").arg(fileName).arg(rand());
+    }
+    void run() override
+    {
+        Base::TimeElapsed startTime;
+        try {
+            // open extra scope to close ZipWriter properly
+            {
+                QString fn = QStringLiteral("%1/%2").arg(dirName, tmpName);
+                Base::FileInfo tmp(fn.toUtf8().constData());
+                Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+                if (!file.is_open()) {
+                    throw Base::FileException("Failed to open file", tmp);
+                }
+
+                Base::ZipWriter writer(file);
+                writer.setModes(modes);
+                writer.setFileVersion(fileVersion);
+                writer.setComment("AutoRecovery file");
+                writer.setLevel(1);  // apparently the fastest compression
+                for (const auto& entry : entries) {
+                    writer.putNextEntry(entry.fileName.c_str());
+                    if (entry.prop) {
+                        entry.prop->SaveDocFile(writer);
+                    }
+                    else {
+                        writer.Stream() << entry.data;
+                    }
+                }
+            }
+
+            QMetaObject::invokeMethod(
+                AutoSaver::instance(),
+                "renameFile",
+                Qt::QueuedConnection,
+                Q_ARG(QString, dirName),
+                Q_ARG(QString, fileName),
+                Q_ARG(QString, tmpName)
+            );
+
+            Base::Console().log(
+                "Write auto-recovery file in %fs\n",
+                Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed())
+            );
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().warning("Exception in auto-saving: %s\n", e.what());
+        }
+        catch (const std::exception& e) {
+            Base::Console().warning("C++ exception in auto-saving: %s\n", e.what());
+        }
+        catch (...) {
+            Base::Console().warning("Unknown exception in auto-saving\n");
+        }
+        *writing = false;
+    }
+
+private:
+    std::vector<RecoverySnapshot::Entry> entries;
+    std::set<std::string> modes;
+    int fileVersion;
+    std::shared_ptr<std::atomic<bool>> writing;
+    QString dirName;
+    QString fileName;
+    QString tmpName;
+};
+
+}  // namespace Gui
+
+bool AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
+{
+    // the last recovery file is still being written
+    if (*saver.writing) {
+        return false;
+    }
+
     Gui::WaitCursor wc;
     App::Document* doc = App::GetApplication().getDocument(name.c_str());
     if (doc && !doc->testStatus(App::Document::PartialDoc)
         && !doc->testStatus(App::Document::TempDoc)) {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document"
+        );
+
+        // skip documents that exceed the size budget (in MB), 0 means there is no limit
+        long sizeLimit = hGrp->GetInt("AutoSaveSizeLimit", 0);
+        if (sizeLimit > 0 && doc->getMemSize() / (1024 * 1024) > std::size_t(sizeLimit)) {
+            Base::Console().log(
+                "Skip auto-recovery file of document '%s' exceeding the size limit\n",
+                name.c_str()
+            );
+            return false;
+        }
+
         // Set the document's current transient directory
         std::string dirName = doc->TransientDir.getValue();
         dirName += "/fc_recovery_files";
@@ -170,9 +364,6 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
 
         // make sure to tmp. disable saving thumbnails because this causes trouble if the
         // associated 3d view is not active
-        Base::Reference<ParameterGrp> hGrp = App::GetApplication().GetParameterGroupByPath(
-            "User parameter:BaseApp/Preferences/Document"
-        );
         bool save = hGrp->GetBool("SaveThumbnail", true);
         hGrp->SetBool("SaveThumbnail", false);
 
@@ -202,37 +393,37 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
             }
             // only create the file if something has changed
             else if (!saver.touched.empty()) {
-                std::string fn = doc->TransientDir.getValue();
-                fn += "/fc_recovery_file.fcstd";
-                Base::FileInfo tmp(fn);
-                Base::ofstream file(tmp, std::ios::out | std::ios::binary);
-                if (file.is_open()) {
-                    Base::ZipWriter writer(file);
-                    if (hGrp->GetBool("SaveBinaryBrep", true)) {
-                        writer.setMode("BinaryBrep");
-                    }
+                RecoverySnapshot snapshot;
 
-                    writer.setComment("AutoRecovery file");
-                    writer.setLevel(1);  // apparently the fastest compression
-                    writer.putNextEntry("Document.xml");
+                // The file is written in a worker thread, so always force binary format because
+                // ASCII is not reentrant. See PropertyPartShape::SaveDocFile
+                snapshot.setMode("BinaryBrep");
 
-                    doc->Save(writer);
+                snapshot.putNextEntry("Document.xml");
 
-                    // Special handling for Gui document.
-                    doc->signalSaveDocument(writer);
+                doc->Save(snapshot);
 
-                    // write additional files
-                    writer.writeFiles();
-                }
+                // Special handling for Gui document.
+                doc->signalSaveDocument(snapshot);
+
+                // take copies of the additional files
+                snapshot.writeFiles();
+
+                *saver.writing = true;
+                QThreadPool::globalInstance()->start(
+                    new RecoverySnapshotRunnable(snapshot, doc->TransientDir.getValue(), saver.writing)
+                );
             }
         }
 
         Base::Console().log(
-            "Save auto-recovery file in %fs\n",
+            "Take auto-recovery snapshot in %fs\n",
             Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed())
         );
         hGrp->SetBool("SaveThumbnail", save);
     }
+
+    return true;
 }
 
 void AutoSaver::timerEvent(QTimerEvent* event)
@@ -241,8 +432,9 @@ void AutoSaver::timerEvent(QTimerEvent* event)
     for (auto& it : saverMap) {
         if (it.second->timerId == id) {
             try {
-                saveDocument(it.first, *it.second);
-                it.second->touched.clear();
+                if (saveDocument(it.first, *it.second)) {
+                    it.second->touched.clear();
+                }
                 break;
             }
             catch (...) {
@@ -256,6 +448,7 @@ void AutoSaver::timerEvent(QTimerEvent* event)
 
 AutoSaveProperty::AutoSaveProperty(const App::Document* doc)
     : timerId(-1)
+    , writing(std::make_shared<std::atomic<bool>>(false))
 {
     // NOLINTBEGIN
     documentNew = const_cast<App::Document*>(doc)->signalNewObject.connect(
@@ -25,7 +25,9 @@
 
 #include <QObject>
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <fastsignals/signal.h>
@@ -51,6 +53,8 @@ public:
     std::set<std::string> touched;
     std::string dirName;
     std::map<std::string, std::string> fileMap;
+    /// set while a recovery file is written in the background
+    std::shared_ptr<std::atomic<bool>> writing;
 
 private:
     void slotNewObject(const App::DocumentObject&);
@@ -88,7 +92,7 @@ protected:
     void slotCreateDocument(const App::Document& Doc);
     void slotDeleteDocument(const App::Document& Doc);
     void timerEvent(QTimerEvent* event) override;
-    void saveDocument(const std::string&, AutoSaveProperty&);
+    bool saveDocument(const std::string&, AutoSaveProperty&);
 
 public Q_SLOTS:
     void renameFile(QString dirName, QString file, QString tmpFile);
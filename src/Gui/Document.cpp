@@ -545,6 +545,10 @@ Document::Document(App::Document* pcDocument, Application* app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize", 20));
+        // set the memory limit in MB, 0 means unlimited
+        d->_pcDocument->setUndoLimit(
+            static_cast<std::size_t>(hGrp->GetUnsigned("MaxUndoMemory", 0)) * 1024 * 1024
+        );
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
@@ -34,6 +34,26 @@ namespace sp = std::placeholders;
 
 std::vector<DocumentObserverPython*> DocumentObserverPython::_instances;
 
+namespace
+{
+void readNames(const Py::Object& obj, const char* attr, std::set<std::string, std::less<>>& names)
+{
+    if (!obj.hasAttr(attr)) {
+        return;
+    }
+    try {
+        Py::Sequence seq(obj.getAttr(attr));
+        for (const auto& item : seq) {
+            names.insert(Py::String(item).as_std_string("utf-8"));
+        }
+    }
+    catch (Py::Exception&) {
+        Base::PyException e;  // extract the Python error text
+        e.reportException();
+    }
+}
+}  // namespace
+
 void DocumentObserverPython::addObserver(const Py::Object& obj)
 {
     _instances.push_back(new DocumentObserverPython(obj));
@@ -89,6 +109,26 @@ DocumentObserverPython::DocumentObserverPython(const Py::Object& obj)
     FC_PY_ELEMENT_ARG1(InEdit, InEdit)
     FC_PY_ELEMENT_ARG1(ResetEdit, ResetEdit)
     // NOLINTEND
+
+    readNames(obj, "observedObjects", observedObjects);
+    readNames(obj, "observedProperties", observedProperties);
+}
+
+bool DocumentObserverPython::isObserved(const Gui::ViewProvider& Obj, const char* propName) const
+{
+    if (!propName) {
+        return false;
+    }
+    if (!observedProperties.empty() && !observedProperties.contains(propName)) {
+        return false;
+    }
+    if (!observedObjects.empty()) {
+        auto vp = dynamic_cast<const ViewProviderDocumentObject*>(&Obj);
+        auto obj = vp ? vp->getObject() : nullptr;
+        const char* objName = obj ? obj->getNameInDocument() : nullptr;
+        return objName && observedObjects.contains(objName);
+    }
+    return true;
 }
 
 DocumentObserverPython::~DocumentObserverPython() = default;
@@ -196,6 +236,9 @@ void DocumentObserverPython::slotBeforeChangeObject(
     const App::Property& Prop
 )
 {
+    if (!isObserved(Obj, Obj.getPropertyName(&Prop))) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
@@ -216,6 +259,9 @@ void DocumentObserverPython::slotBeforeChangeObject(
 
 void DocumentObserverPython::slotChangedObject(const Gui::ViewProvider& Obj, const App::Property& Prop)
 {
+    if (!isObserved(Obj, Obj.getPropertyName(&Prop))) {
+        return;
+    }
     Base::PyGILStateLocker lock;
     try {
         Py::Tuple args(2);
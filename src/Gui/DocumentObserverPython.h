@@ -26,6 +26,7 @@
 #include <FCGlobal.h>
 #include <fastsignals/signal.h>
 #include <CXX/Objects.hxx>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -46,6 +47,9 @@ class ViewProviderDocumentObject;
  * whenever something happens to a document, like creation, destruction, adding or
  * removing viewproviders or when viewprovider property changes. This is the equivalent to the app
  * python document observer
+ *
+ * As there, property changes can be restricted with the optional attributes observedObjects and
+ * observedProperties, lists of object and view provider property names.
  */
 class GuiExport DocumentObserverPython
 {
@@ -82,6 +86,9 @@ private:
     /** The has left edit mode */
     void slotResetEdit(const Gui::ViewProviderDocumentObject& Obj);
 
+    /// Returns false if the property change is filtered out by observedObjects/Properties
+    bool isObserved(const Gui::ViewProvider& Obj, const char* propName) const;
+
 private:
     Py::Object inst;
     static std::vector<DocumentObserverPython*> _instances;
@@ -107,6 +114,9 @@ private:
     Connection pyChangedObject;
     Connection pyInEdit;
     Connection pyResetEdit;
+
+    std::set<std::string, std::less<>> observedObjects;
+    std::set<std::string, std::less<>> observedProperties;
 };
 
 }  // namespace Gui
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+#include <Inventor/actions/SoCallbackAction.h>
+#include <Inventor/actions/SoGetPrimitiveCountAction.h>
+#include <Inventor/elements/SoGLCacheContextElement.h>
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/nodes/SoShape.h>
+
+#include <App/DocumentObject.h>
+
+#include "FrameStatistics.h"
+#include "ViewProvider.h"
+#include "ViewProviderDocumentObject.h"
+
+#ifndef GL_TIME_ELAPSED
+# define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+# define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+# define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+using namespace Gui;
+
+FrameStatistics::FrameStatistics() = default;
+
+FrameStatistics::~FrameStatistics()
+{
+    if (query) {
+        SoGLCacheContextElement::scheduleDeleteCallback(
+            queryContext,
+            deleteQuery,
+            reinterpret_cast<void*>(static_cast<std::uintptr_t>(query))  // NOLINT
+        );
+    }
+}
+
+void FrameStatistics::deleteQuery(void* closure, uint32_t contextid)
+{
+    auto id = static_cast<GLuint>(reinterpret_cast<std::uintptr_t>(closure));  // NOLINT
+    cc_glglue_glDeleteQueries(cc_glglue_instance(static_cast<int>(contextid)), 1, &id);
+}
+
+void FrameStatistics::beginFrame(uint32_t context)
+{
+    traversalStart = Clock::now();
+
+    if (query && context != queryContext) {
+        // the viewer got a new GL context, the old query is freed with the old context
+        SoGLCacheContextElement::scheduleDeleteCallback(
+            queryContext,
+            deleteQuery,
+            reinterpret_cast<void*>(static_cast<std::uintptr_t>(query))  // NOLINT
+        );
+        query = 0;
+        queryPending = false;
+    }
+
+    if (!query) {
+        glue = cc_glglue_instance(static_cast<int>(context));
+        if (!glue || !cc_glglue_has_occlusion_query(glue)
+            || !cc_glglue_glext_supported(glue, "GL_ARB_timer_query")) {
+            return;
+        }
+        cc_glglue_glGenQueries(glue, 1, &query);
+        queryContext = context;
+    }
+
+    // only start a new measurement once the last one has been read
+    if (queryPending) {
+        GLuint available = 0;
+        cc_glglue_glGetQueryObjectuiv(glue, query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return;
+        }
+        GLuint nanoseconds = 0;
+        cc_glglue_glGetQueryObjectuiv(glue, query, GL_QUERY_RESULT, &nanoseconds);
+        current.gpuTime = double(nanoseconds) / 1.0e6;
+        queryPending = false;
+    }
+
+    cc_glglue_glBeginQuery(glue, GL_TIME_ELAPSED, query);
+    queryActive = true;
+}
+
+void FrameStatistics::endTraversal()
+{
+    std::chrono::duration<double, std::milli> elapsed = Clock::now() - traversalStart;
+    current.cpuTime = elapsed.count();
+}
+
+void FrameStatistics::endFrame()
+{
+    if (queryActive) {
+        cc_glglue_glEndQuery(glue, GL_TIME_ELAPSED);
+        queryActive = false;
+        queryPending = true;
+    }
+}
+
+void FrameStatistics::countPrimitives(
+    SoNode* scene,
+    const std::set<ViewProvider*>& providers,
+    const SbViewportRegion& viewport
+)
+{
+    auto now = Clock::now();
+    if (counted && now - lastCount < std::chrono::seconds(1)) {
+        return;
+    }
+    counted = true;
+    lastCount = now;
+
+    std::vector<Provider> counts;
+    counts.reserve(providers.size());
+    SoGetPrimitiveCountAction primitiveAction(viewport);
+    SoCallbackAction shapeAction(viewport);
+    std::size_t shapes = 0;
+    shapeAction.addPreCallback(
+        SoShape::getClassTypeId(),
+        [](void* data, SoCallbackAction*, const SoNode*) {
+            ++*static_cast<std::size_t*>(data);
+            return SoCallbackAction::CONTINUE;
+        },
+        &shapes
+    );
+
+    for (auto vp : providers) {
+        if (!vp->isShow() || !vp->getRoot()) {
+            continue;
+        }
+
+        Provider info;
+        if (auto vpd = freecad_cast<ViewProviderDocumentObject*>(vp)) {
+            App::DocumentObject* obj = vpd->getObject();
+            info.name = obj ? obj->getFullName() : vp->getTypeId().getName();
+        }
+        else {
+            info.name = vp->getTypeId().getName();
+        }
+
+        primitiveAction.apply(vp->getRoot());
+        info.triangles = primitiveAction.getTriangleCount();
+        info.lines = primitiveAction.getLineCount();
+        info.points = primitiveAction.getPointCount();
+        shapes = 0;
+        shapeAction.apply(vp->getRoot());
+        info.shapes = shapes;
+        counts.push_back(std::move(info));
+    }
+
+    // the nodes of view providers may be shared or nested, so the totals are taken from the
+    // whole scene
+    primitiveAction.apply(scene);
+    shapes = 0;
+    shapeAction.apply(scene);
+
+    auto cost = [](const Provider& info) {
+        return info.triangles + info.lines + info.points;
+    };
+    std::size_t count = std::min(numProviders, counts.size());
+    std::partial_sort(
+        counts.begin(),
+        counts.begin() + static_cast<std::ptrdiff_t>(count),
+        counts.end(),
+        [&cost](const Provider& a, const Provider& b) { return cost(a) > cost(b); }
+    );
+    counts.resize(count);
+
+    current.triangles = primitiveAction.getTriangleCount();
+    current.lines = primitiveAction.getLineCount();
+    current.points = primitiveAction.getPointCount();
+    current.shapes = shapes;
+    current.providers = std::move(counts);
+}
+
+std::string FrameStatistics::toString() const
+{
+    std::stringstream stream;
+    stream.precision(2);
+    stream.setf(std::ios::fixed | std::ios::showpoint);
+    stream << "CPU: " << current.cpuTime << " ms";
+    if (current.gpuTime >= 0.0) {
+        stream << "  GPU: " << current.gpuTime << " ms";
+    }
+    else {
+        stream << "  GPU: n/a";
+    }
+    stream << "\nTriangles: " << current.triangles << "  Lines: " << current.lines
+           << "  Points: " << current.points << "  Shapes: " << current.shapes;
+    for (const auto& it : current.providers) {
+        stream << "\n  " << it.name << ": " << it.triangles << " triangles, " << it.shapes
+               << " shapes";
+    }
+    return stream.str();
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <Inventor/C/glue/gl.h>
+#include <FCGlobal.h>
+
+class SbViewportRegion;
+class SoNode;
+
+namespace Gui
+{
+class ViewProvider;
+
+/**
+ * Collects where the time of the frames rendered by a viewer goes. It measures the time of the
+ * scene traversal on the CPU and, if the driver supports timer queries, the time the GPU needs
+ * to draw the frame. The GPU time is read one frame later to avoid waiting for the GPU, so it
+ * lags behind by a frame.
+ *
+ * The number of primitives and shapes is counted per view provider, which needs an extra
+ * traversal of the scene. To keep the overhead low it is refreshed once a second only.
+ */
+class GuiExport FrameStatistics
+{
+public:
+    /// The primitives drawn by a view provider
+    struct Provider
+    {
+        std::string name;
+        std::size_t triangles = 0;
+        std::size_t lines = 0;
+        std::size_t points = 0;
+        /// The number of shape nodes, each one needs at least one draw call
+        std::size_t shapes = 0;
+    };
+
+    struct Frame
+    {
+        /// Time of the scene traversal in ms
+        double cpuTime = 0.0;
+        /// Time of the GPU in ms, negative if not available
+        double gpuTime = -1.0;
+        std::size_t triangles = 0;
+        std::size_t lines = 0;
+        std::size_t points = 0;
+        std::size_t shapes = 0;
+        /// The view providers with the most primitives, most expensive first
+        std::vector<Provider> providers;
+    };
+
+    /// The number of view providers listed in Frame::providers
+    static constexpr std::size_t numProviders = 5;
+
+    FrameStatistics();
+    ~FrameStatistics();
+
+    /// Must be called with the GL context \a context being current
+    void beginFrame(uint32_t context);
+    void endTraversal();
+    void endFrame();
+    /** Counts the primitives of the \a scene and of each of the \a providers if the last count
+     * is older than a second.
+     */
+    void countPrimitives(
+        SoNode* scene,
+        const std::set<ViewProvider*>& providers,
+        const SbViewportRegion& viewport
+    );
+
+    const Frame& frame() const
+    {
+        return current;
+    }
+    /// Returns the statistics as text for the overlay
+    std::string toString() const;
+
+    FrameStatistics(const FrameStatistics&) = delete;
+    FrameStatistics(FrameStatistics&&) = delete;
+    FrameStatistics& operator=(const FrameStatistics&) = delete;
+    FrameStatistics& operator=(FrameStatistics&&) = delete;
+
+private:
+    static void deleteQuery(void* closure, uint32_t contextid);
+
+    using Clock = std::chrono::steady_clock;
+    Frame current;
+    Clock::time_point traversalStart;
+    Clock::time_point lastCount;
+    bool counted = false;
+
+    const cc_glglue* glue = nullptr;
+    uint32_t queryContext = 0;
+    GLuint query = 0;
+    bool queryActive = false;
+    bool queryPending = false;
+};
+
+}  // namespace Gui
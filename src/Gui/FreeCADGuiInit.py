@@ -62,6 +62,8 @@ if typing.TYPE_CHECKING:
     Log: typing.Callable = None
     Err: typing.Callable = None
     ModState: typing.Any = None
+    InitScriptCache: typing.Any = None
+    StartupTimer: typing.Any = None
 
 
 # The values must match with that of the C++ enum class ResolveMode
@@ -269,12 +271,14 @@ class ModGui:
         """
         Load the Mod Gui.
         """
+        start = StartupTimer.now()
         try:
             if self.mod.state == ModState.Loaded and not self.process_metadata():
                 self.run_init_gui()
         except Exception as ex:
             self.mod.state = ModState.Failed
             Err(str(ex))
+        StartupTimer.add("InitGui", self.mod.name, start)
 
 
 class DirModGui(ModGui):
@@ -292,8 +296,7 @@ class DirModGui(ModGui):
         init_gui_py = target / self.INIT_GUI_PY
         if init_gui_py.exists():
             try:
-                source = init_gui_py.read_text(encoding="utf-8")
-                code = compile(source, init_gui_py, "exec")
+                code = InitScriptCache.load(init_gui_py)
                 exec(code)
             except Exception as ex:
                 sep = "-" * 100 + "\n"
@@ -420,6 +423,8 @@ def InitApplications():
         Log(line)
     Log(output[0])
 
+    StartupTimer.report("InitGui")
+
 
 def GeneratePackageIcon(
     subdirectory: str, workbench_metadata: FreeCAD.Metadata, wb_handle: Workbench
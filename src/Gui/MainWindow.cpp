@@ -102,6 +102,7 @@
 #include "ProgressBar.h"
 #include "PropertyView.h"
 #include "PythonConsole.h"
+#include "MemoryView.h"
 #include "ReportView.h"
 #include "SelectionView.h"
 #include "SplashScreen.h"
@@ -587,6 +588,7 @@ void MainWindow::setupDockWindows()
     setupReportView();
     setupPythonConsole();
     setupSelectionView();
+    setupMemoryView();
     setupTaskView();
 
     initDockWindows(false);
@@ -642,6 +644,23 @@ bool MainWindow::setupSelectionView()
     return false;
 }
 
+bool MainWindow::setupMemoryView()
+{
+    // Memory view
+    if (d->hiddenDockWindows.find("Std_MemoryView") == std::string::npos) {
+        auto pcMemoryView = new MemoryView(nullptr, this);
+        pcMemoryView->setObjectName(QStringLiteral("Memory view"));
+        pcMemoryView->setWindowTitle(QDockWidget::tr("Memory"));
+        pcMemoryView->setMinimumWidth(210);
+
+        DockWindowManager* pDockMgr = DockWindowManager::instance();
+        pDockMgr->registerDockWindow("Std_MemoryView", pcMemoryView);
+        return true;
+    }
+
+    return false;
+}
+
 bool MainWindow::setupReportView()
 {
     // Report view
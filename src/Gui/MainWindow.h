@@ -316,6 +316,7 @@ private:
     void setupDockWindows();
     bool setupTaskView();
     bool setupSelectionView();
+    bool setupMemoryView();
     bool setupReportView();
     bool setupPythonConsole();
     bool updateTreeView(bool show);
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <vector>
+
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLocale>
+#include <QToolButton>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/StringHasher.h>
+
+#include "MemoryView.h"
+#include "Application.h"
+#include "BitmapFactory.h"
+#include "Document.h"
+#include "Selection/Selection.h"
+#include "ViewProvider.h"
+#include "WaitCursor.h"
+
+
+using namespace Gui;
+using namespace Gui::DockWnd;
+
+namespace
+{
+
+enum Column
+{
+    NameColumn,
+    DataColumn,
+    ViewColumn,
+    TotalColumn
+};
+
+// Number of objects highlighted as the largest consumers
+constexpr std::size_t numHighlighted = 10;
+
+// Item that shows sizes in a human readable form but sorts them by value
+class SizeItem: public QTreeWidgetItem
+{
+public:
+    using QTreeWidgetItem::QTreeWidgetItem;
+
+    void setSize(int column, std::size_t size)
+    {
+        setData(column, Qt::UserRole, QVariant::fromValue<qulonglong>(size));
+        setText(column, QLocale().formattedDataSize(static_cast<qint64>(size)));
+        setTextAlignment(column, Qt::AlignRight | Qt::AlignVCenter);
+    }
+
+    std::size_t size(int column) const
+    {
+        return data(column, Qt::UserRole).toULongLong();
+    }
+
+    void setSizes(std::size_t data, std::size_t view)
+    {
+        setSize(DataColumn, data);
+        setSize(ViewColumn, view);
+        setSize(TotalColumn, data + view);
+    }
+
+    bool operator<(const QTreeWidgetItem& other) const override
+    {
+        int column = treeWidget() ? treeWidget()->sortColumn() : int(TotalColumn);
+        if (column == NameColumn) {
+            return QTreeWidgetItem::operator<(other);
+        }
+        return size(column) < static_cast<const SizeItem&>(other).size(column);
+    }
+};
+
+}  // namespace
+
+/* TRANSLATOR Gui::DockWnd::MemoryView */
+
+MemoryView::MemoryView(Gui::Document* pcDocument, QWidget* parent)
+    : DockWindow(pcDocument, parent)
+{
+    setWindowTitle(tr("Memory"));
+
+    auto vLayout = new QVBoxLayout(this);
+    vLayout->setSpacing(0);
+    vLayout->setContentsMargins(0, 0, 0, 0);
+
+    auto hLayout = new QHBoxLayout();
+    hLayout->setSpacing(2);
+    totalLabel = new QLabel(this);
+    auto refreshButton = new QToolButton(this);
+    refreshButton->setIcon(BitmapFactory().iconFromTheme("view-refresh"));
+    refreshButton->setToolTip(tr("Recomputes the memory estimates"));
+    refreshButton->setAutoRaise(true);
+    hLayout->addWidget(totalLabel, 1);
+    hLayout->addWidget(refreshButton, 0, Qt::AlignRight);
+    vLayout->addLayout(hLayout);
+
+    tree = new QTreeWidget(this);
+    tree->setColumnCount(4);
+    tree->setHeaderLabels({tr("Name"), tr("Data"), tr("View"), tr("Total")});
+    tree->header()->setSectionResizeMode(NameColumn, QHeaderView::Stretch);
+    tree->header()->setStretchLastSection(false);
+    tree->setSortingEnabled(true);
+    tree->sortByColumn(TotalColumn, Qt::DescendingOrder);
+    vLayout->addWidget(tree);
+
+    connect(refreshButton, &QToolButton::clicked, this, &MemoryView::refresh);
+    connect(tree, &QTreeWidget::itemDoubleClicked, [](QTreeWidgetItem* item) {
+        QStringList names = item->data(NameColumn, Qt::UserRole).toStringList();
+        if (names.size() == 2) {
+            Selection().clearSelection();
+            Selection().addSelection(names[0].toUtf8().constData(), names[1].toUtf8().constData());
+        }
+    });
+}
+
+MemoryView::~MemoryView() = default;
+
+void MemoryView::showEvent(QShowEvent* ev)
+{
+    DockWindow::showEvent(ev);
+    refresh();
+}
+
+void MemoryView::refresh()
+{
+    WaitCursor wc;
+    tree->setSortingEnabled(false);
+    tree->clear();
+
+    std::vector<SizeItem*> objectItems;
+    std::size_t total = 0;
+    for (auto doc : App::GetApplication().getDocuments()) {
+        auto docItem = new SizeItem(tree);
+        docItem->setText(NameColumn, QString::fromUtf8(doc->Label.getValue()));
+        docItem->setIcon(NameColumn, BitmapFactory().iconFromTheme("Document"));
+        Gui::Document* guiDoc = Application::Instance->getDocument(doc);
+
+        std::size_t docData = doc->App::PropertyContainer::getMemSize();
+        std::size_t docView = 0;
+
+        auto addItem = [&](const QString& name, std::size_t data) {
+            auto item = new SizeItem(docItem);
+            item->setText(NameColumn, name);
+            item->setSizes(data, 0);
+            docData += data;
+        };
+        addItem(tr("Undo/Redo"), doc->getUndoMemSize());
+        if (auto hasher = doc->getStringHasher()) {
+            addItem(tr("String table"), hasher->getMemSize());
+        }
+
+        for (auto obj : doc->getObjects()) {
+            auto item = new SizeItem(docItem);
+            item->setText(NameColumn, QString::fromUtf8(obj->Label.getValue()));
+            item->setToolTip(NameColumn, QString::fromUtf8(obj->getFullName().c_str()));
+            item->setData(
+                NameColumn,
+                Qt::UserRole,
+                QStringList {QString::fromLatin1(doc->getName()),
+                             QString::fromLatin1(obj->getNameInDocument())}
+            );
+            std::size_t data = obj->getMemSize();
+            std::size_t view = 0;
+            if (auto vp = guiDoc ? guiDoc->getViewProvider(obj) : nullptr) {
+                item->setIcon(NameColumn, vp->getIcon());
+                view = vp->getMemSize();
+            }
+            item->setSizes(data, view);
+            docData += data;
+            docView += view;
+            objectItems.push_back(item);
+        }
+
+        docItem->setSizes(docData, docView);
+        docItem->setExpanded(true);
+        total += docData + docView;
+    }
+
+    std::size_t count = std::min(numHighlighted, objectItems.size());
+    std::partial_sort(
+        objectItems.begin(),
+        objectItems.begin() + count,
+        objectItems.end(),
+        [](SizeItem* a, SizeItem* b) { return a->size(TotalColumn) > b->size(TotalColumn); }
+    );
+    for (std::size_t i = 0; i < count && objectItems[i]->size(TotalColumn) > 0; ++i) {
+        QFont font = objectItems[i]->font(NameColumn);
+        font.setBold(true);
+        for (int column = NameColumn; column <= TotalColumn; ++column) {
+            objectItems[i]->setFont(column, font);
+        }
+    }
+
+    QString totalSize = QLocale().formattedDataSize(static_cast<qint64>(total));
+    totalLabel->setText(tr("Total: %1").arg(totalSize));
+    tree->setSortingEnabled(true);
+    for (int column = DataColumn; column <= TotalColumn; ++column) {
+        tree->resizeColumnToContents(column);
+    }
+}
+
+#include "moc_MemoryView.cpp"
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include "DockWindow.h"
+
+class QLabel;
+class QTreeWidget;
+
+namespace Gui
+{
+namespace DockWnd
+{
+
+/** Lists the estimated memory of the open documents, split into the objects with their view
+ * providers, the undo/redo stack and the string table. The largest objects are highlighted.
+ * The sizes are computed when the panel is shown or refreshed, not continuously, because the
+ * estimation walks all shapes and scene graphs.
+ */
+class MemoryView: public Gui::DockWindow
+{
+    Q_OBJECT
+
+public:
+    explicit MemoryView(Gui::Document* pcDocument, QWidget* parent = nullptr);
+    ~MemoryView() override;
+
+    const char* getName() const override
+    {
+        return "MemoryView";
+    }
+
+public Q_SLOTS:
+    void refresh();
+
+protected:
+    void showEvent(QShowEvent*) override;
+
+private:
+    QTreeWidget* tree;
+    QLabel* totalLabel;
+};
+
+}  // namespace DockWnd
+}  // namespace Gui
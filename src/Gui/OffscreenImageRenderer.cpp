@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#include <functional>
+
+#include <Inventor/SbViewportRegion.h>
+#include <Inventor/nodes/SoDirectionalLight.h>
+#include <Inventor/nodes/SoOrthographicCamera.h>
+#include <Inventor/nodes/SoSeparator.h>
+#include <Inventor/nodes/SoTransform.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/GeoFeatureGroupExtension.h>
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "OffscreenImageRenderer.h"
+#include "Application.h"
+#include "Camera.h"
+#include "Document.h"
+#include "SoFCOffscreenRenderer.h"
+#include "ViewProviderDocumentObject.h"
+#include "ViewProviderDragger.h"
+
+FC_LOG_LEVEL_INIT("Gui", true, true)
+
+using namespace Gui;
+namespace sp = std::placeholders;
+
+OffscreenImageRenderer::OffscreenImageRenderer()
+    : orientation(Camera::rotation(Camera::Isometric))
+{
+    // NOLINTBEGIN
+    connectChangedObject = App::GetApplication().signalChangedObject.connect(
+        std::bind(&OffscreenImageRenderer::slotChangedObject, this, sp::_1, sp::_2)
+    );
+    connectDeletedObject = App::GetApplication().signalDeletedObject.connect(
+        std::bind(&OffscreenImageRenderer::slotDeletedObject, this, sp::_1)
+    );
+    connectDeleteDocument = App::GetApplication().signalDeleteDocument.connect(
+        std::bind(&OffscreenImageRenderer::slotDeleteDocument, this, sp::_1)
+    );
+    // NOLINTEND
+}
+
+OffscreenImageRenderer::~OffscreenImageRenderer()
+{
+    clear();
+}
+
+void OffscreenImageRenderer::setSize(int width, int height)
+{
+    this->width = width;
+    this->height = height;
+}
+
+void OffscreenImageRenderer::setBackgroundColor(const SbColor& color)
+{
+    background = color;
+}
+
+void OffscreenImageRenderer::setOrientation(const SbRotation& rot)
+{
+    orientation = rot;
+}
+
+void OffscreenImageRenderer::setNumSamples(int samples)
+{
+    numSamples = samples;
+}
+
+void OffscreenImageRenderer::clear()
+{
+    for (const auto& it : viewProviders) {
+        delete it.second;
+    }
+    viewProviders.clear();
+}
+
+ViewProviderDocumentObject* OffscreenImageRenderer::getViewProvider(App::DocumentObject* obj)
+{
+    Gui::Document* guiDoc = nullptr;
+    if (Application::Instance) {
+        guiDoc = Application::Instance->getDocument(obj->getDocument());
+    }
+    if (guiDoc) {
+        return freecad_cast<ViewProviderDocumentObject*>(guiDoc->getViewProvider(obj));
+    }
+
+    auto it = viewProviders.find(obj);
+    if (it != viewProviders.end()) {
+        return it->second;
+    }
+
+    // Without a GUI document create the view provider the same way Gui::Document does
+    ViewProviderDocumentObject* vp = nullptr;
+    std::string name = obj->getViewProviderNameStored();
+    while (!name.empty()) {
+        Base::Type type = Base::Type::getTypeIfDerivedFrom(
+            name.c_str(),
+            ViewProviderDocumentObject::getClassTypeId(),
+            true
+        );
+        vp = static_cast<ViewProviderDocumentObject*>(type.createInstance());
+        if (!vp) {
+            FC_ERR("Invalid view provider type '" << name << "' for " << obj->getFullName());
+            break;
+        }
+        if (name == obj->getViewProviderName() || vp->allowOverride(*obj)) {
+            break;
+        }
+        delete vp;
+        vp = nullptr;
+        name = obj->getViewProviderName();
+    }
+
+    if (vp) {
+        try {
+            vp->attach(obj);
+            vp->updateView();
+            vp->setActiveMode();
+            vp->show();
+        }
+        catch (Base::Exception& e) {
+            e.reportException();
+        }
+    }
+
+    viewProviders[obj] = vp;
+    return vp;
+}
+
+void OffscreenImageRenderer::slotChangedObject(
+    const App::DocumentObject& obj,
+    const App::Property& prop
+)
+{
+    auto it = viewProviders.find(&obj);
+    if (it != viewProviders.end() && it->second) {
+        it->second->update(&prop);
+    }
+}
+
+void OffscreenImageRenderer::slotDeletedObject(const App::DocumentObject& obj)
+{
+    auto it = viewProviders.find(&obj);
+    if (it != viewProviders.end()) {
+        delete it->second;
+        viewProviders.erase(it);
+    }
+}
+
+void OffscreenImageRenderer::slotDeleteDocument(const App::Document& doc)
+{
+    for (auto it = viewProviders.begin(); it != viewProviders.end();) {
+        if (it->first->getDocument() == &doc) {
+            delete it->second;
+            it = viewProviders.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+QImage OffscreenImageRenderer::render(App::Document* doc)
+{
+    // A GUI document adds the children of a group to the scene of the group, otherwise the
+    // objects of a group are rendered one by one and the groups themselves are skipped
+    bool hasGuiDocument = Application::Instance && Application::Instance->getDocument(doc);
+
+    std::vector<App::DocumentObject*> objs;
+    for (auto obj : doc->getObjects()) {
+        if (!obj->Visibility.getValue()) {
+            continue;
+        }
+        bool isGroup = obj->hasExtension(App::GeoFeatureGroupExtension::getExtensionClassTypeId());
+        bool inGroup = App::GeoFeatureGroupExtension::getGroupOfObject(obj) != nullptr;
+        if (hasGuiDocument ? !inGroup : !isGroup) {
+            objs.push_back(obj);
+        }
+    }
+
+    return render(objs);
+}
+
+QImage OffscreenImageRenderer::render(const std::vector<App::DocumentObject*>& objs)
+{
+    auto root = new SoSeparator();
+    root->ref();
+
+    auto camera = new SoOrthographicCamera();
+    camera->orientation.setValue(orientation);
+    root->addChild(camera);
+
+    auto light = new SoDirectionalLight();
+    SbVec3f direction;
+    orientation.multVec(SbVec3f(0.0F, 0.0F, -1.0F), direction);
+    light->direction.setValue(direction);
+    root->addChild(light);
+
+    for (auto obj : objs) {
+        auto vp = getViewProvider(obj);
+        if (!vp) {
+            continue;
+        }
+
+        // the scene of a view provider is relative to its group
+        auto sep = new SoSeparator();
+        if (auto group = App::GeoFeatureGroupExtension::getGroupOfObject(obj)) {
+            auto ext = group->getExtensionByType<App::GeoFeatureGroupExtension>();
+            auto transform = new SoTransform();
+            ViewProviderDragger::updateTransform(ext->globalGroupPlacement(), transform);
+            sep->addChild(transform);
+        }
+        sep->addChild(vp->getRoot());
+        root->addChild(sep);
+    }
+
+    SbViewportRegion viewport(static_cast<short>(width), static_cast<short>(height));
+    camera->viewAll(root, viewport);
+
+    if (!renderer) {
+        renderer = std::make_unique<SoQtOffscreenRenderer>(viewport);
+    }
+    renderer->setViewportRegion(viewport);
+    renderer->setNumPasses(numSamples);
+    renderer->setBackgroundColor(SbColor4f(background, 1.0F));
+
+    QImage image;
+    bool ok = renderer->render(root);
+    root->unref();
+    if (!ok) {
+        throw Base::RuntimeError("Failed to create an OpenGL context for offscreen rendering");
+    }
+
+    renderer->writeToImage(image);
+    return image;
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 51 Franklin Street,      *
+ *   Fifth Floor, Boston, MA  02110-1301, USA                              *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Inventor/SbColor.h>
+#include <Inventor/SbRotation.h>
+#include <QImage>
+#include <fastsignals/signal.h>
+#include <FCGlobal.h>
+
+namespace App
+{
+class Document;
+class DocumentObject;
+class Property;
+}  // namespace App
+
+namespace Gui
+{
+class SoQtOffscreenRenderer;
+class ViewProviderDocumentObject;
+
+/**
+ * Renders documents or objects into images without a 3D view. It works with a full GUI as well
+ * as with FreeCADGui.setupWithoutGUI() when a QGuiApplication exists, e.g. on the offscreen or
+ * eglfs platform plugins of Qt.
+ *
+ * Without GUI documents the view providers are created by the renderer itself. They are kept
+ * until their object or document is deleted, so rendering several views of an object builds its
+ * scene and tessellation only once. Likewise the GL context is reused for all images.
+ *
+ * The renderer must be used from the thread that owns the QGuiApplication.
+ */
+class GuiExport OffscreenImageRenderer
+{
+public:
+    OffscreenImageRenderer();
+    ~OffscreenImageRenderer();
+
+    void setSize(int width, int height);
+    void setBackgroundColor(const SbColor& color);
+    /// The orientation of the camera, the scene is fit into the view
+    void setOrientation(const SbRotation& rot);
+    void setNumSamples(int samples);
+
+    /// Renders the visible objects of \a doc
+    QImage render(App::Document* doc);
+    /// Renders \a objs regardless of their visibility
+    QImage render(const std::vector<App::DocumentObject*>& objs);
+
+    /// Releases the view providers created by the renderer
+    void clear();
+
+private:
+    ViewProviderDocumentObject* getViewProvider(App::DocumentObject* obj);
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+    void slotDeletedObject(const App::DocumentObject& obj);
+    void slotDeleteDocument(const App::Document& doc);
+
+    std::unique_ptr<SoQtOffscreenRenderer> renderer;
+    std::map<const App::DocumentObject*, ViewProviderDocumentObject*> viewProviders;
+    SbRotation orientation;
+    SbColor background {1.0F, 1.0F, 1.0F};
+    int width = 800;
+    int height = 600;
+    int numSamples = 4;
+
+    fastsignals::scoped_connection connectChangedObject;
+    fastsignals::scoped_connection connectDeletedObject;
+    fastsignals::scoped_connection connectDeleteDocument;
+};
+
+}  // namespace Gui
@@ -66,6 +66,7 @@ void DlgSettings3DViewImp::saveSettings()
     ui->CheckBox_ShowFPS->onSave();
     ui->CheckBox_use_SW_OpenGL->onSave();
     ui->CheckBox_useVBO->onSave();
+    ui->CheckBox_renderCulling->onSave();
     ui->FloatSpinBox_EyeDistance->onSave();
     ui->FloatSpinBox_DatumScale->onSave();
     ui->axisLetterColor->onSave();
@@ -84,6 +85,7 @@ void DlgSettings3DViewImp::loadSettings()
     ui->CheckBox_ShowFPS->onRestore();
     ui->CheckBox_use_SW_OpenGL->onRestore();
     ui->CheckBox_useVBO->onRestore();
+    ui->CheckBox_renderCulling->onRestore();
     ui->FloatSpinBox_EyeDistance->onRestore();
     ui->FloatSpinBox_DatumScale->onRestore();
     ui->axisLetterColor->onRestore();
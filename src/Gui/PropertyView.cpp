@@ -21,6 +21,8 @@
  ***************************************************************************/
 
 
+#include <map>
+
 #include <QEvent>
 #include <QGridLayout>
 #include <QTimer>
@@ -354,15 +356,21 @@ struct PropertyView::PropInfo
     std::vector<App::Property*> propList;
 };
 
-struct PropertyView::PropFind
+// Groups the properties by <name,id> in the order they are first added. The position of each
+// group is kept in a map, so that large selections don't need a linear search per property.
+struct PropertyView::PropIndex
 {
-    const PropInfo& item;
-    explicit PropFind(const PropInfo& item)
-        : item(item)
-    {}
-    bool operator()(const PropInfo& elem) const
+    std::vector<PropInfo> infos;
+    std::map<std::pair<std::string, int>, std::size_t> positions;
+
+    void add(const std::string& name, App::Property* prop)
     {
-        return (elem.propId == item.propId) && (elem.propName == item.propName);
+        int id = static_cast<int>(prop->getTypeId().getKey());
+        auto res = positions.emplace(std::make_pair(name, id), infos.size());
+        if (res.second) {
+            infos.push_back(PropInfo {name, id, {}});
+        }
+        infos[res.first->second].propList.push_back(prop);
     }
 };
 
@@ -420,8 +428,8 @@ void PropertyView::onTimer()
     std::set<App::DocumentObject*> objSet;
 
     // group the properties by <name,id>
-    std::vector<PropInfo> propDataMap;
-    std::vector<PropInfo> propViewMap;
+    PropIndex propDataIndex;
+    PropIndex propViewIndex;
     bool checkLink = true;
     ViewProviderDocumentObject* vpLast = nullptr;
     auto sels = Gui::Selection().getSelectionEx("*");
@@ -466,18 +474,7 @@ void PropertyView::onTimer()
                     continue;
                 }
 
-                PropInfo nameType;
-                nameType.propName = prop->getName();
-                nameType.propId = prop->getTypeId().getKey();
-
-                auto pi = std::find_if(propDataMap.begin(), propDataMap.end(), PropFind(nameType));
-                if (pi != propDataMap.end()) {
-                    pi->propList.push_back(prop);
-                }
-                else {
-                    nameType.propList.push_back(prop);
-                    propDataMap.push_back(nameType);
-                }
+                propDataIndex.add(prop->getName(), prop);
             }
         }
         // the same for the view properties
@@ -488,18 +485,7 @@ void PropertyView::onTimer()
                     continue;
                 }
 
-                PropInfo nameType;
-                nameType.propName = pt->first;
-                nameType.propId = pt->second->getTypeId().getKey();
-
-                auto pi = std::find_if(propViewMap.begin(), propViewMap.end(), PropFind(nameType));
-                if (pi != propViewMap.end()) {
-                    pi->propList.push_back(pt->second);
-                }
-                else {
-                    nameType.propList.push_back(pt->second);
-                    propViewMap.push_back(nameType);
-                }
+                propViewIndex.add(pt->first, pt->second);
             }
         }
     }
@@ -507,7 +493,9 @@ void PropertyView::onTimer()
     // the property must be part of each selected object, i.e. the number
     // of selected objects is equal to the number of properties with same
     // name and id
-    std::vector<PropInfo>::const_iterator it;
+    std::vector<PropInfo>::iterator it;
+    std::vector<PropInfo>& propDataMap = propDataIndex.infos;
+    std::vector<PropInfo>& propViewMap = propViewIndex.infos;
     PropertyModel::PropertyList dataProps;
     std::map<std::string, std::vector<App::Property*>> dataPropsMap;
     PropertyModel::PropertyList viewProps;
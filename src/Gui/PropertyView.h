@@ -97,7 +97,7 @@ private:
 
 private:
     struct PropInfo;
-    struct PropFind;
+    struct PropIndex;
     using Connection = fastsignals::connection;
     Connection connectPropData;
     Connection connectPropView;
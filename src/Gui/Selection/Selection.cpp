@@ -24,7 +24,9 @@
 
 
 #include <array>
+#include <limits>
 #include <set>
+#include <unordered_set>
 #include <boost/algorithm/string/predicate.hpp>
 #include <QApplication>
 
@@ -557,19 +559,27 @@ static void notifyDocumentObjectViewProvider(const SelectionChanges& changes)
 }
 
 void SelectionSingleton::notify(SelectionChanges&& Chng)
+{
+    notify(std::move(Chng), std::numeric_limits<std::size_t>::max());
+}
+
+void SelectionSingleton::notify(SelectionChanges&& Chng, std::size_t removals)
 {
     if (Notifying) {
-        NotificationQueue.push_back(std::move(Chng));
+        NotificationQueue.push_back({std::move(Chng), removals});
         return;
     }
     Base::FlagToggler<bool> flag(Notifying);
-    NotificationQueue.push_back(std::move(Chng));
+    NotificationQueue.push_back({std::move(Chng), removals});
     while (!NotificationQueue.empty()) {
-        const auto& msg = NotificationQueue.front();
+        const auto& msg = NotificationQueue.front().msg;
         bool notify = false;
         switch (msg.Type) {
             case SelectionChanges::AddSelection:
-                notify = isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
+                // An element that was just added is still selected if nothing was removed since.
+                // This saves searching the whole selection for each element of a big selection.
+                notify = NotificationQueue.front().removals == Removals
+                    || isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
                 break;
             case SelectionChanges::RmvSelection:
                 notify = !isSelected(msg.pDocName, msg.pObjectName, msg.pSubName, ResolveMode::NoResolve);
@@ -1253,6 +1263,7 @@ bool SelectionSingleton::addSelection(
 
     context.info->selList.push_back(temp);
     context.info->selStackForward.clear();
+    std::size_t removals = Removals;
 
     if (clearPreselect) {
         rmvPreselect();
@@ -1274,7 +1285,7 @@ bool SelectionSingleton::addSelection(
                          << x << ", " << y << ", " << z << ')'
     );
 
-    notify(std::move(Chng));
+    notify(std::move(Chng), removals);
 
     getMainWindow()->updateActions();
 
@@ -1282,7 +1293,8 @@ bool SelectionSingleton::addSelection(
 
     // There is a possibility that some observer removes or clears selection
     // inside signal handler, hence the check here
-    return isSelected(temp.DocName.c_str(), temp.FeatName.c_str(), temp.SubName.c_str());
+    return Removals == removals
+        || isSelected(temp.DocName.c_str(), temp.FeatName.c_str(), temp.SubName.c_str());
 }
 
 void SelectionSingleton::selStackPush(bool clearForward, bool overwrite, const char* pDocName)
@@ -1482,11 +1494,31 @@ bool SelectionSingleton::addSelections(
            << pObjectName << "'),[";
     }
 
+    // Look up the elements in a set instead of searching the selection for each of them, which
+    // gets quadratic for a big selection
+    auto selectionKey = [](const SelectionDescription& sel) {
+        return sel.FeatName + '.' + sel.SubName;
+    };
+    std::unordered_set<std::string> selected;
+    for (const auto& sel : context.info->selList) {
+        if (sel.DocName == context.docName) {
+            selected.insert(selectionKey(sel));
+        }
+    }
+    const std::list<SelectionDescription> unselected;
+
     bool update = false;
     for (const auto& pSubName : pSubNames) {
         SelectionDescription temp;
-        int ret = checkSelection(pDocName, pObjectName, pSubName.c_str(), ResolveMode::NoResolve, temp);
-        if (ret != 0) {
+        int ret = checkSelection(
+            pDocName,
+            pObjectName,
+            pSubName.c_str(),
+            ResolveMode::NoResolve,
+            temp,
+            &unselected
+        );
+        if (ret != 0 || !selected.insert(selectionKey(temp)).second) {
             continue;
         }
 
@@ -1517,7 +1549,7 @@ bool SelectionSingleton::addSelections(
 
         FC_LOG("Add Selection " << Chng.pDocName << '#' << Chng.pObjectName << '.' << Chng.pSubName);
 
-        notify(std::move(Chng));
+        notify(std::move(Chng), Removals);
         update = true;
     }
 
@@ -1689,6 +1721,7 @@ void SelectionSingleton::rmvSelection(
 
         // destroy the SelectionDescription item
         context.info->selList.erase(It);
+        ++Removals;
     }
 
     // NOTE: It can happen that there are nested calls of rmvSelection()
@@ -1904,6 +1937,7 @@ void SelectionSingleton::clearSelection(const char* pDocName, bool clearPreSelec
         if (it->DocName == context.docName.c_str()) {
             touched = true;
             it = context.info->selList.erase(it);
+            ++Removals;
         }
         else {
             ++it;
@@ -1972,6 +2006,7 @@ void SelectionSingleton::clearCompleteSelection(const char* pDocName, bool clear
     }
 
     context.info->selList.clear();
+    ++Removals;
 
     SelectionChanges Chng(SelectionChanges::ClrSelection, context.docName.c_str());
 
@@ -2194,6 +2229,7 @@ void SelectionSingleton::slotDeletedObject(const App::DocumentObject& Obj)
                 it->TypeName
             );
             info.selList.erase(it);
+            ++Removals;
         }
     }
     if (!changes.empty()) {
@@ -2227,6 +2263,7 @@ void SelectionSingleton::slotClosedDocument(const App::Document& doc)
 {
     // const_cast is ok because we just use doc as a key
     docSelectionContext.erase(const_cast<App::Document*>(&doc));
+    ++Removals;
 }
 
 void SelectionSingleton::setSelectionStyle(SelectionStyle selStyle, const char* pDocName)
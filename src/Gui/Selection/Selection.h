@@ -759,6 +759,10 @@ protected:
     {
         notify(SelectionChanges(Chng));
     }
+    /** Notifies a change. An added element is known to be still selected as long as the
+     * number of removals from the selection equals \a removals.
+     */
+    void notify(SelectionChanges&& Chng, std::size_t removals);
 
     struct SelectionDescription
     {
@@ -858,8 +862,16 @@ protected:
     bool logHasSelection {false};
     bool clarifySelectionActive {false};
 
-    std::deque<SelectionChanges> NotificationQueue;
+    struct Notification
+    {
+        SelectionChanges msg;
+        /// the number of removals when an added element was known to be selected
+        std::size_t removals;
+    };
+    std::deque<Notification> NotificationQueue;
     bool Notifying {false};
+    /// counts the elements removed from the selection, see notify()
+    std::size_t Removals {0};
 };
 
 /**
@@ -887,13 +887,19 @@ void SoUpdateVBOAction::initClass()
     SO_ACTION_ADD_METHOD(SoFCSelection, callDoAction);
 }
 
-SoUpdateVBOAction::SoUpdateVBOAction()
+SoUpdateVBOAction::SoUpdateVBOAction(Content content)
+    : content(content)
 {
     SO_ACTION_CONSTRUCTOR(SoUpdateVBOAction);
 }
 
 SoUpdateVBOAction::~SoUpdateVBOAction() = default;
 
+SoUpdateVBOAction::Content SoUpdateVBOAction::getContent() const
+{
+    return content;
+}
+
 void SoUpdateVBOAction::finish()
 {
     atexit_cleanup();
@@ -361,9 +361,18 @@ class GuiExport SoUpdateVBOAction: public SoAction
     SO_ACTION_HEADER(SoUpdateVBOAction);
 
 public:
-    SoUpdateVBOAction();
+    /// Defines which content of the buffers is out of date
+    enum Content
+    {
+        All,    /**< The geometry and the colors */
+        Colors  /**< Only the colors */
+    };
+
+    explicit SoUpdateVBOAction(Content content = All);
     ~SoUpdateVBOAction() override;
 
+    Content getContent() const;
+
     static void initClass();
     static void finish();
 
@@ -372,6 +381,9 @@ protected:
 
 private:
     static void callDoAction(SoAction* action, SoNode* node);
+
+private:
+    Content content;
 };
 
 }  // namespace Gui
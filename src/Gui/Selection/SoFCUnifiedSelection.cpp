@@ -32,6 +32,7 @@
 #include <Inventor/actions/SoGetPrimitiveCountAction.h>
 #include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/actions/SoHandleEventAction.h>
+#include <Inventor/actions/SoRayPickAction.h>
 #include <Inventor/actions/SoWriteAction.h>
 #include <Inventor/bundles/SoMaterialBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
@@ -254,17 +255,63 @@ std::vector<SoFCUnifiedSelection::PickedInfo> SoFCUnifiedSelection::getPickedLis
     SoHandleEventAction* action,
     bool singlePick
 ) const
+{
+    return getPickedList(action->getPickedPointList(), action->getCurPath(), singlePick);
+}
+
+std::vector<SoFCUnifiedSelection::PickedInfo> SoFCUnifiedSelection::getNearestPickedList(
+    SoHandleEventAction* action,
+    SoRayPickAction& pickAction
+) const
+{
+    // The picked point list of the action holds the intersections with everything under the
+    // cursor. For a single pick only the nearest object matters, so it is searched for first and
+    // then only this object is picked completely to find its edges and vertexes next to a face.
+    const SoPickedPoint* pp = action->getPickedPoint();
+    if (!pp) {
+        return {};
+    }
+
+    ViewProvider* vp = nullptr;
+    auto path = Gui::toFullPath(pp->getPath());
+    if (this->pcDocument && path && path->containsPath(action->getCurPath())) {
+        vp = this->pcDocument->getViewProviderByPathFromHead(path);
+    }
+    int index = vp ? path->findNode(vp->getRoot()) : -1;
+    if (index < 0) {
+        return getPickedList(action, true);
+    }
+
+    SoPath* vpPath = path->copy(0, index + 1);
+    vpPath->ref();
+    pickAction.setPoint(action->getEvent()->getPosition());
+    pickAction.setRadius(pickRadius);
+    pickAction.setPickAll(true);
+    pickAction.apply(vpPath);
+    vpPath->unref();
+
+    auto ret = getPickedList(pickAction.getPickedPointList(), action->getCurPath(), true);
+    if (ret.empty()) {
+        return getPickedList(action, true);
+    }
+    return ret;
+}
+
+std::vector<SoFCUnifiedSelection::PickedInfo> SoFCUnifiedSelection::getPickedList(
+    const SoPickedPointList& points,
+    const SoPath* curPath,
+    bool singlePick
+) const
 {
     ViewProvider* last_vp = nullptr;
     std::vector<PickedInfo> ret;
-    const SoPickedPointList& points = action->getPickedPointList();
     for (int i = 0, count = points.getLength(); i < count; ++i) {
         PickedInfo info;
         info.pp = points[i];
         info.vpd = nullptr;
         ViewProvider* vp = nullptr;
         auto path = Gui::toFullPath(info.pp->getPath());
-        if (this->pcDocument && path && path->containsPath(action->getCurPath())) {
+        if (this->pcDocument && path && path->containsPath(curPath)) {
             vp = this->pcDocument->getViewProviderByPathFromHead(path);
             if (singlePick && last_vp && last_vp != vp) {
                 return ret;
@@ -908,7 +955,8 @@ void SoFCUnifiedSelection::handleEvent(SoHandleEventAction* action)
         // just check for a picked point if the data set has been selected.
         if (preselectionMode == AUTO || preselectionMode == ON) {
             // check to see if the mouse is over our geometry...
-            auto infos = this->getPickedList(action, true);
+            SoRayPickAction pickAction(action->getViewportRegion());
+            auto infos = this->getNearestPickedList(action, pickAction);
             if (!infos.empty()) {
                 setPreselect(infos[0]);
             }
@@ -1194,6 +1242,7 @@ bool SoFCSelectionRoot::StackComp::operator()(const Stack& a, const Stack& b) co
 }
 // ---------------------------------------------------------------------------------
 SoSeparator::CacheEnabled SoFCSeparator::CacheMode = SoSeparator::AUTO;
+bool SoFCSeparator::RenderCulling = false;
 SO_NODE_SOURCE(SoFCSeparator)
 
 SoFCSeparator::SoFCSeparator(bool trackCacheMode)
@@ -1208,9 +1257,20 @@ SoFCSeparator::SoFCSeparator(bool trackCacheMode)
 
 void SoFCSeparator::GLRenderBelowPath(SoGLRenderAction* action)
 {
-    if (trackCacheMode && renderCaching.getValue() != CacheMode) {
-        renderCaching = CacheMode;
-        boundingBoxCaching = CacheMode;
+    if (trackCacheMode) {
+        // Coin only culls a separator against the view frustum if its bounding box is cached,
+        // so with culling the bounding box cache is kept even if render caching is off
+        CacheEnabled bboxMode = RenderCulling ? SoSeparator::ON : CacheMode;
+        CacheEnabled cullMode = RenderCulling ? SoSeparator::ON : SoSeparator::AUTO;
+        if (renderCaching.getValue() != CacheMode) {
+            renderCaching = CacheMode;
+        }
+        if (boundingBoxCaching.getValue() != bboxMode) {
+            boundingBoxCaching = bboxMode;
+        }
+        if (renderCulling.getValue() != cullMode) {
+            renderCulling = cullMode;
+        }
     }
     inherited::GLRenderBelowPath(action);
 }
@@ -38,7 +38,10 @@
 
 
 class SoFullPath;
+class SoPath;
 class SoPickedPoint;
+class SoPickedPointList;
+class SoRayPickAction;
 class SoDetail;
 
 
@@ -119,8 +122,19 @@ private:
     bool setSelection(const std::vector<PickedInfo>&, bool ctrlDown = false);
 
     std::vector<PickedInfo> getPickedList(SoHandleEventAction* action, bool singlePick) const;
+    std::vector<PickedInfo> getPickedList(
+        const SoPickedPointList& points,
+        const SoPath* curPath,
+        bool singlePick
+    ) const;
+    std::vector<PickedInfo> getNearestPickedList(
+        SoHandleEventAction* action,
+        SoRayPickAction& pickAction
+    ) const;
 
     Gui::Document* pcDocument {nullptr};
+    // the pick radius in pixels, kept in sync with the one of the viewer
+    float pickRadius {5.0F};
 
     static SoFullPath* currentHighlightPath;
     SoFullPath* detailPath;
@@ -190,10 +204,20 @@ public:
     {
         return CacheMode;
     }
+    /// Enables view frustum culling independent of the cache mode
+    static void setRenderCulling(bool on)
+    {
+        RenderCulling = on;
+    }
+    static bool getRenderCulling()
+    {
+        return RenderCulling;
+    }
 
 private:
     bool trackCacheMode;
     static CacheEnabled CacheMode;
+    static bool RenderCulling;
 };
 
 class GuiExport SoFCSelectionRoot: public SoFCSeparator
@@ -483,7 +483,14 @@ SoQtOffscreenRenderer::SoQtOffscreenRenderer(SoGLRenderAction* action)
 */
 SoQtOffscreenRenderer::~SoQtOffscreenRenderer()
 {
+    // the frame buffer must be released in its own context
+    if (framebuffer && context) {
+        context->makeCurrent(surface.get());
+    }
     delete framebuffer;
+    if (context) {
+        context->doneCurrent();
+    }
 
     if (this->didallocation) {
         delete this->renderaction;
@@ -607,21 +614,32 @@ void SoQtOffscreenRenderer::makeFrameBuffer(int width, int height, int samples)
                                                                        // object, just to be sure
 }
 
+bool SoQtOffscreenRenderer::makeCurrent()
+{
+    if (!context) {
+        QSurfaceFormat format;
+        format.setSamples(PRIVATE(this)->numSamples);
+        auto ctx = std::make_unique<QOpenGLContext>();
+        ctx->setFormat(format);
+        if (!ctx->create()) {
+            return false;
+        }
+        surface = std::make_unique<QOffscreenSurface>();
+        surface->setFormat(ctx->format());
+        surface->create();
+        context = std::move(ctx);
+    }
+
+    return context->makeCurrent(surface.get());
+}
+
 SbBool SoQtOffscreenRenderer::renderFromBase(SoBase* base)
 {
     const SbVec2s fullsize = this->viewport.getViewportSizePixels();
 
-    QSurfaceFormat format;
-    format.setSamples(PRIVATE(this)->numSamples);
-    QOpenGLContext context;
-    context.setFormat(format);
-    if (!context.create()) {
+    if (!makeCurrent()) {
         return false;
     }
-    QOffscreenSurface offscreen;
-    offscreen.setFormat(format);
-    offscreen.create();
-    context.makeCurrent(&offscreen);
 
     if (!framebuffer) {
         makeFrameBuffer(fullsize[0], fullsize[1], PRIVATE(this)->numSamples);
@@ -667,7 +685,7 @@ SbBool SoQtOffscreenRenderer::renderFromBase(SoBase* base)
     this->renderaction->setCacheContext(oldcontext);  // restore old
 
     glImage = framebuffer->toImage();
-    context.doneCurrent();
+    context->doneCurrent();
 
     return true;
 }
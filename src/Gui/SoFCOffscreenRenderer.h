@@ -37,11 +37,15 @@
 # include <GL/gl.h>
 #endif  // FC_OS_MACOSX
 
+#include <memory>
+
 #include <QImage>
 #include <QStringList>
 
 #include <FCGlobal.h>
 
+class QOffscreenSurface;
+class QOpenGLContext;
 class QOpenGLFramebufferObject;
 
 namespace Gui
@@ -152,7 +156,12 @@ private:
     static void pre_render_cb(void* userdata, SoGLRenderAction* action);
     SbBool renderFromBase(SoBase* base);
     void makeFrameBuffer(int width, int height, int samples);
+    bool makeCurrent();
 
+    // The context and surface are kept between renderings so that the frame buffer and the
+    // GL caches of Coin stay valid for the next call
+    std::unique_ptr<QOpenGLContext> context;
+    std::unique_ptr<QOffscreenSurface> surface;
     QOpenGLFramebufferObject* framebuffer;
     uint32_t cache_context;  // our unique context id
 
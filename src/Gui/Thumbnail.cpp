@@ -27,6 +27,9 @@
 #include <QDateTime>
 #include <QImage>
 #include <QThread>
+#include <QTimer>
+#include <Inventor/SoRenderManager.h>
+#include <Inventor/sensors/SoNodeSensor.h>
 
 
 #include <App/Application.h>
@@ -46,13 +49,31 @@ using namespace Gui;
 
 Thumbnail::Thumbnail(int s)
     : size(s)
-{}
+    , sensor(std::make_unique<SoNodeSensor>(sceneChangedCB, this))
+    , timer(std::make_unique<QTimer>())
+{
+    timer->setSingleShot(true);
+    QObject::connect(timer.get(), &QTimer::timeout, [this]() { update(); });
+}
 
 Thumbnail::~Thumbnail() = default;
 
 void Thumbnail::setViewer(View3DInventorViewer* v)
 {
-    this->viewer = v;
+    if (this->viewer != v) {
+        this->viewer = v;
+        this->image = QImage();
+        this->imageId = 0;
+        this->timer->stop();
+    }
+
+    SoNode* root = v ? v->getSoRenderManager()->getSceneGraph() : nullptr;
+    if (this->sensor->getAttachedNode() != root) {
+        this->sensor->detach();
+        if (root) {
+            this->sensor->attach(root);
+        }
+    }
 }
 
 void Thumbnail::setSize(int s)
@@ -65,6 +86,57 @@ void Thumbnail::setFileName(const char* fn)
     this->uri = QUrl::fromLocalFile(QString::fromUtf8(fn));
 }
 
+void Thumbnail::update()
+{
+    if (this->image.isNull() || !this->viewer || this->imageId == sceneId()) {
+        return;
+    }
+
+    renderImage();
+}
+
+void Thumbnail::sceneChangedCB(void* data, SoSensor*)
+{
+    auto self = static_cast<Thumbnail*>(data);
+    // wait until the scene has been left alone for a while before rendering it again
+    if (!self->image.isNull()) {
+        self->timer->start(2000);
+    }
+}
+
+uint32_t Thumbnail::sceneId() const
+{
+    SoNode* root = this->viewer ? this->viewer->getSoRenderManager()->getSceneGraph() : nullptr;
+    return root ? root->getNodeId() : 0;
+}
+
+QImage Thumbnail::renderImage() const
+{
+    QImage img;
+    if (this->viewer->thread() != QThread::currentThread()) {
+        qWarning("Cannot create a thumbnail from non-GUI thread");
+        return img;
+    }
+
+    QColor invalid;
+    this->viewer->imageFromFramebuffer(
+        this->size,
+        this->size,
+        4,
+        invalid,
+        img,
+        View3DInventorViewer::RenderIntent::RasterCapture
+    );
+
+    // take the id afterwards so that changes made while rendering don't count
+    if (!img.isNull()) {
+        this->image = img;
+        this->imageId = sceneId();
+        this->imageSize = this->size;
+    }
+    return img;
+}
+
 unsigned int Thumbnail::getMemSize() const
 {
     return 0;
@@ -89,26 +161,22 @@ void Thumbnail::SaveDocFile(Base::Writer& writer) const
     QImage img;
     bool created = false;
 
-    // 1. Try to create the thumbnail from the viewer
-    if (this->viewer) {
-        if (this->viewer->thread() != QThread::currentThread()) {
-            qWarning("Cannot create a thumbnail from non-GUI thread");
-        }
-        else {
-            QColor invalid;
-            this->viewer->imageFromFramebuffer(
-                this->size,
-                this->size,
-                4,
-                invalid,
-                img,
-                View3DInventorViewer::RenderIntent::RasterCapture
-            );
-            created = !img.isNull();
+    // 1. Reuse the last image rendered from the viewer. If the scene has changed since then it's
+    // rendered again right after saving instead of making the saving wait for it.
+    if (this->viewer && !this->image.isNull() && this->imageSize == this->size) {
+        img = this->image;
+        created = true;
+        if (this->imageId != sceneId()) {
+            this->timer->start(0);
         }
     }
+    // 2. Otherwise try to create the thumbnail from the viewer
+    else if (this->viewer) {
+        img = renderImage();
+        created = !img.isNull();
+    }
 
-    // 2. If creation failed (e.g. no viewer or background thread), try to restore from the existing file
+    // 3. If creation failed (e.g. no viewer or background thread), try to restore from the existing file
     if (!created) {
         QString filename = this->uri.toLocalFile();
         Base::FileInfo fi(filename.toUtf8().constData());
@@ -23,10 +23,16 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <Base/Persistence.h>
+#include <QImage>
+#include <QPointer>
 #include <QUrl>
 
-class QImage;
+class QTimer;
+class SoNodeSensor;
+class SoSensor;
 
 namespace Gui
 {
@@ -41,6 +47,8 @@ public:
     void setViewer(View3DInventorViewer*);
     void setSize(int);
     void setFileName(const char*);
+    /// Renders the thumbnail again if the scene has changed since it was rendered last
+    void update();
 
     /** @name I/O of the document */
     //@{
@@ -55,10 +63,22 @@ public:
     void RestoreDocFile(Base::Reader& reader) override;
     //@}
 
+private:
+    uint32_t sceneId() const;
+    QImage renderImage() const;
+    static void sceneChangedCB(void* data, SoSensor*);
+
 private:
     QUrl uri;
-    View3DInventorViewer* viewer {nullptr};
+    QPointer<View3DInventorViewer> viewer;
     int size;
+    // The last image rendered from the viewer and the id of the scene it shows. It's kept up to
+    // date while the application is idle so that saving doesn't have to wait for the rendering.
+    mutable QImage image;
+    mutable uint32_t imageId {0};
+    mutable int imageSize {0};
+    std::unique_ptr<SoNodeSensor> sensor;
+    std::unique_ptr<QTimer> timer;
 };
 
 }  // namespace Gui
@@ -287,6 +287,11 @@ public:
     {
         QIcon icon, icon2;
         for (auto item : items) {
+            // An item in a collapsed branch can't be seen, so its status is only tested when the
+            // branch gets expanded. This keeps the cost of an update down to the visible items.
+            if (!resetStatus && !item->isUnfolded()) {
+                continue;
+            }
             item->testStatus(resetStatus, icon, icon2);
         }
     }
@@ -3725,6 +3730,23 @@ void TreeWidget::onItemCollapsed(QTreeWidgetItem* item)
     }
 }
 
+namespace
+{
+// Tests the status of the items that were skipped while their branch was collapsed
+void testUnfoldedStatus(QTreeWidgetItem* parent)
+{
+    for (int i = 0; i < parent->childCount(); ++i) {
+        QTreeWidgetItem* child = parent->child(i);
+        if (child->type() == TreeWidget::ObjectType) {
+            static_cast<DocumentObjectItem*>(child)->testStatus(false);
+        }
+        if (child->isExpanded()) {
+            testUnfoldedStatus(child);
+        }
+    }
+}
+}  // namespace
+
 void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
 {
     // object item expanded
@@ -3733,6 +3755,9 @@ void TreeWidget::onItemExpanded(QTreeWidgetItem* item)
         objItem->setExpandedStatus(true);
         objItem->getOwnerDocument()->populateItem(objItem, false, false);
     }
+    if (item) {
+        testUnfoldedStatus(item);
+    }
 }
 
 void TreeWidget::scrollItemToTop()
@@ -6153,6 +6178,16 @@ Gui::ViewProviderDocumentObject* DocumentObjectItem::object() const
     return myData->viewObject;
 }
 
+bool DocumentObjectItem::isUnfolded() const
+{
+    for (auto item = parent(); item; item = item->parent()) {
+        if (!item->isExpanded()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void DocumentObjectItem::testStatus(bool resetStatus)
 {
     QIcon icon, icon2;
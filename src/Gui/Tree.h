@@ -488,6 +488,8 @@ public:
     Gui::ViewProviderDocumentObject* object() const;
     void testStatus(bool resetStatus, QIcon& icon1, QIcon& icon2);
     void testStatus(bool resetStatus);
+    /// Returns true if all parents of the item are expanded
+    bool isUnfolded() const;
     void displayStatusInfo();
     void setExpandedStatus(bool);
     void setData(int column, int role, const QVariant& value) override;
@@ -107,6 +107,7 @@
 #include "Application.h"
 #include "Command.h"
 #include "Document.h"
+#include "FrameStatistics.h"
 #include "GLPainter.h"
 #include "Inventor/SoAxisCrossKit.h"
 #include "Inventor/SoFCBackgroundGradient.h"
@@ -577,6 +578,7 @@ void View3DInventorViewer::init()
     // must be created. Using an SoSeparator avoids this drawback.
     selectionRoot = new Gui::SoFCUnifiedSelection();
     selectionRoot->applySettings();
+    selectionRoot->pickRadius = getPickRadius();
 
     // set the ViewProvider root node
     pcViewProviderRoot = selectionRoot;
@@ -1440,6 +1442,39 @@ void View3DInventorViewer::setEnabledFPSCounter(bool on)
     }
 }
 
+void View3DInventorViewer::setEnabledFrameStatistics(bool on)
+{
+    if (on) {
+        if (!frameStatistics) {
+            frameStatistics = std::make_unique<FrameStatistics>();
+        }
+        if (!frameStatisticsLabel) {
+            frameStatisticsLabel = new QLabel(this);
+            frameStatisticsLabel->setAttribute(Qt::WA_TransparentForMouseEvents);
+            frameStatisticsLabel->setStyleSheet(
+                QStringLiteral("color: white; background: rgba(0, 0, 0, 128); padding: 4px;")
+            );
+        }
+        frameStatisticsLabel->show();
+        redraw();
+    }
+    else {
+        frameStatistics.reset();
+        if (frameStatisticsLabel) {
+            frameStatisticsLabel->hide();
+        }
+    }
+}
+
+bool View3DInventorViewer::isEnabledFrameStatistics() const
+{
+    return frameStatistics != nullptr;
+}
+
+const FrameStatistics* View3DInventorViewer::getFrameStatistics() const
+{
+    return frameStatistics.get();
+}
 
 void View3DInventorViewer::setEnabledVBO(bool on)
 {
@@ -1451,6 +1486,12 @@ bool View3DInventorViewer::isEnabledVBO() const
     return vboEnabled;
 }
 
+void View3DInventorViewer::setRenderCulling(bool on)
+{
+    SoFCSeparator::setRenderCulling(on);
+    this->getSoRenderManager()->scheduleRedraw();
+}
+
 void View3DInventorViewer::setRenderCache(int mode)
 {
     static int canAutoCache = -1;
@@ -2633,6 +2674,10 @@ void View3DInventorViewer::renderScene()
     SoGLRenderAction* glra = this->getSoRenderManager()->getGLRenderAction();
     SoState* state = glra->getState();
 
+    if (frameStatistics) {
+        frameStatistics->beginFrame(glra->getCacheContext());
+    }
+
     // Render our scenegraph with the image.
     {
         ZoneScopedN("Background");
@@ -2705,6 +2750,10 @@ void View3DInventorViewer::renderScene()
         this->drawAxisCross();
     }
 
+    if (frameStatistics) {
+        frameStatistics->endTraversal();
+    }
+
 #if defined(ENABLE_GL_DEPTH_RANGE)
     // using the main portion of z-buffer again (for frontbuffer highlighting)
     glDepthRange(0.1, 1.0);
@@ -2724,6 +2773,20 @@ void View3DInventorViewer::renderScene()
         }
     }
 
+    if (frameStatistics) {
+        frameStatistics->endFrame();
+        frameStatistics->countPrimitives(
+            this->getSoRenderManager()->getSceneGraph(),
+            _ViewProviderSet,
+            this->getSoRenderManager()->getViewportRegion()
+        );
+        if (frameStatisticsLabel) {
+            frameStatisticsLabel->setText(QString::fromStdString(frameStatistics->toString()));
+            frameStatisticsLabel->adjustSize();
+            frameStatisticsLabel->move(10, 10);
+        }
+    }
+
     if (fpsEnabled && fpsCounter) {
         std::stringstream stream;
         stream.precision(1);
@@ -4076,6 +4139,17 @@ bool View3DInventorViewer::isFeedbackVisible() const
     return this->axiscrossEnabled;
 }
 
+/*!
+  Set the pick radius in pixels, the selection node uses it for its own ray picks.
+*/
+void View3DInventorViewer::setPickRadius(float pickRadius)
+{
+    inherited::setPickRadius(pickRadius);
+    if (selectionRoot) {
+        selectionRoot->pickRadius = pickRadius;
+    }
+}
+
 /*!
   Set the size of the feedback axiscross.  The value is interpreted as
   an approximate percentage chunk of the dimensions of the total
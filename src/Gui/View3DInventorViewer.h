@@ -91,6 +91,7 @@ class BoundBox2d;
 
 namespace Gui
 {
+class FrameStatistics;
 class NavigationAnimation;
 class ViewProvider;
 class SoFCBackgroundGradient;
@@ -217,6 +218,8 @@ public:
     void setFeedbackSize(int size);
     int getFeedbackSize() const;
 
+    void setPickRadius(float pickRadius) override;
+
     /// Get the preferred samples from the user settings
     static int getNumSamples();
     void setRenderType(RenderType type);
@@ -523,6 +526,11 @@ public:
     void changeRotationCenterPosition(const SbVec3f& newCenter);
 
     void setEnabledFPSCounter(bool on);
+    /// Shows an overlay with the frame times and primitive counts, see FrameStatistics
+    void setEnabledFrameStatistics(bool on);
+    bool isEnabledFrameStatistics() const;
+    /// Returns the statistics of the last frame, or null if they are disabled
+    const FrameStatistics* getFrameStatistics() const;
     void setEnabledNaviCube(bool on);
     bool isEnabledNaviCube() const;
     void setNaviCubeCorner(int);
@@ -530,6 +538,7 @@ public:
     void setEnabledVBO(bool on);
     bool isEnabledVBO() const;
     void setRenderCache(int);
+    void setRenderCulling(bool on);
 
     //! Update colors of axis in corner to match preferences
     void updateColors();
@@ -625,7 +634,7 @@ private:
     bool restoreEditingRoot;
     SoEventCallback* pEventCallback;
     NavigationStyle* navigation;
-    SoFCUnifiedSelection* selectionRoot;
+    SoFCUnifiedSelection* selectionRoot {nullptr};
 
     SoClipPlane* pcClipPlane;
 
@@ -648,6 +657,8 @@ private:
     bool fpsEnabled;
     QLabel* fpsCounter = nullptr;
     unsigned long previousAxisLetterColor = 0;
+    std::unique_ptr<FrameStatistics> frameStatistics;
+    QLabel* frameStatisticsLabel = nullptr;
     bool vboEnabled;
     bool naviCubeEnabled;
     // Screen-only viewer decorations such as the navicube are rendered only
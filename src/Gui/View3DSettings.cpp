@@ -88,12 +88,14 @@ void View3DSettings::applySettings()
     OnChange(*hGrp, "BackgroundColor4");
     OnChange(*hGrp, "UseBackgroundColorMid");
     OnChange(*hGrp, "ShowFPS");
+    OnChange(*hGrp, "ShowFrameStatistics");
     OnChange(*hGrp, "ShowNaviCube");
     OnChange(*hGrp, "AxisXColor");
     OnChange(*hGrp, "AxisYColor");
     OnChange(*hGrp, "AxisZColor");
     OnChange(*hGrp, "UseVBO");
     OnChange(*hGrp, "RenderCache");
+    OnChange(*hGrp, "RenderCulling");
     OnChange(*hGrp, "Orthographic");
     OnChange(*hGrp, "NavigationStyle");
     OnChange(*hGrp, "OrbitStyle");
@@ -411,6 +413,11 @@ void View3DSettings::OnChange(ParameterGrp::SubjectType& rCaller, ParameterGrp::
             _viewer->setEnabledFPSCounter(rGrp.GetBool("ShowFPS", false));
         }
     }
+    else if (strcmp(Reason, "ShowFrameStatistics") == 0) {
+        for (auto _viewer : _viewers) {
+            _viewer->setEnabledFrameStatistics(rGrp.GetBool("ShowFrameStatistics", false));
+        }
+    }
     else if (strcmp(Reason, "ShowNaviCube") == 0) {
         for (auto _viewer : _viewers) {
             _viewer->setEnabledNaviCube(rGrp.GetBool("ShowNaviCube", true));
@@ -438,6 +445,11 @@ void View3DSettings::OnChange(ParameterGrp::SubjectType& rCaller, ParameterGrp::
             }
         }
     }
+    else if (strcmp(Reason, "RenderCulling") == 0) {
+        for (auto _viewer : _viewers) {
+            _viewer->setRenderCulling(rGrp.GetBool("RenderCulling", false));
+        }
+    }
     else if (strcmp(Reason, "Orthographic") == 0) {
         // check whether a perspective or orthogrphic camera should be set
         if (rGrp.GetBool("Orthographic", true)) {
@@ -27,6 +27,7 @@
 #include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 
+#include "FrameStatistics.h"
 #include "PythonWrapper.h"
 #include "Navigation/NavigationStyle.h"
 #include "View3DViewerPy.h"
@@ -181,6 +182,27 @@ void View3DInventorViewerPy::init_type()
         "0=top left, 1=top right, 2=bottom left, 3=bottom right"
     );
 
+    add_varargs_method(
+        "setEnabledFrameStatistics",
+        &View3DInventorViewerPy::setEnabledFrameStatistics,
+        "setEnabledFrameStatistics(bool): shows or hides an overlay with the render times\n"
+        "and the primitive counts of the frames."
+    );
+    add_varargs_method(
+        "isEnabledFrameStatistics",
+        &View3DInventorViewerPy::isEnabledFrameStatistics,
+        "isEnabledFrameStatistics() -> bool: check whether the frame statistics are enabled."
+    );
+    add_varargs_method(
+        "getFrameStatistics",
+        &View3DInventorViewerPy::getFrameStatistics,
+        "getFrameStatistics() -> dict or None\n"
+        "Returns the statistics of the last rendered frame if they are enabled:\n"
+        "CPUTime and GPUTime in ms (GPUTime is -1 if not supported), the number of\n"
+        "Triangles, Lines, Points and Shapes, and Providers, a list of the view providers\n"
+        "with the most primitives."
+    );
+
     add_varargs_method(
         "getNavigationStyle",
         &View3DInventorViewerPy::getNavigationStyle,
@@ -743,6 +765,58 @@ Py::Object View3DInventorViewerPy::setNaviCubeCorner(const Py::Tuple& args)
     return Py::None();
 }
 
+Py::Object View3DInventorViewerPy::setEnabledFrameStatistics(const Py::Tuple& args)
+{
+    PyObject* m = Py_False;
+    if (!PyArg_ParseTuple(args.ptr(), "O!", &PyBool_Type, &m)) {
+        throw Py::Exception();
+    }
+    _viewer->setEnabledFrameStatistics(Base::asBoolean(m));
+    return Py::None();
+}
+
+Py::Object View3DInventorViewerPy::isEnabledFrameStatistics(const Py::Tuple& args)
+{
+    if (!PyArg_ParseTuple(args.ptr(), "")) {
+        throw Py::Exception();
+    }
+    return Py::Boolean(_viewer->isEnabledFrameStatistics());
+}
+
+Py::Object View3DInventorViewerPy::getFrameStatistics(const Py::Tuple& args)
+{
+    if (!PyArg_ParseTuple(args.ptr(), "")) {
+        throw Py::Exception();
+    }
+
+    const FrameStatistics* stats = _viewer->getFrameStatistics();
+    if (!stats) {
+        return Py::None();
+    }
+
+    const FrameStatistics::Frame& frame = stats->frame();
+    Py::List providers;
+    for (const auto& it : frame.providers) {
+        Py::Dict provider;
+        provider.setItem("Name", Py::String(it.name));
+        provider.setItem("Triangles", Py::Long(static_cast<unsigned long>(it.triangles)));
+        provider.setItem("Lines", Py::Long(static_cast<unsigned long>(it.lines)));
+        provider.setItem("Points", Py::Long(static_cast<unsigned long>(it.points)));
+        provider.setItem("Shapes", Py::Long(static_cast<unsigned long>(it.shapes)));
+        providers.append(provider);
+    }
+
+    Py::Dict dict;
+    dict.setItem("CPUTime", Py::Float(frame.cpuTime));
+    dict.setItem("GPUTime", Py::Float(frame.gpuTime));
+    dict.setItem("Triangles", Py::Long(static_cast<unsigned long>(frame.triangles)));
+    dict.setItem("Lines", Py::Long(static_cast<unsigned long>(frame.lines)));
+    dict.setItem("Points", Py::Long(static_cast<unsigned long>(frame.points)));
+    dict.setItem("Shapes", Py::Long(static_cast<unsigned long>(frame.shapes)));
+    dict.setItem("Providers", providers);
+    return dict;
+}
+
 Py::Object View3DInventorViewerPy::getNavigationStyle(const Py::Tuple& args)
 {
     if (!PyArg_ParseTuple(args.ptr(), "")) {
@@ -81,6 +81,11 @@ public:
     Py::Object isEnabledNaviCube(const Py::Tuple& args);
     Py::Object setNaviCubeCorner(const Py::Tuple& args);
 
+    // Frame statistics
+    Py::Object setEnabledFrameStatistics(const Py::Tuple& args);
+    Py::Object isEnabledFrameStatistics(const Py::Tuple& args);
+    Py::Object getFrameStatistics(const Py::Tuple& args);
+
     Py::Object getNavigationStyle(const Py::Tuple&);
 
 private:
@@ -22,6 +22,7 @@
 
 #include <boost_graph_adjacency_list.hpp>
 #include <boost/graph/topological_sort.hpp>
+#include <unordered_set>
 
 #include <QApplication>
 #include <QKeyEvent>
@@ -32,6 +33,15 @@
 #include <Inventor/events/SoKeyboardEvent.h>
 #include <Inventor/events/SoLocation2Event.h>
 #include <Inventor/events/SoMouseButtonEvent.h>
+#include <Inventor/fields/SoMFColor.h>
+#include <Inventor/fields/SoMFNode.h>
+#include <Inventor/fields/SoMFRotation.h>
+#include <Inventor/fields/SoMFString.h>
+#include <Inventor/fields/SoMFVec2f.h>
+#include <Inventor/fields/SoMFVec3f.h>
+#include <Inventor/fields/SoMFVec4f.h>
+#include <Inventor/fields/SoSFImage.h>
+#include <Inventor/lists/SoFieldList.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoSwitch.h>
 #include <Inventor/nodes/SoTransform.h>
@@ -144,6 +154,85 @@ ViewProvider::~ViewProvider()
     }
 }
 
+namespace
+{
+
+// Estimated memory of the node and the nodes below it that are not visited yet. The data of the
+// vertex arrays and textures dominates, the GPU buffers created from it aren't counted again.
+std::size_t getNodeMemSize(SoNode* node, std::unordered_set<SoNode*>& visited)
+{
+    if (!node || !visited.insert(node).second) {
+        return 0;
+    }
+
+    std::size_t size = sizeof(SoNode);
+    SoFieldList fields;
+    node->getFields(fields);
+    for (int i = 0; i < fields.getLength(); ++i) {
+        SoField* field = fields[i];
+        size += sizeof(SoField);
+        if (field->isOfType(SoSFImage::getClassTypeId())) {
+            SbVec2s dim;
+            int nc = 0;
+            static_cast<SoSFImage*>(field)->getValue(dim, nc);
+            size += std::size_t(dim[0]) * dim[1] * nc;
+            continue;
+        }
+        if (!field->isOfType(SoMField::getClassTypeId())) {
+            continue;
+        }
+        auto mfield = static_cast<SoMField*>(field);
+        std::size_t count = mfield->getNum();
+        if (field->isOfType(SoMFNode::getClassTypeId())) {
+            auto nodes = static_cast<SoMFNode*>(field);
+            for (int j = 0; j < nodes->getNum(); ++j) {
+                size += getNodeMemSize((*nodes)[j], visited);
+            }
+        }
+        else if (field->isOfType(SoMFVec3f::getClassTypeId())
+                 || field->isOfType(SoMFColor::getClassTypeId())) {
+            size += count * sizeof(SbVec3f);
+        }
+        else if (field->isOfType(SoMFVec4f::getClassTypeId())
+                 || field->isOfType(SoMFRotation::getClassTypeId())) {
+            size += count * sizeof(SbVec4f);
+        }
+        else if (field->isOfType(SoMFVec2f::getClassTypeId())) {
+            size += count * sizeof(SbVec2f);
+        }
+        else if (field->isOfType(SoMFString::getClassTypeId())) {
+            size += count * sizeof(SbString);
+        }
+        else {
+            // SoMFInt32, SoMFUInt32, SoMFFloat and the like
+            size += count * sizeof(int32_t);
+        }
+    }
+
+    if (node->isOfType(SoGroup::getClassTypeId())) {
+        auto group = static_cast<SoGroup*>(node);
+        for (int i = 0; i < group->getNumChildren(); ++i) {
+            size += getNodeMemSize(group->getChild(i), visited);
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+unsigned int ViewProvider::getMemSize() const
+{
+    std::size_t size = App::TransactionalObject::getMemSize();
+
+    std::unordered_set<SoNode*> visited;
+    if (SoGroup* childRoot = getChildRoot()) {
+        visited.insert(childRoot);
+    }
+    size += getNodeMemSize(pcRoot, visited);
+    size += getNodeMemSize(pcAnnotation, visited);
+    return static_cast<unsigned int>(size);
+}
+
 ViewProvider* ViewProvider::startEditing(int ModNum)
 {
     try {
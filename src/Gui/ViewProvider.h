@@ -219,6 +219,11 @@ public:
     /// destructor.
     ~ViewProvider() override;
 
+    /** Returns the estimated memory of the properties and of the Coin nodes of the scene graph.
+     * The nodes of claimed children are left to their own view providers.
+     */
+    unsigned int getMemSize() const override;
+
     // returns the root node of the Provider (3D)
     virtual SoSeparator* getRoot() const
     {
@@ -42,6 +42,7 @@
 #include <Inventor/nodes/SoAnnotation.h>
 #include <Inventor/nodes/SoCube.h>
 #include <Inventor/nodes/SoDrawStyle.h>
+#include <Inventor/nodes/SoMatrixTransform.h>
 #include <Inventor/nodes/SoPickStyle.h>
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
@@ -992,7 +993,10 @@ public:
     LinkView& handle;
     CoinPtr<SoSwitch> pcSwitch;
     CoinPtr<SoFCSelectionRoot> pcRoot;
-    CoinPtr<SoTransform> pcTransform;
+    // Arrays can have many thousands of elements, so their placement is kept as a plain matrix.
+    // Other than a SoTransform it is neither decomposed when set nor composed again on every
+    // traversal.
+    CoinPtr<SoMatrixTransform> pcTransform;
     int groupIndex = -1;
     bool isGroup = false;
 
@@ -1001,7 +1005,7 @@ public:
     Element(LinkView& handle)
         : handle(handle)
     {
-        pcTransform = new SoTransform;
+        pcTransform = new SoMatrixTransform;
         pcRoot = new SoFCSelectionRoot(true);
         pcSwitch = new SoSwitch;
         pcSwitch->addChild(pcRoot);
@@ -1435,7 +1439,7 @@ void LinkView::setTransform(int index, const Base::Matrix4D& mat)
     if (index < 0 || index >= (int)nodeArray.size()) {
         LINK_THROW(Base::ValueError, "LinkView: index out of range");
     }
-    setTransform(nodeArray[index]->pcTransform, mat);
+    nodeArray[index]->pcTransform->matrix.setValue(ViewProvider::convert(mat));
 }
 
 void LinkView::setElementVisible(int idx, bool visible)
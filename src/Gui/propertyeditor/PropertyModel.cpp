@@ -21,6 +21,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -503,14 +504,46 @@ void PropertyModel::updateProperty(const App::Property& prop)
         return;
     }
 
+    if (pendingUpdates.empty()) {
+        QMetaObject::invokeMethod(this, &PropertyModel::flushUpdates, Qt::QueuedConnection);
+    }
+    pendingUpdates[it->second] = &prop;
+}
+
+void PropertyModel::flushUpdates()
+{
+    auto updates = std::move(pendingUpdates);
+    pendingUpdates.clear();
+
+    // The items may have been removed or been given other properties in the meantime
     int column = 1;
-    PropertyItem* item = it->second;
-    item->updateData();
-    QModelIndex parent = this->index(item->parent()->row(), 0, QModelIndex());
-    item->assignProperty(&prop);
-    QModelIndex data = this->index(item->row(), column, parent);
-    Q_EMIT dataChanged(data, data);
-    updateChildren(item, column, data);
+    std::map<PropertyItem*, std::pair<int, int>> changedRows;
+    for (auto [item, prop] : updates) {
+        auto it = itemMap.find(const_cast<App::Property*>(prop));
+        if (it == itemMap.end() || it->second != item || !item->parent()) {
+            continue;
+        }
+
+        item->updateData();
+        item->assignProperty(prop);
+        auto res = changedRows.emplace(item->parent(), std::make_pair(item->row(), item->row()));
+        if (!res.second) {
+            res.first->second.first = std::min(res.first->second.first, item->row());
+            res.first->second.second = std::max(res.first->second.second, item->row());
+        }
+
+        QModelIndex parent = this->index(item->parent()->row(), 0, QModelIndex());
+        updateChildren(item, column, this->index(item->row(), column, parent));
+    }
+
+    // one signal per group, the views only repaint the rows that are visible
+    for (const auto& [groupItem, rows] : changedRows) {
+        QModelIndex parent = this->index(groupItem->row(), 0, QModelIndex());
+        Q_EMIT dataChanged(
+            this->index(rows.first, column, parent),
+            this->index(rows.second, column, parent)
+        );
+    }
 }
 
 void PropertyModel::appendProperty(const App::Property& _prop)
@@ -70,6 +70,10 @@ public:
 
     bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
 
+    /** Updates the item of the property. The updates are collected and applied together once
+     * control returns to the event loop, so that a recompute changing the properties of many
+     * selected objects updates each item only once.
+     */
     void updateProperty(const App::Property&);
     void appendProperty(const App::Property&);
     void removeProperty(const App::Property&);
@@ -78,6 +82,9 @@ public:
     QStringList propertyPathFromIndex(const QModelIndex&) const;
     QModelIndex propertyIndexFromPath(const QStringList&) const;
 
+private Q_SLOTS:
+    void flushUpdates();
+
 private:
     void resetGroups();
     void initGroups();
@@ -100,6 +107,9 @@ private:
     std::unordered_map<App::Property*, QPointer<PropertyItem>> itemMap;
 
     std::map<QString, GroupInfo> groupItems;
+
+    // The last changed property of each item with a pending update
+    std::unordered_map<PropertyItem*, const App::Property*> pendingUpdates;
 };
 
 }  // namespace PropertyEditor
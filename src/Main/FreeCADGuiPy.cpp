@@ -40,17 +40,25 @@
 #elif defined(Q_WS_X11)
 # include <QX11EmbedWidget>
 #endif
+#include <array>
+#include <map>
 #include <thread>
 
 // FreeCAD Base header
 #include <App/Application.h>
+#include <App/DocumentObjectPy.h>
+#include <App/DocumentPy.h>
 #include <Base/Exception.h>
 #include <Base/Factory.h>
 #include <Base/Interpreter.h>
 #include <Base/PyObjectBase.h>
+#include <Base/PyWrapParseTupleAndKeywords.h>
+#include <Base/RotationPy.h>
 #include <Gui/Application.h>
 #include <Gui/BitmapFactory.h>
+#include <Gui/Camera.h>
 #include <Gui/MainWindow.h>
+#include <Gui/OffscreenImageRenderer.h>
 #include <Gui/StartupProcess.h>
 #include <Gui/SoFCDB.h>
 #include <Gui/Quarter/Quarter.h>
@@ -193,10 +201,22 @@ static PyObject* FreeCADGui_exec_loop(PyObject* /*self*/, PyObject* args)
 
 static PyObject* FreeCADGui_setupWithoutGUI(PyObject* /*self*/, PyObject* args)
 {
-    if (!PyArg_ParseTuple(args, "")) {
+    PyObject* offscreen = Py_False;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &offscreen)) {
         return nullptr;
     }
 
+    if (Base::asBoolean(offscreen) && !qApp) {
+        // The offscreen platform of Qt renders without a display server. With QT_QPA_PLATFORM
+        // set to eglfs or minimalegl the GL context is created with EGL instead.
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+        }
+        static int argc = 0;
+        static char** argv = {nullptr};
+        (void)new QApplication(argc, argv);
+    }
+
     if (!Gui::Application::Instance) {
         static Gui::Application* app = new Gui::Application(false);
         _isSetupWithoutGui = true;
@@ -216,6 +236,133 @@ static PyObject* FreeCADGui_setupWithoutGUI(PyObject* /*self*/, PyObject* args)
     return Py_None;
 }
 
+static PyObject* FreeCADGui_renderImage(PyObject* /*self*/, PyObject* args, PyObject* kwds)
+{
+    char* filename {};
+    PyObject* source {};
+    int width = 800;
+    int height = 600;
+    PyObject* view = nullptr;
+    PyObject* background = nullptr;
+    static const std::array<const char*, 7> kwlist {
+        "filename",
+        "objects",
+        "width",
+        "height",
+        "view",
+        "background",
+        nullptr
+    };
+    if (!Base::Wrapped_ParseTupleAndKeywords(
+            args,
+            kwds,
+            "etO|iiOO",
+            kwlist,
+            "utf-8",
+            &filename,
+            &source,
+            &width,
+            &height,
+            &view,
+            &background
+        )) {
+        return nullptr;
+    }
+
+    std::string file = filename;
+    PyMem_Free(filename);
+
+    if (!qobject_cast<QGuiApplication*>(qApp)) {
+        PyErr_SetString(PyExc_RuntimeError, "Call setupWithoutGUI(True) before rendering images");
+        return nullptr;
+    }
+    if (width <= 0 || height <= 0) {
+        PyErr_SetString(PyExc_ValueError, "Image size must be positive");
+        return nullptr;
+    }
+
+    // Keep the renderer so that the GL context and the view providers are reused
+    static auto renderer = new Gui::OffscreenImageRenderer();
+
+    try {
+        renderer->setSize(width, height);
+
+        SbRotation orientation = Gui::Camera::rotation(Gui::Camera::Isometric);
+        if (view && PyObject_TypeCheck(view, &Base::RotationPy::Type)) {
+            Base::Rotation rot = *static_cast<Base::RotationPy*>(view)->getRotationPtr();
+            orientation = Gui::Camera::convert(rot);
+        }
+        else if (view && PyUnicode_Check(view)) {
+            static const std::map<std::string, Gui::Camera::Orientation> names {
+                {"Top", Gui::Camera::Top},
+                {"Bottom", Gui::Camera::Bottom},
+                {"Front", Gui::Camera::Front},
+                {"Rear", Gui::Camera::Rear},
+                {"Right", Gui::Camera::Right},
+                {"Left", Gui::Camera::Left},
+                {"Isometric", Gui::Camera::Isometric},
+                {"Dimetric", Gui::Camera::Dimetric},
+                {"Trimetric", Gui::Camera::Trimetric},
+            };
+            auto it = names.find(PyUnicode_AsUTF8(view));
+            if (it == names.end()) {
+                PyErr_SetString(PyExc_ValueError, "Unknown view direction");
+                return nullptr;
+            }
+            orientation = Gui::Camera::rotation(it->second);
+        }
+        else if (view && view != Py_None) {
+            PyErr_SetString(PyExc_TypeError, "View must be a name or a FreeCAD.Rotation");
+            return nullptr;
+        }
+        renderer->setOrientation(orientation);
+
+        SbColor color(1.0F, 1.0F, 1.0F);
+        if (background && background != Py_None) {
+            Py::Sequence rgb(background);
+            color.setValue(
+                static_cast<float>(Py::Float(rgb[0])),
+                static_cast<float>(Py::Float(rgb[1])),
+                static_cast<float>(Py::Float(rgb[2]))
+            );
+        }
+        renderer->setBackgroundColor(color);
+
+        QImage image;
+        if (PyObject_TypeCheck(source, &App::DocumentPy::Type)) {
+            image = renderer->render(static_cast<App::DocumentPy*>(source)->getDocumentPtr());
+        }
+        else {
+            std::vector<App::DocumentObject*> objs;
+            Py::Sequence seq(source);
+            for (const auto& item : seq) {
+                if (!PyObject_TypeCheck(item.ptr(), &App::DocumentObjectPy::Type)) {
+                    PyErr_SetString(PyExc_TypeError, "Expect a document or a list of objects");
+                    return nullptr;
+                }
+                auto objPy = static_cast<App::DocumentObjectPy*>(item.ptr());
+                objs.push_back(objPy->getDocumentObjectPtr());
+            }
+            image = renderer->render(objs);
+        }
+
+        if (!image.save(QString::fromStdString(file))) {
+            PyErr_Format(PyExc_IOError, "Cannot write image to '%s'", file.c_str());
+            return nullptr;
+        }
+    }
+    catch (const Base::Exception& e) {
+        e.setPyException();
+        return nullptr;
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 static PyObject* FreeCADGui_embedToWindow(PyObject* /*self*/, PyObject* args)
 {
     char* pointer;
@@ -276,8 +423,17 @@ struct PyMethodDef FreeCADGui_methods[] = {
     {"setupWithoutGUI",
      FreeCADGui_setupWithoutGUI,
      METH_VARARGS,
-     "setupWithoutGUI() -- Uses this module without starting\n"
-     "an event loop or showing up any GUI\n"},
+     "setupWithoutGUI(offscreen=False) -- Uses this module without starting\n"
+     "an event loop or showing up any GUI\n"
+     "With offscreen set a QApplication without display is created, so that\n"
+     "renderImage() can be used from FreeCADCmd\n"},
+    {"renderImage",
+     (PyCFunction)(void (*)())FreeCADGui_renderImage,
+     METH_VARARGS | METH_KEYWORDS,
+     "renderImage(filename, objects, width=800, height=600, view='Isometric', background=None)\n"
+     "Renders a document or a list of objects into an image file without a 3D view\n"
+     "view is the name of a standard view or a FreeCAD.Rotation of the camera\n"
+     "background is an RGB tuple, the default is white\n"},
     {"embedToWindow",
      FreeCADGui_embedToWindow,
      METH_VARARGS,
@@ -30,9 +30,18 @@
 
 #include <Build/Version.h>  // For FCCopyrightYear
 
+#include <chrono>
 #include <cstdio>
+#include <iostream>
 #include <ostream>
+#include <set>
+#include <string>
 #include <QString>
+#if defined(FC_OS_WIN32)
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
 
 // FreeCAD Base header
 #include <Base/Console.h>
@@ -41,6 +50,7 @@
 
 // FreeCAD doc header
 #include <App/Application.h>
+#include <App/Document.h>
 #include <App/ProgramInformation.h>
 
 using App::Application;
@@ -52,6 +62,140 @@ const auto sBanner = fmt::format(
     FCCopyrightYear
 );
 
+namespace
+{
+
+/// Returns a stream to the standard output and redirects everything else that is written to it
+/// to the standard error, so that the responses of the server don't mix with other output
+FILE* takeStandardOutput()
+{
+    fflush(stdout);
+#if defined(FC_OS_WIN32)
+    FILE* out = _fdopen(_dup(_fileno(stdout)), "w");
+    _dup2(_fileno(stderr), _fileno(stdout));
+#else
+    FILE* out = fdopen(dup(fileno(stdout)), "w");
+    dup2(fileno(stderr), fileno(stdout));
+#endif
+    return out;
+}
+
+std::set<std::string> getDocumentNames()
+{
+    std::set<std::string> names;
+    for (auto doc : App::GetApplication().getDocuments()) {
+        names.insert(doc->getName());
+    }
+    return names;
+}
+
+/// Runs a job, i.e. the Python file given by "script" or the Python source given by "code".
+/// The optional list "args" is passed in sys.argv. Each job gets its own copy of the globals.
+void runJob(const Py::Dict& job)
+{
+    std::string script;
+    if (job.hasKey("script")) {
+        script = Py::String(job.getItem("script")).as_std_string();
+    }
+
+    Py::List argv;
+    argv.append(Py::String(script.empty() ? "-c" : script));
+    if (job.hasKey("args")) {
+        for (const auto& arg : Py::List(job.getItem("args"))) {
+            argv.append(arg);
+        }
+    }
+    Py::Module("sys").setAttr("argv", argv);
+
+    if (!script.empty()) {
+        Base::Interpreter().runFile(script.c_str(), true);
+    }
+    else if (job.hasKey("code")) {
+        std::string code = Py::String(job.getItem("code")).as_std_string();
+        Py::Dict globals(PyDict_Copy(PyModule_GetDict(PyImport_AddModule("__main__"))), true);
+        PyObject* result = PyRun_String(code.c_str(), Py_file_input, globals.ptr(), globals.ptr());
+        if (!result) {
+            if (PyErr_ExceptionMatches(PyExc_SystemExit)) {
+                throw Base::SystemExitException();
+            }
+            throw Base::PyException();
+        }
+        Py_DECREF(result);
+    }
+    else {
+        throw Base::ValueError("Job has neither 'script' nor 'code'");
+    }
+}
+
+/** Runs as a worker that keeps the modules loaded between jobs. Each line of the standard input
+ * is a job as JSON object, e.g. {"id": 1, "script": "convert.py", "args": ["a.step"]}. For each
+ * job one line is written to the standard output, e.g. {"id": 1, "status": "ok", "time": 0.5},
+ * or with "status": "error" and the "error" message. The documents opened by a job are closed
+ * when it has finished. The server quits at the end of the input.
+ */
+int runServer()
+{
+    FILE* out = takeStandardOutput();
+    Console().log("Waiting for jobs on the standard input\n");
+
+    Base::PyGILStateLocker lock;
+    Py::Module json(PyImport_ImportModule("json"), true);
+    Py::Module gc(PyImport_ImportModule("gc"), true);
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::set<std::string> documents = getDocumentNames();
+        Py::Dict response;
+        std::string error;
+        try {
+            Py::Dict job(json.callMemberFunction("loads", Py::TupleN(Py::String(line))));
+            if (job.hasKey("id")) {
+                response.setItem("id", job.getItem("id"));
+            }
+            runJob(job);
+        }
+        catch (const Base::SystemExitException& e) {
+            if (e.getExitCode() != 0) {
+                error = "Exit code " + std::to_string(e.getExitCode());
+            }
+        }
+        catch (const Base::Exception& e) {
+            error = e.what();
+        }
+        catch (const Py::Exception&) {
+            error = Base::PyException().what();
+        }
+
+        // isolate the jobs from each other
+        for (auto doc : App::GetApplication().getDocuments()) {
+            if (documents.find(doc->getName()) == documents.end()) {
+                App::GetApplication().closeDocument(doc->getName());
+            }
+        }
+        gc.callMemberFunction("collect");
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        response.setItem("status", Py::String(error.empty() ? "ok" : "error"));
+        if (!error.empty()) {
+            response.setItem("error", Py::String(error));
+        }
+        response.setItem("time", Py::Float(elapsed.count()));
+        Py::String text(json.callMemberFunction("dumps", Py::TupleN(response)));
+        fprintf(out, "%s\n", text.as_std_string().c_str());
+        fflush(out);
+    }
+
+    fclose(out);
+    return 0;
+}
+
+}  // namespace
+
 int main(int argc, char** argv)
 {
     // Make sure that we use '.' as decimal point
@@ -132,7 +276,12 @@ int main(int argc, char** argv)
 
     // Run phase ===========================================================
     try {
-        Application::runApplication();
+        if (App::Application::Config()["Server"] == "1") {
+            runServer();
+        }
+        else {
+            Application::runApplication();
+        }
     }
     catch (const Base::SystemExitException& e) {
         exit(e.getExitCode());
@@ -22,7 +22,9 @@
  ***************************************************************************/
 
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <unordered_map>
 
@@ -39,9 +41,22 @@
 #include <Base/Rotation.h>
 #include <Base/Tools.h>
 #include <Base/Interpreter.h>
+#include <Base/Parallel.h>
 
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/AttachExtension.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
+
+#include <BRepAlgoAPI_Common.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <BRepGProp.hxx>
+#include <Bnd_Box.hxx>
+#include <GProp_GProps.hxx>
+#include <Precision.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp_Explorer.hxx>
 
 #include <OndselSolver/CREATE.h>
 #include <OndselSolver/ASMTSimulationParameters.h>
@@ -100,6 +115,9 @@ PROPERTY_SOURCE(Assembly::AssemblyObject, App::Part)
 AssemblyObject::AssemblyObject()
     : mbdAssembly(std::make_shared<ASMTAssembly>())
     , bundleFixed(false)
+    , mbdAssemblyReusable(false)
+    , mbdAssemblyBundled(false)
+    , settingPlacements(false)
     , lastDoF(0)
     , lastHasConflict(false)
     , lastHasRedundancies(false)
@@ -111,6 +129,12 @@ AssemblyObject::AssemblyObject()
 
     lastDoF = numberOfComponents() * 6;
     signalSolverUpdate();
+
+    connectChangedObject = App::GetApplication().signalChangedObject.connect(
+        [this](const App::DocumentObject& obj, const App::Property& prop) {
+            slotChangedObject(obj, prop);
+        }
+    );
 }
 
 AssemblyObject::~AssemblyObject() = default;
@@ -140,30 +164,121 @@ App::DocumentObjectExecReturn* AssemblyObject::execute()
 void AssemblyObject::onChanged(const App::Property* prop)
 {
     if (prop == &Group) {
+        invalidateMbdAssembly();
         updateSolveStatus();
     }
     App::Part::onChanged(prop);
 }
 
+void AssemblyObject::invalidateMbdAssembly()
+{
+    mbdAssemblyReusable = false;
+    solvedJoints.clear();
+    solvedGroundedParts.clear();
+    solvedJointPlacements.clear();
+}
+
+void AssemblyObject::slotChangedObject(const App::DocumentObject& obj, const App::Property& prop)
+{
+    if (!mbdAssemblyReusable || settingPlacements || obj.getDocument() != getDocument()) {
+        return;
+    }
+
+    auto object = const_cast<App::DocumentObject*>(&obj);  // NOLINT
+    auto joint = solvedJointPlacements.find(object);
+    if (joint != solvedJointPlacements.end()) {
+        // getJoints() sets the joint placements again on every solve, only a new value matters.
+        const char* name = prop.getName();
+        auto plcProp = dynamic_cast<const App::PropertyPlacement*>(&prop);
+        if (plcProp && name && strcmp(name, "Placement1") == 0
+            && plcProp->getValue() == joint->second.first) {
+            return;
+        }
+        if (plcProp && name && strcmp(name, "Placement2") == 0
+            && plcProp->getValue() == joint->second.second) {
+            return;
+        }
+        invalidateMbdAssembly();
+        return;
+    }
+
+    auto part = objectPartMap.find(object);
+    if (part != objectPartMap.end()) {
+        // Moving a part is what the reused assembly is for, unless the part is grounded or
+        // bundled with others. Other changes of a part reach the solver through its joints.
+        if (&prop == object->getPlacementProperty()
+            && (solvedGroundedParts.contains(object) || !part->second.offsetPlc.isIdentity())) {
+            invalidateMbdAssembly();
+        }
+        return;
+    }
+
+    if (object->isDerivedFrom<JointGroup>() || object->isDerivedFrom<AssemblyLink>()
+        || object->isDerivedFrom<AssemblyObject>()) {
+        invalidateMbdAssembly();
+        return;
+    }
+    for (auto parent : object->getInList()) {
+        if (parent->isDerivedFrom<JointGroup>()) {
+            // A grounded, suppressed or new joint
+            invalidateMbdAssembly();
+            return;
+        }
+    }
+}
+
+bool AssemblyObject::canReuseMbdAssembly(const std::vector<App::DocumentObject*>& joints)
+{
+    return mbdAssemblyReusable && mbdAssemblyBundled == bundleFixed && joints == solvedJoints
+        && solvedGroundedParts == getGroundedParts();
+}
+
 int AssemblyObject::solve(bool enableRedo, bool updateJCS)
 {
     ensureIdentityPlacements();
 
-    mbdAssembly = makeMbdAssembly();
-    objectPartMap.clear();
+    // Parts connected by fixed joints are sent to the solver as a single rigid body, which
+    // removes six unknowns and a fixed joint per collapsed part.
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Assembly"
+    );
+    bool bundle = bundleFixed || hGrp->GetBool("BundleFixedJoints", true);
+    Base::StateLocker bundleLock(bundleFixed, bundle);
+
     motions.clear();
 
-    auto groundedObjs = fixGroundedParts();
-    if (groundedObjs.empty()) {
-        // If no part fixed we can't solve.
-        return -6;
+    // This updates the joint placements, which discards the assembly of the last solve if any
+    // of them changed.
+    std::vector<App::DocumentObject*> joints = getJoints(updateJCS);
+    std::vector<App::DocumentObject*> allJoints = joints;
+
+    if (canReuseMbdAssembly(joints)) {
+        // Warm start: the solver starts from the current placements, which are the result of
+        // the last solve unless the user moved parts since.
+        for (auto& [part, data] : objectPartMap) {
+            if (data.offsetPlc.isIdentity()) {
+                setMbdPartPlacement(data.part, getPlacementFromProp(part, "Placement"));
+            }
+        }
+        removeUnconnectedJoints(joints, solvedGroundedParts);
     }
+    else {
+        invalidateMbdAssembly();
+        mbdAssembly = makeMbdAssembly();
+        objectPartMap.clear();
 
-    std::vector<App::DocumentObject*> joints = getJoints(updateJCS);
+        auto groundedObjs = fixGroundedParts();
+        if (groundedObjs.empty()) {
+            // If no part fixed we can't solve.
+            return -6;
+        }
 
-    removeUnconnectedJoints(joints, groundedObjs);
+        removeUnconnectedJoints(joints, groundedObjs);
 
-    jointParts(joints);
+        jointParts(joints);
+
+        solvedGroundedParts = groundedObjs;
+    }
 
     if (enableRedo) {
         savePlacementsForUndo();
@@ -176,19 +291,33 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
     catch (const std::exception& e) {
         FC_ERR("Solve failed: " << e.what());
         lastSolverStatus = -1;
+        invalidateMbdAssembly();
         updateSolveStatus();
         return -1;
     }
     catch (...) {
         FC_ERR("Solve failed: unhandled exception");
         lastSolverStatus = -1;
+        invalidateMbdAssembly();
         updateSolveStatus();
         return -1;
     }
 
+    settingPlacements = true;
     setNewPlacements();
-
     redrawJointPlacements(joints);
+    settingPlacements = false;
+
+    solvedJoints = allJoints;
+    solvedJointPlacements.clear();
+    for (auto joint : allJoints) {
+        solvedJointPlacements[joint] = {
+            getPlacementFromProp(joint, "Placement1"),
+            getPlacementFromProp(joint, "Placement2")
+        };
+    }
+    mbdAssemblyBundled = bundleFixed;
+    mbdAssemblyReusable = true;
 
     updateSolveStatus();
 
@@ -273,6 +402,7 @@ void AssemblyObject::updateSolveStatus()
 
 int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 {
+    invalidateMbdAssembly();
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
 
@@ -393,22 +523,7 @@ void AssemblyObject::doDragStep()
 
             auto mbdPart = getMbDPart(part);
             dragMbdParts.push_back(mbdPart);
-
-            // Update the MBD part's position
-            Base::Placement plc = getPlacementFromProp(part, "Placement");
-            Base::Vector3d pos = plc.getPosition();
-            mbdPart->updateMbDFromPosition3D(
-                std::make_shared<FullColumn<double>>(ListD {pos.x, pos.y, pos.z})
-            );
-
-            // Update the MBD part's rotation
-            Base::Rotation rot = plc.getRotation();
-            Base::Matrix4D mat;
-            rot.getValue(mat);
-            Base::Vector3d r0 = mat.getRow(0);
-            Base::Vector3d r1 = mat.getRow(1);
-            Base::Vector3d r2 = mat.getRow(2);
-            mbdPart->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+            setMbdPartPlacement(mbdPart, getPlacementFromProp(part, "Placement"));
         }
 
         // Timing mbdAssembly->runDragStep()
@@ -417,6 +532,7 @@ void AssemblyObject::doDragStep()
 
         // Timing the validation and placement setting
         if (validateNewPlacements()) {
+            settingPlacements = true;
             setNewPlacements();
 
             auto joints = getJoints(false);
@@ -426,13 +542,36 @@ void AssemblyObject::doDragStep()
                     redrawJointPlacement(joint);
                 }
             }
+            settingPlacements = false;
         }
     }
     catch (...) {
         // We do nothing if a solve step fails.
+        settingPlacements = false;
     }
 }
 
+void AssemblyObject::setMbdPartPlacement(
+    std::shared_ptr<MbD::ASMTPart> mbdPart,
+    const Base::Placement& plc
+)
+{
+    // Update the MBD part's position
+    Base::Vector3d pos = plc.getPosition();
+    mbdPart->updateMbDFromPosition3D(
+        std::make_shared<FullColumn<double>>(ListD {pos.x, pos.y, pos.z})
+    );
+
+    // Update the MBD part's rotation
+    Base::Rotation rot = plc.getRotation();
+    Base::Matrix4D mat;
+    rot.getValue(mat);
+    Base::Vector3d r0 = mat.getRow(0);
+    Base::Vector3d r1 = mat.getRow(1);
+    Base::Vector3d r2 = mat.getRow(2);
+    mbdPart->updateMbDFromRotationMatrix(r0.x, r0.y, r0.z, r1.x, r1.y, r1.z, r2.x, r2.y, r2.z);
+}
+
 Base::Placement AssemblyObject::getMbdPlacement(std::shared_ptr<ASMTPart> mbdPart)
 {
     if (!mbdPart) {
@@ -486,6 +625,8 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+    // The drag assembly bundles fixed parts, it can't be reused by solve().
+    invalidateMbdAssembly();
     purgeTouched();
 }
 
@@ -546,6 +687,7 @@ void AssemblyObject::clearUndo()
 
 void AssemblyObject::exportAsASMT(std::string fileName)
 {
+    invalidateMbdAssembly();
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     fixGroundedParts();
@@ -906,10 +1048,15 @@ void AssemblyObject::fixGroundedPart(App::DocumentObject* obj, Base::Placement&
     auto mbdMarker1 = makeMbdMarker(markerName1, plc);
     mbdAssembly->addMarker(mbdMarker1);
 
-    std::shared_ptr<ASMTPart> mbdPart = getMbDPart(obj);
+    MbDPartData data = getMbDData(obj);
+    std::shared_ptr<ASMTPart> mbdPart = data.part;
 
+    // The object may have been bundled with another one by a fixed joint
     std::string markerName2 = "FixingMarker";
-    Base::Placement basePlc = Base::Placement();
+    if (!data.offsetPlc.isIdentity()) {
+        markerName2 += "-" + obj->getFullName();
+    }
+    Base::Placement basePlc = data.offsetPlc;
     auto mbdMarker2 = makeMbdMarker(markerName2, basePlc);
     mbdPart->addMarker(mbdMarker2);
 
@@ -2081,3 +2228,163 @@ bool AssemblyObject::isEmpty() const
 {
     return numberOfComponents() == 0;
 }
+
+namespace
+{
+struct InterferenceCandidate
+{
+    App::DocumentObject* obj;
+    TopoDS_Shape shape;
+    Bnd_Box box;
+    bool moved;
+};
+
+bool boxContains(const Bnd_Box& outer, const Bnd_Box& inner)
+{
+    double xmin1, ymin1, zmin1, xmax1, ymax1, zmax1;
+    double xmin2, ymin2, zmin2, xmax2, ymax2, zmax2;
+    outer.Get(xmin1, ymin1, zmin1, xmax1, ymax1, zmax1);
+    inner.Get(xmin2, ymin2, zmin2, xmax2, ymax2, zmax2);
+    return xmin1 <= xmin2 && ymin1 <= ymin2 && zmin1 <= zmin2 && xmax1 >= xmax2 && ymax1 >= ymax2
+        && zmax1 >= zmax2;
+}
+
+// Returns the common volume of two solids, or a null shape if they only touch
+std::pair<double, TopoDS_Shape> commonVolume(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
+{
+    // Without a common face the triangulations can't tell an overlap apart from
+    // disjoint solids, unless one of them is inside the other.
+    BRepExtrema_ShapeProximity proximity(shape1, shape2, 0.0);
+    proximity.Perform();
+    bool overlap = proximity.IsDone()
+        && (!proximity.OverlapSubShapes1().IsEmpty() || !proximity.OverlapSubShapes2().IsEmpty());
+    if (!overlap) {
+        Bnd_Box box1, box2;
+        BRepBndLib::Add(shape1, box1);
+        BRepBndLib::Add(shape2, box2);
+        if (!boxContains(box1, box2) && !boxContains(box2, box1)) {
+            return {0.0, TopoDS_Shape()};
+        }
+    }
+
+    BRepAlgoAPI_Common common(shape1, shape2);
+    common.SetRunParallel(false);
+    common.Build();
+    if (!common.IsDone() || common.Shape().IsNull()) {
+        return {0.0, TopoDS_Shape()};
+    }
+    GProp_GProps props;
+    BRepGProp::VolumeProperties(common.Shape(), props);
+    if (props.Mass() <= Precision::Confusion()) {
+        return {0.0, TopoDS_Shape()};
+    }
+    return {props.Mass(), common.Shape()};
+}
+}  // namespace
+
+std::vector<AssemblyObject::Interference> AssemblyObject::checkInterferences(bool onlyMoved)
+{
+    ParameterGrp::handle hPart = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    double deviation = hPart->GetFloat("MeshDeviation", 0.2);
+    double angularDeflection = Base::toRadians(hPart->GetFloat("MeshAngularDeflection", 28.65));
+
+    std::vector<InterferenceCandidate> candidates;
+    std::unordered_map<App::DocumentObject*, Base::Placement> placements;
+    for (auto* obj : getAssemblyComponents(this)) {
+        TopoDS_Shape shape = PartApp::Feature::getShape(obj, PartApp::ShapeOption::ResolveLink);
+        if (shape.IsNull()) {
+            continue;
+        }
+        TopExp_Explorer xp(shape, TopAbs_SOLID);
+        if (!xp.More()) {
+            continue;
+        }
+        Base::Placement plc = App::GeoFeature::getGlobalPlacement(obj);
+        placements[obj] = plc;
+        auto it = checkedPlacements.find(obj);
+        bool moved = !onlyMoved || it == checkedPlacements.end() || !it->second.isSame(plc);
+        shape.Move(TopLoc_Location(PartApp::TopoShape::convert(plc.toMatrix())));
+        candidates.push_back({obj, shape, Bnd_Box(), moved});
+    }
+
+    // Linked copies share their triangulation, so the shapes are meshed one after the other,
+    // each one in parallel by BRepMesh. Existing triangulations are reused.
+    for (auto& candidate : candidates) {
+        double deflection = PartApp::Tools::getDeflection(candidate.shape, deviation);
+        PartApp::Tools::meshShape(candidate.shape, deflection, angularDeflection);
+        BRepBndLib::Add(candidate.shape, candidate.box);
+    }
+
+    // Broad phase: sweep along X over the boxes sorted by their lower bound
+    auto xMin = [](const InterferenceCandidate& candidate) {
+        return candidate.box.IsVoid() ? 0.0 : candidate.box.CornerMin().X();
+    };
+    std::sort(candidates.begin(), candidates.end(), [&](const auto& c1, const auto& c2) {
+        return xMin(c1) < xMin(c2);
+    });
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        if (candidates[i].box.IsVoid()) {
+            continue;
+        }
+        double xMax = candidates[i].box.CornerMax().X();
+        for (std::size_t j = i + 1; j < candidates.size() && xMin(candidates[j]) <= xMax; j++) {
+            if (!candidates[i].moved && !candidates[j].moved) {
+                continue;
+            }
+            if (!candidates[j].box.IsVoid() && !candidates[i].box.IsOut(candidates[j].box)) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+
+    // Narrow phase and exact common of the remaining pairs
+    std::vector<std::pair<double, TopoDS_Shape>> commons(pairs.size());
+    Base::parallelFor(pairs.size(), [&](std::size_t i) {
+        try {
+            commons[i] = commonVolume(
+                candidates[pairs[i].first].shape,
+                candidates[pairs[i].second].shape
+            );
+        }
+        catch (const Standard_Failure& e) {
+            FC_WARN(
+                "Interference check of " << candidates[pairs[i].first].obj->getFullName()
+                                         << " failed: " << e.GetMessageString()
+            );
+        }
+    });
+
+    std::vector<Interference> result;
+    if (onlyMoved) {
+        // Keep the interferences found before between components that did not move
+        std::unordered_set<App::DocumentObject*> moved;
+        for (auto& candidate : candidates) {
+            if (candidate.moved) {
+                moved.insert(candidate.obj);
+            }
+        }
+        for (auto& interference : lastInterferences) {
+            if (placements.contains(interference.part1) && placements.contains(interference.part2)
+                && !moved.contains(interference.part1) && !moved.contains(interference.part2)) {
+                result.push_back(interference);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        if (!commons[i].second.IsNull()) {
+            result.push_back(
+                {candidates[pairs[i].first].obj,
+                 candidates[pairs[i].second].obj,
+                 commons[i].first,
+                 commons[i].second}
+            );
+        }
+    }
+
+    checkedPlacements = std::move(placements);
+    lastInterferences = result;
+    return result;
+}
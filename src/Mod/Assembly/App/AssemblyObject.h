@@ -26,6 +26,8 @@
 
 #include <boost/signals2.hpp>
 
+#include <TopoDS_Shape.hxx>
+
 #include <Mod/Assembly/AssemblyGlobal.h>
 
 #include <App/FeaturePython.h>
@@ -122,6 +124,10 @@ public:
         double mass = 1.0
     );
     std::shared_ptr<MbD::ASMTPart> getMbDPart(App::DocumentObject* obj);
+    static void setMbdPartPlacement(
+        std::shared_ptr<MbD::ASMTPart> mbdPart,
+        const Base::Placement& plc
+    );
     // To help the solver, during dragging, we are bundling parts connected by a fixed joint.
     // So several assembly components are bundled in a single ASMTPart.
     // So we need to store the plc of each bundled object relative to the bundle origin (first obj
@@ -214,7 +220,23 @@ public:
     bool isEmpty() const;
     int numberOfComponents() const;
 
+    struct Interference
+    {
+        App::DocumentObject* part1;
+        App::DocumentObject* part2;
+        double volume;
+        TopoDS_Shape shape;  // The common volume in global coordinates
+    };
+    /* Find the pairs of components whose solids overlap. Candidate pairs are found from the
+    bounding boxes, then filtered by intersecting the triangulations, and only the remaining
+    ones are intersected exactly. With onlyMoved, only the components that moved since the last
+    check are tested again, e.g. after each frame of a simulation. */
+    std::vector<Interference> checkInterferences(bool onlyMoved = false);
+
     void updateSolveStatus();
+    // The solver assembly of the last solve is reused as long as only the placements of its
+    // parts change. Any other change to the assembly, its joints or its grounded parts discards it.
+    void invalidateMbdAssembly();
     inline int getLastDoF() const
     {
         return lastDoF;
@@ -258,6 +280,9 @@ public:
     fastsignals::signal<void()> signalSolverUpdate;
 
 private:
+    bool canReuseMbdAssembly(const std::vector<App::DocumentObject*>& joints);
+    void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
 
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
@@ -269,6 +294,20 @@ private:
 
     bool bundleFixed;
 
+    // State of the last solve, used to decide if mbdAssembly can be solved again as is
+    bool mbdAssemblyReusable;
+    bool mbdAssemblyBundled;
+    bool settingPlacements;
+    std::vector<App::DocumentObject*> solvedJoints;
+    std::unordered_set<App::DocumentObject*> solvedGroundedParts;
+    std::unordered_map<App::DocumentObject*, std::pair<Base::Placement, Base::Placement>>
+        solvedJointPlacements;
+    fastsignals::scoped_connection connectChangedObject;
+
+    // State of the last interference check, used by checkInterferences(true)
+    std::unordered_map<App::DocumentObject*, Base::Placement> checkedPlacements;
+    std::vector<Interference> lastInterferences;
+
     int lastDoF;
     bool lastHasConflict;
     bool lastHasRedundancies;
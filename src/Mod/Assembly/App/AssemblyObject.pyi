@@ -173,5 +173,23 @@ class AssemblyObject(Part):
             A list of App.DocumentObject instances representing the downstream parts.
         """
         ...
+
+    @constmethod
+    def checkInterferences(self, onlyMoved: bool = False, /) -> list[tuple]:
+        """
+        Find the components of the assembly whose solids overlap.
+
+        Candidate pairs are found from the bounding boxes and the triangulations,
+        only those are intersected exactly. Touching components do not interfere.
+
+        Args:
+            onlyMoved: Only test again the components that moved since the last
+                       check, e.g. after each frame of a simulation.
+
+        Returns:
+            A list of (component1, component2, volume, shape) tuples, where shape
+            is the common volume in global coordinates.
+        """
+        ...
     Joints: Final[list]
     """A list of all joints this assembly has."""
@@ -22,6 +22,8 @@
  ***************************************************************************/
 
 
+#include <Mod/Part/App/TopoShapePy.h>
+
 // inclusion of the generated files (generated out of AssemblyObject.xml)
 #include "AssemblyObjectPy.h"
 #include "AssemblyObjectPy.cpp"
@@ -243,3 +245,29 @@ PyObject* AssemblyObjectPy::getDownstreamParts(PyObject* args) const
 
     return Py::new_reference_to(ret);
 }
+
+PyObject* AssemblyObjectPy::checkInterferences(PyObject* args) const
+{
+    PyObject* onlyMoved = Py_False;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &onlyMoved)) {
+        return nullptr;
+    }
+
+    std::vector<AssemblyObject::Interference> interferences
+        = getAssemblyObjectPtr()->checkInterferences(Base::asBoolean(onlyMoved));
+
+    Py::List ret;
+    for (const auto& interference : interferences) {
+        Py::Tuple tuple(4);
+        tuple.setItem(0, Py::asObject(interference.part1->getPyObject()));
+        tuple.setItem(1, Py::asObject(interference.part2->getPyObject()));
+        tuple.setItem(2, Py::Float(interference.volume));
+        tuple.setItem(
+            3,
+            Py::asObject(new Part::TopoShapePy(new Part::TopoShape(interference.shape)))
+        );
+        ret.append(tuple);
+    }
+
+    return Py::new_reference_to(ret);
+}
@@ -0,0 +1,84 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# /**************************************************************************
+#                                                                           *
+#    Copyright (c) 2026 FreeCAD Project Association                         *
+#                                                                           *
+#    This file is part of FreeCAD.                                          *
+#                                                                           *
+#    FreeCAD is free software: you can redistribute it and/or modify it     *
+#    under the terms of the GNU Lesser General Public License as            *
+#    published by the Free Software Foundation, either version 2.1 of the   *
+#    License, or (at your option) any later version.                        *
+#                                                                           *
+#    FreeCAD is distributed in the hope that it will be useful, but         *
+#    WITHOUT ANY WARRANTY; without even the implied warranty of             *
+#    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+#    Lesser General Public License for more details.                        *
+#                                                                           *
+#    You should have received a copy of the GNU Lesser General Public       *
+#    License along with FreeCAD. If not, see                                *
+#    <https://www.gnu.org/licenses/>.                                       *
+#                                                                           *
+# **************************************************************************/
+
+import FreeCAD as App
+
+from PySide.QtCore import QT_TRANSLATE_NOOP
+
+if App.GuiUp:
+    import FreeCADGui as Gui
+    from PySide import QtWidgets
+
+import UtilsAssembly
+
+translate = App.Qt.translate
+
+__title__ = "Assembly Command to Check Interferences"
+__author__ = "FreeCAD Project Association"
+__url__ = "https://www.freecad.org"
+
+
+class CommandCheckInterference:
+    def __init__(self):
+        pass
+
+    def GetResources(self):
+
+        return {
+            "MenuText": QT_TRANSLATE_NOOP("Assembly_CheckInterference", "Check Interferences"),
+            "ToolTip": QT_TRANSLATE_NOOP(
+                "Assembly_CheckInterference",
+                "Finds the components of the active assembly that overlap and selects them.",
+            ),
+            "CmdType": "ForEdit",
+        }
+
+    def IsActive(self):
+        return UtilsAssembly.isAssemblyCommandActive()
+
+    def Activated(self):
+        assembly = UtilsAssembly.activeAssembly()
+        if not assembly:
+            return
+
+        interferences = assembly.checkInterferences()
+
+        Gui.Selection.clearSelection()
+        for part1, part2, volume, shape in interferences:
+            App.Console.PrintMessage("{} / {}: {:.6g}\n".format(part1.Label, part2.Label, volume))
+            Gui.Selection.addSelection(part1)
+            Gui.Selection.addSelection(part2)
+
+        if interferences:
+            text = translate("Assembly", "{} interferences found, see the report view.").format(
+                len(interferences)
+            )
+        else:
+            text = translate("Assembly", "No interferences found.")
+        QtWidgets.QMessageBox.information(
+            Gui.getMainWindow(), translate("Assembly", "Check Interferences"), text
+        )
+
+
+if App.GuiUp:
+    Gui.addCommand("Assembly_CheckInterference", CommandCheckInterference())
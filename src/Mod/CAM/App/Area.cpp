@@ -25,6 +25,7 @@
 // From Boost 1.75 on the geometry component requires C++14
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
+#include <algorithm>
 #include <limits>
 #include <optional>
 
@@ -71,6 +72,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Exception.h>
+#include <Base/Parallel.h>
 #include <Base/Tools.h>
 #include <Mod/Part/App/CrossSection.h>
 #include <Mod/Part/App/FaceMakerBullseye.h>
@@ -164,7 +166,7 @@ CAreaConfig::~CAreaConfig()
 
 TYPESYSTEM_SOURCE(Path::Area, Base::BaseClass)
 
-bool Area::s_aborting;
+std::atomic<bool> Area::s_aborting;
 
 Area::Area(const AreaParams* params)
     : myParams(s_params)
@@ -1881,10 +1883,30 @@ std::vector<shared_ptr<Area>> Area::makeSections(
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // Fix the tolerance of the solids once instead of for each section, this modifies the
+    // shapes and so can't be done by the sections in parallel
+    std::vector<std::vector<TopoDS_Shape>> solids(myShapes.size());
+    if (!project) {
+        auto itSolids = solids.begin();
+        for (const Shape& s : myShapes) {
+            for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
+                TopoDS_Shape shape(xp.Current());
+                ShapeFix_ShapeTolerance sTol;
+                sTol.SetTolerance(shape, Precision::Confusion());
+                itSolids->push_back(shape);
+            }
+            ++itSolids;
+        }
+    }
+
+    auto makeSection = [&](size_t i) -> shared_ptr<Area> {
         double z = heights[i];
         bool retried = !can_retry;
         while (true) {
+            if (aborting()) {
+                return nullptr;
+            }
+
             gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
             Standard_Real a, b, c, d;
             pln.Coefficients(a, b, c, d);
@@ -1902,31 +1924,21 @@ std::vector<shared_ptr<Area>> Area::makeSections(
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
-                break;
+                return area;
             }
 
-            for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
+            auto itSolids = solids.begin();
+            for (auto it = myShapes.begin(); it != myShapes.end(); ++it, ++itSolids) {
                 const auto& s = *it;
                 BRep_Builder builder;
                 TopoDS_Compound comp;
                 builder.MakeCompound(comp);
 
-                for (TopExp_Explorer xp(s.shape.Moved(loc), TopAbs_SOLID); xp.More(); xp.Next()) {
-                    TopoDS_Shape shape(xp.Current());
-                    ShapeFix_ShapeTolerance sTol;
-                    sTol.SetTolerance(shape, Precision::Confusion());
-
+                for (const TopoDS_Shape& shape : *itSolids) {
                     showShape(shape, nullptr, "section_%zu_shape", i);
                     std::list<TopoDS_Wire> wires;
                     Part::CrossSection section(a, b, c, shape);
-                    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
-                        // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
-                        // needed to make finish pass work.
-                        // This fix might be better to move into Part::CrossSection but it is kept
-                        // here for now to be on the safe side.
-                        wires = section.slice(-d);
-                    });
+                    wires = section.slice(-d);
                     showShapes(wires, nullptr, "section_%zu_wire", i);
                     if (wires.empty()) {
                         AREA_LOG("Section returns no wires");
@@ -1989,19 +2001,43 @@ std::vector<shared_ptr<Area>> Area::makeSections(
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
-                showShape(area->getShape(), nullptr, "section_%zu_final", i);
-                break;
+                // getShape() builds the area, which isn't thread-safe
+                if (FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+                    showShape(area->getShape(), nullptr, "section_%zu_final", i);
+                }
+                return area;
             }
             if (retried) {
                 AREA_WARN("Discard empty section");
-                break;
-            }
-            else {
-                AREA_TRACE("retry section " << z << "->" << z + tolerance);
-                z += tolerance;
-                retried = true;
+                return nullptr;
             }
+            AREA_TRACE("retry section " << z << "->" << z + tolerance);
+            z += tolerance;
+            retried = true;
+        }
+    };
+
+    // The sections are independent, but the debug output adds objects to the document
+    std::vector<shared_ptr<Area>> results(heights.size());
+    unsigned maxThreads = FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE ? 1 : 0;
+    Part::FuzzyHelper::withBooleanFuzzy(.0, [&]() {
+        // Workaround for https://github.com/FreeCAD/FreeCAD/issues/17748
+        // needed to make finish pass work.
+        // This fix might be better to move into Part::CrossSection but it is kept
+        // here for now to be on the safe side.
+        Base::parallelFor(
+            heights.size(),
+            [&](size_t i) { results[i] = makeSection(i); },
+            maxThreads
+        );
+    });
+    if (aborting()) {
+        throw Base::AbortException("Section making aborted");
+    }
+
+    for (auto& area : results) {
+        if (area) {
+            sections.push_back(std::move(area));
         }
     }
     return sections;
@@ -2891,6 +2927,7 @@ struct WireInfo
     TopoDS_Wire wire;
     std::deque<gp_Pnt> points;
     gp_Pnt pt_end;
+    Bnd_Box box;  // only set for closed wires
     bool isClosed;
 
     inline const gp_Pnt& pstart() const
@@ -2939,11 +2976,11 @@ using RResults = std::map<Wires::iterator, size_t>;
 struct GetWires
 {
     Wires& wires;
-    RTree& rtree;
+    std::vector<RValue>& values;
     ShapeParams& params;
-    GetWires(std::list<WireInfo>& ws, RTree& rt, ShapeParams& rp)
+    GetWires(std::list<WireInfo>& ws, std::vector<RValue>& vs, ShapeParams& rp)
         : wires(ws)
-        , rtree(rt)
+        , values(vs)
         , params(rp)
     {}
     void operator()(const TopoDS_Shape& shape, int type)
@@ -2957,6 +2994,9 @@ struct GetWires
             info.wire = BRepBuilderAPI_MakeWire(TopoDS::Edge(shape)).Wire();
         }
         info.isClosed = BRep_Tool::IsClosed(info.wire);
+        if (info.isClosed) {
+            BRepBndLib::Add(info.wire, info.box, Standard_False);
+        }
 
         if (info.isClosed && params.orientation == Area::OrientationReversed) {
             info.wire.Reverse();
@@ -3038,7 +3078,7 @@ struct GetWires
         auto it = wires.end();
         --it;
         for (size_t i = 0, count = it->points.size(); i < count; ++i) {
-            rtree.insert(RValue(it, i));
+            values.emplace_back(it, i);
         }
     }
 };
@@ -3087,7 +3127,11 @@ struct ShapeInfo
         myStartPt = pt;
 
         if (myWires.empty()) {
-            foreachSubshape(myShape, GetWires(myWires, myRTree, myParams), TopAbs_WIRE);
+            std::vector<RValue> values;
+            foreachSubshape(myShape, GetWires(myWires, values, myParams), TopAbs_WIRE);
+            // bulk loading packs the tree, which is faster to build and to query than
+            // inserting the points one by one
+            myRTree = RTree(values.begin(), values.end());
         }
 
         // Now find the true nearest point among the wires returned. Currently
@@ -3101,12 +3145,30 @@ struct ShapeInfo
             myRTree.query(bgi::nearest(pt, myParams.k), bgi::inserter(ret));
         }
 
+        // The exact distance to a closed wire is expensive, so the candidates are checked in
+        // the order of the distance to their bounding box, and the search stops once that
+        // lower bound exceeds the best distance found. Ties are still resolved in favor of
+        // the wire that comes first in the results.
+        std::vector<std::pair<double, Wires::iterator>> candidates;
+        candidates.reserve(ret.size());
+        for (auto r : ret) {
+            candidates.emplace_back(lowerBound(*r.first, pt), r.first);
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+            if (a.first != b.first) {
+                return a.first < b.first;
+            }
+            return a.second < b.second;
+        });
+
         TopoDS_Shape v = BRepBuilderAPI_MakeVertex(pt);
         bool first = true;
         double best_d = 1e20;
         myBestWire = myWires.begin();
-        for (auto r : ret) {
-            Wires::iterator it = r.first;
+        for (const auto& [bound, it] : candidates) {
+            if (!first && bound > best_d) {
+                break;
+            }
             const TopoDS_Shape& wire = it->wire;
             TopoDS_Shape support;
             bool support_edge;
@@ -3152,7 +3214,7 @@ struct ShapeInfo
                     }
                 }
             }
-            if (!first && d >= best_d) {
+            if (!first && (d > best_d || (d == best_d && !(it < myBestWire)))) {
                 continue;
             }
             first = false;
@@ -3169,6 +3231,21 @@ struct ShapeInfo
         return best_d;
     }
 
+    // The squared distance of the point to the bounding box of a closed wire, which is never
+    // more than the distance to the wire itself. Open wires are cheap to check, they get 0.
+    static double lowerBound(const WireInfo& info, const gp_Pnt& pt)
+    {
+        if (!info.isClosed || info.box.IsVoid()) {
+            return 0;
+        }
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        info.box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        double dx = std::max({xMin - pt.X(), 0.0, pt.X() - xMax});
+        double dy = std::max({yMin - pt.Y(), 0.0, pt.Y() - yMax});
+        double dz = std::max({zMin - pt.Z(), 0.0, pt.Z() - zMax});
+        return dx * dx + dy * dy + dz * dz;
+    }
+
     // Assumes nearest() has been called. Rebased the best wire
     // to begin with the best point. Currently only works with closed wire
     TopoDS_Shape rebaseWire(gp_Pnt& pend, double min_dist)
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
@@ -141,7 +142,7 @@ protected:
     bool myProjecting;
     mutable int mySkippedShapes;
 
-    static bool s_aborting;
+    static std::atomic<bool> s_aborting;
     static AreaStaticParams s_params;
 
     /** Called internally to combine children shapes for further processing */
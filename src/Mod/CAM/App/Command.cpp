@@ -23,6 +23,8 @@
 
 #include <cinttypes>
 #include <iomanip>
+#include <sstream>
+#include <string_view>
 #include <boost/algorithm/string.hpp>
 
 #include <Base/Exception.h>
@@ -106,8 +108,14 @@ bool Command::has(const std::string& attr) const
 
 std::string Command::toGCode(int precision, bool padzero) const
 {
-    std::stringstream str;
-    str.fill('0');
+    std::ostringstream str;
+    toGCode(str, precision, padzero);
+    return str.str();
+}
+
+void Command::toGCode(std::ostream& str, int precision, bool padzero) const
+{
+    char fill = str.fill('0');
     str << Name;
     if (precision < 0) {
         precision = 0;
@@ -169,7 +177,7 @@ std::string Command::toGCode(int precision, bool padzero) const
         }
     }
 
-    return str.str();
+    str.fill(fill);
 }
 
 void Command::setFromGCode(const std::string& str)
@@ -178,16 +186,23 @@ void Command::setFromGCode(const std::string& str)
     Annotations.clear();
 
     // Check for annotation comment and split the string
-    std::string gcode_part = str;
+    std::string_view gcode_part = str;
     std::string annotation_part;
 
     auto comment_pos = str.find("; ");
     if (comment_pos != std::string::npos) {
-        gcode_part = str.substr(0, comment_pos);
+        gcode_part = gcode_part.substr(0, comment_pos);
         annotation_part = str.substr(comment_pos + 1);  // length of "; "
     }
 
-    std::string mode = "none";
+    enum class Mode
+    {
+        None,
+        Command,
+        Argument,
+        Comment
+    };
+    Mode mode = Mode::None;
     std::string key;
     std::string value;
     for (unsigned int i = 0; i < gcode_part.size(); i++) {
@@ -195,42 +210,41 @@ void Command::setFromGCode(const std::string& str)
             value += gcode_part[i];
         }
         else if (isalpha(gcode_part[i])) {
-            if (mode == "command") {
+            if (mode == Mode::Command) {
                 if (!key.empty() && !value.empty()) {
                     std::string cmd = key + value;
                     boost::to_upper(cmd);
                     Name = cmd;
-                    key = "";
-                    value = "";
-                    mode = "argument";
+                    key.clear();
+                    value.clear();
                 }
                 else {
                     throw Base::BadFormatError("Badly formatted GCode command");
                 }
-                mode = "argument";
+                mode = Mode::Argument;
             }
-            else if (mode == "none") {
-                mode = "command";
+            else if (mode == Mode::None) {
+                mode = Mode::Command;
             }
-            else if (mode == "argument") {
+            else if (mode == Mode::Argument) {
                 if (!key.empty() && !value.empty()) {
                     double val = std::atof(value.c_str());
                     boost::to_upper(key);
                     Parameters[key] = val;
-                    key = "";
-                    value = "";
+                    key.clear();
+                    value.clear();
                 }
                 else {
                     throw Base::BadFormatError("Badly formatted GCode argument");
                 }
             }
-            else if (mode == "comment") {
+            else if (mode == Mode::Comment) {
                 value += gcode_part[i];
             }
             key = gcode_part[i];
         }
         else if (gcode_part[i] == '(') {
-            mode = "comment";
+            mode = Mode::Comment;
         }
         else if (gcode_part[i] == ')') {
             key = "(";
@@ -238,7 +252,7 @@ void Command::setFromGCode(const std::string& str)
         }
         else {
             // add non-ascii characters only if this is a comment
-            if (mode == "comment") {
+            if (mode == Mode::Comment) {
                 value += gcode_part[i];
             }
         }
@@ -250,9 +264,9 @@ void Command::setFromGCode(const std::string& str)
     }
 
     if (!key.empty() && !value.empty()) {
-        if ((mode == "command") || (mode == "comment")) {
+        if ((mode == Mode::Command) || (mode == Mode::Comment)) {
             std::string cmd = key + value;
-            if (mode == "command") {
+            if (mode == Mode::Command) {
                 boost::to_upper(cmd);
             }
             Name = cmd;
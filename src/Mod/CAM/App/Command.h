@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <map>
 #include <string>
 #include <variant>
@@ -67,6 +68,11 @@ public:
         int precision = 6,
         bool padzero = true
     ) const;                                // returns a GCode string representation of the command
+    void toGCode(
+        std::ostream& stream,
+        int precision = 6,
+        bool padzero = true
+    ) const;                                // writes the GCode representation to the stream
     void setFromGCode(const std::string&);  // sets the parameters from the contents of the given
                                             // GCode string
     void setFromPlacement(const Base::Placement&);  // sets the parameters from the contents of the
@@ -22,6 +22,10 @@
  ***************************************************************************/
 
 
+#include <iterator>
+#include <memory>
+#include <sstream>
+
 #include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -315,87 +319,103 @@ Base::BoundBox3d Toolpath::getBoundBox() const
 
 static void bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
 {
-    Command* cmd = new Command();
+    auto cmd = std::make_unique<Command>();
     cmd->setFromGCode(gcodestr);
     if ("G20" == cmd->Name) {
         inches = true;
-        delete cmd;
     }
     else if ("G21" == cmd->Name) {
         inches = false;
-        delete cmd;
     }
     else {
         if (inches) {
             cmd->scaleBy(25.4);
         }
-        commands.push_back(cmd);
+        commands.push_back(cmd.release());
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+// Splits the characters in [first, last) by () or G or M commands and adds the commands one
+// by one, so that a stream never has to be held in memory as a whole.
+template<typename Iterator>
+static void bulkAddCommands(Iterator first, Iterator last, std::vector<Command*>& commands)
 {
-    clear();
-
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
-    // split input string by () or G or M commands
-    std::string mode = "command";
-    std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
+    enum class Mode
+    {
+        Command,
+        Comment
+    };
+    Mode mode = Mode::Command;
     bool inches = false;
-    while (found != std::string::npos) {
-        if (str[found] == '(') {
-            // start of comment
-            if ((last > -1) && (mode == "command")) {
-                // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+    // the current command or comment, and whether one has been started at all
+    std::string gcodestr;
+    bool started = false;
+
+    for (; first != last; ++first) {
+        char c = *first;
+        if (mode == Mode::Comment) {
+            gcodestr += c;
+            if (c == ')') {
+                // end of comment
+                bulkAddCommand(gcodestr, commands, inches);
+                gcodestr.clear();
+                started = false;
+                mode = Mode::Command;
             }
-            mode = "comment";
-            last = found;
-            found = str.find_first_of(')', found + 1);
-        }
-        else if (str[found] == ')') {
-            // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
-            found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
         }
-        else if (mode == "command") {
-            // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+        else if (c == '(' || c == 'g' || c == 'G' || c == 'm' || c == 'M') {
+            // before starting a new command or a comment, add the last found command
+            if (started) {
+                bulkAddCommand(gcodestr, commands, inches);
+                gcodestr.clear();
             }
-            last = found;
-            found = str.find_first_of("(gGmM", found + 1);
+            if (c == '(') {
+                mode = Mode::Comment;
+            }
+            gcodestr += c;
+            started = true;
+        }
+        else if (started) {
+            gcodestr += c;
         }
     }
     // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
+    if (started && mode == Mode::Command) {
+        bulkAddCommand(gcodestr, commands, inches);
     }
+}
+
+void Toolpath::setFromGCode(const std::string instr)
+{
+    clear();
+    bulkAddCommands(instr.begin(), instr.end(), vpcCommands);
+    recalculate();
+}
+
+void Toolpath::setFromGCode(std::istream& stream)
+{
+    clear();
+    bulkAddCommands(
+        std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>(),
+        vpcCommands
+    );
     recalculate();
 }
 
 std::string Toolpath::toGCode() const
 {
-    std::string result;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        result += (*it)->toGCode();
-        result += "\n";
+    std::ostringstream str;
+    toGCode(str);
+    return str.str();
+}
+
+void Toolpath::toGCode(std::ostream& stream) const
+{
+    for (const Command* cmd : vpcCommands) {
+        cmd->toGCode(stream);
+        stream << '\n';
     }
-    return result;
 }
 
 void Toolpath::recalculate()  // recalculates the path cache
@@ -466,7 +486,12 @@ void Toolpath::recalculate()  // recalculates the path cache
 
 unsigned int Toolpath::getMemSize() const
 {
-    return toGCode().size();
+    // the size of toGCode() without building the whole string
+    unsigned int size = 0;
+    for (const Command* cmd : vpcCommands) {
+        size += cmd->getMemSize() + 1;
+    }
+    return size;
 }
 
 void Toolpath::setCenter(const Base::Vector3d& c)
@@ -506,10 +531,10 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
+    if (vpcCommands.empty()) {
         return;
     }
-    writer.Stream() << toGCode();
+    toGCode(writer.Stream());
 }
 
 void Toolpath::Restore(XMLReader& reader)
@@ -549,9 +574,9 @@ void Toolpath::RestoreDocFile(Base::Reader& reader)
     std::string line;
     while (std::getline(reader.getStream(), line)) {
         if (!line.empty()) {
-            Command cmd;
-            cmd.setFromGCode(line);
-            addCommandNoRecalc(cmd);
+            auto cmd = std::make_unique<Command>();
+            cmd->setFromGCode(line);
+            vpcCommands.push_back(cmd.release());
         }
     }
     recalculate();  // Only once, after all commands are loaded
@@ -63,7 +63,9 @@ public:
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
     void recalculate();                                   // recalculates the points
     void setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
+    void setFromGCode(std::istream&);      // sets the path from GCode read from the given stream
     std::string toGCode() const;           // gets a gcode string representation from the Path
+    void toGCode(std::ostream&) const;     // writes the gcode representation to the given stream
     Base::BoundBox3d getBoundBox() const;
 
     // shortcut functions
@@ -164,32 +164,26 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
 
         const Path::Command& cmd = tp.getCommand(i);
         const std::string& name = cmd.Name;
-        Base::Vector3d next = cmd.getPlacement().getPosition();
-        double a = A;
-        double b = B;
-        double c = C;
+        // the parameter names are upper case, look them up directly instead of going through
+        // getPlacement() and has(), which compute a rotation and copy the names for each command
+        const auto& params = cmd.Parameters;
+        Base::Vector3d next(cmd.getParam("X"), cmd.getParam("Y"), cmd.getParam("Z"));
+        double a = cmd.getParam("A", A);
+        double b = cmd.getParam("B", B);
+        double c = cmd.getParam("C", C);
 
         if (!absolute) {
             next = last + next;
         }
-        if (!cmd.has("X")) {
+        if (!params.contains("X")) {
             next.x = last.x;
         }
-        if (!cmd.has("Y")) {
+        if (!params.contains("Y")) {
             next.y = last.y;
         }
-        if (!cmd.has("Z")) {
+        if (!params.contains("Z")) {
             next.z = last.z;
         }
-        if (cmd.has("A")) {
-            a = cmd.getValue("A");
-        }
-        if (cmd.has("B")) {
-            b = cmd.getValue("B");
-        }
-        if (cmd.has("C")) {
-            c = cmd.getValue("C");
-        }
 
         Base::Rotation nrot = yawPitchRoll(a, b, c);
 
@@ -21,6 +21,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+
 #include <Base/Vector3D.h>
 #include <Base/Tools.h>
 
@@ -288,6 +290,28 @@ bool Voronoi::diagram_type::segmentsAreConnected(int i, int j) const
         || pointsMatch(high(segments[i]), high(segments[j]));
 }
 
+static bool pointsMatch(const Voronoi::point_type& p0, const Voronoi::point_type& p1, double scale)
+{
+    double dx = p0.x() - p1.x();
+    double dy = p0.y() - p1.y();
+    return 1e-6 > sqrt(dx * dx + dy * dy) / scale;
+}
+
+bool Voronoi::diagram_type::isBorderline(const Voronoi::diagram_type::edge_type* edge) const
+{
+    if (edge->is_linear()) {
+        return false;
+    }
+    // a curved edge is formed by a point and a segment, it touches the border if the point is
+    // one of the end points of the segment
+    const cell_type* pointCell = edge->cell()->contains_point() ? edge->cell() : edge->twin()->cell();
+    const cell_type* segmentCell = edge->cell()->contains_point() ? edge->twin()->cell()
+                                                                    : edge->cell();
+    point_type point = retrievePoint(pointCell);
+    segment_type segment = retrieveSegment(segmentCell);
+    return pointsMatch(point, low(segment), scale) || pointsMatch(point, high(segment), scale);
+}
+
 void Voronoi::colorColinear(Voronoi::color_type color, double degree)
 {
     using std::numbers::pi;
@@ -318,6 +342,111 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree)
     }
 }
 
+void Voronoi::colorSecondary(Voronoi::color_type color)
+{
+    for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (it->is_secondary()) {
+            it->color(color);
+        }
+    }
+}
+
+void Voronoi::colorBorderline(Voronoi::color_type color)
+{
+    for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (it->is_primary() && vd->isBorderline(&(*it))) {
+            it->color(color);
+        }
+    }
+}
+
+std::vector<Voronoi::wire_type> Voronoi::collectWires(Voronoi::color_type color) const
+{
+    using edge_type = diagram_type::edge_type;
+    using vertex_type = diagram_type::vertex_type;
+
+    // the edges at each vertex, the vertices are kept in the order they are first seen
+    std::map<const vertex_type*, std::size_t> slots;
+    std::vector<const vertex_type*> vertices;
+    std::vector<std::vector<const edge_type*>> incident;
+    auto addIncident = [&](const vertex_type* v, const edge_type* e) {
+        auto it = slots.emplace(v, vertices.size()).first;
+        if (it->second == vertices.size()) {
+            vertices.push_back(v);
+            incident.emplace_back();
+        }
+        incident[it->second].push_back(e);
+    };
+    for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (it->color() == color && it->is_finite()) {
+            addIncident(it->vertex0(), &(*it));
+            addIncident(it->vertex1(), &(*it));
+        }
+    }
+
+    // knots are the start and end points of a wire
+    std::vector<std::size_t> knots;
+    for (std::size_t i = 0; i < incident.size(); ++i) {
+        if (incident[i].size() == 1) {
+            knots.push_back(i);
+        }
+    }
+    for (std::size_t i = 0; i < incident.size(); ++i) {
+        if (incident[i].size() > 2) {
+            knots.push_back(i);
+        }
+    }
+    if (knots.empty() && !incident.empty()) {
+        // only closed loops
+        knots.push_back(0);
+    }
+
+    // removes the edge from the vertex and returns true if no other edge is left
+    auto consume = [&](std::size_t v, const edge_type* e) {
+        auto& edges = incident[v];
+        edges.erase(std::remove(edges.begin(), edges.end(), e), edges.end());
+        return edges.empty();
+    };
+
+    std::vector<wire_type> wires;
+    while (!knots.empty()) {
+        std::size_t first = knots.front();
+        std::size_t last = first;
+        if (!incident[first].empty()) {
+            wire_type wire;
+            std::size_t start = first;
+            bool done = false;
+            while (!done) {
+                last = start;
+                if (incident[start].empty()) {
+                    break;
+                }
+                const edge_type* edge = incident[start].front();
+                std::size_t end = 0;
+                if (vertices[start] == edge->vertex0()) {
+                    end = slots[edge->vertex1()];
+                    wire.push_back(edge);
+                }
+                else {
+                    end = slots[edge->vertex0()];
+                    wire.push_back(edge->twin());
+                }
+                consume(start, edge);
+                done = consume(end, edge);
+                start = end;
+            }
+            wires.push_back(std::move(wire));
+        }
+        if (incident[first].empty()) {
+            knots.erase(std::remove(knots.begin(), knots.end(), first), knots.end());
+        }
+        if (incident[last].empty()) {
+            knots.erase(std::remove(knots.begin(), knots.end(), last), knots.end());
+        }
+    }
+    return wires;
+}
+
 void Voronoi::resetColor(Voronoi::color_type color)
 {
     for (auto it = vd->cells().begin(); it != vd->cells().end(); ++it) {
@@ -87,6 +87,7 @@ public:
         using angle_map_t = std::map<int, double>;
         double angleOfSegment(int i, angle_map_t* angle = nullptr) const;
         bool segmentsAreConnected(int i, int j) const;
+        bool isBorderline(const edge_type* edge) const;
 
     private:
         double scale;
@@ -109,6 +110,14 @@ public:
     void colorExterior(color_type color);
     void colorTwins(color_type color);
     void colorColinear(color_type color, double degree);
+    void colorSecondary(color_type color);
+    void colorBorderline(color_type color);
+
+    using wire_type = std::vector<const diagram_type::edge_type*>;
+    /** Returns the chains of finite edges with the given color. A chain ends where the number of
+     *  edges meeting at a vertex differs from 2, the edges of a chain are oriented along it.
+     */
+    std::vector<wire_type> collectWires(color_type color) const;
 
     template<typename T>
     T* create(int index)
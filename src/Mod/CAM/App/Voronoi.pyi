@@ -60,6 +60,19 @@ class Voronoi(BaseClass):
         """assign given color to all edges sourced by two segments almost in line with each other (optional angle in degrees)"""
         ...
 
+    def colorSecondary(self) -> Any:
+        """assign given color to all secondary edges"""
+        ...
+
+    def colorBorderline(self) -> Any:
+        """assign given color to all primary curved edges whose point lies on the end of their segment"""
+        ...
+
+    @constmethod
+    def getWires(self) -> Any:
+        """Get list of wires, each a list of connected edges with the given color (default 0) oriented along the wire"""
+        ...
+
     def resetColor(self) -> Any:
         """assign color 0 to all elements with the given color"""
         ...
@@ -452,16 +452,8 @@ PyObject* VoronoiEdgePy::isBorderline(PyObject* args) const
 {
     VoronoiEdge* e = getVoronoiEdgeFromPy(this, args);
     PyObject* chk = Py_False;
-    if (e->isBound() && !e->ptr->is_linear()) {
-        Voronoi::point_type point = e->ptr->cell()->contains_point()
-            ? e->dia->retrievePoint(e->ptr->cell())
-            : e->dia->retrievePoint(e->ptr->twin()->cell());
-        Voronoi::segment_type segment = e->ptr->cell()->contains_point()
-            ? e->dia->retrieveSegment(e->ptr->twin()->cell())
-            : e->dia->retrieveSegment(e->ptr->cell());
-        if (isPointOnSegment(point, segment, e->dia->getScale())) {
-            chk = Py_True;
-        }
+    if (e->isBound() && e->dia->isBorderline(e->ptr)) {
+        chk = Py_True;
     }
     Py_INCREF(chk);
     return chk;
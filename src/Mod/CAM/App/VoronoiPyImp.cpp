@@ -288,6 +288,48 @@ PyObject* VoronoiPy::colorColinear(PyObject* args)
     return Py_None;
 }
 
+PyObject* VoronoiPy::colorSecondary(PyObject* args)
+{
+    Voronoi::color_type color = 0;
+    if (!PyArg_ParseTuple(args, "k", &color)) {
+        throw Py::RuntimeError("colorSecondary requires an integer (color) argument");
+    }
+    getVoronoiPtr()->colorSecondary(color);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyObject* VoronoiPy::colorBorderline(PyObject* args)
+{
+    Voronoi::color_type color = 0;
+    if (!PyArg_ParseTuple(args, "k", &color)) {
+        throw Py::RuntimeError("colorBorderline requires an integer (color) argument");
+    }
+    getVoronoiPtr()->colorBorderline(color);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyObject* VoronoiPy::getWires(PyObject* args) const
+{
+    Voronoi::color_type color = 0;
+    if (!PyArg_ParseTuple(args, "|k", &color)) {
+        throw Py::RuntimeError("Optional color argument (int) accepted");
+    }
+    Voronoi* vo = getVoronoiPtr();
+    Py::List wires;
+    for (const auto& wire : vo->collectWires(color)) {
+        Py::List edges;
+        for (auto edge : wire) {
+            edges.append(Py::asObject(new VoronoiEdgePy(new VoronoiEdge(vo->vd, edge))));
+        }
+        wires.append(edges);
+    }
+    return Py::new_reference_to(wires);
+}
+
 PyObject* VoronoiPy::resetColor(PyObject* args)
 {
     Voronoi::color_type color = 0;
@@ -26,6 +26,8 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <tuple>
 #include <Base/Precision.h>
 
 namespace
@@ -64,26 +66,322 @@ double distSquared(const TSPPoint& a, const TSPPoint& b)
     return dx * dx + dy * dy;
 }
 
+/**
+ * @brief Optional wall clock limit for the improvement steps
+ *
+ * A limit of zero or less means the optimization runs until no further improvement is found.
+ */
+class Deadline
+{
+public:
+    explicit Deadline(double seconds)
+        : limited(seconds > 0.0)
+        , end(
+              std::chrono::steady_clock::now()
+              + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  std::chrono::duration<double>(limited ? seconds : 0.0)
+              )
+          )
+    {}
+
+    bool expired() const
+    {
+        return limited && std::chrono::steady_clock::now() >= end;
+    }
+
+private:
+    bool limited;
+    std::chrono::steady_clock::time_point end;
+};
+
+/**
+ * @brief Uniform bucket grid for nearest neighbor queries
+ *
+ * The points are sorted into square cells of roughly two points each. Queries walk the cells in
+ * rings of growing size around the query location and stop as soon as no closer point can
+ * follow, so a query only looks at the points in its neighborhood instead of all of them.
+ * Points can be removed once they are visited.
+ */
+class PointGrid
+{
+public:
+    explicit PointGrid(const std::vector<TSPPoint>& pts)
+        : points(pts)
+        , cellOf(pts.size())
+        , slotInCell(pts.size())
+        , slotInAlive(pts.size())
+    {
+        if (points.empty()) {
+            return;
+        }
+
+        double maxX = points[0].x;
+        double maxY = points[0].y;
+        minX = maxX;
+        minY = maxY;
+        for (const auto& p : points) {
+            minX = std::min(minX, p.x);
+            minY = std::min(minY, p.y);
+            maxX = std::max(maxX, p.x);
+            maxY = std::max(maxY, p.y);
+        }
+
+        double width = maxX - minX;
+        double height = maxY - minY;
+        double count = static_cast<double>(points.size());
+        cellSize = std::max(
+            std::sqrt(2.0 * width * height / count),
+            2.0 * std::max(width, height) / count
+        );
+        if (!(cellSize > 0.0)) {
+            cellSize = 1.0;
+        }
+        nx = static_cast<int>(width / cellSize) + 1;
+        ny = static_cast<int>(height / cellSize) + 1;
+        cells.resize(static_cast<size_t>(nx) * static_cast<size_t>(ny));
+
+        alive.reserve(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            int id = static_cast<int>(i);
+            size_t cell = static_cast<size_t>(cellY(points[i].y)) * nx + cellX(points[i].x);
+            cellOf[i] = cell;
+            slotInCell[i] = cells[cell].size();
+            cells[cell].push_back(id);
+            slotInAlive[i] = alive.size();
+            alive.push_back(id);
+        }
+    }
+
+    /**
+     * @brief Number of points not removed yet
+     */
+    size_t size() const
+    {
+        return alive.size();
+    }
+
+    /**
+     * @brief Remove a point so that it no longer shows up in queries
+     */
+    void remove(int id)
+    {
+        auto& cell = cells[cellOf[id]];
+        int moved = cell.back();
+        cell[slotInCell[id]] = moved;
+        slotInCell[moved] = slotInCell[id];
+        cell.pop_back();
+
+        moved = alive.back();
+        alive[slotInAlive[id]] = moved;
+        slotInAlive[moved] = slotInAlive[id];
+        alive.pop_back();
+    }
+
+    /**
+     * @brief Find the remaining points closest to a location
+     *
+     * Collects every remaining point whose squared distance to @p p is at most the smallest one
+     * plus @p slack, so that callers can apply their own tie-breaking.
+     *
+     * @param p Query location, may lie outside of the grid
+     * @param slack Tolerance added to the smallest squared distance
+     * @param result Pairs of squared distance and point index, sorted by point index
+     */
+    void nearest(const TSPPoint& p, double slack, std::vector<std::pair<double, int>>& result) const
+    {
+        result.clear();
+        double best = std::numeric_limits<double>::max();
+        auto consider = [&](int id) {
+            double d = distSquared(p, points[id]);
+            if (d <= best + slack) {
+                best = std::min(best, d);
+                result.emplace_back(d, id);
+            }
+        };
+
+        int cx = cellX(p.x);
+        int cy = cellY(p.y);
+        size_t visited = 0;
+        for (int r = firstRing(cx, cy), last = lastRing(cx, cy); r <= last; ++r) {
+            double gap = std::max(0, r - 1) * cellSize;
+            if (!result.empty() && gap * gap > best + slack) {
+                break;
+            }
+            if (visited > alive.size()) {
+                // Mostly empty cells around here, checking the remaining points directly is cheaper
+                result.clear();
+                best = std::numeric_limits<double>::max();
+                for (int id : alive) {
+                    consider(id);
+                }
+                break;
+            }
+            visited += visitRing(cx, cy, r, consider);
+        }
+
+        result.erase(
+            std::remove_if(
+                result.begin(),
+                result.end(),
+                [&](const std::pair<double, int>& entry) { return entry.first > best + slack; }
+            ),
+            result.end()
+        );
+        std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+            return a.second < b.second;
+        });
+    }
+
+    /**
+     * @brief The @p k remaining points closest to point @p id, closest first
+     */
+    std::vector<int> kNearest(int id, size_t k) const
+    {
+        std::vector<std::pair<double, int>> found;
+        auto consider = [&](int other) {
+            if (other != id) {
+                found.emplace_back(distSquared(points[id], points[other]), other);
+            }
+        };
+
+        int cx = cellX(points[id].x);
+        int cy = cellY(points[id].y);
+        for (int r = 0, last = lastRing(cx, cy); r <= last; ++r) {
+            if (found.size() >= k) {
+                std::nth_element(found.begin(), found.begin() + (k - 1), found.end());
+                double gap = (r - 1) * cellSize;
+                if (gap * gap > found[k - 1].first) {
+                    break;
+                }
+            }
+            visitRing(cx, cy, r, consider);
+        }
+
+        size_t count = std::min(k, found.size());
+        std::partial_sort(found.begin(), found.begin() + count, found.end());
+        std::vector<int> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            result.push_back(found[i].second);
+        }
+        return result;
+    }
+
+private:
+    int cellIndex(double value, double origin) const
+    {
+        // Clamp before the conversion, query locations may lie far outside of the grid
+        double cell = std::floor((value - origin) / cellSize);
+        return static_cast<int>(std::clamp(cell, -1.0e9, 1.0e9));
+    }
+    int cellX(double x) const
+    {
+        return std::min(cellIndex(x, minX), nx - 1);
+    }
+    int cellY(double y) const
+    {
+        return std::min(cellIndex(y, minY), ny - 1);
+    }
+
+    // The first ring around cell (cx, cy) that touches the grid
+    int firstRing(int cx, int cy) const
+    {
+        return std::max({0, -cx, cx - (nx - 1), -cy, cy - (ny - 1)});
+    }
+    // The ring around cell (cx, cy) that covers the whole grid
+    int lastRing(int cx, int cy) const
+    {
+        return std::max({cx, nx - 1 - cx, cy, ny - 1 - cy});
+    }
+
+    // Calls func for each point in the cells at Chebyshev distance r from (cx, cy), returns the
+    // number of cells visited
+    template<typename Func>
+    size_t visitRing(int cx, int cy, int r, Func& func) const
+    {
+        size_t visited = 0;
+        auto visitCell = [&](int x, int y) {
+            ++visited;
+            for (int id : cells[static_cast<size_t>(y) * nx + x]) {
+                func(id);
+            }
+        };
+
+        int x0 = std::max(cx - r, 0);
+        int x1 = std::min(cx + r, nx - 1);
+        int y0 = std::max(cy - r, 0);
+        int y1 = std::min(cy + r, ny - 1);
+        if (x0 > x1 || y0 > y1) {
+            return visited;
+        }
+        if (r == 0) {
+            visitCell(cx, cy);
+            return visited;
+        }
+        for (int x = x0; x <= x1; ++x) {
+            if (cy - r >= 0) {
+                visitCell(x, cy - r);
+            }
+            if (cy + r < ny) {
+                visitCell(x, cy + r);
+            }
+        }
+        for (int y = std::max(cy - r + 1, 0); y <= std::min(cy + r - 1, ny - 1); ++y) {
+            if (cx - r >= 0) {
+                visitCell(cx - r, y);
+            }
+            if (cx + r < nx) {
+                visitCell(cx + r, y);
+            }
+        }
+        return visited;
+    }
+
+    const std::vector<TSPPoint>& points;
+    double minX = 0.0;
+    double minY = 0.0;
+    double cellSize = 1.0;
+    int nx = 0;
+    int ny = 0;
+    std::vector<std::vector<int>> cells;
+    std::vector<size_t> cellOf;
+    std::vector<size_t> slotInCell;
+    std::vector<int> alive;
+    std::vector<size_t> slotInAlive;
+};
+
+/**
+ * @brief Number of nearest neighbors that are considered as new successors in the improvement
+ * steps. Moves that would connect a point to one farther away rarely shorten the route.
+ */
+constexpr size_t neighborCount = 10;
+
 /**
  * @brief Core TSP solver implementation using nearest neighbor + iterative improvement
  *
  * Algorithm steps:
  * 1. Add temporary start/end points if specified
  * 2. Build initial route using nearest neighbor heuristic
- * 3. Optimize route with 2-opt and relocation moves
+ * 3. Optimize route with 2-opt, Or-opt and tail moves restricted to neighbor lists
  * 4. Remove temporary points and map back to original indices
  *
  * @param points Input points to visit
  * @param startPoint Optional starting location constraint
  * @param endPoint Optional ending location constraint
+ * @param timeLimit Time budget in seconds for step 3, no limit if zero
  * @return Vector of indices representing optimized visit order
  */
 std::vector<int> solve_impl(
     const std::vector<TSPPoint>& points,
     const TSPPoint* startPoint,
-    const TSPPoint* endPoint
+    const TSPPoint* endPoint,
+    double timeLimit
 )
 {
+    if (points.empty()) {
+        return {};
+    }
+
     // ========================================================================
     // STEP 1: Prepare point set with temporary start/end markers
     // ========================================================================
@@ -97,7 +395,7 @@ std::vector<int> solve_impl(
         pts.insert(pts.begin(), TSPPoint(startPoint->x, startPoint->y));
         tempStartIdx = 0;
     }
-    else if (!pts.empty()) {
+    else {
         // No start specified: duplicate first point as anchor
         pts.insert(pts.begin(), TSPPoint(pts[0].x, pts[0].y));
         tempStartIdx = 0;
@@ -109,230 +407,259 @@ std::vector<int> solve_impl(
         tempEndIdx = static_cast<int>(pts.size()) - 1;
     }
 
+    // The neighbor lists for step 3, closest first. The temporary start and end points are
+    // always included, moves towards them matter even when they are far away.
+    PointGrid grid(pts);
+    std::vector<std::vector<int>> neighbors(pts.size());
+    for (size_t i = 0; i < pts.size(); ++i) {
+        int node = static_cast<int>(i);
+        auto& list = neighbors[i];
+        list = grid.kNearest(node, neighborCount);
+        for (int anchor : {tempStartIdx, tempEndIdx}) {
+            if (anchor == -1 || anchor == node
+                || std::find(list.begin(), list.end(), anchor) != list.end()) {
+                continue;
+            }
+            double d = distSquared(pts[node], pts[anchor]);
+            auto it = std::find_if(list.begin(), list.end(), [&](int other) {
+                return distSquared(pts[node], pts[other]) > d;
+            });
+            list.insert(it, anchor);
+        }
+    }
+
     // ========================================================================
     // STEP 2: Build initial route using Nearest Neighbor algorithm
     // ========================================================================
     // Greedy approach: always visit the closest unvisited point next.
-    // This gives a decent initial solution quickly (O(n²) complexity).
+    // The grid only hands out the unvisited points near the current one, which
+    // keeps this step close to linear for evenly spread points.
     //
     // Tie-breaking rule:
     // - If distances are within ±0.1, prefer point with y-value closer to start
     // - This provides deterministic results when points are nearly equidistant
+    //
+    // The temporary end point is only appended once all other points are visited.
     std::vector<int> route;
-    std::vector<bool> visited(pts.size(), false);
+    route.reserve(pts.size());
     route.push_back(0);  // Start from temp start point (index 0)
-    visited[0] = true;
+    grid.remove(0);
+    if (tempEndIdx != -1) {
+        grid.remove(tempEndIdx);
+    }
 
-    for (size_t step = 1; step < pts.size(); ++step) {
+    std::vector<std::pair<double, int>> candidates;
+    while (grid.size() > 0) {
         double minDist = std::numeric_limits<double>::max();
         int next = -1;
         double nextYDiff = std::numeric_limits<double>::max();
 
-        // Find nearest unvisited neighbor
-        for (size_t i = 0; i < pts.size(); ++i) {
-            if (!visited[i]) {
-                // Use squared distance for speed (no sqrt needed for comparison)
-                double d = distSquared(pts[route.back()], pts[i]);
-                double yDiff = std::abs(pts[route.front()].y - pts[i].y);
+        // Candidates are the unvisited points within the tie tolerance of the nearest one
+        grid.nearest(pts[route.back()], 0.1, candidates);
+        for (const auto& [d, i] : candidates) {
+            double yDiff = std::abs(pts[route.front()].y - pts[i].y);
 
-                // Tie-breaking logic:
-                if (d > minDist + 0.1) {
-                    continue;  // Clearly farther, skip
-                }
-                else if (d < minDist - 0.1) {
-                    // Clearly closer, use it
-                    minDist = d;
-                    next = static_cast<int>(i);
-                    nextYDiff = yDiff;
-                }
-                else if (yDiff < nextYDiff) {
-                    // Tie: prefer point closer to start in Y-axis
-                    minDist = d;
-                    next = static_cast<int>(i);
-                    nextYDiff = yDiff;
-                }
+            // Tie-breaking logic:
+            if (d > minDist + 0.1) {
+                continue;  // Clearly farther, skip
+            }
+            else if (d < minDist - 0.1) {
+                // Clearly closer, use it
+                minDist = d;
+                next = i;
+                nextYDiff = yDiff;
+            }
+            else if (yDiff < nextYDiff) {
+                // Tie: prefer point closer to start in Y-axis
+                minDist = d;
+                next = i;
+                nextYDiff = yDiff;
             }
         }
 
-        if (next == -1) {
-            break;  // No more unvisited points
-        }
         route.push_back(next);
-        visited[next] = true;
+        grid.remove(next);
     }
 
-    // Ensure temporary end point is at the end of route
-    if (tempEndIdx != -1 && route.back() != tempEndIdx) {
-        auto it = std::find(route.begin(), route.end(), tempEndIdx);
-        if (it != route.end()) {
-            route.erase(it);
-        }
+    if (tempEndIdx != -1) {
         route.push_back(tempEndIdx);
     }
 
     // ========================================================================
-    // STEP 3: Iterative improvement using 2-Opt and Relocation
+    // STEP 3: Iterative improvement using 2-Opt and Or-Opt
     // ========================================================================
-    // Repeatedly apply local optimizations until no improvement is possible.
-    // This typically converges quickly (a few iterations) to a near-optimal solution.
+    // Repeatedly apply local optimizations until no improvement is possible
+    // or the time budget is used up.
     //
     // Two optimization techniques:
     // 1. 2-Opt: Reverse segments of the route to eliminate crossing paths
-    // 2. Relocation: Move individual points to better positions in the route
+    // 2. Or-Opt: Move chains of up to three points, possibly reversed, to a
+    //    better position in the route (a chain of one is a plain relocation)
     //
-    // For open routes (no endPoint), additional optimizations are applied that
-    // allow reversing/relocating segments to the end of the route.
-    size_t limitReorderI = route.size() - 2;
-    if (tempEndIdx != -1) {
-        limitReorderI -= 1;
-    }
-    size_t limitReorderJ = route.size();
-    size_t limitRelocationI = route.size() - 1;
-    size_t limitRelocationJ = route.size() - 1;
-    int lastImprovementAtStep = 0;
+    // Instead of trying all pairs of positions, a move is only tried if it
+    // connects a point to one of its nearest neighbors. The first point (temp
+    // start) never moves; without an end constraint the route end is open, so
+    // segments may be reversed up to or moved to the end of the route.
+    const size_t n = route.size();
+    const size_t lastMovable = tempEndIdx != -1 ? n - 2 : n - 1;
+    std::vector<size_t> pos(pts.size());
+    auto updatePositions = [&](size_t from, size_t to) {
+        for (size_t k = from; k <= to; ++k) {
+            pos[route[k]] = k;
+        }
+    };
+    updatePositions(0, n - 1);
 
-    while (true) {
+    auto d = [&](int a, int b) {
+        return dist(pts[a], pts[b]);
+    };
+    // Length of the edge leaving position i, zero past the open route end
+    auto edgeAfter = [&](size_t i) {
+        return i + 1 < n ? d(route[i], route[i + 1]) : 0.0;
+    };
 
-        // --- 2-Opt Optimization ---
-        // Try reversing every possible segment of the route.
-        // If reversing segment [i+1...j-1] reduces total distance, keep it.
-        //
-        // Example: Route A-B-C-D-E becomes A-D-C-B-E if reversing B-C-D is better
-        if (lastImprovementAtStep == 1) {
-            break;
+    // Replace the edges leaving positions i and j (i < j) by reversing the points between them
+    auto tryTwoOpt = [&](size_t i, size_t j) {
+        if (j <= i + 1 || j > lastMovable) {
+            return false;
         }
-        bool reorderFound = true;
-        while (reorderFound) {
-            reorderFound = false;
-            for (size_t i = 0; i < limitReorderI; ++i) {
-                double subRouteLengthCurrentPart = dist(pts[route[i]], pts[route[i + 1]]);
-
-                for (size_t j = i + 3; j < limitReorderJ; ++j) {
-                    // Current edges: i→(i+1) and (j-1)→j
-                    double curLen = subRouteLengthCurrentPart
-                        + dist(pts[route[j - 1]], pts[route[j]]);
-
-                    // New edges after reversal: (i+1)→j and i→(j-1)
-                    // Add epsilon to prevent cycles from floating point errors
-                    double newLen = dist(pts[route[i + 1]], pts[route[j]])
-                        + dist(pts[route[i]], pts[route[j - 1]]) + Base::Precision::Confusion();
-
-                    if (newLen < curLen) {
-                        // Reverse the segment between i+1 and j (exclusive)
-                        std::reverse(route.begin() + i + 1, route.begin() + j);
-                        subRouteLengthCurrentPart = dist(pts[route[i]], pts[route[i + 1]]);
-                        reorderFound = true;
-                        lastImprovementAtStep = 1;
-                    }
-                }
+        double curLen = edgeAfter(i) + edgeAfter(j);
+        double newLen = d(route[i], route[j]) + Base::Precision::Confusion();
+        if (j + 1 < n) {
+            newLen += d(route[i + 1], route[j + 1]);
+        }
+        if (newLen < curLen) {
+            std::reverse(route.begin() + i + 1, route.begin() + j + 1);
+            updatePositions(i + 1, j);
+            return true;
+        }
+        return false;
+    };
 
-                // Open route optimization: can reverse from i to end if no endpoint constraint
-                if (tempEndIdx == -1) {
-                    double curLen = dist(pts[route[i]], pts[route[i + 1]]);
-                    double newLen = dist(pts[route[i]], pts[route[limitReorderJ - 1]])
-                        + Base::Precision::Confusion();
-
-                    if (newLen < curLen) {
-                        // Reverse the order of points after i-th to the last point
-                        std::reverse(route.begin() + i + 1, route.begin() + limitReorderJ);
-                        reorderFound = true;
-                        lastImprovementAtStep = 1;
-                    }
-                }
-            }
+    // Move the chain at positions [s, e] between the points at positions t and t + 1. The
+    // chain end that becomes adjacent to the point at t is first.
+    auto tryOrOpt = [&](size_t s, size_t e, size_t t, int first, int last, double removeGain) {
+        if (t + 1 >= s && t <= e) {
+            return false;  // Not a new position
+        }
+        if (tempEndIdx != -1 && t + 1 >= n) {
+            return false;  // Nothing may follow the end point
+        }
+        double addCost = d(route[t], first) + Base::Precision::Confusion();
+        if (t + 1 < n) {
+            addCost += d(last, route[t + 1]) - d(route[t], route[t + 1]);
+        }
+        if (addCost >= removeGain) {
+            return false;
         }
 
-        // --- Relocation Optimization ---
-        // Try moving each point to a different position in the route.
-        // If moving point i to position j improves the route, do it.
-        if (lastImprovementAtStep == 2) {
-            break;
+        std::vector<int> chain(route.begin() + s, route.begin() + e + 1);
+        if (chain.front() != first) {
+            std::reverse(chain.begin(), chain.end());
         }
-        bool relocateFound = true;
-        while (relocateFound) {
-            relocateFound = false;
-            for (size_t i = 1; i < limitRelocationI; ++i) {
-                double subRouteLengthCurrentPart = dist(pts[route[i - 1]], pts[route[i]])
-                    + dist(pts[route[i]], pts[route[i + 1]]);
-                double subRouteLengthNewPart = dist(pts[route[i - 1]], pts[route[i + 1]])
-                    + Base::Precision::Confusion();
+        route.erase(route.begin() + s, route.begin() + e + 1);
+        size_t insertAt = t < s ? t + 1 : t + 1 - chain.size();
+        route.insert(route.begin() + insertAt, chain.begin(), chain.end());
+        updatePositions(std::min(s, insertAt), std::max(e, insertAt + chain.size() - 1));
+        return true;
+    };
 
-                // Try moving point i backward (to positions before i)
-                for (size_t j = 0; j + 2 < i; ++j) {
-                    // Current cost: edges around point i and edge j→(j+1)
-                    double curLen = subRouteLengthCurrentPart
-                        + dist(pts[route[j]], pts[route[j + 1]]);
+    // Move the tail from position k up to the last movable point between the points at
+    // positions t and t + 1 (t + 1 < k), reversed if its last point becomes adjacent to the point
+    // at t. A temporary end point stays in place and follows the point before the tail.
+    auto tryTailMove = [&](size_t t, size_t k, bool reversed) {
+        if (t + 1 >= k || k > lastMovable) {
+            return false;
+        }
+        int head = route[k];
+        int tail = route[lastMovable];
+        double curLen = edgeAfter(t) + edgeAfter(k - 1) + edgeAfter(lastMovable);
+        double newLen = reversed ? d(route[t], tail) + d(head, route[t + 1])
+                                 : d(route[t], head) + d(tail, route[t + 1]);
+        if (lastMovable + 1 < n) {
+            newLen += d(route[k - 1], route[n - 1]);
+        }
+        if (newLen + Base::Precision::Confusion() < curLen) {
+            auto last = route.begin() + lastMovable + 1;
+            if (reversed) {
+                std::reverse(route.begin() + k, last);
+            }
+            std::rotate(route.begin() + t + 1, route.begin() + k, last);
+            updatePositions(t + 1, lastMovable);
+            return true;
+        }
+        return false;
+    };
 
-                    // New cost: bypass i, insert i after j
-                    double newLen = subRouteLengthNewPart + dist(pts[route[j]], pts[route[i]])
-                        + dist(pts[route[i]], pts[route[j + 1]]);
+    Deadline deadline(timeLimit);
+    bool improved = true;
+    while (improved && !deadline.expired()) {
+        improved = false;
 
-                    if (newLen < curLen) {
-                        // Move point i to position after j
-                        int node = route[i];
-                        route.erase(route.begin() + i);
-                        route.insert(route.begin() + j + 1, node);
-                        subRouteLengthCurrentPart = dist(pts[route[i - 1]], pts[route[i]])
-                            + dist(pts[route[i]], pts[route[i + 1]]);
-                        subRouteLengthNewPart = dist(pts[route[i - 1]], pts[route[i + 1]])
-                            + Base::Precision::Confusion();
-                        relocateFound = true;
-                        lastImprovementAtStep = 2;
-                    }
+        // --- 2-Opt Optimization ---
+        // For point a, try a neighbor c as new successor (reverse from a's
+        // successor up to c) or as new predecessor (reverse from c up to a's
+        // predecessor). Also try moving the tail of the route starting at c
+        // next to a. Neighbors are sorted, so once the new edge is not
+        // shorter than the removed one no later neighbor can do better.
+        for (size_t a = 0; a < pts.size() && !deadline.expired(); ++a) {
+            int node = static_cast<int>(a);
+            for (int c : neighbors[a]) {
+                size_t pa = pos[node];
+                size_t pc = pos[c];
+                double g = d(node, c);
+                bool succ = pa + 1 < n && g < edgeAfter(pa);
+                bool pred = pa > 0 && g < edgeAfter(pa - 1);
+                if (!succ && !pred) {
+                    break;
                 }
-
-                // Try moving point i forward (to positions after i)
-                for (size_t j = i + 1; j < limitRelocationJ; ++j) {
-                    double curLen = subRouteLengthCurrentPart
-                        + dist(pts[route[j]], pts[route[j + 1]]);
-
-                    double newLen = subRouteLengthNewPart + dist(pts[route[j]], pts[route[i]])
-                        + dist(pts[route[i]], pts[route[j + 1]]);
-
-                    if (newLen < curLen) {
-                        int node = route[i];
-                        route.erase(route.begin() + i);
-                        route.insert(route.begin() + j, node);
-                        subRouteLengthCurrentPart = dist(pts[route[i - 1]], pts[route[i]])
-                            + dist(pts[route[i]], pts[route[i + 1]]);
-                        subRouteLengthNewPart = dist(pts[route[i - 1]], pts[route[i + 1]])
-                            + Base::Precision::Confusion();
-                        relocateFound = true;
-                        lastImprovementAtStep = 2;
-                    }
+                if ((succ && tryTwoOpt(std::min(pa, pc), std::max(pa, pc)))
+                    || (pred && pc > 0 && tryTwoOpt(std::min(pa, pc) - 1, std::max(pa, pc) - 1))
+                    || (succ && tryTailMove(pa, pc, false))
+                    || (pred && tryTailMove(pa - 1, pc, true))) {
+                    improved = true;
                 }
             }
+        }
 
-            // Open route optimization: can relocate the last point anywhere
-            if (tempEndIdx == -1) {
-                double subRouteLengthCurrentPart
-                    = dist(pts[route[route.size() - 2]], pts[route[route.size() - 1]]);
-
-                for (size_t j = 0; j + 2 < route.size(); ++j) {
-                    double curLen = subRouteLengthCurrentPart
-                        + dist(pts[route[j]], pts[route[j + 1]]);
-
-                    double newLen = dist(pts[route[j]], pts[route[route.size() - 1]])
-                        + dist(pts[route[route.size() - 1]], pts[route[j + 1]])
-                        + Base::Precision::Confusion();
+        // --- Or-Opt Optimization ---
+        // Try moving chains of one to three points next to a neighbor of
+        // either chain end.
+        for (size_t length = 1; length <= 3; ++length) {
+            for (size_t s = 1; s + length - 1 <= lastMovable && !deadline.expired(); ++s) {
+                size_t e = s + length - 1;
+                int first = route[s];
+                int last = route[e];
+                double removeGain = d(route[s - 1], first);
+                if (e + 1 < n) {
+                    removeGain += d(last, route[e + 1]) - d(route[s - 1], route[e + 1]);
+                }
+                if (removeGain <= Base::Precision::Confusion()) {
+                    continue;
+                }
 
-                    if (newLen < curLen) {
-                        // Relocate the last point after j-th point
-                        int node = route[route.size() - 1];
-                        route.erase(route.begin() + route.size() - 1);
-                        route.insert(route.begin() + j + 1, node);
-                        subRouteLengthCurrentPart
-                            = dist(pts[route[route.size() - 2]], pts[route[route.size() - 1]]);
-                        relocateFound = true;
-                        lastImprovementAtStep = 2;
+                bool moved = false;
+                for (int end : {first, last}) {
+                    int other = end == first ? last : first;
+                    for (int c : neighbors[end]) {
+                        if (d(end, c) >= removeGain) {
+                            break;
+                        }
+                        size_t pc = pos[c];
+                        // c right before the chain, or right after it
+                        if (tryOrOpt(s, e, pc, end, other, removeGain)
+                            || (pc > 0 && tryOrOpt(s, e, pc - 1, other, end, removeGain))) {
+                            moved = true;
+                            break;
+                        }
+                    }
+                    if (moved) {
+                        break;
                     }
                 }
+                improved = improved || moved;
             }
         }
-
-        if (lastImprovementAtStep == 0) {
-            break;  // No additional improvements could be made
-        }
     }
 
     // ========================================================================
@@ -375,23 +702,26 @@ std::vector<int> solve_impl(
  * - If endPoint is provided, the path will end at the point closest to endPoint
  * - If both are provided, the path will respect both constraints while optimizing the middle path
  * - The algorithm ensures all points are visited exactly once
+ * - If timeLimit is positive, the optimization stops once it has run that many seconds
  */
 
 
 std::vector<int> TSPSolver::solve(
     const std::vector<TSPPoint>& points,
     const TSPPoint* startPoint,
-    const TSPPoint* endPoint
+    const TSPPoint* endPoint,
+    double timeLimit
 )
 {
-    return solve_impl(points, startPoint, endPoint);
+    return solve_impl(points, startPoint, endPoint, timeLimit);
 }
 
 std::vector<TSPTunnel> TSPSolver::solveTunnels(
     std::vector<TSPTunnel> tunnels,
     bool allowFlipping,
     const TSPPoint* routeStartPoint,
-    const TSPPoint* routeEndPoint
+    const TSPPoint* routeEndPoint,
+    double timeLimit
 )
 {
     if (tunnels.empty()) {
@@ -415,54 +745,55 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
     }
 
     // STEP 2: Apply nearest neighbor algorithm
-    std::vector<TSPTunnel> potentialNeighbours(tunnels.begin() + 1, tunnels.end());
+    // Each tunnel is entered at its start, open tunnels also at their end if flipping is
+    // allowed. The grid holds the entry points of all tunnels not yet on the route.
+    std::vector<TSPPoint> entries;
+    std::vector<std::pair<size_t, bool>> entryTunnel;  // Tunnel index and whether it is flipped
+    std::vector<std::vector<int>> tunnelEntries(tunnels.size());
+    for (size_t i = 1; i < tunnels.size(); ++i) {
+        tunnelEntries[i].push_back(static_cast<int>(entries.size()));
+        entries.emplace_back(tunnels[i].startX, tunnels[i].startY);
+        entryTunnel.emplace_back(i, false);
+        if (allowFlipping && tunnels[i].isOpen) {
+            tunnelEntries[i].push_back(static_cast<int>(entries.size()));
+            entries.emplace_back(tunnels[i].endX, tunnels[i].endY);
+            entryTunnel.emplace_back(i, true);
+        }
+    }
+
+    PointGrid grid(entries);
     std::vector<TSPTunnel> route;
+    route.reserve(tunnels.size() + 1);
     route.push_back(tunnels[0]);
 
-    while (!potentialNeighbours.empty()) {
-        double costCurrent = std::numeric_limits<double>::max();
-        bool toBeFlipped = false;
-        auto nearestNeighbour = potentialNeighbours.begin();
-
-        // Check normal orientation
-        for (auto it = potentialNeighbours.begin(); it != potentialNeighbours.end(); ++it) {
-            double dx = route.back().endX - it->startX;
-            double dy = route.back().endY - it->startY;
-            double costNew = dx * dx + dy * dy;
-
-            if (costNew < costCurrent) {
-                costCurrent = costNew;
-                toBeFlipped = false;
-                nearestNeighbour = it;
+    std::vector<std::pair<double, int>> candidates;
+    while (grid.size() > 0) {
+        // Take the closest entry, on a tie prefer the normal orientation and then the lower index
+        grid.nearest(TSPPoint(route.back().endX, route.back().endY), 0.0, candidates);
+        auto nearestEntry = std::min_element(
+            candidates.begin(),
+            candidates.end(),
+            [&](const std::pair<double, int>& lhs, const std::pair<double, int>& rhs) {
+                const auto& [lhsIndex, lhsFlipped] = entryTunnel[lhs.second];
+                const auto& [rhsIndex, rhsFlipped] = entryTunnel[rhs.second];
+                return std::tie(lhs.first, lhsFlipped, lhsIndex)
+                    < std::tie(rhs.first, rhsFlipped, rhsIndex);
             }
-        }
-
-        // Check flipped orientation if allowed
-        if (allowFlipping) {
-            for (auto it = potentialNeighbours.begin(); it != potentialNeighbours.end(); ++it) {
-                if (it->isOpen) {
-                    double dx = route.back().endX - it->endX;
-                    double dy = route.back().endY - it->endY;
-                    double costNew = dx * dx + dy * dy;
-
-                    if (costNew < costCurrent) {
-                        costCurrent = costNew;
-                        toBeFlipped = true;
-                        nearestNeighbour = it;
-                    }
-                }
-            }
-        }
+        );
+        auto [index, toBeFlipped] = entryTunnel[nearestEntry->second];
+        TSPTunnel nearestNeighbour = tunnels[index];
 
         // Apply flipping if needed
         if (toBeFlipped) {
-            nearestNeighbour->flipped = !nearestNeighbour->flipped;
-            std::swap(nearestNeighbour->startX, nearestNeighbour->endX);
-            std::swap(nearestNeighbour->startY, nearestNeighbour->endY);
+            nearestNeighbour.flipped = !nearestNeighbour.flipped;
+            std::swap(nearestNeighbour.startX, nearestNeighbour.endX);
+            std::swap(nearestNeighbour.startY, nearestNeighbour.endY);
         }
 
-        route.push_back(*nearestNeighbour);
-        potentialNeighbours.erase(nearestNeighbour);
+        route.push_back(nearestNeighbour);
+        for (int entry : tunnelEntries[index]) {
+            grid.remove(entry);
+        }
     }
 
     // STEP 3: Add the routeEndPoint (will be deleted at the end)
@@ -482,8 +813,22 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
     size_t limitRelocationI = route.size() - 1;
     size_t limitRelocationJ = route.size() - 1;
     int lastImprovementAtStep = 0;
+    Deadline deadline(timeLimit);
 
-    while (true) {
+    // Reversing a part of the route flips its open tunnels. A closed tunnel keeps its direction,
+    // the length estimates of the 2-opt moves only hold if it ends where it starts.
+    auto canReverse = [&](size_t first, size_t last) {
+        return std::all_of(
+            route.begin() + first,
+            route.begin() + last,
+            [](const TSPTunnel& tunnel) {
+                return tunnel.isOpen
+                    || (tunnel.startX == tunnel.endX && tunnel.startY == tunnel.endY);
+            }
+        );
+    };
+
+    while (!deadline.expired()) {
 
         if (allowFlipping) {
             // STEP 4.1: Apply 2-opt
@@ -491,7 +836,7 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
                 break;
             }
             bool improvementFound = true;
-            while (improvementFound) {
+            while (improvementFound && !deadline.expired()) {
                 improvementFound = false;
                 for (size_t i = 0; i < limitReorderI; ++i) {
                     double subRouteLengthCurrentPart = std::sqrt(
@@ -514,7 +859,7 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
                         );
                         subRouteLengthNew += Base::Precision::Confusion();
 
-                        if (subRouteLengthNew < subRouteLengthCurrent) {
+                        if (subRouteLengthNew < subRouteLengthCurrent && canReverse(i + 1, j)) {
                             // Flip direction of each tunnel between i-th and j-th tunnel
                             for (size_t k = i + 1; k < j; ++k) {
                                 if (route[k].isOpen) {
@@ -543,7 +888,8 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
                             + std::pow(route[i].endY - route[route.size() - 1].endY, 2)
                         );
                         subRouteLengthNew += Base::Precision::Confusion();
-                        if (subRouteLengthNew < subRouteLengthCurrent) {
+                        if (subRouteLengthNew < subRouteLengthCurrent
+                            && canReverse(i + 1, limitReorderJ)) {
                             // Flip direction of each tunnel after i-th to the last tunnel
                             for (size_t k = i + 1; k < limitReorderJ; ++k) {
                                 if (route[k].isOpen) {
@@ -566,7 +912,7 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
                 break;
             }
             improvementFound = true;
-            while (improvementFound) {
+            while (improvementFound && !deadline.expired()) {
                 improvementFound = false;
                 for (size_t i = 1; i < limitFlipI; ++i) {
                     if (route[i].isOpen) {
@@ -628,7 +974,7 @@ std::vector<TSPTunnel> TSPSolver::solveTunnels(
             break;
         }
         bool improvementFound = true;
-        while (improvementFound) {
+        while (improvementFound && !deadline.expired()) {
             improvementFound = false;
             for (size_t i = 1; i < limitRelocationI; ++i) {
                 double subRouteLengthCurrentPart = std::sqrt(
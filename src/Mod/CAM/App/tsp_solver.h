@@ -61,10 +61,12 @@ public:
     // Returns a vector of indices representing the visit order using 2-Opt
     // If startPoint or endPoint are provided, the path will start/end at the closest point to these
     // coordinates
+    // timeLimit: optimization time budget in seconds, zero optimizes until no improvement is left
     static std::vector<int> solve(
         const std::vector<TSPPoint>& points,
         const TSPPoint* startPoint = nullptr,
-        const TSPPoint* endPoint = nullptr
+        const TSPPoint* endPoint = nullptr,
+        double timeLimit = 0.0
     );
 
     // Solves TSP for tunnels (path segments with entry/exit points)
@@ -74,6 +76,7 @@ public:
         std::vector<TSPTunnel> tunnels,
         bool allowFlipping = false,
         const TSPPoint* routeStartPoint = nullptr,
-        const TSPPoint* routeEndPoint = nullptr
+        const TSPPoint* routeEndPoint = nullptr,
+        double timeLimit = 0.0
     );
 };
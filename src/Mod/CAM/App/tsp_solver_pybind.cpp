@@ -30,7 +30,8 @@ namespace py = pybind11;
 std::vector<int> tspSolvePy(
     const std::vector<std::pair<double, double>>& points,
     const py::object& startPoint = py::none(),
-    const py::object& endPoint = py::none()
+    const py::object& endPoint = py::none(),
+    double timeLimit = 0.0
 )
 {
     std::vector<TSPPoint> pts;
@@ -94,7 +95,7 @@ std::vector<int> tspSolvePy(
         }
     }
 
-    return TSPSolver::solve(pts, pStartPoint, pEndPoint);
+    return TSPSolver::solve(pts, pStartPoint, pEndPoint, timeLimit);
 }
 
 // Python wrapper for solveTunnels function
@@ -102,7 +103,8 @@ std::vector<py::dict> tspSolveTunnelsPy(
     const std::vector<py::dict>& tunnels,
     bool allowFlipping = false,
     const py::object& routeStartPoint = py::none(),
-    const py::object& routeEndPoint = py::none()
+    const py::object& routeEndPoint = py::none(),
+    double timeLimit = 0.0
 )
 {
     std::vector<TSPTunnel> cppTunnels;
@@ -174,7 +176,13 @@ std::vector<py::dict> tspSolveTunnelsPy(
     }
 
     // Solve the tunnel TSP
-    auto result = TSPSolver::solveTunnels(cppTunnels, allowFlipping, pStartPoint, pEndPoint);
+    auto result = TSPSolver::solveTunnels(
+        cppTunnels,
+        allowFlipping,
+        pStartPoint,
+        pEndPoint,
+        timeLimit
+    );
 
     // Convert result back to Python dictionaries, preserving extra keys from input
     std::vector<py::dict> pyResult;
@@ -205,12 +213,14 @@ PYBIND11_MODULE(tsp_solver, m)
         py::arg("points"),
         py::arg("startPoint") = py::none(),
         py::arg("endPoint") = py::none(),
+        py::arg("timeLimit") = 0.0,
         "Solve TSP for a list of (x, y) points using 2-Opt, returns visit order.\n"
         "Optional arguments:\n"
         "- startPoint: Optional [x, y] point where the path should start (closest point will be "
         "chosen)\n"
         "- endPoint: Optional [x, y] point where the path should end (closest point will be "
-        "chosen)"
+        "chosen)\n"
+        "- timeLimit: Optional time budget in seconds for the optimization, 0 for no limit"
     );
 
     m.def(
@@ -220,12 +230,14 @@ PYBIND11_MODULE(tsp_solver, m)
         py::arg("allowFlipping") = false,
         py::arg("routeStartPoint") = py::none(),
         py::arg("routeEndPoint") = py::none(),
+        py::arg("timeLimit") = 0.0,
         "Solve TSP for tunnels (path segments with entry/exit points).\n"
         "Arguments:\n"
         "- tunnels: List of dictionaries with keys: startX, startY, endX, endY, isOpen (optional)\n"
         "- allowFlipping: Whether tunnels can be reversed (entry becomes exit)\n"
         "- routeStartPoint: Optional [x, y] point where route should start\n"
         "- routeEndPoint: Optional [x, y] point where route should end\n"
+        "- timeLimit: Optional time budget in seconds for the optimization, 0 for no limit\n"
         "Returns: List of tunnel dictionaries in optimized order with flipped status"
     );
 }
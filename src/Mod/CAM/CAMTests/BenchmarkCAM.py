@@ -0,0 +1,236 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+
+# ***************************************************************************
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+"""Headless benchmarks of the CAM core.
+
+Runs Area.makeSections, Area.makePocket, Adaptive2d.Execute, tsp_solver.solve and a G-code
+round trip on the DemoParts models, each scaled to several sizes, and reports the time, the peak
+resident set size and the number of elements produced. This is not part of the test suite, run
+it with:
+
+    FreeCADCmd -c "import CAMTests.BenchmarkCAM as b; b.run()"
+
+run() takes the models, scales and repeat count as arguments and writes the results as JSON when
+given an output file name, so two builds can be compared.
+"""
+
+import glob
+import json
+import os
+import platform
+import statistics
+import time
+
+import FreeCAD
+import Path
+import area
+import tsp_solver
+
+try:
+    import resource
+except ImportError:  # not available on Windows
+    resource = None
+
+
+def demoParts():
+    """Return the DemoParts models found next to the CAM sources, or in the installation."""
+    for folder in (
+        os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "DemoParts"),
+        os.path.join(FreeCAD.getHomePath(), "Mod", "CAM", "DemoParts"),
+    ):
+        models = sorted(glob.glob(os.path.join(folder, "*.fcstd")))
+        if models:
+            return models
+    return []
+
+
+def peakRSS():
+    """Return the peak resident set size of the process in MiB, or None if unknown."""
+    if resource is None:
+        return None
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS bytes
+    if platform.system() == "Darwin":
+        return peak / (1024.0 * 1024.0)
+    return peak / 1024.0
+
+
+def loadShape(fileName):
+    """Return a compound of the solids of all the top level objects of a model."""
+    import Part
+
+    doc = FreeCAD.openDocument(fileName, True)
+    try:
+        shapes = [
+            obj.Shape.copy()
+            for obj in doc.Objects
+            if not obj.InList and hasattr(obj, "Shape") and obj.Shape.Solids
+        ]
+    finally:
+        FreeCAD.closeDocument(doc.Name)
+    return Part.makeCompound(shapes)
+
+
+def timeCall(func, repeat):
+    """Call func repeat times, return the last result with the minimum and median times."""
+    times = []
+    result = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = func()
+        times.append(time.perf_counter() - start)
+    return result, min(times), statistics.median(times)
+
+
+def wires2d(shape, deflection):
+    """Discretize the wires of a planar shape into the point lists Adaptive2d expects."""
+    return [
+        [[p.x, p.y] for p in wire.discretize(Deflection=deflection)] for wire in shape.Wires
+    ]
+
+
+def benchmarkModel(shape, toolRadius, repeat):
+    """Run all the benchmarks on one shape, return a list of result dictionaries."""
+    results = []
+
+    def record(name, func, count):
+        result, best, median = timeCall(func, repeat)
+        results.append(
+            {
+                "case": name,
+                "min": best,
+                "median": median,
+                "elements": count(result),
+                "peakRSS": peakRSS(),
+            }
+        )
+        return result
+
+    bbox = shape.BoundBox
+    levels = 20
+    heights = [bbox.ZMin + (i + 0.5) * bbox.ZLength / levels for i in range(levels)]
+
+    def makeSections():
+        section = Path.Area()
+        section.add(shape)
+        return section.makeSections(mode=0, project=False, heights=heights)
+
+    sections = record("Area.makeSections", makeSections, len)
+    sections = [s for s in sections if not s.getShape().isNull()]
+    if not sections:
+        return results
+    middle = sections[len(sections) // 2]
+
+    pocket = record(
+        "Area.makePocket",
+        lambda: middle.makePocket(mode=2, tool_radius=toolRadius, stepover=toolRadius),
+        lambda s: len(s.Edges),
+    )
+
+    paths = wires2d(middle.getShape(), 0.01)
+    margin = 4 * toolRadius
+    stock = [
+        [
+            [bbox.XMin - margin, bbox.YMin - margin],
+            [bbox.XMax + margin, bbox.YMin - margin],
+            [bbox.XMax + margin, bbox.YMax + margin],
+            [bbox.XMin - margin, bbox.YMax + margin],
+        ]
+    ]
+
+    def adaptive():
+        a2d = area.Adaptive2d()
+        a2d.toolDiameter = 2 * toolRadius
+        a2d.stepOverFactor = 0.2
+        a2d.helixRampTargetDiameter = toolRadius
+        a2d.helixRampMinDiameter = 0.0
+        a2d.tolerance = 0.1
+        a2d.opType = area.AdaptiveOperationType.ClearingOutside
+        return a2d.Execute(stock, paths, [], lambda progress: False)
+
+    record(
+        "Adaptive2d.Execute",
+        adaptive,
+        lambda out: sum(len(p[1]) for r in out for p in r.AdaptivePaths),
+    )
+
+    points = [(e.Vertexes[0].Point.x, e.Vertexes[0].Point.y) for e in pocket.Edges]
+    record("tsp_solver.solve", lambda: tsp_solver.solve(points), len)
+
+    gcode = Path.fromShapes(pocket).toGCode()
+    record("G-code round trip", lambda: Path.Path(Path.Path(gcode).toGCode()), lambda p: p.Size)
+
+    return results
+
+
+def run(models=None, scales=(1, 2, 4), repeat=3, toolRadius=1.0, output=None):
+    """Benchmark each model at each scale, print a table and optionally write JSON."""
+    if models is None:
+        models = demoParts()
+    if not models:
+        FreeCAD.Console.PrintError("No models to benchmark, DemoParts not found\n")
+        return []
+
+    results = []
+    for fileName in models:
+        shape = loadShape(fileName)
+        for scale in scales:
+            scaled = shape.copy()
+            scaled.scale(scale)
+            for result in benchmarkModel(scaled, toolRadius, repeat):
+                result["model"] = os.path.basename(fileName)
+                result["scale"] = scale
+                results.append(result)
+
+    line = "{:<32} {:>5} {:<20} {:>10} {:>10} {:>10} {:>10}\n"
+    FreeCAD.Console.PrintMessage(
+        line.format("model", "scale", "case", "min s", "median s", "elements", "RSS MiB")
+    )
+    for r in results:
+        FreeCAD.Console.PrintMessage(
+            line.format(
+                r["model"],
+                r["scale"],
+                r["case"],
+                "{:.4f}".format(r["min"]),
+                "{:.4f}".format(r["median"]),
+                r["elements"],
+                "-" if r["peakRSS"] is None else "{:.1f}".format(r["peakRSS"]),
+            )
+        )
+
+    if output:
+        with open(output, "w") as f:
+            json.dump(
+                {
+                    "version": FreeCAD.Version()[:3],
+                    "repeat": repeat,
+                    "results": results,
+                },
+                f,
+                indent=2,
+            )
+    return results
+
+
+if __name__ == "__main__":
+    run()
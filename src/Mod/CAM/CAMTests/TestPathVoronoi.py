@@ -189,3 +189,38 @@ class TestPathVoronoi(PathTestUtils.PathTestBase):
         )
         self.assertRoughly(e.valueAt(e.FirstParameter).z, 2.37)
         self.assertRoughly(e.valueAt(e.LastParameter).z, 5.14)
+
+    def test70(self):
+        """Check coloring of secondary and borderline edges"""
+
+        vd.resetColor(0)
+        vd.colorSecondary(1)
+        vd.colorBorderline(5)
+        for e in vd.Edges:
+            if not e.isPrimary():
+                self.assertEqual(e.Color, 1)
+            elif e.isBorderline():
+                self.assertEqual(e.Color, 5)
+            else:
+                self.assertEqual(e.Color, 0)
+
+    def test71(self):
+        """Check wires of the medial axis"""
+
+        wires = vd.getWires(0)
+        self.assertNotEqual(len(wires), 0)
+
+        indices = []
+        for wire in wires:
+            self.assertNotEqual(len(wire), 0)
+            for e0, e1 in zip(wire, wire[1:]):
+                self.assertEqual(e0.Vertices[1], e1.Vertices[0])
+            for e in wire:
+                if e.Color != 0:
+                    e = e.Twin
+                self.assertEqual(e.Color, 0)
+                indices.append(e.Index)
+
+        # each edge with color 0 shows up exactly once
+        expected = sorted(e.Index for e in vd.Edges if e.Color == 0 and e.isFinite())
+        self.assertEqual(sorted(indices), expected)
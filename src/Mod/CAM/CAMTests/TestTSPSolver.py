@@ -442,6 +442,25 @@ class TestTSPSolver(PathTestBase):
             elif tunnel["index"] == 1:
                 self.assertEqual(tunnel["notes"], "high precision")
 
+    def test_10_many_points(self):
+        """Test TSP solver with a large grid of points and a time limit."""
+        points = [(x * 5.0, y * 5.0) for x in range(100) for y in range(100)]
+
+        for timeLimit in (0.0, 0.5):
+            route = tsp_solver.solve(points, timeLimit=timeLimit)
+
+            self.assertEqual(len(route), len(points))
+            self.assertEqual(set(route), set(range(len(points))))
+
+            total_distance = 0
+            for i in range(len(route) - 1):
+                pt1 = points[route[i]]
+                pt2 = points[route[i + 1]]
+                total_distance += math.sqrt((pt2[0] - pt1[0]) ** 2 + (pt2[1] - pt1[1]) ** 2)
+
+            # A serpentine visits all points with steps of 5, allow some detours
+            self.assertLess(total_distance, 1.1 * 5.0 * (len(points) - 1))
+
 
 if __name__ == "__main__":
     import unittest
@@ -750,10 +750,14 @@ void ViewProviderPath::updateVisual(bool rebuild)
             }
             pcLineCoords->point.finishEditing();
 
+            // fill the markers in one go as well, set1Value() notifies the scene graph each time
             pcMarkerCoords->point.setNum(markers.size());
-            for (unsigned int i = 0; i < markers.size(); i++) {
-                pcMarkerCoords->point.set1Value(i, markers[i].x, markers[i].y, markers[i].z);
+            verts = pcMarkerCoords->point.startEditing();
+            i = 0;
+            for (const auto& pt : markers) {
+                verts[i++].setValue(pt.x, pt.y, pt.z);
             }
+            pcMarkerCoords->point.finishEditing();
 
             recomputeBoundingBox();
         }
@@ -31,6 +31,7 @@ import PathGui
 import PathSimulator
 import math
 import os
+import time
 
 from FreeCAD import Vector, Base
 
@@ -386,7 +387,14 @@ class PathSimulation:
 
     def PerformCut(self):
         if self.isVoxel:
-            self.PerformCutVoxel()
+            if self.disableAnim:
+                # fast forward: nothing is shown until the end, so apply as many commands per
+                # timer tick as fit into the time slice and keep the gui responsive in between
+                end = time.monotonic() + 0.1
+                while self.timer.isActive() and self.disableAnim and time.monotonic() < end:
+                    self.PerformCutVoxel()
+            else:
+                self.PerformCutVoxel()
         else:
             self.PerformCutBoolean()
 
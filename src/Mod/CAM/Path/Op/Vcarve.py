@@ -52,65 +52,6 @@ else:
 translate = FreeCAD.Qt.translate
 
 
-def _collectVoronoiWires(vd):
-    edges = [e for e in vd.Edges if e.Color == PRIMARY]
-    vertex = {}
-    for e in edges:
-        for v in e.Vertices:
-            i = v.Index
-            j = vertex.get(i, [])
-            j.append(e)
-            vertex[i] = j
-
-    # knots are the start and end points of a wire
-    knots = [i for i in vertex if len(vertex[i]) == 1]
-    knots.extend([i for i in vertex if len(vertex[i]) > 2])
-    if len(knots) == 0:
-        for i in vertex:
-            if len(vertex[i]) > 0:
-                knots.append(i)
-                break
-
-    def consume(v, edge):
-        vertex[v] = [e for e in vertex[v] if e.Index != edge.Index]
-        return len(vertex[v]) == 0
-
-    def traverse(vStart, edge, edges):
-        if vStart == edge.Vertices[0].Index:
-            vEnd = edge.Vertices[1].Index
-            edges.append(edge)
-        else:
-            vEnd = edge.Vertices[0].Index
-            edges.append(edge.Twin)
-
-        consume(vStart, edge)
-        if consume(vEnd, edge):
-            return None
-        return vEnd
-
-    wires = []
-    while knots:
-        we = []
-        vFirst = knots[0]
-        vStart = vFirst
-        vLast = vFirst
-        if len(vertex[vStart]):
-            while vStart is not None:
-                vLast = vStart
-                edges = vertex[vStart]
-                if len(edges) > 0:
-                    edge = edges[0]
-                    vStart = traverse(vStart, edge, we)
-                else:
-                    vStart = None
-            wires.append(we)
-        if len(vertex[vFirst]) == 0:
-            knots = [v for v in knots if v != vFirst]
-        if len(vertex[vLast]) == 0:
-            knots = [v for v in knots if v != vLast]
-    return wires
-
-
 def _sortVoronoiWires(wires, start=FreeCAD.Vector(0, 0, 0)):
     def closestTo(start, point):
         p = None
@@ -472,7 +413,7 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
         :returns: dictionary - each face object is a key containing list of wires"""
 
         medial_wires_by_face = dict()
-        edges_by_face = dict()  # non processed voronoi edges, for debugging
+        edges_by_face = dict()  # voronoi diagrams with the non processed edges, for debugging
 
         self.voronoiDebugMedialCache = dict()
         self.voronoiDebugEdgeCache = dict()
@@ -483,7 +424,8 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
             # isPartOfDomain is faster than face.IsInside(...)
             return not face.isPartOfDomain(u, v)
 
-        def insert_many_wires(vd, wires):
+        def discretize_wires(wires):
+            polygons = []
             for wire in wires:
                 Path.Log.debug("discretize value: {}".format(obj.Discretize))
                 pts = wire.discretize(QuasiDeflection=obj.Discretize)
@@ -504,26 +446,41 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
                         )
                         del ptv[-1]
                 ptv.append(ptv[0])
+                polygons.append(ptv)
+            return polygons
 
-                for i in range(len(ptv) - 1):
-                    vd.addSegment(ptv[i], ptv[i + 1])
+        # the diagrams of the previous run are reused for faces whose outline did not change
+        previousCache = getattr(self, "voronoiCache", None) or dict()
+        self.voronoiCache = dict()
 
         for f in faces:
+            polygons = discretize_wires(f.Wires)
+            key = (
+                tuple((p.x, p.y) for ptv in polygons for p in ptv),
+                tuple(len(ptv) for ptv in polygons),
+                f.BoundBox.ZMin,
+                obj.Colinear,
+            )
+            cached = previousCache.get(key)
+            if cached:
+                Path.Log.debug("reusing voronoi diagram of face")
+                vd, voronoiWires = cached
+                self.voronoiCache[key] = cached
+                edges_by_face[f] = vd
+                medial_wires_by_face[f] = voronoiWires
+                continue
+
             voronoiWires = []
             vd = Path.Voronoi.Diagram()
-            insert_many_wires(vd, f.Wires)
+            for ptv in polygons:
+                for i in range(len(ptv) - 1):
+                    vd.addSegment(ptv[i], ptv[i + 1])
 
             vd.construct()
-            edges_by_face[f] = vd.Edges
+            edges_by_face[f] = vd
 
-            for e in vd.Edges:
-                if e.isPrimary():
-                    if e.isBorderline():
-                        e.Color = BORDERLINE
-                    else:
-                        e.Color = PRIMARY
-                else:
-                    e.Color = SECONDARY
+            vd.colorSecondary(SECONDARY)
+            vd.colorBorderline(BORDERLINE)
 
             # filter our colinear edged so there are fewer ones
             # to iterate over in colorExterior which is slow
@@ -537,11 +494,12 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
             # keep it here to be safe
             vd.colorTwins(TWIN)
 
-            wires = _collectVoronoiWires(vd)
+            wires = vd.getWires(PRIMARY)
             wires = _sortVoronoiWires(wires)
             voronoiWires.extend(wires)
 
             medial_wires_by_face[f] = voronoiWires
+            self.voronoiCache[key] = (vd, voronoiWires)
 
         self.voronoiDebugMedialCache = medial_wires_by_face
         self.voronoiDebugEdgeCache = edges_by_face
@@ -802,8 +760,8 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
 
         edgesToShow = []
 
-        for face, edges in self.voronoiDebugEdgeCache.items():
-            for edge in edges:  # those are voronoi Edge objects, not FC Edge
+        for face, vd in self.voronoiDebugEdgeCache.items():
+            for edge in vd.Edges:  # those are voronoi Edge objects, not FC Edge
                 currentEdge = edge.toShape()
 
                 edgesToShow.append(currentEdge)
@@ -630,7 +630,9 @@ def sort_locations(locations, keys, attractors=None):
     return out
 
 
-def sort_locations_tsp(locations, keys, attractors=None, startPoint=None, endPoint=None):
+def sort_locations_tsp(
+    locations, keys, attractors=None, startPoint=None, endPoint=None, timeLimit=0.0
+):
     """
     Python wrapper for the C++ TSP solver. Takes a list of dicts (locations),
     a list of keys (e.g. ['x', 'y']), and optional parameters.
@@ -641,6 +643,7 @@ def sort_locations_tsp(locations, keys, attractors=None, startPoint=None, endPoi
     - attractors: Optional parameter (not used, kept for compatibility)
     - startPoint: Optional starting point [x, y]
     - endPoint: Optional ending point [x, y]
+    - timeLimit: Optional time budget in seconds for the optimization, 0 for no limit
 
     Returns the sorted list of locations in TSP order.
     If startPoint is None, the path is optimized to start near the first point in the original list,
@@ -648,13 +651,17 @@ def sort_locations_tsp(locations, keys, attractors=None, startPoint=None, endPoi
     """
     # Extract points from locations
     points = [(loc[keys[0]], loc[keys[1]]) for loc in locations]
-    order = tsp_solver.solve(points=points, startPoint=startPoint, endPoint=endPoint)
+    order = tsp_solver.solve(
+        points=points, startPoint=startPoint, endPoint=endPoint, timeLimit=timeLimit
+    )
 
     # Return the reordered locations
     return [locations[i] for i in order]
 
 
-def sort_tunnels_tsp(tunnels, allowFlipping=False, routeStartPoint=None, routeEndPoint=None):
+def sort_tunnels_tsp(
+    tunnels, allowFlipping=False, routeStartPoint=None, routeEndPoint=None, timeLimit=0.0
+):
     """
     Python wrapper for the C++ TSP tunnel solver. Takes a list of dicts (tunnels),
     a list of keys for start/end coordinates, and optional parameters.
@@ -669,6 +676,7 @@ def sort_tunnels_tsp(tunnels, allowFlipping=False, routeStartPoint=None, routeEn
     - allowFlipping: Whether tunnels can be reversed (entry becomes exit)
     - routeStartPoint: Optional starting point [x, y] for the entire route
     - routeEndPoint: Optional ending point [x, y] for the entire route
+    - timeLimit: Optional time budget in seconds for the optimization, 0 for no limit
 
     Returns the sorted list of tunnels in TSP order. Each returned tunnel dictionary
     will include the original keys plus:
@@ -681,6 +689,7 @@ def sort_tunnels_tsp(tunnels, allowFlipping=False, routeStartPoint=None, routeEn
         allowFlipping=allowFlipping,
         routeStartPoint=routeStartPoint,
         routeEndPoint=routeEndPoint,
+        timeLimit=timeLimit,
     )
 
 
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
 
 
 #include <BRepBndLib.hxx>
@@ -30,10 +32,43 @@
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <gp_Pnt.hxx>
 
+#include <Base/Parallel.h>
+
 #include "VolSim.h"
 
 using std::numbers::pi;
 
+namespace
+{
+
+// The tool profile sampled at a fixed step in stock cells, which is cheaper than looking it up
+// for every cell of a move.
+class ToolProfileTable
+{
+public:
+    ToolProfileTable(cSimTool& tool, float rad)
+    {
+        float invRad = 1.0f / rad;
+        int count = (int)(rad * SIM_PROFILE_STEPS) + 2;
+        heights.reserve(count);
+        for (int i = 0; i < count; i++) {
+            float dist = (i + 0.5f) / SIM_PROFILE_STEPS;
+            heights.push_back(tool.GetToolProfileAt(std::min(1.0f, dist * invRad)));
+        }
+    }
+
+    // the height of the tool at the given distance from its axis, which must not exceed the radius
+    float at(float dist) const
+    {
+        return heights[(int)(dist * SIM_PROFILE_STEPS)];
+    }
+
+private:
+    std::vector<float> heights;
+};
+
+}  // namespace
+
 //************************************************************************************************************
 // stock
 //************************************************************************************************************
@@ -512,6 +547,51 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     }
 }
 
+template<typename Range, typename Func>
+void cStock::CutCells(float minX, float maxX, Range yRange, Func depthAt)
+{
+    int xs = std::max(0, (int)std::floor(minX));
+    int xe = std::min(m_x, (int)std::floor(maxX) + 1);
+    if (xs >= xe) {
+        return;
+    }
+
+    // The stock is stored column by column, so the area is split into strips of whole columns.
+    // Each strip is written by one thread only, and small areas are handled by the caller alone.
+    int numStrips = (xe - xs + SIM_STRIP_SIZE - 1) / SIM_STRIP_SIZE;
+    float minY = 0;
+    float maxY = 0;
+    long long numCells = 0;
+    for (int x = xs; x < xe; x += SIM_STRIP_SIZE) {
+        if (yRange(x + 0.5f, minY, maxY)) {
+            numCells += (long long)SIM_STRIP_SIZE * (long long)(maxY - minY + 1);
+        }
+    }
+    Base::parallelFor(
+        numStrips,
+        [&](std::size_t strip) {
+            int x1 = xs + (int)strip * SIM_STRIP_SIZE;
+            int x2 = std::min(xe, x1 + SIM_STRIP_SIZE);
+            for (int x = x1; x < x2; x++) {
+                float cx = x + 0.5f;
+                float y1 = 0;
+                float y2 = 0;
+                if (!yRange(cx, y1, y2)) {
+                    continue;
+                }
+                int ys = std::max(0, (int)std::floor(y1));
+                int ye = std::min(m_y, (int)std::floor(y2) + 1);
+                float* column = m_stock[x];
+                for (int y = ys; y < ye; y++) {
+                    float z = depthAt(cx, y + 0.5f);
+                    column[y] = std::min(column[y], z);
+                }
+            }
+        },
+        numCells >= SIM_PARALLEL_CELLS ? 0 : 1
+    );
+}
+
 void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
 {
     // translate coordinates
@@ -519,63 +599,65 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
     Point3D pi2 = ToInner(p2);
     float rad = tool.radius;
     rad /= m_res;
-    float cupAngle = 180;
-
-    // strait motion
-    float perpDirX = 1;
-    float perpDirY = 0;
-    cLineSegment path(pi1, pi2);
-    if (path.lenXY > SIM_EPSILON)  // only if moving along xy
-    {
-        perpDirX = -path.pDirXY.y;
-        perpDirY = path.pDirXY.x;
-        Point3D start(perpDirX * rad + pi1.x, perpDirY * rad + pi1.y, pi1.z);
-        Point3D mainWay = path.pDir * SIM_WALK_RES;
-        Point3D sideWay(-perpDirX * SIM_WALK_RES, -perpDirY * SIM_WALK_RES, 0);
-        int lenSteps = (int)(path.len / SIM_WALK_RES) + 1;
-        int radSteps = (int)(rad * 2 / SIM_WALK_RES) + 1;
-        float zstep = (pi2.z - pi1.z) / radSteps;
-        float tstep = 2.0 / radSteps;
-        float t = -1;
-        for (int j = 0; j < radSteps; j++) {
-            float z = pi1.z + tool.GetToolProfileAt(t);
-            Point3D p = start;
-            for (int i = 0; i < lenSteps; i++) {
-                int x = (int)p.x;
-                int y = (int)p.y;
-                if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
-                    }
-                }
-                p.Add(mainWay);
-                z += zstep;
+    float rad2 = rad * rad;
+    ToolProfileTable profile(tool, rad);
+
+    // The depth of each cell is taken at the nearest point of the tool axis. This covers the
+    // straight part of the move as well as the round ends, and no cell is visited twice.
+    float dx = pi2.x - pi1.x;
+    float dy = pi2.y - pi1.y;
+    float dz = pi2.z - pi1.z;
+    float lenXY2 = dx * dx + dy * dy;
+    float sideX = 0;
+    float sideY = 0;
+    if (lenXY2 > SIM_EPSILON) {
+        float lenXY = sqrtf(lenXY2);
+        sideX = -dy / lenXY * rad;
+        sideY = dx / lenXY * rad;
+    }
+
+    // the swept area is convex, its extent in a column is given by the round ends and the sides
+    auto yRange = [&](float cx, float& minY, float& maxY) {
+        minY = FLT_MAX;
+        maxY = -FLT_MAX;
+        for (const Point3D* p : {&pi1, &pi2}) {
+            float h2 = rad2 - (cx - p->x) * (cx - p->x);
+            if (h2 >= 0) {
+                float h = sqrtf(h2);
+                minY = std::min(minY, p->y - h);
+                maxY = std::max(maxY, p->y + h);
             }
-            t += tstep;
-            start.Add(sideWay);
-        }
-    }
-    else {
-        cupAngle = 360;
-    }
-
-    // end cup
-    for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES) {
-        Point3D cupCirc(perpDirX * r, perpDirY * r, pi2.z);
-        float rotang = 180 * SIM_WALK_RES / (pi * r);
-        cupCirc.SetRotationAngle(-rotang);
-        float z = pi2.z + tool.GetToolProfileAt(r / rad);
-        for (float a = 0; a < cupAngle; a += rotang) {
-            int x = (int)(pi2.x + cupCirc.x);
-            int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+        }
+        for (float side : {-1.0f, 1.0f}) {
+            float ax = pi1.x + side * sideX;
+            float ay = pi1.y + side * sideY;
+            if (std::abs(dx) > SIM_EPSILON && (cx - ax) * (cx - ax - dx) <= 0) {
+                float y = ay + (cx - ax) / dx * dy;
+                minY = std::min(minY, y);
+                maxY = std::max(maxY, y);
             }
-            cupCirc.Rotate();
         }
-    }
+        return minY <= maxY;
+    };
+
+    CutCells(
+        std::min(pi1.x, pi2.x) - rad,
+        std::max(pi1.x, pi2.x) + rad,
+        yRange,
+        [&](float cx, float cy) {
+            float s = 1.0f;  // only moving along z, cut at the end point
+            if (lenXY2 > SIM_EPSILON) {
+                s = std::clamp(((cx - pi1.x) * dx + (cy - pi1.y) * dy) / lenXY2, 0.0f, 1.0f);
+            }
+            float ex = cx - (pi1.x + s * dx);
+            float ey = cy - (pi1.y + s * dy);
+            float dist2 = ex * ex + ey * ey;
+            if (dist2 > rad2) {
+                return FLT_MAX;
+            }
+            return pi1.z + s * dz + profile.at(sqrtf(dist2));
+        }
+    );
 }
 
 void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool& tool, bool isCCW)
@@ -586,14 +668,12 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
     Point3D centi(cent.x / m_res, cent.y / m_res, cent.z);
     float rad = tool.radius;
     rad /= m_res;
+    float rad2 = rad * rad;
+    ToolProfileTable profile(tool, rad);
     float cpx = centi.x;
     float cpy = centi.y;
 
-    Point3D xynorm = unit(Point3D(-cpx, -cpy, 0));
     float crad = sqrt(cpx * cpx + cpy * cpy);
-    float crad1 = std::max((float)0.5, crad - rad);
-    float crad2 = crad + rad;
-
     float sang = atan2(-cpy, -cpx);  // start angle
 
     cpx += pi1.x;
@@ -609,60 +689,56 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
     }
     ang = fabs(ang);
 
-    // apply path
-    Point3D cupCirc;
-    float tstep = (float)SIM_WALK_RES / rad;
-    float t = -1;
-    for (float r = crad1; r <= crad2; r += (float)SIM_WALK_RES) {
-        cupCirc.x = xynorm.x * r;
-        cupCirc.y = xynorm.y * r;
-        float rotang = (float)SIM_WALK_RES / r;
-        int ndivs = (int)(ang / rotang) + 1;
-        if (!isCCW) {
-            rotang = -rotang;
-        }
-        cupCirc.SetRotationAngleRad(rotang);
-        float z = pi1.z + tool.GetToolProfileAt(t);
-        float zstep = (pi2.z - pi1.z) / ndivs;
-        for (int i = 0; i < ndivs; i++) {
-            int x = (int)(cpx + cupCirc.x);
-            int y = (int)(cpy + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+    // Cells within the tool radius of the arc are cut at the depth of the tool at that angle,
+    // the cells around the end point get the end cup.
+    float dz = pi2.z - pi1.z;
+    float outer = crad + rad;
+    float inner = std::max(0.0f, crad - rad);
+    float side = 1;
+    // the ring is cut in an upper and a lower half, each of which is a single range per column
+    auto yRange = [&](float cx, float& minY, float& maxY) {
+        float dx2 = (cx - cpx) * (cx - cpx);
+        float h2 = outer * outer - dx2;
+        if (h2 < 0) {
+            return false;
+        }
+        float h1 = sqrtf(std::max(0.0f, inner * inner - dx2));
+        minY = side > 0 ? cpy + h1 : cpy - sqrtf(h2);
+        maxY = side > 0 ? cpy + sqrtf(h2) : cpy - h1;
+        return true;
+    };
+    auto depthAt = [&](float cx, float cy) {
+        float z = FLT_MAX;
+        float vx = cx - cpx;
+        float vy = cy - cpy;
+        float r = sqrtf(vx * vx + vy * vy);
+        float offset = r - crad;
+        if (std::abs(offset) <= rad) {
+            double a = atan2(vy, vx) - sang;
+            if (!isCCW) {
+                a = -a;
             }
-            z += zstep;
-            cupCirc.Rotate();
-        }
-        t += tstep;
-    }
-
-    // apply end cup
-    xynorm.SetRotationAngleRad(ang);
-    xynorm.Rotate();
-    for (float r = 0.5f; r <= rad; r += (float)SIM_WALK_RES) {
-        Point3D cupCirc(xynorm.x * r, xynorm.y * r, 0);
-        float rotang = (float)SIM_WALK_RES / r;
-        int ndivs = (int)(pi / rotang) + 1;
-        if (!isCCW) {
-            rotang = -rotang;
-        }
-        cupCirc.SetRotationAngleRad(rotang);
-        float z = pi2.z + tool.GetToolProfileAt(r / rad);
-        for (int i = 0; i < ndivs; i++) {
-            int x = (int)(pi2.x + cupCirc.x);
-            int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
+            if (a < 0) {
+                a += 2 * pi;
+            }
+            if (a <= ang) {
+                float frac = ang > 0 ? float(a / ang) : 0.0f;
+                z = pi1.z + frac * dz + profile.at(std::abs(offset));
             }
-            cupCirc.Rotate();
         }
-    }
-}
+        float ex = cx - pi2.x;
+        float ey = cy - pi2.y;
+        float dist2 = ex * ex + ey * ey;
+        if (dist2 <= rad2) {
+            z = std::min(z, pi2.z + profile.at(sqrtf(dist2)));
+        }
+        return z;
+    };
 
+    CutCells(cpx - outer, cpx + outer, yRange, depthAt);
+    side = -1;
+    CutCells(cpx - outer, cpx + outer, yRange, depthAt);
+}
 
 //************************************************************************************************************
 // Line Segment
@@ -37,6 +37,9 @@
 #define SIM_TESSEL_BOT 2
 #define SIM_WALK_RES \
     0.6  // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_STRIP_SIZE 32           // number of stock columns processed by one task
+#define SIM_PARALLEL_CELLS 16384  // minimum number of cells for using several threads
+#define SIM_PROFILE_STEPS 8       // samples of the tool profile per pixel
 
 struct toolShapePoint
 {
@@ -234,6 +237,8 @@ public:
     }
 
 private:
+    template<typename Range, typename Func>
+    void CutCells(float minX, float maxX, Range yRange, Func depthAt);
     float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
@@ -1293,16 +1293,11 @@ std::pair<double, double> Adaptive2d::CalcCutArea(IntPoint c1, IntPoint c2, Clea
         const double sa = sin(angle);
         c1 = {(long long)(ca * c1.X - sa * c1.Y), (long long)(sa * c1.X + ca * c1.Y)};
         c2 = {(long long)(ca * c2.X - sa * c2.Y), (long long)(sa * c2.X + ca * c2.Y)};
-        vector<vector<DoublePoint>> rotatedPolygons;
         for (vector<DoublePoint>& pgon : polygons) {
-            vector<DoublePoint> rotated;
             for (auto& p : pgon) {
-                rotated.push_back({ca * p.X - sa * p.Y, sa * p.X + ca * p.Y});
+                p = {ca * p.X - sa * p.Y, sa * p.X + ca * p.Y};
             }
-            rotatedPolygons.push_back(rotated);
         }
-
-        polygons = rotatedPolygons;
     }
 
     // 1) Find all x-coordinates of interest:
@@ -1370,6 +1365,26 @@ std::pair<double, double> Adaptive2d::CalcCutArea(IntPoint c1, IntPoint c2, Clea
         return y;
     };
 
+    // Only the polygon edges that overlap the tool in x can cross one of the vertical lines
+    // below, so collect them once instead of testing all edges for each line
+    struct Edge
+    {
+        DoublePoint p0;
+        DoublePoint p1;
+        size_t polygon;
+    };
+    vector<Edge> edges;
+    for (size_t ipolygon = 0; ipolygon < polygons.size(); ipolygon++) {
+        const auto& polygon = polygons[ipolygon];
+        for (size_t iedge = 0; iedge < polygon.size(); iedge++) {
+            const auto p0 = polygon[iedge];
+            const auto p1 = polygon[(iedge + 1) % polygon.size()];
+            if (max(p0.X, p1.X) > xmin && min(p0.X, p1.X) < xmax) {
+                edges.push_back({p0, p1, ipolygon});
+            }
+        }
+    }
+
     // 3) For each non-empty range in x, construct a vertical line through its midpoint
     const vector<DoublePoint> circles = {c2, c1};
     double area = 0;
@@ -1386,19 +1401,16 @@ std::pair<double, double> Adaptive2d::CalcCutArea(IntPoint c1, IntPoint c2, Clea
         // track of which shape crossing each parameter came from (polygon index and edge index, or
         // circle index and top/bottom flag)
 
-        // y, polygon index (or polygons.size() + circle index), edge index (or 0/1 for top/bottom half)
+        // y, polygon index (or polygons.size() + circle index), index in edges (or 0/1 for
+        // top/bottom half)
         vector<tuple<double, size_t, size_t>> ys;
 
-        for (size_t ipolygon = 0; ipolygon < polygons.size(); ipolygon++) {
-            const auto polygon = polygons[ipolygon];
-            for (size_t iedge = 0; iedge < polygon.size(); iedge++) {
-                const auto p0 = polygon[iedge];
-                const auto p1 = polygon[(iedge + 1) % polygon.size()];
-                // note: we skip if the edge is vertical, p0.X == p1.X == xtest
-                if (min(p0.X, p1.X) < xtest && max(p0.X, p1.X) > xtest) {
-                    const double y = interpX(p0, p1, xtest);
-                    ys.push_back({y, ipolygon, iedge});
-                }
+        for (size_t iedge = 0; iedge < edges.size(); iedge++) {
+            const Edge& edge = edges[iedge];
+            // note: we skip if the edge is vertical, p0.X == p1.X == xtest
+            if (min(edge.p0.X, edge.p1.X) < xtest && max(edge.p0.X, edge.p1.X) > xtest) {
+                const double y = interpX(edge.p0, edge.p1, xtest);
+                ys.push_back({y, edge.polygon, iedge});
             }
         }
 
@@ -1416,7 +1428,7 @@ std::pair<double, double> Adaptive2d::CalcCutArea(IntPoint c1, IntPoint c2, Clea
         std::sort(
             ys.begin(),
             ys.end(),
-            [](std::tuple<double, int, int> a, std::tuple<double, int, int> b) {
+            [](const tuple<double, size_t, size_t>& a, const tuple<double, size_t, size_t>& b) {
                 return std::get<0>(a) < std::get<0>(b);
             }
         );
@@ -1446,9 +1458,8 @@ std::pair<double, double> Adaptive2d::CalcCutArea(IntPoint c1, IntPoint c2, Clea
             if (outsideCount == 0 || prevCount == 0) {
                 if (ishape < polygons.size()) {
                     // crossed a polygon
-                    const auto polygon = polygons[ishape];
-                    const auto p0 = polygon[ipart];
-                    const auto p1 = polygon[(ipart + 1) % polygon.size()];
+                    const auto p0 = edges[ipart].p0;
+                    const auto p1 = edges[ipart].p1;
                     const auto y0 = interpX(p0, p1, x0);
                     const auto y1 = interpX(p0, p1, x1);
                     const double newArea = (y0 + y1) / 2 * (x1 - x0);
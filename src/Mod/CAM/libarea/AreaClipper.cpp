@@ -4,6 +4,9 @@
 
 // implements CArea methods using Angus Johnson's "Clipper"
 
+#include <algorithm>
+#include <vector>
+
 #include "Area.h"
 #include "clipper.hpp"
 using namespace ClipperLib;
@@ -40,7 +43,9 @@ public:
     }
 };
 
-static std::list<DoubleAreaPoint> pts_for_AddVertex;
+// a vector keeps its capacity between clear() calls, so the point buffer stops allocating once
+// it has grown to the size of the largest curve converted so far
+static std::vector<DoubleAreaPoint> pts_for_AddVertex;
 
 static void AddPoint(const DoubleAreaPoint& p)
 {
@@ -207,7 +212,7 @@ static void OffsetWithLoops(const TPolyPolygon& pp, TPolyPolygon& pp_new, double
 
             TPolygon loopy_polygon;
             loopy_polygon.reserve(pts_for_AddVertex.size());
-            for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
+            for (std::vector<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
                  It != pts_for_AddVertex.end();
                  It++) {
                 loopy_polygon.push_back(It->int_point());
@@ -228,18 +233,8 @@ static void OffsetWithLoops(const TPolyPolygon& pp, TPolyPolygon& pp_new, double
     }
     else {
         // reverse all the resulting polygons
-        TPolyPolygon copy = pp_new;
-        pp_new.clear();
-        pp_new.resize(copy.size());
-        for (unsigned int i = 0; i < copy.size(); i++) {
-            const TPolygon& p = copy[i];
-            TPolygon p_new;
-            p_new.resize(p.size());
-            std::size_t size_minus_one = p.size() - 1;
-            for (std::size_t j = 0; j < p.size(); j++) {
-                p_new[j] = p[size_minus_one - j];
-            }
-            pp_new[i] = p_new;
+        for (TPolygon& p : pp_new) {
+            std::reverse(p.begin(), p.end());
         }
     }
 }
@@ -296,7 +291,7 @@ static void OffsetSpansWithObrounds(const CArea& area, TPolyPolygon& pp_new, dou
 
                 TPolygon loopy_polygon;
                 loopy_polygon.reserve(pts_for_AddVertex.size());
-                for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
+                for (std::vector<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
                      It != pts_for_AddVertex.end();
                      It++) {
                     loopy_polygon.push_back(It->int_point());
@@ -311,18 +306,8 @@ static void OffsetSpansWithObrounds(const CArea& area, TPolyPolygon& pp_new, dou
 
 
     // reverse all the resulting polygons
-    TPolyPolygon copy = pp_new;
-    pp_new.clear();
-    pp_new.resize(copy.size());
-    for (unsigned int i = 0; i < copy.size(); i++) {
-        const TPolygon& p = copy[i];
-        TPolygon p_new;
-        p_new.resize(p.size());
-        std::size_t size_minus_one = p.size() - 1;
-        for (std::size_t j = 0; j < p.size(); j++) {
-            p_new[j] = p[size_minus_one - j];
-        }
-        pp_new[i] = p_new;
+    for (TPolygon& p : pp_new) {
+        std::reverse(p.begin(), p.end());
     }
 }
 
@@ -351,7 +336,7 @@ static void MakePoly(const CCurve& curve, TPolygon& p, bool reverse = false)
     p.resize(pts_for_AddVertex.size());
     if (reverse) {
         std::size_t i = pts_for_AddVertex.size() - 1;  // clipper wants them the opposite way to CArea
-        for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
+        for (std::vector<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
              It != pts_for_AddVertex.end();
              It++, i--) {
             p[i] = It->int_point();
@@ -359,7 +344,7 @@ static void MakePoly(const CCurve& curve, TPolygon& p, bool reverse = false)
     }
     else {
         unsigned int i = 0;
-        for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
+        for (std::vector<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
              It != pts_for_AddVertex.end();
              It++, i++) {
             p[i] = It->int_point();
@@ -370,6 +355,7 @@ static void MakePoly(const CCurve& curve, TPolygon& p, bool reverse = false)
 static void MakePolyPoly(const CArea& area, TPolyPolygon& pp, bool reverse = true)
 {
     pp.clear();
+    pp.reserve(area.m_curves.size());
 
     for (std::list<CCurve>::const_iterator It = area.m_curves.begin(); It != area.m_curves.end();
          It++) {
@@ -618,7 +604,7 @@ void UnFitArcs(CCurve& curve)
 
     curve.m_vertices.clear();
 
-    for (std::list<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
+    for (std::vector<DoubleAreaPoint>::iterator It = pts_for_AddVertex.begin();
          It != pts_for_AddVertex.end();
          It++) {
         DoubleAreaPoint& pt = *It;
@@ -223,5 +223,9 @@ PyMOD_INIT_FUNC(Fem)
 #endif
     // clang-format on
 
+#ifdef FC_USE_VTK
+    Fem::FemPostObject::configureParallelism();
+#endif
+
     PyMOD_Return(femModule);
 }
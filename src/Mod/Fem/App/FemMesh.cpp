@@ -21,14 +21,25 @@
  ***************************************************************************/
 
 #include <Python.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
+#include <BRepAdaptor_Curve.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
+#include <Poly_Triangulation.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -47,6 +58,9 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -55,11 +69,13 @@
 
 #include <boost/assign/list_of.hpp>
 #include <boost/tokenizer.hpp>  //to simplify parsing input files we use the boost lib
+#include <fmt/format.h>
 
 #include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
@@ -569,9 +585,305 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
+namespace
+{
+
+//! the nodes the mesher placed on the shape and on its sub-shapes.  Returns false if the mesh was
+//! not generated from a shape containing this one, or has no nodes on it.
+bool getNodesFromSubMeshes(SMESH_Mesh* mesh, const TopoDS_Shape& shape, std::set<int>& result)
+{
+    if (!mesh->HasShapeToMesh()) {
+        return false;
+    }
+    SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+    int index = meshDS->ShapeToIndex(shape);
+    if (index <= 0) {
+        return false;
+    }
+
+    auto addNodes = [&](int subIndex) {
+        SMESHDS_SubMesh* subMesh = meshDS->MeshElements(subIndex);
+        if (!subMesh) {
+            return false;
+        }
+        SMDS_NodeIteratorPtr it = subMesh->GetNodes();
+        bool found = false;
+        while (it->more()) {
+            result.insert(it->next()->GetID());
+            found = true;
+        }
+        return found;
+    };
+    if (!addNodes(index)) {
+        return false;
+    }
+
+    for (TopAbs_ShapeEnum type : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX}) {
+        for (TopExp_Explorer expl(shape, type); expl.More(); expl.Next()) {
+            int subIndex = meshDS->ShapeToIndex(expl.Current());
+            if (subIndex > 0 && subIndex != index) {
+                addNodes(subIndex);
+            }
+        }
+    }
+    return true;
+}
+
+//! a triangle of the tessellation of a face, or a segment of the discretization of an edge
+//! stored with c equal to b
+struct Simplex
+{
+    gp_XYZ a;
+    gp_XYZ b;
+    gp_XYZ c;
+};
+
+//! squared distance from p to the closest point of the triangle abc
+double distanceToTriangle2(const gp_XYZ& p, const Simplex& t)
+{
+    // Real-Time Collision Detection, Ericson, 5.1.5
+    gp_XYZ ab = t.b - t.a;
+    gp_XYZ ac = t.c - t.a;
+    gp_XYZ ap = p - t.a;
+    double d1 = ab.Dot(ap);
+    double d2 = ac.Dot(ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return ap.SquareModulus();
+    }
+    gp_XYZ bp = p - t.b;
+    double d3 = ab.Dot(bp);
+    double d4 = ac.Dot(bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return bp.SquareModulus();
+    }
+    double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        double v = d1 / (d1 - d3);
+        return (p - (t.a + ab * v)).SquareModulus();
+    }
+    gp_XYZ cp = p - t.c;
+    double d5 = ab.Dot(cp);
+    double d6 = ac.Dot(cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return cp.SquareModulus();
+    }
+    double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        double w = d2 / (d2 - d6);
+        return (p - (t.a + ac * w)).SquareModulus();
+    }
+    double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return (p - (t.b + (t.c - t.b) * w)).SquareModulus();
+    }
+    double denom = va + vb + vc;
+    if (denom <= 0.0) {
+        // degenerate triangle, i.e. a segment
+        return std::min(ap.SquareModulus(), bp.SquareModulus());
+    }
+    double v = vb / denom;
+    double w = vc / denom;
+    return (p - (t.a + ab * v + ac * w)).SquareModulus();
+}
+
+//! the tessellation of the faces or edges of a shape hashed into a uniform grid.  A point further
+//! than the margin from every triangle or segment near it cannot be within the tolerance of the
+//! shape, so only the remaining points need the exact distance.
+class ProximityGrid
+{
+public:
+    ProximityGrid(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, double tolerance)
+    {
+        Bnd_Box box;
+        BRepBndLib::Add(shape, box);
+        if (box.IsVoid()) {
+            return;
+        }
+        double deflection = 1.0e-3 * std::sqrt(box.SquareExtent());
+        if (deflection <= 0.0) {
+            return;
+        }
+
+        double maxDeflection = deflection;
+        if (type == TopAbs_FACE) {
+            BRepMesh_IncrementalMesh mesher(shape, deflection);
+            for (TopExp_Explorer expl(shape, TopAbs_FACE); expl.More(); expl.Next()) {
+                TopLoc_Location loc;
+                Handle(Poly_Triangulation) triangulation =
+                    BRep_Tool::Triangulation(TopoDS::Face(expl.Current()), loc);
+                if (triangulation.IsNull()) {
+                    return;
+                }
+                maxDeflection = std::max(maxDeflection, triangulation->Deflection());
+                const gp_Trsf& trsf = loc.Transformation();
+                for (int i = 1; i <= triangulation->NbTriangles(); i++) {
+                    int n1, n2, n3;
+                    triangulation->Triangle(i).Get(n1, n2, n3);
+                    simplices.push_back({triangulation->Node(n1).Transformed(trsf).XYZ(),
+                                         triangulation->Node(n2).Transformed(trsf).XYZ(),
+                                         triangulation->Node(n3).Transformed(trsf).XYZ()});
+                }
+            }
+        }
+        else {
+            for (TopExp_Explorer expl(shape, TopAbs_EDGE); expl.More(); expl.Next()) {
+                const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+                if (BRep_Tool::Degenerated(edge)) {
+                    continue;
+                }
+                BRepAdaptor_Curve curve(edge);
+                GCPnts_QuasiUniformDeflection discretizer(curve, deflection);
+                if (!discretizer.IsDone()) {
+                    return;
+                }
+                for (int i = 1; i < discretizer.NbPoints(); i++) {
+                    gp_XYZ start = discretizer.Value(i).XYZ();
+                    gp_XYZ end = discretizer.Value(i + 1).XYZ();
+                    simplices.push_back({start, end, end});
+                }
+            }
+        }
+        if (simplices.empty()) {
+            return;
+        }
+
+        margin = tolerance + maxDeflection;
+        box.Enlarge(margin);
+        double xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        cellSize = std::max(std::sqrt(box.SquareExtent()) / 64.0, margin);
+
+        for (std::size_t i = 0; i < simplices.size(); i++) {
+            const Simplex& s = simplices[i];
+            std::array<int, 3> low {};
+            std::array<int, 3> high {};
+            for (int axis = 0; axis < 3; axis++) {
+                double lo =
+                    std::min({s.a.Coord(axis + 1), s.b.Coord(axis + 1), s.c.Coord(axis + 1)});
+                double hi =
+                    std::max({s.a.Coord(axis + 1), s.b.Coord(axis + 1), s.c.Coord(axis + 1)});
+                low[axis] = cellIndex(axis, lo - margin);
+                high[axis] = cellIndex(axis, hi + margin);
+            }
+            for (int ix = low[0]; ix <= high[0]; ix++) {
+                for (int iy = low[1]; iy <= high[1]; iy++) {
+                    for (int iz = low[2]; iz <= high[2]; iz++) {
+                        cells[cellKey(ix, iy, iz)].push_back(i);
+                    }
+                }
+            }
+        }
+        valid = true;
+    }
+
+    //! false if the shape could not be tessellated, then every point must be measured
+    bool isValid() const
+    {
+        return valid;
+    }
+
+    //! true if the point may be within the tolerance of the shape
+    bool isNear(const gp_Pnt& pnt) const
+    {
+        auto it = cells.find(
+            cellKey(cellIndex(0, pnt.X()), cellIndex(1, pnt.Y()), cellIndex(2, pnt.Z())));
+        if (it == cells.end()) {
+            return false;
+        }
+        double margin2 = margin * margin;
+        return std::any_of(it->second.begin(), it->second.end(), [&](std::size_t i) {
+            return distanceToTriangle2(pnt.XYZ(), simplices[i]) <= margin2;
+        });
+    }
+
+private:
+    int cellIndex(int axis, double value) const
+    {
+        double origin = axis == 0 ? xMin : (axis == 1 ? yMin : zMin);
+        return static_cast<int>(std::floor((value - origin) / cellSize));
+    }
+
+    static std::int64_t cellKey(int ix, int iy, int iz)
+    {
+        constexpr std::int64_t mask = (1 << 21) - 1;
+        return ((ix & mask) << 42) | ((iy & mask) << 21) | (iz & mask);
+    }
+
+    bool valid {false};
+    double margin {0.0};
+    double cellSize {1.0};
+    double xMin {0.0}, yMin {0.0}, zMin {0.0};
+    std::vector<Simplex> simplices;
+    std::unordered_map<std::int64_t, std::vector<std::size_t>> cells;
+};
+
+//! the ids of the nodes, moved by the mesh transform, that pass the test.  The nodes are tested
+//! in blocks in parallel, makeTest is called once per block so each block has its own measuring
+//! tools.
+template<typename MakeTest>
+std::set<int> findNodes(SMESH_Mesh* mesh, const Base::Matrix4D& mtrx, MakeTest makeTest)
+{
+    std::vector<const SMDS_MeshNode*> nodes;
+    SMDS_NodeIteratorPtr aNodeIter = mesh->GetMeshDS()->nodesIterator();
+    while (aNodeIter->more()) {
+        nodes.push_back(aNodeIter->next());
+    }
+
+    std::set<int> result;
+    std::mutex resultMutex;
+    const std::size_t blockSize = 4096;
+    Base::parallelFor((nodes.size() + blockSize - 1) / blockSize, [&](std::size_t block) {
+        auto isOnShape = makeTest();
+        std::vector<int> ids;
+        std::size_t end = std::min(nodes.size(), (block + 1) * blockSize);
+        for (std::size_t i = block * blockSize; i < end; ++i) {
+            double xyz[3];
+            nodes[i]->GetXYZ(xyz);
+            // Apply the matrix to hold the node in absolute space.
+            Base::Vector3d vec = mtrx * Base::Vector3d(xyz[0], xyz[1], xyz[2]);
+            if (isOnShape(gp_Pnt(vec.x, vec.y, vec.z))) {
+                ids.push_back(nodes[i]->GetID());
+            }
+        }
+        std::lock_guard<std::mutex> lock(resultMutex);
+        result.insert(ids.begin(), ids.end());
+    });
+    return result;
+}
+
+//! the ids of the nodes within the limit of a face or an edge: first the box, then the
+//! tessellation, then the exact distance
+std::set<int> findNodesNearShape(SMESH_Mesh* mesh,
+                                 const Base::Matrix4D& mtrx,
+                                 const TopoDS_Shape& shape,
+                                 TopAbs_ShapeEnum type,
+                                 const Bnd_Box& box,
+                                 double limit)
+{
+    ProximityGrid grid(shape, type, limit);
+    return findNodes(mesh, mtrx, [&]() {
+        auto measure = std::make_shared<BRepExtrema_DistShapeShape>();
+        measure->LoadS1(shape);
+        return [&, measure](const gp_Pnt& pnt) {
+            if (box.IsOut(pnt) || (grid.isValid() && !grid.isNear(pnt))) {
+                return false;
+            }
+            measure->LoadS2(BRepBuilderAPI_MakeVertex(pnt).Vertex());
+            measure->Perform();
+            return measure->IsDone() && measure->NbSolution() > 0 && measure->Value() < limit;
+        };
+    });
+}
+
+}  // namespace
+
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
     std::set<int> result;
+    if (getTransform().isUnity() && getNodesFromSubMeshes(myMesh, solid, result)) {
+        return result;
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(solid, box);
@@ -585,46 +897,26 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
+    // a node is within the limit of the solid if it is inside or on its boundary
+    return findNodes(myMesh, Mtrx, [&]() {
+        auto classifier = std::make_shared<BRepClass3d_SolidClassifier>(solid);
+        return [&, classifier](const gp_Pnt& pnt) {
+            if (box.IsOut(pnt)) {
+                return false;
             }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-    return result;
+            classifier->Perform(pnt, limit);
+            TopAbs_State state = classifier->State();
+            return state == TopAbs_IN || state == TopAbs_ON;
+        };
+    });
 }
 
 std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
 {
     std::set<int> result;
+    if (getTransform().isUnity() && getNodesFromSubMeshes(myMesh, face, result)) {
+        return result;
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(
@@ -639,47 +931,15 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return findNodesNearShape(myMesh, Mtrx, face, TopAbs_FACE, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
     std::set<int> result;
+    if (getTransform().isUnity() && getNodesFromSubMeshes(myMesh, edge, result)) {
+        return result;
+    }
 
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
@@ -690,79 +950,28 @@ std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return findNodesNearShape(myMesh, Mtrx, edge, TopAbs_EDGE, box, limit);
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
 {
     std::set<int> result;
+    if (getTransform().isUnity() && getNodesFromSubMeshes(myMesh, vertex, result)) {
+        return result;
+    }
 
     double limit = BRep_Tool::Tolerance(vertex);
     limit *= limit;  // use square to improve speed
     gp_Pnt pnt = BRep_Tool::Pnt(vertex);
-    Base::Vector3d node(pnt.X(), pnt.Y(), pnt.Z());
 
     // get the current transform of the FemMesh
     const Base::Matrix4D Mtrx(getTransform());
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        vec = Mtrx * vec;
-
-        if (Base::DistanceP2(node, vec) <= limit)
-#pragma omp critical
-        {
-            result.insert(aNode->GetID());
-        }
-    }
-
-    return result;
+    return findNodes(myMesh, Mtrx, [&]() {
+        return [&](const gp_Pnt& node) {
+            return pnt.SquareDistance(node) <= limit;
+        };
+    });
 }
 
 std::list<int> FemMesh::getElementNodes(int id) const
@@ -1685,6 +1894,91 @@ void FemMesh::writeVTK(const std::string& fileName, bool highest) const
 #endif
 }
 
+namespace
+{
+
+// Formats count items into blocks in parallel and writes the blocks in order. To bound the
+// memory only a limited number of blocks is held at a time.
+template<typename Func>
+void writeFormatted(std::ostream& out, std::size_t count, Func&& format)
+{
+    constexpr std::size_t blockSize = 16384;
+    constexpr std::size_t blocksPerWrite = 64;
+    std::size_t numBlocks = (count + blockSize - 1) / blockSize;
+    std::vector<fmt::memory_buffer> buffers(std::min(numBlocks, blocksPerWrite));
+    for (std::size_t first = 0; first < numBlocks; first += blocksPerWrite) {
+        std::size_t num = std::min(numBlocks - first, blocksPerWrite);
+        Base::parallelFor(num, [&](std::size_t i) {
+            fmt::memory_buffer& buffer = buffers[i];
+            buffer.clear();
+            std::size_t begin = (first + i) * blockSize;
+            std::size_t end = std::min(count, begin + blockSize);
+            for (std::size_t j = begin; j < end; ++j) {
+                format(buffer, j);
+            }
+        });
+        for (std::size_t i = 0; i < num; ++i) {
+            out.write(buffers[i].data(), static_cast<std::streamsize>(buffers[i].size()));
+        }
+    }
+}
+
+// element of the inp file with its CalculiX type
+struct AbaqusElement
+{
+    const std::string* type;
+    const SMDS_MeshElement* element;
+};
+
+// Writes the elements sorted by type and ID with a header for each type
+void writeAbaqusElements(
+    std::ostream& out,
+    std::vector<AbaqusElement>& elements,
+    const std::map<std::string, std::vector<int>>& elemOrderMap,
+    const char* comment,
+    const char* elset
+)
+{
+    std::ranges::sort(elements, [](const AbaqusElement& a, const AbaqusElement& b) {
+        if (*a.type != *b.type) {
+            return *a.type < *b.type;
+        }
+        return a.element->GetID() < b.element->GetID();
+    });
+
+    for (std::size_t begin = 0; begin < elements.size();) {
+        const std::string& type = *elements[begin].type;
+        std::size_t end = begin;
+        while (end < elements.size() && *elements[end].type == type) {
+            ++end;
+        }
+
+        out << "** " << comment << " elements" << std::endl;
+        out << "*Element, TYPE=" << type << ", ELSET=" << elset << std::endl;
+        const std::vector<int>& order = elemOrderMap.at(type);
+        writeFormatted(out, end - begin, [&](fmt::memory_buffer& buffer, std::size_t i) {
+            const SMDS_MeshElement* element = elements[begin + i].element;
+            auto it = std::back_inserter(buffer);
+            fmt::format_to(it, "{}", element->GetID());
+            // Calculix allows max 16 entries in one line, a hexa20 has more !
+            for (std::size_t j = 0; j < order.size(); ++j) {
+                int node = element->GetNode(order[j])->GetID();
+                if (j == 15) {
+                    fmt::format_to(it, ",\n{}", node);
+                }
+                else {
+                    fmt::format_to(it, ", {}", node);
+                }
+            }
+            buffer.push_back('\n');
+        });
+        begin = end;
+    }
+    out << std::endl;
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(
     const std::string& Filename,
     int elemParam,
@@ -1917,118 +2211,65 @@ void FemMesh::writeABAQUS(
 
 
     // get all data --> Extract Nodes and Elements of the current SMESH datastructure
-    using VertexMap = std::map<int, Base::Vector3d>;
-    using NodesMap = std::map<int, std::vector<int>>;
-    using ElementsMap = std::map<std::string, NodesMap>;
-
-    // get nodes
-    VertexMap vertexMap;  // empty nodes map
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = _Mtrx * current_node;
-        vertexMap[aNode->GetID()] = current_node;
-    }
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+
+    // collect the elements of a dimension that have a CalculiX type
+    auto addElement = [](std::vector<AbaqusElement>& elements,
+                         const std::map<int, std::string>& typeMap,
+                         const SMDS_MeshElement* element) {
+        auto it = typeMap.find(element->NbNodes());
+        if (it != typeMap.end()) {
+            elements.push_back({&it->second, element});
+        }
+    };
 
     // get volumes
-    ElementsMap elementsMapVol;  // empty volumes map
-    SMDS_VolumeIteratorPtr aVolIter = myMesh->GetMeshDS()->volumesIterator();
+    std::vector<AbaqusElement> elementsVol;
+    elementsVol.reserve(meshDS->NbVolumes());
+    SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
     while (aVolIter->more()) {
-        const SMDS_MeshVolume* aVol = aVolIter->next();
-        std::pair<int, std::vector<int>> apair;
-        apair.first = aVol->GetID();
-        int numNodes = aVol->NbNodes();
-        std::map<int, std::string>::iterator it = volTypeMap.find(numNodes);
-        if (it != volTypeMap.end()) {
-            const std::vector<int>& order = elemOrderMap[it->second];
-            for (int jt : order) {
-                apair.second.push_back(aVol->GetNode(jt)->GetID());
-            }
-            elementsMapVol[it->second].insert(apair);
-        }
+        addElement(elementsVol, volTypeMap, aVolIter->next());
     }
 
     // get faces
-    ElementsMap elementsMapFac;  // empty faces map used for elemParam = 1
-                                 // and elementsMapVol is not empty
-    if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty())) {
-        // for elemParam = 1 we only fill the elementsMapFac if the elmentsMapVol is empty
-        // we're going to fill the elementsMapFac with all faces
-        SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
+    std::vector<AbaqusElement> elementsFac;  // stays empty for elemParam = 1
+                                             // and elementsVol is not empty
+    if ((elemParam == 0) || (elemParam == 1 && elementsVol.empty())) {
+        // for elemParam = 1 we only fill the elementsFac if the elementsVol is empty
+        // we're going to fill the elementsFac with all faces
+        elementsFac.reserve(meshDS->NbFaces());
+        SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
         while (aFaceIter->more()) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aFace->GetID();
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addElement(elementsFac, faceTypeMap, aFaceIter->next());
         }
     }
     if (elemParam == 2) {
-        // we're going to fill the elementsMapFac with the facesOnly
+        // we're going to fill the elementsFac with the facesOnly
         std::set<int> facesOnly = getFacesOnly();
+        elementsFac.reserve(facesOnly.size());
         for (int itfa : facesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = itfa;
-            const SMDS_MeshElement* aFace = myMesh->GetMeshDS()->FindElement(itfa);
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addElement(elementsFac, faceTypeMap, meshDS->FindElement(itfa));
         }
     }
 
     // get edges
-    ElementsMap elementsMapEdg;  // empty edges map used for elemParam == 1
-                                 // and either elementMapVol or elementsMapFac are not empty
-    if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty() && elementsMapFac.empty())) {
-        // for elemParam = 1 we only fill the elementsMapEdg if the elmentsMapVol
-        // and elmentsMapFac are empty we're going to fill the elementsMapEdg with all edges
-        SMDS_EdgeIteratorPtr aEdgeIter = myMesh->GetMeshDS()->edgesIterator();
+    std::vector<AbaqusElement> elementsEdg;  // stays empty for elemParam == 1
+                                             // and either elementsVol or elementsFac are not empty
+    if ((elemParam == 0) || (elemParam == 1 && elementsVol.empty() && elementsFac.empty())) {
+        // for elemParam = 1 we only fill the elementsEdg if the elementsVol
+        // and elementsFac are empty we're going to fill the elementsEdg with all edges
+        elementsEdg.reserve(meshDS->NbEdges());
+        SMDS_EdgeIteratorPtr aEdgeIter = meshDS->edgesIterator();
         while (aEdgeIter->more()) {
-            const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aEdge->GetID();
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addElement(elementsEdg, edgeTypeMap, aEdgeIter->next());
         }
     }
     if (elemParam == 2) {
-        // we're going to fill the elementsMapEdg with the edgesOnly
+        // we're going to fill the elementsEdg with the edgesOnly
         std::set<int> edgesOnly = getEdgesOnly();
+        elementsEdg.reserve(edgesOnly.size());
         for (int ited : edgesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = ited;
-            const SMDS_MeshElement* aEdge = myMesh->GetMeshDS()->FindElement(ited);
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addElement(elementsEdg, edgeTypeMap, meshDS->FindElement(ited));
         }
     }
 
@@ -2037,8 +2278,6 @@ void FemMesh::writeABAQUS(
     // https://forum.freecad.org/viewtopic.php?f=10&t=37436
     Base::FileInfo fi(Filename);
     Base::ofstream anABAQUS_Output(fi);
-    // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
-    anABAQUS_Output.precision(13);
 
     // add some text and make sure one of the known elemParam values is used
     anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes"
@@ -2066,8 +2305,24 @@ void FemMesh::writeABAQUS(
     anABAQUS_Output << "** Nodes" << std::endl;
     anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
 
+    // This way we get sorted output.
+    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        nodes.push_back(aNodeIter->next());
+    }
+    auto byID = [](const SMDS_MeshNode* a, const SMDS_MeshNode* b) {
+        return a->GetID() < b->GetID();
+    };
+    if (!std::ranges::is_sorted(nodes, byID)) {
+        std::ranges::sort(nodes, byID);
+    }
+
     // Axisymmetric, plane strain and plane stress elements expect nodes in the plane z=0.
     // Set the z coordinate to 0 to avoid possible rounding errors.
+    std::vector<char> planeNodes;
     switch (faceVariant) {
         case ABAQUS_FaceVariant::Stress:
         case ABAQUS_FaceVariant::Stress_Reduced:
@@ -2075,13 +2330,10 @@ void FemMesh::writeABAQUS(
         case ABAQUS_FaceVariant::Strain_Reduced:
         case ABAQUS_FaceVariant::Axisymmetric:
         case ABAQUS_FaceVariant::Axisymmetric_Reduced:
-            for (const auto& elMap : elementsMapFac) {
-                const NodesMap& nodeMap = elMap.second;
-                for (const auto& nodes : nodeMap) {
-                    for (int n : nodes.second) {
-                        Base::Vector3d& vertex = vertexMap[n];
-                        vertex.z = 0.0;
-                    }
+            planeNodes.resize(meshDS->MaxNodeID() + 1, 0);
+            for (const auto& face : elementsFac) {
+                for (int i = 0; i < face.element->NbNodes(); ++i) {
+                    planeNodes[face.element->GetNode(i)->GetID()] = 1;
                 }
             }
             break;
@@ -2089,90 +2341,52 @@ void FemMesh::writeABAQUS(
             break;
     }
 
-    // This way we get sorted output.
-    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
+    // 13 significant digits, see https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
+    writeFormatted(anABAQUS_Output, nodes.size(), [&](fmt::memory_buffer& buffer, std::size_t i) {
+        const SMDS_MeshNode* node = nodes[i];
+        Base::Vector3d vertex = _Mtrx * Base::Vector3d(node->X(), node->Y(), node->Z());
+        if (!planeNodes.empty() && planeNodes[node->GetID()]) {
+            vertex.z = 0.0;
+        }
+        fmt::format_to(
+            std::back_inserter(buffer),
+            "{}, {:.13g}, {:.13g}, {:.13g}\n",
+            node->GetID(),
+            vertex.x,
+            vertex.y,
+            vertex.z
+        );
+    });
     anABAQUS_Output << std::endl << std::endl;
-    ;
 
 
     // write volumes to file
     std::string elsetname;
-    if (!elementsMapVol.empty()) {
-        for (const auto& it : elementsMapVol) {
-            anABAQUS_Output << "** Volume elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
-        }
+    if (!elementsVol.empty()) {
+        writeAbaqusElements(anABAQUS_Output, elementsVol, elemOrderMap, "Volume", "Evolumes");
         elsetname += "Evolumes";
-        anABAQUS_Output << std::endl;
     }
 
     // write faces to file
-    if (!elementsMapFac.empty()) {
-        for (const auto& it : elementsMapFac) {
-            anABAQUS_Output << "** Face elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
-        }
+    if (!elementsFac.empty()) {
+        writeAbaqusElements(anABAQUS_Output, elementsFac, elemOrderMap, "Face", "Efaces");
         if (elsetname.empty()) {
             elsetname += "Efaces";
         }
         else {
             elsetname += ", Efaces";
         }
-        anABAQUS_Output << std::endl;
     }
 
     // write edges to file
-    if (!elementsMapEdg.empty()) {
-        for (const auto& it : elementsMapEdg) {
-            anABAQUS_Output << "** Edge elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
-        }
+    if (!elementsEdg.empty()) {
+        writeAbaqusElements(anABAQUS_Output, elementsEdg, elemOrderMap, "Edge", "Eedges");
         if (elsetname.empty()) {
             elsetname += "Eedges";
         }
         else {
             elsetname += ", Eedges";
         }
-        anABAQUS_Output << std::endl;
     }
 
     // write elset Eall
@@ -2189,6 +2403,7 @@ void FemMesh::writeABAQUS(
         anABAQUS_Output << std::endl << "** Group data" << std::endl;
 
         std::list<int> groupIDs = myMesh->GetGroupIds();
+        std::vector<int> ids;
         for (int it : groupIDs) {
 
             // get and write group info and group definition
@@ -2234,15 +2449,22 @@ void FemMesh::writeABAQUS(
             }
 
             // get and write group elements
-            std::set<int> ids;
-            SMDS_ElemIteratorPtr aElemIter = myMesh->GetGroup(it)->GetGroupDS()->GetElements();
+            SMESHDS_GroupBase* groupDS = myMesh->GetGroup(it)->GetGroupDS();
+            ids.clear();
+            ids.reserve(groupDS->Extent());
+            SMDS_ElemIteratorPtr aElemIter = groupDS->GetElements();
             while (aElemIter->more()) {
-                const SMDS_MeshElement* aElement = aElemIter->next();
-                ids.insert(aElement->GetID());
-            }
-            for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                ids.push_back(aElemIter->next()->GetID());
             }
+            std::ranges::sort(ids);
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+            writeFormatted(
+                anABAQUS_Output,
+                ids.size(),
+                [&](fmt::memory_buffer& buffer, std::size_t i) {
+                    fmt::format_to(std::back_inserter(buffer), "{}\n", ids[i]);
+                }
+            );
 
             // write newline after each group
             anABAQUS_Output << std::endl;
@@ -2348,12 +2570,237 @@ unsigned int FemMesh::getMemSize() const
     return 0;
 }
 
+namespace
+{
+
+// Header of the mesh data saved in project files
+constexpr uint32_t meshDataMagic = 0x46454D44;  // "FEMD"
+constexpr uint32_t meshDataVersion = 1;
+
+void writeString(Base::OutputStream& str, const std::string& text)
+{
+    str << static_cast<uint32_t>(text.size());
+    str.write(text.c_str(), static_cast<int>(text.size()));
+}
+
+std::string readString(Base::InputStream& str)
+{
+    uint32_t size {};
+    str >> size;
+    std::string text(size, '\0');
+    str.read(text.data(), static_cast<int>(size));
+    return text;
+}
+
+// Writes nodes, elements and groups of the mesh in binary form. The elements are written in
+// blocks of the same entity type, so the type is stored once per block, and the node count
+// is only stored per element for polygons and polyhedra.
+void writeMeshData(std::ostream& out, SMESH_Mesh* mesh)
+{
+    Base::OutputStream str(out);
+    const SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+
+    str << meshDataMagic << meshDataVersion;
+
+    // nodes
+    str << static_cast<uint32_t>(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr nodeIt = meshDS->nodesIterator();
+    while (nodeIt->more()) {
+        const SMDS_MeshNode* node = nodeIt->next();
+        str << static_cast<int32_t>(node->GetID()) << node->X() << node->Y() << node->Z();
+    }
+
+    // elements
+    std::map<SMDSAbs_EntityType, std::vector<const SMDS_MeshElement*>> blocks;
+    SMDS_ElemIteratorPtr elemIt = meshDS->elementsIterator();
+    while (elemIt->more()) {
+        const SMDS_MeshElement* elem = elemIt->next();
+        if (elem->GetType() != SMDSAbs_Node) {
+            blocks[elem->GetEntityType()].push_back(elem);
+        }
+    }
+
+    str << static_cast<uint32_t>(blocks.size());
+    for (const auto& [entity, elements] : blocks) {
+        const SMDS_MeshElement* first = elements.front();
+        bool isPoly = first->IsPoly();
+        // 0 if the node count differs between the elements
+        uint32_t numNodes = isPoly ? 0 : static_cast<uint32_t>(first->NbNodes());
+        str << static_cast<int32_t>(entity) << static_cast<int32_t>(first->GetType()) << isPoly
+            << static_cast<uint32_t>(elements.size()) << numNodes;
+
+        for (const SMDS_MeshElement* elem : elements) {
+            str << static_cast<int32_t>(elem->GetID());
+            if (numNodes == 0) {
+                str << static_cast<uint32_t>(elem->NbNodes());
+            }
+            SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+            while (nIt->more()) {
+                str << static_cast<int32_t>(nIt->next()->GetID());
+            }
+
+            if (entity == SMDSEntity_Polyhedra) {
+#if SMESH_VERSION_MAJOR >= 9
+                auto quantities = static_cast<const SMDS_MeshVolume*>(elem)->GetQuantities();
+#else
+                auto quantities = static_cast<const SMDS_VtkVolume*>(elem)->GetQuantities();
+#endif
+                str << static_cast<uint32_t>(quantities.size());
+                for (int it : quantities) {
+                    str << static_cast<int32_t>(it);
+                }
+            }
+            else if (entity == SMDSEntity_Ball) {
+                auto ball = static_cast<const SMDS_BallElement*>(elem);
+                str << static_cast<double>(ball->GetDiameter());
+            }
+        }
+    }
+
+    // groups
+    std::vector<SMESH_Group*> groups;
+    SMESH_Mesh::GroupIteratorPtr groupIt = mesh->GetGroups();
+    while (groupIt->more()) {
+        groups.push_back(groupIt->next());
+    }
+
+    str << static_cast<uint32_t>(groups.size());
+    for (SMESH_Group* group : groups) {
+        const SMESHDS_GroupBase* groupDS = group->GetGroupDS();
+        writeString(str, group->GetName());
+        str << static_cast<int32_t>(groupDS->GetID())
+            << static_cast<int32_t>(groupDS->GetType())
+            << static_cast<uint32_t>(groupDS->Extent());
+        SMDS_ElemIteratorPtr it = groupDS->GetElements();
+        while (it->more()) {
+            str << static_cast<int32_t>(it->next()->GetID());
+        }
+    }
+}
+
+// Reads the data written by writeMeshData() into an empty mesh
+void readMeshData(std::istream& in, SMESH_Mesh* mesh)
+{
+    Base::InputStream str(in);
+    SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+    SMESH_MeshEditor editor(mesh);
+
+    uint32_t magic {};
+    uint32_t version {};
+    str >> magic >> version;
+    if (magic != meshDataMagic || version > meshDataVersion) {
+        throw Base::FileException("Unknown format of FEM mesh data");
+    }
+
+    // nodes
+    uint32_t numNodes {};
+    str >> numNodes;
+    for (uint32_t i = 0; i < numNodes && str; ++i) {
+        int32_t id {};
+        double x {}, y {}, z {};
+        str >> id >> x >> y >> z;
+        meshDS->AddNodeWithID(x, y, z, id);
+    }
+
+    // elements
+    uint32_t numBlocks {};
+    str >> numBlocks;
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<int> quantities;
+    for (uint32_t i = 0; i < numBlocks && str; ++i) {
+        int32_t entity {};
+        int32_t type {};
+        bool isPoly {};
+        uint32_t numElements {};
+        uint32_t numNodes {};
+        str >> entity >> type >> isPoly >> numElements >> numNodes;
+
+        for (uint32_t j = 0; j < numElements && str; ++j) {
+            int32_t id {};
+            uint32_t count = numNodes;
+            str >> id;
+            if (count == 0) {
+                str >> count;
+            }
+            nodes.resize(count);
+            for (auto& node : nodes) {
+                int32_t nodeId {};
+                str >> nodeId;
+                node = meshDS->FindNode(nodeId);
+                if (!node) {
+                    throw Base::FileException("Invalid node in FEM mesh data");
+                }
+            }
+
+            if (entity == SMDSEntity_Polyhedra) {
+                uint32_t numQuantities {};
+                str >> numQuantities;
+                quantities.resize(numQuantities);
+                for (int& it : quantities) {
+                    int32_t value {};
+                    str >> value;
+                    it = value;
+                }
+                meshDS->AddPolyhedralVolumeWithID(nodes, quantities, id);
+            }
+            else if (entity == SMDSEntity_Ball) {
+                double diameter {};
+                str >> diameter;
+                SMESH_MeshEditor::ElemFeatures elemFeat;
+                elemFeat.Init(diameter);
+                elemFeat.SetID(id);
+                editor.AddElement(nodes, elemFeat);
+            }
+            else {
+                auto elemType = static_cast<SMDSAbs_ElementType>(type);
+                SMESH_MeshEditor::ElemFeatures elemFeat(elemType, isPoly);
+                elemFeat.SetID(id);
+                editor.AddElement(nodes, elemFeat);
+            }
+        }
+    }
+
+    // groups
+    uint32_t numGroups {};
+    str >> numGroups;
+    for (uint32_t i = 0; i < numGroups && str; ++i) {
+        std::string name = readString(str);
+        int32_t id {};
+        int32_t type {};
+        uint32_t numElements {};
+        str >> id >> type >> numElements;
+
+        auto groupType = static_cast<SMDSAbs_ElementType>(type);
+        int aId = id;
+        SMESH_Group* group = mesh->AddGroup(groupType, name.c_str(), aId);
+        auto groupDS = group ? dynamic_cast<SMESHDS_Group*>(group->GetGroupDS()) : nullptr;
+        for (uint32_t j = 0; j < numElements && str; ++j) {
+            int32_t elemId {};
+            str >> elemId;
+            const SMDS_MeshElement* elem = groupType == SMDSAbs_Node
+                ? meshDS->FindNode(elemId)
+                : meshDS->FindElement(elemId);
+            if (groupDS && elem) {
+                groupDS->SMDSGroup().Add(elem);
+            }
+        }
+    }
+
+    if (!str) {
+        throw Base::FileException("Truncated FEM mesh data");
+    }
+
+    meshDS->Modified();
+}
+
+}  // namespace
+
 void FemMesh::Save(Base::Writer& writer) const
 {
     if (!writer.isForceXML()) {
         // See SaveDocFile(), RestoreDocFile()
         writer.Stream() << writer.ind() << "<FemMesh file=\"";
-        writer.Stream() << writer.addFile("FemMesh.unv", this) << "\"";
+        writer.Stream() << writer.addFile("FemMesh.fmd", this) << "\"";
         writer.Stream() << " a11=\"" << _Mtrx[0][0] << "\" a12=\"" << _Mtrx[0][1] << "\" a13=\""
                         << _Mtrx[0][2] << "\" a14=\"" << _Mtrx[0][3] << "\"";
         writer.Stream() << " a21=\"" << _Mtrx[1][0] << "\" a22=\"" << _Mtrx[1][1] << "\" a23=\""
@@ -2412,24 +2859,17 @@ void FemMesh::Restore(Base::XMLReader& reader)
 
 void FemMesh::SaveDocFile(Base::Writer& writer) const
 {
-    // create a temporary file and copy the content to the zip stream
-    Base::FileInfo fi(App::Application::getTempFileName().c_str());
-
-    myMesh->ExportUNV(fi.filePath().c_str());
-
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    if (file) {
-        std::streambuf* buf = file.rdbuf();
-        writer.Stream() << buf;
-    }
-
-    file.close();
-    // remove temp file
-    fi.deleteFile();
+    writeMeshData(writer.Stream(), myMesh);
 }
 
 void FemMesh::RestoreDocFile(Base::Reader& reader)
 {
+    if (!Base::FileInfo(reader.getFileName()).hasExtension("unv")) {
+        readMeshData(reader, myMesh);
+        return;
+    }
+
+    // files of older versions contain the mesh in UNV format
     // create a temporary file and copy the content from the zip stream
     Base::FileInfo fi(App::Application::getTempFileName().c_str());
 
@@ -2449,15 +2889,24 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
-    // We perform a translation and rotation of the current active Mesh object
-    Base::Matrix4D clMatrix(rclTrf);
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
+    // We perform a translation and rotation of the current active Mesh object, the nodes are
+    // collected first to transform them with the vectorized batch multiplication
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<Base::Vector3d> points;
+    nodes.reserve(meshDS->NbNodes());
+    points.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
     for (; aNodeIter->more();) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = clMatrix * current_node;
-        myMesh->GetMeshDS()->MoveNode(aNode, current_node.x, current_node.y, current_node.z);
+        nodes.push_back(aNode);
+        points.emplace_back(aNode->X(), aNode->Y(), aNode->Z());
+    }
+
+    rclTrf.multVec(points);
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        meshDS->MoveNode(nodes[i], points[i].x, points[i].y, points[i].z);
     }
 }
 
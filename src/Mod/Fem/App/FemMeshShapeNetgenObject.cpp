@@ -23,6 +23,7 @@
 #include <SMESH_Version.h>
 
 #include <Python.h>
+#include <thread>
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
 
@@ -31,6 +32,7 @@
 # include <NETGENPlugin_Mesher.hxx>
 #endif
 
+#include <App/Application.h>
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -76,6 +78,13 @@ FemMeshShapeNetgenObject::FemMeshShapeNetgenObject()
         "allows defining the minimum number of mesh segments in which radii will be split"
     );
     ADD_PROPERTY_TYPE(Optimize, (true), "MeshParams", Prop_None, "Optimize the resulting mesh");
+    ADD_PROPERTY_TYPE(
+        ParallelMeshing,
+        (true),
+        "MeshParams",
+        Prop_None,
+        "Mesh the volumes of the solids concurrently once their shared surface mesh exists"
+    );
 }
 
 FemMeshShapeNetgenObject::~FemMeshShapeNetgenObject() = default;
@@ -111,6 +120,16 @@ App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
         tet->SetNbSegPerRadius(NbSegsPerRadius.getValue());
     }
     myNetGenMesher.SetParameters(tet);
+
+    // the surface mesh is built once for the whole shape, netgen then meshes the volumes of
+    // the solids in parallel on it, so the interfaces stay conforming
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/Netgen"
+    );
+    int threads = static_cast<int>(
+        hGrp->GetInt("NumOfThreads", static_cast<long>(std::thread::hardware_concurrency()))
+    );
+    myNetGenMesher.SetParallelMeshing(ParallelMeshing.getValue(), threads);
     newMesh.getSMesh()->ShapeToMesh(shape);
 
     myNetGenMesher.Compute();
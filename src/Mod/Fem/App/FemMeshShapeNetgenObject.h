@@ -45,6 +45,7 @@ public:
     App::PropertyInteger NbSegsPerEdge;
     App::PropertyInteger NbSegsPerRadius;
     App::PropertyBool Optimize;
+    App::PropertyBool ParallelMeshing;
 
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
@@ -23,6 +23,7 @@
 #include <Python.h>
 #include <vtkDoubleArray.h>
 #include <vtkPointData.h>
+#include <vtkSMPTools.h>
 #include <vtkAlgorithm.h>
 #include <vtkAlgorithmOutput.h>
 #include <vtkUnstructuredGrid.h>
@@ -978,16 +979,14 @@ void FemPostContoursFilter::onChanged(const Property* prop)
             vtkIdType numTuples = pdata->GetNumberOfTuples();
             componentArray->SetNumberOfTuples(numTuples);
 
-            if (component >= 0) {
-                for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
-                    componentArray->SetComponent(tupleIdx, 0, pdata->GetComponent(tupleIdx, component));
-                }
-            }
-            else {
-                for (vtkIdType tupleIdx = 0; tupleIdx < numTuples; ++tupleIdx) {
-                    componentArray->SetComponent(
+            vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType tupleIdx = begin; tupleIdx < end; ++tupleIdx) {
+                    if (component >= 0) {
+                        componentArray->SetValue(tupleIdx, pdata->GetComponent(tupleIdx, component));
+                        continue;
+                    }
+                    componentArray->SetValue(
                         tupleIdx,
-                        0,
                         std::sqrt(
                             pdata->GetComponent(tupleIdx, 0) * pdata->GetComponent(tupleIdx, 0)
                             + pdata->GetComponent(tupleIdx, 1) * pdata->GetComponent(tupleIdx, 1)
@@ -995,7 +994,7 @@ void FemPostContoursFilter::onChanged(const Property* prop)
                         )
                     );
                 }
-            }
+            });
             // name the array
             contourFieldName = std::string(Field.getValueAsString()) + "_contour";
             componentArray->SetName(contourFieldName.c_str());
@@ -21,10 +21,14 @@
  ***************************************************************************/
 
 #include <vtkDataSet.h>
+#include <vtkSMPTools.h>
+#include <vtkVersionMacros.h>
 #include <vtkXMLDataSetWriter.h>
 #include <vtkXMLMultiBlockDataWriter.h>
 #include <vtkTransform.h>
 
+#include <App/Application.h>
+#include <Base/Console.h>
 #include <Base/Exception.h>
 
 #include "FemPostObject.h"
@@ -70,6 +74,28 @@ vtkDataSet* FemPostObject::getDataSet()
     return nullptr;
 }
 
+void FemPostObject::configureParallelism()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/InOutVtk"
+    );
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 1, 0)
+    // empty keeps the backend VTK was built with or the one set by VTK_SMP_BACKEND_IN_USE
+    std::string backend = hGrp->GetASCII("SMPBackend", "");
+    if (!backend.empty() && !vtkSMPTools::SetBackend(backend.c_str())) {
+        Base::Console().warning(
+            "VTK SMP backend '%s' is not available, using '%s'\n",
+            backend.c_str(),
+            vtkSMPTools::GetBackend()
+        );
+    }
+#endif
+
+    // 0 lets the backend use all the cores
+    vtkSMPTools::Initialize(static_cast<int>(hGrp->GetInt("SMPThreads", 0)));
+}
+
 vtkBoundingBox FemPostObject::getBoundingBox()
 {
 
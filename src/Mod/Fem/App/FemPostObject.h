@@ -60,6 +60,11 @@ public:
     vtkBoundingBox getBoundingBox();
     void writeVTK(const char* filename) const;
 
+    /// Selects the VTK SMP backend and its number of threads from the SMPBackend and
+    /// SMPThreads parameters of Mod/Fem/InOutVtk. Filters that use vtkSMPTools pick it up
+    /// on their next execution.
+    static void configureParallelism();
+
 protected:
     // placement is applied via transform filter. However, we do not know
     // how this filter should be used to create data. This is to be implemented
@@ -559,7 +559,7 @@ void FemPostPipeline::setTimeInfo(const std::string& frameType, const Base::Unit
         return;
     }
 
-    auto multiblock = vtkMultiBlockDataSet::SafeDownCast(data);
+    auto multiblock = vtkMultiBlockDataSet::SafeDownCast(Data.startEditing());
     auto timeInfo = vtkSmartPointer<vtkStringArray>::New();
     timeInfo->SetName("TimeInfo");
     timeInfo->InsertNextValue(frameType);
@@ -581,6 +581,7 @@ void FemPostPipeline::setTimeInfo(const std::string& frameType, const Base::Unit
             }
         }
     }
+    Data.finishEditing();
 
     updateFrameValues();
 }
@@ -735,11 +736,11 @@ void FemPostPipeline::onDocumentRestored()
 void FemPostPipeline::renameArrays(const std::map<std::string, std::string>& names)
 {
     std::vector<vtkSmartPointer<vtkDataSet>> fields;
-    auto data = Data.getValue();
-    if (!data) {
+    if (!Data.getValue()) {
         return;
     }
 
+    auto data = Data.startEditing();
     if (auto dataSet = vtkDataSet::SafeDownCast(data)) {
         fields.emplace_back(dataSet);
     }
@@ -761,14 +762,18 @@ void FemPostPipeline::renameArrays(const std::map<std::string, std::string>& nam
         }
     }
 
-    Data.touch();
+    Data.finishEditing();
 }
 
 void FemPostPipeline::addArrayFromFunction(const std::map<std::string, std::string>& functions)
 {
-    auto data = Data.getValue();
+    if (!Data.getValue()) {
+        return;
+    }
+
+    vtkSmartPointer<vtkDataObject> data = Data.startEditing();
     FemVTKTools::addArrayFromFunction(data, functions);
-    Data.setValue(data);
+    Data.finishEditing();
 }
 
 PyObject* FemPostPipeline::getPyObject()
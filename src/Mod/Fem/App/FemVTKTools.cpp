@@ -23,11 +23,18 @@
 
 
 #include <Python.h>
+#include <algorithm>
+#include <array>
 #include <charconv>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <string_view>
+#include <vector>
+#include <QFile>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -54,6 +61,7 @@
 #include <vtkQuadraticTetra.h>
 #include <vtkQuadraticTriangle.h>
 #include <vtkQuadraticWedge.h>
+#include <vtkSMPTools.h>
 #include <vtkStringArray.h>
 #include <vtkTetra.h>
 #include <vtkTriangle.h>
@@ -70,6 +78,7 @@
 #include <App/DocumentObject.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/TimeInfo.h>
 #include <Base/Type.h>
 
@@ -147,6 +156,18 @@ void fillMeshElementIds(vtkCell* cell, std::vector<int>& ids)
     }
 }
 
+// VTK point of every entry of a FreeCAD result list, the lists follow the node iteration order
+std::vector<vtkIdType> resultPointIds(const SMESHDS_Mesh* meshDS)
+{
+    std::vector<vtkIdType> ids;
+    ids.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+    while (aNodeIter->more()) {
+        ids.push_back(aNodeIter->next()->GetID() - 1);
+    }
+    return ids;
+}
+
 }  // namespace
 
 
@@ -480,16 +501,20 @@ void FemVTKTools::exportVTKMesh(
     vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
     SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
 
+    // memory is allocated by VTK points size for max node id, not for point count
+    // if the SMESH mesh has gaps in node numbering, points without any element
+    // assignment will be inserted in these point gaps too
+    // this needs to be taken into account on node mapping when FreeCAD FEM results
+    // are exported to vtk
+    if (meshDS->NbNodes() > 0) {
+        points->SetNumberOfPoints(meshDS->MaxNodeID());
+        points->GetData()->Fill(0.0);
+    }
     while (aNodeIter->more()) {
         const SMDS_MeshNode* node = aNodeIter->next();  // why float, not double?
         double coords[3]
             = {double(node->X() * scale), double(node->Y() * scale), double(node->Z() * scale)};
-        points->InsertPoint(node->GetID() - 1, coords);
-        // memory is allocated by VTK points size for max node id, not for point count
-        // if the SMESH mesh has gaps in node numbering, points without any element
-        // assignment will be inserted in these point gaps too
-        // this needs to be taken into account on node mapping when FreeCAD FEM results
-        // are exported to vtk
+        points->SetPoint(node->GetID() - 1, coords);
     }
     grid->SetPoints(points);
     // nodes debugging
@@ -818,9 +843,7 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
     // NodeNumbers
     const vtkIdType nPoints = dataset->GetNumberOfPoints();
     std::vector<long> nodeIds(nPoints);
-    for (vtkIdType i = 0; i < nPoints; ++i) {
-        nodeIds[i] = i + 1;
-    }
+    std::iota(nodeIds.begin(), nodeIds.end(), 1L);
     static_cast<App::PropertyIntegerList*>(result->getPropertyByName("NodeNumbers"))->setValues(nodeIds);
     Base::Console().log("    NodeNumbers have been filled with values.\n");
 
@@ -835,11 +858,15 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
             );
             if (vector_list) {
                 std::vector<Base::Vector3d> vec(nPoints);
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    double* p = vector_field->GetTuple(i);  // both vtkFloatArray and vtkDoubleArray
-                                                            // return double* for GetTuple(i)
-                    vec[i] = (Base::Vector3d(p[0], p[1], p[2]));
-                }
+                vtkIdType count = std::min(nPoints, vector_field->GetNumberOfTuples());
+                vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+                    // GetTuple(i, p) does not share a buffer between threads like GetTuple(i)
+                    double p[3];
+                    for (vtkIdType i = begin; i < end; ++i) {
+                        vector_field->GetTuple(i, p);
+                        vec[i] = Base::Vector3d(p[0], p[1], p[2]);
+                    }
+                });
                 // PropertyVectorList will not show up in PropertyEditor
                 vector_list->setValues(vec);
                 Base::Console().log(
@@ -880,18 +907,13 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
                 continue;
             }
 
-            double vmin = 1.0e100, vmax = -1.0e100;
             std::vector<double> values(nPoints, 0.0);
-            for (vtkIdType i = 0; i < vec->GetNumberOfTuples(); i++) {
-                double v = *(vec->GetTuple(i));
-                values[i] = v;
-                if (v > vmax) {
-                    vmax = v;
-                }
-                if (v < vmin) {
-                    vmin = v;
+            vtkIdType count = std::min(nPoints, vec->GetNumberOfTuples());
+            vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType i = begin; i < end; ++i) {
+                    values[i] = vec->GetComponent(i, 0);
                 }
-            }
+            });
             field->setValues(values);
             Base::Console().log(
                 "    A PropertyFloatList has been filled with vales: %s\n",
@@ -934,6 +956,7 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
     }
     const SMESH_Mesh* smesh = static_cast<FemMeshObject*>(meshObj)->FemMesh.getValue().getSMesh();
     const SMESHDS_Mesh* meshDS = smesh->GetMeshDS();
+    const std::vector<vtkIdType> pointIds = resultPointIds(meshDS);
 
     // all result object meshes are in mm therefore for e.g. length outputs like
     // displacement we must divide by 1000
@@ -961,10 +984,7 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
             // TODO: ensure that the result bar does not include the used 0 if it is not
             // part of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
-                double tuple[] = {0, 0, 0};
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetTuple(i, tuple);
-                }
+                data->Fill(0.0);
             }
 
             if (it.first.compare("DisplacementVectors") == 0) {
@@ -974,12 +994,16 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
                 factor = 1.0;
             }
 
-            SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
-            for (const auto& jt : vel) {
-                const SMDS_MeshNode* node = aNodeIter->next();
-                double tuple[] = {jt.x * factor, jt.y * factor, jt.z * factor};
-                data->SetTuple(node->GetID() - 1, tuple);
-            }
+            double* raw = data->GetPointer(0);
+            auto count = static_cast<vtkIdType>(std::min(vel.size(), pointIds.size()));
+            vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType i = begin; i < end; ++i) {
+                    double* tuple = raw + dim * pointIds[i];
+                    tuple[0] = vel[i].x * factor;
+                    tuple[1] = vel[i].y * factor;
+                    tuple[2] = vel[i].z * factor;
+                }
+            });
             grid->GetPointData()->AddArray(data);
             Base::Console().log(
                 "    The PropertyVectorList %s was exported to VTK vector list: %s\n",
@@ -1016,9 +1040,7 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
             // TODO: ensure that the result bar does not include the used 0 if it is not part
             // of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetValue(i, 0);
-                }
+                data->Fill(0.0);
             }
 
             if ((scalar.first.compare("MaxShear") == 0) || (scalar.first.compare("NodeStressXX") == 0)
@@ -1041,14 +1063,14 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
                 factor = 1.0;
             }
 
-            SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
-            for (double i : vec) {
-                const SMDS_MeshNode* node = aNodeIter->next();
-                // for the MassFlowRate the last vec entries can be a nullptr, thus check this
-                if (node) {
-                    data->SetValue(node->GetID() - 1, i * factor);
+            // for the MassFlowRate the list can be longer than the number of nodes
+            double* raw = data->GetPointer(0);
+            auto count = static_cast<vtkIdType>(std::min(vec.size(), pointIds.size()));
+            vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType i = begin; i < end; ++i) {
+                    raw[pointIds[i]] = vec[i] * factor;
                 }
-            }
+            });
 
             grid->GetPointData()->AddArray(data);
             Base::Console().log(
@@ -1233,28 +1255,190 @@ size_t getFirstNotBlankPos(const std::string_view& view)
     return pos;
 }
 
-// get n-digits value from string_view
-// not used until libc++ std::from_chars supports double values
-// template<typename T>
-// void valueFromLine(const std::string_view::const_iterator& it, int digits, T& value)
-//{
-//    std::string_view sub(it, digits);
-//    auto pos = getFirstNotBlankPos(sub);
-//    std::from_chars(sub.data() + pos, sub.data() + digits, value, 10);
-//}
-template<typename T>
-void valueFromLine(const std::string_view::iterator& it, int digits, T& value)
+// get the fixed-width field of a line, the part beyond the end of the line is cut off
+std::string_view getField(std::string_view line, size_t pos, size_t width)
+{
+    if (pos >= line.size()) {
+        return {};
+    }
+    return line.substr(pos, width);
+}
+
+// get the text of a field without trailing spaces
+std::string getName(std::string_view field)
+{
+    return std::string(field.substr(0, field.find_last_not_of(' ') + 1));
+}
+
+// get integer value of a field, a blank field gives 0
+long toInt(std::string_view field)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtol(sub.data(), nullptr, 10);
+    long value {0};
+    auto pos = getFirstNotBlankPos(field);
+    std::from_chars(field.data() + pos, field.data() + field.size(), value, 10);
+    return value;
 }
-template<>
-void valueFromLine<double>(const std::string_view::iterator& it, int digits, double& value)
+
+// get floating point value of a field like " 1.23456E+02"
+// std::from_chars isn't available for double with libc++, and std::strtod needs a terminated
+// string. Mantissas of up to 15 digits and powers of ten up to 1e22 are exact as double, so
+// the common case is correctly rounded without a copy. Anything else goes to std::strtod.
+double toReal(std::string_view field)
 {
-    std::string_view sub(&*it, digits);
-    value = std::strtof(sub.data(), nullptr);
+    static constexpr std::array<double, 23> powers {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    auto isDigit = [](char c) {
+        return c >= '0' && c <= '9';
+    };
+
+    const char* it = field.data();
+    const char* end = it + field.size();
+    while (it != end && *it == ' ') {
+        ++it;
+    }
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+
+    std::uint64_t mantissa {0};
+    int digits {0};
+    int exponent {0};
+    for (; it != end && isDigit(*it); ++it, ++digits) {
+        mantissa = mantissa * 10 + (*it - '0');
+    }
+    if (it != end && *it == '.') {
+        for (++it; it != end && isDigit(*it); ++it, ++digits, --exponent) {
+            mantissa = mantissa * 10 + (*it - '0');
+        }
+    }
+    if (it != end && (*it == 'E' || *it == 'e')) {
+        ++it;
+        bool negExp = false;
+        if (it != end && (*it == '-' || *it == '+')) {
+            negExp = *it == '-';
+            ++it;
+        }
+        int exp {0};
+        for (; it != end && isDigit(*it) && exp < 10000; ++it) {
+            exp = exp * 10 + (*it - '0');
+        }
+        exponent += negExp ? -exp : exp;
+    }
+
+    if (it != end || digits > 15 || exponent < -22 || exponent > 22) {
+        std::string copy(field);
+        return std::strtod(copy.c_str(), nullptr);
+    }
+
+    auto value = static_cast<double>(mantissa);
+    value = exponent < 0 ? value / powers[-exponent] : value * powers[exponent];
+    return negative ? -value : value;
 }
 
+// Maps the content of a file into memory, so that it can be parsed without copying it first.
+class FileContent
+{
+public:
+    explicit FileContent(const Base::FileInfo& fi)
+        : file(QString::fromStdString(fi.filePath()))
+    {
+        if (file.open(QIODevice::ReadOnly) && file.size() > 0) {
+            content = file.map(0, file.size());
+            if (!content) {
+                // not every file system supports mapping
+                buffer = file.readAll();
+            }
+        }
+    }
+
+    std::string_view view() const
+    {
+        if (content) {
+            return {reinterpret_cast<const char*>(content), std::size_t(file.size())};  // NOLINT
+        }
+        return {buffer.constData(), std::size_t(buffer.size())};
+    }
+
+private:
+    QFile file;
+    uchar* content {nullptr};
+    QByteArray buffer;
+};
+
+// Hands out the lines of the file content without copying them
+class LineReader
+{
+public:
+    explicit LineReader(std::string_view content)
+        : content(content)
+    {}
+
+    bool next(std::string_view& line)
+    {
+        if (pos >= content.size()) {
+            return false;
+        }
+        size_t end = content.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = content.size();
+        }
+        line = content.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        pos = end + 1;
+        return true;
+    }
+
+    size_t offset() const
+    {
+        return std::min(pos, content.size());
+    }
+
+private:
+    std::string_view content;
+    size_t pos {0};
+};
+
+// Position of the CalculiX node numbers in vtkPoints. The numbers don't have to start at 1 or
+// be contiguous, but are dense enough in practice to be used as index of a vector.
+class NodeIndex
+{
+public:
+    void add(long node, vtkIdType id)
+    {
+        if (node < 0) {
+            return;
+        }
+        if (static_cast<size_t>(node) >= index.size()) {
+            index.resize(node + 1, -1);
+        }
+        index[node] = id;
+        ++count;
+    }
+
+    vtkIdType find(long node) const
+    {
+        if (node < 0 || static_cast<size_t>(node) >= index.size()) {
+            return -1;
+        }
+        return index[node];
+    }
+
+    vtkIdType size() const
+    {
+        return count;
+    }
+
+private:
+    std::vector<vtkIdType> index;
+    vtkIdType count {0};
+};
+
 // add cell from sorted nodes
 template<typename T>
 void addCell(vtkCellArray* cellArray, const std::vector<int>& topoElem)
@@ -1387,78 +1571,48 @@ std::vector<size_t> identifyScalarEntities(const std::vector<std::vector<int>> e
 }
 
 // read nodes and fill vtkPoints object
-std::map<int, int> readNodes(
-    std::ifstream& ifstr,
-    const std::string& lines,
-    vtkSmartPointer<vtkPoints>& points
-)
+void readNodes(LineReader& reader, std::string_view header, vtkPoints* points, NodeIndex& nodes)
 {
-    std::string keyCode = "    2C";
-    std::string keyCodeCoord = " -1";
-    long numNodes {0};
-    int indicator {0};
-    int node {0};
-    long nodeID = 0;
-
-    // frd file might have nodes that are not numbered starting from zero.
-    // Use the map to identify them
-    std::map<int, int> mapNodes;
-
-    std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 18);
-
-    valueFromLine(sub.begin(), 12, numNodes);
-
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
-    int digits = getDigits(static_cast<Indicator>(indicator));
+    std::string_view keyCodeCoord = " -1";
+    long numNodes = toInt(getField(header, 24, 12));
+    int digits = getDigits(static_cast<Indicator>(toInt(getField(header, 73, 1))));
 
     points->SetNumberOfPoints(numNodes);
 
-    std::string line;
-    while (nodeID < numNodes && std::getline(ifstr, line)) {
-        std::vector<double> coords;
-        std::string_view view {line};
-        if (view.rfind(keyCodeCoord, 0) == 0) {
-            std::string_view v(line.data() + keyCodeCoord.length(), digits);
-            valueFromLine(v.begin(), digits, node);
-
-            std::string_view vi = view.substr(keyCodeCoord.length() + digits);
-            double value;
-            for (auto it = vi.begin(); it != vi.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                coords.emplace_back(value);
-            }
+    std::string_view line;
+    vtkIdType nodeID = 0;
+    while (nodeID < numNodes && reader.next(line)) {
+        if (line.rfind(keyCodeCoord, 0) != 0) {
+            continue;
+        }
+        long node = toInt(getField(line, keyCodeCoord.length(), digits));
+        size_t pos = keyCodeCoord.length() + digits;
+        double coords[3];
+        for (double& value : coords) {
+            value = toReal(getField(line, pos, 12));
+            pos += 12;
         }
 
-        points->SetPoint(nodeID, coords.data());
-        mapNodes[node] = nodeID++;
+        points->SetPoint(nodeID, coords);
+        nodes.add(node, nodeID++);
     }
-
-    return mapNodes;
 }
 
 // fill elements and fill cell array
 std::vector<int> readElements(
-    std::ifstream& ifstr,
-    const std::string& lines,
-    const std::map<int, int>& mapNodes,
+    LineReader& reader,
+    std::string_view header,
+    const NodeIndex& nodes,
     vtkCellArray* cellArray,
     vtkIntArray* material,
     vtkIntArray* group
 )
 {
-    std::string line;
-    std::string keyCode = "    3C";
-    std::string keyCodeType = " -1";
-    std::string keyCodeNodes = " -2";
-    long numElem;
-    int indicator;
-    int elem;
+    std::string_view keyCodeType = " -1";
+    std::string_view keyCodeNodes = " -2";
     long elemID = 0;
     // element info: {type, group, material}
     std::vector<int> info(3);
-    std::map<int, int> mapElem;
     std::vector<int> topoElem;
     std::vector<int> vtkType;
 
@@ -1468,33 +1622,30 @@ std::vector<int> readElements(
     group->SetNumberOfComponents(1);
     group->SetName("Group");
 
-    std::string_view view {lines};
-
-    std::string_view sub = view.substr(keyCode.length() + 18);
-    valueFromLine(sub.begin(), 12, numElem);
-
-    sub = sub.substr(12 + 37);
-    valueFromLine(sub.begin(), 1, indicator);
-    int digits = getDigits(static_cast<Indicator>(indicator));
-    while (elemID < numElem && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(keyCodeType, 0) == 0) {
-            std::string_view v(line.data() + keyCodeType.length());
-            valueFromLine(v.begin(), digits, elem);
-            v = v.substr(digits);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = v.begin(), it2 = info.begin(); it1 != v.end() && it2 != info.end();
-                 it1 += 5, ++it2) {
-                valueFromLine(it1, 5, *it2);
+    long numElem = toInt(getField(header, 24, 12));
+    int digits = getDigits(static_cast<Indicator>(toInt(getField(header, 73, 1))));
+
+    std::string_view line;
+    while (elemID < numElem && reader.next(line)) {
+        if (line.rfind(keyCodeType, 0) == 0) {
+            size_t pos = keyCodeType.length() + digits;
+            for (int& value : info) {
+                value = static_cast<int>(toInt(getField(line, pos, 5)));
+                pos += 5;
             }
+            topoElem.clear();
         }
-        if (view.rfind(keyCodeNodes, 0) == 0) {
-            std::string_view vi = view.substr(keyCodeNodes.length());
-            int node;
-            for (auto it = vi.begin(); it != vi.end(); it += digits) {
-                valueFromLine(it, digits, node);
-                topoElem.emplace_back(mapNodes.at(node));
+        else if (line.rfind(keyCodeNodes, 0) == 0) {
+            for (size_t pos = keyCodeNodes.length(); pos < line.size(); pos += digits) {
+                std::string_view field = getField(line, pos, digits);
+                if (field.find_first_not_of(' ') == std::string_view::npos) {
+                    continue;
+                }
+                vtkIdType id = nodes.find(toInt(field));
+                if (id < 0) {
+                    throw Base::FileException("File to load not readable");
+                }
+                topoElem.emplace_back(static_cast<int>(id));
             }
 
             // add cell to cellArray
@@ -1503,218 +1654,155 @@ std::vector<int> readElements(
                 group->InsertNextValue(info[1]);
                 material->InsertNextValue(info[2]);
                 topoElem.clear();
-                mapElem[elem] = elemID++;
+                ++elemID;
             }
         }
     }
     return vtkType;
 }
 
-// read parameter header (not used)
-void readParameter([[maybe_unused]] std::ifstream& ifstr, [[maybe_unused]] const std::string& line)
-{}
-
 // read first header from nodal result block
-void readResultInfo([[maybe_unused]] std::ifstream& ifstr, const std::string& lines, FRDResultInfo& info)
+FRDResultInfo readResultInfo(std::string_view line)
 {
-    std::string keyCode = "  100C";
-
-    std::string_view view {lines};
-    std::string_view sub = view.substr(keyCode.length() + 6);
-    valueFromLine(sub.begin(), 12, info.value);
-
-    sub = sub.substr(12);
-    valueFromLine(sub.begin(), 12, info.numNodes);
-
-    sub = sub.substr(12 + 20);
-    int anType;
-    valueFromLine(sub.begin(), 2, anType);
-    info.analysisType = static_cast<AnalysisType>(anType);
+    FRDResultInfo info;
+    info.value = toReal(getField(line, 12, 12));
+    info.numNodes = toInt(getField(line, 24, 12));
+    info.analysisType = static_cast<AnalysisType>(toInt(getField(line, 56, 2)));
+    info.step = static_cast<int>(toInt(getField(line, 58, 5)));
+    info.indicator = static_cast<Indicator>(toInt(getField(line, 73, 2)));
+    return info;
+}
 
-    sub = sub.substr(2);
-    valueFromLine(sub.begin(), 5, info.step);
+// position of a nodal result block in the file content
+struct FRDResultBlock
+{
+    FRDResultInfo info;
+    // lines after the "  100C" header up to and including the closing " -3"
+    std::string_view content;
+};
 
-    sub = sub.substr(5 + 10);
-    int ind;
-    valueFromLine(sub.begin(), 2, ind);
-    info.indicator = static_cast<Indicator>(ind);
-}
+// result arrays of a nodal result block
+struct FRDResults
+{
+    std::vector<vtkSmartPointer<vtkDoubleArray>> arrays;
+    std::vector<long> invalidNodes;
+};
 
-// read result from nodal result block and add result array to grid
-void readResults(
-    std::ifstream& ifstr,
-    [[maybe_unused]] const std::string& lines,
-    const std::map<int, int>& mapNodes,
-    const FRDResultInfo& info,
-    vtkSmartPointer<vtkUnstructuredGrid>& grid
-)
+// read result from nodal result block
+// Doesn't touch anything but the block itself so that blocks can be read in parallel.
+FRDResults readResults(const FRDResultBlock& block, const NodeIndex& nodes)
 {
-    int digits = getDigits(info.indicator);
+    FRDResults results;
+    LineReader reader(block.content);
+    std::string_view line;
+    int digits = getDigits(block.info.indicator);
 
     // get dataset info, start with " -4"
-    std::string line;
-    std::string keyDataSet = " -4";
-    unsigned int numComps;
-    std::getline(ifstr, line);
-    std::string_view view = line;
-    std::string_view sub = view.substr(keyDataSet.length() + 2);
-    std::string dataSetName {sub.substr(0, 8)};
-    // remove trailing spaces
-    dataSetName.erase(dataSetName.find_last_not_of(" ") + 1);
-    sub = sub.substr(8);
-    valueFromLine(sub.begin(), 5, numComps);
+    std::string_view keyDataSet = " -4";
+    while (reader.next(line) && line.rfind(keyDataSet, 0) != 0) {}
+    std::string dataSetName = getName(getField(line, keyDataSet.length() + 2, 8));
+    auto numComps = static_cast<unsigned int>(toInt(getField(line, keyDataSet.length() + 10, 5)));
 
     // get entity info
-    std::string keyEntity = " -5";
+    std::string_view keyEntity = " -5";
     std::vector<std::string> entityNames;
     // type: 1: scalar; 2: vector; 4: matrix; 12: vector (3 amp - 3 phase); 14: tensor (6 amp - 6
     // phase) {type, row, col, exist}
     std::vector<std::vector<int>> entityTypes;
     unsigned int countComp = 0;
-    while (countComp < numComps && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(keyEntity, 0) == 0) {
-            sub = view.substr(keyEntity.length() + 2);
-            std::string en {sub.substr(0, 8)};
-            // remove trailing spaces
-            en.erase(en.find_last_not_of(" ") + 1);
-            std::vector<int> et = {0, 0, 0, 0};
-            // fill entityType, ignore MENU: "    1"
-            sub = sub.substr(8 + 5, 4 * 5);
-            std::string_view::iterator it1;
-            std::vector<int>::iterator it2;
-            for (it1 = sub.begin(), it2 = et.begin(); it1 != sub.end() && it2 != et.end();
-                 (it1 += 5), ++it2) {
-                valueFromLine(it1, digits, *it2);
-            }
+    while (countComp < numComps && reader.next(line)) {
+        if (line.rfind(keyEntity, 0) != 0) {
+            continue;
+        }
+        std::string en = getName(getField(line, keyEntity.length() + 2, 8));
+        // fill entityType, ignore MENU: "    1"
+        std::vector<int> et = {0, 0, 0, 0};
+        size_t pos = keyEntity.length() + 2 + 8 + 5;
+        for (int& value : et) {
+            value = static_cast<int>(toInt(getField(line, pos, 5)));
+            pos += 5;
+        }
 
-            if (et[3] == 0) {
-                // ignore predefined entity
-                entityNames.emplace_back(en);
-                entityTypes.emplace_back(et);
-            }
-            ++countComp;
+        if (et[3] == 0) {
+            // ignore predefined entity
+            entityNames.emplace_back(en);
+            entityTypes.emplace_back(et);
         }
+        ++countComp;
     }
 
     // used components
     numComps = entityNames.size();
+    if (numComps == 0) {
+        return results;
+    }
 
-    // enter in node values block
-    std::string code1 = " -1";
-    std::string code2 = " -2";
-    int node {-1};
-    double value {0.0};
-    std::vector<double> vecValues;
-    std::vector<double> scaValues;
-    std::vector<int> nodes;
-    int countNodes = 0;
-    size_t countScaPos {0};
     // result block could have both vector/matrix and scalar components
     // save each scalars entity in his own array
     auto scalarPos = identifyScalarEntities(entityTypes);
-    // array for vector entities (if needed)
-    vtkSmartPointer<vtkDoubleArray> vecArray = vtkSmartPointer<vtkDoubleArray>::New();
-    // arrays for scalar entities (if needed)
-    std::vector<vtkSmartPointer<vtkDoubleArray>> scaArrays;
-    for (size_t i = 0; i < scalarPos.size(); ++i) {
-        scaArrays.emplace_back(vtkSmartPointer<vtkDoubleArray>::New());
-    }
-
-    vecArray->SetNumberOfComponents(numComps - scalarPos.size());
-    vecArray->SetNumberOfTuples(mapNodes.size());
-    vecArray->SetName(dataSetName.c_str());
-    // set all values to zero
-    for (int i = 0; i < vecArray->GetNumberOfComponents(); ++i) {
-        vecArray->FillComponent(i, 0.0);
-    }
-    //    vecArray->Fill(0.0);
-    for (size_t i = 0; i < scaArrays.size(); ++i) {
-        scaArrays[i]->SetNumberOfComponents(1);
-        scaArrays[i]->SetNumberOfTuples(mapNodes.size());
-        std::string name = entityNames[scalarPos[i]];
-        scaArrays[i]->SetName(name.c_str());
-        //        scaArrays[i]->Fill(0.0);
-        for (int j = 0; j < scaArrays[i]->GetNumberOfComponents(); ++j) {
-            scaArrays[i]->FillComponent(j, 0.0);
-        }
-    }
-
-    while (countNodes < info.numNodes && std::getline(ifstr, line)) {
-        std::string_view view {line};
-        if (view.rfind(code1, 0) == 0) {
-            sub = view.substr(code1.length());
-            valueFromLine(sub.begin(), digits, node);
-            // clear values vector for each node result block
-            vecValues.clear();
-            scaValues.clear();
-            countScaPos = 0;
-            try {
-                // result nodes could not exist in .frd file due to element expansion
-                // so mapNodes.at() could throw an exception
-                nodes.emplace_back(mapNodes.at(node));
-                sub = sub.substr(digits);
-                for (auto it = sub.begin(); it != sub.end(); it += 12, ++countScaPos) {
-                    valueFromLine(it, 12, value);
-                    // search if value is scalar or vector/matrix component
-                    auto pos = std::ranges::find(scalarPos, countScaPos);
-                    if (pos == scalarPos.end()) {
-                        vecValues.emplace_back(value);
-                    }
-                    else {
-                        scaValues.emplace_back(value);
-                    }
-                }
-            }
-            catch (const std::out_of_range&) {
-                Base::Console().warning("Invalid node: %d\n", node);
-            }
-            ++countNodes;
-        }
-        else if (view.rfind(code2, 0) == 0) {
-            sub = view.substr(code2.length() + digits);
-            for (auto it = sub.begin(); it != sub.end(); it += 12) {
-                valueFromLine(it, 12, value);
-                // search if value is scalar or vector/matrix component
-                auto pos = std::ranges::find(scalarPos, countScaPos);
-                if (pos == scalarPos.end()) {
-                    vecValues.emplace_back(value);
-                }
-                else {
-                    scaValues.emplace_back(value);
-                }
+    vtkIdType numTuples = nodes.size();
+    int numVecComps = static_cast<int>(numComps - scalarPos.size());
+
+    // destination of each component: pointer to the value of the first tuple and stride
+    std::vector<std::pair<double*, int>> targets(numComps);
+    if (numVecComps > 0) {
+        auto vecArray = vtkSmartPointer<vtkDoubleArray>::New();
+        vecArray->SetNumberOfComponents(numVecComps);
+        vecArray->SetNumberOfTuples(numTuples);
+        vecArray->SetName(dataSetName.c_str());
+        double* values = vecArray->GetPointer(0);
+        std::fill_n(values, numTuples * numVecComps, 0.0);
+        int comp = 0;
+        for (size_t i = 0; i < numComps; ++i) {
+            if (std::ranges::find(scalarPos, i) == scalarPos.end()) {
+                targets[i] = {values + comp++, numVecComps};
             }
         }
-        if ((vecValues.size() + scaValues.size()) == numComps) {
-            if (!vecValues.empty()) {
-                if (node == -1) {
-                    throw Base::FileException("File to load not readable");
-                }
-                vecArray->SetTuple(mapNodes.at(node), vecValues.data());
-            }
-            if (!scaValues.empty()) {
-                if (node == -1) {
-                    throw Base::FileException("File to load not readable");
-                }
-                std::vector<vtkSmartPointer<vtkDoubleArray>>::iterator it1;
-                std::vector<double>::iterator it2;
-                for (it1 = scaArrays.begin(), it2 = scaValues.begin();
-                     it1 != scaArrays.end() && it2 != scaValues.end();
-                     ++it1, ++it2) {
-                    (*it1)->SetTuple1(mapNodes.at(node), *it2);
-                }
+        results.arrays.emplace_back(vecArray);
+    }
+    for (size_t pos : scalarPos) {
+        auto scaArray = vtkSmartPointer<vtkDoubleArray>::New();
+        scaArray->SetNumberOfComponents(1);
+        scaArray->SetNumberOfTuples(numTuples);
+        scaArray->SetName(entityNames[pos].c_str());
+        double* values = scaArray->GetPointer(0);
+        std::fill_n(values, numTuples, 0.0);
+        targets[pos] = {values, 1};
+        results.arrays.emplace_back(scaArray);
+    }
+
+    // enter in node values block, a node starts with " -1" and continues with " -2"
+    std::string_view code1 = " -1";
+    std::string_view code2 = " -2";
+    vtkIdType id {-1};
+    size_t comp {0};
+    while (reader.next(line)) {
+        if (line.rfind(code1, 0) == 0) {
+            // result nodes could not exist in .frd file due to element expansion
+            long node = toInt(getField(line, code1.length(), digits));
+            id = nodes.find(node);
+            if (id < 0) {
+                results.invalidNodes.emplace_back(node);
             }
+            comp = 0;
+        }
+        else if (line.rfind(code2, 0) != 0) {
+            continue;
+        }
+        if (id < 0) {
+            continue;
         }
-    }
 
-    // add vecArray only if not all scalars
-    if (numComps != scalarPos.size()) {
-        grid->GetPointData()->AddArray(vecArray);
-    }
-    for (auto& s : scaArrays) {
-        grid->GetPointData()->AddArray(s);
+        for (size_t pos = code1.length() + digits; pos < line.size() && comp < numComps;
+             pos += 12, ++comp) {
+            const auto& [values, stride] = targets[comp];
+            values[id * stride] = toReal(getField(line, pos, 12));
+        }
     }
+
+    return results;
 }
+
 vtkSmartPointer<vtkStringArray> createTimeInfo(const std::string& type)
 {
     auto timeInfo = vtkSmartPointer<vtkStringArray>::New();
@@ -1735,58 +1823,89 @@ vtkSmartPointer<vtkFloatArray> createTimeValue(const double& value)
     return stepValue;
 }
 
-vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
+// Content of a .frd file. The mesh is read at once while the result blocks are only located,
+// they are read when the results of their analysis type are requested.
+class FRDFile
 {
-    auto points = vtkSmartPointer<vtkPoints>::New();
-    auto cells = vtkSmartPointer<vtkCellArray>::New();
-    auto multiBlock = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-    vtkSmartPointer<vtkUnstructuredGrid> grid;
-    vtkSmartPointer<vtkMultiBlockDataSet> block;
-    std::map<FRDResultInfo, vtkSmartPointer<vtkUnstructuredGrid>> grids;
-    std::map<AnalysisType, vtkSmartPointer<vtkMultiBlockDataSet>> blocks;
-    std::string line;
-    std::map<int, int> mapNodes;
-    std::vector<int> cellTypes;
-    auto materialArray = vtkSmartPointer<vtkIntArray>::New();
-    auto groupArray = vtkSmartPointer<vtkIntArray>::New();
-
-    while (std::getline(ifstr, line)) {
-        std::string keyCode = "    2C";
-        std::string_view view = line;
-
-        if (view.rfind(keyCode, 0) == 0) {
-            // read nodes block
-            mapNodes = readNodes(ifstr, line, points);
-        }
-        keyCode = "    3C";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read elements block
-            cellTypes = readElements(ifstr, line, mapNodes, cells, materialArray, groupArray);
-        }
-        keyCode = "    1P";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read parameter
-            readParameter(ifstr, line);
-        }
-        keyCode = "  100C";
-        if (view.rfind(keyCode, 0) == 0) {
-            // read result info block
-            FRDResultInfo info;
-            readResultInfo(ifstr, line, info);
-            auto it = grids.find(info);
-            if (it == grids.end()) {
-                // create TimeInfo metadata
-                auto timeInfo = createTimeInfo(mapAnalysisTypeToStr[info.analysisType]);
-                // search analysis type block and create it if necessary
-                auto it2 = blocks.find(info.analysisType);
-                if (it2 == blocks.end()) {
-                    block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-                    block->GetFieldData()->AddArray(timeInfo);
-                    blocks[info.analysisType] = block;
-                }
-                else {
-                    block = it2->second;
-                }
+public:
+    explicit FRDFile(std::string_view content)
+    {
+        LineReader reader(content);
+        std::string_view line;
+        while (reader.next(line)) {
+            if (line.rfind("    2C", 0) == 0) {
+                // read nodes block
+                readNodes(reader, line, points, nodes);
+            }
+            else if (line.rfind("    3C", 0) == 0) {
+                // read elements block
+                cellTypes = readElements(reader, line, nodes, cells, materialArray, groupArray);
+            }
+            else if (line.rfind("  100C", 0) == 0) {
+                // locate result block, it ends with " -3"
+                FRDResultBlock block;
+                block.info = readResultInfo(line);
+                size_t begin = reader.offset();
+                while (reader.next(line) && line.rfind(" -3", 0) != 0) {}
+                block.content = content.substr(begin, reader.offset() - begin);
+                blocks.emplace_back(block);
+            }
+        }
+    }
+
+    std::vector<AnalysisType> getAnalysisTypes() const
+    {
+        std::vector<AnalysisType> types;
+        for (const auto& block : blocks) {
+            if (std::ranges::find(types, block.info.analysisType) == types.end()) {
+                types.emplace_back(block.info.analysisType);
+            }
+        }
+        std::ranges::sort(types);
+        return types;
+    }
+
+    // points and elements without results
+    vtkSmartPointer<vtkMultiBlockDataSet> readMesh() const
+    {
+        auto block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+        auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+        grid->SetPoints(points);
+        grid->SetCells(cellTypes.data(), cells);
+        auto timeInfo = createTimeInfo("");
+        auto stepValue = createTimeValue(0);
+        grid->GetFieldData()->AddArray(stepValue);
+        grid->GetFieldData()->AddArray(timeInfo);
+
+        block->SetBlock(0, grid);
+        block->GetFieldData()->AddArray(timeInfo);
+        return block;
+    }
+
+    // one grid per step of the analysis type, the result blocks are read in parallel
+    vtkSmartPointer<vtkMultiBlockDataSet> readAnalysis(AnalysisType type) const
+    {
+        std::vector<const FRDResultBlock*> selected;
+        for (const auto& block : blocks) {
+            if (block.info.analysisType == type) {
+                selected.emplace_back(&block);
+            }
+        }
+
+        std::vector<FRDResults> results(selected.size());
+        Base::parallelFor(selected.size(), [&](size_t i) {
+            results[i] = readResults(*selected[i], nodes);
+        });
+
+        auto timeInfo = createTimeInfo(mapAnalysisTypeToStr[type]);
+        auto block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+        block->GetFieldData()->AddArray(timeInfo);
+
+        std::map<FRDResultInfo, vtkSmartPointer<vtkUnstructuredGrid>> grids;
+        for (size_t i = 0; i < selected.size(); ++i) {
+            const FRDResultInfo& info = selected[i]->info;
+            auto& grid = grids[info];
+            if (!grid) {
                 // create unstructured grid
                 grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
                 grid->SetPoints(points);
@@ -1800,42 +1919,29 @@ vtkSmartPointer<vtkMultiBlockDataSet> readFRD(std::ifstream& ifstr)
                 grid->GetFieldData()->AddArray(stepValue);
                 grid->GetFieldData()->AddArray(timeInfo);
 
-                grids[info] = grid;
                 unsigned int nb = block->GetNumberOfBlocks();
                 block->SetBlock(nb, grid);
             }
-            else {
-                grid = (*it).second;
+            for (long node : results[i].invalidNodes) {
+                Base::Console().warning("Invalid node: %ld\n", node);
+            }
+            for (const auto& array : results[i].arrays) {
+                grid->GetPointData()->AddArray(array);
             }
-            // read result entries and node results
-            readResults(ifstr, line, mapNodes, info, grid);
         }
-    }
-    int i = 0;
-
-    for (const auto& b : blocks) {
-        multiBlock->SetBlock(i, b.second);
-        ++i;
-    }
-
-    // save points and elements even without results
-    if (grids.empty()) {
-        block = vtkSmartPointer<vtkMultiBlockDataSet>::New();
-        grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
-        grid->SetPoints(points);
-        grid->SetCells(cellTypes.data(), cells);
-        auto timeInfo = createTimeInfo("");
-        auto stepValue = createTimeValue(0);
-        grid->GetFieldData()->AddArray(stepValue);
-        grid->GetFieldData()->AddArray(timeInfo);
 
-        block->SetBlock(0, grid);
-        block->GetFieldData()->AddArray(timeInfo);
-        multiBlock->SetBlock(0, block);
+        return block;
     }
 
-    return multiBlock;
-}
+private:
+    vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
+    vtkSmartPointer<vtkCellArray> cells = vtkSmartPointer<vtkCellArray>::New();
+    vtkSmartPointer<vtkIntArray> materialArray = vtkSmartPointer<vtkIntArray>::New();
+    vtkSmartPointer<vtkIntArray> groupArray = vtkSmartPointer<vtkIntArray>::New();
+    std::vector<int> cellTypes;
+    NodeIndex nodes;
+    std::vector<FRDResultBlock> blocks;
+};
 
 }  // namespace FRDReader
 
@@ -1847,20 +1953,12 @@ void FemVTKTools::frdToVTK(const char* filename, bool binary)
         throw Base::FileException("File to load not existing or not readable", filename);
     }
 
-    std::ifstream ifstr(filename, std::ios::in | std::ios::binary);
-
-    vtkSmartPointer<vtkMultiBlockDataSet> multiBlock = FRDReader::readFRD(ifstr);
+    FRDReader::FileContent content(fi);
+    FRDReader::FRDFile frd(content.view());
 
     std::string dir = fi.dirPath();
 
-    for (unsigned int i = 0; i < multiBlock->GetNumberOfBlocks(); ++i) {
-        vtkDataObject* block = multiBlock->GetBlock(i);
-        // get TimeInfo
-        vtkSmartPointer<vtkStringArray> info = vtkStringArray::SafeDownCast(
-            block->GetFieldData()->GetAbstractArray(0)
-        );
-        std::string type = info->GetValue(0).c_str();
-
+    auto writeBlock = [&](vtkMultiBlockDataSet* block, const std::string& type) {
         auto writer = vtkSmartPointer<vtkXMLMultiBlockDataWriter>::New();
         writer->SetDataMode(
             binary ? vtkXMLMultiBlockDataWriter::Binary : vtkXMLMultiBlockDataWriter::Ascii
@@ -1871,6 +1969,16 @@ void FemVTKTools::frdToVTK(const char* filename, bool binary)
         writer->SetFileName(blockFile.c_str());
         writer->SetInputData(block);
         writer->Update();
+    };
+
+    auto types = frd.getAnalysisTypes();
+    // save points and elements even without results
+    if (types.empty()) {
+        writeBlock(frd.readMesh(), "");
+    }
+    // the results of only one analysis type are held in memory at a time
+    for (auto type : types) {
+        writeBlock(frd.readAnalysis(type), FRDReader::mapAnalysisTypeToStr[type]);
     }
 }
 
@@ -118,9 +118,8 @@ void PropertyPostDataObject::scaleDataObject(vtkDataObject* dataObject, double s
 void PropertyPostDataObject::scale(double s)
 {
     if (m_dataObject) {
-        aboutToSetValue();
-        scaleDataObject(m_dataObject, s);
-        hasSetValue();
+        scaleDataObject(startEditing(), s);
+        finishEditing();
     }
 }
 
@@ -129,8 +128,7 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     aboutToSetValue();
 
     if (ds) {
-        createDataObjectByExternalType(ds);
-        m_dataObject->DeepCopy(ds);
+        shareDataObject(ds);
     }
     else {
         m_dataObject = nullptr;
@@ -139,6 +137,33 @@ void PropertyPostDataObject::setValue(const vtkSmartPointer<vtkDataObject>& ds)
     hasSetValue();
 }
 
+vtkDataObject* PropertyPostDataObject::startEditing()
+{
+    aboutToSetValue();
+
+    // the undo transaction keeps the old dataset
+    if (m_dataObject) {
+        vtkSmartPointer<vtkDataObject> data = m_dataObject;
+        createDataObjectByExternalType(data);
+        m_dataObject->DeepCopy(data);
+    }
+
+    return m_dataObject;
+}
+
+void PropertyPostDataObject::finishEditing()
+{
+    hasSetValue();
+}
+
+void PropertyPostDataObject::shareDataObject(vtkDataObject* ds)
+{
+    // A new data object that references the arrays of ds. Algorithms create new arrays for
+    // each run instead of changing the existing ones, so the arrays can't change afterwards.
+    createDataObjectByExternalType(ds);
+    m_dataObject->ShallowCopy(ds);
+}
+
 const vtkSmartPointer<vtkDataObject>& PropertyPostDataObject::getValue() const
 {
     return m_dataObject;
@@ -170,15 +195,16 @@ int PropertyPostDataObject::getDataType()
 PyObject* PropertyPostDataObject::getPyObject()
 {
 #ifdef FC_USE_VTK_PYTHON
-    // create a copy first
-    auto copy = static_cast<PropertyPostDataObject*>(Copy());
+    // create a copy first, the dataset is shared and must not be changed from Python
+    PropertyPostDataObject copy;
+    if (m_dataObject) {
+        copy.createDataObjectByExternalType(m_dataObject);
+        copy.m_dataObject->DeepCopy(m_dataObject);
+    }
 
     // get the data python wrapper
-    PyObject* py_dataset = vtkPythonUtil::GetObjectFromPointer(copy->getValue());
-    auto result = Py::new_reference_to(py_dataset);
-    delete copy;
-
-    return result;
+    PyObject* py_dataset = vtkPythonUtil::GetObjectFromPointer(copy.getValue());
+    return Py::new_reference_to(py_dataset);
 #else
     PyErr_SetString(PyExc_NotImplementedError, "VTK python wrapper not available");
     Py_Return;
@@ -193,9 +219,10 @@ void PropertyPostDataObject::setPyObject([[maybe_unused]] PyObject* value)
         throw Base::TypeError("Can only set vtkDataObject");
     }
     auto dobj = static_cast<vtkDataObject*>(obj);
-    createDataObjectByExternalType(dobj);
 
+    // the object stays accessible from Python, so don't share its arrays
     aboutToSetValue();
+    createDataObjectByExternalType(dobj);
     m_dataObject->DeepCopy(dobj);
     hasSetValue();
 #else
@@ -205,12 +232,9 @@ void PropertyPostDataObject::setPyObject([[maybe_unused]] PyObject* value)
 
 App::Property* PropertyPostDataObject::Copy() const
 {
+    // the dataset is never changed in place, so the copy can share it
     PropertyPostDataObject* prop = new PropertyPostDataObject();
-    if (m_dataObject) {
-
-        prop->createDataObjectByExternalType(m_dataObject);
-        prop->m_dataObject->DeepCopy(m_dataObject);
-    }
+    prop->m_dataObject = m_dataObject;
 
     return prop;
 }
@@ -563,8 +587,7 @@ void PropertyPostDataObject::RestoreDocFile(Base::Reader& reader)
             }
             else {
                 aboutToSetValue();
-                createDataObjectByExternalType(xmlReader->GetOutputDataObject(0));
-                m_dataObject->DeepCopy(xmlReader->GetOutputDataObject(0));
+                shareDataObject(xmlReader->GetOutputDataObject(0));
                 hasSetValue();
             }
         }
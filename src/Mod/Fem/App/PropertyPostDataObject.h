@@ -33,6 +33,9 @@ namespace Fem
 {
 
 /** The vtk data set property class.
+ * The data set is shared between the property, its copies for undo/redo and the filters it
+ * was taken from, so it must not be changed in place but only between startEditing() and
+ * finishEditing().
  * @author Stefan Tröger
  */
 class FemExport PropertyPostDataObject: public App::Property
@@ -47,10 +50,14 @@ public:
     //@{
     /// Scale the point coordinates of the data set with factor \a s
     void scale(double s);
-    /// set the dataset
+    /// set the dataset, the arrays are shared with \a ds
     void setValue(const vtkSmartPointer<vtkDataObject>&);
-    /// get the part shape
+    /// get the dataset, it must not be changed
     const vtkSmartPointer<vtkDataObject>& getValue() const;
+    /// replace the dataset by a private copy that can be changed in place
+    vtkDataObject* startEditing();
+    /// notify the change of the dataset returned by startEditing()
+    void finishEditing();
     /// check if we hold a dataset or a dataobject (which would mean a composite data structure)
     bool isDataSet();
     bool isComposite();
@@ -84,6 +91,7 @@ private:
 
 protected:
     void createDataObjectByExternalType(vtkSmartPointer<vtkDataObject> ex);
+    void shareDataObject(vtkDataObject* ds);
     vtkSmartPointer<vtkDataObject> m_dataObject;
 };
 
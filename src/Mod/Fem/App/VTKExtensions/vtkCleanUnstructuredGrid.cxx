@@ -31,7 +31,7 @@
 # include <vtkStringArray.h>
 # include <vtkUnstructuredGrid.h>
 
-# include <unordered_set>
+# include <numeric>
 #endif
 
 #include "vtkCleanUnstructuredGrid.h"
@@ -139,12 +139,45 @@ unsigned char GetTopologicalDimension(vtkDataSet* ds)
     return topoDim;
 }
 
+// The points merged into every output point. Loops over the output points gather from their
+// sources instead of scattering into shared entries, so that they can run in parallel.
+struct MergedPoints
+{
+    MergedPoints(const std::vector<vtkIdType>& ptMap, vtkIdType nMerged)
+        : Offsets(nMerged + 1, 0)
+    {
+        for (vtkIdType id : ptMap) {
+            if (id >= 0) {
+                ++Offsets[id + 1];
+            }
+        }
+        std::partial_sum(Offsets.begin(), Offsets.end(), Offsets.begin());
+        Sources.resize(Offsets.back());
+        // sources end up in ascending order for every output point
+        std::vector<vtkIdType> next(Offsets.begin(), Offsets.end() - 1);
+        for (vtkIdType iP = 0; iP < static_cast<vtkIdType>(ptMap.size()); ++iP) {
+            if (ptMap[iP] >= 0) {
+                Sources[next[ptMap[iP]]++] = iP;
+            }
+        }
+    }
+
+    vtkIdType GetNumberOfPoints() const
+    {
+        return static_cast<vtkIdType>(Offsets.size()) - 1;
+    }
+
+    std::vector<vtkIdType> Offsets;
+    std::vector<vtkIdType> Sources;
+};
+
 struct WeighingStrategy
 {
     virtual ~WeighingStrategy() = default;
     virtual vtkSmartPointer<vtkDoubleArray> ComputeWeights(
         vtkDataSet* ds,
-        const std::vector<vtkIdType>& ptMap
+        const std::vector<vtkIdType>& ptMap,
+        const MergedPoints& merged
     ) = 0;
 };
 
@@ -152,7 +185,8 @@ struct FirstPointStrategy: public WeighingStrategy
 {
     vtkSmartPointer<vtkDoubleArray> ComputeWeights(
         vtkDataSet* ds,
-        const std::vector<vtkIdType>& ptMap
+        const std::vector<vtkIdType>& ptMap,
+        const MergedPoints& merged
     ) override
     {
         if (ds->GetNumberOfPoints() != static_cast<vtkIdType>(ptMap.size())) {
@@ -166,14 +200,18 @@ struct FirstPointStrategy: public WeighingStrategy
         weights->SetNumberOfTuples(ds->GetNumberOfPoints());
         weights->Fill(0.0);
 
-        std::unordered_set<vtkIdType> firstPoints;
-        for (vtkIdType iP = 0; iP < ds->GetNumberOfPoints(); ++iP) {
-            if (firstPoints.find(ptMap[iP]) != firstPoints.end()) {
-                continue;
+        auto wRange = vtk::DataArrayValueRange<1>(weights);
+        vtkSMPTools::For(
+            0,
+            merged.GetNumberOfPoints(),
+            [&wRange, &merged](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType iM = begin; iM < end; ++iM) {
+                    if (merged.Offsets[iM] < merged.Offsets[iM + 1]) {
+                        wRange[merged.Sources[merged.Offsets[iM]]] = 1.0;
+                    }
+                }
             }
-            firstPoints.insert(ptMap[iP]);
-            weights->SetValue(iP, 1.0);
-        }
+        );
         return weights;
     }
 };
@@ -182,7 +220,8 @@ struct AveragingStrategy: public WeighingStrategy
 {
     vtkSmartPointer<vtkDoubleArray> ComputeWeights(
         vtkDataSet* ds,
-        const std::vector<vtkIdType>& ptMap
+        const std::vector<vtkIdType>& ptMap,
+        const MergedPoints& merged
     ) override
     {
         if (ds->GetNumberOfPoints() != static_cast<vtkIdType>(ptMap.size())) {
@@ -191,26 +230,25 @@ struct AveragingStrategy: public WeighingStrategy
             );
             return nullptr;
         }
-        std::vector<double> counts(ds->GetNumberOfPoints(), 0.0);
-        for (vtkIdType iP = 0; iP < ds->GetNumberOfPoints(); ++iP) {
-            if (ptMap[iP] < 0) {
-                continue;
-            }
-            counts[ptMap[iP]] += 1.0;
-        }
-
         vtkNew<vtkDoubleArray> weights;
         weights->SetNumberOfComponents(1);
         weights->SetNumberOfTuples(ds->GetNumberOfPoints());
         weights->Fill(0.0);
 
         auto wRange = vtk::DataArrayValueRange<1>(weights);
-        for (vtkIdType iP = 0; iP < ds->GetNumberOfPoints(); ++iP) {
-            if (ptMap[iP] < 0) {
-                continue;
+        vtkSMPTools::For(
+            0,
+            merged.GetNumberOfPoints(),
+            [&wRange, &merged](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType iM = begin; iM < end; ++iM) {
+                    vtkIdType first = merged.Offsets[iM];
+                    vtkIdType last = merged.Offsets[iM + 1];
+                    for (vtkIdType iS = first; iS < last; ++iS) {
+                        wRange[merged.Sources[iS]] = 1.0 / static_cast<double>(last - first);
+                    }
+                }
             }
-            wRange[iP] = (counts[ptMap[iP]] ? 1.0 / counts[ptMap[iP]] : 0.0);
-        }
+        );
 
         return weights;
     }
@@ -220,7 +258,8 @@ struct SpatialDensityStrategy: public WeighingStrategy
 {
     vtkSmartPointer<vtkDoubleArray> ComputeWeights(
         vtkDataSet* ds,
-        const std::vector<vtkIdType>& ptMap
+        const std::vector<vtkIdType>& ptMap,
+        const MergedPoints& merged
     ) override
     {
         if (ds->GetNumberOfPoints() != static_cast<vtkIdType>(ptMap.size())) {
@@ -278,58 +317,58 @@ struct SpatialDensityStrategy: public WeighingStrategy
         density->Fill(0.0);
         auto dRange = vtk::DataArrayValueRange<1>(density);
         auto mRange = vtk::DataArrayValueRange<1>(measures);
+        // For thread safety: the first calls build the cell and point links of the data set
         if (ds->GetNumberOfCells() > 0) {
-            vtkNew<vtkIdList> pointIdList;
-            ds->GetCellPoints(0, pointIdList);
+            vtkNew<vtkIdList> buffer;
+            ds->GetCellPoints(0, buffer);
+            ds->GetPointCells(0, buffer);
         }
+        // Share of every cell measure that goes to each of its points
+        std::vector<double> participation(ds->GetNumberOfCells());
         vtkSMPThreadLocalObject<vtkIdList> localPointIds;
-        auto distribute = [&](vtkIdType begin, vtkIdType end) {
+        vtkSMPTools::For(0, ds->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+            vtkIdList* pointIds = localPointIds.Local();
             for (vtkIdType iC = begin; iC < end; ++iC) {
-                ds->GetCellPoints(iC, localPointIds.Local());
-                double participation = mRange[iC] / localPointIds.Local()->GetNumberOfIds();
-                for (vtkIdType iP = 0; iP < localPointIds.Local()->GetNumberOfIds(); ++iP) {
-                    dRange[localPointIds.Local()->GetId(iP)] += participation;
+                ds->GetCellPoints(iC, pointIds);
+                participation[iC] = mRange[iC] / pointIds->GetNumberOfIds();
+            }
+        });
+        // Gather the shares of the cells using each point, every point is written by one
+        // thread only
+        vtkSMPThreadLocalObject<vtkIdList> localCellIds;
+        vtkSMPTools::For(0, ds->GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+            vtkIdList* cellIds = localCellIds.Local();
+            for (vtkIdType iP = begin; iP < end; ++iP) {
+                if (ptMap[iP] < 0) {
+                    continue;
                 }
+                ds->GetPointCells(iP, cellIds);
+                double sum = 0.0;
+                for (vtkIdType iC = 0; iC < cellIds->GetNumberOfIds(); ++iC) {
+                    sum += participation[cellIds->GetId(iC)];
+                }
+                dRange[iP] = sum;
             }
-        };
-        // For thread safety
-        if (ds->GetNumberOfCells() > 0) {
-            vtkNew<vtkIdList> buffer;
-            ds->GetCellPoints(0, buffer);
-        }
-        distribute(0, ds->GetNumberOfCells());
-        // Merits a dedicated struct with a reduce operation
-        // collisions occurring in the += operation
-        // vtkSMPTools::For(0, ds->GetNumberOfCells(), distribute);
+        });
         // Normalize spatial densities with respect to point map
-        {
-            std::vector<double> masses(*std::max_element(ptMap.begin(), ptMap.end()) + 1, 0);
-            auto computeMasses = [&dRange, &masses, &ptMap](vtkIdType begin, vtkIdType end) {
-                for (vtkIdType iP = begin; iP < end; ++iP) {
-                    if (ptMap[iP] < 0) {
-                        dRange[iP] = 0.0;
-                        continue;
+        vtkSMPTools::For(
+            0,
+            merged.GetNumberOfPoints(),
+            [&dRange, &merged](vtkIdType begin, vtkIdType end) {
+                for (vtkIdType iM = begin; iM < end; ++iM) {
+                    vtkIdType first = merged.Offsets[iM];
+                    vtkIdType last = merged.Offsets[iM + 1];
+                    double mass = 0.0;
+                    for (vtkIdType iS = first; iS < last; ++iS) {
+                        mass += dRange[merged.Sources[iS]];
                     }
-                    masses[ptMap[iP]] += dRange[iP];
-                }
-            };
-            computeMasses(0, ds->GetNumberOfPoints());
-            // Merits a dedicated struct with a reduce operation
-            // collisions occurring in the += operation
-            // vtkSMPTools::For(0, ds->GetNumberOfPoints(), computeMasses);
-            vtkSMPTools::For(
-                0,
-                ds->GetNumberOfPoints(),
-                [&dRange, &masses, &ptMap](vtkIdType begin, vtkIdType end) {
-                    for (vtkIdType iP = begin; iP < end; ++iP) {
-                        if (ptMap[iP] < 0) {
-                            continue;
-                        }
-                        dRange[iP] = (masses[ptMap[iP]] != 0 ? dRange[iP] / masses[ptMap[iP]] : 0.0);
+                    for (vtkIdType iS = first; iS < last; ++iS) {
+                        vtkIdType iP = merged.Sources[iS];
+                        dRange[iP] = (mass != 0 ? dRange[iP] / mass : 0.0);
                     }
                 }
-            );
-        }
+            }
+        );
         return density;
     }
 };
@@ -362,46 +401,44 @@ struct WeighingWorklet
         ArrayTypeIn* inArray,
         ArrayTypeOut* outArray,
         vtkDoubleArray* weights,
-        const std::vector<vtkIdType>& ptMap
+        const MergedPoints& merged
     )
     {
         outArray->Fill(0);
         auto inRange = vtk::DataArrayTupleRange(inArray);
         auto outRange = vtk::DataArrayTupleRange(outArray);
         auto wRange = vtk::DataArrayValueRange<1>(weights);
-        auto weighing = [&](vtkIdType begin, vtkIdType end) {
-            for (vtkIdType iP = begin; iP < end; ++iP) {
-                if (ptMap[iP] < 0) {
-                    continue;
-                }
-                auto inT = inRange[iP];
-                auto outT = outRange[ptMap[iP]];
-                for (vtkIdType iT = 0; iT < inArray->GetNumberOfComponents(); ++iT) {
-                    outT[iT] += wRange[iP] * inT[iT];
+        const vtkIdType nComp = inArray->GetNumberOfComponents();
+        // every output tuple is written by one thread only
+        vtkSMPTools::For(0, merged.GetNumberOfPoints(), [&](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType iM = begin; iM < end; ++iM) {
+                auto outT = outRange[iM];
+                for (vtkIdType iS = merged.Offsets[iM]; iS < merged.Offsets[iM + 1]; ++iS) {
+                    vtkIdType iP = merged.Sources[iS];
+                    auto inT = inRange[iP];
+                    for (vtkIdType iT = 0; iT < nComp; ++iT) {
+                        outT[iT] += wRange[iP] * inT[iT];
+                    }
                 }
             }
-        };
-        weighing(0, inArray->GetNumberOfTuples());
-        // Merits a dedicated struct with a reduce operation
-        // collisions occurring in the += operation
-        // vtkSMPTools::For(0, inArray->GetNumberOfTuples(), weighing);
+        });
     }
 };
 
+// Bits share bytes and strings are not worth it, the last merged point wins
 template<>
 void WeighingWorklet::operator()(
     vtkBitArray* inArray,
     vtkBitArray* outArray,
     vtkDoubleArray* vtkNotUsed(weights),
-    const std::vector<vtkIdType>& ptMap
+    const MergedPoints& merged
 )
 {
     outArray->Fill(0);
-    for (vtkIdType iP = 0; iP < inArray->GetNumberOfValues(); ++iP) {
-        if (ptMap[iP] < 0) {
-            continue;
+    for (vtkIdType iM = 0; iM < merged.GetNumberOfPoints(); ++iM) {
+        if (merged.Offsets[iM] < merged.Offsets[iM + 1]) {
+            outArray->SetValue(iM, inArray->GetValue(merged.Sources[merged.Offsets[iM + 1] - 1]));
         }
-        outArray->SetValue(ptMap[iP], inArray->GetValue(iP));
     }
 }
 
@@ -410,14 +447,13 @@ void WeighingWorklet::operator()(
     vtkStringArray* inArray,
     vtkStringArray* outArray,
     vtkDoubleArray* vtkNotUsed(weights),
-    const std::vector<vtkIdType>& ptMap
+    const MergedPoints& merged
 )
 {
-    for (vtkIdType iP = 0; iP < inArray->GetNumberOfValues(); ++iP) {
-        if (ptMap[iP] < 0) {
-            continue;
+    for (vtkIdType iM = 0; iM < merged.GetNumberOfPoints(); ++iM) {
+        if (merged.Offsets[iM] < merged.Offsets[iM + 1]) {
+            outArray->SetValue(iM, inArray->GetValue(merged.Sources[merged.Offsets[iM + 1] - 1]));
         }
-        outArray->SetValue(ptMap[iP], inArray->GetValue(iP));
     }
 }
 
@@ -426,14 +462,13 @@ void WeighingWorklet::operator()(
     vtkAbstractArray* inArray,
     vtkAbstractArray* outArray,
     vtkDoubleArray* vtkNotUsed(weights),
-    const std::vector<vtkIdType>& ptMap
+    const MergedPoints& merged
 )
 {
-    for (vtkIdType iP = 0; iP < inArray->GetNumberOfTuples(); ++iP) {
-        if (ptMap[iP] < 0) {
-            continue;
+    for (vtkIdType iM = 0; iM < merged.GetNumberOfPoints(); ++iM) {
+        if (merged.Offsets[iM] < merged.Offsets[iM + 1]) {
+            outArray->InsertTuple(iM, merged.Sources[merged.Offsets[iM + 1] - 1], inArray);
         }
-        outArray->InsertTuple(ptMap[iP], iP, inArray);
     }
 }
 
@@ -441,7 +476,7 @@ void WeightAttributes(
     vtkPointData* inPD,
     vtkPointData* outPD,
     vtkDoubleArray* weights,
-    const std::vector<vtkIdType>& ptMap
+    const MergedPoints& merged
 )
 {
     // better here to use a Dispatch2BySameArrayType, but that doesn't exist
@@ -472,10 +507,10 @@ void WeightAttributes(
                     );
                     continue;
                 }
-                worker(inStrArr, outStrArr, weights, ptMap);
+                worker(inStrArr, outStrArr, weights, merged);
                 continue;
             }
-            worker(inAbsArr, outAbsArr, weights, ptMap);
+            worker(inAbsArr, outAbsArr, weights, merged);
             continue;
         }
         auto outArr = outPD->GetArray(inArr->GetName());
@@ -485,13 +520,15 @@ void WeightAttributes(
             );
             continue;
         }
-        if (!Dispatcher::Execute(inArr, outArr, worker, weights, ptMap)) {
+        if (!Dispatcher::Execute(inArr, outArr, worker, weights, merged)) {
             auto inBitArr = vtkBitArray::SafeDownCast(inArr);
             auto outBitArr = vtkBitArray::SafeDownCast(outArr);
             if (inBitArr && outBitArr) {
-                worker(inBitArr, outBitArr, weights, ptMap);
+                worker(inBitArr, outBitArr, weights, merged);
+            }
+            else {
+                worker(inArr, outArr, weights, merged);
             }
-            worker(inArr, outArr, weights, ptMap);
         }
     }
 }
@@ -629,14 +666,15 @@ int vtkCleanUnstructuredGrid::RequestData(
         }
     }
     output->SetPoints(newPts);
+    ::MergedPoints merged(ptMap, newPts->GetNumberOfPoints());
 
     ::WeighingStrategyFactory factory;
     auto strategy = factory(static_cast<DataWeighingType>(this->PointDataWeighingStrategy));
-    auto weights = strategy->ComputeWeights(input, ptMap);
+    auto weights = strategy->ComputeWeights(input, ptMap, merged);
     auto inPD = input->GetPointData();
     auto outPD = output->GetPointData();
     ::AllocatePointAttributes(inPD, outPD, output->GetNumberOfPoints());
-    ::WeightAttributes(inPD, outPD, weights, ptMap);
+    ::WeightAttributes(inPD, outPD, weights, merged);
 
     // Now copy the cells.
     vtkNew<vtkIdList> cellPoints;
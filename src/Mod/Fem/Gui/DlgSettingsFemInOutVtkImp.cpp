@@ -25,6 +25,10 @@
 
 #include <Gui/Application.h>
 
+#ifdef FC_USE_VTK
+# include <Mod/Fem/App/FemPostObject.h>
+#endif
+
 #include "DlgSettingsFemInOutVtkImp.h"
 #include "ui_DlgSettingsFemInOutVtk.h"
 
@@ -36,6 +40,7 @@ DlgSettingsFemInOutVtkImp::DlgSettingsFemInOutVtkImp(QWidget* parent)
     , ui(new Ui_DlgSettingsFemInOutVtk)
 {
     ui->setupUi(this);
+    populateSMPBackend();
 }
 
 /*
@@ -47,6 +52,12 @@ void DlgSettingsFemInOutVtkImp::saveSettings()
 {
     ui->comboBoxVtkImportObject->onSave();
     ui->cb_export_level->onSave();
+    ui->cb_smp_backend->onSave();
+    ui->sb_smp_threads->onSave();
+
+#ifdef FC_USE_VTK
+    Fem::FemPostObject::configureParallelism();
+#endif
 }
 
 void DlgSettingsFemInOutVtkImp::loadSettings()
@@ -55,6 +66,9 @@ void DlgSettingsFemInOutVtkImp::loadSettings()
 
     populateExportLevel();
     ui->cb_export_level->onSave();
+
+    ui->cb_smp_backend->onRestore();
+    ui->sb_smp_threads->onRestore();
 }
 
 /**
@@ -67,6 +81,9 @@ void DlgSettingsFemInOutVtkImp::changeEvent(QEvent* e)
         ui->retranslateUi(this);
         ui->comboBoxVtkImportObject->setCurrentIndex(c_index);
         populateExportLevel();
+        int smpIndex = ui->cb_smp_backend->currentIndex();
+        populateSMPBackend();
+        ui->cb_smp_backend->setCurrentIndex(smpIndex);
     }
     else {
         QWidget::changeEvent(e);
@@ -89,4 +106,14 @@ void DlgSettingsFemInOutVtkImp::populateExportLevel() const
     ui->cb_export_level->setCurrentIndex(index);
 }
 
+void DlgSettingsFemInOutVtkImp::populateSMPBackend() const
+{
+    // the backend names are the ones vtkSMPTools::SetBackend() accepts
+    ui->cb_smp_backend->clear();
+    ui->cb_smp_backend->addItem(tr("Default"), QByteArray());
+    for (const char* backend : {"Sequential", "STDThread", "TBB", "OpenMP"}) {
+        ui->cb_smp_backend->addItem(QString::fromLatin1(backend), QByteArray(backend));
+    }
+}
+
 #include "moc_DlgSettingsFemInOutVtkImp.cpp"
@@ -48,6 +48,7 @@ protected:
 
 private:
     void populateExportLevel() const;
+    void populateSMPBackend() const;
     std::unique_ptr<Ui_DlgSettingsFemInOutVtk> ui;
 };
 
@@ -37,6 +37,9 @@
 #include <Inventor/nodes/SoSeparator.h>
 #include <Inventor/nodes/SoShapeHints.h>
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <sstream>
 
 #include <SMESHDS_Mesh.hxx>
@@ -45,6 +48,7 @@
 #include <App/DocumentObject.h>
 #include <Base/BoundBox.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/TimeInfo.h>
 #include <Mod/Fem/App/FemMeshObject.h>
 
@@ -62,10 +66,6 @@ struct FemFace
     unsigned short Size;
     unsigned short FaceNo;
     bool hide;
-    Base::Vector3d getFirstNodePoint()
-    {
-        return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
-    }
 
     Base::Vector3d set(
         short size,
@@ -82,7 +82,8 @@ struct FemFace
         const SMDS_MeshNode* n8 = nullptr
     );
 
-    bool isSameFace(FemFace& face);
+    bool hasSameNodes(const FemFace& face) const;
+    bool hasLessNodes(const FemFace& face) const;
 };
 
 Base::Vector3d FemFace::set(
@@ -135,32 +136,61 @@ Base::Vector3d FemFace::set(
     return Base::Vector3d(Nodes[0]->X(), Nodes[0]->Y(), Nodes[0]->Z());
 }
 
-class FemFaceGridItem: public std::vector<FemFace*>
+bool FemFace::hasSameNodes(const FemFace& face) const
 {
-public:
-    // FemFaceGridItem(void){reserve(200);}
-};
+    // the nodes are sorted, so the same face of two elements has the same node array
+    return Size == face.Size && std::equal(std::begin(Nodes), std::end(Nodes), face.Nodes);
+}
 
-bool FemFace::isSameFace(FemFace& face)
+bool FemFace::hasLessNodes(const FemFace& face) const
 {
-    // the same element can not have the same face
-    if (face.ElementNumber == ElementNumber) {
-        return false;
+    if (Size != face.Size) {
+        return Size < face.Size;
     }
-    if (face.Size != Size) {
-        return false;
+    return std::lexicographical_compare(
+        std::begin(Nodes),
+        std::end(Nodes),
+        std::begin(face.Nodes),
+        std::end(face.Nodes),
+        std::less<>()
+    );
+}
+
+// Dense map from the nodes of a mesh to their index in the coordinate node, addressed by the
+// node id instead of searching a tree keyed on the node pointer
+class FemNodeIndexMap
+{
+public:
+    explicit FemNodeIndexMap(int maxNodeId)
+        : index(maxNodeId + 1, -1)
+        , nodes(maxNodeId + 1, nullptr)
+    {}
+
+    void add(const SMDS_MeshNode* node)
+    {
+        nodes[node->GetID()] = node;
     }
-    // if the same face size just compare if the sorted nodes are the same
-    if (Nodes[0] == face.Nodes[0] && Nodes[1] == face.Nodes[1] && Nodes[2] == face.Nodes[2]
-        && Nodes[3] == face.Nodes[3] && Nodes[4] == face.Nodes[4] && Nodes[5] == face.Nodes[5]
-        && Nodes[6] == face.Nodes[6] && Nodes[7] == face.Nodes[7]) {
-        hide = true;
-        face.hide = true;
-        return true;
+    // assigns the indexes in ascending node id order and returns the used nodes in that order
+    std::vector<const SMDS_MeshNode*> enumerate()
+    {
+        std::vector<const SMDS_MeshNode*> used;
+        for (const SMDS_MeshNode* node : nodes) {
+            if (node) {
+                index[node->GetID()] = static_cast<int>(used.size());
+                used.push_back(node);
+            }
+        }
+        return used;
+    }
+    int operator[](const SMDS_MeshNode* node) const
+    {
+        return index[node->GetID()];
     }
 
-    return false;
-}
+private:
+    std::vector<int> index;
+    std::vector<const SMDS_MeshNode*> nodes;
+};
 
 // ----------------------------------------------------------------------------
 
@@ -638,6 +668,17 @@ void ViewProviderFemMesh::setDisplacementByNodeIdHelper(
     long startId
 )
 {
+    // a new displacement field starts from the undeformed mesh
+    if (UndeformedCoords.empty()) {
+        long sz = pcCoords->point.getNum();
+        const SbVec3f* verts = pcCoords->point.getValues(0);
+        UndeformedCoords.resize(sz);
+        for (long i = 0; i < sz; i++) {
+            UndeformedCoords[i].Set(verts[i][0], verts[i][1], verts[i][2]);
+        }
+    }
+    DisplacementFactor = 0;
+
     DisplacementVector.resize(vNodeElementIdx.size());
     int i = 0;
     for (std::vector<unsigned long>::const_iterator it = vNodeElementIdx.begin();
@@ -652,33 +693,35 @@ void ViewProviderFemMesh::resetDisplacementByNodeId()
 {
     applyDisplacementToNodes(0.0);
     DisplacementVector.clear();
+    UndeformedCoords.clear();
 }
 /// reaply the node displacement with a certain factor and do a redraw
 void ViewProviderFemMesh::applyDisplacementToNodes(double factor)
 {
-    if (DisplacementVector.empty()) {
+    if (DisplacementVector.empty() || factor == DisplacementFactor) {
         return;
     }
 
-    float x = 0, y = 0, z = 0;
-    // set the point coordinates
-    long sz = pcCoords->point.getNum();
+    // the coordinates are computed from the undeformed ones so that every frame of an animation
+    // costs the same and no rounding error builds up
+    std::size_t sz = std::min<std::size_t>(
+        pcCoords->point.getNum(),
+        std::min(DisplacementVector.size(), UndeformedCoords.size())
+    );
     SbVec3f* verts = pcCoords->point.startEditing();
-    for (long i = 0; i < sz; i++) {
-        verts[i].getValue(x, y, z);
-        // undo old factor#
-        Base::Vector3d oldDisp = DisplacementVector[i] * DisplacementFactor;
-        x -= oldDisp.x;
-        y -= oldDisp.y;
-        z -= oldDisp.z;
-        // apply new factor
-        Base::Vector3d newDisp = DisplacementVector[i] * factor;
-        x += newDisp.x;
-        y += newDisp.y;
-        z += newDisp.z;
-        // set the new value
-        verts[i].setValue(x, y, z);
-    }
+    const std::size_t blockSize = 16384;
+    Base::parallelFor((sz + blockSize - 1) / blockSize, [&](std::size_t block) {
+        std::size_t end = std::min(sz, (block + 1) * blockSize);
+        for (std::size_t i = block * blockSize; i < end; i++) {
+            const Base::Vector3f& base = UndeformedCoords[i];
+            const Base::Vector3d& disp = DisplacementVector[i];
+            verts[i].setValue(
+                float(base.x + disp.x * factor),
+                float(base.y + disp.y * factor),
+                float(base.z + disp.z * factor)
+            );
+        }
+    });
     pcCoords->point.finishEditing();
 
     DisplacementFactor = factor;
@@ -708,12 +751,14 @@ void ViewProviderFemMesh::setColorByNodeIdHelper(const std::vector<Base::Color>&
     pcShapeMaterial->diffuseColor.setNum(vNodeElementIdx.size());
     SbColor* colors = pcShapeMaterial->diffuseColor.startEditing();
 
-    long i = 0;
-    for (std::vector<unsigned long>::const_iterator it = vNodeElementIdx.begin();
-         it != vNodeElementIdx.end();
-         ++it, i++) {
-        colors[i] = SbColor(colorVec[*it].r, colorVec[*it].g, colorVec[*it].b);
-    }
+    const std::size_t blockSize = 16384;
+    Base::parallelFor((vNodeElementIdx.size() + blockSize - 1) / blockSize, [&](std::size_t block) {
+        std::size_t end = std::min(vNodeElementIdx.size(), (block + 1) * blockSize);
+        for (std::size_t i = block * blockSize; i < end; i++) {
+            const Base::Color& c = colorVec[vNodeElementIdx[i]];
+            colors[i] = SbColor(c.r, c.g, c.b);
+        }
+    });
 
     pcShapeMaterial->diffuseColor.finishEditing();
 }
@@ -1703,96 +1748,40 @@ void ViewProviderFEMMeshBuilder::createMesh(
     int FaceSize = facesHelper.size();
 
 
-    if (FaceSize < MaxFacesShowInner) {
+    // showing the inner faces is limited to small meshes
+    if (!ShowInner || FaceSize >= MaxFacesShowInner) {
         Base::Console().log(
-            "    %f: Start eliminate internal faces SIMPLE\n",
+            "    %f: Start eliminate internal faces\n",
             Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed())
         );
 
-        // search for double (inside) faces and hide them
-        if (!ShowInner) {
-            for (int l = 0; l < FaceSize; l++) {
-                if (!facesHelper[l].hide) {
-                    for (int i = l + 1; i < FaceSize; i++) {
-                        if (facesHelper[l].isSameFace(facesHelper[i])) {
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    else {
-        Base::Console().log(
-            "    %f: Start eliminate internal faces GRID\n",
-            Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed())
-        );
-        BndBox.Enlarge(BndBox.CalcDiagonalLength() / 10000.0);
-        // calculate grid properties
-        double edge = pow(FaceSize, 1.0 / 3.0);
-        double edgeL = BndBox.LengthX() + BndBox.LengthY() + BndBox.LengthZ();
-        double gridFactor = 5.0;
-        double size = (edgeL / (3 * edge)) * gridFactor;
-
-        unsigned int NbrX = (unsigned int)(BndBox.LengthX() / size) + 1;
-        unsigned int NbrY = (unsigned int)(BndBox.LengthY() / size) + 1;
-        unsigned int NbrZ = (unsigned int)(BndBox.LengthZ() / size) + 1;
-        Base::Console().log("      Size:F:%f,  X:%i  ,Y:%i  ,Z:%i\n", gridFactor, NbrX, NbrY, NbrZ);
-
-        double Xmin = BndBox.MinX;
-        double Ymin = BndBox.MinY;
-        double Zmin = BndBox.MinZ;
-        double Xln = BndBox.LengthX() / NbrX;
-        double Yln = BndBox.LengthY() / NbrY;
-        double Zln = BndBox.LengthZ() / NbrZ;
-
-        std::vector<FemFaceGridItem> Grid(
-            static_cast<size_t>(NbrX) * static_cast<size_t>(NbrY) * static_cast<size_t>(NbrZ)
-        );
-
-
-        unsigned int iX = 0;
-        unsigned int iY = 0;
-        unsigned int iZ = 0;
-
+        // search for double (inside) faces and hide them, sorting the faces by their nodes
+        // puts the faces shared by two elements next to each other
+        std::vector<FemFace*> sortedFaces(FaceSize);
         for (int l = 0; l < FaceSize; l++) {
-            Base::Vector3d point(facesHelper[l].getFirstNodePoint());
-            double x = (point.x - Xmin) / Xln;
-            double y = (point.y - Ymin) / Yln;
-            double z = (point.z - Zmin) / Zln;
-
-            iX = x;
-            iY = y;
-            iZ = z;
-
-            if (iX >= NbrX || iY >= NbrY || iZ >= NbrZ) {
-                Base::Console().log("      Outof range!\n");
-            }
-
-            Grid[iX + iY * NbrX + iZ * NbrX * NbrY].push_back(&facesHelper[l]);
+            sortedFaces[l] = &facesHelper[l];
         }
-
-        unsigned int max = 0, avg = 0;
-        for (const auto& it : Grid) {
-            for (size_t l = 0; l < it.size(); l++) {
-                if (!it[l]->hide) {
-                    for (size_t i = l + 1; i < it.size(); i++) {
-                        if (it[l]->isSameFace(*(it[i]))) {
-                            break;
-                        }
+        std::sort(sortedFaces.begin(), sortedFaces.end(), [](const FemFace* a, const FemFace* b) {
+            return a->hasLessNodes(*b);
+        });
+
+        for (int l = 0; l < FaceSize;) {
+            int end = l + 1;
+            while (end < FaceSize && sortedFaces[l]->hasSameNodes(*sortedFaces[end])) {
+                end++;
+            }
+            // the same element can not have the same face
+            for (int i = l + 1; i < end; i++) {
+                if (sortedFaces[i]->ElementNumber != sortedFaces[l]->ElementNumber) {
+                    for (int k = l; k < end; k++) {
+                        sortedFaces[k]->hide = true;
                     }
+                    break;
                 }
             }
-            if (it.size() > max) {
-                max = it.size();
-            }
-            avg += it.size();
+            l = end;
         }
-        avg = avg / Grid.size();
-
-        Base::Console().log("      VoxelSize: Max:%i ,Average:%i\n", max, avg);
-
-    }  // if( FaceSize < 1000)
+    }
 
 
     Base::Console().log(
@@ -1801,7 +1790,7 @@ void ViewProviderFEMMeshBuilder::createMesh(
     );
 
     // sort out double nodes and build up index map
-    std::map<const SMDS_MeshNode*, int> mapNodeIndex;
+    FemNodeIndexMap mapNodeIndex(data->MaxNodeID());
 
     // handling the corner case beams only, means no faces/triangles only nodes and edges
     if (onlyEdges) {
@@ -1811,7 +1800,7 @@ void ViewProviderFEMMeshBuilder::createMesh(
             const SMDS_MeshEdge* aEdge = aEdgeIte->next();
             int num = aEdge->NbNodes();
             for (int i = 0; i < num; i++) {
-                mapNodeIndex[aEdge->GetNode(i)] = 0;
+                mapNodeIndex.add(aEdge->GetNode(i));
             }
         }
     }
@@ -1821,7 +1810,7 @@ void ViewProviderFEMMeshBuilder::createMesh(
             if (!facesHelper[l].hide) {
                 for (auto Node : facesHelper[l].Nodes) {
                     if (Node) {
-                        mapNodeIndex[Node] = 0;
+                        mapNodeIndex.add(Node);
                     }
                     else {
                         break;
@@ -1836,15 +1825,15 @@ void ViewProviderFEMMeshBuilder::createMesh(
     );
 
     // set the point coordinates
-    coords->point.setNum(mapNodeIndex.size());
-    vNodeElementIdx.resize(mapNodeIndex.size());
-    std::map<const SMDS_MeshNode*, int>::iterator it = mapNodeIndex.begin();
+    std::vector<const SMDS_MeshNode*> usedNodes = mapNodeIndex.enumerate();
+    coords->point.setNum(usedNodes.size());
+    vNodeElementIdx.resize(usedNodes.size());
     SbVec3f* verts = coords->point.startEditing();
-    for (int i = 0; it != mapNodeIndex.end(); ++it, i++) {
-        verts[i].setValue((float)it->first->X(), (float)it->first->Y(), (float)it->first->Z());
-        it->second = i;
+    for (std::size_t i = 0; i < usedNodes.size(); i++) {
+        const SMDS_MeshNode* node = usedNodes[i];
+        verts[i].setValue((float)node->X(), (float)node->Y(), (float)node->Z());
         // set selection idx
-        vNodeElementIdx[i] = it->first->GetID();
+        vNodeElementIdx[i] = node->GetID();
     }
     coords->point.finishEditing();
 
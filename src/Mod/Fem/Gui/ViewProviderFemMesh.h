@@ -172,6 +172,8 @@ protected:
     std::vector<unsigned long> vNodeElementIdx;
     std::vector<unsigned long> vHighlightedIdx;
     std::vector<Base::Vector3d> DisplacementVector;
+    /// node coordinates without displacement, the displaced ones are computed from them
+    std::vector<Base::Vector3f> UndeformedCoords;
     double DisplacementFactor;
 
     SoMaterial* pcPointMaterial;
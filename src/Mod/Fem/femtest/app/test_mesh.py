@@ -607,3 +607,37 @@ class TestMeshGroups(unittest.TestCase):
                 )
             ),
         )
+
+    def test_save_restore_document(self):
+        """
+        Save a mesh with groups in a document and open it again. Verify that
+        nodes, elements and groups are the same.
+        """
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_elements
+        from femexamples.meshes.mesh_canticcx_tetra10 import create_nodes
+
+        fm = Fem.FemMesh()
+        create_nodes(fm)
+        create_elements(fm)
+        nodegroup = fm.addGroup("mynodegroup", "Node")
+        fm.addGroupElements(nodegroup, [1, 2, 3, 4])
+        volumegroup = fm.addGroup("myvolumegroup", "Volume")
+        fm.addGroupElements(volumegroup, list(fm.Volumes[:10]))
+
+        obj = self.document.addObject("Fem::FemMeshObject", "Mesh")
+        obj.FemMesh = fm
+        fcstd_file = join(testtools.get_fem_test_tmp_dir("mesh_groups_save"), "mesh.FCStd")
+        self.document.saveAs(fcstd_file)
+        FreeCAD.closeDocument(self.document.Name)
+        self.document = FreeCAD.openDocument(fcstd_file)
+
+        restored = self.document.getObject("Mesh").FemMesh
+        self.assertEqual(fm.Nodes, restored.Nodes)
+        self.assertEqual(fm.Volumes, restored.Volumes)
+        for elem in fm.Volumes:
+            self.assertEqual(fm.getElementNodes(elem), restored.getElementNodes(elem))
+        self.assertEqual(sorted(fm.Groups), sorted(restored.Groups))
+        for group in fm.Groups:
+            self.assertEqual(fm.getGroupName(group), restored.getGroupName(group))
+            self.assertEqual(fm.getGroupElementType(group), restored.getGroupElementType(group))
+            self.assertEqual(fm.getGroupElements(group), restored.getGroupElements(group))
@@ -32,6 +32,7 @@
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wextra-semi"
 #endif
+#include <IGESControl_Controller.hxx>
 #include <Interface_Static.hxx>
 #include <OSD_Exception.hxx>
 #include <Standard_Version.hxx>
@@ -43,18 +44,22 @@
 #include <XSControl_TransferReader.hxx>
 #include <XSControl_WorkSession.hxx>
 #include <Message_ProgressRange.hxx>
+#include <STEPCAFControl_Controller.hxx>
 
 #if defined(__clang__)
 # pragma clang diagnostic pop
 #endif
 
 #include <chrono>
+#include <functional>
+#include <memory>
 #include "dxf/ImpExpDxf.h"
 #include "SketchExportHelper.h"
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Mod/Part/App/ImportIges.h>
 #include <Mod/Part/App/ImportStep.h>
@@ -89,13 +94,20 @@ public:
         add_keyword_method(
             "insert",
             &Module::importer,
-            "insert(string,string) -- Insert the file into the given document."
+            "insert(string,string,[update]) -- Insert the file into the given document.\n"
+            "With update=True, the parts of a previous import of the file are updated instead."
         );
         add_keyword_method(
             "export",
             &Module::exporter,
             "export(list,string) -- Export a list of objects into a single file."
         );
+        add_varargs_method(
+            "exportBatch",
+            &Module::exportBatch,
+            "exportBatch(list,[threads]) -- Export each (object,filename) tuple of the list\n"
+            "into its own STEP or IGES file. The files are written concurrently."
+        );
         add_varargs_method(
             "readDXF",
             &Module::readDXF,
@@ -128,12 +140,21 @@ private:
         PyObject* merge = Py_None;
         PyObject* useLinkGroup = Py_None;
         int mode = -1;
-        static const std::array<const char*, 7>
-            kwd_list {"name", "docName", "importHidden", "merge", "useLinkGroup", "mode", nullptr};
+        PyObject* update = Py_None;
+        static const std::array<const char*, 8> kwd_list {
+            "name",
+            "docName",
+            "importHidden",
+            "merge",
+            "useLinkGroup",
+            "mode",
+            "update",
+            nullptr
+        };
         if (!Base::Wrapped_ParseTupleAndKeywords(
                 args.ptr(),
                 kwds.ptr(),
-                "et|sO!O!O!i",
+                "et|sO!O!O!iO!",
                 kwd_list,
                 "utf-8",
                 &Name,
@@ -144,7 +165,9 @@ private:
                 &merge,
                 &PyBool_Type,
                 &useLinkGroup,
-                &mode
+                &mode,
+                &PyBool_Type,
+                &update
             )) {
             throw Py::Exception();
         }
@@ -215,7 +238,13 @@ private:
             if (mode >= 0) {
                 ocaf.setMode(mode);
             }
+            if (update != Py_None) {
+                ocaf.setUpdate(Base::asBoolean(update));
+            }
             ocaf.loadShapes();
+            if (update != Py_None && Base::asBoolean(update)) {
+                pcDoc->recompute();
+            }
 
             hApp->Close(hDoc);
 
@@ -373,6 +402,91 @@ private:
         return Py::None();
     }
 
+    Py::Object exportBatch(const Py::Tuple& args)
+    {
+        PyObject* object = nullptr;
+        int threads = 0;
+        if (!PyArg_ParseTuple(args.ptr(), "O|i", &object, &threads)) {
+            throw Py::Exception();
+        }
+
+        Part::OCAF::ImportExportSettings settings;
+        bool exportHidden = settings.getExportHiddenObject();
+        bool keepPlacement = settings.getExportKeepPlacement();
+
+        std::vector<std::pair<App::DocumentObject*, Base::FileInfo>> jobs;
+        Py::Sequence list(object);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            Py::Tuple tuple(*it);
+            if (tuple.size() != 2
+                || !PyObject_TypeCheck(tuple[0].ptr(), &(App::DocumentObjectPy::Type))) {
+                throw Py::TypeError("Expected a list of (object, filename) tuples");
+            }
+            auto pyobj = static_cast<App::DocumentObjectPy*>(tuple[0].ptr());
+            Base::FileInfo file(Py::String(tuple[1]).as_std_string("utf-8"));
+            if (!file.hasExtension({"stp", "step", "igs", "iges"})) {
+                throw Py::ValueError("Only STEP and IGES files can be exported in a batch");
+            }
+            jobs.emplace_back(pyobj->getDocumentObjectPtr(), file);
+        }
+
+        Handle(XCAFApp_Application) hApp = XCAFApp_Application::GetApplication();
+        std::vector<Handle(TDocStd_Document)> docs;
+        auto closeDocs = [&]() {
+            for (auto& hDoc : docs) {
+                hApp->Close(hDoc);
+            }
+        };
+
+        try {
+            // The objects are transferred to the XCAF documents in this thread because the
+            // FreeCAD documents are not thread safe. Only the translation to STEP or IGES and
+            // writing the files runs concurrently, each file with its own writer.
+            STEPCAFControl_Controller::Init();
+            IGESControl_Controller::Init();
+            std::vector<std::function<void()>> writers;
+            for (auto& [obj, file] : jobs) {
+                Handle(TDocStd_Document) hDoc;
+                hApp->NewDocument(TCollection_ExtendedString("MDTV-CAF"), hDoc);
+                docs.push_back(hDoc);
+
+                Import::ExportOCAF2 ocaf(hDoc);
+                ocaf.setExportOptions(ExportOCAF2::customExportOptions());
+                ocaf.setExportHiddenObject(exportHidden);
+                ocaf.setKeepPlacement(keepPlacement);
+                std::vector<App::DocumentObject*> objs {obj};
+                ocaf.exportObjects(objs);
+
+                if (file.hasExtension({"stp", "step"})) {
+                    auto writer = std::make_shared<Import::WriterStep>(file);
+                    writers.emplace_back([writer, hDoc]() { writer->write(hDoc); });
+                }
+                else {
+                    auto writer = std::make_shared<Import::WriterIges>(file);
+                    writers.emplace_back([writer, hDoc]() { writer->write(hDoc); });
+                }
+            }
+
+            Base::parallelFor(
+                writers.size(),
+                [&](std::size_t index) { writers[index](); },
+                static_cast<unsigned>(std::max(threads, 0))
+            );
+            closeDocs();
+        }
+        catch (Standard_Failure& e) {
+            closeDocs();
+            throw Py::Exception(Base::PyExc_FC_GeneralError, e.GetMessageString());
+        }
+        catch (const Base::Exception& e) {
+            closeDocs();
+            e.setPyException();
+            throw Py::Exception();
+        }
+
+        return Py::None();
+    }
+
     // This readDXF method is an almost exact duplicate of the one in ImportGui::Module.
     // The only difference is the CDxfRead class derivation that is created.
     // It would seem desirable to have most of this code in just one place, passing it
@@ -25,7 +25,16 @@
 #if defined(__MINGW32__)
 # define WNT  // avoid conflict with GUID
 #endif
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <set>
+
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRep_Tool.hxx>
 #include <Interface_Static.hxx>
+#include <Precision.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -34,6 +43,7 @@
 #include <TDF_LabelSequence.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_GraphNode.hxx>
@@ -50,7 +60,10 @@
 #include <App/Link.h>
 #include <Base/Console.h>
 #include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
+#include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/FeatureCompound.h>
 #include <Mod/Part/App/Interface.h>
 #include <Mod/Part/App/OCAF/ImportExportSettings.h>
@@ -104,6 +117,8 @@ ImportOCAFOptions ImportOCAF2::customImportOptions()
     defaultOptions.reduceObjects = settings.getReduceObjects();
     defaultOptions.showProgress = settings.getShowProgress();
     defaultOptions.expandCompound = settings.getExpandCompound();
+    defaultOptions.deduplicateShapes = settings.getDeduplicateShapes();
+    defaultOptions.tessellationOnly = settings.getTessellationOnly();
     defaultOptions.mode = static_cast<int>(settings.getImportMode());
 
     auto hGrp = App::GetApplication().GetParameterGroupByPath(
@@ -300,11 +315,20 @@ bool ImportOCAF2::createObject(
     std::vector<Base::Color> edgeColors;
 
     TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
+    bool hasSubShapes = !label.IsNull() && aShapeTool->GetSubShapes(label, seq);
 
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
+    // use the maps built by prepareShapes() if there are any
+    ShapeMaps localMaps;
+    auto itMaps = myShapeMaps.find(shape);
+    if (itMaps == myShapeMaps.end()) {
+        mapShape(shape, hasSubShapes, localMaps);
+    }
+    const ShapeMaps& maps = itMaps == myShapeMaps.end() ? localMaps : itMaps->second;
+
+    // a mesh only gets the color of the whole shape
+    if (hasSubShapes && !options.tessellationOnly) {
+        const TopTools_IndexedMapOfShape& faceMap = maps.faceMap;
+        const TopTools_IndexedMapOfShape& edgeMap = maps.edgeMap;
 
         faceColors.assign(faceMap.Extent(), info.faceColor);
         edgeColors.assign(edgeMap.Extent(), info.edgeColor);
@@ -374,9 +398,13 @@ bool ImportOCAF2::createObject(
         doc = getDocument(doc, label);
     }
 
+    if (options.tessellationOnly) {
+        createMesh(doc, tshape, info);
+        return true;
+    }
+
     if (options.expandCompound
-        && (tshape.countSubShapes(TopAbs_SOLID) > 1
-            || (!tshape.countSubShapes(TopAbs_SOLID) && tshape.countSubShapes(TopAbs_SHELL) > 1))) {
+        && (maps.solidCount > 1 || (!maps.solidCount && maps.shellCount > 1))) {
         feature = dynamic_cast<Part::Feature*>(expandShape(doc, label, shape));
         assert(feature);
     }
@@ -503,8 +531,238 @@ bool ImportOCAF2::createGroup(
     return true;
 }
 
+void ImportOCAF2::mapShape(const TopoDS_Shape& shape, bool subShapes, ShapeMaps& maps)
+{
+    TopTools_IndexedMapOfShape solidMap, shellMap;
+    TopExp::MapShapes(shape, TopAbs_SOLID, solidMap);
+    TopExp::MapShapes(shape, TopAbs_SHELL, shellMap);
+    maps.solidCount = solidMap.Extent();
+    maps.shellCount = shellMap.Extent();
+    if (subShapes) {
+        TopExp::MapShapes(shape, TopAbs_FACE, maps.faceMap);
+        TopExp::MapShapes(shape, TopAbs_EDGE, maps.edgeMap);
+    }
+}
+
+void ImportOCAF2::createMesh(App::Document* doc, const Part::TopoShape& shape, Info& info)
+{
+    std::vector<Base::Vector3d> points;
+    std::vector<Data::ComplexGeoData::Facet> facets;
+    shape.getFaces(points, facets, shape.getAccuracy());
+
+    auto kernel = std::make_unique<Mesh::MeshObject>();
+    kernel->setFacets(facets, points);
+
+    auto feature = doc->addObject<Mesh::Feature>(shape.shapeName().c_str());
+    feature->Mesh.setValuePtr(kernel.release());
+    applyMeshColor(feature, info.faceColor);
+
+    info.propPlacement = &feature->Placement;
+    info.obj = feature;
+}
+
+void ImportOCAF2::prepareShapes(const TDF_LabelSequence& labels)
+{
+    // The labels are read here, the shapes are then explored in parallel, which only reads
+    // the topology. The document objects are created serially afterwards.
+    std::vector<std::pair<TopoDS_Shape, bool>> shapes;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        if (aShapeTool->IsAssembly(label)) {
+            continue;
+        }
+        TopoDS_Shape shape = aShapeTool->GetShape(label).Located(TopLoc_Location());
+        if (shape.IsNull() || myShapeMaps.count(shape)) {
+            continue;
+        }
+        TDF_LabelSequence seq;
+        myShapeMaps.emplace(shape, ShapeMaps());
+        shapes.emplace_back(shape, aShapeTool->GetSubShapes(label, seq));
+    }
+
+    std::vector<ShapeMaps*> maps;
+    maps.reserve(shapes.size());
+    for (const auto& shape : shapes) {
+        maps.push_back(&myShapeMaps[shape.first]);
+    }
+    Base::parallelFor(shapes.size(), [&](std::size_t i) {
+        mapShape(shapes[i].first, shapes[i].second, *maps[i]);
+    });
+}
+
+ImportOCAF2::ShapeCounts ImportOCAF2::countShapes(const TopoDS_Shape& shape)
+{
+    TopTools_IndexedMapOfShape vertexMap, edgeMap, faceMap;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    return {
+        static_cast<int>(shape.ShapeType()),
+        vertexMap.Extent(),
+        edgeMap.Extent(),
+        faceMap.Extent()
+    };
+}
+
+bool ImportOCAF2::isSameGeometry(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2)
+{
+    // The shapes are compared in their own coordinate system. Copies of the same part under
+    // different products are written with the same topology, so the sub-shapes are compared
+    // in the order they are explored.
+    const double tol = Precision::Confusion();
+
+    TopTools_IndexedMapOfShape map1, map2;
+    TopExp::MapShapes(shape1, TopAbs_VERTEX, map1);
+    TopExp::MapShapes(shape2, TopAbs_VERTEX, map2);
+    for (int i = 1; i <= map1.Extent(); ++i) {
+        gp_Pnt p1 = BRep_Tool::Pnt(TopoDS::Vertex(map1(i)));
+        gp_Pnt p2 = BRep_Tool::Pnt(TopoDS::Vertex(map2(i)));
+        if (p1.Distance(p2) > tol) {
+            return false;
+        }
+    }
+
+    map1.Clear();
+    map2.Clear();
+    TopExp::MapShapes(shape1, TopAbs_EDGE, map1);
+    TopExp::MapShapes(shape2, TopAbs_EDGE, map2);
+    for (int i = 1; i <= map1.Extent(); ++i) {
+        const TopoDS_Edge& edge1 = TopoDS::Edge(map1(i));
+        const TopoDS_Edge& edge2 = TopoDS::Edge(map2(i));
+        if (BRep_Tool::Degenerated(edge1) || BRep_Tool::Degenerated(edge2)) {
+            if (BRep_Tool::Degenerated(edge1) != BRep_Tool::Degenerated(edge2)) {
+                return false;
+            }
+            continue;
+        }
+        BRepAdaptor_Curve curve1(edge1);
+        BRepAdaptor_Curve curve2(edge2);
+        if (curve1.GetType() != curve2.GetType()) {
+            return false;
+        }
+        gp_Pnt p1 = curve1.Value((curve1.FirstParameter() + curve1.LastParameter()) / 2);
+        gp_Pnt p2 = curve2.Value((curve2.FirstParameter() + curve2.LastParameter()) / 2);
+        if (p1.Distance(p2) > tol) {
+            return false;
+        }
+    }
+
+    map1.Clear();
+    map2.Clear();
+    TopExp::MapShapes(shape1, TopAbs_FACE, map1);
+    TopExp::MapShapes(shape2, TopAbs_FACE, map2);
+    for (int i = 1; i <= map1.Extent(); ++i) {
+        BRepAdaptor_Surface surface1(TopoDS::Face(map1(i)), Standard_False);
+        BRepAdaptor_Surface surface2(TopoDS::Face(map2(i)), Standard_False);
+        if (surface1.GetType() != surface2.GetType()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::unordered_map<TopoDS_Shape, ImportOCAF2::Info, ShapeHasher>::iterator
+ImportOCAF2::findSameShape(const TopoDS_Shape& shape)
+{
+    auto candidates = mySameShapes.find(countShapes(shape));
+    if (candidates == mySameShapes.end()) {
+        return myShapes.end();
+    }
+    for (const auto& candidate : candidates->second) {
+        if (isSameGeometry(shape, candidate)) {
+            FC_LOG("link identical shape " << Tools::labelName(aShapeTool->FindShape(shape)));
+            return myShapes.find(candidate);
+        }
+    }
+    return myShapes.end();
+}
+
+void ImportOCAF2::updateShapes()
+{
+    // The parts of a previous import are found by their label, which is the product name, or
+    // the product name with the suffix added to make labels unique. Parts with the same name
+    // are paired in document order, which is the order they were imported in.
+    std::map<std::string, std::vector<Part::Feature*>> parts;
+    for (auto obj : pDocument->getObjectsOfType(Part::Feature::getClassTypeId())) {
+        if (obj->getTypeId() != Part::Feature::getClassTypeId()) {
+            continue;
+        }
+        auto feature = static_cast<Part::Feature*>(obj);
+        std::string label = feature->Label.getValue();
+        parts[label].push_back(feature);
+        const std::size_t suffix = 3;
+        if (label.size() > suffix
+            && std::all_of(label.end() - suffix, label.end(), [](char c) {
+                   return std::isdigit(static_cast<unsigned char>(c));
+               })) {
+            parts[label.substr(0, label.size() - suffix)].push_back(feature);
+        }
+    }
+
+    TDF_LabelSequence labels;
+    aShapeTool->GetShapes(labels);
+    std::set<Part::Feature*> done;
+    int changed = 0;
+    int unchanged = 0;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        auto label = labels.Value(i);
+        if (aShapeTool->IsAssembly(label)) {
+            continue;
+        }
+        TopoDS_Shape shape = aShapeTool->GetShape(label).Located(TopLoc_Location());
+        std::string name = Tools::labelName(label);
+        if (shape.IsNull() || name.empty()) {
+            continue;
+        }
+
+        auto it = parts.find(name);
+        if (it == parts.end()) {
+            FC_WARN("No object to update with " << name);
+            continue;
+        }
+        // an unchanged part is not touched, so that its dependents need no recompute
+        auto existingShape = [](Part::Feature* feature) {
+            return feature->Shape.getValue().Located(TopLoc_Location());
+        };
+        Part::Feature* feature = nullptr;
+        ShapeCounts counts = countShapes(shape);
+        for (auto candidate : it->second) {
+            if (!done.count(candidate) && countShapes(existingShape(candidate)) == counts
+                && isSameGeometry(shape, existingShape(candidate))) {
+                feature = candidate;
+                break;
+            }
+        }
+        if (feature) {
+            done.insert(feature);
+            ++unchanged;
+            continue;
+        }
+        for (auto candidate : it->second) {
+            if (!done.count(candidate)) {
+                feature = candidate;
+                break;
+            }
+        }
+        if (!feature) {
+            FC_WARN("No object to update with " << name);
+            continue;
+        }
+        done.insert(feature);
+        // keep the placement of the object
+        feature->Shape.setValue(shape.Located(feature->Shape.getValue().Location()));
+        ++changed;
+    }
+    FC_MSG("Updated " << changed << " objects, " << unchanged << " objects are unchanged");
+}
+
 App::DocumentObject* ImportOCAF2::loadShapes()
 {
+    if (options.update) {
+        updateShapes();
+        return nullptr;
+    }
+
     if (!options.useLinkGroup) {
         ImportLegacy legacy(*this);
         legacy.setMerge(options.merge);
@@ -516,16 +774,24 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         Tools::dumpLabels(pDoc->Main(), aShapeTool, aColorTool);
     }
 
+    if (options.tessellationOnly) {
+        // registers the mesh feature types
+        Base::Interpreter().loadModule("Mesh");
+    }
+
     TDF_LabelSequence labels;
     aShapeTool->GetShapes(labels);
     Base::SequencerLauncher seq("Importing...", labels.Length());
     FC_LOG("free shape count " << labels.Length());
     sequencer = options.showProgress ? &seq : nullptr;
 
-    labels.Clear();
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    myShapeMaps.clear();
+    mySameShapes.clear();
+    prepareShapes(labels);
+    labels.Clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
@@ -562,7 +828,9 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     if (ret) {
         ret->recomputeFeature(true);
     }
-    if (options.merge && ret && !ret->isDerivedFrom<Part::Feature>()) {
+    // the meshes of a tessellation only import have no shape to merge
+    if (options.merge && !options.tessellationOnly && ret
+        && !ret->isDerivedFrom<Part::Feature>()) {
         auto shape = Part::Feature::getTopoShape(
             ret,
             Part::ShapeOption::ResolveLink | Part::ShapeOption::Transform
@@ -583,6 +851,8 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    myShapeMaps.clear();
+    mySameShapes.clear();
     sequencer = nullptr;
     return ret;
 }
@@ -671,18 +941,27 @@ App::DocumentObject* ImportOCAF2::loadShape(
         if (sequencer && !baseLabel.IsNull() && aShapeTool->IsTopLevel(baseLabel)) {
             sequencer->next(true);
         }
-        bool res;
-        if (baseLabel.IsNull() || !aShapeTool->IsAssembly(baseLabel)) {
-            res = createObject(doc, baseLabel, baseShape, info, newDoc);
-        }
-        else {
-            res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
+        bool isAssembly = !baseLabel.IsNull() && aShapeTool->IsAssembly(baseLabel);
+        if (!isAssembly && options.deduplicateShapes) {
+            it = findSameShape(baseShape);
         }
-        if (!res) {
-            return nullptr;
+        if (it == myShapes.end()) {
+            bool res;
+            if (!isAssembly) {
+                res = createObject(doc, baseLabel, baseShape, info, newDoc);
+            }
+            else {
+                res = createAssembly(doc, baseLabel, baseShape, info, newDoc);
+            }
+            if (!res) {
+                return nullptr;
+            }
+            setObjectName(info, baseLabel);
+            it = myShapes.emplace(baseShape, info).first;
+            if (!isAssembly && options.deduplicateShapes) {
+                mySameShapes[countShapes(baseShape)].push_back(baseShape);
+            }
         }
-        setObjectName(info, baseLabel);
-        it = myShapes.emplace(baseShape, info).first;
     }
     if (baseOnly) {
         return it->second.obj;
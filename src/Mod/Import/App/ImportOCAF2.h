@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <set>
 #include <string>
@@ -31,6 +32,7 @@
 #include <vector>
 
 #include <TDocStd_Document.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
@@ -71,6 +73,9 @@ struct ImportExport ImportOCAFOptions
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool deduplicateShapes = false;
+    bool tessellationOnly = false;
+    bool update = false;
     int mode = 0;
 };
 
@@ -108,6 +113,19 @@ public:
     {
         options.expandCompound = enable;
     }
+    void setDeduplicateShapes(bool enable)
+    {
+        options.deduplicateShapes = enable;
+    }
+    void setTessellationOnly(bool enable)
+    {
+        options.tessellationOnly = enable;
+    }
+    /// Update the parts of a previous import of the file instead of creating new objects
+    void setUpdate(bool enable)
+    {
+        options.update = enable;
+    }
 
     enum ImportMode
     {
@@ -181,8 +199,33 @@ private:
     {}
     virtual void applyLinkColor(App::DocumentObject*, int /*index*/, Base::Color)
     {}
+    virtual void applyMeshColor(App::DocumentObject*, Base::Color)
+    {}
 
 private:
+    /// The sub-shape maps createObject() needs, built for all simple shapes before any object
+    /// is created
+    struct ShapeMaps
+    {
+        TopTools_IndexedMapOfShape faceMap;
+        TopTools_IndexedMapOfShape edgeMap;
+        int solidCount = 0;
+        int shellCount = 0;
+    };
+    static void mapShape(const TopoDS_Shape& shape, bool subShapes, ShapeMaps& maps);
+    void createMesh(App::Document* doc, const Part::TopoShape& shape, Info& info);
+    void prepareShapes(const TDF_LabelSequence& labels);
+    void updateShapes();
+
+    /// Key of the shapes that can be geometrically identical: shape type, vertex, edge and
+    /// face count
+    using ShapeCounts = std::array<int, 4>;
+    static ShapeCounts countShapes(const TopoDS_Shape& shape);
+    static bool isSameGeometry(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2);
+    std::unordered_map<TopoDS_Shape, Info, ShapeHasher>::iterator findSameShape(
+        const TopoDS_Shape& shape
+    );
+
     class ImportLegacy: public ImportOCAF
     {
     public:
@@ -213,6 +256,8 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TopoDS_Shape, ShapeMaps, ShapeHasher> myShapeMaps;
+    std::map<ShapeCounts, std::vector<TopoDS_Shape>> mySameShapes;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
@@ -25,24 +25,75 @@
 #include <boost/core/ignore_unused.hpp>
 #include <Standard_Version.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
+#include <TDF_LabelSequence.hxx>
 #include <Message_ProgressRange.hxx>
 #include <RWGltf_CafWriter.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#if OCC_VERSION_HEX >= 0x070700
+# include <RWGltf_DracoParameters.hxx>
+#endif
 
 #include "WriterGltf.h"
+#include <App/Application.h>
+#include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/Tools.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/encodeFilename.h>
 
 using namespace Import;
 
+namespace
+{
+// The glTF writer only exports faces that are triangulated. The shapes are meshed with the
+// tessellation settings of the 3D view, so the triangulation of shapes already displayed is
+// reused instead of being computed again.
+void meshShapes(Handle(TDocStd_Document) hDoc)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    double deviation = hGrp->GetFloat("MeshDeviation", 0.2);
+    double angularDeflection = Base::toRadians(hGrp->GetFloat("MeshAngularDeflection", 28.65));
+
+    Handle(XCAFDoc_ShapeTool) shapeTool = XCAFDoc_DocumentTool::ShapeTool(hDoc->Main());
+    TDF_LabelSequence labels;
+    shapeTool->GetShapes(labels);
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        TDF_Label label = labels.Value(i);
+        if (shapeTool->IsAssembly(label)) {
+            continue;
+        }
+        TopoDS_Shape shape = shapeTool->GetShape(label);
+        if (!shape.IsNull()) {
+            Part::Tools::meshShape(
+                shape,
+                Part::Tools::getDeflection(shape, deviation),
+                angularDeflection
+            );
+        }
+    }
+}
+}  // namespace
+
 WriterGltf::WriterGltf(const Base::FileInfo& file)  // NOLINT
     : file {file}
-{}
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Import/glTF"
+    );
+    mergeFaces = hGrp->GetBool("MergeFaces", mergeFaces);
+    dracoCompression = hGrp->GetBool("DracoCompression", dracoCompression);
+}
 
 void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
     std::string utf8Name = file.filePath();
     std::string name8bit = Part::encodeFilename(utf8Name);
 
+    meshShapes(hDoc);
+
     TColStd_IndexedDataMapOfStringString aMetadata;
     RWGltf_CafWriter aWriter(name8bit.c_str(), file.hasExtension("glb"));
     aWriter.SetTransformationFormat(RWGltf_WriterTrsfFormat_Compact);
@@ -51,8 +102,29 @@ void WriterGltf::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(RWMesh_CoordinateSystem_Zup);
 #if OCC_VERSION_HEX >= 0x070700
     aWriter.SetParallel(true);
+#endif
+#if OCC_VERSION_HEX >= 0x070600
+    // one primitive per part instead of one per face
+    aWriter.SetMergeFaces(mergeFaces);
+#endif
+#if OCC_VERSION_HEX >= 0x070700
+    if (dracoCompression) {
+        RWGltf_DracoParameters draco;
+        draco.DracoCompression = true;
+        aWriter.SetCompressionParameters(draco);
+    }
 #endif
     Standard_Boolean ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
+#if OCC_VERSION_HEX >= 0x070700
+    if (!ret && dracoCompression) {
+        // OCCT may be built without Draco
+        Base::Console().warning(
+            "Cannot write glTF with Draco compression, writing it uncompressed\n"
+        );
+        aWriter.SetCompressionParameters(RWGltf_DracoParameters());
+        ret = aWriter.Perform(hDoc, aMetadata, Message_ProgressRange());
+    }
+#endif
     if (!ret) {
         throw Base::FileException("Cannot save to file: ", file);
     }
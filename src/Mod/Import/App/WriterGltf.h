@@ -37,7 +37,18 @@ public:
 
     void write(Handle(TDocStd_Document) hDoc) const;
 
+    void setMergeFaces(bool on)
+    {
+        mergeFaces = on;
+    }
+    void setDracoCompression(bool on)
+    {
+        dracoCompression = on;
+    }
+
 private:
     Base::FileInfo file;
+    bool mergeFaces = true;
+    bool dracoCompression = false;
 };
 }  // namespace Import
@@ -35,9 +35,20 @@
 
 using namespace Import;
 
+// The settings are read here, so that several writers can write concurrently
 WriterStep::WriterStep(const Base::FileInfo& file)  // NOLINT
     : file {file}
-{}
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                             .GetUserParameter()
+                                             .GetGroup("BaseApp")
+                                             ->GetGroup("Preferences")
+                                             ->GetGroup("Mod/Part")
+                                             ->GetGroup("STEP");
+    author = hGrp->GetASCII("Author", "Author");
+    company = hGrp->GetASCII("Company");
+    Part::Interface::writeStepAssembly(Part::Interface::Assembly::On);
+}
 
 void WriterStep::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
 {
@@ -45,24 +56,14 @@ void WriterStep::write(Handle(TDocStd_Document) hDoc) const  // NOLINT
     std::string name8bit = Part::encodeFilename(utf8Name);
 
     STEPCAFControl_Writer writer;
-    Part::Interface::writeStepAssembly(Part::Interface::Assembly::On);
     writer.Transfer(hDoc, STEPControl_AsIs);
 
     APIHeaderSection_MakeHeader makeHeader(writer.ChangeWriter().Model());
-    Base::Reference<ParameterGrp> hGrp = App::GetApplication()
-                                             .GetUserParameter()
-                                             .GetGroup("BaseApp")
-                                             ->GetGroup("Preferences")
-                                             ->GetGroup("Mod/Part")
-                                             ->GetGroup("STEP");
 
     // Don't set name because STEP doesn't support UTF-8
     // https://forum.freecad.org/viewtopic.php?f=8&t=52967
-    makeHeader.SetAuthorValue(
-        1,
-        new TCollection_HAsciiString(hGrp->GetASCII("Author", "Author").c_str())
-    );
-    makeHeader.SetOrganizationValue(1, new TCollection_HAsciiString(hGrp->GetASCII("Company").c_str()));
+    makeHeader.SetAuthorValue(1, new TCollection_HAsciiString(author.c_str()));
+    makeHeader.SetOrganizationValue(1, new TCollection_HAsciiString(company.c_str()));
     makeHeader.SetOriginatingSystem(
         new TCollection_HAsciiString(App::Application::getExecutableName().c_str())
     );
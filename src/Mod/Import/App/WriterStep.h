@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <Mod/Import/ImportGlobal.h>
 #include <Base/FileInfo.h>
 #include <TDocStd_Document.hxx>
@@ -39,5 +41,7 @@ public:
 
 private:
     Base::FileInfo file;
+    std::string author;
+    std::string company;
 };
 }  // namespace Import
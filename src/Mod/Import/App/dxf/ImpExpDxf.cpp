@@ -73,6 +73,7 @@
 #include <Base/Console.h>
 #include <Base/Interpreter.h>
 #include <Base/Matrix.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 #include <Base/Vector3D.h>
 #include <Base/PlacementPy.h>
@@ -477,6 +478,7 @@ bool ImpExpDxfRead::ReadEntitiesSection()
             if (!CDxfRead::ReadEntitiesSection()) {
                 return false;
             }
+            savingCollector.BuildDeferredShapes();
         }
 
         // Merge the contents of ShapesToCombine and AddObject the result(s)
@@ -503,6 +505,20 @@ bool ImpExpDxfRead::ReadEntitiesSection()
     return true;
 }
 
+void ImpExpDxfRead::ShapeSavingEntityCollector::BuildDeferredShapes()
+{
+    Base::parallelFor(DeferredShapes.size(), [this](std::size_t index) {
+        auto& [shape, makeShape] = DeferredShapes[index];
+        try {
+            *shape = makeShape();
+        }
+        catch (const Standard_Failure&) {
+            // the shape stays null and is skipped by CombineShapes()
+        }
+    });
+    DeferredShapes.clear();
+}
+
 void ImpExpDxfRead::CombineShapes(std::list<TopoDS_Shape>& shapes, const char* nameBase) const
 {
     BRep_Builder builder;
@@ -955,25 +971,27 @@ void ImpExpDxfRead::OnReadLine(const Base::Vector3d& start, const Base::Vector3d
     if (p0.IsEqual(p1, 1e-8)) {
         return;
     }
-    TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(p0, p1).Edge();
-    GeometryBuilder builder(edge);
+    auto type = GeometryBuilder::PrimitiveType::None;
 
     // CORRECTED: Set PrimitiveType conditionally based on m_importMode
     switch (m_importMode) {
         case ImportMode::EditableDraft:
         case ImportMode::EditablePrimitives:
             // For these modes, we want a specific Part primitive (Part::Line)
-            builder.type = GeometryBuilder::PrimitiveType::Line;
+            type = GeometryBuilder::PrimitiveType::Line;
             break;
         case ImportMode::IndividualShapes:
         case ImportMode::FusedShapes:
             // For these modes, we want a generic Part::Feature wrapping the TopoDS_Shape.
             // PrimitiveType::None will lead to a generic Part::Feature in AddGeometry.
-            builder.type = GeometryBuilder::PrimitiveType::None;
+            type = GeometryBuilder::PrimitiveType::None;
             break;
     }
 
-    Collector->AddGeometry(builder);
+    Collector->AddDeferredGeometry(
+        [p0, p1]() -> TopoDS_Shape { return BRepBuilderAPI_MakeEdge(p0, p1).Edge(); },
+        type
+    );
 }
 
 
@@ -1024,20 +1042,24 @@ void ImpExpDxfRead::OnReadArc(
         return;
     }
 
-    TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge();
-    GeometryBuilder builder(edge);  // Instantiate builder once
+    auto type = GeometryBuilder::PrimitiveType::None;
 
     switch (m_importMode) {
         case ImportMode::EditableDraft:
         case ImportMode::EditablePrimitives:
-            builder.type = GeometryBuilder::PrimitiveType::Arc;
+            type = GeometryBuilder::PrimitiveType::Arc;
             break;
         case ImportMode::IndividualShapes:
         case ImportMode::FusedShapes:
-            builder.type = GeometryBuilder::PrimitiveType::None;  // Generic Part::Feature
+            type = GeometryBuilder::PrimitiveType::None;  // Generic Part::Feature
             break;
     }
-    Collector->AddGeometry(builder);
+    Collector->AddDeferredGeometry(
+        [circle, p0, p1]() -> TopoDS_Shape {
+            return BRepBuilderAPI_MakeEdge(circle, p0, p1).Edge();
+        },
+        type
+    );
 }
 
 
@@ -1059,20 +1081,22 @@ void ImpExpDxfRead::OnReadCircle(const Base::Vector3d& start, const Base::Vector
         return;
     }
 
-    TopoDS_Edge edge = BRepBuilderAPI_MakeEdge(circle).Edge();
-    GeometryBuilder builder(edge);  // Instantiate builder once
+    auto type = GeometryBuilder::PrimitiveType::None;
 
     switch (m_importMode) {
         case ImportMode::EditableDraft:
         case ImportMode::EditablePrimitives:
-            builder.type = GeometryBuilder::PrimitiveType::Circle;
+            type = GeometryBuilder::PrimitiveType::Circle;
             break;
         case ImportMode::IndividualShapes:
         case ImportMode::FusedShapes:
-            builder.type = GeometryBuilder::PrimitiveType::None;  // Generic Part::Feature
+            type = GeometryBuilder::PrimitiveType::None;  // Generic Part::Feature
             break;
     }
-    Collector->AddGeometry(builder);
+    Collector->AddDeferredGeometry(
+        [circle]() -> TopoDS_Shape { return BRepBuilderAPI_MakeEdge(circle).Edge(); },
+        type
+    );
 }
 
 
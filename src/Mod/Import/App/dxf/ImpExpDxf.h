@@ -215,6 +215,7 @@ protected:
     };
 
     using FeaturePythonBuilder = std::function<App::FeaturePython*(const Base::Matrix4D& transform)>;
+    using ShapeMaker = std::function<TopoDS_Shape()>;
     // Block management
     class Block
     {
@@ -301,6 +302,17 @@ protected:
         virtual void AddObject(const TopoDS_Shape& shape, const char* nameBase) = 0;
         // Generic method to add a new geometry builder
         virtual void AddGeometry(const GeometryBuilder& builder) = 0;
+        // Called by OnReadXxxx functions for simple edges. The shape is made by calling makeShape,
+        // which a collector may postpone until all entities are read.
+        virtual void AddDeferredGeometry(
+            const ShapeMaker& makeShape,
+            GeometryBuilder::PrimitiveType type
+        )
+        {
+            GeometryBuilder builder(makeShape());
+            builder.type = type;
+            AddGeometry(builder);
+        }
         // Called by OnReadInsert to add App::Link or other C++-created objects
         virtual void AddObject(App::DocumentObject* obj, const char* nameBase) = 0;
         // Called by OnReadXxxx functions to add FeaturePython (draft) objects.
@@ -404,14 +416,28 @@ protected:
             ShapesList[Reader.m_entityAttributes].push_back(builder.shape);
         }
 
+        void AddDeferredGeometry(
+            const ShapeMaker& makeShape,
+            GeometryBuilder::PrimitiveType /*type*/
+        ) override
+        {
+            // Keep the place of the shape in the list, it is made by BuildDeferredShapes()
+            TopoDS_Shape& shape = ShapesList[Reader.m_entityAttributes].emplace_back();
+            DeferredShapes.emplace_back(&shape, makeShape);
+        }
+
         void AddObject(App::DocumentObject* obj, const char* nameBase) override
         {
             // A Link is not a shape to be merged, so pass to base class for standard handling.
             DrawingEntityCollector::AddObject(obj, nameBase);
         }
 
+        // Makes the shapes passed to AddDeferredGeometry() in parallel
+        void BuildDeferredShapes();
+
     private:
         std::map<CDxfRead::CommonEntityAttributes, std::list<TopoDS_Shape>>& ShapesList;
+        std::vector<std::pair<TopoDS_Shape*, ShapeMaker>> DeferredShapes;
     };
 #ifdef LATER
     class PolylineEntityCollector: public CombiningDrawingEntityCollector
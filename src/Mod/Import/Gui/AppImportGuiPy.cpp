@@ -174,6 +174,8 @@ private:
             options.setItem("reduceObjects", Py::Boolean(stepSettings.reduceObjects));
             options.setItem("showProgress", Py::Boolean(stepSettings.showProgress));
             options.setItem("expandCompound", Py::Boolean(stepSettings.expandCompound));
+            options.setItem("deduplicateShapes", Py::Boolean(stepSettings.deduplicateShapes));
+            options.setItem("tessellationOnly", Py::Boolean(stepSettings.tessellationOnly));
             options.setItem("mode", Py::Long(stepSettings.mode));
             options.setItem("codePage", Py::Long(stepSettings.codePage));
         }
@@ -287,6 +289,16 @@ private:
                             static_cast<bool>(Py::Boolean(options.getItem("expandCompound")))
                         );
                     }
+                    if (options.hasKey("deduplicateShapes")) {
+                        ocaf.setDeduplicateShapes(
+                            static_cast<bool>(Py::Boolean(options.getItem("deduplicateShapes")))
+                        );
+                    }
+                    if (options.hasKey("tessellationOnly")) {
+                        ocaf.setTessellationOnly(
+                            static_cast<bool>(Py::Boolean(options.getItem("tessellationOnly")))
+                        );
+                    }
                     if (options.hasKey("mode")) {
                         ocaf.setMode(static_cast<int>(Py::Long(options.getItem("mode"))));
                     }
@@ -25,6 +25,7 @@
 
 #include "ImportOCAFGui.h"
 #include <Gui/Application.h>
+#include <Gui/ViewProviderGeometryObject.h>
 #include <Gui/ViewProviderLink.h>
 #include <Mod/Part/Gui/ViewProvider.h>
 
@@ -103,6 +104,18 @@ void ImportOCAFGui::applyLinkColor(App::DocumentObject* obj, int index, Base::Co
     vp->MaterialList.set1Value(index, mat);
 }
 
+void ImportOCAFGui::applyMeshColor(App::DocumentObject* obj, Base::Color color)
+{
+    auto vp = dynamic_cast<Gui::ViewProviderGeometryObject*>(
+        Gui::Application::Instance->getViewProvider(obj)
+    );
+    if (!vp) {
+        return;
+    }
+    vp->ShapeAppearance.setDiffuseColor(color);
+    vp->Transparency.setValue(100 * color.transparency());
+}
+
 void ImportOCAFGui::applyElementColors(
     App::DocumentObject* obj,
     const std::map<std::string, Base::Color>& colors
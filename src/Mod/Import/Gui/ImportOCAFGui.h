@@ -38,6 +38,7 @@ private:
     void applyFaceColors(Part::Feature* part, const std::vector<Base::Color>& colors) override;
     void applyEdgeColors(Part::Feature* part, const std::vector<Base::Color>& colors) override;
     void applyLinkColor(App::DocumentObject* obj, int index, Base::Color color) override;
+    void applyMeshColor(App::DocumentObject* obj, Base::Color color) override;
     void applyElementColors(
         App::DocumentObject* obj,
         const std::map<std::string, Base::Color>& colors
@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
 #include <numeric>
 #include <limits>
 
@@ -31,7 +32,9 @@
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp_Face.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <gp_Pnt.hxx>
 
 #include <QEventLoop>
@@ -44,13 +47,15 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 #include <Mod/Part/App/PartFeature.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Points/App/PointsFeature.h>
-#include <Mod/Points/App/PointsGrid.h>
+#include <Mod/Points/App/PointsKDTree.h>
 
 #include "InspectionFeature.h"
 
@@ -201,7 +206,7 @@ protected:
         assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
     }
 
-    void AddFacet(const MeshCore::MeshGeomFacet& rclFacet, unsigned long ulFacetIndex)
+    void GetGrids(MeshCore::ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const override
     {
         unsigned long ulX1;
         unsigned long ulY1;
@@ -210,6 +215,11 @@ protected:
         unsigned long ulY2;
         unsigned long ulZ2;
 
+        MeshCore::MeshGeomFacet rclFacet = _pclMesh->GetFacet(ulIndex);
+        for (auto& pnt : rclFacet._aclPoints) {
+            pnt = _transform * pnt;
+        }
+
         Base::BoundBox3f clBB;
         clBB.Add(rclFacet._aclPoints[0]);
         clBB.Add(rclFacet._aclPoints[1]);
@@ -224,21 +234,19 @@ protected:
                 for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
                     for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
                         if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                            _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
+                            raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
                         }
                     }
                 }
             }
         }
         else {
-            _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
+            raulGrids.push_back(GetIndexToPosition(ulX1, ulY1, ulZ1));
         }
     }
 
     void InitGrid() override
     {
-        unsigned long i, j;
-
         Base::BoundBox3f clBBMesh = _pclMesh->GetBoundBox().Transformed(_transform);
 
         float fLengthX = clBBMesh.LengthX();
@@ -253,28 +261,13 @@ protected:
 
         _fGridLenZ = (1.0f + fLengthZ) / float(_ulCtGridsZ);
         _fMinZ = clBBMesh.MinZ - 0.5f;
-
-        _aulGrid.clear();
-        _aulGrid.resize(_ulCtGridsX);
-        for (i = 0; i < _ulCtGridsX; i++) {
-            _aulGrid[i].resize(_ulCtGridsY);
-            for (j = 0; j < _ulCtGridsY; j++) {
-                _aulGrid[i][j].resize(_ulCtGridsZ);
-            }
-        }
     }
 
     void RebuildGrid() override
     {
         _ulCtElements = _pclMesh->CountFacets();
         InitGrid();
-
-        unsigned long i = 0;
-        MeshCore::MeshFacetIterator clFIter(*_pclMesh);
-        clFIter.Transform(_transform);
-        for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-            AddFacet(*clFIter, i++);
-        }
+        FillGrid();
     }
 
 private:
@@ -289,30 +282,18 @@ InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offs
     _clTrf = rMesh.getTransform();
     _bApply = _clTrf != tmp;
 
-    // Max. limit of grid elements
-    float fMaxGridElements = 8000000.0f;
     Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
 
-    // estimate the minimum allowed grid length
-    float fMinGridLen
-        = (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
-
-    // We want to avoid to get too small grid elements otherwise building up the grid structure
-    // would take too much time and memory. Having quite a dense grid speeds up more the following
-    // algorithms extremely. Due to the issue above it's always a compromise between speed and
-    // memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
-
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
+    // the hierarchy doesn't depend on a grid length, so it copes with scans where dense regions
+    // are next to large flat areas
+    _pBVH = new MeshCore::MeshFacetBVH(_mesh, rMesh.getTransform());
     _box = box;
     _box.Enlarge(offset);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pBVH;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -321,29 +302,19 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
         return std::numeric_limits<float>::max();  // must be inside bbox
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
+    Base::Vector3f nearest;
+    MeshCore::FacetIndex index = _pBVH->NearestFacetToPoint(point, nearest);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return std::numeric_limits<float>::max();
     }
 
-    float fMinDist = std::numeric_limits<float>::max();
-    bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
-
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
+    MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(index);
+    if (_bApply) {
+        geomFace.Transform(_clTrf);
     }
 
+    float fMinDist = geomFace.DistanceToPoint(point);
+    bool positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
     if (!positive) {
         fMinDist = -fMinDist;
     }
@@ -441,43 +412,143 @@ float InspectNominalFastMesh::getDistance(const Base::Vector3f& point) const
 InspectNominalPoints::InspectNominalPoints(const Points::PointKernel& Kernel, float /*offset*/)
     : _rKernel(Kernel)
 {
-    int uGridPerAxis = 50;  // totally 125.000 grid elements
-    this->_pGrid = new Points::PointsGrid(Kernel, uGridPerAxis);
+    // the tree adapts to the density of the points and is shared with the kernel
+    _kdTree = Kernel.getKDTree();
 }
 
-InspectNominalPoints::~InspectNominalPoints()
-{
-    delete this->_pGrid;
-}
+InspectNominalPoints::~InspectNominalPoints() = default;
 
 float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 {
-    // TODO: Make faster
-    std::set<unsigned long> indices;
-    unsigned long x, y, z;
+    std::size_t index = _kdTree->findNearest(point);
+    if (index == Points::PointsKDTree::npos) {
+        return std::numeric_limits<float>::max();
+    }
+
     Base::Vector3d pointd(point.x, point.y, point.z);
-    _pGrid->Position(pointd, x, y, z);
-    _pGrid->GetElements(x, y, z, indices);
+    Base::Vector3d pt = _rKernel.getPoint(static_cast<int>(index));
+    return (float)Base::Distance(pointd, pt);
+}
 
-    double fMinDist = std::numeric_limits<double>::max();
-    for (unsigned long it : indices) {
-        Base::Vector3d pt = _rKernel.getPoint(it);
-        double fDist = Base::Distance(pointd, pt);
-        if (fDist < fMinDist) {
-            fMinDist = fDist;
+// ----------------------------------------------------------------
+
+/*
+ * The triangulation of the faces is only used to find the faces that can hold the nearest point,
+ * the distance itself is always computed on the exact geometry of these faces.
+ */
+struct InspectNominalShape::PreparedShape
+{
+    void tessellate();
+    std::vector<std::size_t> nearFaces(const Base::Vector3f& point) const;
+
+    /// the shape the distances are measured to, for a solid this is its outer shell
+    TopoDS_Shape surface;
+    /// the faces of the surface in the order of TopExp_Explorer
+    std::vector<TopoDS_Face> faces;
+    /// the triangulation of all faces, faceOfFacet maps a facet to its face
+    MeshCore::MeshKernel mesh;
+    std::vector<std::size_t> faceOfFacet;
+    MeshCore::MeshFacetBVH bvh;
+    double deflection {0.0};
+    /// false if a part of the surface is not covered by the triangulation
+    bool complete {false};
+};
+
+void InspectNominalShape::PreparedShape::tessellate()
+{
+    if (surface.IsNull()) {
+        return;
+    }
+
+    // free edges and vertices are not covered by the triangulation
+    if (TopExp_Explorer(surface, TopAbs_EDGE, TopAbs_FACE).More()
+        || TopExp_Explorer(surface, TopAbs_VERTEX, TopAbs_EDGE).More()) {
+        return;
+    }
+
+    for (TopExp_Explorer xp(surface, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+
+    // use the same settings as TopoShape::getFaces() to share the triangulation
+    Part::TopoShape topoShape(surface);
+    deflection = topoShape.getAccuracy();
+    Part::Tools::meshShape(surface, deflection, std::min(0.1, deflection * 5 + 0.005));
+
+    std::vector<Data::ComplexGeoData::Domain> domains;
+    topoShape.getDomains(domains);
+    if (faces.empty() || faces.size() != domains.size()) {
+        return;
+    }
+
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (std::size_t index = 0; index < domains.size(); index++) {
+        const Data::ComplexGeoData::Domain& domain = domains[index];
+        if (domain.facets.empty()) {
+            return;  // the face couldn't be meshed
+        }
+
+        auto offset = static_cast<MeshCore::PointIndex>(points.size());
+        for (const auto& pnt : domain.points) {
+            points.emplace_back(Base::toVector<float>(pnt));
+        }
+        for (const auto& facet : domain.facets) {
+            facets.emplace_back(offset + facet.I1, offset + facet.I2, offset + facet.I3);
+            faceOfFacet.push_back(index);
         }
     }
 
-    return (float)fMinDist;
+    mesh.Adopt(points, facets);
+    bvh.Build(mesh);
+    complete = true;
 }
 
-// ----------------------------------------------------------------
+std::vector<std::size_t> InspectNominalShape::PreparedShape::nearFaces(
+    const Base::Vector3f& point
+) const
+{
+    std::vector<std::size_t> result;
+    if (!complete) {
+        return result;
+    }
+
+    Base::Vector3f nearest;
+    MeshCore::FacetIndex index = bvh.NearestFacetToPoint(point, nearest);
+    if (index == MeshCore::FACET_INDEX_MAX) {
+        return result;
+    }
+
+    // the triangulation deviates from the faces by up to the deflection, so every face with
+    // facets that close to the nearest facet may hold the nearest point
+    float radius = Base::Distance(point, nearest) + 2.0F * static_cast<float>(deflection);
+    Base::BoundBox3f box(
+        point.x - radius,
+        point.y - radius,
+        point.z - radius,
+        point.x + radius,
+        point.y + radius,
+        point.z + radius
+    );
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.SearchFacets(box, facets);
+    for (MeshCore::FacetIndex it : facets) {
+        if (mesh.GetFacet(it).DistanceToPoint(point) <= radius) {
+            result.push_back(faceOfFacet[it]);
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
 
 InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
-    : _rShape(shape)
+    : _pPrepared(new PreparedShape)
+    , _rShape(shape)
 {
-    distss = new BRepExtrema_DistShapeShape();
-    distss->LoadS1(_rShape);
+    _pPrepared->surface = _rShape;
 
     // When having a solid then use its shell because otherwise the distance
     // for inner points will always be zero
@@ -485,38 +556,53 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
         TopExp_Explorer xp;
         xp.Init(_rShape, TopAbs_SHELL);
         if (xp.More()) {
-            distss->LoadS1(xp.Current());
+            _pPrepared->surface = xp.Current();
             isSolid = true;
         }
     }
-    // distss->SetDeflection(radius);
+
+    _pPrepared->tessellate();
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
-    delete distss;
+    delete _pPrepared;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 {
+    // all state is local, so this can be called from several threads at once
     gp_Pnt pnt3d(point.x, point.y, point.z);
     BRepBuilderAPI_MakeVertex mkVert(pnt3d);
-    distss->LoadS2(mkVert.Vertex());
 
     float fMinDist = std::numeric_limits<float>::max();
-    if (distss->Perform() && distss->NbSolution() > 0) {
-        fMinDist = (float)distss->Value();
+    bool belowFace = false;
+    auto measure = [&](const TopoDS_Shape& shape) {
+        BRepExtrema_DistShapeShape distss(shape, mkVert.Vertex());
+        if (distss.IsDone() && distss.NbSolution() > 0 && distss.Value() < fMinDist) {
+            fMinDist = (float)distss.Value();
+            // check if the distance was computed from a face
+            belowFace = !isSolid && fMinDist > 0 && isBelowFace(distss, pnt3d);
+        }
+    };
+
+    std::vector<std::size_t> faces = _pPrepared->nearFaces(point);
+    if (faces.empty()) {
+        measure(_pPrepared->surface);
+    }
+    for (std::size_t index : faces) {
+        measure(_pPrepared->faces[index]);
+    }
+
+    if (fMinDist < std::numeric_limits<float>::max()) {
         // the shape is a solid, check if the vertex is inside
         if (isSolid) {
             if (isInsideSolid(pnt3d)) {
                 fMinDist = -fMinDist;
             }
         }
-        else if (fMinDist > 0) {
-            // check if the distance was computed from a face
-            if (isBelowFace(pnt3d)) {
-                fMinDist = -fMinDist;
-            }
+        else if (belowFace) {
+            fMinDist = -fMinDist;
         }
     }
     return fMinDist;
@@ -530,15 +616,18 @@ bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
     return (classifier.State() == TopAbs_IN);
 }
 
-bool InspectNominalShape::isBelowFace(const gp_Pnt& pnt3d) const
+bool InspectNominalShape::isBelowFace(
+    const BRepExtrema_DistShapeShape& distss,
+    const gp_Pnt& pnt3d
+) const
 {
     // check if the distance was computed from a face
-    for (Standard_Integer index = 1; index <= distss->NbSolution(); index++) {
-        if (distss->SupportTypeShape1(index) == BRepExtrema_IsInFace) {
-            TopoDS_Shape face = distss->SupportOnShape1(index);
+    for (Standard_Integer index = 1; index <= distss.NbSolution(); index++) {
+        if (distss.SupportTypeShape1(index) == BRepExtrema_IsInFace) {
+            TopoDS_Shape face = distss.SupportOnShape1(index);
             Standard_Real u, v;
-            distss->ParOnFaceS1(index, u, v);
-            // gp_Pnt pnt = distss->PointOnShape1(index);
+            distss.ParOnFaceS1(index, u, v);
+            // gp_Pnt pnt = distss.PointOnShape1(index);
             BRepGProp_Face props(TopoDS::Face(face));
             gp_Vec normal;
             gp_Pnt center;
@@ -809,7 +898,6 @@ App::DocumentObjectExecReturn* Feature::execute()
         actual = new InspectActualPoints(pts->Points.getValue());
     }
     else if (pcActual->isDerivedFrom<Part::Feature>()) {
-        useMultithreading = false;
         Part::Feature* part = static_cast<Part::Feature*>(pcActual);
         actual = new InspectActualShape(part->Shape.getShape());
     }
@@ -832,7 +920,6 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
 
@@ -39,6 +41,7 @@ namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshFacetBVH;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -47,7 +50,7 @@ class MeshObject;
 }
 namespace Points
 {
-class PointsGrid;
+class PointsKDTree;
 }
 namespace Part
 {
@@ -126,7 +129,7 @@ public:
 
 private:
     const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
+    MeshCore::MeshFacetBVH* _pBVH;
     Base::BoundBox3f _box;
     bool _bApply;
     Base::Matrix4D _clTrf;
@@ -157,7 +160,7 @@ public:
 
 private:
     const Points::PointKernel& _rKernel;
-    Points::PointsGrid* _pGrid;
+    std::shared_ptr<const Points::PointsKDTree> _kdTree;
 };
 
 class InspectionExport InspectNominalShape: public InspectNominalGeometry
@@ -169,10 +172,11 @@ public:
 
 private:
     bool isInsideSolid(const gp_Pnt&) const;
-    bool isBelowFace(const gp_Pnt&) const;
+    bool isBelowFace(const BRepExtrema_DistShapeShape&, const gp_Pnt&) const;
 
 private:
-    BRepExtrema_DistShapeShape* distss;
+    struct PreparedShape;
+    PreparedShape* _pPrepared;
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
@@ -31,6 +31,7 @@
 
 #include <App/Application.h>
 #include <Base/Interpreter.h>
+#include <Base/Parallel.h>
 #include <Base/Stream.h>
 #include <Gui/MetaTypes.h>
 
@@ -367,6 +368,7 @@ void MaterialYamlEntry::addToTree(
 
 std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>>
     MaterialLoader::_materialEntryMap = nullptr;
+std::map<QString, MaterialLoader::MaterialCard> MaterialLoader::_cardCache;
 
 MaterialLoader::MaterialLoader(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
@@ -540,33 +542,95 @@ void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
     dereference(_materialMap, material);
 }
 
+MaterialLoader::MaterialCard MaterialLoader::readCard(const QString& path, const QFileInfo& info)
+{
+    MaterialCard card;
+    card.modified = info.lastModified();
+    card.size = info.size();
+    card.configStyle = MaterialConfigLoader::isConfigStyle(path);
+    if (card.configStyle) {
+        return card;
+    }
+
+    std::string pathName = path.toStdString();
+    Base::FileInfo fi(pathName);
+    Base::ifstream fin(fi);
+    if (!fin) {
+        card.error = "YAML file open error: '" + pathName + "'";
+        return card;
+    }
+    try {
+        card.yaml = YAML::Load(fin);
+    }
+    catch (YAML::Exception const& e) {
+        card.error = "YAML parsing error: '" + pathName + "'\n\t'" + e.what() + "'";
+    }
+    return card;
+}
+
 void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibraryLocal>& library)
 {
     if (_materialEntryMap == nullptr) {
         _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
     }
 
+    std::vector<QFileInfo> files;
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
-                try {
-                    auto model = getMaterialFromPath(library, file.canonicalFilePath());
-                    if (model) {
-                        (*_materialEntryMap)[model->getUUID()] = model;
-                    }
-                }
-                catch (const MaterialReadError&) {
-                    // Ignore the file. Error messages should have already been logged
-                }
+                files.push_back(file);
             }
         }
     }
 
-    for (auto& it : *_materialEntryMap) {
-        it.second->addToTree(_materialMap);
+    // Reading and parsing the cards is independent for each file, which matters most for
+    // libraries on a network share. Cards that did not change since the last time the library
+    // was loaded are not parsed again.
+    std::vector<QString> paths(files.size());
+    std::vector<MaterialCard> cards(files.size());
+    Base::parallelFor(files.size(), [&](std::size_t i) {
+        paths[i] = files[i].canonicalFilePath();
+        auto cached = _cardCache.find(paths[i]);
+        if (cached != _cardCache.end() && cached->second.modified == files[i].lastModified()
+            && cached->second.size == files[i].size()) {
+            cards[i] = cached->second;
+            return;
+        }
+        cards[i] = readCard(paths[i], files[i]);
+    });
+
+    std::vector<std::shared_ptr<MaterialEntry>> entries;
+    for (std::size_t i = 0; i < files.size(); i++) {
+        const QString& path = paths[i];
+        MaterialCard& card = cards[i];
+        _cardCache[path] = card;
+        try {
+            std::shared_ptr<MaterialEntry> model;
+            if (card.configStyle) {
+                // Old style cards have no inheritance to resolve
+                getMaterialFromPath(library, path);
+            }
+            else if (!card.error.empty()) {
+                Base::Console().error("%s\n", card.error.c_str());
+            }
+            else {
+                model = getMaterialFromYAML(library, card.yaml, path);
+            }
+            if (model) {
+                (*_materialEntryMap)[model->getUUID()] = model;
+                entries.push_back(model);
+            }
+        }
+        catch (const MaterialReadError&) {
+            // Ignore the file. Error messages should have already been logged
+        }
+    }
+
+    for (auto& entry : entries) {
+        entry->addToTree(_materialMap);
     }
 }
 
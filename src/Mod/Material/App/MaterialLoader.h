@@ -25,6 +25,7 @@
 
 #include <memory>
 
+#include <QDateTime>
 #include <QDir>
 #include <QString>
 #include <yaml-cpp/yaml.h>
@@ -131,6 +132,17 @@ public:
 private:
     MaterialLoader();
 
+    // A parsed card file, kept to skip parsing it again while it does not change
+    struct MaterialCard
+    {
+        QDateTime modified;
+        qint64 size = -1;
+        bool configStyle = false;
+        YAML::Node yaml;
+        std::string error;
+    };
+    static MaterialCard readCard(const QString& path, const QFileInfo& info);
+
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
     std::shared_ptr<MaterialEntry>
@@ -141,6 +153,7 @@ private:
         const std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>>& libraryList);
 
     static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
+    static std::map<QString, MaterialCard> _cardCache;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
 };
@@ -23,6 +23,9 @@
 
 #include <Mod/Measure/MeasureGlobal.h>
 
+#include <atomic>
+
+#include <App/Application.h>
 #include <App/PropertyGeo.h>
 #include <Base/PlacementPy.h>
 #include <App/FeaturePythonPyImp.h>
@@ -34,6 +37,19 @@
 
 using namespace Measure;
 
+namespace
+{
+std::atomic<std::uint64_t> geometryRevision {0};
+
+void changeGeometryRevision(const App::DocumentObject& obj)
+{
+    // Measurements only write their results
+    if (!obj.isDerivedFrom<MeasureBase>()) {
+        ++geometryRevision;
+    }
+}
+}  // namespace
+
 
 PROPERTY_SOURCE(Measure::MeasureBase, App::DocumentObject)
 
@@ -68,6 +84,25 @@ Py::Object MeasureBase::getProxyObject() const
     return dynamic_cast<App::PropertyPythonObject*>(prop)->getValue();
 };
 
+std::uint64_t MeasureBase::getGeometryRevision()
+{
+    // Connected on first use, nothing is cached before
+    static const bool connected = [] {
+        auto& app = App::GetApplication();
+        app.signalNewObject.connect(&changeGeometryRevision);
+        app.signalDeletedObject.connect(&changeGeometryRevision);
+        app.signalChangedObject.connect(
+            [](const App::DocumentObject& obj, const App::Property&) {
+                changeGeometryRevision(obj);
+            }
+        );
+        app.signalFinishRestoreDocument.connect([](const App::Document&) { ++geometryRevision; });
+        return true;
+    }();
+    (void)connected;
+    return geometryRevision;
+}
+
 std::vector<App::DocumentObject*> MeasureBase::getSubject() const
 {
     Base::PyGILStateLocker lock;
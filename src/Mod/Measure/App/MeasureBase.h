@@ -29,6 +29,11 @@
 #include <memory>
 #include <QString>
 
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include <App/DocumentObject.h>
 #include <App/MeasureManager.h>
 #include <App/DocumentObserver.h>
@@ -77,6 +82,9 @@ public:
     // Return the objects that are measured
     virtual std::vector<App::DocumentObject*> getSubject() const;
 
+    // Changes whenever an object that is not a measurement changes or is added or removed
+    static std::uint64_t getGeometryRevision();
+
 private:
     Py::Object getProxyObject() const;
 
@@ -113,7 +121,51 @@ public:
 
     static Part::MeasureInfoPtr getMeasureInfo(App::SubObjectT& subObjT)
     {
+        // Measurements of the same subelement share the resolved geometry as long as no
+        // object changes, e.g. during a recompute of many measurements.
+        std::string key = subObjT.getDocumentName() + "#" + subObjT.getObjectName() + "."
+            + subObjT.getSubName();
+        std::uint64_t revision = getGeometryRevision();
+        {
+            std::lock_guard<std::mutex> lock(_mInfoCacheMutex);
+            if (_mInfoCacheRevision != revision) {
+                _mInfoCache.clear();
+                _mInfoCacheRevision = revision;
+            }
+            auto it = _mInfoCache.find(key);
+            if (it != _mInfoCache.end()) {
+                return it->second;
+            }
+        }
+
+        Part::MeasureInfoPtr info = resolveMeasureInfo(subObjT);
+        if (info) {
+            std::lock_guard<std::mutex> lock(_mInfoCacheMutex);
+            if (_mInfoCacheRevision == revision) {
+                _mInfoCache[key] = info;
+            }
+        }
+        return info;
+    }
+
+    static void addGeometryHandlers(const std::vector<std::string>& modules, GeometryHandler callback)
+    {
+        // TODO: this will replace a callback with a later one.  Should we check that there isn't
+        // already a handler defined for this module?
+        for (auto& mod : modules) {
+            _mGeometryHandlers[mod] = callback;
+        }
+    }
 
+
+    static bool hasGeometryHandler(const std::string& module)
+    {
+        return (_mGeometryHandlers.count(module) > 0);
+    }
+
+private:
+    static Part::MeasureInfoPtr resolveMeasureInfo(App::SubObjectT& subObjT)
+    {
         // Resolve App::Link
         App::DocumentObject* sub = subObjT.getSubObject();
         if (!sub) {
@@ -141,23 +193,10 @@ public:
         return handler(subObjT);
     }
 
-    static void addGeometryHandlers(const std::vector<std::string>& modules, GeometryHandler callback)
-    {
-        // TODO: this will replace a callback with a later one.  Should we check that there isn't
-        // already a handler defined for this module?
-        for (auto& mod : modules) {
-            _mGeometryHandlers[mod] = callback;
-        }
-    }
-
-
-    static bool hasGeometryHandler(const std::string& module)
-    {
-        return (_mGeometryHandlers.count(module) > 0);
-    }
-
-private:
     inline static HandlerMap _mGeometryHandlers = MeasureBaseExtendable<T>::HandlerMap();
+    inline static std::unordered_map<std::string, Part::MeasureInfoPtr> _mInfoCache;
+    inline static std::uint64_t _mInfoCacheRevision = 0;
+    inline static std::mutex _mInfoCacheMutex;
 };
 
 
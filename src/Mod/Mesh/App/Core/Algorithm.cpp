@@ -27,9 +27,11 @@
 #include <limits>
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
+#include "BVH.h"
 #include "Approximation.h"
 #include "Elements.h"
 #include "Grid.h"
@@ -180,6 +182,17 @@ bool MeshAlgorithm::NearestFacetOnRay(
     return false;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(
+    const Base::Vector3f& rclPt,
+    const Base::Vector3f& rclDir,
+    const MeshFacetBVH& rclBVH,
+    Base::Vector3f& rclRes,
+    FacetIndex& rulFacet
+) const
+{
+    return rclBVH.NearestFacetOnRay(rclPt, rclDir, rclRes, rulFacet);
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(
     const Base::Vector3f& rclPt,
     const Base::Vector3f& rclDir,
@@ -1305,21 +1318,29 @@ void MeshAlgorithm::CheckFacets(
 {
     const MeshPointArray& p = _rclMesh.GetPoints();
     const MeshFacetArray& f = _rclMesh.GetFacets();
-    Base::Vector3f pt2d;
     // Use a bounding box to reduce number of call to Polygon::Contains
     Base::BoundBox2d bb = rclPoly.CalcBoundBox();
     // Precompute the screen projection matrix as Coin's projection function is expensive
     Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
 
+    // A point is shared by about six facets, so each point is projected and tested only once.
+    // The points are independent of each other and are tested in parallel blocks.
+    constexpr std::size_t blockSize = 4096;
+    std::vector<char> inside(p.size());
+    Base::parallelFor((p.size() + blockSize - 1) / blockSize, [&](std::size_t block) {
+        std::size_t end = std::min(p.size(), (block + 1) * blockSize);
+        for (std::size_t i = block * blockSize; i < end; i++) {
+            Base::Vector3f pt2d = fixedProj(p[i]);
+            Base::Vector2d pt(pt2d.x, pt2d.y);
+            // First check whether the point is in the bounding box of the polygon
+            inside[i] = bb.Contains(pt) && rclPoly.Contains(pt) ? 1 : 0;
+        }
+    });
+
     FacetIndex index = 0;
     for (auto it = f.begin(); it != f.end(); ++it, ++index) {
         for (PointIndex ptIndex : it->_aulPoints) {
-            pt2d = fixedProj(p[ptIndex]);
-
-            // First check whether the point is in the bounding box of the polygon
-            if ((bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
-                 && rclPoly.Contains(Base::Vector2d(pt2d.x, pt2d.y)))
-                ^ !bInner) {
+            if ((inside[ptIndex] != 0) ^ !bInner) {
                 raulFacets.push_back(index);
                 break;
             }
@@ -1403,6 +1424,42 @@ void MeshAlgorithm::SearchFacetsFromPolyline(
     rclResultFacetsIndices.insert(rclResultFacetsIndices.begin(), aclFacets.begin(), aclFacets.end());
 }
 
+void MeshAlgorithm::SearchFacetsFromPolyline(
+    const std::vector<Base::Vector3f>& rclPolyline,
+    float fRadius,
+    const MeshFacetBVH& rclBVH,
+    std::vector<FacetIndex>& rclResultFacetsIndices
+) const
+{
+    rclResultFacetsIndices.clear();
+    if (rclPolyline.size() < 3) {
+        return;  // no polygon defined
+    }
+
+    std::vector<FacetIndex> aclBBFacets;
+    for (auto pV = rclPolyline.begin(); pV < (rclPolyline.end() - 1); ++pV) {
+        const Base::Vector3f &rclP0 = *pV, &rclP1 = *(pV + 1);
+
+        BoundBox3f clSegmBB(rclP0.x, rclP0.y, rclP0.z, rclP0.x, rclP0.y, rclP0.z);
+        clSegmBB.Add(rclP1);
+        clSegmBB.Enlarge(fRadius);
+
+        aclBBFacets.clear();
+        rclBVH.SearchFacets(clSegmBB, aclBBFacets);
+        for (FacetIndex index : aclBBFacets) {
+            if (_rclMesh.GetFacet(index).DistanceToLineSegment(rclP0, rclP1) < fRadius) {
+                rclResultFacetsIndices.push_back(index);
+            }
+        }
+    }
+
+    std::sort(rclResultFacetsIndices.begin(), rclResultFacetsIndices.end());
+    rclResultFacetsIndices.erase(
+        std::unique(rclResultFacetsIndices.begin(), rclResultFacetsIndices.end()),
+        rclResultFacetsIndices.end()
+    );
+}
+
 void MeshAlgorithm::CutBorderFacets(std::vector<FacetIndex>& raclFacetIndices, unsigned short usLevel) const
 {
     std::vector<FacetIndex> aclToDelete;
@@ -1565,6 +1622,41 @@ bool MeshAlgorithm::NearestPointFromPoint(
     return true;
 }
 
+bool MeshAlgorithm::NearestPointFromPoint(
+    const Base::Vector3f& rclPt,
+    const MeshFacetBVH& rclBVH,
+    FacetIndex& rclResFacetIndex,
+    Base::Vector3f& rclResPoint
+) const
+{
+    FacetIndex ulInd = rclBVH.NearestFacetToPoint(rclPt, rclResPoint);
+
+    if (ulInd == FACET_INDEX_MAX) {
+        return false;
+    }
+
+    rclResFacetIndex = ulInd;
+    return true;
+}
+
+bool MeshAlgorithm::NearestPointFromPoint(
+    const Base::Vector3f& rclPt,
+    const MeshFacetBVH& rclBVH,
+    float fMaxSearchArea,
+    FacetIndex& rclResFacetIndex,
+    Base::Vector3f& rclResPoint
+) const
+{
+    FacetIndex ulInd = rclBVH.NearestFacetToPoint(rclPt, rclResPoint, fMaxSearchArea);
+
+    if (ulInd == FACET_INDEX_MAX) {
+        return false;  // no facet in search area
+    }
+
+    rclResFacetIndex = ulInd;
+    return true;
+}
+
 bool MeshAlgorithm::CutWithPlane(
     const Base::Vector3f& clBase,
     const Base::Vector3f& clNormal,
@@ -47,6 +47,7 @@ class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
 class MeshFacetGrid;
+class MeshFacetBVH;
 class MeshFacetArray;
 class MeshRefPointToFacets;
 class AbstractPolygonTriangulator;
@@ -136,6 +137,19 @@ public:
         Base::Vector3f& rclRes,
         FacetIndex& rulFacet
     ) const;
+    /**
+     * Searches for the nearest facet to the ray defined by (\a rclPt, \a rclDir). The point \a
+     * rclRes holds the intersection point with the ray and the nearest facet with index \a
+     * rulFacet. \note This method is optimized by using a bounding volume hierarchy, unlike the
+     * grid it also works well for meshes with very unevenly distributed facets.
+     */
+    bool NearestFacetOnRay(
+        const Base::Vector3f& rclPt,
+        const Base::Vector3f& rclDir,
+        const MeshFacetBVH& rclBVH,
+        Base::Vector3f& rclRes,
+        FacetIndex& rulFacet
+    ) const;
     /**
      * Searches for the first facet of the grid element (\a rGrid) in that the point \a rPt lies
      * into which is a distance not higher than \a fMaxDistance. Of no such facet is found \a
@@ -381,6 +395,13 @@ public:
         const MeshFacetGrid& rclGrid,
         std::vector<FacetIndex>& rclResultFacetsIndices
     ) const;
+    /** Does the same as the grid based version but uses the hierarchy \a rclBVH. */
+    void SearchFacetsFromPolyline(
+        const std::vector<Base::Vector3f>& rclPolyline,
+        float fRadius,
+        const MeshFacetBVH& rclBVH,
+        std::vector<FacetIndex>& rclResultFacetsIndices
+    ) const;
     /** Projects a point directly to the mesh (means nearest facet), the result is the facet index
      * and the foraminate point, use second version with grid for more performance.
      */
@@ -402,6 +423,19 @@ public:
         FacetIndex& rclResFacetIndex,
         Base::Vector3f& rclResPoint
     ) const;
+    bool NearestPointFromPoint(
+        const Base::Vector3f& rclPt,
+        const MeshFacetBVH& rclBVH,
+        FacetIndex& rclResFacetIndex,
+        Base::Vector3f& rclResPoint
+    ) const;
+    bool NearestPointFromPoint(
+        const Base::Vector3f& rclPt,
+        const MeshFacetBVH& rclBVH,
+        float fMaxSearchArea,
+        FacetIndex& rclResFacetIndex,
+        Base::Vector3f& rclResPoint
+    ) const;
     /** Cuts the mesh with a plane. The result is a list of polylines. */
     bool CutWithPlane(
         const Base::Vector3f& clBase,
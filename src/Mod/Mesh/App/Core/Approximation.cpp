@@ -139,6 +139,13 @@ PlaneFit::PlaneFit()
     , _vDirW(0, 0, 1)
 {}
 
+void PlaneFit::Clear()
+{
+    Approximation::Clear();
+    _sums = Sums();
+    _numSummed = 0;
+}
+
 float PlaneFit::Fit()
 {
     _bIsFitted = true;
@@ -146,27 +153,32 @@ float PlaneFit::Fit()
         return std::numeric_limits<float>::max();
     }
 
-    double sxx {0.0};
-    double sxy {0.0};
-    double sxz {0.0};
-    double syy {0.0};
-    double syz {0.0};
-    double szz {0.0};
-    double mx {0.0};
-    double my {0.0};
-    double mz {0.0};
-
-    for (const auto& vPoint : _vPoints) {
-        sxx += double(vPoint.x * vPoint.x);
-        sxy += double(vPoint.x * vPoint.y);
-        sxz += double(vPoint.x * vPoint.z);
-        syy += double(vPoint.y * vPoint.y);
-        syz += double(vPoint.y * vPoint.z);
-        szz += double(vPoint.z * vPoint.z);
-        mx += double(vPoint.x);
-        my += double(vPoint.y);
-        mz += double(vPoint.z);
-    }
+    // only add the points added since the last fit, in the same order as summing all points
+    auto first = _vPoints.end();
+    std::advance(first, -static_cast<std::ptrdiff_t>(_vPoints.size() - _numSummed));
+    for (auto it = first; it != _vPoints.end(); ++it) {
+        const auto& vPoint = *it;
+        _sums.xx += double(vPoint.x * vPoint.x);
+        _sums.xy += double(vPoint.x * vPoint.y);
+        _sums.xz += double(vPoint.x * vPoint.z);
+        _sums.yy += double(vPoint.y * vPoint.y);
+        _sums.yz += double(vPoint.y * vPoint.z);
+        _sums.zz += double(vPoint.z * vPoint.z);
+        _sums.x += double(vPoint.x);
+        _sums.y += double(vPoint.y);
+        _sums.z += double(vPoint.z);
+    }
+    _numSummed = _vPoints.size();
+
+    double sxx = _sums.xx;
+    double sxy = _sums.xy;
+    double sxz = _sums.xz;
+    double syy = _sums.yy;
+    double syz = _sums.yz;
+    double szz = _sums.zz;
+    double mx = _sums.x;
+    double my = _sums.y;
+    double mz = _sums.z;
 
     size_t nSize = _vPoints.size();
     sxx = sxx - mx * mx / (double(nSize));
@@ -403,6 +415,8 @@ void PlaneFit::ProjectToPlane()
         float fD = (cPnt - cGravity) * cNormal;
         cPnt = cPnt - fD * cNormal;
     }
+    _sums = Sums();
+    _numSummed = 0;
 }
 
 void PlaneFit::Dimension(float& length, float& width) const
@@ -173,7 +173,7 @@ public:
     /**
      * Deletes the inserted points and frees any allocated resources.
      */
-    void Clear();
+    virtual void Clear();
     /**
      * Returns the result of the last fit.
      * @return float Quality of the last fit.
@@ -228,8 +228,11 @@ public:
     /**
      * Fit a plane into the given points. We must have at least three non-collinear points
      * to succeed. If the fit fails FLOAT_MAX is returned.
+     * The sums over the points are kept, so that fitting again after adding a few points only
+     * processes the new points, e.g. while growing a region of a mesh.
      */
     float Fit() override;
+    void Clear() override;
     /**
      * Returns the distance from the point \a rcPoint to the fitted plane. If Fit() has not been
      * called FLOAT_MAX is returned.
@@ -273,6 +276,22 @@ protected:
     Base::Vector3f _vDirV;
     Base::Vector3f _vDirW; /**< Normal of the plane. */
     // NOLINTEND
+
+private:
+    struct Sums
+    {
+        double xx {0.0};
+        double xy {0.0};
+        double xz {0.0};
+        double yy {0.0};
+        double yz {0.0};
+        double zz {0.0};
+        double x {0.0};
+        double y {0.0};
+        double z {0.0};
+    };
+    Sums _sums; /**< Sums over the first _numSummed points. */
+    std::size_t _numSummed {0};
 };
 
 // -------------------------------------------------------------------------------
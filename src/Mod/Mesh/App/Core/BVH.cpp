@@ -0,0 +1,728 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+#include "BVH.h"
+#include "Elements.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+// Leaves with up to this number of facets are always created
+constexpr std::size_t minLeafSize = 2;
+// Leaves with more facets are only created if the facets cannot be split
+constexpr std::size_t maxLeafSize = 8;
+// Number of bins per axis to evaluate the surface area heuristic
+constexpr std::size_t numBins = 16;
+// Relative cost of traversing a node compared to intersecting a facet
+constexpr float traversalCost = 1.0F;
+
+float SurfaceArea(const Base::BoundBox3f& box)
+{
+    if (!box.IsValid()) {
+        return 0.0F;
+    }
+    float lx = box.LengthX();
+    float ly = box.LengthY();
+    float lz = box.LengthZ();
+    return 2.0F * (lx * ly + ly * lz + lz * lx);
+}
+
+float Component(const Base::Vector3f& vec, int axis)
+{
+    return axis == 0 ? vec.x : (axis == 1 ? vec.y : vec.z);
+}
+
+float MinComponent(const Base::BoundBox3f& box, int axis)
+{
+    return axis == 0 ? box.MinX : (axis == 1 ? box.MinY : box.MinZ);
+}
+
+float MaxComponent(const Base::BoundBox3f& box, int axis)
+{
+    return axis == 0 ? box.MaxX : (axis == 1 ? box.MaxY : box.MaxZ);
+}
+
+// Avoids infinite values in the slab test for axis-parallel rays
+float SafeInverse(float value)
+{
+    constexpr float tiny = 1e-30F;
+    if (std::fabs(value) < tiny) {
+        return value < 0.0F ? -1.0F / tiny : 1.0F / tiny;
+    }
+    return 1.0F / value;
+}
+
+// Squared distance between a point and a box, zero if the point is inside
+float DistanceP2(const Base::BoundBox3f& box, const Base::Vector3f& pnt)
+{
+    float dx = std::max({box.MinX - pnt.x, 0.0F, pnt.x - box.MaxX});
+    float dy = std::max({box.MinY - pnt.y, 0.0F, pnt.y - box.MaxY});
+    float dz = std::max({box.MinZ - pnt.z, 0.0F, pnt.z - box.MaxZ});
+    return dx * dx + dy * dy + dz * dz;
+}
+}  // namespace
+
+// ----------------------------------------------------------------
+
+struct MeshFacetBVH::Ray
+{
+    Ray(const Base::Vector3f& pnt, const Base::Vector3f& dir)
+        : org(pnt)
+        , dir(dir)
+        , inv(SafeInverse(dir.x), SafeInverse(dir.y), SafeInverse(dir.z))
+    {}
+
+    /** Returns the ray parameter where the ray enters the box, or FLOAT_MAX if it misses it or only
+     * enters it behind the nearest hit so far. */
+    float IntersectBox(const Base::BoundBox3f& box) const
+    {
+        float tx1 = (box.MinX - org.x) * inv.x;
+        float tx2 = (box.MaxX - org.x) * inv.x;
+        float ty1 = (box.MinY - org.y) * inv.y;
+        float ty2 = (box.MaxY - org.y) * inv.y;
+        float tz1 = (box.MinZ - org.z) * inv.z;
+        float tz2 = (box.MaxZ - org.z) * inv.z;
+        float tmin = std::max({std::min(tx1, tx2), std::min(ty1, ty2), std::min(tz1, tz2), 0.0F});
+        float tmax = std::min({std::max(tx1, tx2), std::max(ty1, ty2), std::max(tz1, tz2), tBest});
+        return tmin <= tmax ? tmin : std::numeric_limits<float>::max();
+    }
+
+    Base::Vector3f org;
+    Base::Vector3f dir;
+    Base::Vector3f inv;
+    float tBest {std::numeric_limits<float>::max()};
+    std::size_t hit {std::numeric_limits<std::size_t>::max()};
+};
+
+/**
+ * Rays in structure of arrays layout, so that the tests of all rays against a box or a facet are
+ * done in simple loops the compiler can vectorize. Unused lanes have a negative tBest and never
+ * hit anything.
+ */
+struct MeshFacetBVH::RayPacket
+{
+    static constexpr std::size_t size = 8;
+
+    void Set(std::size_t lane, const Base::Vector3f& pnt, const Base::Vector3f& dir)
+    {
+        ox[lane] = pnt.x;
+        oy[lane] = pnt.y;
+        oz[lane] = pnt.z;
+        dx[lane] = dir.x;
+        dy[lane] = dir.y;
+        dz[lane] = dir.z;
+        ix[lane] = SafeInverse(dir.x);
+        iy[lane] = SafeInverse(dir.y);
+        iz[lane] = SafeInverse(dir.z);
+        tBest[lane] = std::numeric_limits<float>::max();
+        hit[lane] = std::numeric_limits<std::size_t>::max();
+    }
+
+    void Disable(std::size_t lane)
+    {
+        Set(lane, Base::Vector3f(), Base::Vector3f(1.0F, 1.0F, 1.0F));
+        tBest[lane] = -1.0F;
+    }
+
+    bool IntersectBox(const Base::BoundBox3f& box) const
+    {
+        bool any = false;
+        for (std::size_t i = 0; i < size; i++) {
+            float tx1 = (box.MinX - ox[i]) * ix[i];
+            float tx2 = (box.MaxX - ox[i]) * ix[i];
+            float ty1 = (box.MinY - oy[i]) * iy[i];
+            float ty2 = (box.MaxY - oy[i]) * iy[i];
+            float tz1 = (box.MinZ - oz[i]) * iz[i];
+            float tz2 = (box.MaxZ - oz[i]) * iz[i];
+            float tmin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+            float tmax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+            any |= std::max(tmin, 0.0F) <= std::min(tmax, tBest[i]);
+        }
+        return any;
+    }
+
+    // NOLINTBEGIN
+    std::array<float, size> ox, oy, oz;
+    std::array<float, size> dx, dy, dz;
+    std::array<float, size> ix, iy, iz;
+    std::array<float, size> tBest;
+    std::array<std::size_t, size> hit;
+    // NOLINTEND
+};
+
+// ----------------------------------------------------------------
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& rclM)
+{
+    Build(rclM);
+}
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& rclM, const Base::Matrix4D& rclMat)
+{
+    Build(rclM, rclMat);
+}
+
+void MeshFacetBVH::Build(const MeshKernel& rclM)
+{
+    Build(rclM, Base::Matrix4D());
+}
+
+void MeshFacetBVH::Build(const MeshKernel& rclM, const Base::Matrix4D& rclMat)
+{
+    const MeshFacetArray& rFacets = rclM.GetFacets();
+    const MeshPointArray& rPoints = rclM.GetPoints();
+    bool bTransform = rclMat != Base::Matrix4D();
+
+    std::vector<Base::Vector3f> points;
+    points.reserve(3 * rFacets.size());
+    for (const auto& facet : rFacets) {
+        for (PointIndex index : facet._aulPoints) {
+            const Base::Vector3f& pnt = rPoints[index];
+            points.push_back(bTransform ? rclMat * pnt : pnt);
+        }
+    }
+
+    Build(std::move(points));
+}
+
+void MeshFacetBVH::Clear()
+{
+    _aclNodes.clear();
+    _aulFacets.clear();
+    for (int i = 0; i < 3; i++) {
+        _afX[i].clear();
+        _afY[i].clear();
+        _afZ[i].clear();
+    }
+}
+
+Base::BoundBox3f MeshFacetBVH::GetBoundBox() const
+{
+    if (_aclNodes.empty()) {
+        return Base::BoundBox3f();
+    }
+    return _aclNodes.front().box;
+}
+
+void MeshFacetBVH::Build(std::vector<Base::Vector3f>&& points)
+{
+    Clear();
+
+    std::size_t ulCtFacets = points.size() / 3;
+    if (ulCtFacets == 0) {
+        return;
+    }
+    assert(ulCtFacets < std::numeric_limits<std::uint32_t>::max());
+
+    std::vector<Base::BoundBox3f> boxes(ulCtFacets);
+    std::vector<Base::Vector3f> centers(ulCtFacets);
+    for (std::size_t i = 0; i < ulCtFacets; i++) {
+        boxes[i].Add(points[3 * i]);
+        boxes[i].Add(points[3 * i + 1]);
+        boxes[i].Add(points[3 * i + 2]);
+        centers[i] = boxes[i].GetCenter();
+    }
+
+    std::vector<std::uint32_t> order(ulCtFacets);
+    std::iota(order.begin(), order.end(), 0);
+
+    struct Task
+    {
+        std::size_t node;
+        std::size_t begin;
+        std::size_t end;
+    };
+    struct Bin
+    {
+        Base::BoundBox3f box;
+        std::size_t count {0};
+    };
+
+    _aclNodes.reserve(2 * ulCtFacets / minLeafSize + 1);
+    _aclNodes.emplace_back();
+    std::vector<Task> tasks {{0, 0, ulCtFacets}};
+    while (!tasks.empty()) {
+        Task task = tasks.back();
+        tasks.pop_back();
+
+        Base::BoundBox3f box;
+        Base::BoundBox3f centerBox;
+        for (std::size_t i = task.begin; i < task.end; i++) {
+            box.Add(boxes[order[i]]);
+            centerBox.Add(centers[order[i]]);
+        }
+        _aclNodes[task.node].box = box;
+
+        std::size_t count = task.end - task.begin;
+        auto makeLeaf = [&]() {
+            _aclNodes[task.node].first = static_cast<std::uint32_t>(task.begin);
+            _aclNodes[task.node].count = static_cast<std::uint32_t>(count);
+        };
+        if (count <= minLeafSize) {
+            makeLeaf();
+            continue;
+        }
+
+        // find the cheapest split with the binned surface area heuristic
+        float bestCost = std::numeric_limits<float>::max();
+        int bestAxis = -1;
+        std::size_t bestBin = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            float minC = MinComponent(centerBox, axis);
+            float extent = MaxComponent(centerBox, axis) - minC;
+            if (extent <= 0.0F) {
+                continue;
+            }
+
+            std::array<Bin, numBins> bins;
+            float scale = float(numBins) / extent;
+            for (std::size_t i = task.begin; i < task.end; i++) {
+                auto bin = std::min<std::size_t>(
+                    static_cast<std::size_t>((Component(centers[order[i]], axis) - minC) * scale),
+                    numBins - 1
+                );
+                bins[bin].box.Add(boxes[order[i]]);
+                bins[bin].count++;
+            }
+
+            // sweep from the right to get the cost of all right sides
+            std::array<float, numBins> rightCost {};
+            Base::BoundBox3f rightBox;
+            std::size_t rightCount = 0;
+            for (std::size_t i = numBins - 1; i > 0; i--) {
+                rightBox.Add(bins[i].box);
+                rightCount += bins[i].count;
+                rightCost[i] = SurfaceArea(rightBox) * float(rightCount);
+            }
+
+            Base::BoundBox3f leftBox;
+            std::size_t leftCount = 0;
+            for (std::size_t i = 0; i < numBins - 1; i++) {
+                leftBox.Add(bins[i].box);
+                leftCount += bins[i].count;
+                float cost = SurfaceArea(leftBox) * float(leftCount) + rightCost[i + 1];
+                if (leftCount > 0 && leftCount < count && cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i;
+                }
+            }
+        }
+
+        float leafCost = SurfaceArea(box) * float(count);
+        bestCost = traversalCost * SurfaceArea(box) + bestCost;
+        if (bestAxis < 0 || (bestCost >= leafCost && count <= maxLeafSize)) {
+            makeLeaf();
+            continue;
+        }
+
+        float minC = MinComponent(centerBox, bestAxis);
+        float scale = float(numBins) / (MaxComponent(centerBox, bestAxis) - minC);
+        auto it = std::partition(
+            order.begin() + std::ptrdiff_t(task.begin),
+            order.begin() + std::ptrdiff_t(task.end),
+            [&](std::uint32_t index) {
+                auto bin = std::min<std::size_t>(
+                    static_cast<std::size_t>((Component(centers[index], bestAxis) - minC) * scale),
+                    numBins - 1
+                );
+                return bin <= bestBin;
+            }
+        );
+        auto mid = static_cast<std::size_t>(it - order.begin());
+
+        std::size_t left = _aclNodes.size();
+        _aclNodes[task.node].first = static_cast<std::uint32_t>(left);
+        _aclNodes.emplace_back();
+        _aclNodes.emplace_back();
+        tasks.push_back({left + 1, mid, task.end});
+        tasks.push_back({left, task.begin, mid});
+    }
+
+    // store the facets in the order of the leaves
+    _aulFacets.assign(order.begin(), order.end());
+    for (int i = 0; i < 3; i++) {
+        _afX[i].resize(ulCtFacets);
+        _afY[i].resize(ulCtFacets);
+        _afZ[i].resize(ulCtFacets);
+        for (std::size_t j = 0; j < ulCtFacets; j++) {
+            const Base::Vector3f& pnt = points[3 * std::size_t(order[j]) + i];
+            _afX[i][j] = pnt.x;
+            _afY[i][j] = pnt.y;
+            _afZ[i][j] = pnt.z;
+        }
+    }
+}
+
+void MeshFacetBVH::GetFacetPoints(
+    std::size_t index,
+    Base::Vector3f& v0,
+    Base::Vector3f& v1,
+    Base::Vector3f& v2
+) const
+{
+    v0.Set(_afX[0][index], _afY[0][index], _afZ[0][index]);
+    v1.Set(_afX[1][index], _afY[1][index], _afZ[1][index]);
+    v2.Set(_afX[2][index], _afY[2][index], _afZ[2][index]);
+}
+
+void MeshFacetBVH::IntersectLeaf(const Node& node, Ray& ray) const
+{
+    // Moeller-Trumbore ray-triangle intersection
+    std::size_t end = std::size_t(node.first) + node.count;
+    for (std::size_t i = node.first; i < end; i++) {
+        float e1x = _afX[1][i] - _afX[0][i];
+        float e1y = _afY[1][i] - _afY[0][i];
+        float e1z = _afZ[1][i] - _afZ[0][i];
+        float e2x = _afX[2][i] - _afX[0][i];
+        float e2y = _afY[2][i] - _afY[0][i];
+        float e2z = _afZ[2][i] - _afZ[0][i];
+
+        float px = ray.dir.y * e2z - ray.dir.z * e2y;
+        float py = ray.dir.z * e2x - ray.dir.x * e2z;
+        float pz = ray.dir.x * e2y - ray.dir.y * e2x;
+        float det = e1x * px + e1y * py + e1z * pz;
+        if (det == 0.0F) {
+            continue;  // ray is parallel to the facet or degenerated facet
+        }
+
+        float invDet = 1.0F / det;
+        float sx = ray.org.x - _afX[0][i];
+        float sy = ray.org.y - _afY[0][i];
+        float sz = ray.org.z - _afZ[0][i];
+        float u = (sx * px + sy * py + sz * pz) * invDet;
+
+        float qx = sy * e1z - sz * e1y;
+        float qy = sz * e1x - sx * e1z;
+        float qz = sx * e1y - sy * e1x;
+        float v = (ray.dir.x * qx + ray.dir.y * qy + ray.dir.z * qz) * invDet;
+        float t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+        if (u >= 0.0F && v >= 0.0F && u + v <= 1.0F && t >= 0.0F && t < ray.tBest) {
+            ray.tBest = t;
+            ray.hit = i;
+        }
+    }
+}
+
+void MeshFacetBVH::IntersectLeaf(const Node& node, RayPacket& packet) const
+{
+    std::size_t end = std::size_t(node.first) + node.count;
+    for (std::size_t i = node.first; i < end; i++) {
+        float v0x = _afX[0][i];
+        float v0y = _afY[0][i];
+        float v0z = _afZ[0][i];
+        float e1x = _afX[1][i] - v0x;
+        float e1y = _afY[1][i] - v0y;
+        float e1z = _afZ[1][i] - v0z;
+        float e2x = _afX[2][i] - v0x;
+        float e2y = _afY[2][i] - v0y;
+        float e2z = _afZ[2][i] - v0z;
+
+        // one facet against all rays of the packet
+        for (std::size_t k = 0; k < RayPacket::size; k++) {
+            float px = packet.dy[k] * e2z - packet.dz[k] * e2y;
+            float py = packet.dz[k] * e2x - packet.dx[k] * e2z;
+            float pz = packet.dx[k] * e2y - packet.dy[k] * e2x;
+            float det = e1x * px + e1y * py + e1z * pz;
+            float invDet = det != 0.0F ? 1.0F / det : 0.0F;
+
+            float sx = packet.ox[k] - v0x;
+            float sy = packet.oy[k] - v0y;
+            float sz = packet.oz[k] - v0z;
+            float u = (sx * px + sy * py + sz * pz) * invDet;
+
+            float qx = sy * e1z - sz * e1y;
+            float qy = sz * e1x - sx * e1z;
+            float qz = sx * e1y - sy * e1x;
+            float v = (packet.dx[k] * qx + packet.dy[k] * qy + packet.dz[k] * qz) * invDet;
+            float t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+            bool hit = det != 0.0F && u >= 0.0F && v >= 0.0F && u + v <= 1.0F && t >= 0.0F
+                && t < packet.tBest[k];
+            packet.tBest[k] = hit ? t : packet.tBest[k];
+            packet.hit[k] = hit ? i : packet.hit[k];
+        }
+    }
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(
+    const Base::Vector3f& rclPt,
+    const Base::Vector3f& rclDir,
+    Base::Vector3f& rclRes,
+    FacetIndex& rulFacet
+) const
+{
+    if (_aclNodes.empty()) {
+        return false;
+    }
+
+    struct Entry
+    {
+        std::uint32_t node;
+        float t;
+    };
+
+    Ray ray(rclPt, rclDir);
+    std::vector<Entry> stack;
+    stack.reserve(64);
+    float t = ray.IntersectBox(_aclNodes.front().box);
+    if (t != std::numeric_limits<float>::max()) {
+        stack.push_back({0, t});
+    }
+
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+        if (entry.t > ray.tBest) {
+            continue;  // a closer facet was found meanwhile
+        }
+
+        const Node& node = _aclNodes[entry.node];
+        if (node.count > 0) {
+            IntersectLeaf(node, ray);
+            continue;
+        }
+
+        // visit the nearer child first
+        float tLeft = ray.IntersectBox(_aclNodes[node.first].box);
+        float tRight = ray.IntersectBox(_aclNodes[node.first + 1].box);
+        Entry left {node.first, tLeft};
+        Entry right {node.first + 1, tRight};
+        if (tLeft > tRight) {
+            std::swap(left, right);
+        }
+        if (right.t != std::numeric_limits<float>::max()) {
+            stack.push_back(right);
+        }
+        if (left.t != std::numeric_limits<float>::max()) {
+            stack.push_back(left);
+        }
+    }
+
+    if (ray.hit == std::numeric_limits<std::size_t>::max()) {
+        return false;
+    }
+
+    rclRes = rclPt + ray.tBest * rclDir;
+    rulFacet = _aulFacets[ray.hit];
+    return true;
+}
+
+void MeshFacetBVH::IntersectPacket(RayPacket& packet) const
+{
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+
+    while (!stack.empty()) {
+        const Node& node = _aclNodes[stack.back()];
+        stack.pop_back();
+        if (!packet.IntersectBox(node.box)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            IntersectLeaf(node, packet);
+        }
+        else {
+            stack.push_back(node.first + 1);
+            stack.push_back(node.first);
+        }
+    }
+}
+
+void MeshFacetBVH::NearestFacetsOnRays(
+    const std::vector<Base::Vector3f>& raclPts,
+    const std::vector<Base::Vector3f>& raclDirs,
+    std::vector<Base::Vector3f>& raclRes,
+    std::vector<FacetIndex>& raulFacets
+) const
+{
+    assert(raclPts.size() == raclDirs.size());
+    std::size_t count = raclPts.size();
+    raclRes.resize(count);
+    raulFacets.assign(count, FACET_INDEX_MAX);
+    if (_aclNodes.empty()) {
+        return;
+    }
+
+    RayPacket packet;
+    for (std::size_t start = 0; start < count; start += RayPacket::size) {
+        std::size_t lanes = std::min(RayPacket::size, count - start);
+        for (std::size_t k = 0; k < RayPacket::size; k++) {
+            if (k < lanes) {
+                packet.Set(k, raclPts[start + k], raclDirs[start + k]);
+            }
+            else {
+                packet.Disable(k);
+            }
+        }
+
+        IntersectPacket(packet);
+
+        for (std::size_t k = 0; k < lanes; k++) {
+            if (packet.hit[k] != std::numeric_limits<std::size_t>::max()) {
+                raclRes[start + k] = raclPts[start + k] + packet.tBest[k] * raclDirs[start + k];
+                raulFacets[start + k] = _aulFacets[packet.hit[k]];
+            }
+        }
+    }
+}
+
+void MeshFacetBVH::NearestFacetsOnRays(
+    const std::vector<Base::Vector3f>& raclPts,
+    const Base::Vector3f& rclDir,
+    std::vector<Base::Vector3f>& raclRes,
+    std::vector<FacetIndex>& raulFacets
+) const
+{
+    std::vector<Base::Vector3f> dirs(raclPts.size(), rclDir);
+    NearestFacetsOnRays(raclPts, dirs, raclRes, raulFacets);
+}
+
+FacetIndex MeshFacetBVH::NearestFacetToPoint(
+    const Base::Vector3f& rclPt,
+    Base::Vector3f& rclRes,
+    float fMaxDist
+) const
+{
+    if (_aclNodes.empty()) {
+        return FACET_INDEX_MAX;
+    }
+
+    struct Entry
+    {
+        std::uint32_t node;
+        float dist2;
+    };
+
+    float fMinDist2 = fMaxDist < std::sqrt(std::numeric_limits<float>::max())
+        ? fMaxDist * fMaxDist
+        : std::numeric_limits<float>::max();
+    std::size_t ulHit = std::numeric_limits<std::size_t>::max();
+
+    std::vector<Entry> stack;
+    stack.reserve(64);
+    stack.push_back({0, DistanceP2(_aclNodes.front().box, rclPt)});
+    while (!stack.empty()) {
+        Entry entry = stack.back();
+        stack.pop_back();
+        if (entry.dist2 >= fMinDist2) {
+            continue;
+        }
+
+        const Node& node = _aclNodes[entry.node];
+        if (node.count > 0) {
+            std::size_t end = std::size_t(node.first) + node.count;
+            for (std::size_t i = node.first; i < end; i++) {
+                Base::Vector3f v0, v1, v2, pnt;
+                GetFacetPoints(i, v0, v1, v2);
+                float fDist = MeshGeomFacet(v0, v1, v2).DistanceToPoint(rclPt, pnt);
+                if (fDist * fDist < fMinDist2) {
+                    fMinDist2 = fDist * fDist;
+                    ulHit = i;
+                    rclRes = pnt;
+                }
+            }
+            continue;
+        }
+
+        // visit the nearer child first
+        Entry left {node.first, DistanceP2(_aclNodes[node.first].box, rclPt)};
+        Entry right {node.first + 1, DistanceP2(_aclNodes[node.first + 1].box, rclPt)};
+        if (left.dist2 > right.dist2) {
+            std::swap(left, right);
+        }
+        if (right.dist2 < fMinDist2) {
+            stack.push_back(right);
+        }
+        if (left.dist2 < fMinDist2) {
+            stack.push_back(left);
+        }
+    }
+
+    if (ulHit == std::numeric_limits<std::size_t>::max()) {
+        return FACET_INDEX_MAX;
+    }
+    return _aulFacets[ulHit];
+}
+
+void MeshFacetBVH::SearchFacets(const Base::BoundBox3f& rclBox, std::vector<FacetIndex>& raulFacets) const
+{
+    SearchFacets(
+        [&rclBox](const Base::BoundBox3f& box) {
+            return box.Intersect(rclBox);
+        },
+        raulFacets
+    );
+}
+
+void MeshFacetBVH::SearchFacets(
+    const std::function<bool(const Base::BoundBox3f&)>& rclPred,
+    std::vector<FacetIndex>& raulFacets
+) const
+{
+    if (_aclNodes.empty()) {
+        return;
+    }
+
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const Node& node = _aclNodes[stack.back()];
+        stack.pop_back();
+        if (!rclPred(node.box)) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            std::size_t end = std::size_t(node.first) + node.count;
+            for (std::size_t i = node.first; i < end; i++) {
+                Base::Vector3f v0, v1, v2;
+                GetFacetPoints(i, v0, v1, v2);
+                Base::BoundBox3f box;
+                box.Add(v0);
+                box.Add(v1);
+                box.Add(v2);
+                if (rclPred(box)) {
+                    raulFacets.push_back(_aulFacets[i]);
+                }
+            }
+        }
+        else {
+            stack.push_back(node.first + 1);
+            stack.push_back(node.first);
+        }
+    }
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Matrix.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH is a bounding volume hierarchy over the facets of a mesh, built with the surface
+ * area heuristic. Unlike the MeshFacetGrid its query cost doesn't depend on how evenly the facets
+ * are distributed, which makes it the better choice for meshes with very dense regions next to
+ * large sparse areas, such as scans.
+ *
+ * The facet geometry is copied into the hierarchy, so it must be rebuilt after the mesh has been
+ * modified. All queries are const and may be called from several threads at once.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /** @name Construction */
+    //@{
+    MeshFacetBVH() = default;
+    /// Builds the hierarchy over the facets of \a rclM
+    explicit MeshFacetBVH(const MeshKernel& rclM);
+    /// Builds the hierarchy over the facets of \a rclM transformed by \a rclMat
+    MeshFacetBVH(const MeshKernel& rclM, const Base::Matrix4D& rclMat);
+    //@}
+
+    /** Rebuilds the hierarchy over the facets of \a rclM. */
+    void Build(const MeshKernel& rclM);
+    /** Rebuilds the hierarchy over the facets of \a rclM transformed by \a rclMat. */
+    void Build(const MeshKernel& rclM, const Base::Matrix4D& rclMat);
+    /** Removes all facets. */
+    void Clear();
+    /** Returns true if the hierarchy doesn't contain any facet. */
+    bool IsEmpty() const
+    {
+        return _aulFacets.empty();
+    }
+    /** Returns the number of facets in the hierarchy. */
+    unsigned long CountFacets() const
+    {
+        return static_cast<unsigned long>(_aulFacets.size());
+    }
+    /** Returns the bounding box of all facets. */
+    Base::BoundBox3f GetBoundBox() const;
+
+    /** @name Search */
+    //@{
+    /**
+     * Searches for the nearest facet hit by the ray starting at \a rclPt in direction \a rclDir.
+     * Only intersections in ray direction are taken into account. Returns false if no facet is
+     * hit, otherwise \a rclRes holds the intersection point and \a rulFacet the facet index.
+     */
+    bool NearestFacetOnRay(
+        const Base::Vector3f& rclPt,
+        const Base::Vector3f& rclDir,
+        Base::Vector3f& rclRes,
+        FacetIndex& rulFacet
+    ) const;
+    /**
+     * Does the same as the method above for many rays at once, the rays are traversed in packets.
+     * For each ray \a raulFacets holds the facet index, or FACET_INDEX_MAX if no facet is hit, and
+     * \a raclRes the intersection point.
+     */
+    void NearestFacetsOnRays(
+        const std::vector<Base::Vector3f>& raclPts,
+        const std::vector<Base::Vector3f>& raclDirs,
+        std::vector<Base::Vector3f>& raclRes,
+        std::vector<FacetIndex>& raulFacets
+    ) const;
+    /** Does the same as NearestFacetsOnRays() for rays with the common direction \a rclDir. */
+    void NearestFacetsOnRays(
+        const std::vector<Base::Vector3f>& raclPts,
+        const Base::Vector3f& rclDir,
+        std::vector<Base::Vector3f>& raclRes,
+        std::vector<FacetIndex>& raulFacets
+    ) const;
+    /**
+     * Searches for the facet with the shortest distance to \a rclPt that is closer than \a
+     * fMaxDist. Returns FACET_INDEX_MAX if there is no such facet, otherwise \a rclRes holds the
+     * nearest point on the facet.
+     */
+    FacetIndex NearestFacetToPoint(
+        const Base::Vector3f& rclPt,
+        Base::Vector3f& rclRes,
+        float fMaxDist = std::numeric_limits<float>::max()
+    ) const;
+    /**
+     * Appends the indices of all facets whose bounding boxes intersect \a rclBox to \a raulFacets.
+     */
+    void SearchFacets(const Base::BoundBox3f& rclBox, std::vector<FacetIndex>& raulFacets) const;
+    /**
+     * Appends the indices of all facets whose bounding boxes fulfill \a rclPred to \a raulFacets.
+     * The predicate is also used to prune whole subtrees, so it must hold for a box whenever it
+     * holds for a box inside of it.
+     */
+    void SearchFacets(
+        const std::function<bool(const Base::BoundBox3f&)>& rclPred,
+        std::vector<FacetIndex>& raulFacets
+    ) const;
+    //@}
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        std::uint32_t first {0}; /**< First facet of a leaf or first of both children. */
+        std::uint32_t count {0}; /**< Number of facets of a leaf or zero. */
+    };
+    struct Ray;
+    struct RayPacket;
+
+    void Build(std::vector<Base::Vector3f>&& points);
+    void IntersectLeaf(const Node& node, Ray& ray) const;
+    void IntersectLeaf(const Node& node, RayPacket& packet) const;
+    void IntersectPacket(RayPacket& packet) const;
+    void GetFacetPoints(std::size_t index, Base::Vector3f& v0, Base::Vector3f& v1, Base::Vector3f& v2) const;
+
+private:
+    std::vector<Node> _aclNodes;
+    std::vector<FacetIndex> _aulFacets; /**< Mesh facet index of each stored facet. */
+    /** Facet corners in structure of arrays layout, in the order of the leaves. */
+    std::vector<float> _afX[3], _afY[3], _afZ[3];  // NOLINT
+};
+
+}  // namespace MeshCore
@@ -0,0 +1,1218 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <tuple>
+
+#include <Base/BoundBox.h>
+#include <Base/Converter.h>
+#include <Base/Tools2D.h>
+#include <Base/Vector3D.h>
+
+#include "BVH.h"
+#include "Boolean.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+using Vec3 = Base::Vector3d;
+using Triangle = std::array<PointIndex, 3>;
+using Edge = std::pair<PointIndex, PointIndex>;
+
+// with less facets per thread the threads don't pay off
+constexpr std::size_t minFacetsPerThread = 10000;
+
+int countThreads(std::size_t count)
+{
+    return int(std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(std::thread::hardware_concurrency(), count / minFacetsPerThread)
+    ));
+}
+
+Edge makeEdge(PointIndex p1, PointIndex p2)
+{
+    return p1 < p2 ? Edge(p1, p2) : Edge(p2, p1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Exact arithmetic with floating-point expansions, see J. R. Shewchuk: Adaptive Precision
+// Floating-Point Arithmetic and Fast Robust Geometric Predicates
+
+using Expansion = std::vector<double>;
+
+void twoSum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    double bv = x - a;
+    double av = x - bv;
+    y = (a - av) + (b - bv);
+}
+
+void twoProduct(double a, double b, double& x, double& y)
+{
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+Expansion twoDiff(double a, double b)
+{
+    double x {}, y {};
+    twoSum(a, -b, x, y);
+    return y != 0.0 ? Expansion {y, x} : Expansion {x};
+}
+
+Expansion growExpansion(const Expansion& e, double b)
+{
+    Expansion h;
+    h.reserve(e.size() + 1);
+    double q = b;
+    for (double t : e) {
+        double x {}, y {};
+        twoSum(q, t, x, y);
+        if (y != 0.0) {
+            h.push_back(y);
+        }
+        q = x;
+    }
+    if (q != 0.0 || h.empty()) {
+        h.push_back(q);
+    }
+    return h;
+}
+
+Expansion sumExpansion(const Expansion& e, const Expansion& f)
+{
+    Expansion h = e;
+    for (double b : f) {
+        h = growExpansion(h, b);
+    }
+    return h;
+}
+
+Expansion scaleExpansion(const Expansion& e, double b)
+{
+    Expansion h;
+    double q {}, y {};
+    twoProduct(e.front(), b, q, y);
+    if (y != 0.0) {
+        h.push_back(y);
+    }
+    for (std::size_t i = 1; i < e.size(); i++) {
+        double p1 {}, p0 {}, s {};
+        twoProduct(e[i], b, p1, p0);
+        twoSum(q, p0, s, y);
+        if (y != 0.0) {
+            h.push_back(y);
+        }
+        twoSum(p1, s, q, y);
+        if (y != 0.0) {
+            h.push_back(y);
+        }
+    }
+    if (q != 0.0 || h.empty()) {
+        h.push_back(q);
+    }
+    return h;
+}
+
+Expansion multiply(const Expansion& e, const Expansion& f)
+{
+    Expansion h {0.0};
+    for (double b : f) {
+        h = sumExpansion(h, scaleExpansion(e, b));
+    }
+    return h;
+}
+
+Expansion negate(Expansion e)
+{
+    for (double& t : e) {
+        t = -t;
+    }
+    return e;
+}
+
+// the terms are ordered by magnitude and don't overlap, so the largest one has the sign
+int sign(const Expansion& e)
+{
+    for (auto it = e.rbegin(); it != e.rend(); ++it) {
+        if (*it != 0.0) {
+            return *it > 0.0 ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+int orient3dExact(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d)
+{
+    Expansion adx = twoDiff(a.x, d.x), ady = twoDiff(a.y, d.y), adz = twoDiff(a.z, d.z);
+    Expansion bdx = twoDiff(b.x, d.x), bdy = twoDiff(b.y, d.y), bdz = twoDiff(b.z, d.z);
+    Expansion cdx = twoDiff(c.x, d.x), cdy = twoDiff(c.y, d.y), cdz = twoDiff(c.z, d.z);
+
+    auto cross = [](const Expansion& a1,
+                    const Expansion& b1,
+                    const Expansion& a2,
+                    const Expansion& b2) {
+        return sumExpansion(multiply(a1, b1), negate(multiply(a2, b2)));
+    };
+
+    Expansion det = multiply(adz, cross(bdx, cdy, cdx, bdy));
+    det = sumExpansion(det, multiply(bdz, cross(cdx, ady, adx, cdy)));
+    det = sumExpansion(det, multiply(cdz, cross(adx, bdy, bdx, ady)));
+    return sign(det);
+}
+
+/**
+ * Returns the sign of the volume of the tetrahedron (a, b, c, d). The result is exact, the
+ * expansions are only computed if the floating-point result is too close to zero.
+ */
+int orient3d(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d)
+{
+    double adx = a.x - d.x, ady = a.y - d.y, adz = a.z - d.z;
+    double bdx = b.x - d.x, bdy = b.y - d.y, bdz = b.z - d.z;
+    double cdx = c.x - d.x, cdy = c.y - d.y, cdz = c.z - d.z;
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    double cdxady = cdx * ady, adxcdy = adx * cdy;
+    double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * std::fabs(adz)
+        + (std::fabs(cdxady) + std::fabs(adxcdy)) * std::fabs(bdz)
+        + (std::fabs(adxbdy) + std::fabs(bdxady)) * std::fabs(cdz);
+
+    constexpr double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+    constexpr double errBound = (7.0 + 56.0 * epsilon) * epsilon;
+    if (det > errBound * permanent) {
+        return 1;
+    }
+    if (-det > errBound * permanent) {
+        return -1;
+    }
+    return orient3dExact(a, b, c, d);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Intersection of facet pairs
+
+/**
+ * The identity of a point of an intersection curve. It's either a vertex of one mesh, the crossing
+ * of an edge of each mesh or the intersection of an edge of one mesh with a facet of the other
+ * mesh. Points with the same identity are computed by several facet pairs and get the same index.
+ */
+struct PointKey
+{
+    enum Kind : std::uint64_t
+    {
+        Vertex1,
+        Vertex2,
+        Edge1Edge2,
+        Edge1Facet2,
+        Edge2Facet1
+    };
+    std::array<std::uint64_t, 5> data {};
+
+    bool operator<(const PointKey& other) const
+    {
+        return data < other.data;
+    }
+    bool operator==(const PointKey& other) const
+    {
+        return data == other.data;
+    }
+};
+
+struct CurvePoint
+{
+    PointKey key;
+    Vec3 pos;
+};
+
+struct Segment
+{
+    FacetIndex facets[2];
+    CurvePoint points[2];
+};
+
+struct Input
+{
+    std::vector<Vec3> points[2];
+    const MeshFacetArray* facets[2];
+
+    std::array<Vec3, 3> GetTriangle(int mesh, FacetIndex index) const
+    {
+        const MeshFacet& face = (*facets[mesh])[index];
+        const std::vector<Vec3>& pts = points[mesh];
+        return {pts[face._aulPoints[0]], pts[face._aulPoints[1]], pts[face._aulPoints[2]]};
+    }
+};
+
+bool isSeparated(const int (&sides)[3])
+{
+    return (sides[0] > 0 && sides[1] > 0 && sides[2] > 0)
+        || (sides[0] < 0 && sides[1] < 0 && sides[2] < 0);
+}
+
+bool isCoplanar(const int (&sides)[3])
+{
+    return sides[0] == 0 && sides[1] == 0 && sides[2] == 0;
+}
+
+bool sameSide(const int (&sides)[3])
+{
+    return (sides[0] >= 0 && sides[1] >= 0 && sides[2] >= 0)
+        || (sides[0] <= 0 && sides[1] <= 0 && sides[2] <= 0);
+}
+
+// returns the edge with the lower point index first
+std::pair<int, int> orderEdge(const MeshFacet& facet, int i, int j)
+{
+    return facet._aulPoints[i] < facet._aulPoints[j] ? std::make_pair(i, j) : std::make_pair(j, i);
+}
+
+// the point of the line (p1, p2) that is closest to the line (q1, q2)
+Vec3 crossLines(const Vec3& p1, const Vec3& p2, const Vec3& q1, const Vec3& q2)
+{
+    Vec3 u = p2 - p1;
+    Vec3 v = q2 - q1;
+    Vec3 n = u % v;
+    double len = n.Sqr();
+    double t = len > 0.0 ? std::clamp(((q1 - p1) % v) * n / len, 0.0, 1.0) : 0.0;
+    return p1 + u * t;
+}
+
+/**
+ * Collects the points where the triangle \a tria of \a mesh touches the triangle \a trib of the
+ * other mesh. \a sides are the sides of the corners of \a tria with respect to the plane of
+ * \a trib.
+ */
+void collectPoints(
+    int mesh,
+    const MeshFacet& facet,
+    const std::array<Vec3, 3>& tria,
+    const int (&sides)[3],
+    FacetIndex other,
+    const MeshFacet& otherFacet,
+    const std::array<Vec3, 3>& trib,
+    std::vector<CurvePoint>& points
+)
+{
+    for (int i = 0; i < 3; i++) {
+        if (sides[i] == 0) {
+            // the corner lies in the plane, test it against the planes through the edges of the
+            // other triangle and a corner off the plane
+            const Vec3& apex = tria[sides[(i + 1) % 3] != 0 ? (i + 1) % 3 : (i + 2) % 3];
+            bool inside = true;
+            for (int j = 0; j < 3 && inside; j++) {
+                const Vec3& p1 = trib[j];
+                const Vec3& p2 = trib[(j + 1) % 3];
+                int s1 = orient3d(p1, p2, apex, tria[i]);
+                int s2 = orient3d(p1, p2, apex, trib[(j + 2) % 3]);
+                inside = s1 == 0 || s1 == s2;
+            }
+            if (inside) {
+                PointKey key;
+                key.data = {PointKey::Vertex1 + mesh, facet._aulPoints[i], 0, 0, 0};
+                points.push_back({key, tria[i]});
+            }
+        }
+    }
+
+    for (int i = 0; i < 3; i++) {
+        if (sides[i] * sides[(i + 1) % 3] >= 0) {
+            continue;
+        }
+
+        // the sides of the edges of the other triangle, edge k goes from corner k to corner k + 1
+        int edgeSides[3];
+        int zeros = 0;
+        for (int k = 0; k < 3; k++) {
+            edgeSides[k] = orient3d(tria[i], tria[(i + 1) % 3], trib[k], trib[(k + 1) % 3]);
+            zeros += edgeSides[k] == 0 ? 1 : 0;
+        }
+        if (!sameSide(edgeSides) || zeros == 3) {
+            continue;
+        }
+
+        auto [e1, e2] = orderEdge(facet, i, (i + 1) % 3);
+        PointKey key;
+        Vec3 pos;
+        if (zeros == 2) {
+            // the edge goes through a corner of the other triangle
+            int k = edgeSides[0] != 0 ? 2 : (edgeSides[1] != 0 ? 0 : 1);
+            key.data = {PointKey::Vertex2 - mesh, otherFacet._aulPoints[k], 0, 0, 0};
+            pos = trib[k];
+        }
+        else if (zeros == 1) {
+            // the edge crosses an edge of the other triangle
+            int k = edgeSides[0] == 0 ? 0 : (edgeSides[1] == 0 ? 1 : 2);
+            auto [o1, o2] = orderEdge(otherFacet, k, (k + 1) % 3);
+            if (mesh == 0) {
+                key.data = {
+                    PointKey::Edge1Edge2,
+                    facet._aulPoints[e1],
+                    facet._aulPoints[e2],
+                    otherFacet._aulPoints[o1],
+                    otherFacet._aulPoints[o2]
+                };
+                pos = crossLines(tria[e1], tria[e2], trib[o1], trib[o2]);
+            }
+            else {
+                key.data = {
+                    PointKey::Edge1Edge2,
+                    otherFacet._aulPoints[o1],
+                    otherFacet._aulPoints[o2],
+                    facet._aulPoints[e1],
+                    facet._aulPoints[e2]
+                };
+                pos = crossLines(trib[o1], trib[o2], tria[e1], tria[e2]);
+            }
+        }
+        else {
+            // compute the point the same way for all facets at this edge
+            const Vec3& v1 = tria[e1];
+            const Vec3& v2 = tria[e2];
+            Vec3 normal = (trib[1] - trib[0]) % (trib[2] - trib[0]);
+            double d1 = normal * (v1 - trib[0]);
+            double d2 = normal * (v2 - trib[0]);
+            double t = std::clamp(d1 / (d1 - d2), 0.0, 1.0);
+            key.data = {
+                PointKey::Edge1Facet2 + mesh,
+                facet._aulPoints[e1],
+                facet._aulPoints[e2],
+                other,
+                0
+            };
+            pos = v1 + (v2 - v1) * t;
+        }
+        points.push_back({key, pos});
+    }
+}
+
+bool intersectFacets(const Input& input, FacetIndex facet1, FacetIndex facet2, Segment& segment)
+{
+    std::array<Vec3, 3> tri1 = input.GetTriangle(0, facet1);
+    std::array<Vec3, 3> tri2 = input.GetTriangle(1, facet2);
+
+    int sides1[3], sides2[3];
+    for (int i = 0; i < 3; i++) {
+        sides1[i] = orient3d(tri2[0], tri2[1], tri2[2], tri1[i]);
+    }
+    if (isSeparated(sides1) || isCoplanar(sides1)) {
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        sides2[i] = orient3d(tri1[0], tri1[1], tri1[2], tri2[i]);
+    }
+    if (isSeparated(sides2)) {
+        return false;
+    }
+
+    std::vector<CurvePoint> points;
+    const MeshFacet& face1 = (*input.facets[0])[facet1];
+    const MeshFacet& face2 = (*input.facets[1])[facet2];
+    collectPoints(0, face1, tri1, sides1, facet2, face2, tri2, points);
+    collectPoints(1, face2, tri2, sides2, facet1, face1, tri1, points);
+
+    // the same point can be found from both sides, vertices and crossing edges take precedence
+    std::sort(points.begin(), points.end(), [](const CurvePoint& p1, const CurvePoint& p2) {
+        return p1.key < p2.key;
+    });
+    double scale = 0.0;
+    for (int i = 0; i < 3; i++) {
+        scale = std::max(scale, Base::Distance(tri1[i], tri1[(i + 1) % 3]));
+    }
+    double tolerance = 1e-12 * scale;
+    std::vector<CurvePoint> unique;
+    for (const auto& pnt : points) {
+        auto it = std::find_if(unique.begin(), unique.end(), [&](const CurvePoint& other) {
+            return pnt.key == other.key || Base::Distance(pnt.pos, other.pos) <= tolerance;
+        });
+        if (it == unique.end()) {
+            unique.push_back(pnt);
+        }
+    }
+
+    if (unique.size() < 2) {
+        return false;
+    }
+
+    // take the farthest points if there are too many in degenerate cases
+    std::size_t first = 0, second = 1;
+    double maxDist = -1.0;
+    for (std::size_t i = 0; i < unique.size(); i++) {
+        for (std::size_t j = i + 1; j < unique.size(); j++) {
+            double dist = Base::DistanceP2(unique[i].pos, unique[j].pos);
+            if (dist > maxDist) {
+                maxDist = dist;
+                first = i;
+                second = j;
+            }
+        }
+    }
+
+    segment.facets[0] = facet1;
+    segment.facets[1] = facet2;
+    segment.points[0] = unique[first];
+    segment.points[1] = unique[second];
+    return true;
+}
+
+/**
+ * Points of the intersection curves with different identities can be closer than the precision of
+ * their coordinates. Such points are welded with each other and with the vertices of the meshes,
+ * the returned vector maps each point to the kept one.
+ */
+std::vector<PointIndex> weldPoints(const std::vector<Vec3>& points, std::size_t numMeshPoints)
+{
+    std::vector<PointIndex> parent(points.size());
+    std::iota(parent.begin(), parent.end(), PointIndex(0));
+    if (numMeshPoints == points.size()) {
+        return parent;
+    }
+
+    Base::BoundBox3d box;
+    for (const auto& pnt : points) {
+        box.Add(pnt);
+    }
+    double tolerance = 1e-10 * box.CalcDiagonalLength();
+
+    auto find = [&parent](PointIndex i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::vector<PointIndex> order(points.size());
+    std::iota(order.begin(), order.end(), PointIndex(0));
+    std::sort(order.begin(), order.end(), [&points](PointIndex p1, PointIndex p2) {
+        return points[p1].x < points[p2].x;
+    });
+
+    for (std::size_t i = 0; i < order.size(); i++) {
+        for (std::size_t j = i + 1; j < order.size(); j++) {
+            PointIndex p1 = order[i];
+            PointIndex p2 = order[j];
+            if (points[p2].x - points[p1].x > tolerance) {
+                break;
+            }
+            if (Base::Distance(points[p1], points[p2]) > tolerance) {
+                continue;
+            }
+            // the vertices of the meshes are never welded with each other
+            PointIndex r1 = find(p1);
+            PointIndex r2 = find(p2);
+            if (r1 == r2 || (r1 < numMeshPoints && r2 < numMeshPoints)) {
+                continue;
+            }
+            parent[std::max(r1, r2)] = std::min(r1, r2);
+        }
+    }
+
+    for (PointIndex i = 0; i < parent.size(); i++) {
+        parent[i] = find(i);
+    }
+    return parent;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Triangulation of a cut facet
+
+/**
+ * Triangulates a facet with additional points and segments in the plane of the facet. The points
+ * are inserted one after another, the segments are then recovered by edge flips.
+ */
+class FacetTriangulator
+{
+public:
+    FacetTriangulator(const std::vector<Vec3>& points, const Triangle& corners)
+        : points(points)
+    {
+        Vec3 normal = (points[corners[1]] - points[corners[0]])
+            % (points[corners[2]] - points[corners[0]]);
+        double nx = std::fabs(normal.x), ny = std::fabs(normal.y), nz = std::fabs(normal.z);
+        axis = nx >= ny && nx >= nz ? 0 : (ny >= nz ? 1 : 2);
+        double dir = axis == 0 ? normal.x : (axis == 1 ? normal.y : normal.z);
+        valid = dir != 0.0;
+        flipped = dir < 0.0;
+
+        for (PointIndex pnt : corners) {
+            ids.push_back(pnt);
+            uv.push_back(Project(points[pnt]));
+        }
+        // the triangles are counterclockwise in the projection
+        triangles.push_back(flipped ? std::array<int, 3> {0, 2, 1} : std::array<int, 3> {0, 1, 2});
+
+        double scale = 0.0;
+        for (int i = 0; i < 3; i++) {
+            scale = std::max(scale, uv[i].Distance(uv[(i + 1) % 3]));
+        }
+        tolerance = 1e-10 * scale;
+    }
+
+    bool IsValid() const
+    {
+        return valid;
+    }
+
+    void AddPoint(PointIndex id)
+    {
+        Insert(id);
+    }
+
+    /** Makes the segment an edge and appends its parts to \a edges. */
+    void AddSegment(PointIndex id1, PointIndex id2, std::vector<Edge>& edges)
+    {
+        int v1 = Insert(id1);
+        int v2 = Insert(id2);
+        Recover(v1, v2, edges);
+    }
+
+    void GetTriangles(std::vector<Triangle>& result) const
+    {
+        for (const auto& tria : triangles) {
+            if (flipped) {
+                result.push_back({ids[tria[0]], ids[tria[2]], ids[tria[1]]});
+            }
+            else {
+                result.push_back({ids[tria[0]], ids[tria[1]], ids[tria[2]]});
+            }
+        }
+    }
+
+private:
+    Base::Vector2d Project(const Vec3& pnt) const
+    {
+        switch (axis) {
+            case 0:
+                return {pnt.y, pnt.z};
+            case 1:
+                return {pnt.z, pnt.x};
+            default:
+                return {pnt.x, pnt.y};
+        }
+    }
+
+    double Orient(int a, int b, const Base::Vector2d& pnt) const
+    {
+        Base::Vector2d ab = uv[b] - uv[a];
+        Base::Vector2d ap = pnt - uv[a];
+        return ab.x * ap.y - ab.y * ap.x;
+    }
+
+    // returns the distance of the point to the line through a and b with the sign of Orient()
+    double Side(int a, int b, const Base::Vector2d& pnt) const
+    {
+        double len = uv[a].Distance(uv[b]);
+        return len > 0.0 ? Orient(a, b, pnt) / len : 0.0;
+    }
+
+    int Insert(PointIndex id)
+    {
+        auto known = std::find(ids.begin(), ids.end(), id);
+        if (known != ids.end()) {
+            return int(known - ids.begin());
+        }
+
+        Base::Vector2d pnt = Project(points[id]);
+        for (std::size_t i = 0; i < uv.size(); i++) {
+            if (uv[i].Distance(pnt) <= tolerance) {
+                return int(i);
+            }
+        }
+
+        // search for the triangle that contains the point best
+        std::size_t best = 0;
+        std::array<double, 3> bestSides {};
+        double bestMin = -std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < triangles.size(); i++) {
+            const auto& tria = triangles[i];
+            std::array<double, 3> sides {};
+            for (int j = 0; j < 3; j++) {
+                sides[j] = Side(tria[(j + 1) % 3], tria[(j + 2) % 3], pnt);
+            }
+            double minSide = *std::min_element(sides.begin(), sides.end());
+            if (minSide > bestMin) {
+                bestMin = minSide;
+                best = i;
+                bestSides = sides;
+            }
+        }
+
+        std::array<bool, 3> onEdge {};
+        int numOnEdge = 0;
+        for (int j = 0; j < 3; j++) {
+            onEdge[j] = bestSides[j] <= tolerance;
+            numOnEdge += onEdge[j] ? 1 : 0;
+        }
+
+        std::array<int, 3> tria = triangles[best];
+        if (numOnEdge >= 2) {
+            // the point is at a corner of the triangle
+            for (int j = 0; j < 3; j++) {
+                if (!onEdge[j]) {
+                    return tria[j];
+                }
+            }
+            return tria[0];
+        }
+
+        int index = int(uv.size());
+        ids.push_back(id);
+        uv.push_back(pnt);
+
+        if (numOnEdge == 0) {
+            triangles[best] = {tria[0], tria[1], index};
+            triangles.push_back({tria[1], tria[2], index});
+            triangles.push_back({tria[2], tria[0], index});
+        }
+        else {
+            int j = onEdge[0] ? 0 : (onEdge[1] ? 1 : 2);
+            int a = tria[(j + 1) % 3];
+            int b = tria[(j + 2) % 3];
+            SplitEdge(best, a, b, index);
+            // the triangle on the other side, if the edge isn't at the border of the facet
+            for (std::size_t i = 0; i < triangles.size(); i++) {
+                if (HasEdge(triangles[i], b, a)) {
+                    SplitEdge(i, b, a, index);
+                    break;
+                }
+            }
+        }
+
+        return index;
+    }
+
+    static bool HasEdge(const std::array<int, 3>& tria, int a, int b)
+    {
+        for (int j = 0; j < 3; j++) {
+            if (tria[j] == a && tria[(j + 1) % 3] == b) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // splits the triangle with the directed edge (a, b) at the point p on this edge
+    void SplitEdge(std::size_t index, int a, int b, int p)
+    {
+        std::array<int, 3> tria = triangles[index];
+        while (tria[0] != a) {
+            std::rotate(tria.begin(), tria.begin() + 1, tria.end());
+        }
+        int c = tria[2];
+        triangles[index] = {a, p, c};
+        triangles.push_back({p, b, c});
+    }
+
+    bool EdgeExists(int a, int b) const
+    {
+        return std::any_of(triangles.begin(), triangles.end(), [a, b](const auto& tria) {
+            return HasEdge(tria, a, b) || HasEdge(tria, b, a);
+        });
+    }
+
+    // flips the edge (a, b) if the two adjacent triangles form a convex quadrilateral
+    bool Flip(int a, int b)
+    {
+        std::size_t t1 = triangles.size(), t2 = triangles.size();
+        for (std::size_t i = 0; i < triangles.size(); i++) {
+            if (HasEdge(triangles[i], a, b)) {
+                t1 = i;
+            }
+            else if (HasEdge(triangles[i], b, a)) {
+                t2 = i;
+            }
+        }
+        if (t1 == triangles.size() || t2 == triangles.size()) {
+            return false;
+        }
+
+        auto opposite = [this](std::size_t index, int a, int b) {
+            for (int v : triangles[index]) {
+                if (v != a && v != b) {
+                    return v;
+                }
+            }
+            return a;
+        };
+        int c = opposite(t1, a, b);
+        int d = opposite(t2, a, b);
+        if (Side(c, d, uv[a]) * Side(c, d, uv[b]) >= 0.0) {
+            return false;
+        }
+        if (std::fabs(Side(c, d, uv[a])) <= tolerance
+            || std::fabs(Side(c, d, uv[b])) <= tolerance) {
+            return false;
+        }
+
+        triangles[t1] = {a, d, c};
+        triangles[t2] = {d, b, c};
+        return true;
+    }
+
+    void Recover(int v1, int v2, std::vector<Edge>& edges)
+    {
+        if (v1 == v2) {
+            return;
+        }
+
+        // a point on the segment splits it
+        Base::Vector2d dir = uv[v2] - uv[v1];
+        double len2 = dir.Sqr();
+        int split = -1;
+        double splitParam = 1.0;
+        for (int i = 0; i < int(uv.size()); i++) {
+            if (i == v1 || i == v2) {
+                continue;
+            }
+            double param = (uv[i] - uv[v1]) * dir / len2;
+            if (param > 0.0 && param < splitParam && std::fabs(Side(v1, v2, uv[i])) <= tolerance) {
+                split = i;
+                splitParam = param;
+            }
+        }
+        if (split >= 0) {
+            Recover(v1, split, edges);
+            Recover(split, v2, edges);
+            return;
+        }
+
+        // flip the edges that cross the segment until the segment is an edge
+        std::size_t maxFlips = 4 * triangles.size() * triangles.size() + 16;
+        for (std::size_t iter = 0; iter < maxFlips && !EdgeExists(v1, v2); iter++) {
+            bool flipped = false;
+            for (std::size_t i = 0; i < triangles.size() && !flipped; i++) {
+                for (int j = 0; j < 3 && !flipped; j++) {
+                    int a = triangles[i][j];
+                    int b = triangles[i][(j + 1) % 3];
+                    if (a == v1 || a == v2 || b == v1 || b == v2) {
+                        continue;
+                    }
+                    if (Side(v1, v2, uv[a]) * Side(v1, v2, uv[b]) >= 0.0
+                        || Side(a, b, uv[v1]) * Side(a, b, uv[v2]) >= 0.0) {
+                        continue;
+                    }
+                    flipped = Flip(a, b);
+                }
+            }
+            if (!flipped) {
+                break;
+            }
+        }
+
+        edges.emplace_back(makeEdge(ids[v1], ids[v2]));
+    }
+
+private:
+    const std::vector<Vec3>& points;
+    std::vector<PointIndex> ids;
+    std::vector<Base::Vector2d> uv;
+    std::vector<std::array<int, 3>> triangles;
+    double tolerance {0.0};
+    int axis {2};
+    bool valid {true};
+    bool flipped {false};
+};
+
+// ------------------------------------------------------------------------------------------------
+// Classification
+
+/** Returns the generalized winding number of the closed mesh with respect to \a pnt. */
+double windingNumber(const Input& input, int mesh, const Vec3& pnt)
+{
+    const MeshFacetArray& facets = *input.facets[mesh];
+    std::mutex mutex;
+    double total = 0.0;
+    parallel_for(
+        facets.size(),
+        [&](std::size_t begin, std::size_t end) {
+            double sum = 0.0;
+            for (std::size_t i = begin; i < end; i++) {
+                std::array<Vec3, 3> tria = input.GetTriangle(mesh, FacetIndex(i));
+                // solid angle by A. Van Oosterom and J. Strackee
+                Vec3 a = tria[0] - pnt, b = tria[1] - pnt, c = tria[2] - pnt;
+                double la = a.Length(), lb = b.Length(), lc = c.Length();
+                double det = a * (b % c);
+                double div = la * lb * lc + (a * b) * lc + (b * c) * la + (c * a) * lb;
+                sum += 2.0 * std::atan2(det, div);
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            total += sum;
+        },
+        countThreads(facets.size())
+    );
+    return total / (4.0 * M_PI);
+}
+
+/**
+ * Decides for each triangle of \a mesh whether it lies inside the other mesh. The triangles are
+ * grouped into regions that don't cross an intersection curve, only one triangle of each region is
+ * tested.
+ */
+std::vector<char> classify(
+    const Input& input,
+    int mesh,
+    const std::vector<Vec3>& points,
+    const std::vector<Triangle>& triangles,
+    const std::vector<Edge>& curveEdges
+)
+{
+    int threads = countThreads(triangles.size());
+
+    struct TriangleEdge
+    {
+        Edge edge;
+        std::size_t triangle;
+    };
+    std::vector<TriangleEdge> edges(3 * triangles.size());
+    parallel_for(
+        triangles.size(),
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                for (int j = 0; j < 3; j++) {
+                    edges[3 * i + j] = {makeEdge(triangles[i][j], triangles[i][(j + 1) % 3]), i};
+                }
+            }
+        },
+        threads
+    );
+    parallel_sort(
+        edges.begin(),
+        edges.end(),
+        [](const TriangleEdge& e1, const TriangleEdge& e2) { return e1.edge < e2.edge; },
+        threads
+    );
+
+    std::vector<std::size_t> parent(triangles.size());
+    std::iota(parent.begin(), parent.end(), std::size_t(0));
+    auto find = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    for (std::size_t i = 0; i < edges.size();) {
+        std::size_t j = i + 1;
+        while (j < edges.size() && edges[j].edge == edges[i].edge) {
+            j++;
+        }
+        if (!std::binary_search(curveEdges.begin(), curveEdges.end(), edges[i].edge)) {
+            for (std::size_t k = i + 1; k < j; k++) {
+                parent[find(edges[k].triangle)] = find(edges[i].triangle);
+            }
+        }
+        i = j;
+    }
+    std::vector<TriangleEdge>().swap(edges);
+
+    // the biggest triangle of a region is tested
+    std::map<std::size_t, std::pair<double, std::size_t>> regions;
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        const Triangle& tria = triangles[i];
+        double area = ((points[tria[1]] - points[tria[0]]) % (points[tria[2]] - points[tria[0]]))
+                          .Sqr();
+        auto& region = regions.emplace(find(i), std::make_pair(-1.0, i)).first->second;
+        if (area > region.first) {
+            region = {area, i};
+        }
+    }
+
+    std::map<std::size_t, char> inside;
+    for (const auto& [root, region] : regions) {
+        const Triangle& tria = triangles[region.second];
+        Vec3 center = (points[tria[0]] + points[tria[1]] + points[tria[2]]) / 3.0;
+        inside[root] = windingNumber(input, 1 - mesh, center) > 0.5 ? 1 : 0;
+    }
+
+    std::vector<char> result(triangles.size());
+    for (std::size_t i = 0; i < triangles.size(); i++) {
+        result[i] = inside[find(i)];
+    }
+    return result;
+}
+}  // namespace
+
+MeshBoolean::MeshBoolean(
+    const MeshKernel& mesh1,
+    const MeshKernel& mesh2,
+    MeshKernel& result,
+    SetOperations::OperationType opType
+)
+    : _mesh1(mesh1)
+    , _mesh2(mesh2)
+    , _result(result)
+    , _operationType(opType)
+{}
+
+void MeshBoolean::Do()
+{
+    const MeshKernel* meshes[2] = {&_mesh1, &_mesh2};
+    Input input;
+    for (int m = 0; m < 2; m++) {
+        const MeshPointArray& pts = meshes[m]->GetPoints();
+        input.points[m].resize(pts.size());
+        parallel_for(
+            pts.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    const Base::Vector3f& pnt = pts[i];
+                    input.points[m][i] = Base::convertTo<Vec3>(pnt);
+                }
+            },
+            countThreads(pts.size())
+        );
+        input.facets[m] = &meshes[m]->GetFacets();
+    }
+
+    // broad phase with the hierarchy of the second mesh, narrow phase with exact predicates
+    std::vector<Segment> segments;
+    {
+        MeshFacetBVH bvh(_mesh2);
+        const MeshFacetArray& facets = *input.facets[0];
+        std::mutex mutex;
+        parallel_for(
+            facets.size(),
+            [&](std::size_t begin, std::size_t end) {
+                std::vector<Segment> found;
+                std::vector<FacetIndex> candidates;
+                const MeshPointArray& pts = _mesh1.GetPoints();
+                for (std::size_t i = begin; i < end; i++) {
+                    const MeshFacet& face = facets[i];
+                    Base::BoundBox3f box;
+                    for (PointIndex pnt : face._aulPoints) {
+                        box.Add(pts[pnt]);
+                    }
+                    candidates.clear();
+                    bvh.SearchFacets(box, candidates);
+                    Segment segment;
+                    for (FacetIndex other : candidates) {
+                        if (intersectFacets(input, FacetIndex(i), other, segment)) {
+                            found.push_back(segment);
+                        }
+                    }
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                segments.insert(segments.end(), found.begin(), found.end());
+            },
+            countThreads(facets.size())
+        );
+    }
+
+    // the threads deliver the segments in any order
+    std::sort(segments.begin(), segments.end(), [](const Segment& s1, const Segment& s2) {
+        return std::tie(s1.facets[0], s1.facets[1]) < std::tie(s2.facets[0], s2.facets[1]);
+    });
+
+    // number the points of the curves after the points of both meshes
+    std::size_t numPoints1 = input.points[0].size();
+    std::size_t numPoints2 = input.points[1].size();
+    std::vector<Vec3> points;
+    points.reserve(numPoints1 + numPoints2);
+    points.insert(points.end(), input.points[0].begin(), input.points[0].end());
+    points.insert(points.end(), input.points[1].begin(), input.points[1].end());
+
+    std::map<PointKey, PointIndex> curvePoints;
+    auto pointIndex = [&](const CurvePoint& pnt) {
+        switch (pnt.key.data[0]) {
+            case PointKey::Vertex1:
+                return PointIndex(pnt.key.data[1]);
+            case PointKey::Vertex2:
+                return PointIndex(numPoints1 + pnt.key.data[1]);
+            default: {
+                auto it = curvePoints.emplace(pnt.key, PointIndex(points.size()));
+                if (it.second) {
+                    points.push_back(pnt.pos);
+                }
+                return it.first->second;
+            }
+        }
+    };
+
+    std::vector<Edge> edges;
+    edges.reserve(segments.size());
+    for (const auto& segment : segments) {
+        edges.emplace_back(pointIndex(segment.points[0]), pointIndex(segment.points[1]));
+    }
+    std::vector<PointIndex> welded = weldPoints(points, numPoints1 + numPoints2);
+
+    // the segments of each facet
+    std::vector<std::pair<FacetIndex, Edge>> facetSegments[2];
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        Edge edge(welded[edges[i].first], welded[edges[i].second]);
+        if (edge.first != edge.second) {
+            facetSegments[0].emplace_back(segments[i].facets[0], edge);
+            facetSegments[1].emplace_back(segments[i].facets[1], edge);
+        }
+    }
+    std::vector<Edge>().swap(edges);
+    std::vector<Segment>().swap(segments);
+    curvePoints.clear();
+
+    std::vector<Triangle> triangles[2];
+    std::vector<Edge> curveEdges;
+    for (int m = 0; m < 2; m++) {
+        const MeshFacetArray& facets = *input.facets[m];
+        PointIndex offset = m == 0 ? 0 : PointIndex(numPoints1);
+        auto& cuts = facetSegments[m];
+        std::sort(cuts.begin(), cuts.end());
+
+        auto corners = [&facets, offset](FacetIndex index) {
+            const MeshFacet& face = facets[index];
+            return Triangle {
+                face._aulPoints[0] + offset,
+                face._aulPoints[1] + offset,
+                face._aulPoints[2] + offset
+            };
+        };
+
+        // the uncut facets are kept
+        std::size_t next = 0;
+        for (std::size_t i = 0; i < facets.size(); i++) {
+            if (next < cuts.size() && cuts[next].first == i) {
+                while (next < cuts.size() && cuts[next].first == i) {
+                    next++;
+                }
+                continue;
+            }
+            triangles[m].push_back(corners(FacetIndex(i)));
+        }
+
+        // the ranges of segments of the cut facets
+        std::vector<std::size_t> starts;
+        for (std::size_t i = 0; i < cuts.size(); i++) {
+            if (i == 0 || cuts[i].first != cuts[i - 1].first) {
+                starts.push_back(i);
+            }
+        }
+        starts.push_back(cuts.size());
+
+        std::mutex mutex;
+        parallel_for(
+            starts.size() - 1,
+            [&](std::size_t begin, std::size_t end) {
+                std::vector<Triangle> cutTriangles;
+                std::vector<Edge> edges;
+                for (std::size_t i = begin; i < end; i++) {
+                    FacetIndex index = cuts[starts[i]].first;
+                    FacetTriangulator triangulator(points, corners(index));
+                    if (!triangulator.IsValid()) {
+                        cutTriangles.push_back(corners(index));
+                        continue;
+                    }
+                    for (std::size_t j = starts[i]; j < starts[i + 1]; j++) {
+                        triangulator.AddPoint(cuts[j].second.first);
+                        triangulator.AddPoint(cuts[j].second.second);
+                    }
+                    for (std::size_t j = starts[i]; j < starts[i + 1]; j++) {
+                        triangulator.AddSegment(cuts[j].second.first, cuts[j].second.second, edges);
+                    }
+                    triangulator.GetTriangles(cutTriangles);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                triangles[m].insert(triangles[m].end(), cutTriangles.begin(), cutTriangles.end());
+                curveEdges.insert(curveEdges.end(), edges.begin(), edges.end());
+            },
+            countThreads(10 * starts.size())
+        );
+        std::vector<std::pair<FacetIndex, Edge>>().swap(cuts);
+    }
+
+    std::sort(curveEdges.begin(), curveEdges.end());
+    curveEdges.erase(std::unique(curveEdges.begin(), curveEdges.end()), curveEdges.end());
+
+    std::vector<char> inside[2];
+    for (int m = 0; m < 2; m++) {
+        inside[m] = classify(input, m, points, triangles[m], curveEdges);
+    }
+
+    // which parts are kept: -1 none, 0 outside the other mesh, 1 inside the other mesh
+    int keep[2] = {-1, -1};
+    bool flip2 = false;
+    switch (_operationType) {
+        case SetOperations::Union:
+            keep[0] = 0;
+            keep[1] = 0;
+            break;
+        case SetOperations::Intersect:
+            keep[0] = 1;
+            keep[1] = 1;
+            break;
+        case SetOperations::Difference:
+            keep[0] = 0;
+            keep[1] = 1;
+            flip2 = true;
+            break;
+        case SetOperations::Inner:
+            keep[0] = 1;
+            break;
+        case SetOperations::Outer:
+            keep[0] = 0;
+            break;
+    }
+
+    std::vector<PointIndex> index(points.size(), POINT_INDEX_MAX);
+    MeshPointArray resultPoints;
+    MeshFacetArray resultFacets;
+    for (int m = 0; m < 2; m++) {
+        if (keep[m] < 0) {
+            continue;
+        }
+        for (std::size_t i = 0; i < triangles[m].size(); i++) {
+            if (inside[m][i] != keep[m]) {
+                continue;
+            }
+            Triangle tria = triangles[m][i];
+            if (m == 1 && flip2) {
+                std::swap(tria[1], tria[2]);
+            }
+            for (PointIndex& pnt : tria) {
+                if (index[pnt] == POINT_INDEX_MAX) {
+                    index[pnt] = PointIndex(resultPoints.size());
+                    resultPoints.push_back(Base::convertTo<Base::Vector3f>(points[pnt]));
+                }
+                pnt = index[pnt];
+            }
+            resultFacets.emplace_back(tria[0], tria[1], tria[2]);
+        }
+    }
+
+    _result.Adopt(resultPoints, resultFacets, true);
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include "SetOperations.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshBoolean class is an alternative to SetOperations for closed meshes.
+ *
+ * The intersecting facet pairs are searched with a MeshFacetBVH and intersected in parallel. All
+ * decisions about the intersection topology use exact orientation predicates. Each cut facet is
+ * triangulated again with the intersection segments as edges, so the parts of both meshes share
+ * the points and edges of the intersection curves. The parts between the curves are finally
+ * classified by the generalized winding number with respect to the other mesh.
+ *
+ * Overlapping coplanar facets are not cut with each other.
+ */
+class MeshExport MeshBoolean
+{
+public:
+    MeshBoolean(
+        const MeshKernel& mesh1,
+        const MeshKernel& mesh2,
+        MeshKernel& result,
+        SetOperations::OperationType opType
+    );
+
+    /** Computes the result mesh. */
+    void Do();
+
+private:
+    const MeshKernel& _mesh1;
+    const MeshKernel& _mesh2;
+    MeshKernel& _result;
+    SetOperations::OperationType _operationType;
+};
+
+}  // namespace MeshCore
@@ -24,6 +24,7 @@
 
 
 #include <algorithm>
+#include <numeric>
 
 
 #include <Base/Exception.h>
@@ -355,6 +356,36 @@ void MeshFastBuilder::AddFacet(const MeshGeomFacet& facetPoints)
     }
 }
 
+void MeshFastBuilder::AddFacets(
+    size_type ctFacets,
+    const std::function<void(size_type, Base::Vector3f*)>& getFacet
+)
+{
+    size_type offset = p->verts.size();
+    p->verts.resize(offset + 3 * ctFacets);
+    Private::Vertex* verts = p->verts.data() + offset;
+
+    // only use several threads for big meshes
+    constexpr std::size_t minFacetsPerThread = 10000;
+    int threads = int(std::min<std::size_t>(
+        std::thread::hardware_concurrency(),
+        std::size_t(ctFacets) / minFacetsPerThread
+    ));
+    MeshCore::parallel_for(
+        std::size_t(ctFacets),
+        [&](std::size_t begin, std::size_t end) {
+            Base::Vector3f points[3];
+            for (std::size_t i = begin; i < end; i++) {
+                getFacet(size_type(i), points);
+                for (int j = 0; j < 3; j++) {
+                    verts[3 * i + j] = Private::Vertex(points[j].x, points[j].y, points[j].z);
+                }
+            }
+        },
+        threads
+    );
+}
+
 void MeshFastBuilder::Finish()
 {
     using size_type = QVector<Private::Vertex>::size_type;
@@ -368,32 +399,71 @@ void MeshFastBuilder::Finish()
     int threads = int(std::thread::hardware_concurrency());
     MeshCore::parallel_sort(verts.begin(), verts.end(), std::less<>(), threads);
 
-    QVector<FacetIndex> indices(ulCtPts);
+    // Split the sorted vertexes into chunks and count the distinct points of each chunk, so that
+    // afterwards the points and their indices can be written in parallel.
+    constexpr std::size_t minPointsPerThread = 10000;
+    std::size_t numVerts = std::size_t(ulCtPts);
+    std::size_t chunks = std::max<std::size_t>(1, std::min<std::size_t>(threads, numVerts / minPointsPerThread));
+    std::size_t chunkSize = (numVerts + chunks - 1) / chunks;
+    const Private::Vertex* sorted = verts.constData();
+    auto isNewPoint = [sorted](std::size_t i) {
+        return i == 0 || sorted[i] != sorted[i - 1];
+    };
 
-    size_type vertex_count = 0;
-    for (QVector<Private::Vertex>::iterator v = verts.begin(); v != verts.end(); ++v) {
-        if (!vertex_count || *v != verts[vertex_count - 1]) {
-            verts[vertex_count++] = *v;
-        }
+    std::vector<std::size_t> offsets(chunks + 1, 0);
+    MeshCore::parallel_for(
+        chunks,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t chunk = begin; chunk < end; chunk++) {
+                std::size_t last = std::min(numVerts, (chunk + 1) * chunkSize);
+                for (std::size_t i = chunk * chunkSize; i < last; i++) {
+                    if (isNewPoint(i)) {
+                        offsets[chunk + 1]++;
+                    }
+                }
+            }
+        },
+        int(chunks)
+    );
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    MeshPointArray rPoints(static_cast<PointIndex>(offsets.back()));
+    std::vector<PointIndex> indices(numVerts);
+    MeshCore::parallel_for(
+        chunks,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t chunk = begin; chunk < end; chunk++) {
+                // the first vertexes of a chunk may belong to the last point of the chunk before
+                std::size_t point = offsets[chunk];
+                std::size_t last = std::min(numVerts, (chunk + 1) * chunkSize);
+                for (std::size_t i = chunk * chunkSize; i < last; i++) {
+                    if (isNewPoint(i)) {
+                        rPoints[point++].Set(sorted[i].x, sorted[i].y, sorted[i].z);
+                    }
+                    indices[sorted[i].i] = static_cast<PointIndex>(point - 1);
+                }
+            }
+        },
+        int(chunks)
+    );
 
-        indices[v->i] = static_cast<FacetIndex>(vertex_count - 1);
-    }
+    // release the memory of the vertexes before the facets are created
+    verts = QVector<Private::Vertex>();
 
-    size_type ulCt = verts.size() / 3;
+    std::size_t ulCt = numVerts / 3;
     MeshFacetArray rFacets(static_cast<FacetIndex>(ulCt));
-    for (size_type i = 0; i < ulCt; ++i) {
-        rFacets[static_cast<size_t>(i)]._aulPoints[0] = indices[3 * i];
-        rFacets[static_cast<size_t>(i)]._aulPoints[1] = indices[3 * i + 1];
-        rFacets[static_cast<size_t>(i)]._aulPoints[2] = indices[3 * i + 2];
-    }
-
-    verts.resize(vertex_count);
-
-    MeshPointArray rPoints;
-    rPoints.reserve(static_cast<size_t>(vertex_count));
-    for (const auto& v : verts) {
-        rPoints.push_back(MeshPoint(v.x, v.y, v.z));
-    }
+    MeshCore::parallel_for(
+        ulCt,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                rFacets[i]._aulPoints[0] = indices[3 * i];
+                rFacets[i]._aulPoints[1] = indices[3 * i + 1];
+                rFacets[i]._aulPoints[2] = indices[3 * i + 2];
+            }
+        },
+        int(chunks)
+    );
+    indices = std::vector<PointIndex>();
 
     _meshKernel.Adopt(rPoints, rFacets, true);
 }
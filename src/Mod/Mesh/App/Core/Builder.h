@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <functional>
 #include <set>
 #include <vector>
 
@@ -221,6 +222,10 @@ public:
     /** Add new facet
      */
     void AddFacet(const MeshGeomFacet& facetPoints);
+    /** Adds \a ctFacets facets at once. \a getFacet(i, points) must write the three corner points
+     * of the i-th facet to \a points. It is called from several threads at the same time.
+     */
+    void AddFacets(size_type ctFacets, const std::function<void(size_type, Base::Vector3f*)>& getFacet);
 
     /** Finishes building up the mesh structure. Must be done after adding facets.
      */
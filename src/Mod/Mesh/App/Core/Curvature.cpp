@@ -23,12 +23,10 @@
  ***************************************************************************/
 
 #include <algorithm>
-#include <functional>
+#include <cmath>
 #include <limits>
-
-#include <QFuture>
-#include <QFutureWatcher>
-#include <QtConcurrentMap>
+#include <numeric>
+#include <thread>
 
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -37,18 +35,32 @@
 #ifdef OPTIMIZE_CURVATURE
 # include <Eigen/Eigenvalues>
 #else
-# include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
+# include <Mod/Mesh/App/WildMagic4/Wm4Matrix3.h>
+# include <Mod/Mesh/App/WildMagic4/Wm4Vector2.h>
 #endif
 
 #include "Approximation.h"
 #include "Curvature.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Tools.h"
 
 
 using namespace MeshCore;
-namespace sp = std::placeholders;
+
+namespace
+{
+// with less elements per thread the threads don't pay off
+int countThreads(std::size_t count)
+{
+    constexpr std::size_t minElementsPerThread = 10000;
+    return int(std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(std::thread::hardware_concurrency(), count / minElementsPerThread)
+    ));
+}
+}  // namespace
 
 MeshCurvature::MeshCurvature(const MeshKernel& kernel)
     : myKernel(kernel)
@@ -81,16 +93,25 @@ void MeshCurvature::ComputePerFace(bool parallel)
         }
     }
     else {
-        // NOLINTBEGIN
-        QFuture<CurvatureInfo> future
-            = QtConcurrent::mapped(mySegment, std::bind(&FacetCurvature::Compute, &face, sp::_1));
-        // NOLINTEND
-        QFutureWatcher<CurvatureInfo> watcher;
-        watcher.setFuture(future);
-        watcher.waitForFinished();
-        for (const auto& it : future) {
-            myCurvature.push_back(it);
-        }
+        // each facet is expensive, so the threads pay off with small chunks
+        constexpr std::size_t minFacetsPerThread = 100;
+        int threads = int(std::max<std::size_t>(
+            1,
+            std::min<std::size_t>(
+                std::thread::hardware_concurrency(),
+                mySegment.size() / minFacetsPerThread
+            )
+        ));
+        myCurvature.resize(mySegment.size());
+        parallel_for(
+            mySegment.size(),
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++) {
+                    myCurvature[i] = face.Compute(mySegment[i]);
+                }
+            },
+            threads
+        );
     }
 }
 
@@ -293,57 +314,161 @@ void MeshCurvature::ComputePerVertex()
 {
     myCurvature.clear();
 
-    // get all points
-    std::vector<Wm4::Vector3<double>> aPnts;
-    aPnts.reserve(myKernel.CountPoints());
-    MeshPointIterator cPIt(myKernel);
-    for (cPIt.Init(); cPIt.More(); cPIt.Next()) {
-        Wm4::Vector3<double> cP(cPIt->x, cPIt->y, cPIt->z);
-        aPnts.push_back(cP);
+    // in case of an empty mesh no curvature can be calculated
+    if (myKernel.CountPoints() == 0 || myKernel.CountFacets() == 0) {
+        return;
     }
 
-    // get all point connections
-    std::vector<int> aIdx;
-    aIdx.reserve(3 * myKernel.CountFacets());
-    const MeshFacetArray& raFts = myKernel.GetFacets();
-    for (const auto& it : raFts) {
+    // This is the algorithm of Wm4::MeshCurvature computed per vertex instead of per triangle.
+    // Each vertex sums up over its corners in the order of the facets, so that the results are
+    // the same as before but the vertices can be handled in parallel.
+    const MeshPointArray& rPoints = myKernel.GetPoints();
+    const MeshFacetArray& rFacets = myKernel.GetFacets();
+    std::size_t numPoints = rPoints.size();
+    std::size_t numFacets = rFacets.size();
+
+    // the corners (3 * facet + corner) of each point
+    std::vector<std::size_t> offsets(numPoints + 1, 0);
+    for (const auto& it : rFacets) {
         for (PointIndex point : it._aulPoints) {
-            aIdx.push_back(int(point));
+            offsets[point + 1]++;
         }
     }
-
-    // in case of an empty mesh no curvature can be calculated
-    if (myKernel.CountPoints() == 0 || myKernel.CountFacets() == 0) {
-        return;
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<std::size_t> corners(offsets.back());
+    {
+        std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < numFacets; i++) {
+            for (int j = 0; j < 3; j++) {
+                corners[next[rFacets[i]._aulPoints[j]]++] = 3 * i + j;
+            }
+        }
     }
 
-    // compute vertex based curvatures
-    Wm4::MeshCurvature<double>
-        meshCurv(myKernel.CountPoints(), aPnts.data(), myKernel.CountFacets(), aIdx.data());
-
-    // get curvature information now
-    const Wm4::Vector3<double>* aMaxCurvDir = meshCurv.GetMaxDirections();
-    const Wm4::Vector3<double>* aMinCurvDir = meshCurv.GetMinDirections();
-    const double* aMaxCurv = meshCurv.GetMaxCurvatures();
-    const double* aMinCurv = meshCurv.GetMinCurvatures();
+    using Vector3 = Wm4::Vector3<double>;
+    using Matrix3 = Wm4::Matrix3<double>;
+    using Vector2 = Wm4::Vector2<double>;
+
+    std::vector<Vector3> aPnts(numPoints);
+    std::vector<Vector3> aNormals(numPoints);
+    std::vector<Vector3> aFacetNormals(numFacets);
+    myCurvature.resize(numPoints);
+
+    auto pointThreads = countThreads(numPoints);
+    parallel_for(
+        numPoints,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                aPnts[i] = Vector3(rPoints[i].x, rPoints[i].y, rPoints[i].z);
+            }
+        },
+        pointThreads
+    );
+
+    // the length provides a weighted sum
+    parallel_for(
+        numFacets,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const MeshFacet& face = rFacets[i];
+                Vector3 kEdge1 = aPnts[face._aulPoints[1]] - aPnts[face._aulPoints[0]];
+                Vector3 kEdge2 = aPnts[face._aulPoints[2]] - aPnts[face._aulPoints[0]];
+                aFacetNormals[i] = kEdge1.Cross(kEdge2);
+            }
+        },
+        countThreads(numFacets)
+    );
+
+    parallel_for(
+        numPoints,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                Vector3 kNormal(0.0, 0.0, 0.0);
+                for (std::size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                    kNormal += aFacetNormals[corners[k] / 3];
+                }
+                kNormal.Normalize();
+                aNormals[i] = kNormal;
+            }
+        },
+        pointThreads
+    );
+
+    parallel_for(
+        numPoints,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                // compute the matrix of normal derivatives
+                Matrix3 akWWTrn(0, 0, 0, 0, 0, 0, 0, 0, 0);
+                Matrix3 akDWTrn(0, 0, 0, 0, 0, 0, 0, 0, 0);
+                const Vector3& kN = aNormals[i];
+                for (std::size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                    const MeshFacet& face = rFacets[corners[k] / 3];
+                    int j = int(corners[k] % 3);
+                    PointIndex iV1 = face._aulPoints[(j + 1) % 3];
+                    PointIndex iV2 = face._aulPoints[(j + 2) % 3];
+
+                    // Compute the edges from V0 to V1 and V2, project them to tangent plane of
+                    // vertex, and compute difference of adjacent normals.
+                    for (PointIndex iV : {iV1, iV2}) {
+                        Vector3 kE = aPnts[iV] - aPnts[i];
+                        Vector3 kW = kE - (kE.Dot(kN)) * kN;
+                        Vector3 kD = aNormals[iV] - kN;
+                        for (int iRow = 0; iRow < 3; iRow++) {
+                            for (int iCol = 0; iCol < 3; iCol++) {
+                                akWWTrn[iRow][iCol] += kW[iRow] * kW[iCol];
+                                akDWTrn[iRow][iCol] += kD[iRow] * kW[iCol];
+                            }
+                        }
+                    }
+                }
 
-    myCurvature.reserve(myKernel.CountPoints());
-    for (unsigned long i = 0; i < myKernel.CountPoints(); i++) {
-        CurvatureInfo ci;
-        ci.cMaxCurvDir = Base::Vector3f(
-            (float)aMaxCurvDir[i].X(),
-            (float)aMaxCurvDir[i].Y(),
-            (float)aMaxCurvDir[i].Z()
-        );
-        ci.cMinCurvDir = Base::Vector3f(
-            (float)aMinCurvDir[i].X(),
-            (float)aMinCurvDir[i].Y(),
-            (float)aMinCurvDir[i].Z()
-        );
-        ci.fMaxCurvature = (float)aMaxCurv[i];
-        ci.fMinCurvature = (float)aMinCurv[i];
-        myCurvature.push_back(ci);
-    }
+                // Add in N*N^T to W*W^T for numerical stability.  In theory 0*0^T gets
+                // added to D*W^T, but of course no update needed in the implementation.
+                for (int iRow = 0; iRow < 3; iRow++) {
+                    for (int iCol = 0; iCol < 3; iCol++) {
+                        akWWTrn[iRow][iCol] = 0.5 * akWWTrn[iRow][iCol] + kN[iRow] * kN[iCol];
+                        akDWTrn[iRow][iCol] *= 0.5;
+                    }
+                }
+                Matrix3 akDNormal = akDWTrn * akWWTrn.Inverse();
+
+                // Compute S = J^T * dN/dX * J with J = [U | V], see Wm4::MeshCurvature.
+                Vector3 kU, kV;
+                Vector3::GenerateComplementBasis(kU, kV, kN);
+                double fS01 = kU.Dot(akDNormal * kV);
+                double fS10 = kV.Dot(akDNormal * kU);
+                double fSAvr = 0.5 * (fS01 + fS10);
+                double fS00 = kU.Dot(akDNormal * kU);
+                double fS11 = kV.Dot(akDNormal * kV);
+
+                // compute the eigenvalues of S (min and max curvatures)
+                double fTrace = fS00 + fS11;
+                double fDet = fS00 * fS11 - fSAvr * fSAvr;
+                double fDiscr = fTrace * fTrace - 4.0 * fDet;
+                double fRootDiscr = std::sqrt(std::fabs(fDiscr));
+                double fMinCurvature = 0.5 * (fTrace - fRootDiscr);
+                double fMaxCurvature = 0.5 * (fTrace + fRootDiscr);
+
+                // compute the eigenvectors of S
+                auto direction = [&](double fCurvature) {
+                    Vector2 kW0(fSAvr, fCurvature - fS00);
+                    Vector2 kW1(fCurvature - fS11, fSAvr);
+                    Vector2& kW = kW0.SquaredLength() >= kW1.SquaredLength() ? kW0 : kW1;
+                    kW.Normalize();
+                    Vector3 kDir = kW.X() * kU + kW.Y() * kV;
+                    return Base::Vector3f(float(kDir.X()), float(kDir.Y()), float(kDir.Z()));
+                };
+
+                CurvatureInfo& ci = myCurvature[i];
+                ci.fMaxCurvature = float(fMaxCurvature);
+                ci.fMinCurvature = float(fMinCurvature);
+                ci.cMaxCurvDir = direction(fMaxCurvature);
+                ci.cMinCurvDir = direction(fMinCurvature);
+            }
+        },
+        pointThreads
+    );
 }
 #endif  // OPTIMIZE_CURVATURE
 
@@ -22,58 +22,79 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
+#include <thread>
 
 #include "Decimation.h"
+#include "Functional.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
 
 
 using namespace MeshCore;
 
-MeshSimplify::MeshSimplify(MeshKernel& mesh)
-    : myKernel(mesh)
-{}
+namespace
+{
+// with less facets per thread the partitioning doesn't pay off
+constexpr std::size_t minFacetsPerThread = 100000;
+// a partition needs an interior besides its locked border
+constexpr std::size_t minFacetsPerPartition = 1000;
+// owner of a point that is not used by any or by several partitions
+constexpr int unused = -1;
+constexpr int shared = -2;
 
-void MeshSimplify::simplify(float tolerance, float reduction)
+void initVertex(Simplify::Vertex& v, const Base::Vector3f& p, bool locked)
 {
-    Simplify alg;
+    v.p = p;
+    v.tstart = 0;
+    v.tcount = 0;
+    v.border = 0;
+    v.locked = locked ? 1 : 0;
+}
 
-    const MeshPointArray& points = myKernel.GetPoints();
+void initTriangle(Simplify::Triangle& t, PointIndex p0, PointIndex p1, PointIndex p2)
+{
+    t.v[0] = static_cast<int>(p0);
+    t.v[1] = static_cast<int>(p1);
+    t.v[2] = static_cast<int>(p2);
+    t.deleted = 0;
+    t.dirty = 0;
+    for (double& j : t.err) {
+        j = 0.0;
+    }
+}
+
+void fillSimplify(
+    Simplify& alg,
+    const MeshPointArray& points,
+    const MeshFacetArray& facets,
+    const std::vector<bool>& locked
+)
+{
+    alg.vertices.resize(points.size());
     for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+        initVertex(alg.vertices[i], points[i], !locked.empty() && locked[i]);
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
+    alg.triangles.resize(facets.size());
     for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
+        const MeshFacet& face = facets[i];
+        initTriangle(alg.triangles[i], face._aulPoints[0], face._aulPoints[1], face._aulPoints[2]);
     }
+}
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0F - reduction));
-
-    // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+void getSimplified(Simplify& alg, MeshPointArray& points, MeshFacetArray& facets)
+{
+    // release the memory of the algorithm as early as possible
+    std::vector<Simplify::Ref>().swap(alg.refs);
 
-    // Simplification done
-    MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
+    points.reserve(alg.vertices.size());
     for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+        points.push_back(vertex.p);
     }
+    std::vector<Simplify::Vertex>().swap(alg.vertices);
 
     std::size_t numFacets = 0;
     for (const auto& triangle : alg.triangles) {
@@ -81,76 +102,291 @@ void MeshSimplify::simplify(float tolerance, float reduction)
             numFacets++;
         }
     }
-    MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
+    facets.reserve(numFacets);
     for (const auto& triangle : alg.triangles) {
         if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
-            new_facets.push_back(face);
+            facets.emplace_back(triangle.v[0], triangle.v[1], triangle.v[2]);
         }
     }
+}
+}  // namespace
 
-    myKernel.Adopt(new_points, new_facets, true);
+MeshSimplify::MeshSimplify(MeshKernel& mesh)
+    : myKernel(mesh)
+{}
+
+void MeshSimplify::setThreads(int threads)
+{
+    myThreads = std::max<int>(threads, 0);
+}
+
+void MeshSimplify::setLockedPoints(const std::vector<PointIndex>& points)
+{
+    myLocked.assign(myKernel.CountPoints(), false);
+    for (PointIndex pnt : points) {
+        if (pnt < myLocked.size()) {
+            myLocked[pnt] = true;
+        }
+    }
+}
+
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0F - reduction));
+    decimate(target_count, tolerance);
 }
 
 void MeshSimplify::simplify(int targetSize)
 {
-    Simplify alg;
+    decimate(targetSize, std::numeric_limits<float>::max());
+}
 
-    const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+int MeshSimplify::countThreads() const
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    if (myThreads > 0) {
+        return int(std::min<std::size_t>(myThreads, numFacets / minFacetsPerPartition));
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
+    return int(std::min<std::size_t>(std::thread::hardware_concurrency(), numFacets / minFacetsPerThread));
+}
+
+void MeshSimplify::decimate(int targetSize, float tolerance)
+{
+    int threads = countThreads();
+    if (threads > 1) {
+        decimatePartitions(targetSize, tolerance, threads);
     }
 
+    Simplify alg;
+    fillSimplify(alg, myKernel.GetPoints(), myKernel.GetFacets(), myLocked);
+
+    // the mesh is rebuilt from the algorithm, so its memory can be released beforehand
+    myKernel.Clear();
+    myLocked.clear();
+
     // Simplification starts
-    alg.simplify_mesh(targetSize, std::numeric_limits<float>::max());
+    alg.simplify_mesh(targetSize, tolerance);
 
     // Simplification done
     MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+    MeshFacetArray new_facets;
+    getSimplified(alg, new_points, new_facets);
+    myKernel.Adopt(new_points, new_facets, true);
+}
+
+void MeshSimplify::decimatePartitions(int targetSize, float tolerance, int threads)
+{
+    const MeshPointArray& points = myKernel.GetPoints();
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    std::size_t numFacets = facets.size();
+    std::size_t numPartitions = threads;
+
+    // split the facets into slabs of equal size along the longest side of the bounding box
+    const Base::BoundBox3f& box = myKernel.GetBoundBox();
+    float Base::Vector3f::*coord = &Base::Vector3f::x;
+    if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+        coord = &Base::Vector3f::y;
+    }
+    else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+        coord = &Base::Vector3f::z;
     }
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
+    std::vector<float> keys(numFacets);
+    parallel_for(
+        numFacets,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const MeshFacet& face = facets[i];
+                keys[i] = points[face._aulPoints[0]].*coord + points[face._aulPoints[1]].*coord
+                    + points[face._aulPoints[2]].*coord;
+            }
+        },
+        threads
+    );
+
+    std::vector<FacetIndex> order(numFacets);
+    std::iota(order.begin(), order.end(), FacetIndex(0));
+    parallel_sort(
+        order.begin(),
+        order.end(),
+        [&keys](FacetIndex f1, FacetIndex f2) { return keys[f1] < keys[f2]; },
+        threads
+    );
+    std::vector<float>().swap(keys);
+
+    auto partitionStart = [numFacets, numPartitions](std::size_t part) {
+        return part * numFacets / numPartitions;
+    };
+
+    // the points used by several partitions are locked
+    std::vector<int> owner(points.size(), unused);
+    for (std::size_t part = 0; part < numPartitions; part++) {
+        for (std::size_t i = partitionStart(part); i < partitionStart(part + 1); i++) {
+            for (PointIndex pnt : facets[order[i]]._aulPoints) {
+                int& own = owner[pnt];
+                if (own == unused) {
+                    own = int(part);
+                }
+                else if (own != int(part)) {
+                    own = shared;
+                }
+            }
+        }
+    }
+
+    // the locked points of the caller are kept like the shared points
+    for (std::size_t i = 0; i < myLocked.size(); i++) {
+        if (myLocked[i] && owner[i] != unused) {
+            owner[i] = shared;
+        }
+    }
+
+    // the shared points come first in the decimated mesh
+    std::vector<PointIndex> sharedPoints;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (owner[i] == shared) {
+            sharedPoints.push_back(PointIndex(i));
         }
     }
+    std::size_t numShared = sharedPoints.size();
+
+    // the facet indices of the own points of a partition start at numShared
+    struct Partition
+    {
+        MeshPointArray points;
+        MeshFacetArray facets;
+    };
+    std::vector<Partition> results(numPartitions);
+    double ratio = double(targetSize) / double(numFacets);
+
+    auto decimatePartition = [&](std::size_t part) {
+        std::size_t first = partitionStart(part);
+        std::size_t last = partitionStart(part + 1);
+
+        std::vector<PointIndex> verts;
+        verts.reserve(3 * (last - first));
+        for (std::size_t i = first; i < last; i++) {
+            const MeshFacet& face = facets[order[i]];
+            verts.insert(verts.end(), face._aulPoints, face._aulPoints + 3);
+        }
+        std::sort(verts.begin(), verts.end());
+        verts.erase(std::unique(verts.begin(), verts.end()), verts.end());
+        auto localIndex = [&verts](PointIndex pnt) {
+            return PointIndex(std::lower_bound(verts.begin(), verts.end(), pnt) - verts.begin());
+        };
+
+        Simplify alg;
+        alg.vertices.resize(verts.size());
+        for (std::size_t i = 0; i < verts.size(); i++) {
+            initVertex(alg.vertices[i], points[verts[i]], owner[verts[i]] == shared);
+        }
+
+        std::size_t lockedFacets = 0;
+        alg.triangles.resize(last - first);
+        for (std::size_t i = first; i < last; i++) {
+            const MeshFacet& face = facets[order[i]];
+            initTriangle(
+                alg.triangles[i - first],
+                localIndex(face._aulPoints[0]),
+                localIndex(face._aulPoints[1]),
+                localIndex(face._aulPoints[2])
+            );
+            if (owner[face._aulPoints[0]] == shared || owner[face._aulPoints[1]] == shared
+                || owner[face._aulPoints[2]] == shared) {
+                lockedFacets++;
+            }
+        }
+
+        // the facets at the locked border are left to the final pass
+        std::size_t freeFacets = last - first - lockedFacets;
+        int target = static_cast<int>(ratio * double(freeFacets)) + static_cast<int>(lockedFacets);
+        alg.simplify_mesh(target, tolerance);
+        std::vector<Simplify::Ref>().swap(alg.refs);
+
+        // the locked points keep their order, so they map to the shared points in ascending order
+        Partition& result = results[part];
+        std::vector<PointIndex> index(alg.vertices.size());
+        auto nextLocked = verts.begin();
+        for (std::size_t i = 0; i < alg.vertices.size(); i++) {
+            const Simplify::Vertex& vertex = alg.vertices[i];
+            if (vertex.locked) {
+                nextLocked = std::find_if(nextLocked, verts.end(), [&owner](PointIndex pnt) {
+                    return owner[pnt] == shared;
+                });
+                index[i] = PointIndex(
+                    std::lower_bound(sharedPoints.begin(), sharedPoints.end(), *nextLocked)
+                    - sharedPoints.begin()
+                );
+                ++nextLocked;
+            }
+            else {
+                index[i] = PointIndex(numShared + result.points.size());
+                result.points.push_back(vertex.p);
+            }
+        }
+
+        result.facets.reserve(alg.triangles.size());
+        for (const auto& triangle : alg.triangles) {
+            if (!triangle.deleted) {
+                result.facets.emplace_back(
+                    index[triangle.v[0]],
+                    index[triangle.v[1]],
+                    index[triangle.v[2]]
+                );
+            }
+        }
+    };
+
+    parallel_for(
+        numPartitions,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t part = begin; part < end; part++) {
+                decimatePartition(part);
+            }
+        },
+        threads
+    );
+
+    // stitch the partitions together at the shared points
+    std::size_t numPoints = numShared;
+    std::size_t numDecimated = 0;
+    for (const auto& result : results) {
+        numPoints += result.points.size();
+        numDecimated += result.facets.size();
+    }
+
+    MeshPointArray new_points;
+    new_points.reserve(numPoints);
+    for (PointIndex pnt : sharedPoints) {
+        new_points.push_back(points[pnt]);
+    }
+
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
+    new_facets.reserve(numDecimated);
+    for (auto& result : results) {
+        PointIndex offset = PointIndex(new_points.size() - numShared);
+        new_points.insert(new_points.end(), result.points.begin(), result.points.end());
+        for (MeshFacet face : result.facets) {
+            for (PointIndex& pnt : face._aulPoints) {
+                if (pnt >= numShared) {
+                    pnt += offset;
+                }
+            }
             new_facets.push_back(face);
         }
+        result = Partition();
     }
 
-    myKernel.Adopt(new_points, new_facets, true);
+    // the locked points are among the shared points now
+    if (!myLocked.empty()) {
+        std::vector<bool> locked(new_points.size(), false);
+        for (std::size_t i = 0; i < numShared; i++) {
+            locked[i] = myLocked[sharedPoints[i]];
+        }
+        myLocked.swap(locked);
+    }
+
+    myKernel.Adopt(new_points, new_facets, false);
 }
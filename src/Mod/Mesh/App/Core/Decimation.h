@@ -25,7 +25,9 @@
 
 #pragma once
 
-#include <Mod/Mesh/MeshGlobal.h>
+#include <vector>
+
+#include "Definitions.h"
 
 namespace MeshCore
 {
@@ -35,11 +37,30 @@ class MeshExport MeshSimplify
 {
 public:
     explicit MeshSimplify(MeshKernel&);
+    /**
+     * Sets the number of threads. Big meshes are split into as many spatial partitions that are
+     * decimated concurrently with locked borders, a final pass over the whole mesh then also
+     * decimates the borders. 0 (the default) chooses the number from the hardware and the mesh
+     * size, 1 decimates the whole mesh at once.
+     */
+    void setThreads(int threads);
+    /**
+     * Sets the points that keep their position. The edges at these points are never collapsed,
+     * e.g. to decimate a part of a mesh that must still fit to the rest of it.
+     */
+    void setLockedPoints(const std::vector<PointIndex>& points);
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
 
+private:
+    int countThreads() const;
+    void decimate(int targetSize, float tolerance);
+    void decimatePartitions(int targetSize, float tolerance, int threads);
+
 private:
     MeshKernel& myKernel;
+    int myThreads {0};
+    std::vector<bool> myLocked;
 };
 
 }  // namespace MeshCore
@@ -22,6 +22,8 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <limits>
 
 #include <Mod/Mesh/App/WildMagic4/Wm4DistSegment3Triangle3.h>
@@ -98,13 +100,87 @@ MeshPointArray& MeshPointArray::operator=(const MeshPointArray& rclPAry) = defau
 
 MeshPointArray& MeshPointArray::operator=(MeshPointArray&& rclPAry) = default;
 
+namespace
+{
+/**
+ * MeshPoint stores its coordinates interleaved with the flag and property, so the bulk operations
+ * on the point array copy the points block-wise into separate coordinate arrays. The loops over a
+ * block then have no dependencies between the iterations and are vectorized by the compiler.
+ */
+struct PointBlock
+{
+    static constexpr std::size_t Size = 256;
+    std::array<float, Size> x {}, y {}, z {};
+
+    void Load(const MeshPoint* points, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            x[i] = points[i].x;
+            y[i] = points[i].y;
+            z[i] = points[i].z;
+        }
+    }
+    void Store(MeshPoint* points, std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; i++) {
+            points[i].Set(x[i], y[i], z[i]);
+        }
+    }
+    void Transform(const Base::Matrix4D& mat, std::size_t count)
+    {
+        // same arithmetic as Matrix4D::multVec
+        const double m00 = mat[0][0], m01 = mat[0][1], m02 = mat[0][2], m03 = mat[0][3];
+        const double m10 = mat[1][0], m11 = mat[1][1], m12 = mat[1][2], m13 = mat[1][3];
+        const double m20 = mat[2][0], m21 = mat[2][1], m22 = mat[2][2], m23 = mat[2][3];
+        for (std::size_t i = 0; i < count; i++) {
+            double sx = static_cast<double>(x[i]);
+            double sy = static_cast<double>(y[i]);
+            double sz = static_cast<double>(z[i]);
+            x[i] = static_cast<float>(m00 * sx + m01 * sy + m02 * sz + m03);
+            y[i] = static_cast<float>(m10 * sx + m11 * sy + m12 * sz + m13);
+            z[i] = static_cast<float>(m20 * sx + m21 * sy + m22 * sz + m23);
+        }
+    }
+    void AddToBoundBox(Base::BoundBox3f& box, std::size_t count) const
+    {
+        float minX = box.MinX, minY = box.MinY, minZ = box.MinZ;
+        float maxX = box.MaxX, maxY = box.MaxY, maxZ = box.MaxZ;
+        for (std::size_t i = 0; i < count; i++) {
+            minX = std::min(minX, x[i]);
+            minY = std::min(minY, y[i]);
+            minZ = std::min(minZ, z[i]);
+            maxX = std::max(maxX, x[i]);
+            maxY = std::max(maxY, y[i]);
+            maxZ = std::max(maxZ, z[i]);
+        }
+        box = Base::BoundBox3f(minX, minY, minZ, maxX, maxY, maxZ);
+    }
+};
+}  // namespace
+
 void MeshPointArray::Transform(const Base::Matrix4D& mat)
 {
-    for (auto& pP : *this) {
-        mat.multVec(pP, pP);
+    PointBlock block;
+    for (std::size_t start = 0; start < size(); start += PointBlock::Size) {
+        std::size_t count = std::min(PointBlock::Size, size() - start);
+        block.Load(data() + start, count);
+        block.Transform(mat, count);
+        block.Store(data() + start, count);
     }
 }
 
+Base::BoundBox3f MeshPointArray::GetBoundBox() const
+{
+    Base::BoundBox3f box;
+    PointBlock block;
+    for (std::size_t start = 0; start < size(); start += PointBlock::Size) {
+        std::size_t count = std::min(PointBlock::Size, size() - start);
+        block.Load(data() + start, count);
+        block.AddToBoundBox(box, count);
+    }
+    return box;
+}
+
 MeshFacetArray::MeshFacetArray(const MeshFacetArray& ary) = default;
 
 MeshFacetArray::MeshFacetArray(MeshFacetArray&& ary) = default;
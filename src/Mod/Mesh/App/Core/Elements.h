@@ -734,6 +734,8 @@ public:
     MeshPointArray& operator=(const MeshPointArray& rclPAry);
     MeshPointArray& operator=(MeshPointArray&& rclPAry);
     void Transform(const Base::Matrix4D&);
+    /** Returns the bounding box of all points. */
+    Base::BoundBox3f GetBoundBox() const;
     /**
      * Searches for the first point index  Two points are equal if the distance is less
      * than EPSILON. If no such points is found POINT_INDEX_MAX is returned.
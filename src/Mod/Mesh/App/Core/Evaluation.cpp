@@ -24,6 +24,8 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 
@@ -600,81 +602,127 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
+/**
+ * Searches for pairs of intersecting facets. The candidate pairs are found with a sweep and
+ * prune along the longest axis of the mesh: the facets are sorted by the lower end of their
+ * bounding boxes, so that each facet needs only to be tested against the following facets that
+ * start before it ends. The facets are handled block-wise with several threads, in between the
+ * progress is reported.
+ * Facets sharing a common vertex are not tested because they could but usually do not intersect
+ * each other and the intersection test would detect false-positives, otherwise.
+ */
+void findSelfIntersections(
+    const MeshKernel& mesh,
+    bool firstOnly,
+    bool canAbort,
+    std::vector<std::pair<FacetIndex, FacetIndex>>& intersection
+)
+{
+    const MeshFacetArray& rFaces = mesh.GetFacets();
+    std::size_t numFacets = rFaces.size();
+    int threads = int(std::thread::hardware_concurrency());
 
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
+    Base::BoundBox3f meshBox = mesh.GetBoundBox();
+    int axis = 0;
+    if (meshBox.LengthY() > meshBox.LengthX() && meshBox.LengthY() >= meshBox.LengthZ()) {
+        axis = 1;
+    }
+    else if (meshBox.LengthZ() > meshBox.LengthX() && meshBox.LengthZ() > meshBox.LengthY()) {
+        axis = 2;
     }
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes(numFacets);
+    std::vector<float> lower(numFacets);
+    std::vector<float> upper(numFacets);
+    std::vector<FacetIndex> order(numFacets);
+    MeshCore::parallel_for(
+        numFacets,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const Base::BoundBox3f& box = boxes[i] = mesh.GetFacet(i).GetBoundBox();
+                lower[i] = axis == 0 ? box.MinX : axis == 1 ? box.MinY : box.MinZ;
+                upper[i] = axis == 0 ? box.MaxX : axis == 1 ? box.MaxY : box.MaxZ;
+                order[i] = i;
+            }
+        },
+        threads
+    );
+    MeshCore::parallel_sort(
+        order.begin(),
+        order.end(),
+        [&lower](FacetIndex x, FacetIndex y) { return lower[x] < lower[y]; },
+        threads
+    );
+
+    auto shareVertex = [&rFaces](FacetIndex i, FacetIndex j) {
+        const MeshFacet& rface1 = rFaces[i];
+        const MeshFacet& rface2 = rFaces[j];
+        for (PointIndex point : rface1._aulPoints) {
+            if (point == rface2._aulPoints[0] || point == rface2._aulPoints[1]
+                || point == rface2._aulPoints[2]) {
+                return true;
+            }
         }
+        return false;
+    };
 
-        MeshGeomFacet facet1, facet2;
+    std::atomic<bool> found {false};
+    std::mutex mutex;
+    auto intersectRange = [&](std::size_t begin, std::size_t end) {
+        std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
         Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+        for (std::size_t pos = begin; pos < end && !(firstOnly && found); pos++) {
+            FacetIndex index1 = order[pos];
+            const Base::BoundBox3f& box1 = boxes[index1];
+            MeshGeomFacet facet1 = mesh.GetFacet(index1);
+            for (std::size_t next = pos + 1; next < numFacets; next++) {
+                FacetIndex index2 = order[next];
+                if (lower[index2] > upper[index1]) {
+                    break;
                 }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
+                if (!(box1 && boxes[index2]) || shareVertex(index1, index2)) {
+                    continue;
                 }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
+                if (facet1.IntersectWithFacet(mesh.GetFacet(index2), pt1, pt2) == 2) {
+                    pairs.emplace_back(std::min(index1, index2), std::max(index1, index2));
+                    if (firstOnly) {
+                        found = true;
+                        break;
                     }
                 }
             }
         }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        intersection.insert(intersection.end(), pairs.begin(), pairs.end());
+    };
+
+    // Calculates the intersections
+    constexpr std::size_t numBlocks = 100;
+    std::size_t blockSize = (numFacets + numBlocks - 1) / numBlocks;
+    Base::SequencerLauncher seq("Checking for self-intersections...", numBlocks);
+    for (std::size_t block = 0; block < numFacets && !(firstOnly && found); block += blockSize) {
+        std::size_t count = std::min(blockSize, numFacets - block);
+        MeshCore::parallel_for(
+            count,
+            [&](std::size_t begin, std::size_t end) { intersectRange(block + begin, block + end); },
+            threads
+        );
+        seq.next(canAbort);
     }
 
-    return true;
+    std::sort(intersection.begin(), intersection.end());
+}
+}  // namespace
+
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    findSelfIntersections(_rclMesh, true, false, intersection);
+    return intersection.empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -707,77 +755,7 @@ void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection
 ) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
-                    }
-                }
-            }
-        }
-    }
+    findSelfIntersections(_rclMesh, false, true, intersection);
 }
 
 std::vector<FacetIndex> MeshFixSelfIntersection::GetFacets() const
@@ -971,76 +949,98 @@ bool MeshFixNeighbourhood::Fixup()
     return true;
 }
 
-void MeshKernel::RebuildNeighbours(FacetIndex index)
+namespace
 {
-    std::vector<Edge_Index> edges;
-    edges.reserve(3 * (this->_aclFacetArray.size() - index));
+/// Sets the neighbourhood of the facets of the sorted edges in the range [first, last)
+void setNeighbours(MeshFacetArray& facets, const Edge_Index* first, const Edge_Index* last)
+{
+    while (first != last) {
+        const Edge_Index* next = first + 1;
+        while (next != last && next->p0 == first->p0 && next->p1 == first->p1) {
+            ++next;
+        }
 
-    // build up an array of edges
-    auto pB = this->_aclFacetArray.begin();
-    for (auto pI = pB + index; pI != this->_aclFacetArray.end(); ++pI) {
-        for (int i = 0; i < 3; i++) {
-            Edge_Index item {};
-            item.p0 = std::min<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.p1 = std::max<PointIndex>(pI->_aulPoints[i], pI->_aulPoints[(i + 1) % 3]);
-            item.f = pI - pB;
-            edges.push_back(item);
+        // we handle only the cases for 1 and 2, for all higher
+        // values we have a non-manifold that is ignored here
+        std::ptrdiff_t count = next - first;
+        if (count == 2) {
+            MeshFacet& rFace0 = facets[first->f];
+            MeshFacet& rFace1 = facets[(first + 1)->f];
+            unsigned short side0 = rFace0.Side(first->p0, first->p1);
+            unsigned short side1 = rFace1.Side(first->p0, first->p1);
+            rFace0._aulNeighbours[side0] = (first + 1)->f;
+            rFace1._aulNeighbours[side1] = first->f;
         }
+        else if (count == 1) {
+            MeshFacet& rFace = facets[first->f];
+            unsigned short side = rFace.Side(first->p0, first->p1);
+            rFace._aulNeighbours[side] = FACET_INDEX_MAX;
+        }
+
+        first = next;
     }
+}
+}  // namespace
 
-    // sort the edges
-    // std::sort(edges.begin(), edges.end(), Edge_Less());
-    int threads = int(std::thread::hardware_concurrency());
-    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), threads);
+void MeshKernel::RebuildNeighbours(FacetIndex index)
+{
+    std::size_t numFacets = this->_aclFacetArray.size() - index;
+    std::vector<Edge_Index> edges(3 * numFacets);
 
-    PointIndex p0 = POINT_INDEX_MAX, p1 = POINT_INDEX_MAX;
-    PointIndex f0 = FACET_INDEX_MAX, f1 = FACET_INDEX_MAX;
-    int count = 0;
-    std::vector<Edge_Index>::iterator pE;
-    for (pE = edges.begin(); pE != edges.end(); ++pE) {
-        if (p0 == pE->p0 && p1 == pE->p1) {
-            f1 = pE->f;
-            count++;
-        }
-        else {
-            // we handle only the cases for 1 and 2, for all higher
-            // values we have a non-manifold that is ignored here
-            if (count == 2) {
-                MeshFacet& rFace0 = this->_aclFacetArray[f0];
-                MeshFacet& rFace1 = this->_aclFacetArray[f1];
-                unsigned short side0 = rFace0.Side(p0, p1);
-                unsigned short side1 = rFace1.Side(p0, p1);
-                rFace0._aulNeighbours[side0] = f1;
-                rFace1._aulNeighbours[side1] = f0;
-            }
-            else if (count == 1) {
-                MeshFacet& rFace = this->_aclFacetArray[f0];
-                unsigned short side = rFace.Side(p0, p1);
-                rFace._aulNeighbours[side] = FACET_INDEX_MAX;
+    // only use several threads for big meshes
+    constexpr std::size_t minFacetsPerThread = 10000;
+    int hardwareThreads = int(std::thread::hardware_concurrency());
+    int threads = int(std::min<std::size_t>(hardwareThreads, numFacets / minFacetsPerThread));
+
+    // build up an array of edges
+    MeshCore::parallel_for(
+        numFacets,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                FacetIndex facet = index + i;
+                const MeshFacet& rFace = this->_aclFacetArray[facet];
+                for (int j = 0; j < 3; j++) {
+                    Edge_Index& item = edges[3 * i + j];
+                    item.p0 = std::min<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j + 1) % 3]);
+                    item.p1 = std::max<PointIndex>(rFace._aulPoints[j], rFace._aulPoints[(j + 1) % 3]);
+                    item.f = facet;
+                }
             }
+        },
+        threads
+    );
 
-            p0 = pE->p0;
-            p1 = pE->p1;
-            f0 = pE->f;
-            count = 1;
+    // sort the edges
+    // std::sort(edges.begin(), edges.end(), Edge_Less());
+    MeshCore::parallel_sort(edges.begin(), edges.end(), Edge_Less(), hardwareThreads);
+
+    // Split the edges into chunks without separating equal edges. As each side of a facet has
+    // exactly one edge the chunks can be handled in parallel.
+    std::size_t chunks = std::max(threads, 1);
+    std::vector<std::size_t> bounds(chunks + 1, edges.size());
+    bounds[0] = 0;
+    for (std::size_t i = 1; i < chunks; i++) {
+        std::size_t pos = std::max(bounds[i - 1], i * edges.size() / chunks);
+        while (pos > 0 && pos < edges.size() && edges[pos - 1].p0 == edges[pos].p0
+               && edges[pos - 1].p1 == edges[pos].p1) {
+            pos++;
         }
+        bounds[i] = pos;
     }
 
-    // we handle only the cases for 1 and 2, for all higher
-    // values we have a non-manifold that is ignored here
-    if (count == 2) {
-        MeshFacet& rFace0 = this->_aclFacetArray[f0];
-        MeshFacet& rFace1 = this->_aclFacetArray[f1];
-        unsigned short side0 = rFace0.Side(p0, p1);
-        unsigned short side1 = rFace1.Side(p0, p1);
-        rFace0._aulNeighbours[side0] = f1;
-        rFace1._aulNeighbours[side1] = f0;
-    }
-    else if (count == 1) {
-        MeshFacet& rFace = this->_aclFacetArray[f0];
-        unsigned short side = rFace.Side(p0, p1);
-        rFace._aulNeighbours[side] = FACET_INDEX_MAX;
-    }
+    MeshCore::parallel_for(
+        chunks,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                setNeighbours(
+                    this->_aclFacetArray,
+                    edges.data() + bounds[i],
+                    edges.data() + bounds[i + 1]
+                );
+            }
+        },
+        int(chunks)
+    );
 }
 
 void MeshKernel::RebuildNeighbours()
@@ -25,7 +25,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -61,4 +63,27 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/** Splits the range [0, count) into \a threads consecutive chunks and calls \a func(begin, end)
+ * for each chunk in its own thread. */
+template<class Func>
+static void parallel_for(std::size_t count, Func func, int threads)
+{
+    std::size_t chunks = std::min<std::size_t>(std::max<int>(threads, 1), count);
+    if (chunks < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::size_t chunkSize = (count + chunks - 1) / chunks;
+    std::vector<std::future<void>> futures;
+    for (std::size_t begin = chunkSize; begin < count; begin += chunkSize) {
+        std::size_t end = std::min(begin + chunkSize, count);
+        futures.push_back(std::async(std::launch::async, [&func, begin, end]() { func(begin, end); }));
+    }
+    func(std::size_t(0), chunkSize);
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 }  // namespace MeshCore
@@ -24,10 +24,13 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
+#include <thread>
 
 #include "Algorithm.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
@@ -71,7 +74,8 @@ void MeshGrid::Attach(const MeshKernel& rclM)
 
 void MeshGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulGridOffsets.clear();
+    _aulGridElements.clear();
     _pclMesh = nullptr;
 }
 
@@ -128,14 +132,70 @@ void MeshGrid::InitGrid()
         }
     }
 
-    // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
+    // Create data structure with empty grids
+    std::size_t ulCtGrids = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+    _aulGridOffsets.assign(ulCtGrids + 1, 0);
+    _aulGridElements.clear();
+}
+
+void MeshGrid::FillGrid()
+{
+    std::size_t ulCtGrids = std::size_t(_ulCtGridsX) * _ulCtGridsY * _ulCtGridsZ;
+    std::size_t ulCtElements = HasElements();
+    // for small meshes starting the threads takes longer than filling the grid
+    constexpr std::size_t minElementsPerThread = 10000;
+    int threads = std::min<int>(
+        int(std::thread::hardware_concurrency()),
+        int(ulCtElements / minElementsPerThread)
+    );
+
+    // count the elements of each grid
+    std::vector<std::atomic<std::size_t>> counts(ulCtGrids);
+    auto countElements = [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> grids;
+        for (std::size_t i = begin; i < end; i++) {
+            grids.clear();
+            GetGrids(ElementIndex(i), grids);
+            for (unsigned long grid : grids) {
+                counts[grid].fetch_add(1, std::memory_order_relaxed);
+            }
         }
+    };
+    parallel_for(ulCtElements, countElements, threads);
+
+    _aulGridOffsets.resize(ulCtGrids + 1);
+    _aulGridOffsets[0] = 0;
+    for (std::size_t i = 0; i < ulCtGrids; i++) {
+        _aulGridOffsets[i + 1] = _aulGridOffsets[i] + counts[i].load(std::memory_order_relaxed);
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+    _aulGridElements.resize(_aulGridOffsets.back());
+
+    // store the elements, the counters are now used as insert positions
+    auto storeElements = [&](std::size_t begin, std::size_t end) {
+        std::vector<unsigned long> grids;
+        for (std::size_t i = begin; i < end; i++) {
+            grids.clear();
+            GetGrids(ElementIndex(i), grids);
+            for (unsigned long grid : grids) {
+                std::size_t pos = counts[grid].fetch_add(1, std::memory_order_relaxed);
+                _aulGridElements[_aulGridOffsets[grid] + pos] = ElementIndex(i);
+            }
+        }
+    };
+    parallel_for(ulCtElements, storeElements, threads);
+
+    // the threads may have stored the elements of a grid in any order
+    if (threads > 1) {
+        auto sortElements = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                std::sort(
+                    _aulGridElements.begin() + std::ptrdiff_t(_aulGridOffsets[i]),
+                    _aulGridElements.begin() + std::ptrdiff_t(_aulGridOffsets[i + 1])
+                );
+            }
+        };
+        parallel_for(ulCtGrids, sortElements, threads);
     }
 }
 
@@ -161,8 +221,8 @@ unsigned long MeshGrid::Inside(
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements
-                    .insert(raulElements.end(), _aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                std::span<const ElementIndex> elements = GetElementSpan(i, j, k);
+                raulElements.insert(raulElements.end(), elements.begin(), elements.end());
             }
         }
     }
@@ -203,11 +263,8 @@ unsigned long MeshGrid::Inside(
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(
-                        raulElements.end(),
-                        _aulGrid[i][j][k].begin(),
-                        _aulGrid[i][j][k].end()
-                    );
+                    std::span<const ElementIndex> elements = GetElementSpan(i, j, k);
+                    raulElements.insert(raulElements.end(), elements.begin(), elements.end());
                 }
             }
         }
@@ -240,7 +297,8 @@ unsigned long MeshGrid::Inside(const Base::BoundBox3f& rclBB, std::set<ElementIn
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                std::span<const ElementIndex> elements = GetElementSpan(i, j, k);
+                raulElements.insert(elements.begin(), elements.end());
             }
         }
     }
@@ -470,7 +528,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(nX, i, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nX++;
@@ -482,7 +541,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nX < _ulCtGridsX) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(nX, i, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nX++;
@@ -494,7 +554,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(i, nY, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nY++;
@@ -506,7 +567,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nY < _ulCtGridsY) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            indices.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(i, nY, j);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nY--;
@@ -518,7 +580,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(i, j, nZ);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nZ++;
@@ -530,7 +593,8 @@ void MeshGrid::SearchNearestFromPoint(const Base::Vector3f& pnt, std::set<Elemen
                 while (indices.empty() && nZ < _ulCtGridsZ) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            indices.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            std::span<const ElementIndex> elements = GetElementSpan(i, j, nZ);
+                            indices.insert(elements.begin(), elements.end());
                         }
                     }
                     nZ--;
@@ -634,10 +698,10 @@ unsigned long MeshGrid::GetElements(
     std::set<ElementIndex>& raclInd
 ) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
+    std::span<const ElementIndex> elements = GetElementSpan(ulX, ulY, ulZ);
+    if (!elements.empty()) {
+        raclInd.insert(elements.begin(), elements.end());
+        return elements.size();
     }
 
     return 0;
@@ -655,9 +719,8 @@ unsigned long MeshGrid::GetElements(
         return 0;
     }
 
-    aulFacets.resize(_aulGrid[ulX][ulY][ulZ].size());
-
-    std::copy(_aulGrid[ulX][ulY][ulZ].begin(), _aulGrid[ulX][ulY][ulZ].end(), aulFacets.begin());
+    std::span<const ElementIndex> elements = GetElementSpan(ulX, ulY, ulZ);
+    aulFacets.assign(elements.begin(), elements.end());
     return aulFacets.size();
 }
 
@@ -774,12 +837,42 @@ void MeshFacetGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-    MeshFacetIterator clFIter(*_pclMesh);
+    FillGrid();
+}
 
-    unsigned long i = 0;
-    for (clFIter.Init(); clFIter.More(); clFIter.Next()) {
-        //    AddFacet(*clFIter, i++, 2.0f);
-        AddFacet(*clFIter, i++);
+void MeshFacetGrid::GetGrids(ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const
+{
+    MeshGeomFacet clFacet = _pclMesh->GetFacet(ulIndex);
+
+    unsigned long ulX1 {};
+    unsigned long ulY1 {};
+    unsigned long ulZ1 {};
+    unsigned long ulX2 {};
+    unsigned long ulY2 {};
+    unsigned long ulZ2 {};
+
+    Base::BoundBox3f clBB;
+    clBB.Add(clFacet._aclPoints[0]);
+    clBB.Add(clFacet._aclPoints[1]);
+    clBB.Add(clFacet._aclPoints[2]);
+
+    Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
+    Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
+
+    // if the facet spans over several grids
+    if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
+        for (unsigned long ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
+            for (unsigned long ulY = ulY1; ulY <= ulY2; ulY++) {
+                for (unsigned long ulX = ulX1; ulX <= ulX2; ulX++) {
+                    if (clFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
+                        raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
+                    }
+                }
+            }
+        }
+    }
+    else {
+        raulGrids.push_back(GetIndexToPosition(ulX1, ulY1, ulZ1));
     }
 }
 
@@ -1028,8 +1121,7 @@ void MeshFacetGrid::SearchNearestFacetInGrid(
     ElementIndex& rulFacetInd
 ) const
 {
-    const std::set<ElementIndex>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    for (ElementIndex pI : rclSet) {
+    for (ElementIndex pI : GetElementSpan(ulX, ulY, ulZ)) {
         float fDist = _pclMesh->GetFacet(pI).DistanceToPoint(rclPt);
         if (fDist < rfMinDist) {
             rfMinDist = fDist;
@@ -1071,15 +1163,15 @@ MeshPointGrid::MeshPointGrid(const MeshKernel& rclM, float fGridLen)
     );
 }
 
-void MeshPointGrid::AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon)
+void MeshPointGrid::GetGrids(ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const
 {
-    (void)fEpsilon;
+    const MeshPoint& rclPt = _pclMesh->GetPoints()[ulIndex];
     unsigned long ulX {};
     unsigned long ulY {};
     unsigned long ulZ {};
     Pos(Base::Vector3f(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
     if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
+        raulGrids.push_back(GetIndexToPosition(ulX, ulY, ulZ));
     }
 }
 
@@ -1136,13 +1228,7 @@ void MeshPointGrid::RebuildGrid()
     InitGrid();
 
     // Fill data structure
-
-    MeshPointIterator cPIter(*_pclMesh);
-
-    unsigned long i = 0;
-    for (cPIter.Init(); cPIter.More(); cPIter.Next()) {
-        AddPoint(*cPIter, i++);
-    }
+    FillGrid();
 }
 
 void MeshPointGrid::Pos(
@@ -1215,11 +1301,7 @@ bool MeshGridIterator::InitOnRay(
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // Determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(
-            raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
-        );
+        GetElements(raulElements);
         _bValidRay = true;
     }
     else {  // Start point outside
@@ -1234,11 +1316,7 @@ bool MeshGridIterator::InitOnRay(
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(
-                raulElements.end(),
-                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
-            );
+            GetElements(raulElements);
             _bValidRay = true;
         }
     }
@@ -1301,11 +1379,7 @@ bool MeshGridIterator::NextOnRay(std::vector<ElementIndex>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(
-            raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
-        );
+        GetElements(raulElements);
     }
     else {
         _bValidRay = false;  // Beam leaked
@@ -26,6 +26,8 @@
 
 #include <limits>
 #include <set>
+#include <span>
+#include <vector>
 
 #include <Base/BoundBox.h>
 
@@ -53,6 +55,10 @@ static constexpr float MESHGRID_BBOX_EXTENSION = 10.0F;
  *
  * Grids can be used within algorithms to avoid to iterate through all elements,
  * so grids can speed up algorithms dramatically.
+ *
+ * The element indices of all grid elements are packed into one array, where the indices of each
+ * grid element are stored contiguously and in ascending order. An offset array points to the
+ * first index of each grid element.
  */
 class MeshExport MeshGrid
 {
@@ -118,6 +124,13 @@ public:
         std::set<ElementIndex>& raclInd
     ) const;
     unsigned long GetElements(const Base::Vector3f& rclPoint, std::vector<ElementIndex>& aulFacets) const;
+    /** Returns the indices of the elements in the given grid, sorted in ascending order. The span
+     * gets invalid when the grid is rebuilt. */
+    inline std::span<const ElementIndex> GetElementSpan(
+        unsigned long ulX,
+        unsigned long ulY,
+        unsigned long ulZ
+    ) const;
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -161,7 +174,7 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return static_cast<unsigned long>(_aulGrid[ulX][ulY][ulZ].size());
+        return static_cast<unsigned long>(GetElementSpan(ulX, ulY, ulZ).size());
     }
     /** Validates the grid structure and rebuilds it if needed. Must be implemented in sub-classes.
      */
@@ -208,11 +221,20 @@ protected:
     virtual void RebuildGrid() = 0;
     /** Returns the number of stored elements. Must be implemented in sub-classes. */
     virtual unsigned long HasElements() const = 0;
+    /** Appends the indices, as returned by GetIndexToPosition(), of all grids the element \a
+     * ulIndex must be stored in. It is called from several threads at once by FillGrid() and must
+     * not modify the grid. Must be implemented in sub-classes. */
+    virtual void GetGrids(ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const = 0;
+    /** Fills the grid structure with all elements. The grids of each element are determined twice,
+     * once to count the elements of each grid and once to store them, both passes run in
+     * parallel for large meshes. */
+    void FillGrid();
 
 protected:
     // NOLINTBEGIN
-    std::vector<std::vector<std::vector<std::set<ElementIndex>>>> _aulGrid; /**< Grid data structure. */
-    const MeshKernel* _pclMesh;                                             /**< The mesh kernel. */
+    std::vector<std::size_t> _aulGridOffsets;   /**< Offsets of the grids in _aulGridElements. */
+    std::vector<ElementIndex> _aulGridElements; /**< Element indices of all grids. */
+    const MeshKernel* _pclMesh;                 /**< The mesh kernel. */
     unsigned long _ulCtElements; /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;   /**< Number of grid elements in z. */
     unsigned long _ulCtGridsY;   /**< Number of grid elements in z. */
@@ -307,10 +329,8 @@ protected:
         unsigned long& rulY,
         unsigned long& rulZ
     ) const;
-    /** Adds a new facet element to the grid structure. \a rclFacet is the geometric facet and \a
-     * ulFacetIndex the corresponding index in the mesh kernel. The facet is added to each grid
-     * element that intersects the facet. */
-    inline void AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float fEpsilon = 0.0F);
+    /** Appends the grids the facet with index \a ulIndex intersects with. */
+    void GetGrids(ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const override;
     /** Returns the number of stored elements. */
     unsigned long HasElements() const override
     {
@@ -357,9 +377,8 @@ public:
     bool Verify() const override;
 
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the mesh kernel. */
-    void AddPoint(const MeshPoint& rclPt, ElementIndex ulPtIndex, float fEpsilon = 0.0F);
+    /** Appends the grid the point with index \a ulIndex lies in. */
+    void GetGrids(ElementIndex ulIndex, std::vector<unsigned long>& raulGrids) const override;
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(
         const Base::Vector3f& rclPoint,
@@ -393,11 +412,8 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<ElementIndex>& raulElements) const
     {
-        raulElements.insert(
-            raulElements.end(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end()
-        );
+        std::span<const ElementIndex> elements = _rclGrid.GetElementSpan(_ulX, _ulY, _ulZ);
+        raulElements.insert(raulElements.end(), elements.begin(), elements.end());
     }
     /** Returns the number of elements in the current grid. */
     unsigned long GetCtElements() const
@@ -538,6 +554,20 @@ inline bool MeshGrid::CheckPos(unsigned long ulX, unsigned long ulY, unsigned lo
     return ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ));
 }
 
+inline std::span<const ElementIndex> MeshGrid::GetElementSpan(
+    unsigned long ulX,
+    unsigned long ulY,
+    unsigned long ulZ
+) const
+{
+    assert(CheckPos(ulX, ulY, ulZ));
+    std::size_t index = (std::size_t(ulZ) * _ulCtGridsY + ulY) * _ulCtGridsX + ulX;
+    return {
+        _aulGridElements.data() + _aulGridOffsets[index],
+        _aulGridElements.data() + _aulGridOffsets[index + 1]
+    };
+}
+
 // --------------------------------------------------------------
 
 inline void MeshFacetGrid::Pos(
@@ -594,57 +624,4 @@ inline void MeshFacetGrid::PosWithCheck(
     assert((rulX < _ulCtGridsX) && (rulY < _ulCtGridsY) && (rulZ < _ulCtGridsZ));
 }
 
-inline void MeshFacetGrid::AddFacet(const MeshGeomFacet& rclFacet, ElementIndex ulFacetIndex, float /*fEpsilon*/)
-{
-    unsigned long ulX {};
-    unsigned long ulY {};
-    unsigned long ulZ {};
-
-    unsigned long ulX1 {};
-    unsigned long ulY1 {};
-    unsigned long ulZ1 {};
-    unsigned long ulX2 {};
-    unsigned long ulY2 {};
-    unsigned long ulZ2 {};
-
-    Base::BoundBox3f clBB;
-
-    clBB.Add(rclFacet._aclPoints[0]);
-    clBB.Add(rclFacet._aclPoints[1]);
-    clBB.Add(rclFacet._aclPoints[2]);
-
-    // float fDiagonalLength = clBB.CalcDiagonalLength();
-
-    // clBB.Enlarge(fEpsilon*fDiagonalLength);
-
-    Pos(Base::Vector3f(clBB.MinX, clBB.MinY, clBB.MinZ), ulX1, ulY1, ulZ1);
-    Pos(Base::Vector3f(clBB.MaxX, clBB.MaxY, clBB.MaxZ), ulX2, ulY2, ulZ2);
-
-    /*
-    if (ulX1 > 0) ulX1--;
-    if (ulY1 > 0) ulY1--;
-    if (ulZ1 > 0) ulZ1--;
-
-    if (ulX2 < (_ulCtGridsX-1)) ulX2++;
-    if (ulY2 < (_ulCtGridsY-1)) ulY2++;
-    if (ulZ2 < (_ulCtGridsZ-1)) ulZ2++;
-    */
-
-    // falls Facet ueber mehrere BB reicht
-    if ((ulX1 < ulX2) || (ulY1 < ulY2) || (ulZ1 < ulZ2)) {
-        for (ulX = ulX1; ulX <= ulX2; ulX++) {
-            for (ulY = ulY1; ulY <= ulY2; ulY++) {
-                for (ulZ = ulZ1; ulZ <= ulZ2; ulZ++) {
-                    if (rclFacet.IntersectBoundingBox(GetBoundBox(ulX, ulY, ulZ))) {
-                        _aulGrid[ulX][ulY][ulZ].insert(ulFacetIndex);
-                    }
-                }
-            }
-        }
-    }
-    else {
-        _aulGrid[ulX1][ulY1][ulZ1].insert(ulFacetIndex);
-    }
-}
-
 }  // namespace MeshCore
@@ -21,10 +21,16 @@
  *                                                                         *
  **************************************************************************/
 
+#include <array>
+#include <atomic>
+#include <bit>
 #include <boost/lexical_cast.hpp>
+#include <cstring>
 #include <istream>
+#include <thread>
 
 
+#include "Core/Functional.h"
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
 #include <Base/Stream.h>
@@ -35,6 +41,50 @@
 
 using namespace MeshCore;
 
+namespace
+{
+/// Read-only stream buffer over a block of memory
+class MemoryStreambuf: public std::streambuf
+{
+public:
+    MemoryStreambuf(const char* data, std::size_t size)
+    {
+        // the buffer is only read
+        char* begin = const_cast<char*>(data);  // NOLINT
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode /*mode*/) override
+    {
+        char* pos = gptr();
+        if (way == std::ios_base::beg) {
+            pos = eback();
+        }
+        else if (way == std::ios_base::end) {
+            pos = egptr();
+        }
+        if (off < eback() - pos || off > egptr() - pos) {
+            return {off_type(-1)};
+        }
+        setg(eback(), pos + off, egptr());
+        return {gptr() - eback()};
+    }
+    pos_type seekpos(pos_type pos, std::ios_base::openmode mode) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, mode);
+    }
+};
+
+template<typename T>
+float readValue(const char* data)
+{
+    T value {};
+    std::memcpy(&value, data, sizeof(T));
+    return static_cast<float>(value);
+}
+}  // namespace
+
 // http://local.wasp.uwa.edu.au/~pbourke/dataformats/ply/
 ReaderPLY::ReaderPLY(MeshKernel& kernel, Material* material)
     : _kernel(kernel)
@@ -302,6 +352,48 @@ bool ReaderPLY::ReadHeader(std::istream& input)
     return true;
 }
 
+std::size_t ReaderPLY::sizeOfNumber(Number number)
+{
+    switch (number) {
+        case int8:
+        case uint8:
+            return 1;
+        case int16:
+        case uint16:
+            return 2;
+        case int32:
+        case uint32:
+        case float32:
+            return 4;
+        case float64:
+            return 8;
+    }
+    return 0;
+}
+
+float ReaderPLY::readNumber(const char* data, Number number)
+{
+    switch (number) {
+        case int8:
+            return readValue<int8_t>(data);
+        case uint8:
+            return readValue<uint8_t>(data);
+        case int16:
+            return readValue<int16_t>(data);
+        case uint16:
+            return readValue<uint16_t>(data);
+        case int32:
+            return readValue<int32_t>(data);
+        case uint32:
+            return readValue<uint32_t>(data);
+        case float32:
+            return readValue<float>(data);
+        case float64:
+            return readValue<double>(data);
+    }
+    return 0.0F;
+}
+
 bool ReaderPLY::VerifyVertexProperty()
 {
     // check if valid 3d points
@@ -367,26 +459,52 @@ bool ReaderPLY::VerifyColorProperty()
 
 bool ReaderPLY::Load(std::istream& input)
 {
-    if (!CheckHeader(input)) {
+    if (!LoadHeader(input)) {
         return false;
     }
 
-    if (!ReadHeader(input)) {
+    // clang-format off
+    return format == ascii ? LoadAscii(input)
+                           : LoadBinary(input);
+    // clang-format on
+}
+
+bool ReaderPLY::Load(const char* data, std::size_t size)
+{
+    MemoryStreambuf buf(data, size);
+    std::istream input(&buf);
+    if (!LoadHeader(input)) {
         return false;
     }
 
-    if (!VerifyVertexProperty()) {
+    if (format == ascii) {
+        return LoadAscii(input);
+    }
+
+    std::streamoff offset = input.tellg();
+    if (offset > 0 && LoadBinary(data + offset, size - std::size_t(offset))) {
+        return true;
+    }
+
+    input.seekg(offset);
+    return LoadBinary(input);
+}
+
+bool ReaderPLY::LoadHeader(std::istream& input)
+{
+    if (!CheckHeader(input)) {
+        return false;
+    }
+
+    if (!ReadHeader(input)) {
         return false;
     }
 
-    if (!VerifyColorProperty()) {
+    if (!VerifyVertexProperty()) {
         return false;
     }
 
-    // clang-format off
-    return format == ascii ? LoadAscii(input)
-                           : LoadBinary(input);
-    // clang-format on
+    return VerifyColorProperty();
 }
 
 void ReaderPLY::CleanupMesh()
@@ -660,3 +778,97 @@ bool ReaderPLY::LoadBinary(std::istream& input)
     CleanupMesh();
     return true;
 }
+
+bool ReaderPLY::LoadBinary(const char* data, std::size_t size)
+{
+    // The vertexes and faces are read in parallel directly from the data. This is only possible if
+    // the byte order matches and all records have a fixed size, i.e. all faces are triangles
+    // without further properties.
+    bool little_endian = std::endian::native == std::endian::little;
+    if ((format == binary_little_endian) != little_endian || !face_props.empty()) {
+        return false;
+    }
+
+    struct VertexProperty
+    {
+        Property property;
+        Number number;
+        std::size_t offset;
+    };
+    std::vector<VertexProperty> props;
+    std::size_t v_size = 0;
+    for (const auto& it : vertex_props) {
+        props.push_back({it.first, it.second, v_size});
+        v_size += sizeOfNumber(it.second);
+    }
+
+    // the number of indices as uchar followed by three uint32 indices
+    const std::size_t f_size = 1 + 3 * sizeof(uint32_t);
+    if (size != v_count * v_size + f_count * f_size) {
+        return false;
+    }
+
+    bool colors = _material && _material->binding == MeshIO::PER_VERTEX;
+    meshPoints.resize(v_count);
+    if (colors) {
+        _material->diffuseColor.resize(v_count);
+    }
+
+    constexpr std::size_t minItemsPerThread = 10000;
+    int threads = int(std::thread::hardware_concurrency());
+    parallel_for(
+        v_count,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                const char* vertex = data + i * v_size;
+                PropertyArray prop_values {};
+                for (const auto& it : props) {
+                    prop_values[it.property] = readNumber(vertex + it.offset, it.number);
+                }
+                meshPoints[i].Set(prop_values[coord_x], prop_values[coord_y], prop_values[coord_z]);
+                if (colors) {
+                    // NOLINTBEGIN
+                    float r = (prop_values[color_r]) / 255.0F;
+                    float g = (prop_values[color_g]) / 255.0F;
+                    float b = (prop_values[color_b]) / 255.0F;
+                    // NOLINTEND
+                    _material->diffuseColor[i] = Base::Color(r, g, b);
+                }
+            }
+        },
+        int(std::min<std::size_t>(threads, v_count / minItemsPerThread))
+    );
+
+    // facets with invalid indices are removed in CleanupMesh()
+    const char* faces = data + v_count * v_size;
+    std::atomic<bool> triangles {true};
+    meshFacets.resize(f_count);
+    parallel_for(
+        f_count,
+        [&](std::size_t begin, std::size_t end) {
+            std::array<uint32_t, 3> indices {};
+            for (std::size_t i = begin; i < end; i++) {
+                const char* face = faces + i * f_size;
+                if (static_cast<unsigned char>(face[0]) != 3) {
+                    triangles = false;
+                    return;
+                }
+                std::memcpy(indices.data(), face + 1, sizeof(indices));
+                meshFacets[i].SetVertices(indices[0], indices[1], indices[2]);
+            }
+        },
+        int(std::min<std::size_t>(threads, f_count / minItemsPerThread))
+    );
+
+    if (!triangles) {
+        meshPoints.clear();
+        meshFacets.clear();
+        if (colors) {
+            _material->diffuseColor.clear();
+        }
+        return false;
+    }
+
+    CleanupMesh();
+    return true;
+}
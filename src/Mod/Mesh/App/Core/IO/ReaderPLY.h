@@ -52,8 +52,14 @@ public:
      * \return true on success and false otherwise
      */
     bool Load(std::istream& input);
+    /*!
+     * \brief Load the mesh from the file content \a data of \a size bytes
+     * \return true on success and false otherwise
+     */
+    bool Load(const char* data, std::size_t size);
 
 private:
+    bool LoadHeader(std::istream& input);
     bool CheckHeader(std::istream& input) const;
     bool ReadHeader(std::istream& input);
     bool VerifyVertexProperty();
@@ -69,6 +75,7 @@ private:
     bool ReadFaces(Base::InputStream& is);
     bool LoadAscii(std::istream& input);
     bool LoadBinary(std::istream& input);
+    bool LoadBinary(const char* data, std::size_t size);
     void CleanupMesh();
 
 private:
@@ -100,6 +107,9 @@ private:
         float64
     };
 
+    static std::size_t sizeOfNumber(Number number);
+    static float readNumber(const char* data, Number number);
+
     struct PropertyComp
     {
         using argument_type_1st = std::pair<Property, int>;
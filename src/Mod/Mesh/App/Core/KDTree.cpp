@@ -26,6 +26,10 @@
 # pragma warning(disable : 4396)
 #endif
 
+#include <algorithm>
+
+#include <Base/Parallel.h>
+
 #include "KDTree.h"
 #include <kdtree++/kdtree.hpp>
 
@@ -83,9 +87,68 @@ using MyKDTree = KDTree::KDTree<3, Point3d>;
 class MeshKDTree::Private
 {
 public:
+    void build(std::vector<Point3d>& points);
+
     MyKDTree kd_tree;
+
+private:
+    using Range = std::pair<std::size_t, std::size_t>;
+    void insert(const std::vector<Point3d>& points, std::size_t begin, std::size_t end);
 };
 
+void MeshKDTree::Private::build(std::vector<Point3d>& points)
+{
+    // Does the same as KDTree::optimise() but partitions the disjoint ranges of a level in
+    // parallel. Inserting the nodes afterwards needs no more comparisons of the points.
+    std::vector<Range> level;
+    if (!points.empty()) {
+        level.emplace_back(0, points.size());
+    }
+    for (int axis = 0; !level.empty(); axis = (axis + 1) % 3) {
+        auto first = points.begin();
+        Base::parallelFor(level.size(), [&](std::size_t index) {
+            auto [begin, end] = level[index];
+            std::nth_element(
+                first + static_cast<std::ptrdiff_t>(begin),
+                first + static_cast<std::ptrdiff_t>(begin + (end - begin) / 2),
+                first + static_cast<std::ptrdiff_t>(end),
+                [axis](const Point3d& lhs, const Point3d& rhs) { return lhs[axis] < rhs[axis]; }
+            );
+        });
+
+        std::vector<Range> next;
+        next.reserve(2 * level.size());
+        for (auto [begin, end] : level) {
+            std::size_t mid = begin + (end - begin) / 2;
+            if (mid - begin > 1) {
+                next.emplace_back(begin, mid);
+            }
+            if (end - mid > 2) {
+                next.emplace_back(mid + 1, end);
+            }
+        }
+        level.swap(next);
+    }
+
+    kd_tree.clear();
+    insert(points, 0, points.size());
+}
+
+void MeshKDTree::Private::insert(
+    const std::vector<Point3d>& points,
+    std::size_t begin,
+    std::size_t end
+)
+{
+    if (begin == end) {
+        return;
+    }
+    std::size_t mid = begin + (end - begin) / 2;
+    kd_tree.insert(points[mid]);
+    insert(points, begin, mid);
+    insert(points, mid + 1, end);
+}
+
 MeshKDTree::MeshKDTree()
     : d(new Private)
 {}
@@ -93,24 +156,40 @@ MeshKDTree::MeshKDTree()
 MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    Build(points);
 }
 
 MeshKDTree::MeshKDTree(const MeshPointArray& points)
     : d(new Private)
 {
+    Build(points);
+}
+
+MeshKDTree::~MeshKDTree()
+{
+    delete d;
+}
+
+void MeshKDTree::Build(std::span<const Base::Vector3f> points)
+{
+    std::vector<Point3d> data;
+    data.reserve(points.size());
     PointIndex index = 0;
     for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
+        data.emplace_back(it, index++);
     }
+    d->build(data);
 }
 
-MeshKDTree::~MeshKDTree()
+void MeshKDTree::Build(const MeshPointArray& points)
 {
-    delete d;
+    std::vector<Point3d> data;
+    data.reserve(points.size());
+    PointIndex index = 0;
+    for (const auto& it : points) {
+        data.emplace_back(it, index++);
+    }
+    d->build(data);
 }
 
 void MeshKDTree::AddPoint(const Base::Vector3f& point)
@@ -182,6 +261,20 @@ PointIndex MeshKDTree::FindNearest(
     return index;
 }
 
+void MeshKDTree::FindNearest(
+    std::span<const Base::Vector3f> points,
+    float max_dist,
+    std::vector<PointIndex>& indices
+) const
+{
+    indices.resize(points.size());
+    Base::parallelFor(points.size(), [&](std::size_t index) {
+        Base::Vector3f n;
+        float dist {};
+        indices[index] = FindNearest(points[index], max_dist, n, dist);
+    });
+}
+
 PointIndex MeshKDTree::FindExact(const Base::Vector3f& p) const
 {
     MyKDTree::const_iterator it = d->kd_tree.find_exact(Point3d(p, 0));
@@ -201,3 +294,16 @@ void MeshKDTree::FindInRange(const Base::Vector3f& p, float range, std::vector<P
         indices.push_back(it.i);
     }
 }
+
+void MeshKDTree::FindInRange(
+    std::span<const Base::Vector3f> points,
+    float range,
+    std::vector<std::vector<PointIndex>>& indices
+) const
+{
+    indices.clear();
+    indices.resize(points.size());
+    Base::parallelFor(points.size(), [&](std::size_t index) {
+        FindInRange(points[index], range, indices[index]);
+    });
+}
@@ -25,31 +25,85 @@
 
 #pragma once
 
+#include <span>
+
 #include "Elements.h"
 
 namespace MeshCore
 {
 
+/**
+ * The MeshKDTree is a kd-tree over points that returns the indices of the points in the order
+ * they were added. The constructors and Build() create a balanced tree at once, AddPoint() and
+ * AddPoints() insert the points one by one, which may unbalance the tree until Optimize() is
+ * called.
+ *
+ * All query methods are const and may be called from several threads at the same time, as long
+ * as no thread modifies the tree.
+ */
 class MeshExport MeshKDTree
 {
 public:
+    /// Construction of an empty tree
     MeshKDTree();
+    /// Builds a balanced tree over \a points
     explicit MeshKDTree(const std::vector<Base::Vector3f>& points);
+    /// Builds a balanced tree over \a points
     explicit MeshKDTree(const MeshPointArray& points);
     ~MeshKDTree();
 
+    /** @name Construction */
+    //@{
+    /** Replaces the points of the tree with \a points. The points are split at the median of
+     * each level, so the tree is balanced. The partitioning of the subtrees of a level runs in
+     * parallel.
+     */
+    void Build(std::span<const Base::Vector3f> points);
+    /// \overload
+    void Build(const MeshPointArray& points);
     void AddPoint(const Base::Vector3f& point);
     void AddPoints(const std::vector<Base::Vector3f>& points);
     void AddPoints(const MeshPointArray& points);
+    //@}
 
     bool IsEmpty() const;
     void Clear();
+    /// Rebalances the tree after points were added with AddPoint() or AddPoints()
     void Optimize();
 
+    /** @name Queries */
+    //@{
+    /** Returns the index of the point nearest to \a p and sets \a n to the point and the last
+     * argument to its distance. Returns POINT_INDEX_MAX if the tree is empty.
+     */
     PointIndex FindNearest(const Base::Vector3f& p, Base::Vector3f& n, float&) const;
+    /** Returns the index of the point nearest to \a p within the distance \a max_dist and sets
+     * \a n to the point and the last argument to its distance. Returns POINT_INDEX_MAX if there
+     * is no such point.
+     */
     PointIndex FindNearest(const Base::Vector3f& p, float max_dist, Base::Vector3f& n, float&) const;
+    /** Sets \a indices to the index of the nearest point within \a max_dist for each of
+     * \a points, or to POINT_INDEX_MAX if there is no such point. The points are processed in
+     * parallel.
+     */
+    void FindNearest(
+        std::span<const Base::Vector3f> points,
+        float max_dist,
+        std::vector<PointIndex>& indices
+    ) const;
+    /// Returns the index of a point equal to \a p, or POINT_INDEX_MAX if there is none
     PointIndex FindExact(const Base::Vector3f& p) const;
+    /// Appends the indices of all points within the given range of the point to the vector
     void FindInRange(const Base::Vector3f&, float, std::vector<PointIndex>&) const;
+    /** Sets \a indices to the indices of the points within \a range of each of \a points. The
+     * points are processed in parallel.
+     */
+    void FindInRange(
+        std::span<const Base::Vector3f> points,
+        float range,
+        std::vector<std::vector<PointIndex>>& indices
+    ) const;
+    //@}
 
     MeshKDTree(const MeshKDTree&) = delete;
     MeshKDTree(MeshKDTree&&) = delete;
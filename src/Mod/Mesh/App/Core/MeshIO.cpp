@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
@@ -35,6 +36,7 @@
 #include <boost/convert/spirit.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
+#include <QFile>
 
 #include "IO/Reader3MF.h"
 #include "IO/ReaderOBJ.h"
@@ -140,6 +142,60 @@ private:
     Base::ifstream str;
 };
 
+// Maps the content of a file into memory, so that it can be parsed without copying it first.
+class MappedFile
+{
+public:
+    explicit MappedFile(const Base::FileInfo& fi)
+        : file(QString::fromStdString(fi.filePath()))
+    {
+        if (file.open(QIODevice::ReadOnly) && file.size() > 0) {
+            content = file.map(0, file.size());
+        }
+    }
+
+    const char* data() const
+    {
+        return reinterpret_cast<const char*>(content);  // NOLINT
+    }
+
+    std::size_t size() const
+    {
+        return content ? std::size_t(file.size()) : 0;
+    }
+
+private:
+    QFile file;
+    uchar* content {nullptr};
+};
+
+// Checks the bytes after the header of an STL file for keywords of the ASCII format
+bool hasAsciiSTLKeywords(char* szBuf)
+{
+    boost::algorithm::to_upper(szBuf);
+    return strstr(szBuf, "SOLID") || strstr(szBuf, "FACET") || strstr(szBuf, "NORMAL")
+        || strstr(szBuf, "VERTEX") || strstr(szBuf, "ENDFACET") || strstr(szBuf, "ENDLOOP");
+}
+
+// Checks the same as MeshInput::LoadSTL() if the file content is a binary STL
+bool isBinarySTL(const char* data, std::size_t size)
+{
+    uint32_t ulCt {};
+    if (size < 80 + sizeof(ulCt)) {
+        return false;
+    }
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+    std::size_t ulBytes = ulCt > 1 ? 100 : 50;
+    if (size < 80 + sizeof(ulCt) + ulBytes) {
+        return false;
+    }
+
+    char szBuf[101];
+    std::memcpy(szBuf, data + 80 + sizeof(ulCt), ulBytes);
+    szBuf[ulBytes] = 0;
+    return !hasAsciiSTLKeywords(szBuf);
+}
+
 }  // namespace MeshCore
 
 // --------------------------------------------------------------
@@ -241,7 +297,13 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
-        ok = LoadSTL(str);
+        MappedFile file(fi);
+        if (isBinarySTL(file.data(), file.size())) {
+            ok = LoadBinarySTL(file.data(), file.size());
+        }
+        else {
+            ok = LoadSTL(str);
+        }
     }
     else if (fi.hasExtension("iv")) {
         ok = LoadInventor(str);
@@ -271,7 +333,13 @@ bool MeshInput::LoadAny(const char* FileName)
         ok = LoadOFF(str);
     }
     else if (fi.hasExtension("ply")) {
-        ok = LoadPLY(str);
+        MappedFile file(fi);
+        if (file.data()) {
+            ok = LoadPLY(file.data(), file.size());
+        }
+        else {
+            ok = LoadPLY(str);
+        }
     }
     else {
         throw Base::FileException("File extension not supported", FileName);
@@ -345,11 +413,9 @@ bool MeshInput::LoadSTL(std::istream& input)
         return (ulCt == 0);
     }
     szBuf[ulBytes] = 0;
-    boost::algorithm::to_upper(szBuf);
 
     try {
-        if (!strstr(szBuf, "SOLID") && !strstr(szBuf, "FACET") && !strstr(szBuf, "NORMAL")
-            && !strstr(szBuf, "VERTEX") && !strstr(szBuf, "ENDFACET") && !strstr(szBuf, "ENDLOOP")) {
+        if (!hasAsciiSTLKeywords(szBuf)) {
             // probably binary STL
             buf->pubseekoff(0, std::ios::beg, std::ios::in);
             return LoadBinarySTL(input);
@@ -667,6 +733,12 @@ bool MeshInput::LoadPLY(std::istream& input)
     return reader.Load(input);
 }
 
+bool MeshInput::LoadPLY(const char* data, std::size_t size)
+{
+    ReaderPLY reader(this->_rclMesh, this->_material);
+    return reader.Load(data, size);
+}
+
 bool MeshInput::LoadMeshNode(std::istream& input)
 {
     boost::regex rx_p(
@@ -867,6 +939,38 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
     return true;
 }
 
+bool MeshInput::LoadBinarySTL(const char* data, std::size_t size)
+{
+    constexpr std::size_t headerSize = 80 + sizeof(uint32_t);
+    constexpr std::size_t facetSize = 50;
+    if (size < headerSize) {
+        return false;
+    }
+
+    uint32_t ulCt {};
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+    if (ulCt > (size - headerSize) / facetSize) {
+        return false;  // not a valid STL file
+    }
+
+    MeshFastBuilder builder(this->_rclMesh);
+    builder.AddFacets(
+        MeshFastBuilder::size_type(ulCt),
+        [data](MeshFastBuilder::size_type index, Base::Vector3f* points) {
+            // the normal followed by the three points
+            float coords[12];
+            std::memcpy(coords, data + headerSize + std::size_t(index) * facetSize, sizeof(coords));
+            // same order as LoadBinarySTL(std::istream&)
+            points[0].Set(coords[9], coords[10], coords[11]);
+            points[1].Set(coords[3], coords[4], coords[5]);
+            points[2].Set(coords[6], coords[7], coords[8]);
+        }
+    );
+    builder.Finish();
+
+    return true;
+}
+
 /** Loads the mesh object from an XML file. */
 void MeshInput::LoadXML(Base::XMLReader& reader)
 {
@@ -132,6 +132,9 @@ public:
     bool LoadAsciiSTL(std::istream& input);
     /** Loads a binary STL file. */
     bool LoadBinarySTL(std::istream& input);
+    /** Loads a binary STL file from its content \a data of \a size bytes. The facets are read in
+     * parallel. */
+    bool LoadBinarySTL(const char* data, std::size_t size);
     /** Loads an OBJ Mesh file. */
     bool LoadOBJ(std::istream& input);
     /** Loads an OBJ Mesh file. */
@@ -142,6 +145,9 @@ public:
     bool LoadOFF(std::istream& input);
     /** Loads a PLY Mesh file. */
     bool LoadPLY(std::istream& input);
+    /** Loads a PLY Mesh file from its content \a data of \a size bytes. The elements of binary
+     * files are read in parallel. */
+    bool LoadPLY(const char* data, std::size_t size);
     /** Loads the mesh object from an XML file. */
     void LoadXML(Base::XMLReader& reader);
     /** Loads the mesh object from a 3MF file. */
@@ -24,6 +24,8 @@
 
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 #include <limits>
 #include <map>
@@ -876,47 +878,160 @@ MeshFacetArray MeshKernel::GetFacets(const std::vector<FacetIndex>& indices) con
     return ary;
 }
 
+namespace
+{
+constexpr uint32_t meshMagic = 0xA0B0C0D0;
+// Field by field, with a 256 byte info block
+constexpr uint32_t meshVersionStream = 0x010000;
+// Little-endian blocks: 48 byte header with the counts and the bounding box, the points as three
+// floats, padding to a multiple of 8 bytes, the facets as three point and three neighbour indices
+constexpr uint32_t meshVersionBlocks = 0x020000;
+constexpr uint32_t openEdge = 0xffffffff;
+// Number of points or facets converted at once, so that there is no second copy of the mesh
+constexpr std::size_t blockChunk = 1 << 16;
+
+template<typename T>
+void writeBlock(std::ostream& out, std::vector<T>& data)
+{
+    if constexpr (std::endian::native == std::endian::big) {
+        for (auto& value : data) {
+            Base::SwapEndian(value);
+        }
+    }
+    auto size = std::streamsize(data.size() * sizeof(T));
+    out.write(reinterpret_cast<const char*>(data.data()), size);
+}
+
+template<typename T>
+void readBlock(std::istream& in, std::vector<T>& data)
+{
+    auto size = std::streamsize(data.size() * sizeof(T));
+    in.read(reinterpret_cast<char*>(data.data()), size);
+    if (in.gcount() != size) {
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+    if constexpr (std::endian::native == std::endian::big) {
+        for (auto& value : data) {
+            Base::SwapEndian(value);
+        }
+    }
+}
+}  // namespace
+
 void MeshKernel::Write(std::ostream& rclOut) const
 {
     if (!rclOut || rclOut.bad()) {
         return;
     }
 
-    Base::OutputStream str(rclOut);
-
-    // Write a header with a "magic number" and a version
-    str << static_cast<uint32_t>(0xA0B0C0D0);
-    str << static_cast<uint32_t>(0x010000);
+    std::vector<uint32_t> ident {meshMagic, meshVersionBlocks};
+    writeBlock(rclOut, ident);
+    std::vector<uint64_t> counts {CountPoints(), CountFacets()};
+    writeBlock(rclOut, counts);
+    std::vector<float> box {
+        _clBoundBox.MinX,
+        _clBoundBox.MaxX,
+        _clBoundBox.MinY,
+        _clBoundBox.MaxY,
+        _clBoundBox.MinZ,
+        _clBoundBox.MaxZ,
+    };
+    writeBlock(rclOut, box);
+
+    std::vector<float> coords;
+    for (std::size_t start = 0; start < _aclPointArray.size(); start += blockChunk) {
+        std::size_t end = std::min(start + blockChunk, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t i = start; i < end; ++i) {
+            const auto& point = _aclPointArray[i];
+            coords.insert(coords.end(), {point.x, point.y, point.z});
+        }
+        writeBlock(rclOut, coords);
+    }
+    if (_aclPointArray.size() % 2 != 0) {
+        std::vector<uint32_t> padding {0};
+        writeBlock(rclOut, padding);
+    }
+
+    auto index = [](ElementIndex value) {
+        return value < openEdge ? static_cast<uint32_t>(value) : openEdge;
+    };
+    std::vector<uint32_t> indices;
+    for (std::size_t start = 0; start < _aclFacetArray.size(); start += blockChunk) {
+        std::size_t end = std::min(start + blockChunk, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t i = start; i < end; ++i) {
+            const auto& facet = _aclFacetArray[i];
+            for (auto point : facet._aulPoints) {
+                indices.push_back(index(point));
+            }
+            for (auto neighbour : facet._aulNeighbours) {
+                indices.push_back(index(neighbour));
+            }
+        }
+        writeBlock(rclOut, indices);
+    }
+}
 
-    char szInfo[257];  // needs an additional byte for zero-termination
-    strcpy(
-        szInfo,
-        "MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-"
-        "MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-"
-        "MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-"
-        "MESH-MESH-MESH-\n"
-    );
-    rclOut.write(szInfo, 256);
+void MeshKernel::ReadBlocks(std::istream& rclIn)
+{
+    std::vector<uint64_t> counts(2);
+    readBlock(rclIn, counts);
+    // indices are stored with 32 bits, with the maximum marking an open edge
+    if (counts[0] >= openEdge || counts[1] >= openEdge) {
+        throw Base::BadFormatError("Invalid data structure");
+    }
+    auto numPoints = static_cast<std::size_t>(counts[0]);
+    auto numFacets = static_cast<std::size_t>(counts[1]);
+    std::vector<float> box(6);
+    readBlock(rclIn, box);
+
+    try {
+        MeshPointArray pointArray(numPoints);
+        std::vector<float> coords;
+        for (std::size_t start = 0; start < numPoints; start += blockChunk) {
+            std::size_t end = std::min(start + blockChunk, numPoints);
+            coords.resize(3 * (end - start));
+            readBlock(rclIn, coords);
+            for (std::size_t i = start; i < end; ++i) {
+                const float* xyz = &coords[3 * (i - start)];
+                pointArray[i].Set(xyz[0], xyz[1], xyz[2]);
+            }
+        }
+        if (numPoints % 2 != 0) {
+            std::vector<uint32_t> padding(1);
+            readBlock(rclIn, padding);
+        }
 
-    // write the number of points and facets
-    str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
+        MeshFacetArray facetArray(numFacets);
+        std::vector<uint32_t> indices;
+        for (std::size_t start = 0; start < numFacets; start += blockChunk) {
+            std::size_t end = std::min(start + blockChunk, numFacets);
+            indices.resize(6 * (end - start));
+            readBlock(rclIn, indices);
+            for (std::size_t i = start; i < end; ++i) {
+                const uint32_t* values = &indices[6 * (i - start)];
+                auto& facet = facetArray[i];
+                for (int j = 0; j < 3; j++) {
+                    // make sure to have valid indices
+                    uint32_t neighbour = values[3 + j];
+                    bool validNeighbour = neighbour < numFacets || neighbour == openEdge;
+                    if (values[j] >= numPoints || !validNeighbour) {
+                        throw Base::BadFormatError("Invalid data structure");
+                    }
+                    facet._aulPoints[j] = values[j];
+                    facet._aulNeighbours[j] = neighbour != openEdge ? neighbour : FACET_INDEX_MAX;
+                }
+            }
+        }
 
-    // write the data
-    for (const auto& it : _aclPointArray) {
-        str << it.x << it.y << it.z;
+        _aclPointArray.swap(pointArray);
+        _aclFacetArray.swap(facetArray);
+        _clBoundBox = Base::BoundBox3f(box[0], box[2], box[4], box[1], box[3], box[5]);
     }
-
-    for (const auto& it : _aclFacetArray) {
-        str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
-            << static_cast<uint32_t>(it._aulPoints[2]);
-        str << static_cast<uint32_t>(it._aulNeighbours[0])
-            << static_cast<uint32_t>(it._aulNeighbours[1])
-            << static_cast<uint32_t>(it._aulNeighbours[2]);
+    catch (std::length_error&) {
+        throw Base::BadFormatError("Reading from stream failed");
     }
-
-    str << _clBoundBox.MinX << _clBoundBox.MaxX;
-    str << _clBoundBox.MinY << _clBoundBox.MaxY;
-    str << _clBoundBox.MinZ << _clBoundBox.MaxZ;
 }
 
 void MeshKernel::Read(std::istream& rclIn)
@@ -931,6 +1046,10 @@ void MeshKernel::Read(std::istream& rclIn)
     // Read the header with a "magic number" and a version
     uint32_t magic {}, version {}, swap_magic {}, swap_version {};
     str >> magic >> version;
+    if (magic == meshMagic && version == meshVersionBlocks) {
+        ReadBlocks(rclIn);
+        return;
+    }
     swap_magic = magic;
     Base::SwapEndian(swap_magic);
     swap_version = version;
@@ -939,10 +1058,10 @@ void MeshKernel::Read(std::istream& rclIn)
 
     // is it the new or old format?
     bool new_format = false;
-    if (magic == 0xA0B0C0D0 && version == 0x010000) {
+    if (magic == meshMagic && version == meshVersionStream) {
         new_format = true;
     }
-    else if (swap_magic == 0xA0B0C0D0 && swap_version == 0x010000) {
+    else if (swap_magic == meshMagic && swap_version == meshVersionStream) {
         new_format = true;
         str.setByteOrder(Base::Stream::BigEndian);
     }
@@ -1115,14 +1234,8 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    _aclPointArray.Transform(rclMat);
+    _clBoundBox = _aclPointArray.GetBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1133,10 +1246,7 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 
 void MeshKernel::RecalcBoundBox() const
 {
-    _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
-    }
+    _clBoundBox = _aclPointArray.GetBoundBox();
 }
 
 std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
@@ -1164,16 +1274,40 @@ std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetI
     std::vector<Base::Vector3f> normals;
     normals.reserve(facets.size());
 
-    for (FacetIndex it : facets) {
-        const MeshFacet& face = _aclFacetArray[it];
+    // The facets are processed block-wise with their edges copied into separate coordinate
+    // arrays, so that the computation of the normals can be vectorized by the compiler.
+    constexpr std::size_t blockSize = 256;
+    std::array<float, blockSize> ux {}, uy {}, uz {}, vx {}, vy {}, vz {};
+    for (std::size_t start = 0; start < facets.size(); start += blockSize) {
+        std::size_t count = std::min(blockSize, facets.size() - start);
+        for (std::size_t i = 0; i < count; i++) {
+            const MeshFacet& face = _aclFacetArray[facets[start + i]];
+            const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
+            const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
+            const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+            ux[i] = p2.x - p1.x;
+            uy[i] = p2.y - p1.y;
+            uz[i] = p2.z - p1.z;
+            vx[i] = p3.x - p1.x;
+            vy[i] = p3.y - p1.y;
+            vz[i] = p3.z - p1.z;
+        }
 
-        const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
-        const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
-        const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+        // the normals replace the first edges, degenerated facets keep a zero normal
+        for (std::size_t i = 0; i < count; i++) {
+            float nx = uy[i] * vz[i] - uz[i] * vy[i];
+            float ny = uz[i] * vx[i] - ux[i] * vz[i];
+            float nz = ux[i] * vy[i] - uy[i] * vx[i];
+            float len = std::sqrt(nx * nx + ny * ny + nz * nz);
+            float div = len != 0.0F ? len : 1.0F;
+            ux[i] = nx / div;
+            uy[i] = ny / div;
+            uz[i] = nz / div;
+        }
 
-        Base::Vector3f n = (p2 - p1) % (p3 - p1);
-        n.Normalize();
-        normals.emplace_back(n);
+        for (std::size_t i = 0; i < count; i++) {
+            normals.emplace_back(ux[i], uy[i], uz[i]);
+        }
     }
 
     return normals;
@@ -78,7 +78,10 @@ public:
 
     /** @name I/O methods */
     //@{
-    /// Binary streaming of data
+    /** Binary streaming of data. Write() stores the points, facets and neighbours as
+     * little-endian blocks, which Read() converts in large chunks. Read() also accepts the
+     * formats written by older versions.
+     */
     void Write(std::ostream& rclOut) const;
     void Read(std::istream& rclIn);
     //@}
@@ -479,6 +482,8 @@ public:
 protected:
     /** Rebuilds the neighbour indices for subset of all facets from index \a index on. */
     void RebuildNeighbours(FacetIndex);
+    /** Reads the block layout of Write() after the magic number and version. */
+    void ReadBlocks(std::istream& rclIn);
     /** Checks if this point is associated to no other facet and deletes if so.
      * The point indices of the facets get adjusted.
      * \a ulIndex is the index of the point to be deleted. \a ulFacetIndex is the index
@@ -28,6 +28,7 @@
 #include <map>
 
 
+#include "BVH.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
@@ -148,12 +149,6 @@ bool MeshProjection::projectLineOnMesh(
     std::vector<Base::Vector3f>& polyline
 )
 {
-    Base::Vector3f dir(v2 - v1);
-    Base::Vector3f base(v1), normal(vd % dir);
-    normal.Normalize();
-    dir.Normalize();
-
-
     std::vector<FacetIndex> facets;
 
     // special case: start and endpoint inside same facet
@@ -175,6 +170,55 @@ bool MeshProjection::projectLineOnMesh(
     std::sort(facets.begin(), facets.end());
     facets.erase(std::unique(facets.begin(), facets.end()), facets.end());
 
+    return cutFacetsWithPlane(facets, v1, f1, v2, f2, vd, polyline);
+}
+
+bool MeshProjection::projectLineOnMesh(
+    const MeshFacetBVH& bvh,
+    const Base::Vector3f& v1,
+    FacetIndex f1,
+    const Base::Vector3f& v2,
+    FacetIndex f2,
+    const Base::Vector3f& vd,
+    std::vector<Base::Vector3f>& polyline
+) const
+{
+    // special case: start and endpoint inside same facet
+    if (f1 == f2) {
+        polyline.push_back(v1);
+        polyline.push_back(v2);
+        return true;
+    }
+
+    // the test holds for every box that encloses a box passing it, so whole subtrees can be skipped
+    std::vector<FacetIndex> facets;
+    bvh.SearchFacets(
+        [&](const Base::BoundBox3f& box) {
+            return bboxInsideRectangle(box, v1, v2, vd);
+        },
+        facets
+    );
+
+    std::sort(facets.begin(), facets.end());
+
+    return cutFacetsWithPlane(facets, v1, f1, v2, f2, vd, polyline);
+}
+
+bool MeshProjection::cutFacetsWithPlane(
+    const std::vector<FacetIndex>& facets,
+    const Base::Vector3f& v1,
+    FacetIndex f1,
+    const Base::Vector3f& v2,
+    FacetIndex f2,
+    const Base::Vector3f& vd,
+    std::vector<Base::Vector3f>& polyline
+) const
+{
+    Base::Vector3f dir(v2 - v1);
+    Base::Vector3f base(v1), normal(vd % dir);
+    normal.Normalize();
+    dir.Normalize();
+
     // cut all facets with plane
     std::list<std::pair<Base::Vector3f, Base::Vector3f>> cutLine;
     for (FacetIndex facet : facets) {
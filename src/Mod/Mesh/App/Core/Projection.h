@@ -40,6 +40,7 @@ class TopoDS_Shape;
 namespace MeshCore
 {
 
+class MeshFacetBVH;
 class MeshFacetGrid;
 class MeshKernel;
 class MeshGeomFacet;
@@ -58,8 +59,30 @@ public:
         const Base::Vector3f& view,
         std::vector<Base::Vector3f>& polyline
     );
+    /**
+     * Does the same as the grid based version but collects the facets to cut from \a bvh. The
+     * hierarchy only needs to be built once for the mesh and can be shared by several threads.
+     */
+    bool projectLineOnMesh(
+        const MeshFacetBVH& bvh,
+        const Base::Vector3f& p1,
+        FacetIndex f1,
+        const Base::Vector3f& p2,
+        FacetIndex f2,
+        const Base::Vector3f& view,
+        std::vector<Base::Vector3f>& polyline
+    ) const;
 
 protected:
+    bool cutFacetsWithPlane(
+        const std::vector<FacetIndex>& facets,
+        const Base::Vector3f& v1,
+        FacetIndex f1,
+        const Base::Vector3f& v2,
+        FacetIndex f2,
+        const Base::Vector3f& vd,
+        std::vector<Base::Vector3f>& polyline
+    ) const;
     bool bboxInsideRectangle(
         const Base::BoundBox3f& bbox,
         const Base::Vector3f& p1,
@@ -26,6 +26,8 @@
 #include <cmath>
 #include <limits>
 
+#include <Base/Parallel.h>
+
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "Segmentation.h"
@@ -531,19 +533,32 @@ bool MeshCurvatureFreeformSegment::TestFacet(const MeshFacet& rclFacet) const
 
 // --------------------------------------------------------
 
-MeshSurfaceVisitor::MeshSurfaceVisitor(MeshSurfaceSegment& segm, std::vector<FacetIndex>& indices)
+MeshSurfaceVisitor::MeshSurfaceVisitor(
+    MeshSurfaceSegment& segm,
+    std::vector<FacetIndex>& indices,
+    const std::vector<char>* accepted
+)
     : indices(indices)
     , segm(segm)
+    , accepted(accepted)
 {}
 
 bool MeshSurfaceVisitor::AllowVisit(
     const MeshFacet& face,
     const MeshFacet&,
-    FacetIndex,
+    FacetIndex index,
     unsigned long,
     unsigned short
 )
 {
+    // Visited facets are skipped anyway, so don't test them. This matters for the fitting
+    // segments, where a test after adding facets refits the surface.
+    if (face.IsFlag(MeshFacet::VISIT)) {
+        return false;
+    }
+    if (accepted) {
+        return (*accepted)[index] != 0;
+    }
     return segm.TestFacet(face);
 }
 
@@ -572,10 +587,19 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
     cAlgo.CountFacetFlag(MeshCore::MeshFacet::VISIT);
     std::vector<FacetIndex> resetVisited;
 
+    std::vector<char> accepted;
     for (auto& it : segm) {
         cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
         resetVisited.clear();
 
+        // test all facets at once if the outcome doesn't depend on the segment grown so far
+        if (it->HasFixedTest()) {
+            accepted.resize(rFAry.size());
+            Base::parallelFor(rFAry.size(), [&](std::size_t index) {
+                accepted[index] = it->TestFacet(rFAry[index]) ? 1 : 0;
+            });
+        }
+
         MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
         iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::VISIT);
@@ -593,7 +617,7 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
             if (it->TestInitialFacet(startFacet)) {
                 indices.push_back(startFacet);
             }
-            MeshSurfaceVisitor pv(*it, indices);
+            MeshSurfaceVisitor pv(*it, indices, it->HasFixedTest() ? &accepted : nullptr);
             myKernel.VisitNeighbourFacets(pv, startFacet);
 
             // add or discard the segment
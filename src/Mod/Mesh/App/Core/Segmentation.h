@@ -55,6 +55,13 @@ public:
     MeshSurfaceSegment& operator=(MeshSurfaceSegment&&) = delete;
 
     virtual bool TestFacet(const MeshFacet& rclFacet) const = 0;
+    /** Returns true if TestFacet() only depends on the facet, not on the facets added to the
+     * segment before. Then the facets are tested in advance and in parallel.
+     */
+    virtual bool HasFixedTest() const
+    {
+        return false;
+    }
     virtual const char* GetType() const = 0;
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
@@ -273,6 +280,10 @@ public:
     {
         return info.at(pos);
     }
+    bool HasFixedTest() const override
+    {
+        return true;
+    }
 
 private:
     const std::vector<CurvatureInfo>& info;
@@ -378,7 +389,12 @@ private:
 class MeshExport MeshSurfaceVisitor: public MeshFacetVisitor
 {
 public:
-    MeshSurfaceVisitor(MeshSurfaceSegment& segm, std::vector<FacetIndex>& indices);
+    /// \a accepted optionally holds the results of TestFacet() for all facets
+    MeshSurfaceVisitor(
+        MeshSurfaceSegment& segm,
+        std::vector<FacetIndex>& indices,
+        const std::vector<char>* accepted = nullptr
+    );
     bool AllowVisit(
         const MeshFacet& face,
         const MeshFacet&,
@@ -391,6 +407,7 @@ public:
 private:
     std::vector<FacetIndex>& indices;
     MeshSurfaceSegment& segm;
+    const std::vector<char>* accepted;
 };
 
 class MeshExport MeshSegmentAlgorithm
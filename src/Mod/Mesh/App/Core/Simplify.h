@@ -12,6 +12,7 @@
 // * Comment out printf statements
 // * Fix compiler warnings
 // * Remove macros loop,i,j,k
+// * Add locked vertices that are never collapsed, used to decimate partitions of a mesh
 
 #include <vector>
 
@@ -82,7 +83,7 @@ class Simplify
 {
 public:
     struct Triangle { int v[3];double err[4];int deleted,dirty;vec3f n; };
-    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border;};
+    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border,locked;};
     struct Ref { int tid,tvertex; };
     std::vector<Triangle> triangles;
     std::vector<Vertex> vertices;
@@ -196,6 +197,10 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
                     if (v0.border != v1.border)
                         continue;
 
+                    // Locked vertices must keep their position
+                    if (v0.locked || v1.locked)
+                        continue;
+
                     // Compute vertex to collapse to
                     vec3f p;
                     calculate_error(i0,i1,p);
@@ -472,10 +477,12 @@ void Simplify::compact_mesh()
     dst=0;
     for (std::size_t i=0;i<vertices.size();++i)
     {
-        if (vertices[i].tcount)
+        // keep locked vertices to preserve their order
+        if (vertices[i].tcount || vertices[i].locked)
         {
             vertices[i].tstart=dst;
             vertices[dst].p=vertices[i].p;
+            vertices[dst].locked=vertices[i].locked;
             dst++;
         }
     }
@@ -0,0 +1,492 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Sequencer.h>
+#include <Base/Stream.h>
+
+#include "Builder.h"
+#include "Decimation.h"
+#include "MeshIO.h"
+#include "MeshKernel.h"
+#include "Smoothing.h"
+#include "Streaming.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+constexpr std::size_t stlHeaderSize = 80 + sizeof(uint32_t);
+constexpr std::size_t stlFacetSize = 50;
+// number of facets that are read or written at once
+constexpr std::size_t chunkSize = 8192;
+
+using Triangle = std::array<Base::Vector3f, 3>;
+using TriangleChunk = std::vector<Triangle>;
+
+/**
+ * Reads the facets of a mesh file in chunks. Only binary STL files are read piece by piece, all
+ * other formats are loaded by MeshInput at once.
+ */
+class FacetReader
+{
+public:
+    explicit FacetReader(const char* fileName)
+        : fi(fileName)
+    {
+        if (!fi.exists() || !fi.isFile()) {
+            throw Base::FileException("File does not exist", fileName);
+        }
+        if (!fi.isReadable()) {
+            throw Base::FileException("No permission on the file", fileName);
+        }
+
+        if (fi.hasExtension({"stl", "ast"})) {
+            Base::ifstream str(fi, std::ios::in | std::ios::binary);
+            char header[stlHeaderSize];
+            uint32_t count {};
+            if (str.read(header, sizeof(header))) {
+                std::memcpy(&count, header + 80, sizeof(count));
+                binary = stlHeaderSize + std::size_t(count) * stlFacetSize == fi.size();
+            }
+            if (binary) {
+                numFacets = count;
+                return;
+            }
+        }
+
+        MeshInput input(kernel);
+        if (!input.LoadAny(fileName)) {
+            throw Base::FileException("Failed to read mesh from file", fileName);
+        }
+        numFacets = kernel.CountFacets();
+    }
+
+    std::size_t CountFacets() const
+    {
+        return numFacets;
+    }
+
+    void Read(const std::function<void(const TriangleChunk&)>& func)
+    {
+        TriangleChunk chunk;
+        chunk.reserve(chunkSize);
+        if (binary) {
+            Base::ifstream str(fi, std::ios::in | std::ios::binary);
+            str.seekg(stlHeaderSize);
+            std::vector<char> data(chunkSize * stlFacetSize);
+            for (std::size_t first = 0; first < numFacets; first += chunkSize) {
+                std::size_t count = std::min(chunkSize, numFacets - first);
+                if (!str.read(data.data(), std::streamsize(count * stlFacetSize))) {
+                    throw Base::FileException("Unexpected end of file", fi);
+                }
+                chunk.resize(count);
+                for (std::size_t i = 0; i < count; i++) {
+                    // the normal followed by the three points
+                    float coords[12];
+                    std::memcpy(coords, data.data() + i * stlFacetSize, sizeof(coords));
+                    chunk[i][0].Set(coords[3], coords[4], coords[5]);
+                    chunk[i][1].Set(coords[6], coords[7], coords[8]);
+                    chunk[i][2].Set(coords[9], coords[10], coords[11]);
+                }
+                func(chunk);
+            }
+        }
+        else {
+            const MeshPointArray& points = kernel.GetPoints();
+            const MeshFacetArray& facets = kernel.GetFacets();
+            for (std::size_t first = 0; first < numFacets; first += chunkSize) {
+                std::size_t count = std::min(chunkSize, numFacets - first);
+                chunk.resize(count);
+                for (std::size_t i = 0; i < count; i++) {
+                    const MeshFacet& face = facets[first + i];
+                    for (int j = 0; j < 3; j++) {
+                        chunk[i][j] = points[face._aulPoints[j]];
+                    }
+                }
+                func(chunk);
+            }
+        }
+    }
+
+    void Release()
+    {
+        kernel.Clear();
+    }
+
+private:
+    Base::FileInfo fi;
+    MeshKernel kernel;
+    std::size_t numFacets {0};
+    bool binary {false};
+};
+
+/**
+ * Splits a bounding box into a regular grid of at least the given number of buckets. The
+ * buckets are nearly cubic.
+ */
+class BucketGrid
+{
+public:
+    BucketGrid(const Base::BoundBox3f& box, std::size_t buckets)
+        : box(box)
+        , lengths {box.LengthX(), box.LengthY(), box.LengthZ()}
+    {
+        while (Count() < buckets) {
+            // divide the side with the longest buckets
+            int axis = 0;
+            for (int i = 1; i < 3; i++) {
+                if (lengths[i] * float(dims[axis]) > lengths[axis] * float(dims[i])) {
+                    axis = i;
+                }
+            }
+            if (lengths[axis] <= 0.0F) {
+                break;
+            }
+            dims[axis]++;
+        }
+    }
+
+    std::size_t Count() const
+    {
+        return dims[0] * dims[1] * dims[2];
+    }
+
+    std::size_t Index(const Triangle& triangle) const
+    {
+        Base::Vector3f center = (triangle[0] + triangle[1] + triangle[2]) / 3.0F;
+        std::array<float, 3> coords {center.x - box.MinX, center.y - box.MinY, center.z - box.MinZ};
+        std::array<std::size_t, 3> index {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            if (lengths[i] > 0.0F && coords[i] > 0.0F) {
+                index[i] = std::min(
+                    dims[i] - 1,
+                    static_cast<std::size_t>(coords[i] / lengths[i] * float(dims[i]))
+                );
+            }
+        }
+        return (index[2] * dims[1] + index[1]) * dims[0] + index[0];
+    }
+
+private:
+    Base::BoundBox3f box;
+    std::array<float, 3> lengths;
+    std::array<std::size_t, 3> dims {1, 1, 1};
+};
+
+/**
+ * Collects the facets of the buckets in temporary files that are removed at destruction.
+ */
+class BucketFiles
+{
+public:
+    explicit BucketFiles(std::size_t count)
+        : buffers(count)
+    {
+        names.reserve(count);
+        for (std::size_t i = 0; i < count; i++) {
+            names.push_back(Base::FileInfo::getTempFileName("MeshBucket"));
+        }
+    }
+    ~BucketFiles()
+    {
+        for (const auto& name : names) {
+            Base::FileInfo fi(name);
+            if (fi.exists()) {
+                fi.deleteFile();
+            }
+        }
+    }
+
+    BucketFiles(const BucketFiles&) = delete;
+    BucketFiles(BucketFiles&&) = delete;
+    BucketFiles& operator=(const BucketFiles&) = delete;
+    BucketFiles& operator=(BucketFiles&&) = delete;
+
+    std::size_t Count() const
+    {
+        return names.size();
+    }
+
+    void Add(std::size_t bucket, const Triangle& triangle)
+    {
+        TriangleChunk& buffer = buffers[bucket];
+        buffer.push_back(triangle);
+        if (buffer.size() >= chunkSize) {
+            Flush(bucket);
+        }
+    }
+
+    void Flush()
+    {
+        for (std::size_t i = 0; i < buffers.size(); i++) {
+            Flush(i);
+        }
+    }
+
+    TriangleChunk Read(std::size_t bucket) const
+    {
+        TriangleChunk triangles;
+        Base::FileInfo fi(names[bucket]);
+        if (fi.exists()) {
+            triangles.resize(fi.size() / sizeof(Triangle));
+            Base::ifstream str(fi, std::ios::in | std::ios::binary);
+            if (!str.read(
+                    reinterpret_cast<char*>(triangles.data()),
+                    std::streamsize(triangles.size() * sizeof(Triangle))
+                )) {
+                throw Base::FileException("Failed to read temporary file", fi);
+            }
+        }
+        return triangles;
+    }
+
+private:
+    void Flush(std::size_t bucket)
+    {
+        TriangleChunk& buffer = buffers[bucket];
+        if (buffer.empty()) {
+            return;
+        }
+
+        Base::FileInfo fi(names[bucket]);
+        Base::ofstream str(fi, std::ios::out | std::ios::binary | std::ios::app);
+        if (!str.write(
+                reinterpret_cast<const char*>(buffer.data()),
+                std::streamsize(buffer.size() * sizeof(Triangle))
+            )) {
+            throw Base::FileException("Failed to write temporary file", fi);
+        }
+        // release the memory as there can be many buckets
+        TriangleChunk().swap(buffer);
+    }
+
+    std::vector<std::string> names;
+    std::vector<TriangleChunk> buffers;
+};
+
+/**
+ * Writes facets to a binary STL file whose number of facets is only known at the end.
+ */
+class STLWriter
+{
+public:
+    explicit STLWriter(const char* fileName)
+        : fi(fileName)
+        , str(fi, std::ios::out | std::ios::binary | std::ios::trunc)
+    {
+        if (!str) {
+            throw Base::FileException("Cannot open file", fileName);
+        }
+
+        std::string header("MESH-MESH-MESH-MESH-MESH-MESH-MESH-MESH-");
+        header.resize(80, ' ');
+        str.write(header.c_str(), std::streamsize(header.size()));
+        uint32_t count = 0;
+        str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+
+    void Write(const MeshKernel& kernel)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        std::vector<char> data;
+        data.reserve(chunkSize * stlFacetSize);
+        uint16_t attribute = 0;
+        for (const auto& face : kernel.GetFacets()) {
+            MeshGeomFacet facet(
+                points[face._aulPoints[0]],
+                points[face._aulPoints[1]],
+                points[face._aulPoints[2]]
+            );
+            Base::Vector3f normal = facet.GetNormal();
+            float coords[12] = {
+                normal.x,
+                normal.y,
+                normal.z,
+                facet._aclPoints[0].x,
+                facet._aclPoints[0].y,
+                facet._aclPoints[0].z,
+                facet._aclPoints[1].x,
+                facet._aclPoints[1].y,
+                facet._aclPoints[1].z,
+                facet._aclPoints[2].x,
+                facet._aclPoints[2].y,
+                facet._aclPoints[2].z
+            };
+            const char* record = reinterpret_cast<const char*>(coords);
+            data.insert(data.end(), record, record + sizeof(coords));
+            record = reinterpret_cast<const char*>(&attribute);
+            data.insert(data.end(), record, record + sizeof(attribute));
+            if (data.size() >= chunkSize * stlFacetSize) {
+                str.write(data.data(), std::streamsize(data.size()));
+                data.clear();
+            }
+        }
+        str.write(data.data(), std::streamsize(data.size()));
+        if (!str) {
+            throw Base::FileException("Failed to write file", fi);
+        }
+        numFacets += kernel.CountFacets();
+    }
+
+    void Close()
+    {
+        uint32_t count = static_cast<uint32_t>(numFacets);
+        str.seekp(80);
+        str.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        str.close();
+        if (!str) {
+            throw Base::FileException("Failed to write file", fi);
+        }
+    }
+
+private:
+    Base::FileInfo fi;
+    Base::ofstream str;
+    std::size_t numFacets {0};
+};
+
+void loadBucket(MeshKernel& kernel, const TriangleChunk& triangles)
+{
+    MeshFastBuilder builder(kernel);
+    builder.AddFacets(
+        MeshFastBuilder::size_type(triangles.size()),
+        [&triangles](MeshFastBuilder::size_type index, Base::Vector3f* points) {
+            const Triangle& triangle = triangles[index];
+            std::copy(triangle.begin(), triangle.end(), points);
+        }
+    );
+    builder.Finish();
+}
+
+// the points at open edges, these are the bucket borders and the borders of the mesh itself
+std::vector<bool> getBorderPoints(const MeshKernel& kernel)
+{
+    std::vector<bool> border(kernel.CountPoints(), false);
+    for (const auto& face : kernel.GetFacets()) {
+        for (int i = 0; i < 3; i++) {
+            if (face._aulNeighbours[i] == FACET_INDEX_MAX) {
+                border[face._aulPoints[i]] = true;
+                border[face._aulPoints[(i + 1) % 3]] = true;
+            }
+        }
+    }
+    return border;
+}
+
+std::vector<PointIndex> getPoints(const std::vector<bool>& border, bool onBorder)
+{
+    std::vector<PointIndex> points;
+    for (std::size_t i = 0; i < border.size(); i++) {
+        if (border[i] == onBorder) {
+            points.push_back(PointIndex(i));
+        }
+    }
+    return points;
+}
+}  // namespace
+
+void MeshStreamProcessor::SetBucketSize(std::size_t facets)
+{
+    _bucketSize = std::max<std::size_t>(facets, 1);
+}
+
+void MeshStreamProcessor::AddDecimation(float reduction)
+{
+    _operations.push_back({Operation::Decimate, std::clamp(reduction, 0.0F, 1.0F)});
+}
+
+void MeshStreamProcessor::AddSmoothing(unsigned int iterations)
+{
+    _operations.push_back({Operation::Smooth, float(iterations)});
+}
+
+void MeshStreamProcessor::Process(const char* input, const char* output) const
+{
+    FacetReader reader(input);
+    std::size_t numFacets = reader.CountFacets();
+
+    // the first pass over the input only determines the bounding box
+    Base::BoundBox3f box;
+    reader.Read([&box](const TriangleChunk& chunk) {
+        for (const auto& triangle : chunk) {
+            for (const auto& point : triangle) {
+                box.Add(point);
+            }
+        }
+    });
+
+    BucketGrid grid(box, (numFacets + _bucketSize - 1) / _bucketSize);
+    BucketFiles buckets(grid.Count());
+    reader.Read([&grid, &buckets](const TriangleChunk& chunk) {
+        for (const auto& triangle : chunk) {
+            buckets.Add(grid.Index(triangle), triangle);
+        }
+    });
+    buckets.Flush();
+    reader.Release();
+
+    STLWriter writer(output);
+    Base::SequencerLauncher seq("Processing mesh...", buckets.Count());
+    for (std::size_t i = 0; i < buckets.Count(); i++) {
+        TriangleChunk triangles = buckets.Read(i);
+        if (triangles.empty()) {
+            seq.next(true);
+            continue;
+        }
+
+        MeshKernel kernel;
+        loadBucket(kernel, triangles);
+        TriangleChunk().swap(triangles);
+
+        for (const auto& op : _operations) {
+            std::vector<bool> border = getBorderPoints(kernel);
+            switch (op.type) {
+                case Operation::Decimate: {
+                    MeshSimplify simplify(kernel);
+                    simplify.setLockedPoints(getPoints(border, true));
+                    float target = float(kernel.CountFacets()) * (1.0F - op.value);
+                    simplify.simplify(static_cast<int>(target));
+                } break;
+                case Operation::Smooth: {
+                    LaplaceSmoothing smooth(kernel);
+                    smooth.SmoothPoints(static_cast<unsigned int>(op.value), getPoints(border, false));
+                } break;
+            }
+        }
+
+        writer.Write(kernel);
+        seq.next(true);  // allow one to cancel
+    }
+    writer.Close();
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Mod/Mesh/MeshGlobal.h>
+
+
+namespace MeshCore
+{
+
+/**
+ * The MeshStreamProcessor class processes meshes that don't fit into memory as a whole.
+ * The facets of the input file are read in chunks and sorted into buckets of a spatial grid that
+ * are stored in temporary files. The buckets are then loaded one after another, processed by the
+ * local operations and appended to the output file. The points at the borders of a bucket are
+ * never moved, so that the processed buckets still fit together.
+ *
+ * Binary STL input files are read in chunks, all other formats are loaded at once by MeshInput
+ * before they are sorted into the buckets. The output is written as binary STL file.
+ */
+class MeshExport MeshStreamProcessor
+{
+public:
+    struct Operation
+    {
+        enum Type
+        {
+            Decimate, /**< value is the reduction in the range of [0, 1] */
+            Smooth    /**< value is the number of Laplace iterations */
+        };
+        Type type;
+        float value;
+    };
+
+    MeshStreamProcessor() = default;
+
+    /** Sets the maximum number of facets in a bucket. The default is one million facets. */
+    void SetBucketSize(std::size_t facets);
+    /** Appends a decimation by \a reduction to the operations. */
+    void AddDecimation(float reduction);
+    /** Appends \a iterations of Laplace smoothing to the operations. */
+    void AddSmoothing(unsigned int iterations);
+    /** Reads the mesh from \a input, processes it and writes the result to \a output.
+     * Throws a Base::FileException if one of the files cannot be accessed.
+     */
+    void Process(const char* input, const char* output) const;
+
+private:
+    std::size_t _bucketSize {1000000};
+    std::vector<Operation> _operations;
+};
+
+}  // namespace MeshCore
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
 #include "Core/Curvature.h"
 
 #include "FeatureMeshCurvature.h"
@@ -64,18 +66,17 @@ App::DocumentObjectExecReturn* Curvature::execute()
     meshCurv.ComputePerVertex();
     const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
 
-    std::vector<CurvatureInfo> values;
-    values.reserve(curv.size());
-    for (const auto& it : curv) {
+    std::vector<CurvatureInfo> values(curv.size());
+    std::transform(curv.begin(), curv.end(), values.begin(), [](const auto& it) {
         CurvatureInfo ci;
         ci.cMaxCurvDir = it.cMaxCurvDir;
         ci.cMinCurvDir = it.cMinCurvDir;
         ci.fMaxCurvature = it.fMaxCurvature;
         ci.fMinCurvature = it.fMinCurvature;
-        values.push_back(ci);
-    }
+        return ci;
+    });
 
-    CurvInfo.setValues(values);
+    CurvInfo.setValues(std::move(values));
 
     return App::DocumentObject::StdReturn;
 }
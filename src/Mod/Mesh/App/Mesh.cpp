@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 
 
@@ -38,6 +40,7 @@
 #include <Base/ViewProj.h>
 #include <Base/Writer.h>
 
+#include "Core/BVH.h"
 #include "Core/Builder.h"
 #include "Core/Decimation.h"
 #include "Core/Degeneration.h"
@@ -200,6 +203,59 @@ bool MeshObject::getCenterOfGravity(Base::Vector3d& center) const
     return true;
 }
 
+std::size_t MeshObject::fingerprint() const
+{
+    // FNV-1a over the bit patterns of the coordinates, the point indices and the placement
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto add = [&hash](std::uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+
+    const MeshCore::MeshPointArray& points = _kernel.GetPoints();
+    const MeshCore::MeshFacetArray& facets = _kernel.GetFacets();
+    add(points.size());
+    add(facets.size());
+    for (const auto& pnt : points) {
+        std::uint32_t bits[3];
+        std::memcpy(bits, &pnt.x, sizeof(float));
+        std::memcpy(bits + 1, &pnt.y, sizeof(float));
+        std::memcpy(bits + 2, &pnt.z, sizeof(float));
+        add(bits[0]);
+        add(bits[1]);
+        add(bits[2]);
+    }
+    for (const auto& face : facets) {
+        add(face._aulPoints[0]);
+        add(face._aulPoints[1]);
+        add(face._aulPoints[2]);
+    }
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            std::uint64_t bits {};
+            double value = _Mtrx[i][j];
+            std::memcpy(&bits, &value, sizeof(double));
+            add(bits);
+        }
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+std::shared_ptr<const MeshCore::MeshFacetBVH> MeshObject::getFacetBVH() const
+{
+    // The kernel can be modified through the non-const getKernel() without notice,
+    // so a cached hierarchy is only reused if the mesh still has the same fingerprint
+    std::size_t current = fingerprint();
+    std::lock_guard<std::mutex> lock(_bvhMutex);
+    if (!_bvh || _bvhFingerprint != current) {
+        _bvh = std::make_shared<const MeshCore::MeshFacetBVH>(_kernel, _Mtrx);
+        _bvhFingerprint = current;
+    }
+
+    return _bvh;
+}
+
 void MeshObject::copySegments(const MeshObject& mesh)
 {
     // After copying the segments the mesh pointers must be adjusted
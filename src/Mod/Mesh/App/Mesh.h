@@ -26,6 +26,8 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -59,6 +61,7 @@ class ViewProjMethod;
 namespace MeshCore
 {
 class AbstractPolygonTriangulator;
+class MeshFacetBVH;
 }
 
 namespace Mesh
@@ -191,6 +194,11 @@ public:
     {
         return _kernel;
     }
+    /** Returns a bounding volume hierarchy over the transformed facets of the mesh.
+     * The hierarchy is built on first use and shared by later calls until the
+     * geometry, the topology or the placement of the mesh changes.
+     */
+    std::shared_ptr<const MeshCore::MeshFacetBVH> getFacetBVH() const;
 
     Base::BoundBox3d getBoundBox() const override;
     bool getCenterOfGravity(Base::Vector3d& center) const override;
@@ -490,11 +498,15 @@ private:
     void swapKernel(MeshCore::MeshKernel& kernel, const std::vector<std::string>& g);
     void copySegments(const MeshObject&);
     void swapSegments(MeshObject&);
+    std::size_t fingerprint() const;
 
 private:
     Base::Matrix4D _Mtrx;
     MeshCore::MeshKernel _kernel;
     std::vector<Segment> _segments;
+    mutable std::mutex _bvhMutex;
+    mutable std::shared_ptr<const MeshCore::MeshFacetBVH> _bvh;
+    mutable std::size_t _bvhFingerprint {0};
     static const float Epsilon;
 };
 
@@ -236,6 +236,13 @@ void PropertyCurvatureList::setValues(const std::vector<CurvatureInfo>& lValues)
     hasSetValue();
 }
 
+void PropertyCurvatureList::setValues(std::vector<CurvatureInfo>&& lValues)
+{
+    aboutToSetValue();
+    _lValueList = std::move(lValues);
+    hasSetValue();
+}
+
 std::vector<float> PropertyCurvatureList::getCurvature(int mode) const
 {
     const std::vector<Mesh::CurvatureInfo>& fCurvInfo = getValues();
@@ -739,19 +746,54 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+void PropertyMeshKernel::setMeshObject(MeshObject* mesh)
+{
+    // The Python wrapper holds its own reference, so let it follow the property
+    if (meshPyObject && meshPyObject->getMeshObjectPtr() != mesh) {
+        mesh->ref();
+        MeshObject* old = meshPyObject->getMeshObjectPtr();
+        meshPyObject->setTwinPointer(mesh);
+        old->unref();
+    }
+    _meshObject = mesh;
+}
+
+void PropertyMeshKernel::detachMesh(bool copyContent)
+{
+    // the reference of the Python wrapper doesn't count as sharing
+    int owners = 1;
+    if (meshPyObject && meshPyObject->getMeshObjectPtr() == _meshObject) {
+        owners++;
+    }
+    if (_meshObject.getRefCount() <= owners) {
+        return;
+    }
+
+    Base::Reference<MeshObject> mesh;
+    if (copyContent) {
+        mesh = new MeshObject(*_meshObject);
+    }
+    else {
+        mesh = new MeshObject();
+        mesh->setTransform(_meshObject->getTransform());
+    }
+    setMeshObject(mesh);
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
-    _meshObject = mesh;
+    setMeshObject(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    detachMesh(false);
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -759,6 +801,7 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachMesh(false);
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
@@ -766,6 +809,7 @@ void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
     aboutToSetValue();
+    detachMesh(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -773,6 +817,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    detachMesh(false);
     _meshObject->swap(mesh);
     hasSetValue();
 }
@@ -808,6 +853,7 @@ unsigned int PropertyMeshKernel::getMemSize() const
 MeshObject* PropertyMeshKernel::startEditing()
 {
     aboutToSetValue();
+    detachMesh(true);
     return static_cast<MeshObject*>(_meshObject);
 }
 
@@ -819,6 +865,7 @@ void PropertyMeshKernel::finishEditing()
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachMesh(true);
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -826,6 +873,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
     aboutToSetValue();
+    detachMesh(true);
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
         kernel.SetPoint(it.first, it.second);
@@ -835,6 +883,10 @@ void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex,
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    if (_meshObject->getTransform() == rclTrf) {
+        return;
+    }
+    detachMesh(true);
     _meshObject->setTransform(rclTrf);
 }
 
@@ -910,6 +962,7 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
         kernel.Adopt(points, facets);
 
         aboutToSetValue();
+        detachMesh(false);
         _meshObject->getKernel().Adopt(points, facets);
         hasSetValue();
     }
@@ -927,23 +980,57 @@ void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachMesh(false);
     _meshObject->load(reader);
     hasSetValue();
 }
 
+namespace
+{
+class MeshDocFileData: public Base::Persistence::DocFileData
+{
+public:
+    MeshObject mesh;
+};
+}  // namespace
+
+bool PropertyMeshKernel::canReadDocFileConcurrently() const
+{
+    return true;
+}
+
+std::unique_ptr<Base::Persistence::DocFileData> PropertyMeshKernel::readDocFile(
+    Base::Reader& reader
+) const
+{
+    auto data = std::make_unique<MeshDocFileData>();
+    data->mesh.load(reader);
+    return data;
+}
+
+void PropertyMeshKernel::restoreDocFileData(DocFileData& data)
+{
+    auto& meshData = static_cast<MeshDocFileData&>(data);
+    aboutToSetValue();
+    detachMesh(false);
+    _meshObject->swap(meshData.mesh.getKernel());
+    hasSetValue();
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Reference the same mesh object, it is copied on the first modification
     PropertyMeshKernel* prop = new PropertyMeshKernel();
-    *(prop->_meshObject) = *(this->_meshObject);
+    prop->_meshObject = this->_meshObject;
     return prop;
 }
 
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
+    // Note: Reference the same mesh object, it is copied on the first modification
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
-    *(this->_meshObject) = *(prop._meshObject);
+    Base::Reference<MeshObject> mesh(prop._meshObject);
+    aboutToSetValue();
+    setMeshObject(mesh);
     hasSetValue();
 }
@@ -138,6 +138,7 @@ public:
     std::vector<float> getCurvature(int tMode) const;
     void setValue(const CurvatureInfo&);
     void setValues(const std::vector<CurvatureInfo>&);
+    void setValues(std::vector<CurvatureInfo>&&);
 
     /// index operator
     const CurvatureInfo& operator[](const int idx) const
@@ -259,9 +260,12 @@ public:
     void setValue(const MeshObject& m);
     /** This method sets the mesh by copying the data. */
     void setValue(const MeshCore::MeshKernel& m);
-    /** Swaps the mesh data structure. */
+    /** Swaps the mesh data structure.
+     * @note If the mesh is shared with a copy of this property, e.g. an undo
+     * snapshot, the passed mesh gets an empty mesh instead of the old one.
+     */
     void swapMesh(MeshObject&);
-    /** Swaps the mesh data structure. */
+    /** Swaps the mesh data structure. \see swapMesh(MeshObject&) */
     void swapMesh(MeshCore::MeshKernel&);
     /** Returns a the attached mesh object by reference. It cannot be modified
      * from outside.
@@ -316,11 +320,30 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canReadDocFileConcurrently() const override;
+    std::unique_ptr<DocFileData> readDocFile(Base::Reader& reader) const override;
+    void restoreDocFileData(DocFileData& data) override;
 
+    /** The copy shares the mesh object with this property. The mesh is only
+     * copied when one of them gets modified afterwards (copy-on-write).
+     */
     App::Property* Copy() const override;
+    /** Shares the mesh object of \a from, see Copy(). */
     void Paste(const App::Property& from) override;
+    bool canSpillToFile() const override
+    {
+        return true;
+    }
     //@}
 
+private:
+    void setMeshObject(MeshObject* mesh);
+    /** Must be called before modifying the mesh object. If it is shared with
+     * another property it gets replaced by a copy, or by an empty mesh if
+     * \a copyContent is false because the content is replaced anyway.
+     */
+    void detachMesh(bool copyContent);
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
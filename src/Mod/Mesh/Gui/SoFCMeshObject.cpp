@@ -31,11 +31,15 @@
 #endif
 #ifdef FC_OS_MACOSX
 # include <OpenGL/gl.h>
+# include <OpenGL/glext.h>
 # include <OpenGL/glu.h>
 #else
 # include <GL/gl.h>
+# include <GL/glext.h>
 # include <GL/glu.h>
 #endif
+// Should come after glext.h to avoid warnings
+#include <Inventor/C/glue/gl.h>
 #include <Inventor/SbLine.h>
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/SoPrimitiveVertex.h>
@@ -49,6 +53,8 @@
 #include <Inventor/bundles/SoTextureCoordinateBundle.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
+#include <Inventor/elements/SoGLCacheContextElement.h>
+#include <Inventor/misc/SoContextHandler.h>
 #include <Inventor/misc/SoState.h>
 
 #include <Base/Console.h>
@@ -56,8 +62,8 @@
 #include <Gui/SoFCInteractiveElement.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Elements.h>
-#include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 
 #include "SoFCMeshObject.h"
@@ -363,7 +369,7 @@ SoFCMeshPickNode::SoFCMeshPickNode()
 */
 SoFCMeshPickNode::~SoFCMeshPickNode()
 {
-    delete meshGrid;
+    delete meshBVH;
 }
 
 // Doc from superclass.
@@ -378,10 +384,8 @@ void SoFCMeshPickNode::notify(SoNotList* list)
     if (f == &mesh) {
         const Mesh::MeshObject* meshObject = mesh.getValue();
         if (meshObject) {
-            MeshCore::MeshAlgorithm alg(meshObject->getKernel());
-            float fAvgLen = alg.GetAverageEdgeLength();
-            delete meshGrid;
-            meshGrid = new MeshCore::MeshFacetGrid(meshObject->getKernel(), 5.0F * fAvgLen);
+            delete meshBVH;
+            meshBVH = new MeshCore::MeshFacetBVH(meshObject->getKernel());
         }
     }
 }
@@ -405,7 +409,7 @@ void SoFCMeshPickNode::pick(SoPickAction* action)
     Base::Vector3f pt(pos[0], pos[1], pos[2]);
     Base::Vector3f dr(dir[0], dir[1], dir[2]);
     Mesh::FacetIndex index {};
-    if (alg.NearestFacetOnRay(pt, dr, *meshGrid, pt, index)) {
+    if (alg.NearestFacetOnRay(pt, dr, *meshBVH, pt, index)) {
         SoPickedPoint* pp = raypick->addIntersection(SbVec3f(pt.x, pt.y, pt.z));
         if (pp) {
             SoFaceDetail* det = new SoFaceDetail();
@@ -614,9 +618,44 @@ SoFCMeshObjectShape::SoFCMeshObjectShape()
 {
     SO_NODE_CONSTRUCTOR(SoFCMeshObjectShape);
     setName(SoFCMeshObjectShape::getClassTypeId().getName());
+    SoContextHandler::addContextDestructionCallback(contextDestructionCB, this);
 }
 
-SoFCMeshObjectShape::~SoFCMeshObjectShape() = default;
+namespace
+{
+void deleteVertexBuffer(void* closure, uint32_t contextid)
+{
+    const cc_glglue* glue = cc_glglue_instance(static_cast<int>(contextid));
+    auto id = static_cast<GLuint>(reinterpret_cast<uintptr_t>(closure));
+    cc_glglue_glDeleteBuffers(glue, 1, &id);
+}
+}  // namespace
+
+SoFCMeshObjectShape::~SoFCMeshObjectShape()
+{
+    SoContextHandler::removeContextDestructionCallback(contextDestructionCB, this);
+
+    // schedule delete for all allocated GL resources
+    for (const auto& it : vertexBuffers) {
+        if (it.second.id != 0) {
+            void* ptr = reinterpret_cast<void*>(static_cast<uintptr_t>(it.second.id));
+            SoGLCacheContextElement::scheduleDeleteCallback(it.first, deleteVertexBuffer, ptr);
+        }
+    }
+}
+
+void SoFCMeshObjectShape::contextDestructionCB(uint32_t context, void* userdata)
+{
+    auto self = static_cast<SoFCMeshObjectShape*>(userdata);
+    auto it = self->vertexBuffers.find(context);
+    if (it != self->vertexBuffers.end()) {
+        if (it->second.id != 0) {
+            const cc_glglue* glue = cc_glglue_instance(static_cast<int>(context));
+            cc_glglue_glDeleteBuffers(glue, 1, &it->second.id);
+        }
+        self->vertexBuffers.erase(it);
+    }
+}
 
 void SoFCMeshObjectShape::notify(SoNotList* node)
 {
@@ -664,10 +703,6 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction* action)
             }
             else {
 #ifdef RENDER_GLARRAYS
-                if (updateGLArray) {
-                    updateGLArray = false;
-                    generateGLArrays(state);
-                }
                 renderFacesGLArray(action);
 #else
                 drawFaces(mesh, 0, mbind, needNormals, ccw);
@@ -887,50 +922,105 @@ void SoFCMeshObjectShape::generateGLArrays(SoState* state)
 {
     const Mesh::MeshObject* mesh = SoFCMeshObjectElement::get(state);
 
-    this->index_array.resize(0);
-    this->vertex_array.resize(0);
-
-    std::vector<float> face_vertices;
-    std::vector<int32_t> face_indices;
-
     const MeshCore::MeshKernel& kernel = mesh->getKernel();
     const MeshCore::MeshPointArray& cP = kernel.GetPoints();
     const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
 
-    // Flat shading
-    face_vertices.reserve(3 * cF.size() * 6);  // duplicate each vertex
-    face_indices.resize(3 * cF.size());
-
-    int indexed = 0;
+    // Flat shading: every facet gets three vertices of its own with the facet normal, so
+    // the triangles can be drawn in order and don't need an index array
+    std::vector<float> face_vertices(3 * cF.size() * 6);
+    float* data = face_vertices.data();
     for (const auto& it : cF) {
-        Base::Vector3f n = kernel.GetFacet(it).GetNormal();
-        for (Mesh::PointIndex ptIndex : it._aulPoints) {
-            face_vertices.push_back(n.x);
-            face_vertices.push_back(n.y);
-            face_vertices.push_back(n.z);
-            const Base::Vector3f& v = cP[ptIndex];
-            face_vertices.push_back(v.x);
-            face_vertices.push_back(v.y);
-            face_vertices.push_back(v.z);
-
-            face_indices[indexed] = indexed;
-            indexed++;
+        const Base::Vector3f& p0 = cP[it._aulPoints[0]];
+        const Base::Vector3f& p1 = cP[it._aulPoints[1]];
+        const Base::Vector3f& p2 = cP[it._aulPoints[2]];
+        Base::Vector3f n = (p1 - p0) % (p2 - p0);
+        n.Normalize();
+        for (const Base::Vector3f* v : {&p0, &p1, &p2}) {
+            *data++ = n.x;
+            *data++ = n.y;
+            *data++ = n.z;
+            *data++ = v->x;
+            *data++ = v->y;
+            *data++ = v->z;
         }
     }
-    this->index_array.swap(face_indices);
     this->vertex_array.swap(face_vertices);
+    this->vertexCount = static_cast<GLint>(3 * cF.size());
+}
+
+/**
+ * Binds the vertex buffer of the current GL context and uploads the arrays to it if this
+ * hasn't been done since the last change. Returns false if vertex buffers aren't supported.
+ */
+bool SoFCMeshObjectShape::bindVertexBuffer(SoGLRenderAction* action)
+{
+    uint32_t contextId = action->getCacheContext();
+    const cc_glglue* glue = cc_glglue_instance(static_cast<int>(contextId));
+    if (!cc_glglue_has_vertex_buffer_object(glue)) {
+        return false;
+    }
+
+    VertexBuffer& buf = vertexBuffers[contextId];
+    if (buf.id == 0) {
+        cc_glglue_glGenBuffers(glue, 1, &buf.id);
+    }
+    cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, buf.id);
+    if (!buf.loaded) {
+        if (vertex_array.empty()) {
+            generateGLArrays(action->getState());
+        }
+        cc_glglue_glBufferData(
+            glue,
+            GL_ARRAY_BUFFER_ARB,
+            static_cast<intptr_t>(vertex_array.size() * sizeof(float)),
+            vertex_array.data(),
+            GL_STATIC_DRAW_ARB
+        );
+        buf.loaded = true;
+
+        // Once every context has its copy on the graphics card the arrays aren't needed
+        // any more. A new context builds them again.
+        bool allLoaded = std::all_of(
+            vertexBuffers.begin(),
+            vertexBuffers.end(),
+            [](const auto& it) { return it.second.loaded; }
+        );
+        if (allLoaded) {
+            std::vector<float>().swap(vertex_array);
+        }
+    }
+
+    return true;
 }
 
 void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    GLsizei cnt = static_cast<GLsizei>(index_array.size());
+    if (updateGLArray) {
+        updateGLArray = false;
+        std::vector<float>().swap(vertex_array);
+        for (auto& it : vertexBuffers) {
+            it.second.loaded = false;
+        }
+    }
 
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_VERTEX_ARRAY);
 
-    glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, index_array.data());
+    if (bindVertexBuffer(action)) {
+        glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+        glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+
+        const cc_glglue* glue = cc_glglue_instance(static_cast<int>(action->getCacheContext()));
+        cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, 0);
+    }
+    else {
+        if (vertex_array.empty()) {
+            generateGLArrays(action->getState());
+        }
+        glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
+        glDrawArrays(GL_TRIANGLES, 0, vertexCount);
+    }
 
     glDisableClientState(GL_VERTEX_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
@@ -938,14 +1028,15 @@ void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction* action)
 
 void SoFCMeshObjectShape::renderCoordsGLArray(SoGLRenderAction* action)
 {
-    (void)action;
-    int cnt = index_array.size();
+    if (updateGLArray || vertex_array.empty()) {
+        generateGLArrays(action->getState());
+    }
 
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_VERTEX_ARRAY);
 
     glInterleavedArrays(GL_N3F_V3F, 0, vertex_array.data());
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, index_array.data());
+    glDrawArrays(GL_POINTS, 0, vertexCount);
 
     glDisableClientState(GL_VERTEX_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
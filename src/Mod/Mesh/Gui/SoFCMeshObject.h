@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <map>
 #include <Inventor/elements/SoReplacedElement.h>
 #include <Inventor/fields/SoSFUInt32.h>
 #include <Inventor/fields/SoSFVec3f.h>
@@ -39,7 +40,7 @@ using GLfloat = float;
 
 namespace MeshCore
 {
-class MeshFacetGrid;
+class MeshFacetBVH;
 }
 
 namespace MeshGui
@@ -108,7 +109,7 @@ protected:
     ~SoFCMeshPickNode() override;
 
 private:
-    MeshCore::MeshFacetGrid* meshGrid {nullptr};
+    MeshCore::MeshFacetBVH* meshBVH {nullptr};
 };
 
 // -------------------------------------------------------
@@ -236,14 +237,23 @@ private:
     void generateGLArrays(SoState* state);
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    bool bindVertexBuffer(SoGLRenderAction* action);
+    static void contextDestructionCB(uint32_t context, void* userdata);
 
 private:
+    struct VertexBuffer
+    {
+        GLuint id {0};
+        bool loaded {false};
+    };
+
     GLuint* selectBuf {nullptr};
     GLfloat modelview[16] {};
     GLfloat projection[16] {};
     // Vertex array handling
-    std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
+    GLint vertexCount {0};
+    std::map<uint32_t, VertexBuffer> vertexBuffers;
     SbBool updateGLArray {false};
 };
 
@@ -22,7 +22,9 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <limits>
+#include <thread>
 
 #include <FCConfig.h>
 
@@ -53,6 +55,8 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -69,6 +73,74 @@ using MeshCore::MeshFacetIterator;
 using MeshCore::MeshKernel;
 using MeshCore::MeshPointIterator;
 
+namespace
+{
+// with less polylines per thread the threads don't pay off
+int countThreads(std::size_t count)
+{
+    constexpr std::size_t minPolylinesPerThread = 4;
+    return int(std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(std::thread::hardware_concurrency(), count / minPolylinesPerThread)
+    ));
+}
+
+// Searches the facet the point can be projected onto along the facet normal with the shortest
+// distance. The search box is grown until it encloses the best hit, so the result is the same as
+// if all facets were tested in index order.
+bool findNearestFacetAlongNormal(
+    const MeshKernel& rMesh,
+    const MeshCore::MeshFacetBVH& rBVH,
+    const Base::Vector3f& rPnt,
+    Base::Vector3f& rRslt,
+    MeshCore::FacetIndex& rFaceIndex
+)
+{
+    Base::BoundBox3f meshBox = rMesh.GetBoundBox();
+    Base::Vector3f nearest;
+    if (!meshBox.IsValid() || rBVH.NearestFacetToPoint(rPnt, nearest) == MeshCore::FACET_INDEX_MAX) {
+        return false;
+    }
+
+    float radius = std::max(Base::Distance(rPnt, nearest), 1e-6f * meshBox.CalcDiagonalLength());
+    if (radius <= 0.0f) {
+        radius = std::numeric_limits<float>::epsilon();
+    }
+
+    std::vector<MeshCore::FacetIndex> facets;
+    for (;;) {
+        Base::BoundBox3f box(rPnt.x, rPnt.y, rPnt.z, rPnt.x, rPnt.y, rPnt.z);
+        box.Enlarge(radius);
+        facets.clear();
+        rBVH.SearchFacets(box, facets);
+        std::sort(facets.begin(), facets.end());
+
+        Base::Vector3f TempResultPoint;
+        float MinLength = std::numeric_limits<float>::max();
+        bool bHit = false;
+        for (MeshCore::FacetIndex index : facets) {
+            MeshGeomFacet facet = rMesh.GetFacet(index);
+            if (facet.Foraminate(rPnt, facet.GetNormal(), TempResultPoint)) {
+                float Dist = (rPnt - TempResultPoint).Length();
+                if (Dist < MinLength) {
+                    bHit = true;
+                    MinLength = Dist;
+                    rRslt = TempResultPoint;
+                    rFaceIndex = index;
+                }
+            }
+        }
+
+        // a closer hit outside of the box is only possible if the best one is farther than radius
+        if ((bHit && MinLength <= radius) || box.IsInBox(meshBox)) {
+            return bHit;
+        }
+
+        radius *= 2.0f;
+    }
+}
+}  // namespace
+
 CurveProjector::CurveProjector(const TopoDS_Shape& aShape, const MeshKernel& pMesh)
     : _Shape(aShape)
     , _Mesh(pMesh)
@@ -89,6 +161,15 @@ void CurveProjector::writeIntersectionPointsToFile(const char* name)
     str.close();
 }
 
+const MeshCore::MeshFacetBVH& CurveProjector::getFacetBVH() const
+{
+    if (!_bvh) {
+        _bvh = std::make_shared<const MeshCore::MeshFacetBVH>(_Mesh);
+    }
+
+    return *_bvh;
+}
+
 
 //**************************************************************************
 //**************************************************************************
@@ -244,27 +325,12 @@ bool CurveProjectorShape::findStartPoint(
     MeshCore::FacetIndex& FaceIndex
 )
 {
-    Base::Vector3f TempResultPoint;
-    float MinLength = std::numeric_limits<float>::max();
-    bool bHit = false;
-
-    // go through the whole Mesh
-    MeshFacetIterator It(MeshK);
-    for (It.Init(); It.More(); It.Next()) {
-        // try to project (with angle) to the face
-        if (It->Foraminate(Pnt, It->GetNormal(), TempResultPoint)) {
-            // distance to the projected point
-            float Dist = (Pnt - TempResultPoint).Length();
-            if (Dist < MinLength) {
-                // remember the point with the closest distance
-                bHit = true;
-                MinLength = Dist;
-                Rslt = TempResultPoint;
-                FaceIndex = It.Position();
-            }
-        }
+    if (&MeshK == &_Mesh) {
+        return findNearestFacetAlongNormal(MeshK, getFacetBVH(), Pnt, Rslt, FaceIndex);
     }
-    return bHit;
+
+    MeshCore::MeshFacetBVH cBVH(MeshK);
+    return findNearestFacetAlongNormal(MeshK, cBVH, Pnt, Rslt, FaceIndex);
 }
 
 
@@ -445,7 +511,8 @@ void CurveProjectorWithToolMesh::makeToolMesh(const TopoDS_Edge& aEdge, std::vec
 
     std::vector<LineSeg> LineSegs;
 
-    MeshFacetIterator It(_Mesh);
+    const MeshCore::MeshFacetBVH& cBVH = getFacetBVH();
+    std::vector<MeshCore::FacetIndex> facets;
 
     Base::SequencerLauncher seq("Building up tool mesh...", ulNbOfPoints + 1);
 
@@ -458,16 +525,21 @@ void CurveProjectorWithToolMesh::makeToolMesh(const TopoDS_Edge& aEdge, std::vec
 
         Base::Vector3f ResultNormal;
 
-        // go through the whole Mesh
-        for (It.Init(); It.More(); It.Next()) {
+        // only facets near the point can be hit closer than the search distance, the slack
+        // covers the tolerance of IntersectWithLine()
+        Base::BoundBox3f box(LinePoint.x, LinePoint.y, LinePoint.z, LinePoint.x, LinePoint.y, LinePoint.z);
+        box.Enlarge(0.51f);
+        facets.clear();
+        cBVH.SearchFacets(box, facets);
+        // sum up the normals in the same order as a loop over all facets
+        std::sort(facets.begin(), facets.end());
+
+        for (MeshCore::FacetIndex index : facets) {
+            MeshGeomFacet facet = _Mesh.GetFacet(index);
             // try to project (with angle) to the face
-            if (It->IntersectWithLine(
-                    Base::Vector3f((float)gpPt.X(), (float)gpPt.Y(), (float)gpPt.Z()),
-                    It->GetNormal(),
-                    cResultPoint
-                )) {
+            if (facet.IntersectWithLine(LinePoint, facet.GetNormal(), cResultPoint)) {
                 if (Base::Distance(LinePoint, cResultPoint) < 0.5) {
-                    ResultNormal += It->GetNormal();
+                    ResultNormal += facet.GetNormal();
                 }
             }
         }
@@ -510,6 +582,20 @@ MeshProjection::MeshProjection(const MeshKernel& rMesh)
     : _rcMesh(rMesh)
 {}
 
+MeshProjection::MeshProjection(const MeshKernel& rMesh, std::shared_ptr<const MeshCore::MeshFacetBVH> bvh)
+    : _rcMesh(rMesh)
+    , _bvh(std::move(bvh))
+{}
+
+const MeshCore::MeshFacetBVH& MeshProjection::getFacetBVH() const
+{
+    if (!_bvh) {
+        _bvh = std::make_shared<const MeshCore::MeshFacetBVH>(_rcMesh);
+    }
+
+    return *_bvh;
+}
+
 void MeshProjection::discretize(
     const TopoDS_Edge& aEdge,
     std::vector<Base::Vector3f>& polyline,
@@ -652,11 +738,6 @@ void MeshProjection::projectToMesh(
     std::vector<PolyLine>& rPolyLines
 ) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-
     TopExp_Explorer Ex;
 
     int iCnt = 0;
@@ -669,7 +750,7 @@ void MeshProjection::projectToMesh(
     for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
         const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
         std::vector<SplitEdge> rSplitEdges;
-        projectEdgeToEdge(aEdge, fMaxDist, cGrid, rSplitEdges);
+        projectEdgeToEdge(aEdge, fMaxDist, rSplitEdges);
         PolyLine polyline;
         polyline.points.reserve(rSplitEdges.size());
         for (auto it : rSplitEdges) {
@@ -687,10 +768,11 @@ void MeshProjection::projectOnMesh(
     std::vector<Base::Vector3f>& pointsOut
 ) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    // shoot all rays at once, they are traversed in packets
+    const MeshCore::MeshFacetBVH& cBVH = getFacetBVH();
+    std::vector<Base::Vector3f> results;
+    std::vector<MeshCore::FacetIndex> indices;
+    cBVH.NearestFacetsOnRays(pointsIn, dir, results, indices);
 
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
@@ -714,10 +796,11 @@ void MeshProjection::projectOnMesh(
 
     Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
 
-    for (auto it : pointsIn) {
-        Base::Vector3f result;
-        MeshCore::FacetIndex index;
-        if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
+    for (std::size_t i = 0; i < pointsIn.size(); i++) {
+        const Base::Vector3f& it = pointsIn[i];
+        Base::Vector3f result = results[i];
+        MeshCore::FacetIndex index = indices[i];
+        if (index != MeshCore::FACET_INDEX_MAX) {
             MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
@@ -771,62 +854,16 @@ void MeshProjection::projectParallelToMesh(
     std::vector<PolyLine>& rPolyLines
 ) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    std::vector<PolyLine> polylines;
     TopExp_Explorer Ex;
-
-    int iCnt = 0;
-    for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
-        iCnt++;
-    }
-
-    Base::SequencerLauncher seq("Project curve on mesh", iCnt);
-
     for (Ex.Init(aShape, TopAbs_EDGE); Ex.More(); Ex.Next()) {
         const TopoDS_Edge& aEdge = TopoDS::Edge(Ex.Current());
-        std::vector<Base::Vector3f> points;
-        discretize(aEdge, points, 5);
-
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
-        std::vector<HitPoint> hitPoints;
-        using HitPoints = std::pair<HitPoint, HitPoint>;
-        std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
-
-                if (hitPoints.size() > 1) {
-                    HitPoint p1 = hitPoints[hitPoints.size() - 2];
-                    HitPoint p2 = hitPoints[hitPoints.size() - 1];
-                    hitPointPairs.emplace_back(p1, p2);
-                }
-            }
-        }
-
-        MeshCore::MeshProjection meshProjection(_rcMesh);
         PolyLine polyline;
-        for (auto it : hitPointPairs) {
-            points.clear();
-            if (meshProjection.projectLineOnMesh(
-                    cGrid,
-                    it.first.first,
-                    it.first.second,
-                    it.second.first,
-                    it.second.second,
-                    dir,
-                    points
-                )) {
-                polyline.points.insert(polyline.points.end(), points.begin(), points.end());
-            }
-        }
-        rPolyLines.push_back(polyline);
-
-        seq.next();
+        discretize(aEdge, polyline.points, 5);
+        polylines.push_back(std::move(polyline));
     }
+
+    projectParallelToMesh(polylines, dir, rPolyLines);
 }
 
 void MeshProjection::projectParallelToMesh(
@@ -835,60 +872,63 @@ void MeshProjection::projectParallelToMesh(
     std::vector<PolyLine>& rPolyLines
 ) const
 {
-    // calculate the average edge length and create a grid
-    MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
-
-    Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
+    const MeshCore::MeshFacetBVH& cBVH = getFacetBVH();
 
+    // shoot the rays of all polylines at once, they are traversed in packets
+    std::vector<Base::Vector3f> points;
+    std::vector<std::size_t> offsets;
+    offsets.reserve(aEdges.size() + 1);
     for (const auto& it : aEdges) {
-        std::vector<Base::Vector3f> points = it.points;
-
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
-        std::vector<HitPoint> hitPoints;
-        using HitPoints = std::pair<HitPoint, HitPoint>;
-        std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
-
-                if (hitPoints.size() > 1) {
-                    HitPoint p1 = hitPoints[hitPoints.size() - 2];
-                    HitPoint p2 = hitPoints[hitPoints.size() - 1];
-                    hitPointPairs.emplace_back(p1, p2);
-                }
-            }
-        }
+        offsets.push_back(points.size());
+        points.insert(points.end(), it.points.begin(), it.points.end());
+    }
+    offsets.push_back(points.size());
+
+    std::vector<Base::Vector3f> results;
+    std::vector<MeshCore::FacetIndex> indices;
+    cBVH.NearestFacetsOnRays(points, dir, results, indices);
+
+    // connect the hit points of each polyline, the polylines don't depend on each other
+    std::size_t first = rPolyLines.size();
+    rPolyLines.resize(first + aEdges.size());
+    MeshCore::MeshProjection meshProjection(_rcMesh);
+    MeshCore::parallel_for(
+        aEdges.size(),
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<Base::Vector3f> section;
+            for (std::size_t i = begin; i < end; i++) {
+                PolyLine& polyline = rPolyLines[first + i];
+                std::size_t last = offsets[i + 1];
+                for (std::size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+                    if (indices[j] == MeshCore::FACET_INDEX_MAX) {
+                        continue;
+                    }
 
-        MeshCore::MeshProjection meshProjection(_rcMesh);
-        PolyLine polyline;
-        for (auto it : hitPointPairs) {
-            points.clear();
-            if (meshProjection.projectLineOnMesh(
-                    cGrid,
-                    it.first.first,
-                    it.first.second,
-                    it.second.first,
-                    it.second.second,
-                    dir,
-                    points
-                )) {
-                polyline.points.insert(polyline.points.end(), points.begin(), points.end());
+                    if (last != offsets[i + 1]) {
+                        section.clear();
+                        if (meshProjection.projectLineOnMesh(
+                                cBVH,
+                                results[last],
+                                indices[last],
+                                results[j],
+                                indices[j],
+                                dir,
+                                section
+                            )) {
+                            polyline.points.insert(polyline.points.end(), section.begin(), section.end());
+                        }
+                    }
+                    last = j;
+                }
             }
-        }
-        rPolyLines.push_back(polyline);
-
-        seq.next();
-    }
+        },
+        countThreads(aEdges.size())
+    );
 }
 
 void MeshProjection::projectEdgeToEdge(
     const TopoDS_Edge& aEdge,
     float fMaxDist,
-    const MeshFacetGrid& rGrid,
     std::vector<SplitEdge>& rSplitEdges
 ) const
 {
@@ -901,10 +941,7 @@ void MeshProjection::projectEdgeToEdge(
     std::vector<Base::Vector3f> acPolyLine;
     discretize(aEdge, acPolyLine);
 
-    MeshAlgorithm(_rcMesh).SearchFacetsFromPolyline(acPolyLine, fMaxDist, rGrid, auFInds);
-    // remove duplicated elements
-    std::sort(auFInds.begin(), auFInds.end());
-    auFInds.erase(std::unique(auFInds.begin(), auFInds.end()), auFInds.end());
+    MeshAlgorithm(_rcMesh).SearchFacetsFromPolyline(acPolyLine, fMaxDist, getFacetBVH(), auFInds);
 
     // facet to edge
     for (MeshCore::FacetIndex index : auFInds) {
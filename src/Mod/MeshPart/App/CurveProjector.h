@@ -25,6 +25,7 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 
 #include <TopoDS_Edge.hxx>
 
@@ -37,6 +38,7 @@ namespace MeshCore
 {
 class MeshKernel;
 class MeshGeomFacet;
+class MeshFacetBVH;
 class MeshFacetGrid;
 }  // namespace MeshCore
 
@@ -87,9 +89,14 @@ public:
 
 protected:
     virtual void Do() = 0;
+    /// Returns the hierarchy over the facets of the mesh, it's built on first use
+    const MeshCore::MeshFacetBVH& getFacetBVH() const;
     const TopoDS_Shape& _Shape;
     const MeshKernel& _Mesh;
     result_type mvEdgeSplitPoints;
+
+private:
+    mutable std::shared_ptr<const MeshCore::MeshFacetBVH> _bvh;
 };
 
 
@@ -198,6 +205,12 @@ public:
     };
 
     explicit MeshProjection(const MeshKernel& rMesh);
+    /**
+     * Uses the hierarchy \a bvh over the facets of \a rMesh for all projections instead of
+     * building an own one, so that it can be shared between several projections of the same
+     * mesh, e.g. with Mesh::MeshObject::getFacetBVH().
+     */
+    MeshProjection(const MeshKernel& rMesh, std::shared_ptr<const MeshCore::MeshFacetBVH> bvh);
 
     /**
      * @brief findSectionParameters
@@ -241,6 +254,7 @@ public:
     ) const;
     /**
      * Project all edges of the shape onto the mesh using parallel projection.
+     * The edges are discretized first and then projected like polylines.
      */
     void projectParallelToMesh(
         const TopoDS_Shape& aShape,
@@ -249,6 +263,7 @@ public:
     ) const;
     /**
      * Project all polylines onto the mesh using parallel projection.
+     * The rays of all points are shot at once and the polylines are handled in several threads.
      */
     void projectParallelToMesh(
         const std::vector<PolyLine>& aEdges,
@@ -265,13 +280,16 @@ protected:
     void projectEdgeToEdge(
         const TopoDS_Edge& aCurve,
         float fMaxDist,
-        const MeshCore::MeshFacetGrid& rGrid,
         std::vector<SplitEdge>& rSplitEdges
     ) const;
     bool findIntersection(const Edge&, const Edge&, const Base::Vector3f& dir, Base::Vector3f& res) const;
 
+private:
+    const MeshCore::MeshFacetBVH& getFacetBVH() const;
+
 private:
     const MeshKernel& _rcMesh;
+    mutable std::shared_ptr<const MeshCore::MeshFacetBVH> _bvh;
 };
 
 }  // namespace MeshPart
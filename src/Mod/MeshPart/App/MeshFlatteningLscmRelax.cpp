@@ -22,17 +22,21 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
 #include <map>
 #include <numbers>
 #include <set>
+#include <thread>
 #include <vector>
 
 
 #include <Eigen/SparseCholesky>
 
+#include <Mod/Mesh/App/Core/Functional.h>
+
 #include "MeshFlatteningLscmRelax.h"
 
 
@@ -47,6 +51,40 @@ namespace lscmrelax
 using trip = Eigen::Triplet<double>;
 using spMat = Eigen::SparseMatrix<double>;
 
+// with less triangles per thread the threads don't pay off
+static int count_threads(long count)
+{
+    const long min_triangles_per_thread = 10000;
+    return static_cast<int>(std::max<long>(
+        1, std::min<long>(std::thread::hardware_concurrency(), count / min_triangles_per_thread)));
+}
+
+void ReusableLDLT::factorize(const spMat& mat)
+{
+    // the patterns are compared in compressed storage
+    if (!mat.isCompressed())
+    {
+        spMat compressed = mat;
+        compressed.makeCompressed();
+        this->factorize(compressed);
+        return;
+    }
+
+    const spMat::StorageIndex* outer = mat.outerIndexPtr();
+    const spMat::StorageIndex* inner = mat.innerIndexPtr();
+    long outer_size = mat.outerSize() + 1;
+    long inner_size = mat.nonZeros();
+    if (this->outer_pattern.empty() ||
+        !std::equal(outer, outer + outer_size, this->outer_pattern.begin(), this->outer_pattern.end()) ||
+        !std::equal(inner, inner + inner_size, this->inner_pattern.begin(), this->inner_pattern.end()))
+    {
+        this->outer_pattern.assign(outer, outer + outer_size);
+        this->inner_pattern.assign(inner, inner + inner_size);
+        this->solver.analyzePattern(mat);
+    }
+    this->solver.factorize(mat);
+}
+
 
 
 ColMat<double, 2> map_to_2D(ColMat<double, 3> points)
@@ -145,64 +183,81 @@ LscmRelax::LscmRelax(
 void LscmRelax::relax(double weight)
 {
     ColMat<double, 3> d_q_l_g = this->q_l_m - this->q_l_g;
-    // for every triangle
-    Eigen::Matrix<double, 3, 6> B;
-    Eigen::Matrix<double, 2, 2> T;
-    Eigen::Matrix<double, 6, 6> K_m;
-    Eigen::Matrix<double, 6, 1> u_m, rhs_m;
     Eigen::VectorXd rhs(this->vertices.cols() * 2 + 3);
     if (this->sol.size() == 0)
         this->sol.Zero(this->vertices.cols() * 2 + 3);
     spMat K_g(this->vertices.cols() * 2 + 3, this->vertices.cols() * 2 + 3);
-    std::vector<trip> K_g_triplets;
-    Vector2 v1, v2, v3, v12, v23, v31;
-    long row_pos, col_pos;
-    double A;
+    // every triangle owns a fixed range of the triplets and a column of rhs_tris,
+    // so the triangles can be processed in parallel
+    const long num_tris = this->triangles.cols();
+    std::vector<trip> K_g_triplets(num_tris * 36 + this->flat_vertices.cols() * 8);
+    Eigen::Matrix<double, 6, Eigen::Dynamic> rhs_tris(6, num_tris);
 
     rhs.setZero();
 
-    for (long i=0; i<this->triangles.cols(); i++)
+    MeshCore::parallel_for(num_tris, [&](std::size_t begin, std::size_t end)
     {
-        // 1: construct B-mat in m-system
-        v1 = this->flat_vertices.col(this->triangles(0, i));
-        v2 = this->flat_vertices.col(this->triangles(1, i));
-        v3 = this->flat_vertices.col(this->triangles(2, i));
-        v12 = v2 - v1;
-        v23 = v3 - v2;
-        v31 = v1 - v3;
-        B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
-              0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
-             -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
-        T << v12.x(), -v12.y(),
-             v12.y(), v12.x();
-        T /= v12.norm();
-        A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
-        B /= A * 2; // (2*area)
-
-        // 2: sigma due dqlg in m-system
-        u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
-
-        // 3: rhs_m = B.T * C * B * dqlg_m
-        //    K_m = B.T * C * B
-        rhs_m = B.transpose() * this->C * B * u_m * A;
-        K_m = B.transpose() * this->C * B * A;
-
-        // 5: add to rhs_g, K_g
-        for (int j=0; j < 3; j++)
+        Eigen::Matrix<double, 3, 6> B;
+        Eigen::Matrix<double, 2, 2> T;
+        Eigen::Matrix<double, 6, 6> K_m;
+        Eigen::Matrix<double, 6, 1> u_m;
+        Vector2 v1, v2, v3, v12, v23, v31;
+        long row_pos, col_pos;
+        double A;
+
+        for (long i=static_cast<long>(begin); i<static_cast<long>(end); i++)
         {
-            row_pos = this->triangles(j, i);
-            rhs[row_pos * 2]     += rhs_m[j * 2];
-            rhs[row_pos * 2 + 1] += rhs_m[j * 2 +1];
-            for (int k=0; k < 3; k++)
+            // 1: construct B-mat in m-system
+            v1 = this->flat_vertices.col(this->triangles(0, i));
+            v2 = this->flat_vertices.col(this->triangles(1, i));
+            v3 = this->flat_vertices.col(this->triangles(2, i));
+            v12 = v2 - v1;
+            v23 = v3 - v2;
+            v31 = v1 - v3;
+            B << -v23.y(),   0,        -v31.y(),   0,        -v12.y(),   0,
+                  0,         v23.x(),   0,         v31.x(),   0,         v12.x(),
+                 -v23.x(),   v23.y(),  -v31.x(),   v31.y(),  -v12.x(),   v12.y();
+            T << v12.x(), -v12.y(),
+                 v12.y(), v12.x();
+            T /= v12.norm();
+            A = std::abs(this->q_l_m(i, 0) * this->q_l_m(i, 2) / 2);
+            B /= A * 2; // (2*area)
+
+            // 2: sigma due dqlg in m-system
+            u_m << Vector2(0, 0), T * Vector2(d_q_l_g(i, 0), 0), T * Vector2(d_q_l_g(i, 1), d_q_l_g(i, 2));
+
+            // 3: rhs_m = B.T * C * B * dqlg_m
+            //    K_m = B.T * C * B
+            rhs_tris.col(i) = B.transpose() * this->C * B * u_m * A;
+            K_m = B.transpose() * this->C * B * A;
+
+            // 4: add to K_g
+            trip* K_g_tri = &K_g_triplets[i * 36];
+            for (int j=0; j < 3; j++)
             {
-                col_pos = this->triangles(k, i);
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2)));
-                K_g_triplets.emplace_back(trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1)));
-                K_g_triplets.emplace_back(trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1)));
-                // we don't have to fill all because the matrix is symmetric.
+                row_pos = this->triangles(j, i);
+                for (int k=0; k < 3; k++)
+                {
+                    col_pos = this->triangles(k, i);
+                    *K_g_tri++ = trip(row_pos * 2,     col_pos * 2,        K_m(j * 2,      k * 2));
+                    *K_g_tri++ = trip(row_pos * 2 + 1, col_pos * 2,        K_m(j * 2 + 1,  k * 2));
+                    *K_g_tri++ = trip(row_pos * 2 + 1, col_pos * 2 + 1,    K_m(j * 2 + 1,  k * 2 + 1));
+                    *K_g_tri++ = trip(row_pos * 2,     col_pos * 2 + 1,    K_m(j * 2,      k * 2 + 1));
+                    // we don't have to fill all because the matrix is symmetric.
+                }
             }
         }
+    }, count_threads(num_tris));
+
+    // 5: add to rhs_g, in the order of the triangles to get the same sums as a serial assembly
+    for (long i=0; i<num_tris; i++)
+    {
+        for (int j=0; j < 3; j++)
+        {
+            long row_pos = this->triangles(j, i);
+            rhs[row_pos * 2]     += rhs_tris(j * 2, i);
+            rhs[row_pos * 2 + 1] += rhs_tris(j * 2 + 1, i);
+        }
     }
     // FIXING SOME PINS:
     // - if there are no pins (or only one pin) selected solve the system without the nullspace solution.
@@ -248,19 +303,20 @@ void LscmRelax::relax(double weight)
     //     K_g_triplets.push_back(trip(i, i, 0.01));
 
     // lagrange multiplier
+    trip* K_g_lagrange = &K_g_triplets[num_tris * 36];
     for (long i=0; i < this->flat_vertices.cols() ; i++)
     {
         // fixing total ux
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2, i * 2, 1));
+        *K_g_lagrange++ = trip(i * 2, this->flat_vertices.cols() * 2, 1);
+        *K_g_lagrange++ = trip(this->flat_vertices.cols() * 2, i * 2, 1);
         // fixing total uy
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 1, 1));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 1, i * 2 + 1, 1));
+        *K_g_lagrange++ = trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 1, 1);
+        *K_g_lagrange++ = trip(this->flat_vertices.cols() * 2 + 1, i * 2 + 1, 1);
         // fixing ux*y-uy*x
-        K_g_triplets.emplace_back(trip(i * 2, this->flat_vertices.cols() * 2 + 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2, - this->flat_vertices(1, i)));
-        K_g_triplets.emplace_back(trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 2, this->flat_vertices(0, i)));
-        K_g_triplets.emplace_back(trip(this->flat_vertices.cols() * 2 + 2, i * 2 + 1, this->flat_vertices(0, i)));
+        *K_g_lagrange++ = trip(i * 2, this->flat_vertices.cols() * 2 + 2, - this->flat_vertices(1, i));
+        *K_g_lagrange++ = trip(this->flat_vertices.cols() * 2 + 2, i * 2, - this->flat_vertices(1, i));
+        *K_g_lagrange++ = trip(i * 2 + 1, this->flat_vertices.cols() * 2 + 2, this->flat_vertices(0, i));
+        *K_g_lagrange++ = trip(this->flat_vertices.cols() * 2 + 2, i * 2 + 1, this->flat_vertices(0, i));
     }
 
     // project out the nullspace solution:
@@ -283,9 +339,8 @@ void LscmRelax::relax(double weight)
     // rhs +=  K_g * Eigen::VectorXd::Ones(K_g.rows());
 
     // solve linear system (privately store the value for guess in next step)
-    Eigen::SimplicialLDLT<spMat, Eigen::Lower> solver;
-    solver.compute(K_g);
-    this->sol = solver.solve(-rhs);
+    this->relax_solver.factorize(K_g);
+    this->sol = this->relax_solver.solver.solve(-rhs);
     this->set_shift(this->sol.head(this->vertices.cols() * 2) * weight);
     this->set_q_l_m();
 }
@@ -411,7 +466,11 @@ void LscmRelax::edge_relax(double weight)
     Eigen::ConjugateGradient<spMat,Eigen::Lower, NullSpaceProjector> solver;
     solver.preconditioner().setNullSpace(this->get_nullspace());
     solver.compute(K_g);
-    this->sol = solver.solve(-rhs);
+    // start with the shift of the previous step
+    if (this->sol.size() == rhs.size())
+        this->sol = solver.solveWithGuess(-rhs, this->sol);
+    else
+        this->sol = solver.solve(-rhs);
     this->set_shift(this->sol * weight);
 }
 
@@ -422,31 +481,34 @@ void LscmRelax::edge_relax(double weight)
 void LscmRelax::lscm()
 {
     this->set_q_l_g();
-    std::vector<trip> triple_list;
-    long i;
-    double x21, x31, y31, x32;
+    const long num_tris = this->triangles.cols();
+    std::vector<trip> triple_list(num_tris * 10);
 
-    // 1. create the triplet list (t * 2, v * 2)
-    for(i=0; i<this->triangles.cols(); i++)
+    // 1. create the triplet list (t * 2, v * 2), every triangle owns 10 triplets
+    MeshCore::parallel_for(num_tris, [&](std::size_t begin, std::size_t end)
     {
-        x21 = this->q_l_g(i, 0);
-        x31 = this->q_l_g(i, 1);
-        y31 = this->q_l_g(i, 2);
-        x32 = x31 - x21;
-
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31));
-        triple_list.emplace_back(trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21));
-
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31));
-        triple_list.emplace_back(trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21));
-
-    }
+        double x21, x31, y31, x32;
+        for (long i=static_cast<long>(begin); i<static_cast<long>(end); i++)
+        {
+            x21 = this->q_l_g(i, 0);
+            x31 = this->q_l_g(i, 1);
+            y31 = this->q_l_g(i, 2);
+            x32 = x31 - x21;
+
+            trip* tri = &triple_list[i * 10];
+            *tri++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2, x32);
+            *tri++ = trip(2 * i, this->new_order[this->triangles(0, i)] * 2 + 1, -y31);
+            *tri++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2, -x31);
+            *tri++ = trip(2 * i, this->new_order[this->triangles(1, i)] * 2 + 1, y31);
+            *tri++ = trip(2 * i, this->new_order[this->triangles(2, i)] * 2, x21);
+
+            *tri++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2, y31);
+            *tri++ = trip(2 * i + 1, this->new_order[this->triangles(0, i)] * 2 + 1, x32);
+            *tri++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2, -y31);
+            *tri++ = trip(2 * i + 1, this->new_order[this->triangles(1, i)] * 2 + 1, -x31);
+            *tri++ = trip(2 * i + 1, this->new_order[this->triangles(2, i)] * 2 + 1, x21);
+        }
+    }, count_threads(num_tris));
     // 2. divide the triplets in matrix(unknown part) and rhs(known part) and reset the position
     std::vector<trip> rhs_triplets;
     std::vector<trip> mat_triplets;
@@ -478,11 +540,21 @@ void LscmRelax::lscm()
     A.setFromTriplets(mat_triplets.begin(), mat_triplets.end());
 
     // 6. solve the system and set the flatted coordinates
-    // Eigen::SparseQR<spMat, Eigen::COLAMDOrdering<int> > solver;
-    Eigen::LeastSquaresConjugateGradient<spMat > solver;
-    Eigen::VectorXd sol(this->vertices.size() * 2);
-    solver.compute(A);
-    sol = solver.solve(-rhs);
+    //    the normal equations are symmetric positive definite as soon as two pins are fixed,
+    //    the iterative least squares solver is only used if the factorization fails
+    Eigen::VectorXd sol;
+    spMat A_t = A.transpose();
+    this->lscm_solver.factorize(A_t * A);
+    if (this->lscm_solver.solver.info() == Eigen::Success)
+    {
+        sol = this->lscm_solver.solver.solve(A_t * -rhs);
+    }
+    else
+    {
+        Eigen::LeastSquaresConjugateGradient<spMat > solver;
+        solver.compute(A);
+        sol = solver.solveWithGuess(-rhs, this->get_lscm_guess());
+    }
 
     // TODO: create function, is needed also in the fem step
     this->set_position(sol);
@@ -490,7 +562,23 @@ void LscmRelax::lscm()
     this->transform(true);
     // this->rotate_by_min_bound_area();
     this->set_q_l_m();
+    this->has_flat_solution = true;
+}
 
+Eigen::VectorXd LscmRelax::get_lscm_guess()
+{
+    // start with the previous solution of the free vertices if there is one
+    long free_count = this->vertices.cols() - static_cast<long>(this->fixed_pins.size());
+    Eigen::VectorXd guess = Eigen::VectorXd::Zero(free_count * 2);
+    if (this->has_flat_solution)
+    {
+        for (long i=0; i < free_count; i++)
+        {
+            guess[i * 2] = this->flat_vertices(0, this->old_order[i]);
+            guess[i * 2 + 1] = this->flat_vertices(1, this->old_order[i]);
+        }
+    }
+    return guess;
 }
 
 void LscmRelax::set_q_l_g()
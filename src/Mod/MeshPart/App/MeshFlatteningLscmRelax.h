@@ -41,6 +41,8 @@
 #include <tuple>
 #include <vector>
 
+#include <Eigen/SparseCholesky>
+
 #include "MeshFlattening.h"
 
 
@@ -70,6 +72,29 @@ class NullSpaceProjector: public Eigen::IdentityPreconditioner
 using Vector3 = Eigen::Vector3d;
 using Vector2 = Eigen::Vector2d;
 
+// sparse LDLT solver that only computes the symbolic factorization again
+// if the sparsity pattern of the factorized matrix has changed
+class ReusableLDLT
+{
+  public:
+    Eigen::SimplicialLDLT<spMat, Eigen::Lower> solver;
+
+    ReusableLDLT() = default;
+    // the solver can't be copied, a copy starts without factorization
+    ReusableLDLT(const ReusableLDLT&) {}
+    ReusableLDLT& operator=(const ReusableLDLT&) {
+        this->outer_pattern.clear();
+        this->inner_pattern.clear();
+        return *this;
+    }
+
+    void factorize(const spMat& mat);
+
+  private:
+    std::vector<spMat::StorageIndex> outer_pattern;
+    std::vector<spMat::StorageIndex> inner_pattern;
+};
+
 class LscmRelax{
 private:
     ColMat<double, 3> q_l_g;  // the position of the 3d triangles at there locale coord sys
@@ -87,8 +112,16 @@ private:
     Eigen::Matrix<double, 3, 3> C;
     Eigen::VectorXd sol;
 
+    // the sparsity patterns of the systems don't change between the steps,
+    // so their symbolic factorizations are only computed once
+    ReusableLDLT lscm_solver;
+    ReusableLDLT relax_solver;
+    // true as soon as flat_vertices holds a solution that can be used as start value
+    bool has_flat_solution = false;
+
     std::vector<long> get_fem_fixed_pins();
     Eigen::MatrixXd get_nullspace();
+    Eigen::VectorXd get_lscm_guess();
 
 public:
     LscmRelax() = default;
@@ -26,6 +26,7 @@
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <IMeshTools_Parameters.hxx>
 #include <Standard_Version.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -228,7 +229,15 @@ Mesh::MeshObject* Mesher::createStandard() const
 {
     if (!shape.IsNull()) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+
+        // The edges are discretized first and shared by the adjacent faces, so the faces can be
+        // meshed independently without losing the watertightness
+        IMeshTools_Parameters meshParams;
+        meshParams.Deflection = deflection;
+        meshParams.Relative = relative;
+        meshParams.Angle = angularDeflection;
+        meshParams.InParallel = parallel;
+        BRepMesh_IncrementalMesh aMesh(shape, meshParams);
     }
 
     std::vector<Part::TopoShape::Domain> domains;
@@ -144,6 +144,15 @@ public:
     {
         return segments;
     }
+    /// Mesh the faces of the standard mesher in parallel
+    void setParallel(bool s)
+    {
+        parallel = s;
+    }
+    bool isParallel() const
+    {
+        return parallel;
+    }
     void setColors(const std::vector<uint32_t>& c)
     {
         colors = c;
@@ -230,6 +239,7 @@ private:
     bool relative {false};
     bool regular {false};
     bool segments {false};
+    bool parallel {true};
 #if defined(HAVE_NETGEN)
     int fineness {5};
     double growthRate {0};
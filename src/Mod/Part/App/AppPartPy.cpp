@@ -85,6 +85,7 @@
 #include <Base/VectorPy.h>
 
 #include "BSplineSurfacePy.h"
+#include "CrossSection.h"
 #include "edgecluster.h"
 #include "FaceMaker.h"
 #include "GeometryCurvePy.h"
@@ -96,6 +97,7 @@
 #include "OCCError.h"
 #include "PartFeature.h"
 #include "PartPyCXX.h"
+#include "PlanePy.h"
 #include "Tools.h"
 #include "TopoShapeCompoundPy.h"
 #include "TopoShapePy.h"
@@ -661,6 +663,14 @@ public:
             "makeWireString(string,fontdir,fontfile,height,[track]) -- Make list of wires in the "
             "form of a string's characters."
         );
+        add_varargs_method(
+            "makeCrossSections",
+            &Module::makeCrossSections,
+            "makeCrossSections(shape, planes) -> Compound\n"
+            "Slices the shape with each plane, in parallel\n\n"
+            "planes: list of Part.Plane or (base, normal) vector tuples\n"
+            "The result has one compound of section wires per plane, in the order of the planes."
+        );
         add_varargs_method(
             "makeSplitShape",
             &Module::makeSplitShape,
@@ -743,6 +753,19 @@ public:
             &Module::clearShapeCache,
             "clearShapeCache() -- Clears internal shape cache"
         );
+        add_varargs_method(
+            "getShapeCacheStatistics",
+            &Module::getShapeCacheStatistics,
+            "getShapeCacheStatistics([reset=False]) -- Returns a dict with the hits, misses,\n"
+            "evictions, entries, size and size limit in bytes of the internal shape cache.\n"
+            "If reset is True the counters are set to zero afterwards."
+        );
+        add_varargs_method(
+            "setShapeCacheLimit",
+            &Module::setShapeCacheLimit,
+            "setShapeCacheLimit(bytes) -- Sets the memory budget shared by the shape caches of\n"
+            "all objects, 0 for no limit. The least recently used entries are evicted first."
+        );
         add_keyword_method(
             "getShape",
             &Module::getShape,
@@ -2248,6 +2271,56 @@ private:
         );
     }
 
+    Py::Object makeCrossSections(const Py::Tuple& args)
+    {
+        PyObject* shape;
+        PyObject* pyPlanes;
+        if (!PyArg_ParseTuple(args.ptr(), "O!O", &(TopoShapePy::Type), &shape, &pyPlanes)) {
+            throw Py::Exception();
+        }
+
+        try {
+            std::vector<gp_Pln> planes;
+            Py::Sequence seq(pyPlanes);
+            for (Py::Sequence::iterator it = seq.begin(); it != seq.end(); ++it) {
+                PyObject* item = (*it).ptr();
+                if (PyObject_TypeCheck(item, &PlanePy::Type)) {
+                    Handle(Geom_Plane) plane = Handle(Geom_Plane)::DownCast(
+                        static_cast<GeometryPy*>(item)->getGeometryPtr()->handle()
+                    );
+                    planes.push_back(plane->Pln());
+                }
+                else {
+                    Py::Tuple tuple(*it);
+                    planes.emplace_back(
+                        Base::convertTo<gp_Pnt>(Py::Vector(tuple[0]).toVector()),
+                        Base::convertTo<gp_Dir>(Py::Vector(tuple[1]).toVector())
+                    );
+                }
+            }
+
+            const TopoDS_Shape& input = static_cast<TopoShapePy*>(shape)->getTopoShapePtr()->getShape();
+            std::vector<std::list<TopoDS_Wire>> sections = CrossSections(input).slice(planes);
+
+            BRep_Builder builder;
+            TopoDS_Compound comp;
+            builder.MakeCompound(comp);
+            for (const auto& wires : sections) {
+                TopoDS_Compound section;
+                builder.MakeCompound(section);
+                for (const auto& wire : wires) {
+                    if (!wire.IsNull()) {
+                        builder.Add(section, wire);
+                    }
+                }
+                builder.Add(comp, section);
+            }
+            return shape2pyshape(comp);
+        }
+        catch (Standard_Failure& e) {
+            throw Py::Exception(PartExceptionOCCError, e.GetMessageString());
+        }
+    }
     Py::Object makeSplitShape(const Py::Tuple& args)
     {
         PyObject* shape;
@@ -2726,6 +2799,36 @@ private:
         return Py::Object();
     }
 
+    Py::Object getShapeCacheStatistics(const Py::Tuple& args)
+    {
+        PyObject* reset = Py_False;
+        if (!PyArg_ParseTuple(args.ptr(), "|O!", &PyBool_Type, &reset)) {
+            throw Py::Exception();
+        }
+        auto stats = Part::PropertyShapeCache::getStatistics();
+        if (Base::asBoolean(reset)) {
+            Part::PropertyShapeCache::resetStatistics();
+        }
+        Py::Dict dict;
+        dict.setItem("Hits", Py::Long(static_cast<unsigned long>(stats.hits)));
+        dict.setItem("Misses", Py::Long(static_cast<unsigned long>(stats.misses)));
+        dict.setItem("Evictions", Py::Long(static_cast<unsigned long>(stats.evictions)));
+        dict.setItem("Entries", Py::Long(static_cast<unsigned long>(stats.entries)));
+        dict.setItem("Size", Py::Long(static_cast<unsigned long>(stats.memSize)));
+        dict.setItem("Limit", Py::Long(static_cast<unsigned long>(stats.memLimit)));
+        return dict;
+    }
+
+    Py::Object setShapeCacheLimit(const Py::Tuple& args)
+    {
+        unsigned long long bytes;
+        if (!PyArg_ParseTuple(args.ptr(), "K", &bytes)) {
+            throw Py::Exception();
+        }
+        Part::PropertyShapeCache::setMemLimit(static_cast<std::size_t>(bytes));
+        return Py::Object();
+    }
+
     Py::Object splitSubname(const Py::Tuple& args)
     {
         const char* subname;
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 #include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
@@ -43,6 +44,8 @@
 #include <TopoDS_Wire.hxx>
 
 
+#include <Base/Parallel.h>
+
 #include "CrossSection.h"
 #include "TopoShapeOpCode.h"
 
@@ -75,7 +78,7 @@ std::list<TopoDS_Wire> CrossSection::slice(double d) const
     return removeDuplicates(wires);
 }
 
-std::list<TopoDS_Wire> CrossSection::removeDuplicates(const std::list<TopoDS_Wire>& wires) const
+std::list<TopoDS_Wire> CrossSection::removeDuplicates(const std::list<TopoDS_Wire>& wires)
 {
     std::list<TopoDS_Wire> wires_reduce;
     for (const auto& wire : wires) {
@@ -232,6 +235,54 @@ TopoDS_Wire CrossSection::fixWire(const TopoDS_Wire& wire) const
     return aFix.Wire();
 }
 
+CrossSections::CrossSections(const TopoDS_Shape& s)
+{
+    // Same sub shapes as CrossSection::slice()
+    auto addSubShape = [this](const TopoDS_Shape& shape) {
+        SubShape sub;
+        sub.shape = shape;
+        BRepBndLib::Add(shape, sub.bounds);
+        sub.bounds.Enlarge(Precision::Confusion());
+        subShapes.push_back(sub);
+    };
+    TopExp_Explorer xp;
+    for (xp.Init(s, TopAbs_SOLID); xp.More(); xp.Next()) {
+        addSubShape(xp.Current());
+    }
+    for (xp.Init(s, TopAbs_SHELL, TopAbs_SOLID); xp.More(); xp.Next()) {
+        addSubShape(xp.Current());
+    }
+    for (xp.Init(s, TopAbs_FACE, TopAbs_SHELL); xp.More(); xp.Next()) {
+        addSubShape(xp.Current());
+    }
+}
+
+std::list<TopoDS_Wire> CrossSections::slice(const gp_Pln& plane) const
+{
+    double a, b, c, d;
+    plane.Coefficients(a, b, c, d);
+
+    std::list<TopoDS_Wire> wires;
+    for (const auto& sub : subShapes) {
+        if (sub.bounds.IsOut(plane)) {
+            continue;
+        }
+        CrossSection cs(a, b, c, sub.shape);
+        wires.splice(wires.end(), cs.slice(-d));
+    }
+
+    return CrossSection::removeDuplicates(wires);
+}
+
+std::vector<std::list<TopoDS_Wire>> CrossSections::slice(const std::vector<gp_Pln>& planes) const
+{
+    std::vector<std::list<TopoDS_Wire>> result(planes.size());
+    Base::parallelFor(planes.size(), [&](std::size_t index) {
+        result[index] = slice(planes[index]);
+    });
+    return result;
+}
+
 TopoCrossSection::TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op)
     : a(a)
     , b(b)
@@ -25,6 +25,9 @@
 #pragma once
 
 #include <list>
+#include <vector>
+#include <Bnd_Box.hxx>
+#include <gp_Pln.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <Mod/Part/PartGlobal.h>
 #include "TopoShape.h"
@@ -48,11 +51,35 @@ private:
     void connectEdges(const std::list<TopoDS_Edge>& edges, std::list<TopoDS_Wire>& wires) const;
     void connectWires(const TopTools_IndexedMapOfShape& wireMap, std::list<TopoDS_Wire>& wires) const;
     TopoDS_Wire fixWire(const TopoDS_Wire& wire) const;
-    std::list<TopoDS_Wire> removeDuplicates(const std::list<TopoDS_Wire>& wires) const;
+    static std::list<TopoDS_Wire> removeDuplicates(const std::list<TopoDS_Wire>& wires);
 
 private:
     double a, b, c;
     const TopoDS_Shape& s;
+
+    friend class CrossSections;
+};
+
+/** Cross sections of one shape with many planes
+ *
+ * The sub shapes to slice and their bounding boxes are collected once, so that each plane only
+ * slices the sub shapes it crosses. The planes are sliced in parallel.
+ */
+class PartExport CrossSections
+{
+public:
+    explicit CrossSections(const TopoDS_Shape& s);
+    /// Returns the section wires of each plane, in the order of the planes
+    std::vector<std::list<TopoDS_Wire>> slice(const std::vector<gp_Pln>& planes) const;
+    std::list<TopoDS_Wire> slice(const gp_Pln& plane) const;
+
+private:
+    struct SubShape
+    {
+        TopoDS_Shape shape;
+        Bnd_Box bounds;
+    };
+    std::vector<SubShape> subShapes;
 };
 
 class PartExport TopoCrossSection
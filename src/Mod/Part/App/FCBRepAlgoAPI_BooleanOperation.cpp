@@ -36,11 +36,16 @@
 #include <Precision.hxx>
 #include <FuzzyHelper.h>
 #include <SignalException.h>
+#include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/Parameter.h>
+
+#include <algorithm>
+#include <vector>
 
 FCBRepAlgoAPI_BooleanOperation::FCBRepAlgoAPI_BooleanOperation()
 {
-    SetRunParallel(Standard_True);
+    SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     SetNonDestructive(Standard_True);
 }
 
@@ -61,7 +66,7 @@ FCBRepAlgoAPI_BooleanOperation::FCBRepAlgoAPI_BooleanOperation(
     }
 
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     SetNonDestructive(Standard_True);
 }
 
@@ -96,6 +101,97 @@ void FCBRepAlgoAPIHelper::setAutoFuzzy(BRepAlgoAPI_BuilderAlgo* op)
     );
 }
 
+namespace
+{
+ParameterGrp::handle getBooleanParameter()
+{
+    return App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/Boolean"
+    );
+}
+
+// Collects the non compound shapes, returns false if any of them is not a solid
+bool collectSolids(const TopoDS_Shape& shape, std::vector<TopoDS_Shape>& solids)
+{
+    if (shape.IsNull()) {
+        return true;
+    }
+    if (shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            if (!collectSolids(it.Value(), solids)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (shape.ShapeType() != TopAbs_SOLID) {
+        return false;
+    }
+    solids.push_back(shape);
+    return true;
+}
+}  // namespace
+
+bool FCBRepAlgoAPIHelper::runParallel()
+{
+    return getBooleanParameter()->GetBool("RunParallel", true);
+}
+
+bool FCBRepAlgoAPIHelper::setAutoGlue(BRepAlgoAPI_BooleanOperation* op)
+{
+    if (op->Operation() != BOPAlgo_FUSE || op->Glue() != BOPAlgo_GlueOff
+        || !getBooleanParameter()->GetBool("AutoGlue", false)) {
+        return false;
+    }
+
+    std::vector<TopoDS_Shape> solids;
+    for (TopTools_ListOfShape::Iterator it(op->Arguments()); it.More(); it.Next()) {
+        if (!collectSolids(it.Value(), solids)) {
+            return false;
+        }
+    }
+    for (TopTools_ListOfShape::Iterator it(op->Tools()); it.More(); it.Next()) {
+        if (!collectSolids(it.Value(), solids)) {
+            return false;
+        }
+    }
+    if (solids.size() < 2) {
+        return false;
+    }
+
+    std::vector<Bnd_Box> bounds(solids.size());
+    for (std::size_t i = 0; i < solids.size(); ++i) {
+        BRepBndLib::Add(solids[i], bounds[i]);
+        if (bounds[i].IsVoid()) {
+            return false;
+        }
+    }
+
+    // Boxes overlapping by less than this on any axis only touch. The boxes are
+    // enlarged by the shape tolerance, and the fuzzy value merges close faces.
+    const double touching = 10 * Precision::Confusion() + 2 * op->FuzzyValue();
+    auto overlaps = [touching](const Bnd_Box& b1, const Bnd_Box& b2) {
+        double xmin1, ymin1, zmin1, xmax1, ymax1, zmax1;
+        double xmin2, ymin2, zmin2, xmax2, ymax2, zmax2;
+        b1.Get(xmin1, ymin1, zmin1, xmax1, ymax1, zmax1);
+        b2.Get(xmin2, ymin2, zmin2, xmax2, ymax2, zmax2);
+        return std::min(xmax1, xmax2) - std::max(xmin1, xmin2) > touching
+            && std::min(ymax1, ymax2) - std::max(ymin1, ymin2) > touching
+            && std::min(zmax1, zmax2) - std::max(zmin1, zmin2) > touching;
+    };
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        for (std::size_t j = i + 1; j < bounds.size(); ++j) {
+            if (overlaps(bounds[i], bounds[j])) {
+                return false;
+            }
+        }
+    }
+
+    // The solids can only share faces, glue them instead of intersecting
+    op->SetGlue(BOPAlgo_GlueShift);
+    return true;
+}
+
 void FCBRepAlgoAPI_BooleanOperation::Build()
 {
     Message_ProgressRange progressRange;
@@ -127,11 +223,16 @@ void FCBRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& progress
         myArguments = myOriginalArguments;
     }
     else {
+        // only for this run, a fuse of the tools may be followed by a cut
+        bool glued = FCBRepAlgoAPIHelper::setAutoGlue(this);
 #if OCC_VERSION_HEX >= 0x070600
         BRepAlgoAPI_BooleanOperation::Build(progressRange);
 #else
         BRepAlgoAPI_BooleanOperation::Build();
 #endif
+        if (glued) {
+            SetGlue(BOPAlgo_GlueOff);
+        }
     }
     if (progressRange.UserBreak()) {
         Standard_ConstructionError::Raise("User aborted");
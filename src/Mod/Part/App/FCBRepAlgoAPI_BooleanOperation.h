@@ -36,6 +36,14 @@ class FCBRepAlgoAPIHelper
 public:
     static void setAutoFuzzy(BRepAlgoAPI_BooleanOperation* op);
     static void setAutoFuzzy(BRepAlgoAPI_BuilderAlgo* op);
+
+    // whether boolean operations run in OCCT parallel mode, see parameter RunParallel in
+    // Mod/Part/Boolean (default true)
+    static bool runParallel();
+
+    // turn on BOPAlgo_GlueShift for a fuse of solids whose bounding boxes at most touch, see
+    // parameter AutoGlue in Mod/Part/Boolean (default false). Returns true if glue was turned on.
+    static bool setAutoGlue(BRepAlgoAPI_BooleanOperation* op);
 };
 
 class FCBRepAlgoAPI_BooleanOperation: public BRepAlgoAPI_BooleanOperation
@@ -36,7 +36,7 @@
 
 FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section()
 {
-    SetRunParallel(Standard_True);
+    SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     SetNonDestructive(Standard_True);
 }
 
@@ -54,7 +54,7 @@ FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section(
         Standard_ConstructionError::Raise("Tool shape is not valid for boolean operation");
     }
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     SetNonDestructive(Standard_True);
     if (PerformNow) {
         Build();
@@ -72,7 +72,7 @@ FCBRepAlgoAPI_Section::FCBRepAlgoAPI_Section(
         Standard_ConstructionError::Raise("Base shape is not valid for boolean operation");
     }
     setAutoFuzzy();
-    SetRunParallel(Standard_True);
+    SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     if (PerformNow) {
         Build();
     }
@@ -38,6 +38,8 @@
 #include <QtGlobal>
 #include <TopExp.hxx>
 
+#include <boost/geometry.hpp>
+
 #include "FaceMakerBullseye.h"
 #include "FaceMakerCheese.h"
 
@@ -47,6 +49,9 @@
 
 using namespace Part;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
 TYPESYSTEM_SOURCE(Part::FaceMakerBullseye, Part::FaceMakerPublic)
 
 void FaceMakerBullseye::setPlane(const gp_Pln& plane)
@@ -180,6 +185,25 @@ void FaceMakerBullseye::Build_Essence()
 }
 
 
+struct FaceMakerBullseye::FaceDriller::HoleIndex
+{
+    static constexpr int maxElements = 16;
+
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    // the box of a hole wire and a face bounded by it
+    using Value = std::pair<Box, TopoDS_Face>;
+
+    bgi::rtree<Value, bgi::linear<maxElements>> rtree;
+
+    static Box toBox(const Bnd_Box& box)
+    {
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        return {Point(xMin, yMin, zMin), Point(xMax, yMax, zMax)};
+    }
+};
+
 FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire outerWire)
 {
     this->myPlane = plane;
@@ -195,8 +219,12 @@ FaceMakerBullseye::FaceDriller::FaceDriller(const gp_Pln& plane, TopoDS_Wire out
     builder.MakeFace(this->myFace, myHPlane, Precision::Confusion());
     builder.Add(this->myFace, outerWire);
     this->myTopoFace = TopoShape(this->myFace);
+
+    BRepBndLib::Add(outerWire, myOuterBound);
 }
 
+FaceMakerBullseye::FaceDriller::~FaceDriller() = default;
+
 FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
     const TopoShape& shape
 ) const
@@ -218,6 +246,14 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
 
     double tol = BRep_Tool::Tolerance(vertex);
     auto point = BRep_Tool::Pnt(vertex);
+
+    // A point outside the box of the outer wire is outside of both classifications below
+    Bnd_Box outerBound = myOuterBound;
+    outerBound.Enlarge(tol);
+    if (outerBound.IsOut(point)) {
+        return HitTest::HitNone;
+    }
+
     double u, v;
     GeomAPI_ProjectPointOnSurf(point, myHPlane).LowerDistanceParameters(u, v);
     const char* err = "FaceMakerBullseye::FaceDriller::hitTest: result unknown";
@@ -234,6 +270,35 @@ FaceMakerBullseye::FaceDriller::HitTest FaceMakerBullseye::FaceDriller::hitTest(
             default:
                 throw Base::ValueError(err);
         }
+
+        // The point is inside the outer wire, so it is off the face only if it is inside one of
+        // the holes. Classifying against the holes whose box contains the point is the same as
+        // classifying against the whole face, without going through all of its wires.
+        if (myHoleIndex) {
+            Bnd_Box pointBound;
+            pointBound.Add(point);
+            pointBound.Enlarge(tol);
+            for (auto it = myHoleIndex->rtree.qbegin(
+                     bgi::intersects(HoleIndex::toBox(pointBound))
+                 );
+                 it != myHoleIndex->rtree.qend();
+                 ++it) {
+                BRepClass_FaceClassifier holeCl(it->second, gp_Pnt2d(u, v), tol);
+                switch (holeCl.State()) {
+                    case TopAbs_IN:
+                        // inside a hole
+                        return hit;
+                    case TopAbs_ON:
+                        // on a hole wire, see below
+                        return HitTest::Hit;
+                    case TopAbs_OUT:
+                        break;
+                    default:
+                        throw Base::ValueError(err);
+                }
+            }
+            return HitTest::Hit;
+        }
     }
     BRepClass_FaceClassifier cl(myFace, gp_Pnt2d(u, v), tol);
     TopAbs_State ret = cl.State();
@@ -279,6 +344,21 @@ void FaceMakerBullseye::FaceDriller::addHole(TopoDS_Wire w)
 
     BRep_Builder builder;
     builder.Add(this->myFace, w);
+    indexHole(w);
+}
+
+void FaceMakerBullseye::FaceDriller::indexHole(const TopoDS_Wire& w)
+{
+    if (!myHoleIndex) {
+        myHoleIndex = std::make_unique<HoleIndex>();
+    }
+    Bnd_Box box;
+    BRepBndLib::Add(w, box);
+    if (box.IsVoid()) {
+        return;
+    }
+    TopoDS_Face face = BRepBuilderAPI_MakeFace(myHPlane, w);
+    myHoleIndex->rtree.insert(std::make_pair(HoleIndex::toBox(box), face));
 }
 
 void FaceMakerBullseye::FaceDriller::addHole(const WireInfo& wireInfo, std::vector<TopoShape>& sources)
@@ -319,6 +399,10 @@ void FaceMakerBullseye::FaceDriller::addHole(const WireInfo& wireInfo, std::vect
                 }
             }
             copyFaceBound(this->myFace, this->myTopoFace, this->myTopoFaceBound);
+            // myFace has been reset to the outer wire, the merged holes are added below
+            if (myHoleIndex) {
+                myHoleIndex->rtree.clear();
+            }
             wire = hole;
         }
     }
@@ -332,6 +416,7 @@ void FaceMakerBullseye::FaceDriller::addHole(const WireInfo& wireInfo, std::vect
         else {
             builder.Add(this->myFace, TopoDS::Wire(w));
         }
+        indexHole(TopoDS::Wire(w));
     }
 }
 
@@ -96,6 +96,7 @@ protected:
     {
     public:
         FaceDriller(const gp_Pln& plane, TopoDS_Wire outerWire);
+        ~FaceDriller();
 
         /// Hit test result
         enum class HitTest
@@ -133,6 +134,9 @@ protected:
         static int getWireDirection(const gp_Pln& plane, const TopoDS_Wire& w);
 
     private:
+        /// Adds a hole wire of myFace to the hole index
+        void indexHole(const TopoDS_Wire& w);
+
         gp_Pln myPlane;
         TopoDS_Face myFace;
         TopoDS_Face myFaceBound;
@@ -141,6 +145,11 @@ protected:
         std::vector<WireInfo> myHoles;
         Handle(Geom_Surface) myHPlane;
         std::unique_ptr<WireJoiner> myJoiner;
+        Bnd_Box myOuterBound;
+        // bounding box tree of the holes of myFace, to classify points against the nearby holes
+        // only
+        struct HoleIndex;
+        std::unique_ptr<HoleIndex> myHoleIndex;
     };
 };
 
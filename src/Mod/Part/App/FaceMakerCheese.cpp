@@ -44,12 +44,66 @@
 #include <TopTools_HSequenceOfShape.hxx>
 #include <QtGlobal>
 
+#include <boost/geometry.hpp>
+
 
 #include "FaceMakerCheese.h"
 
 
 using namespace Part;
 
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+/// Classifies wires against the face bounded by a wire, the face is only built once
+class WireClassifier
+{
+public:
+    explicit WireClassifier(const TopoDS_Wire& wire)
+    {
+        BRepBuilderAPI_MakeFace mkFace(wire);
+        if (!mkFace.IsDone()) {
+            Standard_Failure::Raise("Failed to create a face from wire in sketch");
+        }
+        TopoDS_Face face = FaceMakerCheese::validateFace(mkFace.Face());
+        BRepAdaptor_Surface adapt(face);
+        class2d.Init(face, Precision::Confusion());
+        Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
+        surface = new ShapeAnalysis_Surface(surf);
+    }
+
+    /// returns true if the first vertex of the wire is inside the face
+    bool isInside(const TopoDS_Wire& wire)
+    {
+        TopExp_Explorer xp(wire, TopAbs_VERTEX);
+        if (!xp.More()) {
+            return false;
+        }
+        // TODO: We can make a check to see if all points are inside or all outside
+        // because otherwise we have some intersections which is not allowed
+        gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(xp.Current()));
+        gp_Pnt2d uv = surface->ValueOfUV(p, Precision::Confusion());
+        return class2d.Perform(uv) == TopAbs_IN;
+    }
+
+private:
+    IntTools_FClass2d class2d;
+    Handle(ShapeAnalysis_Surface) surface;
+};
+
+Bnd_Box getWireBound(const TopoDS_Wire& wire)
+{
+    Bnd_Box box;
+    if (!wire.IsNull()) {
+        BRepBndLib::Add(wire, box);
+        box.SetGap(0.0);
+    }
+    return box;
+}
+}  // namespace
+
 TYPESYSTEM_SOURCE(Part::FaceMakerCheese, Part::FaceMakerPublic)
 
 
@@ -100,63 +154,16 @@ TopoDS_Face FaceMakerCheese::validateFace(const TopoDS_Face& face)
 
 bool FaceMakerCheese::Wire_Compare::operator()(const TopoDS_Wire& w1, const TopoDS_Wire& w2)
 {
-    Bnd_Box box1, box2;
-    if (!w1.IsNull()) {
-        BRepBndLib::Add(w1, box1);
-        box1.SetGap(0.0);
-    }
-
-    if (!w2.IsNull()) {
-        BRepBndLib::Add(w2, box2);
-        box2.SetGap(0.0);
-    }
-
-    return box1.SquareExtent() < box2.SquareExtent();
+    return getWireBound(w1).SquareExtent() < getWireBound(w2).SquareExtent();
 }
 
 bool FaceMakerCheese::isInside(const TopoDS_Wire& wire1, const TopoDS_Wire& wire2)
 {
-    Bnd_Box box1;
-    BRepBndLib::Add(wire1, box1);
-    box1.SetGap(0.0);
-
-    Bnd_Box box2;
-    BRepBndLib::Add(wire2, box2);
-    box2.SetGap(0.0);
-
-    if (box1.IsOut(box2)) {
+    if (getWireBound(wire1).IsOut(getWireBound(wire2))) {
         return false;
     }
 
-    double prec = Precision::Confusion();
-
-    BRepBuilderAPI_MakeFace mkFace(wire1);
-    if (!mkFace.IsDone()) {
-        Standard_Failure::Raise("Failed to create a face from wire in sketch");
-    }
-    TopoDS_Face face = validateFace(mkFace.Face());
-    BRepAdaptor_Surface adapt(face);
-    IntTools_FClass2d class2d(face, prec);
-    Handle(Geom_Surface) surf = new Geom_Plane(adapt.Plane());
-    ShapeAnalysis_Surface as(surf);
-
-    TopExp_Explorer xp(wire2, TopAbs_VERTEX);
-    while (xp.More()) {
-        TopoDS_Vertex v = TopoDS::Vertex(xp.Current());
-        gp_Pnt p = BRep_Tool::Pnt(v);
-        gp_Pnt2d uv = as.ValueOfUV(p, prec);
-        if (class2d.Perform(uv) == TopAbs_IN) {
-            return true;
-        }
-        // TODO: We can make a check to see if all points are inside or all outside
-        // because otherwise we have some intersections which is not allowed
-        else {
-            return false;
-        }
-        // xp.Next();
-    }
-
-    return false;
+    return WireClassifier(wire1).isInside(wire2);
 }
 
 TopoDS_Shape FaceMakerCheese::makeFace(std::list<TopoDS_Wire>& wires)
@@ -202,27 +209,68 @@ TopoDS_Shape FaceMakerCheese::makeFace(const std::vector<TopoDS_Wire>& w)
 
     // FIXME: Need a safe method to sort wire that the outermost one comes last
     //  Currently it's done with the diagonal lengths of the bounding boxes
-    std::vector<TopoDS_Wire> wires = w;
-    std::sort(wires.begin(), wires.end(), Wire_Compare());
-    std::list<TopoDS_Wire> wire_list;
-    wire_list.insert(wire_list.begin(), wires.rbegin(), wires.rend());
+    std::vector<std::pair<TopoDS_Wire, Bnd_Box>> wires;
+    wires.reserve(w.size());
+    for (const auto& wire : w) {
+        wires.emplace_back(wire, getWireBound(wire));
+    }
+    std::sort(wires.begin(), wires.end(), [](const auto& w1, const auto& w2) {
+        return w1.second.SquareExtent() > w2.second.SquareExtent();
+    });
+
+    // The wires not assigned to a face yet are kept in a bounding box tree, so that each outer
+    // wire is only classified against the wires overlapping with it.
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, std::size_t>;
+    std::vector<Value> values;
+    values.reserve(wires.size());
+    for (std::size_t i = 0; i < wires.size(); ++i) {
+        if (wires[i].second.IsVoid()) {
+            continue;
+        }
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        wires[i].second.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        values.emplace_back(Box(Point(xMin, yMin, zMin), Point(xMax, yMax, zMax)), i);
+    }
+    bgi::rtree<Value, bgi::linear<16>> unassigned(values);
+    std::vector<Box> boxes(wires.size());
+    for (const auto& value : values) {
+        boxes[value.second] = value.first;
+    }
 
     // separate the wires into several independent faces
+    std::vector<bool> assigned(wires.size(), false);
     std::list<std::list<TopoDS_Wire>> sep_wire_list;
-    while (!wire_list.empty()) {
+    for (std::size_t i = 0; i < wires.size(); ++i) {
+        if (assigned[i]) {
+            continue;
+        }
+        assigned[i] = true;
+        const TopoDS_Wire& wire = wires[i].first;
         std::list<TopoDS_Wire> sep_list;
-        TopoDS_Wire wire = wire_list.front();
-        wire_list.pop_front();
         sep_list.push_back(wire);
 
-        std::list<TopoDS_Wire>::iterator it = wire_list.begin();
-        while (it != wire_list.end()) {
-            if (isInside(wire, *it)) {
-                sep_list.push_back(*it);
-                it = wire_list.erase(it);
-            }
-            else {
-                ++it;
+        if (!wires[i].second.IsVoid()) {
+            unassigned.remove(Value(boxes[i], i));
+
+            std::vector<Value> candidates;
+            unassigned.query(bgi::intersects(boxes[i]), std::back_inserter(candidates));
+            // keep the order of the sorted wires
+            std::sort(candidates.begin(), candidates.end(), [](const Value& v1, const Value& v2) {
+                return v1.second < v2.second;
+            });
+
+            std::unique_ptr<WireClassifier> classifier;
+            for (const auto& candidate : candidates) {
+                if (!classifier) {
+                    classifier = std::make_unique<WireClassifier>(wire);
+                }
+                if (classifier->isInside(wires[candidate.second].first)) {
+                    sep_list.push_back(wires[candidate.second].first);
+                    assigned[candidate.second] = true;
+                    unassigned.remove(candidate);
+                }
             }
         }
 
@@ -272,6 +272,26 @@ bool ImportExportSettings::getExpandCompound() const
     return pGroup->GetBool("ExpandCompound", false);
 }
 
+void ImportExportSettings::setDeduplicateShapes(bool on)
+{
+    pGroup->SetBool("DeduplicateShapes", on);
+}
+
+bool ImportExportSettings::getDeduplicateShapes() const
+{
+    return pGroup->GetBool("DeduplicateShapes", false);
+}
+
+void ImportExportSettings::setTessellationOnly(bool on)
+{
+    pGroup->SetBool("TessellationOnly", on);
+}
+
+bool ImportExportSettings::getTessellationOnly() const
+{
+    return pGroup->GetBool("TessellationOnly", false);
+}
+
 void ImportExportSettings::setShowProgress(bool on)
 {
     pGroup->SetBool("ShowProgress", on);
@@ -100,6 +100,12 @@ public:
     void setExpandCompound(bool);
     bool getExpandCompound() const;
 
+    void setDeduplicateShapes(bool);
+    bool getDeduplicateShapes() const;
+
+    void setTessellationOnly(bool);
+    bool getTessellationOnly() const;
+
     void setShowProgress(bool);
     bool getShowProgress() const;
 
@@ -921,7 +921,7 @@ void Feature::setMaterialAppearance(const App::Material& material)
 // Toponaming project March 2024:  This method should be going away when we get to the python layer.
 void Feature::clearShapeCache()
 {
-    //    _ShapeCache.cache.clear();
+    PropertyShapeCache::clearAll();
 }
 
 /*
@@ -1181,6 +1181,14 @@ static TopoShape _getTopoShape(
                 }
             }
         }
+        // If the caller does not want element maps, the array elements simply
+        // share the base shape at their own placement, which saves mapping
+        // the element names of every element. Such a compound is not cached,
+        // because other callers may need the element map.
+        bool plainElements = options.testFlag(ShapeOption::NoElementMap) && !baseShape.isNull();
+        if (plainElements) {
+            cacheable = false;
+        }
         for (auto& sub : owner->getSubObjects()) {
             if (sub.empty()) {
                 continue;
@@ -1245,6 +1253,10 @@ static TopoShape _getTopoShape(
                     continue;
                 }
             }
+            else if (plainElements && mat.hasScale() == Base::ScaleType::NoScaling
+                     && mat.determinant3() > 0.0) {
+                shape.setShape(TopoShape::moved(baseShape.getShape(), TopoShape::convert(mat)), false);
+            }
             else {
                 if (link && !link->getShowElementValue()) {
                     shape = baseShape.makeElementTransform(
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
@@ -58,13 +60,77 @@ using namespace Part;
 
 TYPESYSTEM_SOURCE(Part::PropertyPartShape, App::PropertyComplexGeoData)
 
+/// The content of a shape file that is read on first use, see restoreDocFileLazily()
+struct PropertyPartShape::LazyFile
+{
+    std::string Content;
+    std::string FileName;
+    int FileVersion {0};
+};
+
+namespace
+{
+std::mutex lazyFileMutex;
+}  // namespace
+
 PropertyPartShape::PropertyPartShape() = default;
 
 PropertyPartShape::~PropertyPartShape() = default;
 
+namespace
+{
+bool isSkippingIdenticalShapes()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    return hGrp->GetBool("SkipIdenticalShapes", true);
+}
+
+bool isIdenticalShape(const TopoShape& shape, const TopoShape& other)
+{
+    if (shape.Tag != other.Tag || shape.Hasher != other.Hasher) {
+        return false;
+    }
+    if (!shape.getShape().IsEqual(other.getShape())
+        && (shape.isNull() || other.isNull() || shape.getFingerprint() != other.getFingerprint())) {
+        return false;
+    }
+    return shape.getElementMapSize() == other.getElementMapSize()
+        && shape.getElementMap() == other.getElementMap();
+}
+}  // namespace
+
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
+    if (_LazyPending) {
+        std::lock_guard<std::mutex> lock(lazyFileMutex);
+        _LazyFile.reset();
+        _LazyPending = false;
+    }
+
+    TopoShape previous(_Shape);
+    assignShape(sh);
+    if (isSkippingIdenticalShapes() && isIdenticalShape(previous, _Shape)) {
+        // Keep the new shape, but spare the container and its dependents a change of a shape
+        // they already have, e.g. after a recompute giving the same result.
+        auto obj = freecad_cast<App::DocumentObject*>(getContainer());
+        if (obj && obj->isRecomputing()) {
+            obj->setStatus(App::ObjectStatus::OutputUnchanged, true);
+        }
+        return;
+    }
+
+    TopoShape assigned(std::move(_Shape));
+    _Shape = std::move(previous);
     aboutToSetValue();
+    _Shape = std::move(assigned);
+    hasSetValue();
+    _Ver.clear();
+}
+
+void PropertyPartShape::assignShape(const TopoShape& sh)
+{
     _Shape = sh;
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if (obj) {
@@ -88,12 +154,11 @@ void PropertyPartShape::setValue(const TopoShape& sh)
             _Shape.hashChildMaps();
         }
     }
-    hasSetValue();
-    _Ver.clear();
 }
 
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
+    loadLazily();
     aboutToSetValue();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if (obj) {
@@ -106,11 +171,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    loadLazily();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    loadLazily();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -127,12 +194,14 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    loadLazily();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
 
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
+    loadLazily();
     Base::BoundBox3d box;
     if (_Shape.getShape().IsNull()) {
         return box;
@@ -160,16 +229,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D& rclTrf)
 {
+    loadLazily();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    loadLazily();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 {
+    loadLazily();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -177,6 +249,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 
 PyObject* PropertyPartShape::getPyObject()
 {
+    loadLazily();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop) {
         prop->setConst();
@@ -215,6 +288,7 @@ void PropertyPartShape::setPyObject(PyObject* value)
 
 App::Property* PropertyPartShape::Copy() const
 {
+    loadLazily();
     PropertyPartShape* prop = new PropertyPartShape();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
@@ -233,6 +307,7 @@ void PropertyPartShape::Paste(const App::Property& from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if (prop) {
+        prop->loadLazily();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -240,6 +315,12 @@ void PropertyPartShape::Paste(const App::Property& from)
 
 unsigned int PropertyPartShape::getMemSize() const
 {
+    if (_LazyPending) {
+        std::lock_guard<std::mutex> lock(lazyFileMutex);
+        if (_LazyFile) {
+            return static_cast<unsigned int>(_LazyFile->Content.size());
+        }
+    }
     return _Shape.getMemSize();
 }
 
@@ -351,6 +432,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier>& paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    loadLazily();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
@@ -361,8 +443,42 @@ void PropertyPartShape::beforeSave() const
         _Shape.beforeSave();
     }
 }
+namespace
+{
+// Decides whether the shape is saved in the binary BinTools format.
+// In "BinaryBrepAuto" mode solids and compounds are saved binary, where the
+// text format is slow to parse, while simple shapes like wires or edges stay
+// in the text format.
+bool useBinaryBrep(const Base::Writer& writer, const TopoDS_Shape& shape)
+{
+    if (writer.getMode("BinaryBrep")) {
+        return true;
+    }
+    if (writer.getMode("BinaryBrepAuto")) {
+        return !shape.IsNull() && shape.ShapeType() <= TopAbs_SHELL;
+    }
+    return false;
+}
+
+// The format is detected from the content and not from the file extension.
+// A file written by BinTools starts with "Open CASCADE Topology", a text BREP
+// file with "CASCADE Topology" or the "DBRep_DrawableShape" header.
+bool isBinaryBrep(std::istream& str)
+{
+    return str.peek() == 'O';
+}
+
+bool saveTriangulation()
+{
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("SaveBinaryTriangulation", true);
+}
+}  // namespace
+
 void PropertyPartShape::Save(Base::Writer& writer) const
 {
+    loadLazily();
     // See SaveDocFile(), RestoreDocFile()
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
@@ -385,7 +501,7 @@ void PropertyPartShape::Save(Base::Writer& writer) const
     }
     writer.Stream() << " ElementMap=\"" << version << '"';
 
-    bool binary = writer.getMode("BinaryBrep");
+    bool binary = useBinaryBrep(writer, _Shape.getShape());
     bool toXML = writer.isForceXML();
     if (!toXML) {
         writer.Stream() << " file=\""
@@ -710,16 +826,17 @@ void PropertyPartShape::loadFromStream(Base::Reader& reader)
 
 void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
 {
+    loadLazily();
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull()) {
         return;
     }
     TopoDS_Shape myShape = _Shape.getShape();
-    if (writer.getMode("BinaryBrep")) {
+    if (useBinaryBrep(writer, myShape)) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), saveTriangulation());
     }
     else {
         bool direct = App::GetApplication()
@@ -743,7 +860,6 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
     auto elementMap = _Shape.resetElementMap();
     auto hasher = _Shape.Hasher;
 
-    Base::FileInfo brep(reader.getFileName());
     TopoShape shape;
 
     // In LS3 the following statement is executed right before shape.Hasher = hasher;
@@ -755,7 +871,7 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
 
     std::string ver = _Ver;
 
-    if (brep.hasExtension("bin")) {
+    if (isBinaryBrep(reader)) {
         shape.importBinary(reader);
     }
     else {
@@ -780,6 +896,110 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
     _Ver = ver;
 }
 
+namespace
+{
+class ShapeDocFileData: public Base::Persistence::DocFileData
+{
+public:
+    TopoShape shape;
+    std::string failedFile;
+};
+}  // namespace
+
+bool PropertyPartShape::canReadDocFileConcurrently() const
+{
+    // Reading through a temporary file is only done in RestoreDocFile()
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("DirectAccess", true);
+}
+
+std::unique_ptr<Base::Persistence::DocFileData> PropertyPartShape::readDocFile(
+    Base::Reader& reader
+) const
+{
+    auto data = std::make_unique<ShapeDocFileData>();
+    if (isBinaryBrep(reader)) {
+        data->shape.importBinary(reader);
+        return data;
+    }
+
+    // Same as loadFromStream() but without touching the property
+    auto savedLocale = reader.getloc();
+    try {
+        reader.exceptions(std::istream::failbit | std::istream::badbit);
+        BRep_Builder builder;
+        TopoDS_Shape shape;
+        BRepTools::Read(shape, reader, builder);
+        data->shape = shape;
+    }
+    catch (const std::exception&) {
+        reader.imbue(savedLocale);
+        if (!reader.eof()) {
+            data->failedFile = reader.getFileName();
+        }
+    }
+    return data;
+}
+
+void PropertyPartShape::restoreDocFileData(DocFileData& data)
+{
+    aboutToSetValue();
+    applyDocFileData(data);
+    hasSetValue();
+}
+
+void PropertyPartShape::applyDocFileData(DocFileData& data)
+{
+    auto& shapeData = static_cast<ShapeDocFileData&>(data);
+    if (!shapeData.failedFile.empty()) {
+        Base::Console().warning("Failed to load BRep file %s\n", shapeData.failedFile.c_str());
+    }
+
+    // save the element map
+    auto elementMap = _Shape.resetElementMap();
+    TopoShape& shape = shapeData.shape;
+    shape.Hasher = _Shape.Hasher;
+    shape.resetElementMap(elementMap);
+    assignShape(shape);
+}
+
+bool PropertyPartShape::canRestoreDocFileLazily() const
+{
+    return canReadDocFileConcurrently();
+}
+
+void PropertyPartShape::restoreDocFileLazily(std::string&& content,
+                                             const std::string& fileName,
+                                             int fileVersion)
+{
+    std::lock_guard<std::mutex> lock(lazyFileMutex);
+    _LazyFile = std::make_unique<LazyFile>(LazyFile {std::move(content), fileName, fileVersion});
+    _LazyPending = true;
+}
+
+void PropertyPartShape::loadLazily() const
+{
+    if (!_LazyPending) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(lazyFileMutex);
+    if (!_LazyFile) {
+        return;
+    }
+
+    // The shape is set without notification because from the outside it looks
+    // as if it has been restored with the document
+    std::unique_ptr<LazyFile> file = std::move(_LazyFile);
+    std::istringstream str(file->Content);
+    Base::Reader reader(str, file->FileName, file->FileVersion);
+    auto data = readDocFile(reader);
+    auto self = const_cast<PropertyPartShape*>(this);  // NOLINT
+    self->applyDocFileData(*data);
+    _LazyPending = false;
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(
@@ -1048,6 +1268,55 @@ void PropertyFilletEdges::Paste(const Property& from)
 
 TYPESYSTEM_SOURCE(Part::PropertyShapeCache, App::Property);
 
+namespace
+{
+// Guards the entries and the LRU list of all shape caches
+std::mutex shapeCacheMutex;
+PropertyShapeCache::Statistics shapeCacheStatistics;
+bool shapeCacheLimitSet = false;
+
+std::size_t shapeCacheLimit()
+{
+    if (!shapeCacheLimitSet) {
+        shapeCacheLimitSet = true;
+        long megabytes = App::GetApplication()
+                             .GetParameterGroupByPath(
+                                 "User parameter:BaseApp/Preferences/Mod/Part/General"
+                             )
+                             ->GetInt("ShapeCacheSize", 1024);
+        shapeCacheStatistics.memLimit = static_cast<std::size_t>(std::max(0L, megabytes)) << 20;
+    }
+    return shapeCacheStatistics.memLimit;
+}
+}  // namespace
+
+PropertyShapeCache::LruList& PropertyShapeCache::lruList()
+{
+    static LruList list;
+    return list;
+}
+
+PropertyShapeCache::~PropertyShapeCache()
+{
+    clear();
+}
+
+void PropertyShapeCache::erase(std::unordered_map<std::string, Entry>::iterator it)
+{
+    lruList().erase(it->second.lru);
+    shapeCacheStatistics.memSize -= it->second.memSize;
+    --shapeCacheStatistics.entries;
+    cache.erase(it);
+}
+
+void PropertyShapeCache::clear()
+{
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    while (!cache.empty()) {
+        erase(cache.begin());
+    }
+}
+
 App::Property* PropertyShapeCache::Copy(void) const
 {
     return new PropertyShapeCache();
@@ -1055,7 +1324,7 @@ App::Property* PropertyShapeCache::Copy(void) const
 
 void PropertyShapeCache::Paste(const App::Property&)
 {
-    cache.clear();
+    clear();
 }
 
 void PropertyShapeCache::Save(Base::Writer&) const
@@ -1064,6 +1333,16 @@ void PropertyShapeCache::Save(Base::Writer&) const
 void PropertyShapeCache::Restore(Base::XMLReader&)
 {}
 
+unsigned int PropertyShapeCache::getMemSize() const
+{
+    std::size_t size = sizeof(*this);
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    for (const auto& v : cache) {
+        size += v.first.size() + v.second.memSize;
+    }
+    return static_cast<unsigned int>(size);
+}
+
 /**
  * Make a new python List with a tuple for each cache entry containing the key and the shape
  * @return the python list
@@ -1071,7 +1350,14 @@ void PropertyShapeCache::Restore(Base::XMLReader&)
 PyObject* PropertyShapeCache::getPyObject()
 {
     Py::List res;
-    for (auto& v : cache) {
+    std::vector<std::pair<std::string, TopoShape>> entries;
+    {
+        std::lock_guard<std::mutex> lock(shapeCacheMutex);
+        for (auto& v : cache) {
+            entries.emplace_back(v.first, v.second.shape);
+        }
+    }
+    for (auto& v : entries) {
         res.append(Py::TupleN(Py::String(v.first), shape2pyshape(v.second)));
     }
     return Py::new_reference_to(res);
@@ -1087,13 +1373,17 @@ void PropertyShapeCache::setPyObject(PyObject* value)
         return;
     }
     if (value == Py_None) {
-        cache.clear();
+        clear();
         return;
     }
     App::PropertyStringList prop;
     prop.setPyObject(value);
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
     for (const auto& sub : prop.getValues()) {
-        cache.erase(sub);
+        auto it = cache.find(sub);
+        if (it != cache.end()) {
+            erase(it);
+        }
     }
 }
 
@@ -1146,18 +1436,24 @@ bool PropertyShapeCache::getShape(const App::DocumentObject* obj, TopoShape& sha
     //    if (PartParams::getDisableShapeCache())
     //        return false;
     auto prop = get(obj, false);
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
     if (!prop) {
+        ++shapeCacheStatistics.misses;
         return false;
     }
     if (!subname) {
         subname = "";
     }
     auto it = prop->cache.find(subname);
-    if (it != prop->cache.end()) {
-        shape = it->second;
-        return !shape.isNull();
+    if (it == prop->cache.end()) {
+        ++shapeCacheStatistics.misses;
+        return false;
     }
-    return false;
+    ++shapeCacheStatistics.hits;
+    auto& list = lruList();
+    list.splice(list.begin(), list, it->second.lru);
+    shape = it->second.shape;
+    return !shape.isNull();
 }
 
 /**
@@ -1179,7 +1475,68 @@ void PropertyShapeCache::setShape(const App::DocumentObject* obj, const TopoShap
     if (!subname) {
         subname = "";
     }
-    prop->cache[subname] = shape;
+    std::size_t memSize = shape.getMemSize();
+
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    auto it = prop->cache.find(subname);
+    if (it != prop->cache.end()) {
+        prop->erase(it);
+    }
+    std::size_t limit = shapeCacheLimit();
+    if (limit && memSize > limit) {
+        return;
+    }
+
+    auto& list = lruList();
+    while (limit && !list.empty() && shapeCacheStatistics.memSize + memSize > limit) {
+        auto [owner, key] = list.back();
+        owner->erase(owner->cache.find(*key));
+        ++shapeCacheStatistics.evictions;
+    }
+
+    it = prop->cache.emplace(subname, Entry {shape, memSize, {}}).first;
+    list.emplace_front(prop, &it->first);
+    it->second.lru = list.begin();
+    shapeCacheStatistics.memSize += memSize;
+    ++shapeCacheStatistics.entries;
+}
+
+void PropertyShapeCache::setMemLimit(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    shapeCacheLimitSet = true;
+    shapeCacheStatistics.memLimit = bytes;
+    auto& list = lruList();
+    while (bytes && !list.empty() && shapeCacheStatistics.memSize > bytes) {
+        auto [owner, key] = list.back();
+        owner->erase(owner->cache.find(*key));
+        ++shapeCacheStatistics.evictions;
+    }
+}
+
+PropertyShapeCache::Statistics PropertyShapeCache::getStatistics()
+{
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    shapeCacheLimit();
+    return shapeCacheStatistics;
+}
+
+void PropertyShapeCache::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    shapeCacheStatistics.hits = 0;
+    shapeCacheStatistics.misses = 0;
+    shapeCacheStatistics.evictions = 0;
+}
+
+void PropertyShapeCache::clearAll()
+{
+    std::lock_guard<std::mutex> lock(shapeCacheMutex);
+    auto& list = lruList();
+    while (!list.empty()) {
+        auto [owner, key] = list.back();
+        owner->erase(owner->cache.find(*key));
+    }
 }
 
 void PropertyShapeCache::slotChanged(const App::DocumentObject&, const App::Property& prop)
@@ -1191,6 +1548,6 @@ void PropertyShapeCache::slotChanged(const App::DocumentObject&, const App::Prop
     if (strcmp(propName, "Group") == 0 || strcmp(propName, "Shape") == 0
         || strstr(propName, "Touched") != 0) {
         FC_LOG("clear shape cache on changed " << prop.getFullName());
-        cache.clear();
+        clear();
     }
 }
@@ -24,7 +24,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -93,6 +98,12 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canReadDocFileConcurrently() const override;
+    std::unique_ptr<DocFileData> readDocFile(Base::Reader& reader) const override;
+    void restoreDocFileData(DocFileData& data) override;
+    bool canRestoreDocFileLazily() const override;
+    void restoreDocFileLazily(std::string&& content, const std::string& fileName, int fileVersion)
+        override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -116,8 +127,15 @@ private:
     void saveToFile(Base::Writer& writer) const;
     void loadFromFile(Base::Reader& reader);
     void loadFromStream(Base::Reader& reader);
+    void assignShape(const TopoShape& sh);
+    void applyDocFileData(DocFileData& data);
+    /// Reads the shape passed to restoreDocFileLazily() if not done yet
+    void loadLazily() const;
 
 private:
+    struct LazyFile;
+    mutable std::unique_ptr<LazyFile> _LazyFile;
+    mutable std::atomic<bool> _LazyPending {false};
     TopoShape _Shape;
     std::string _Ver;
     mutable int _HasherIndex = 0;
@@ -288,6 +306,19 @@ class PartExport PropertyShapeCache: public App::Property
     TYPESYSTEM_HEADER_WITH_OVERRIDE();
 
 public:
+    /// Counters and memory usage of all shape caches together
+    struct Statistics
+    {
+        std::size_t hits {0};
+        std::size_t misses {0};
+        std::size_t evictions {0};
+        std::size_t entries {0};
+        std::size_t memSize {0};
+        std::size_t memLimit {0};
+    };
+
+    ~PropertyShapeCache() override;
+
     virtual App::Property* Copy(void) const override;
 
     virtual void Paste(const App::Property&) override;
@@ -300,15 +331,41 @@ public:
 
     virtual void Restore(Base::XMLReader& reader) override;
 
+    /// Memory of the cached shapes, including their triangulation
+    unsigned int getMemSize() const override;
+
     static PropertyShapeCache* get(const App::DocumentObject* obj, bool create);
     static bool getShape(const App::DocumentObject* obj, TopoShape& shape, const char* subname = 0);
     static void setShape(const App::DocumentObject* obj, const TopoShape& shape, const char* subname = 0);
 
+    /** The caches of all objects share one memory budget, the least recently used entries are
+     * evicted when it is exceeded. The budget defaults to the ShapeCacheSize parameter in MB.
+     */
+    static void setMemLimit(std::size_t bytes);
+    static Statistics getStatistics();
+    static void resetStatistics();
+    /// Clear the caches of all objects
+    static void clearAll();
+
 private:
     void slotChanged(const App::DocumentObject&, const App::Property& prop);
+    void clear();
 
 private:
-    std::unordered_map<std::string, TopoShape> cache;
+    // Entries of all caches, the most recently used first
+    using LruList = std::list<std::pair<PropertyShapeCache*, const std::string*>>;
+
+    struct Entry
+    {
+        TopoShape shape;
+        std::size_t memSize {0};
+        LruList::iterator lru;
+    };
+
+    static LruList& lruList();
+    void erase(std::unordered_map<std::string, Entry>::iterator it);
+
+    std::unordered_map<std::string, Entry> cache;
     fastsignals::scoped_connection connChanged;
 };
 
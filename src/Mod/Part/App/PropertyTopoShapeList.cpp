@@ -236,12 +236,12 @@ void PropertyTopoShapeList::Restore(Base::XMLReader& reader)
 void PropertyTopoShapeList::RestoreDocFile(Base::Reader& reader)
 {
     Base::FileInfo finfo(reader.getFileName());
-    bool binary = finfo.hasExtension("bin");
     int index = atoi(Base::FileInfo(finfo.fileNamePure()).extension().c_str());
     if (index < 0 || index >= static_cast<int>(m_restorePointers.size())) {
         return;
     }
-    if (binary) {
+    // detect the format from the content, see PropertyPartShape::RestoreDocFile()
+    if (reader.peek() == 'O') {
         m_restorePointers[index]->importBinary(reader);
     }
     else {
@@ -23,6 +23,9 @@
  ***************************************************************************/
 
 #include <cassert>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
@@ -66,7 +69,9 @@
 # include <GeomAdaptor_HCurve.hxx>
 #endif
 
+#include <App/Application.h>
 #include <Base/Exception.h>
+#include <Base/Parameter.h>
 #include <Base/Vector3D.h>
 
 #include "Tools.h"
@@ -901,3 +906,137 @@ Standard_Real Part::Tools::getDeflection(const TopoDS_Shape& shape, double devia
 {
     return getDeflection(getBounds(shape), deviation);
 }
+
+namespace
+{
+// Shapes meshed by Part::Tools::meshShape(), least recently used first. The
+// triangulation itself is stored in the TShape by OCC, the cache only keeps the
+// TShape alive and remembers the parameters used for meshing.
+class TriangulationCache
+{
+public:
+    static TriangulationCache& instance()
+    {
+        static TriangulationCache cache;
+        return cache;
+    }
+
+    bool isMeshed(const TopoDS_Shape& shape, double deflection, double angularDeflection)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(shape.TShape().get());
+        if (it == entries.end()) {
+            return false;
+        }
+        const Entry& entry = *it->second;
+        if (entry.deflection > deflection || entry.angularDeflection > angularDeflection) {
+            return false;
+        }
+        lru.splice(lru.end(), lru, it->second);
+        return true;
+    }
+
+    void add(const TopoDS_Shape& shape, double deflection, double angularDeflection)
+    {
+        std::size_t bytes = 0;
+        for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+            TopLoc_Location loc;
+            Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+            if (!mesh.IsNull()) {
+                bytes += mesh->NbNodes() * sizeof(gp_Pnt) + mesh->NbTriangles() * sizeof(Poly_Triangle);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto key = shape.TShape().get();
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            totalBytes -= it->second->bytes;
+            lru.erase(it->second);
+            entries.erase(it);
+        }
+        lru.push_back(Entry {shape.TShape(), deflection, angularDeflection, bytes});
+        entries.emplace(key, std::prev(lru.end()));
+        totalBytes += bytes;
+
+        std::size_t limit = getLimit();
+        while (totalBytes > limit && lru.size() > 1) {
+            totalBytes -= lru.front().bytes;
+            entries.erase(lru.front().shape.get());
+            lru.pop_front();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        lru.clear();
+        totalBytes = 0;
+    }
+
+private:
+    static std::size_t getLimit()
+    {
+        static std::size_t limit = [] {
+            ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+                "User parameter:BaseApp/Preferences/Mod/Part/General"
+            );
+            return static_cast<std::size_t>(hGrp->GetUnsigned("TriangulationCacheSize", 512)) << 20;
+        }();
+        return limit;
+    }
+
+    struct Entry
+    {
+        Handle(TopoDS_TShape) shape;
+        double deflection;
+        double angularDeflection;
+        std::size_t bytes;
+    };
+
+    std::mutex mutex;
+    std::list<Entry> lru;
+    std::unordered_map<const TopoDS_TShape*, std::list<Entry>::iterator> entries;
+    std::size_t totalBytes {0};
+};
+
+bool hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (mesh.IsNull() || mesh->Deflection() > deflection) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+bool Part::Tools::meshShape(const TopoDS_Shape& shape, double deflection, double angularDeflection)
+{
+    if (shape.IsNull()) {
+        return false;
+    }
+
+    auto& cache = TriangulationCache::instance();
+    if (cache.isMeshed(shape, deflection, angularDeflection) && hasTriangulation(shape, deflection)) {
+        return false;
+    }
+
+    BRepMesh_IncrementalMesh(
+        shape,
+        deflection,
+        /*isRelative*/ Standard_False,
+        angularDeflection,
+        /*isInParallel*/ Standard_True
+    );
+    cache.add(shape, deflection, angularDeflection);
+    return true;
+}
+
+void Part::Tools::clearTriangulationCache()
+{
+    TriangulationCache::instance().clear();
+}
@@ -361,6 +361,29 @@ public:
      * \return The computed deflection value.
      */
     static Standard_Real getDeflection(const TopoDS_Shape& shape, double deviation);
+
+    /**
+     * \brief Makes sure that all faces of a shape are triangulated.
+     *
+     * The shape is only meshed with BRepMesh_IncrementalMesh if it was not
+     * meshed before with a linear and angular deflection at most as big as the
+     * given ones, or if its faces lost their triangulation since. Shapes meshed
+     * by this function are tracked in a process wide cache keyed by their
+     * TShape, which is limited by the memory of the triangulations it keeps
+     * alive, see the parameter TriangulationCacheSize (in MB) of Mod/Part/General.
+     *
+     * \param[in] shape The shape to triangulate.
+     * \param[in] deflection The maximum linear deflection.
+     * \param[in] angularDeflection The maximum angular deflection in radians.
+     *
+     * \return True if the shape was meshed, false if the existing triangulation is reused.
+     */
+    static bool meshShape(const TopoDS_Shape& shape, double deflection, double angularDeflection);
+
+    /**
+     * \brief Removes all shapes from the cache used by meshShape().
+     */
+    static void clearTriangulationCache();
 };
 
 }  // namespace Part
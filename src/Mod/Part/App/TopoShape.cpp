@@ -27,7 +27,11 @@
 #include <array>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
 #include <sstream>
+#include <unordered_set>
 #include <boost/regex.hpp>
 
 #include <APIHeaderSection_MakeHeader.hxx>
@@ -65,7 +69,6 @@
 #include <BRepLib.hxx>
 #include <BRepLib_FindSurface.hxx>
 #include <BRepLProp_SLProps.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepOffsetAPI_MakeOffset.hxx>
 #include <BRepOffsetAPI_MakeOffsetShape.hxx>
 #include <BRepOffsetAPI_MakePipe.hxx>
@@ -122,6 +125,8 @@
 #include <Law_BSpline.hxx>
 #include <Law_BSpFunc.hxx>
 #include <Law_Constant.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_Triangulation.hxx>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -167,6 +172,7 @@
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/Placement.h>
+#include <Base/Parallel.h>
 #include <Base/Tools.h>
 #include <Base/Reader.h>
 #include <Base/Writer.h>
@@ -302,7 +308,7 @@ std::pair<std::string, unsigned long> TopoShape::getElementTypeAndIndex(const ch
     const char* Name = strName.c_str();
     int index = 0;
     std::string element;
-    boost::regex ex("^(Face|Edge|Vertex)([1-9][0-9]*)$");
+    static const boost::regex ex("^(Face|Edge|Vertex)([1-9][0-9]*)$");
     boost::cmatch what;
 
     if (Name && boost::regex_match(Name, what, ex)) {
@@ -418,44 +424,56 @@ static inline std::vector<T> _getSubShapes(const TopoDS_Shape& s, TopAbs_ShapeEn
     return shapes;
 }
 
-static std::array<std::string, TopAbs_SHAPE> _ShapeNames;
+// Indexed by TopAbs_ShapeEnum. A function static, so that concurrent first uses are safe.
+static const std::array<std::string, TopAbs_SHAPE>& _ShapeNames()
+{
+    static const std::array<std::string, TopAbs_SHAPE> names {
+        "Compound",
+        "CompSolid",
+        "Solid",
+        "Shell",
+        "Face",
+        "Wire",
+        "Edge",
+        "Vertex",
+    };
+    return names;
+}
 
-static void initShapeNameMap()
+// Parses the index after the type of an element name like "Face12" without allocating, returns
+// 0 if there is no index or anything else follows
+static int _parseShapeIndex(const char* digits)
 {
-    if (_ShapeNames[TopAbs_VERTEX].empty()) {
-        _ShapeNames[TopAbs_VERTEX] = "Vertex";
-        _ShapeNames[TopAbs_EDGE] = "Edge";
-        _ShapeNames[TopAbs_FACE] = "Face";
-        _ShapeNames[TopAbs_WIRE] = "Wire";
-        _ShapeNames[TopAbs_SHELL] = "Shell";
-        _ShapeNames[TopAbs_SOLID] = "Solid";
-        _ShapeNames[TopAbs_COMPOUND] = "Compound";
-        _ShapeNames[TopAbs_COMPSOLID] = "CompSolid";
+    if (!*digits) {
+        return 0;
+    }
+    int idx = 0;
+    for (; *digits; ++digits) {
+        if (*digits < '0' || *digits > '9' || idx > (std::numeric_limits<int>::max() - 9) / 10) {
+            return 0;
+        }
+        idx = idx * 10 + (*digits - '0');
     }
+    return idx;
 }
 
 std::pair<TopAbs_ShapeEnum, int> TopoShape::shapeTypeAndIndex(const char* name)
 {
-    int idx = 0;
-    TopAbs_ShapeEnum type = TopAbs_SHAPE;
-    static const std::string _subshape("SubShape");
-    if (boost::starts_with(name, _subshape)) {
-        std::istringstream iss(name + _subshape.size());
-        iss >> idx;
-        if (!iss.eof()) {
-            idx = 0;
-        }
+    if (!name) {
+        return std::make_pair(TopAbs_SHAPE, 0);
     }
-    else {
-        type = shapeType(name, true);
-        if (type != TopAbs_SHAPE) {
-            std::istringstream iss(name + shapeName(type).size());
-            iss >> idx;
-            if (!iss.eof()) {
-                idx = 0;
-                type = TopAbs_SHAPE;
-            }
-        }
+    static const char _subshape[] = "SubShape";
+    constexpr std::size_t subshapeLength = sizeof(_subshape) - 1;
+    if (std::strncmp(name, _subshape, subshapeLength) == 0) {
+        return std::make_pair(TopAbs_SHAPE, _parseShapeIndex(name + subshapeLength));
+    }
+    TopAbs_ShapeEnum type = shapeType(name, true);
+    if (type == TopAbs_SHAPE) {
+        return std::make_pair(TopAbs_SHAPE, 0);
+    }
+    int idx = _parseShapeIndex(name + _ShapeNames()[type].size());
+    if (idx == 0) {
+        type = TopAbs_SHAPE;
     }
     return std::make_pair(type, idx);
 }
@@ -479,9 +497,9 @@ std::pair<TopAbs_ShapeEnum, int> TopoShape::shapeTypeAndIndex(const Data::Indexe
 TopAbs_ShapeEnum TopoShape::shapeType(const char* type, bool silent)
 {
     if (type) {
-        initShapeNameMap();
-        for (size_t idx = 0; idx < _ShapeNames.size(); ++idx) {
-            if (!_ShapeNames[idx].empty() && boost::starts_with(type, _ShapeNames[idx])) {
+        const auto& names = _ShapeNames();
+        for (size_t idx = 0; idx < names.size(); ++idx) {
+            if (std::strncmp(type, names[idx].c_str(), names[idx].size()) == 0) {
                 return static_cast<TopAbs_ShapeEnum>(idx);
             }
         }
@@ -525,9 +543,8 @@ TopAbs_ShapeEnum TopoShape::shapeType(bool silent) const
 
 const std::string& TopoShape::shapeName(TopAbs_ShapeEnum type, bool silent)
 {
-    initShapeNameMap();
-    if (type >= 0 && type < _ShapeNames.size() && !_ShapeNames[type].empty()) {
-        return _ShapeNames[type];
+    if (type >= 0 && type < _ShapeNames().size()) {
+        return _ShapeNames()[type];
     }
     if (!silent) {
         FC_THROWM(Base::CADKernelError, "invalid shape type '" << type << "'");
@@ -958,7 +975,7 @@ void TopoShape::exportBrep(std::ostream& out) const
     SS.Write(this->_Shape, out);
 }
 
-void TopoShape::exportBinary(std::ostream& out) const
+void TopoShape::exportBinary(std::ostream& out, bool withTriangles) const
 {
     // See BinTools_FormatVersion of OCCT 7.6
     enum
@@ -972,6 +989,11 @@ void TopoShape::exportBinary(std::ostream& out) const
     // An example how to use BinTools_ShapeSet can be found in BinMNaming_NamedShapeDriver.cxx
     BinTools_ShapeSet theShapeSet;
     theShapeSet.SetFormatNb(VERSION_3);
+#if OCC_VERSION_HEX >= 0x070600
+    theShapeSet.SetWithTriangles(withTriangles);
+#else
+    (void)withTriangles;
+#endif
     if (this->_Shape.IsNull()) {
         theShapeSet.Add(this->_Shape);
         theShapeSet.Write(out);
@@ -999,14 +1021,7 @@ void TopoShape::dump(std::ostream& out) const
 void TopoShape::exportStl(const char* filename, double deflection) const
 {
     StlAPI_Writer writer;
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        deflection,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(deflection),
-        /*isInParallel*/ true
-    );
+    Tools::meshShape(this->_Shape, deflection, defaultAngularDeflection(deflection));
     writer.Write(this->_Shape, encodeFilename(filename).c_str());
 }
 
@@ -1028,14 +1043,7 @@ void TopoShape::exportFaceSet(
     bool supportFaceColors = (numFaces == colors.size());
 
     std::size_t index = 0;
-    BRepMesh_IncrementalMesh MESH(
-        this->_Shape,
-        dev,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(dev),
-        /*isInParallel*/ true
-    );
+    Tools::meshShape(this->_Shape, dev, defaultAngularDeflection(dev));
     for (ex.Init(this->_Shape, TopAbs_FACE); ex.More(); ex.Next(), index++) {
         // get the shape and mesh it
         const TopoDS_Face& aFace = TopoDS::Face(ex.Current());
@@ -1224,6 +1232,25 @@ bool TopoShape::getCenterOfGravity(Base::Vector3d& center) const
         return false;
     }
 
+    std::optional<MassPropertyType> type;
+    if (TopExp_Explorer(_Shape, TopAbs_SOLID).More()) {
+        type = MassPropertyType::Volume;
+    }
+    else if (TopExp_Explorer(_Shape, TopAbs_FACE).More()) {
+        type = MassPropertyType::Surface;
+    }
+    else if (TopExp_Explorer(_Shape, TopAbs_EDGE).More()) {
+        type = MassPropertyType::Linear;
+    }
+    if (type) {
+        MassProperties props = getMassProperties(*type);
+        if (props.mass > Precision::Infinite()) {
+            return false;
+        }
+        center = props.centerOfMass;
+        return true;
+    }
+
     // Computing of CentreOfMass
     GProp_GProps prop;
     if (getShapeProperties(_Shape, prop)) {
@@ -1281,6 +1308,8 @@ unsigned int TopoShape::getMemSize() const
         // Now get a map of TopoDS_Shape objects without duplicates
         TopTools_IndexedMapOfShape M;
         TopExp::MapShapes(_Shape, M);
+        // triangulations and polygons may be shared by several faces and edges
+        std::unordered_set<const Standard_Transient*> meshes;
         for (int i = 0; i < M.Extent(); i++) {
             const TopoDS_Shape& shape = M(i + 1);
             if (shape.IsNull()) {
@@ -1296,6 +1325,19 @@ unsigned int TopoShape::getMemSize() const
                     // first, last, tolerance
                     memsize += 5 * sizeof(Standard_Real);
                     const TopoDS_Face& face = TopoDS::Face(shape);
+                    // the triangulation created for the display
+                    TopLoc_Location loc;
+                    const Handle(Poly_Triangulation)& mesh = BRep_Tool::Triangulation(face, loc);
+                    if (!mesh.IsNull() && meshes.insert(mesh.get()).second) {
+                        memsize += sizeof(Poly_Triangulation) + mesh->NbNodes() * sizeof(gp_Pnt)
+                            + mesh->NbTriangles() * sizeof(Poly_Triangle);
+                        if (mesh->HasUVNodes()) {
+                            memsize += mesh->NbNodes() * sizeof(gp_Pnt2d);
+                        }
+                        if (mesh->HasNormals()) {
+                            memsize += mesh->NbNodes() * 3 * sizeof(Standard_ShortReal);
+                        }
+                    }
                     // if no geometry is attached to a face an exception is raised
                     BRepAdaptor_Surface surface;
                     try {
@@ -1355,6 +1397,14 @@ unsigned int TopoShape::getMemSize() const
                     // first, last, tolerance
                     memsize += 3 * sizeof(Standard_Real);
                     const TopoDS_Edge& edge = TopoDS::Edge(shape);
+                    TopLoc_Location loc;
+                    const Handle(Poly_Polygon3D)& polygon = BRep_Tool::Polygon3D(edge, loc);
+                    if (!polygon.IsNull() && meshes.insert(polygon.get()).second) {
+                        memsize += sizeof(Poly_Polygon3D) + polygon->NbNodes() * sizeof(gp_Pnt);
+                        if (polygon->HasParameters()) {
+                            memsize += polygon->NbNodes() * sizeof(Standard_Real);
+                        }
+                    }
                     // if no geometry is attached to an edge an exception is raised
                     BRepAdaptor_Curve curve;
                     try {
@@ -1409,6 +1459,11 @@ unsigned int TopoShape::getMemSize() const
             }
         }
 
+        // shape maps and ancestor tables cached for the element lookups
+        if (_cache) {
+            memsize += static_cast<unsigned int>(_cache->getMemSize());
+        }
+
         // estimated memory usage
         return memsize;
     }
@@ -1965,11 +2020,13 @@ std::list<TopoDS_Wire> TopoShape::slice(const Base::Vector3d& dir, double d) con
 
 TopoDS_Compound TopoShape::slices(const Base::Vector3d& dir, const std::vector<double>& d) const
 {
-    std::vector<std::list<TopoDS_Wire>> wire_list;
-    CrossSection cs(dir.x, dir.y, dir.z, this->_Shape);
+    std::vector<gp_Pln> planes;
+    planes.reserve(d.size());
     for (double jt : d) {
-        wire_list.push_back(cs.slice(jt));
+        planes.emplace_back(dir.x, dir.y, dir.z, -jt);
     }
+    CrossSections cs(this->_Shape);
+    std::vector<std::list<TopoDS_Wire>> wire_list = cs.slice(planes);
 
     std::vector<std::list<TopoDS_Wire>>::const_iterator ft;
     TopoDS_Compound comp;
@@ -3659,19 +3716,131 @@ void TopoShape::
     }
 
     // get the meshes of all faces and then merge them
-    BRepMesh_IncrementalMesh aMesh(
-        this->_Shape,
-        accuracy,
-        /*isRelative*/ Standard_False,
-        /*theAngDeflection*/
-        defaultAngularDeflection(accuracy),
-        /*isInParallel*/ true
-    );
+    Tools::meshShape(this->_Shape, accuracy, defaultAngularDeflection(accuracy));
     std::vector<Domain> domains;
     getDomains(domains);
     getFacesFromDomains(domains, aPoints, aTopo);
 }
 
+namespace
+{
+struct FaceTriangulation
+{
+    Handle(Poly_Triangulation) triangulation;
+    gp_Trsf transform;
+    bool reversed;
+    std::size_t nodeOffset;
+    std::size_t triangleOffset;
+};
+
+std::vector<FaceTriangulation> getFaceTriangulations(
+    const TopoDS_Shape& shape,
+    std::size_t* countNodes = nullptr,
+    std::size_t* countTriangles = nullptr
+)
+{
+    std::vector<FaceTriangulation> faces;
+    std::size_t nodes = 0;
+    std::size_t triangles = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, loc);
+        if (triangulation.IsNull()) {
+            continue;
+        }
+        bool reversed = face.Orientation() != TopAbs_FORWARD;
+        faces.push_back({triangulation, loc.Transformation(), reversed, nodes, triangles});
+        nodes += triangulation->NbNodes();
+        triangles += triangulation->NbTriangles();
+    }
+    if (nodes > std::numeric_limits<uint32_t>::max()) {
+        throw Base::ValueError("Too many triangulation nodes for 32 bit indices");
+    }
+    if (countNodes) {
+        *countNodes = nodes;
+    }
+    if (countTriangles) {
+        *countTriangles = triangles;
+    }
+    return faces;
+}
+
+template<typename T>
+void fillFaceTriangulation(const TopoDS_Shape& shape, T* points, uint32_t* facets)
+{
+    auto faces = getFaceTriangulations(shape);
+    Base::parallelFor(faces.size(), [&](std::size_t index) {
+        const FaceTriangulation& face = faces[index];
+        const Handle(Poly_Triangulation)& triangulation = face.triangulation;
+
+        // Apply the location as plain matrix product on the coordinates
+        double mat[3][4];
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                mat[row][col] = face.transform.Value(row + 1, col + 1);
+            }
+        }
+        T* point = points + 3 * face.nodeOffset;
+        for (int i = 1; i <= triangulation->NbNodes(); ++i, point += 3) {
+#if OCC_VERSION_HEX < 0x070600
+            const gp_Pnt& node = triangulation->Nodes()(i);
+#else
+            const gp_Pnt node = triangulation->Node(i);
+#endif
+            double x = node.X();
+            double y = node.Y();
+            double z = node.Z();
+            point[0] = static_cast<T>(mat[0][0] * x + mat[0][1] * y + mat[0][2] * z + mat[0][3]);
+            point[1] = static_cast<T>(mat[1][0] * x + mat[1][1] * y + mat[1][2] * z + mat[1][3]);
+            point[2] = static_cast<T>(mat[2][0] * x + mat[2][1] * y + mat[2][2] * z + mat[2][3]);
+        }
+
+        auto offset = static_cast<uint32_t>(face.nodeOffset);
+        uint32_t* facet = facets + 3 * face.triangleOffset;
+        for (int i = 1; i <= triangulation->NbTriangles(); ++i, facet += 3) {
+            Standard_Integer n1, n2, n3;
+#if OCC_VERSION_HEX < 0x070600
+            triangulation->Triangles()(i).Get(n1, n2, n3);
+#else
+            triangulation->Triangle(i).Get(n1, n2, n3);
+#endif
+            if (face.reversed) {
+                std::swap(n1, n2);
+            }
+            facet[0] = offset + n1 - 1;
+            facet[1] = offset + n2 - 1;
+            facet[2] = offset + n3 - 1;
+        }
+    });
+}
+}  // namespace
+
+std::pair<std::size_t, std::size_t> TopoShape::countFaceTriangulation(double accuracy) const
+{
+    if (this->_Shape.IsNull()) {
+        return {0, 0};
+    }
+
+    if (accuracy > 0.0) {
+        Tools::meshShape(this->_Shape, accuracy, defaultAngularDeflection(accuracy));
+    }
+    std::size_t nodes = 0;
+    std::size_t triangles = 0;
+    getFaceTriangulations(this->_Shape, &nodes, &triangles);
+    return {nodes, triangles};
+}
+
+void TopoShape::getFaceTriangulation(float* points, uint32_t* facets) const
+{
+    fillFaceTriangulation(this->_Shape, points, facets);
+}
+
+void TopoShape::getFaceTriangulation(double* points, uint32_t* facets) const
+{
+    fillFaceTriangulation(this->_Shape, points, facets);
+}
+
 void TopoShape::setFaces(
     const std::vector<Base::Vector3d>& Points,
     const std::vector<Facet>& Topo,
@@ -314,6 +314,13 @@ public:
     }
 
     virtual bool isSame(const Data::ComplexGeoData& other) const;
+    /** Returns a hash of the topology and geometry of the shape
+     *
+     * The hash covers the sub shape structure, the tolerances, the vertex positions and samples
+     * (or the poles, for B-splines) of the edge and face geometries, but not the TShape
+     * pointers. Recomputing a feature to the same result hence gives the same fingerprint.
+     */
+    std::size_t getFingerprint() const;
 
     /** @name Placement control */
     //@{
@@ -326,6 +333,30 @@ public:
     /// More precise bound box from the CasCade shape
     Base::BoundBox3d getBoundBoxOptimal() const;
     bool getCenterOfGravity(Base::Vector3d& center) const override;
+
+    /// Kind of global properties computed by getMassProperties()
+    enum class MassPropertyType
+    {
+        Linear,
+        Surface,
+        Volume
+    };
+    /// Global properties of the shape with unit density
+    struct MassProperties
+    {
+        /// Length, area or volume of the shape
+        double mass = 0.0;
+        Base::Vector3d centerOfMass;
+        /// Matrix of inertia about the center of mass
+        Base::Matrix4D matrixOfInertia;
+    };
+    /** Returns the global properties of the shape
+     *
+     * The properties are computed once for the shape without its location and cached, so that
+     * located copies of the same shape only transform the cached result. The children of a
+     * compound are computed in parallel.
+     */
+    MassProperties getMassProperties(MassPropertyType type) const;
     static void convertTogpTrsf(const Base::Matrix4D& mtrx, gp_Trsf& trsf);
     static void convertToMatrix(const gp_Trsf& trsf, Base::Matrix4D& mtrx);
     static Base::Matrix4D convert(const gp_Trsf& trsf);
@@ -370,6 +401,21 @@ public:
         double Accuracy,
         uint16_t flags = 0
     ) const override;
+    /// Returns the total number of nodes and triangles of the face triangulations, i.e. the sizes
+    /// needed by getFaceTriangulation(). With a positive accuracy the faces are meshed first, if
+    /// not yet done.
+    std::pair<std::size_t, std::size_t> countFaceTriangulation(double accuracy = 0.0) const;
+    /** Copies the face triangulations into contiguous buffers
+     *
+     * @param points: receives x, y and z of each node, with the face location applied. It must
+     * have room for three times the node count of countFaceTriangulation().
+     * @param facets: receives the three node indices of each triangle. It must have room for
+     * three times the triangle count of countFaceTriangulation().
+     *
+     * Unlike getFaces() the nodes shared by adjacent faces are not merged.
+     */
+    void getFaceTriangulation(float* points, uint32_t* facets) const;
+    void getFaceTriangulation(double* points, uint32_t* facets) const;
     void setFaces(
         const std::vector<Base::Vector3d>& Points,
         const std::vector<Facet>& faces,
@@ -509,7 +555,11 @@ public:
     void exportStep(const char* FileName) const;
     void exportBrep(const char* FileName) const;
     void exportBrep(std::ostream&) const;
-    void exportBinary(std::ostream&) const;
+    /** Writes the shape in the binary BinTools format
+     * @param withTriangles: also write the triangulation of the faces so that
+     * it doesn't need to be recomputed after loading the shape.
+     */
+    void exportBinary(std::ostream&, bool withTriangles = false) const;
     void exportStl(const char* FileName, double deflection) const;
     void exportFaceSet(double, double, const std::vector<Base::Color>&, std::ostream&) const;
     void exportLineSet(std::ostream&) const;
@@ -1696,6 +1746,22 @@ public:
     void mapSubElementsTo(std::vector<TopoShape>& shapes, const char* op = nullptr) const;
     bool hasPendingElementMap() const;
 
+    /** Enable or disable deferred element map generation
+     *
+     * If enabled, makeShapeWithElementMap() (and thus all makeElement*()
+     * functions) only records the shape history of the operation. The element
+     * map is generated from it the first time it is actually needed, e.g. by
+     * getElementName(), getElementMap() or when the shape is used as the input
+     * of another operation. Intermediate shapes that are never referenced by
+     * name then skip the naming altogether.
+     *
+     * The default is read from the "LazyElementMap" parameter in
+     * "User parameter:BaseApp/Preferences/Mod/Part/General".
+     */
+    static void setElementMapDeferred(bool enable);
+    /// Check if element map generation is deferred, see setElementMapDeferred()
+    static bool isElementMapDeferred();
+
     std::string getElementMapVersion() const override;
 
     void flushElementMap() const override;
@@ -2853,6 +2919,13 @@ public:
     friend class TopoShapeCache;
 
 private:
+    /// Generate the element map of this shape from the given shape history
+    TopoShape& makeElementMapFromHistory(
+        const Mapper& mapper,
+        const std::vector<TopoShape>& shapes,
+        const char* op
+    );
+
     // Cache storage
     mutable std::shared_ptr<TopoShapeCache> _parentCache;
     mutable std::shared_ptr<TopoShapeCache> _cache;
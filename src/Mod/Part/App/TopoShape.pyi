@@ -817,6 +817,30 @@ class TopoShape(ComplexGeoData):
         """
         ...
 
+    @constmethod
+    def countTessellation(self, tolerance: float, /) -> Tuple[int, int]:
+        """
+        Tessellate the shape and return the number of nodes and triangles of its faces
+        countTessellation(tolerance) -> (nodes, triangles)
+        --
+        The counts give the sizes of the buffers for fillTessellation().
+        """
+        ...
+
+    @constmethod
+    def fillTessellation(self, points: object, facets: object, /) -> None:
+        """
+        Copy the face tessellation into writable buffers
+        fillTessellation(points, facets)
+        --
+        points: C contiguous float32 or float64 buffer, e.g. a numpy array, receiving
+        x, y, z of each node.
+        facets: C contiguous uint32 buffer receiving three node indices per triangle.
+        The buffers must hold at least three times the counts of countTessellation().
+        Unlike tessellate() the nodes shared by adjacent faces are not merged.
+        """
+        ...
+
     @constmethod
     def project(self, shapeList: List[TopoShape], /) -> TopoShape:
         """
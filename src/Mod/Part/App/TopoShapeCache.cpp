@@ -22,10 +22,36 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <atomic>
+
+#include <App/Application.h>
+#include <Base/Parallel.h>
+#include <Base/Parameter.h>
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
 
+namespace
+{
+std::atomic<int> parallelAncestry {-1};
+
+const std::array<TopAbs_ShapeEnum, TopAbs_SHAPE + 1> allShapeTypes {
+    TopAbs_COMPOUND,
+    TopAbs_COMPSOLID,
+    TopAbs_SOLID,
+    TopAbs_SHELL,
+    TopAbs_FACE,
+    TopAbs_WIRE,
+    TopAbs_EDGE,
+    TopAbs_VERTEX,
+    TopAbs_SHAPE,
+};
+
+// Index maps store the shape and a hash chain link besides the key
+constexpr std::size_t indexedMapEntrySize = sizeof(TopoDS_Shape) + 2 * sizeof(void*) + sizeof(int);
+}  // namespace
+
 ShapeRelationKey::ShapeRelationKey(Data::MappedName name, HistoryTraceType historyTraceType)
     : name(std::move(name))
     , historyTraceType(historyTraceType)
@@ -41,11 +67,17 @@ bool ShapeRelationKey::operator<(const ShapeRelationKey& other) const
 
 TopoShape TopoShapeCache::Ancestry::_getTopoShape(const TopoShape& parent, int index)
 {
-    auto& ts = topoShapes[index - 1];
-    if (ts.isNull()) {
-        ts.setShape(shapes.FindKey(index), true);
-        ts.initCache();
-        ts._cache->subLocation = ts._Shape.Location();
+    TopoShape ts;
+    {
+        std::lock_guard<std::mutex> lock(owner->mutex);
+        topoShapes.resize(shapes.Extent());
+        auto& cached = topoShapes[index - 1];
+        if (cached.isNull()) {
+            cached.setShape(shapes.FindKey(index), true);
+            cached.initCache();
+            cached._cache->subLocation = cached._Shape.Location();
+        }
+        ts = cached;
     }
 
     if (ts._Shape.IsEqual(parent._cache->shape)) {
@@ -91,6 +123,10 @@ TopoShape TopoShapeCache::Ancestry::_getTopoShape(const TopoShape& parent, int i
 
 void TopoShapeCache::Ancestry::clear()
 {
+    if (!owner) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(owner->mutex);
     topoShapes.clear();
 }
 
@@ -100,7 +136,6 @@ TopoShape TopoShapeCache::Ancestry::getTopoShape(const TopoShape& parent, int in
     if (index <= 0 || index > shapes.Extent()) {
         return res;
     }
-    topoShapes.resize(shapes.Extent());
     return _getTopoShape(parent, index);
 }
 
@@ -109,7 +144,6 @@ std::vector<TopoShape> TopoShapeCache::Ancestry::getTopoShapes(const TopoShape&
     int count = shapes.Extent();
     std::vector<TopoShape> res;
     res.reserve(count);
-    topoShapes.resize(count);
     for (int i = 1; i <= count; ++i) {
         res.push_back(_getTopoShape(parent, i));
     }
@@ -118,11 +152,16 @@ std::vector<TopoShape> TopoShapeCache::Ancestry::getTopoShapes(const TopoShape&
 
 TopoDS_Shape TopoShapeCache::Ancestry::stripLocation(const TopoDS_Shape& parent, const TopoDS_Shape& child)
 {
-    if (parent.Location() != owner->location) {
-        owner->location = parent.Location();
-        owner->locationInverse = parent.Location().Inverted();
+    TopLoc_Location inverse;
+    {
+        std::lock_guard<std::mutex> lock(owner->mutex);
+        if (parent.Location() != owner->location) {
+            owner->location = parent.Location();
+            owner->locationInverse = parent.Location().Inverted();
+        }
+        inverse = owner->locationInverse;
     }
-    return TopoShape::located(child, owner->locationInverse * child.Location());
+    return TopoShape::located(child, inverse * child.Location());
 }
 
 int TopoShapeCache::Ancestry::find(const TopoDS_Shape& parent, const TopoDS_Shape& subShape)
@@ -154,6 +193,16 @@ bool TopoShapeCache::Ancestry::empty() const
     return shapes.IsEmpty();
 }
 
+std::size_t TopoShapeCache::Ancestry::getMemSize() const
+{
+    std::size_t size = shapes.Extent() * indexedMapEntrySize
+        + topoShapes.capacity() * sizeof(TopoShape);
+    for (const auto& info : ancestors) {
+        size += (info.offsets.capacity() + info.indices.capacity()) * sizeof(int);
+    }
+    return size;
+}
+
 TopoShapeCache::TopoShapeCache(const TopoDS_Shape& tds)
     : shape(tds.Located(TopLoc_Location()))
 {}
@@ -174,25 +223,101 @@ bool TopoShapeCache::isTouched(const TopoDS_Shape& tds) const
     return !this->shape.IsPartner(tds) || this->shape.Orientation() != tds.Orientation();
 }
 
+namespace
+{
+void mapShapes(const TopoDS_Shape& shape, TopAbs_ShapeEnum type, TopTools_IndexedMapOfShape& shapes)
+{
+    if (shape.IsNull()) {
+        return;
+    }
+    if (type == TopAbs_SHAPE) {
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            shapes.Add(it.Value());
+        }
+    }
+    else {
+        TopExp::MapShapes(shape, type, shapes);
+    }
+}
+}  // namespace
+
 TopoShapeCache::Ancestry& TopoShapeCache::getAncestry(TopAbs_ShapeEnum type)
 {
     auto& ancestry = shapeAncestryCache.at(type);
-    if (!ancestry.owner) {
-        ancestry.owner = this;
-        if (!shape.IsNull()) {
-            if (type == TopAbs_SHAPE) {
-                for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
-                    ancestry.shapes.Add(it.Value());
-                }
-            }
-            else {
-                TopExp::MapShapes(shape, type, ancestry.shapes);
-            }
+    if (ancestry.ready.load(std::memory_order_acquire)) {
+        return ancestry;
+    }
+    if (isParallelAncestry()) {
+        buildAncestry();
+    }
+    else {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!ancestry.ready.load(std::memory_order_relaxed)) {
+            mapAncestries({&ancestry});
         }
     }
     return ancestry;
 }
 
+void TopoShapeCache::buildAncestry()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Ancestry*> pending;
+    for (auto type : allShapeTypes) {
+        auto& ancestry = shapeAncestryCache.at(type);
+        if (!ancestry.ready.load(std::memory_order_relaxed)) {
+            pending.push_back(&ancestry);
+        }
+    }
+    mapAncestries(pending);
+}
+
+void TopoShapeCache::mapAncestries(const std::vector<Ancestry*>& pending)
+{
+    // The maps of different types are independent and only read the shape
+    auto map = [&](std::size_t i) {
+        auto type = static_cast<TopAbs_ShapeEnum>(pending[i] - shapeAncestryCache.data());
+        pending[i]->owner = this;
+        mapShapes(shape, type, pending[i]->shapes);
+    };
+    if (pending.size() > 1) {
+        Base::parallelFor(pending.size(), map);
+    }
+    else if (!pending.empty()) {
+        map(0);
+    }
+    for (auto ancestry : pending) {
+        ancestry->ready.store(true, std::memory_order_release);
+    }
+}
+
+void TopoShapeCache::setParallelAncestry(bool enable)
+{
+    parallelAncestry = enable ? 1 : 0;
+}
+
+bool TopoShapeCache::isParallelAncestry()
+{
+    int parallel = parallelAncestry;
+    if (parallel < 0) {
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General"
+        );
+        parallel = hGrp->GetBool("ParallelAncestry", false) ? 1 : 0;
+        parallelAncestry = parallel;
+    }
+    return parallel != 0;
+}
+
+std::size_t TopoShapeCache::getMemSize() const
+{
+    std::size_t size = sizeof(TopoShapeCache);
+    for (const auto& ancestry : shapeAncestryCache) {
+        size += ancestry.getMemSize();
+    }
+    return size;
+}
+
 int TopoShapeCache::countShape(TopAbs_ShapeEnum type)
 {
     if (shape.IsNull()) {
@@ -230,29 +355,73 @@ TopoDS_Shape TopoShapeCache::findAncestor(
     }
 
     auto& info = getAncestry(type);
+    auto& subInfo = getAncestry(subShape.ShapeType());
 
     auto& ancestorInfo = info.ancestors.at(subShape.ShapeType());
-    if (!ancestorInfo.initialized) {
-        ancestorInfo.initialized = true;
-        // ancestorInfo.shapes is the output variable here, storing (and caching) the actual map
-        TopExp::MapShapesAndAncestors(shape, subShape.ShapeType(), type, ancestorInfo.shapes);
-    }
-    int index = parent.Location().IsIdentity()
-        ? ancestorInfo.shapes.FindIndex(subShape)
-        : ancestorInfo.shapes.FindIndex(info.stripLocation(parent, subShape));
-    if (index == 0) {
+    if (!ancestorInfo.initialized.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!ancestorInfo.initialized.load(std::memory_order_relaxed)) {
+            // Same as TopExp::MapShapesAndAncestors(), but stores indices into the existing maps
+            // instead of lists of shapes
+            int count = info.count();
+            std::vector<std::vector<int>> children(count);
+            auto collect = [&](std::size_t i) {
+                const TopoDS_Shape& ancestor = info.shapes.FindKey(static_cast<int>(i) + 1);
+                for (TopExp_Explorer xp(ancestor, subShape.ShapeType()); xp.More(); xp.Next()) {
+                    int index = subInfo.shapes.FindIndex(xp.Current());
+                    if (index > 0) {
+                        children[i].push_back(index);
+                    }
+                }
+            };
+            if (isParallelAncestry()) {
+                Base::parallelFor(children.size(), collect);
+            }
+            else {
+                for (std::size_t i = 0; i < children.size(); ++i) {
+                    collect(i);
+                }
+            }
+
+            auto& offsets = ancestorInfo.offsets;
+            offsets.assign(subInfo.count() + 1, 0);
+            for (const auto& indices : children) {
+                for (int index : indices) {
+                    ++offsets[index];
+                }
+            }
+            for (std::size_t i = 1; i < offsets.size(); ++i) {
+                offsets[i] += offsets[i - 1];
+            }
+            ancestorInfo.indices.resize(offsets.back());
+            // fill from the back to keep the ancestors in order
+            for (int i = count; i > 0; --i) {
+                for (int index : children[i - 1]) {
+                    ancestorInfo.indices[--offsets[index]] = i;
+                }
+            }
+            // offsets[i] now is where the ancestors of i start, shift it to the layout described
+            // in AncestorInfo
+            offsets.erase(offsets.begin());
+            offsets.push_back(static_cast<int>(ancestorInfo.indices.size()));
+            ancestorInfo.initialized.store(true, std::memory_order_release);
+        }
+    }
+    int index = subInfo.find(parent, subShape);
+    if (index <= 0 || index >= static_cast<int>(ancestorInfo.offsets.size())) {
         return nullShape;
     }
-    const auto& shapes = ancestorInfo.shapes.FindFromIndex(index);
-    if (shapes.Extent() == 0) {
+    int begin = ancestorInfo.offsets[index - 1];
+    int end = ancestorInfo.offsets[index];
+    if (begin == end) {
         return nullShape;
     }
 
     if (ancestors) {
-        ancestors->reserve(ancestors->size() + shapes.Extent());
-        for (TopTools_ListIteratorOfListOfShape it(shapes); it.More(); it.Next()) {
-            ancestors->push_back(TopoShape::moved(it.Value(), parent.Location()));
+        ancestors->reserve(ancestors->size() + end - begin);
+        for (int i = begin; i < end; ++i) {
+            ancestors->push_back(info.find(parent, ancestorInfo.indices[i]));
         }
     }
-    return TopoShape::moved(shapes.First(), parent.Location());
+    return info.find(parent, ancestorInfo.indices[begin]);
 }
@@ -32,7 +32,14 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <GProp_GProps.hxx>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <App/ElementMap.h>
 
@@ -52,6 +59,12 @@ struct PartExport ShapeRelationKey
     bool operator<(const ShapeRelationKey& other) const;
 };
 
+/** Lazily built sub shape maps of a TopoShape, shared by all copies of the shape.
+ *
+ * The maps are looked up concurrently, e.g. by parallel recomputes and exporters. Building a map
+ * or ancestor table, filling the cached sub TopoShapes and the location cache are guarded by a
+ * mutex; lookups in already built maps take no lock.
+ */
 class PartExport TopoShapeCache: public std::enable_shared_from_this<TopoShapeCache>
 {
 public:
@@ -62,6 +75,11 @@ public:
     /// generated.
     Data::ElementMapPtr cachedElementMap;
 
+    /// Recorded shape history of the operation that made the owner TopoShape, if generating its
+    /// element map has been deferred. See TopoShape::setElementMapDeferred().
+    struct PendingElementMap;
+    std::shared_ptr<PendingElementMap> pendingElementMap;
+
     /// Location of the original cached TopoDS_Shape.
     TopLoc_Location subLocation;
 
@@ -75,10 +93,14 @@ public:
     /// Inverse of location
     TopLoc_Location locationInverse;
 
+    /// Compact ancestor table of one sub shape type. The ancestors of the sub shape with index i
+    /// (in the ancestry of the sub shape type) are at indices[offsets[i - 1]] up to
+    /// indices[offsets[i] - 1], given as index in the ancestry of the ancestor type.
     struct PartExport AncestorInfo
     {
-        bool initialized = false;
-        TopTools_IndexedDataMapOfShapeListOfShape shapes;
+        std::atomic<bool> initialized {false};
+        std::vector<int> offsets;
+        std::vector<int> indices;
     };
 
     /// Class for caching the ancestor and children shapes mapping
@@ -87,6 +109,9 @@ public:
     private:
         TopoShapeCache* owner = nullptr;
 
+        /// Set once shapes is built, after which it is only read
+        std::atomic<bool> ready {false};
+
         /// OCCT map from the owner TopoShape to a list of children (i.e. lower hierarchical)
         /// TopoDS_Shape
         TopTools_IndexedMapOfShape shapes;
@@ -94,10 +119,9 @@ public:
         /// One-to-one corresponding TopoShape to each child TopoDS_Shape
         std::vector<TopoShape> topoShapes;
 
-        /// Caches the OCCT ancestor shape maps, e.g.
+        /// Caches the ancestor shape tables, e.g.
         ///     Cache::shapeAncestryCache[TopAbs_FACE].ancestors[TopAbs_EDGE]
-        /// stores an OCCT TopTools_IndexedDataMapOfShapeListOfShape that can return a list of
-        /// faces containing a given edge.
+        /// stores the indices of the faces containing a given edge.
         std::array<AncestorInfo, TopAbs_SHAPE + 1> ancestors;
 
         TopoShape _getTopoShape(const TopoShape& parent, int index);
@@ -111,6 +135,7 @@ public:
         TopoDS_Shape find(const TopoDS_Shape& parent, int index);
         int count() const;
         bool empty() const;
+        std::size_t getMemSize() const;
 
         friend TopoShapeCache;
     };
@@ -119,6 +144,19 @@ public:
     void insertRelation(const ShapeRelationKey& key, const QVector<Data::MappedElement>& value);
     bool isTouched(const TopoDS_Shape& tds) const;
     Ancestry& getAncestry(TopAbs_ShapeEnum type);
+
+    /// Builds the children maps of all shape types at once, in parallel.
+    void buildAncestry();
+
+    /// Sets whether getAncestry() builds the maps of all shape types in parallel on first use,
+    /// and whether ancestor tables are built in parallel. This pays off for big compounds, e.g.
+    /// imported STEP files. The default is taken from the parameter ParallelAncestry of
+    /// Mod/Part/General.
+    static void setParallelAncestry(bool enable);
+    static bool isParallelAncestry();
+
+    /// Estimated memory used by the cached shape maps and ancestor tables
+    std::size_t getMemSize() const;
     int countShape(TopAbs_ShapeEnum type);
     int findShape(const TopoDS_Shape& parent, const TopoDS_Shape& subShape);
     TopoDS_Shape findShape(const TopoDS_Shape& parent, TopAbs_ShapeEnum type, int index);
@@ -140,6 +178,14 @@ public:
     std::array<Ancestry, TopAbs_SHAPE + 1> shapeAncestryCache;
 
     std::map<ShapeRelationKey, QVector<Data::MappedElement>> relations;
+
+    /// Global properties of the cached (unlocated) shape, indexed by TopoShape::MassPropertyType
+    std::array<std::optional<GProp_GProps>, 3> massProperties;
+
+private:
+    void mapAncestries(const std::vector<Ancestry*>& pending);
+
+    std::mutex mutex;
 };
 
 }  // namespace Part
@@ -22,6 +22,7 @@
  *                                                                          *
  ***************************************************************************/
 
+#include <atomic>
 #include <cmath>
 #include <limits>
 
@@ -31,11 +32,13 @@
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_CompCurve.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #if OCC_VERSION_HEX < 0x070600
 # include <BRepAdaptor_HCurve.hxx>
 # include <BRepAdaptor_HCompCurve.hxx>
 #endif
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepFill.hxx>
@@ -56,6 +59,7 @@
 #include <BRepBuilderAPI_MakeSolid.hxx>
 #include <BRepBuilderAPI_NurbsConvert.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <BRepGProp.hxx>
 #include <BRepFilletAPI_MakeChamfer.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
 #include <BRepLib.hxx>
@@ -80,8 +84,12 @@
 #include <ShapeFix_Shape.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <gp_Pln.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/geometry.hpp>
 
 #include <utility>
 
@@ -100,10 +108,12 @@
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/BoundBox.h"
 #include "Base/Exception.h"
+#include "Base/Parallel.h"
 #include "Base/Tools.h"
 #include <SignalException.h>
 #include "OCCTProgressIndicator.h"
 
+#include <App/Application.h>
 #include <App/ElementMap.h>
 #include <App/ElementNamingUtils.h>
 #include <ShapeAnalysis_FreeBoundsProperties.hxx>
@@ -136,6 +146,87 @@ static void expandCompound(const TopoShape& shape, std::vector<TopoShape>& res)
     }
 }
 
+namespace
+{
+/// Deferred element map generation, -1 means not yet read from the parameters
+std::atomic<int> elementMapDeferred {-1};
+
+/** Shape mapper replaying the history recorded from another mapper
+ *
+ * The mappers wrapping OCCT builders are only valid as long as the builder
+ * exists, so the history needed by makeShapeWithElementMap() is copied here
+ * when element map generation is deferred.
+ */
+struct MapperRecord: TopoShape::Mapper
+{
+    using ShapeMap = std::
+        unordered_map<TopoDS_Shape, std::vector<TopoDS_Shape>, ShapeHasher, ShapeHasher>;
+    ShapeMap generatedShapes;
+    ShapeMap modifiedShapes;
+
+    /// Record the history of all vertices, edges and faces of the given source shape
+    void record(const TopoShape::Mapper& mapper, const TopoShape& source)
+    {
+        for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+            int count = static_cast<int>(source.countSubShapes(type));
+            for (int i = 1; i <= count; ++i) {
+                auto element = source.findShape(type, i);
+                const auto& modified = mapper.modified(element);
+                if (!modified.empty()) {
+                    modifiedShapes.emplace(element, modified);
+                }
+                const auto& generated = mapper.generated(element);
+                if (!generated.empty()) {
+                    generatedShapes.emplace(element, generated);
+                }
+            }
+        }
+    }
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        auto iter = generatedShapes.find(s);
+        return iter != generatedShapes.end() ? iter->second : _res;
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        auto iter = modifiedShapes.find(s);
+        return iter != modifiedShapes.end() ? iter->second : _res;
+    }
+};
+}  // namespace
+
+void TopoShape::setElementMapDeferred(bool enable)
+{
+    elementMapDeferred = enable ? 1 : 0;
+}
+
+bool TopoShape::isElementMapDeferred()
+{
+    int deferred = elementMapDeferred;
+    if (deferred < 0) {
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General"
+        );
+        deferred = hGrp->GetBool("LazyElementMap", false) ? 1 : 0;
+        elementMapDeferred = deferred;
+    }
+    return deferred != 0;
+}
+
+struct TopoShapeCache::PendingElementMap
+{
+    /// The shape as it was when it was made
+    TopoDS_Shape shape;
+    long tag = 0;
+    App::StringHasherRef hasher;
+    std::string op;
+    MapperRecord mapper;
+    /// The mappable source shapes, kept alive until the map is generated
+    std::vector<TopoShape> shapes;
+};
+
 void TopoShape::initCache(int reset) const
 {
     if (reset > 0 || !_cache || _cache->isTouched(_Shape)) {
@@ -147,6 +238,86 @@ void TopoShape::initCache(int reset) const
     }
 }
 
+namespace
+{
+GProp_GProps computeMassProperties(const TopoDS_Shape& shape, TopoShape::MassPropertyType type)
+{
+    GProp_GProps props;
+    switch (type) {
+        case TopoShape::MassPropertyType::Linear:
+            BRepGProp::LinearProperties(shape, props);
+            break;
+        case TopoShape::MassPropertyType::Surface:
+            BRepGProp::SurfaceProperties(shape, props);
+            break;
+        case TopoShape::MassPropertyType::Volume:
+            BRepGProp::VolumeProperties(shape, props);
+            break;
+    }
+    return props;
+}
+}  // namespace
+
+TopoShape::MassProperties TopoShape::getMassProperties(MassPropertyType type) const
+{
+    MassProperties result;
+    if (_Shape.IsNull()) {
+        return result;
+    }
+
+    gp_Trsf trsf = _Shape.Location().Transformation();
+    GProp_GProps props;
+    if (trsf.IsNegative()) {
+        // A mirroring location flips the sign of oriented integrals, so compute the located
+        // shape directly instead of transforming the cached result
+        props = computeMassProperties(_Shape, type);
+        trsf = gp_Trsf();
+    }
+    else {
+        initCache();
+        auto& cached = _cache->massProperties[static_cast<int>(type)];
+        if (!cached) {
+            const TopoDS_Shape& shape = _cache->shape;
+            std::vector<TopoDS_Shape> children;
+            if (shape.ShapeType() == TopAbs_COMPOUND) {
+                for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+                    children.push_back(it.Value());
+                }
+            }
+            if (children.size() > 1) {
+                std::vector<GProp_GProps> childProps(children.size());
+                Base::parallelFor(children.size(), [&](std::size_t i) {
+                    childProps[i] = computeMassProperties(children[i], type);
+                });
+                cached.emplace();
+                for (const auto& childProp : childProps) {
+                    cached->Add(childProp);
+                }
+            }
+            else {
+                cached = computeMassProperties(shape, type);
+            }
+        }
+        props = *cached;
+    }
+
+    // Length, area and volume scale with the power of their dimension, the matrix of inertia by
+    // two more
+    int dimension = static_cast<int>(type) + 1;
+    double scale = trsf.ScaleFactor();
+    result.mass = props.Mass() * std::pow(scale, dimension);
+    result.centerOfMass = Base::convertTo<Base::Vector3d>(props.CentreOfMass().Transformed(trsf));
+    gp_Mat rotation = trsf.HVectorialPart();
+    gp_Mat inertia = rotation * props.MatrixOfInertia() * rotation.Transposed()
+        * std::pow(scale, dimension + 2);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            result.matrixOfInertia[i][j] = inertia(i + 1, j + 1);
+        }
+    }
+    return result;
+}
+
 Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
 {
     if (_cache && elementMap != this->elementMap(false)) {
@@ -188,6 +359,13 @@ void TopoShape::flushElementMap() const
             this->_subLocation.Identity();
             const_cast<TopoShape*>(this)->resetElementMap(self.elementMap());
         }
+        else if (this->_cache->pendingElementMap) {
+            // Take the pending history first, as generating the map flushes again
+            auto pending = std::move(this->_cache->pendingElementMap);
+            TopoShape self(pending->tag, pending->hasher, pending->shape);
+            self.makeElementMapFromHistory(pending->mapper, pending->shapes, pending->op.c_str());
+            const_cast<TopoShape*>(this)->resetElementMap(self.elementMap());
+        }
     }
 }
 
@@ -727,7 +905,8 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(
 bool TopoShape::hasPendingElementMap() const
 {
     return !elementMap(false) && this->_cache
-        && (this->_parentCache || this->_cache->cachedElementMap);
+        && (this->_parentCache || this->_cache->cachedElementMap
+            || this->_cache->pendingElementMap);
 }
 
 bool TopoShape::canMapElement(const TopoShape& other) const
@@ -1436,6 +1615,34 @@ TopoShape& TopoShape::makeShapeWithElementMap(
     if (!op) {
         op = Part::OpCodes::Maker;
     }
+
+    if (isElementMapDeferred()) {
+        // Use a cache of our own, as the pending map must not leak into other
+        // shapes sharing the current one.
+        initCache(1);
+        auto pending = std::make_shared<TopoShapeCache::PendingElementMap>();
+        pending->shape = _Shape;
+        pending->tag = Tag;
+        pending->hasher = Hasher;
+        pending->op = op;
+        for (auto& incomingShape : shapes) {
+            if (canMapElement(incomingShape)) {
+                pending->mapper.record(mapper, incomingShape);
+                pending->shapes.push_back(incomingShape);
+            }
+        }
+        _cache->pendingElementMap = std::move(pending);
+        return *this;
+    }
+    return makeElementMapFromHistory(mapper, shapes, op);
+}
+
+TopoShape& TopoShape::makeElementMapFromHistory(
+    const Mapper& mapper,
+    const std::vector<TopoShape>& shapes,
+    const char* op
+)
+{
     std::string _op = op;
     _op += '_';
 
@@ -2041,6 +2248,12 @@ TopoShape TopoShape::getSubTopoShape(const char* Type, bool silent) const
         return *this;
     }
 
+    // Plain names like "Face12" are their own indexed name, so skip the element map lookup
+    auto res = shapeTypeAndIndex(Type);
+    if (res.second > 0) {
+        return getSubTopoShape(res.first, res.second, silent);
+    }
+
     Data::MappedElement mapped = getElementName(Type);
     if (!mapped.index && boost::starts_with(Type, elementMapPrefix())) {
         if (!silent) {
@@ -2048,7 +2261,7 @@ TopoShape TopoShape::getSubTopoShape(const char* Type, bool silent) const
         }
         return TopoShape();
     }
-    auto res = shapeTypeAndIndex(mapped.index);
+    res = shapeTypeAndIndex(mapped.index);
     if (res.second <= 0) {
         if (!silent) {
             FC_THROWM(Base::ValueError, "Invalid shape name " << (Type ? Type : ""));
@@ -5819,6 +6032,87 @@ TopoShape& TopoShape::makeElementBoolean(
 }
 
 
+namespace
+{
+bool isBooleanClustering()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/Boolean"
+    );
+    return hGrp->GetBool("ClusterBooleans", false);
+}
+
+Bnd_Box getBooleanBounds(const TopoShape& shape, double tolerance)
+{
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape.getShape(), bounds);
+    bounds.Enlarge(std::max(std::fabs(tolerance), Precision::Confusion()));
+    return bounds;
+}
+
+// Groups the shapes into clusters of transitively overlapping bounding boxes, in order of
+// their first shape
+std::vector<std::vector<std::size_t>> clusterByBounds(
+    const std::vector<TopoShape>& shapes,
+    double tolerance
+)
+{
+    namespace bg = boost::geometry;
+    namespace bgi = boost::geometry::index;
+    using Point = bg::model::point<double, 3, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, std::size_t>;
+
+    std::vector<Value> values;
+    values.reserve(shapes.size());
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        Bnd_Box bounds = getBooleanBounds(shapes[i], tolerance);
+        if (bounds.IsVoid()) {
+            continue;
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        values.emplace_back(Box(Point(xMin, yMin, zMin), Point(xMax, yMax, zMax)), i);
+    }
+    bgi::rtree<Value, bgi::quadratic<16>> tree(values.begin(), values.end());
+
+    std::vector<std::size_t> parents(shapes.size());
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+        parents[i] = i;
+    }
+    auto findRoot = [&parents](std::size_t i) {
+        while (parents[i] != i) {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    };
+    std::vector<Value> hits;
+    for (const auto& value : values) {
+        hits.clear();
+        tree.query(bgi::intersects(value.first), std::back_inserter(hits));
+        for (const auto& hit : hits) {
+            auto root1 = findRoot(value.second);
+            auto root2 = findRoot(hit.second);
+            if (root1 != root2) {
+                parents[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+    }
+
+    std::vector<std::vector<std::size_t>> clusters;
+    std::map<std::size_t, std::size_t> clusterOfRoot;
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        auto res = clusterOfRoot.emplace(findRoot(i), clusters.size());
+        if (res.second) {
+            clusters.emplace_back();
+        }
+        clusters[res.first->second].push_back(i);
+    }
+    return clusters;
+}
+}  // namespace
+
 // TODO: Refactor this so that each OpCode type is a separate method to reduce size
 TopoShape& TopoShape::makeElementBoolean(
     const char* maker,
@@ -5967,6 +6261,53 @@ TopoShape& TopoShape::makeElementBoolean(
         return *this;
     }
 
+    if (inputs.size() > 2 && isBooleanClustering()) {
+        if (strcmp(maker, Part::OpCodes::Cut) == 0) {
+            // Tools that do not reach the base shape cannot cut anything
+            Bnd_Box baseBounds = getBooleanBounds(inputs[0], tolerance);
+            std::vector<TopoShape> tools;
+            tools.push_back(inputs[0]);
+            for (std::size_t i = 1; i < inputs.size(); ++i) {
+                if (!baseBounds.IsOut(getBooleanBounds(inputs[i], tolerance))) {
+                    tools.push_back(inputs[i]);
+                }
+            }
+            if (tools.size() < inputs.size()) {
+                if (tools.size() == 1) {
+                    return makeElementCopy(inputs[0], op);
+                }
+                return makeElementBoolean(maker, tools, op, tolerance);
+            }
+        }
+        else if (strcmp(maker, Part::OpCodes::Fuse) == 0) {
+            // Shapes in different clusters do not touch, fuse each cluster on its own and
+            // combine the results as a compound
+            auto clusters = clusterByBounds(inputs, tolerance);
+            if (clusters.size() > 1) {
+                std::vector<TopoShape> results(clusters.size());
+                Base::parallelFor(clusters.size(), [&](std::size_t i) {
+                    const auto& cluster = clusters[i];
+                    if (cluster.size() == 1) {
+                        results[i] = inputs[cluster.front()];
+                        return;
+                    }
+                    std::vector<TopoShape> members;
+                    members.reserve(cluster.size());
+                    for (auto index : cluster) {
+                        members.push_back(inputs[index]);
+                    }
+                    results[i] = TopoShape(Tag, Hasher)
+                                     .makeElementBoolean(maker, members, op, tolerance);
+                });
+                return makeElementCompound(
+                    results,
+                    op,
+                    SingleShapeCompoundCreationPolicy::returnShape
+                );
+            }
+        }
+    }
+
     std::unique_ptr<BRepAlgoAPI_BooleanOperation> mk;
     if (strcmp(maker, Part::OpCodes::Fuse) == 0) {
         mk.reset(new FCBRepAlgoAPI_Fuse);
@@ -6000,7 +6341,7 @@ TopoShape& TopoShape::makeElementBoolean(
         }
     }
 
-    mk->SetRunParallel(Standard_True);
+    mk->SetRunParallel(FCBRepAlgoAPIHelper::runParallel());
     OSD_Parallel::SetUseOcctThreads(Standard_True);
 
     mk->SetArguments(shapeArguments);
@@ -6037,6 +6378,125 @@ bool TopoShape::isSame(const Data::ComplexGeoData& _other) const
     return Tag == other.Tag && Hasher == other.Hasher && _Shape.IsEqual(other._Shape);
 }
 
+namespace
+{
+void hashPoint(std::size_t& seed, const gp_Pnt& pnt)
+{
+    boost::hash_combine(seed, pnt.X());
+    boost::hash_combine(seed, pnt.Y());
+    boost::hash_combine(seed, pnt.Z());
+}
+
+void hashCurve(std::size_t& seed, const TopoDS_Edge& edge)
+{
+    if (BRep_Tool::Degenerated(edge)) {
+        return;
+    }
+    BRepAdaptor_Curve curve(edge);
+    double first = curve.FirstParameter();
+    double last = curve.LastParameter();
+    boost::hash_combine(seed, static_cast<int>(curve.GetType()));
+    boost::hash_combine(seed, first);
+    boost::hash_combine(seed, last);
+    if (curve.GetType() == GeomAbs_BSplineCurve) {
+        Handle(Geom_BSplineCurve) spline = curve.BSpline();
+        for (int i = 1; i <= spline->NbPoles(); ++i) {
+            hashPoint(seed, spline->Pole(i));
+            boost::hash_combine(seed, spline->Weight(i));
+        }
+        for (int i = 1; i <= spline->NbKnots(); ++i) {
+            boost::hash_combine(seed, spline->Knot(i));
+        }
+        return;
+    }
+    if (Precision::IsInfinite(first) || Precision::IsInfinite(last)) {
+        return;
+    }
+    for (double fraction : {0.25, 0.5, 0.75}) {
+        hashPoint(seed, curve.Value(first + (last - first) * fraction));
+    }
+}
+
+void hashSurface(std::size_t& seed, const TopoDS_Face& face)
+{
+    BRepAdaptor_Surface surface(face);
+    double u1 = surface.FirstUParameter();
+    double u2 = surface.LastUParameter();
+    double v1 = surface.FirstVParameter();
+    double v2 = surface.LastVParameter();
+    boost::hash_combine(seed, static_cast<int>(surface.GetType()));
+    for (double param : {u1, u2, v1, v2}) {
+        boost::hash_combine(seed, param);
+    }
+    if (surface.GetType() == GeomAbs_BSplineSurface) {
+        Handle(Geom_BSplineSurface) spline = surface.BSpline();
+        for (int i = 1; i <= spline->NbUPoles(); ++i) {
+            for (int j = 1; j <= spline->NbVPoles(); ++j) {
+                hashPoint(seed, spline->Pole(i, j));
+                boost::hash_combine(seed, spline->Weight(i, j));
+            }
+        }
+        return;
+    }
+    if (Precision::IsInfinite(u1) || Precision::IsInfinite(u2) || Precision::IsInfinite(v1)
+        || Precision::IsInfinite(v2)) {
+        return;
+    }
+    for (double fraction : {0.25, 0.5, 0.75}) {
+        hashPoint(seed, surface.Value(u1 + (u2 - u1) * fraction, v2 - (v2 - v1) * fraction));
+    }
+}
+}  // namespace
+
+std::size_t TopoShape::getFingerprint() const
+{
+    std::size_t seed = 0;
+    if (_Shape.IsNull()) {
+        return seed;
+    }
+    boost::hash_combine(seed, static_cast<int>(_Shape.ShapeType()));
+    boost::hash_combine(seed, static_cast<int>(_Shape.Orientation()));
+    for (auto type : {TopAbs_SOLID, TopAbs_SHELL, TopAbs_WIRE}) {
+        boost::hash_combine(seed, countSubShapes(type));
+    }
+
+    TopTools_IndexedMapOfShape vertices;
+    TopExp::MapShapes(_Shape, TopAbs_VERTEX, vertices);
+    boost::hash_combine(seed, vertices.Extent());
+    for (int i = 1; i <= vertices.Extent(); ++i) {
+        const auto& vertex = TopoDS::Vertex(vertices(i));
+        boost::hash_combine(seed, BRep_Tool::Tolerance(vertex));
+        hashPoint(seed, BRep_Tool::Pnt(vertex));
+    }
+
+    TopTools_IndexedMapOfShape edges;
+    TopExp::MapShapes(_Shape, TopAbs_EDGE, edges);
+    boost::hash_combine(seed, edges.Extent());
+    for (int i = 1; i <= edges.Extent(); ++i) {
+        const auto& edge = TopoDS::Edge(edges(i));
+        boost::hash_combine(seed, BRep_Tool::Tolerance(edge));
+        for (TopExp_Explorer xp(edge, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            boost::hash_combine(seed, vertices.FindIndex(xp.Current()));
+            boost::hash_combine(seed, static_cast<int>(xp.Current().Orientation()));
+        }
+        hashCurve(seed, edge);
+    }
+
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(_Shape, TopAbs_FACE, faces);
+    boost::hash_combine(seed, faces.Extent());
+    for (int i = 1; i <= faces.Extent(); ++i) {
+        const auto& face = TopoDS::Face(faces(i));
+        boost::hash_combine(seed, BRep_Tool::Tolerance(face));
+        boost::hash_combine(seed, static_cast<int>(face.Orientation()));
+        for (TopExp_Explorer xp(face, TopAbs_EDGE); xp.More(); xp.Next()) {
+            boost::hash_combine(seed, edges.FindIndex(xp.Current()));
+        }
+        hashSurface(seed, face);
+    }
+    return seed;
+}
+
 long TopoShape::isElementGenerated(const Data::MappedName& _name, int depth) const
 {
     long res = 0;
@@ -1721,6 +1721,117 @@ PyObject* TopoShapePy::tessellate(PyObject* args) const
     }
 }
 
+PyObject* TopoShapePy::countTessellation(PyObject* args) const
+{
+    double tolerance;
+    if (!PyArg_ParseTuple(args, "d", &tolerance)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto [nodes, triangles] = getTopoShapePtr()->countFaceTriangulation(tolerance);
+        return Py_BuildValue(
+            "(nn)",
+            static_cast<Py_ssize_t>(nodes),
+            static_cast<Py_ssize_t>(triangles)
+        );
+    }
+    PY_CATCH_OCC
+}
+
+namespace
+{
+// Writable C contiguous buffer of a Python object, released on destruction
+class WritableBuffer
+{
+public:
+    WritableBuffer() = default;
+    WritableBuffer(const WritableBuffer&) = delete;
+    WritableBuffer& operator=(const WritableBuffer&) = delete;
+    ~WritableBuffer()
+    {
+        if (acquired) {
+            PyBuffer_Release(&view);
+        }
+    }
+
+    bool get(PyObject* obj)
+    {
+        if (PyObject_GetBuffer(obj, &view, PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+            return false;
+        }
+        acquired = true;
+        return true;
+    }
+
+    /// Item type of the buffer, without byte order prefix
+    char type() const
+    {
+        const char* format = view.format ? view.format : "B";
+        if (*format == '@' || *format == '=' || *format == '<') {
+            ++format;
+        }
+        return format[1] ? '\0' : format[0];
+    }
+    std::size_t count() const
+    {
+        return static_cast<std::size_t>(view.len / view.itemsize);
+    }
+
+    Py_buffer view = Py_buffer();
+
+private:
+    bool acquired = false;
+};
+}  // namespace
+
+PyObject* TopoShapePy::fillTessellation(PyObject* args) const
+{
+    PyObject* pyPoints;
+    PyObject* pyFacets;
+    if (!PyArg_ParseTuple(args, "OO", &pyPoints, &pyFacets)) {
+        return nullptr;
+    }
+
+    WritableBuffer points;
+    WritableBuffer facets;
+    if (!points.get(pyPoints) || !facets.get(pyFacets)) {
+        return nullptr;
+    }
+    char pointType = points.type();
+    bool isFloat = pointType == 'f' && points.view.itemsize == sizeof(float);
+    bool isDouble = pointType == 'd' && points.view.itemsize == sizeof(double);
+    if (!isFloat && !isDouble) {
+        PyErr_SetString(PyExc_TypeError, "Expect a float32 or float64 buffer of points");
+        return nullptr;
+    }
+    char facetType = facets.type();
+    if ((facetType != 'I' && facetType != 'L') || facets.view.itemsize != sizeof(uint32_t)) {
+        PyErr_SetString(PyExc_TypeError, "Expect a uint32 buffer of facets");
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto [nodes, triangles] = getTopoShapePtr()->countFaceTriangulation();
+        if (points.count() < 3 * nodes || facets.count() < 3 * triangles) {
+            PyErr_SetString(PyExc_ValueError, "Buffers too small for the tessellation");
+            return nullptr;
+        }
+
+        auto* facetData = static_cast<uint32_t*>(facets.view.buf);
+        if (isFloat) {
+            getTopoShapePtr()->getFaceTriangulation(static_cast<float*>(points.view.buf), facetData);
+        }
+        else {
+            getTopoShapePtr()->getFaceTriangulation(static_cast<double*>(points.view.buf), facetData);
+        }
+        Py_Return;
+    }
+    PY_CATCH_OCC
+}
+
 PyObject* TopoShapePy::project(PyObject* args) const
 {
     PyObject* obj;
@@ -2835,35 +2946,29 @@ Py::List TopoShapePy::getCompounds() const
 
 Py::Float TopoShapePy::getLength() const
 {
-    const TopoDS_Shape& shape = getTopoShapePtr()->getShape();
-    if (shape.IsNull()) {
+    if (getTopoShapePtr()->isNull()) {
         throw Py::RuntimeError("shape is invalid");
     }
-    GProp_GProps props;
-    BRepGProp::LinearProperties(shape, props);
-    return Py::Float(props.Mass());
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Linear);
+    return Py::Float(props.mass);
 }
 
 Py::Float TopoShapePy::getArea() const
 {
-    const TopoDS_Shape& shape = getTopoShapePtr()->getShape();
-    if (shape.IsNull()) {
+    if (getTopoShapePtr()->isNull()) {
         throw Py::RuntimeError("shape is invalid");
     }
-    GProp_GProps props;
-    BRepGProp::SurfaceProperties(shape, props);
-    return Py::Float(props.Mass());
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Surface);
+    return Py::Float(props.mass);
 }
 
 Py::Float TopoShapePy::getVolume() const
 {
-    const TopoDS_Shape& shape = getTopoShapePtr()->getShape();
-    if (shape.IsNull()) {
+    if (getTopoShapePtr()->isNull()) {
         throw Py::RuntimeError("shape is invalid");
     }
-    GProp_GProps props;
-    BRepGProp::VolumeProperties(shape, props);
-    return Py::Float(props.Mass());
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Volume);
+    return Py::Float(props.mass);
 }
 
 PyObject* TopoShapePy::getElementHistory(PyObject* args) const
@@ -103,32 +103,20 @@ int TopoShapeSolidPy::PyInit(PyObject* args, PyObject* /*kwd*/)
 
 Py::Float TopoShapeSolidPy::getMass() const
 {
-    GProp_GProps props;
-    BRepGProp::VolumeProperties(getTopoShapePtr()->getShape(), props);
-    double c = props.Mass();
-    return Py::Float(c);
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Volume);
+    return Py::Float(props.mass);
 }
 
 Py::Object TopoShapeSolidPy::getCenterOfMass() const
 {
-    GProp_GProps props;
-    BRepGProp::VolumeProperties(getTopoShapePtr()->getShape(), props);
-    gp_Pnt c = props.CentreOfMass();
-    return Py::Vector(Base::Vector3d(c.X(), c.Y(), c.Z()));
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Volume);
+    return Py::Vector(props.centerOfMass);
 }
 
 Py::Object TopoShapeSolidPy::getMatrixOfInertia() const
 {
-    GProp_GProps props;
-    BRepGProp::VolumeProperties(getTopoShapePtr()->getShape(), props);
-    gp_Mat m = props.MatrixOfInertia();
-    Base::Matrix4D mat;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            mat[i][j] = m(i + 1, j + 1);
-        }
-    }
-    return Py::Matrix(mat);
+    auto props = getTopoShapePtr()->getMassProperties(TopoShape::MassPropertyType::Volume);
+    return Py::Matrix(props.matrixOfInertia);
 }
 
 Py::Object TopoShapeSolidPy::getStaticMoments() const
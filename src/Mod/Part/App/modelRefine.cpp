@@ -24,6 +24,7 @@
 
 
 #include <algorithm>
+#include <map>
 #include <numbers>
 #include <iterator>
 #include <Bnd_Box.hxx>
@@ -45,6 +46,7 @@
 #include <Geom_Surface.hxx>
 #include <GeomAdaptor_Surface.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <gp.hxx>
 #include <gp_Ax3.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Pln.hxx>
@@ -68,6 +70,7 @@
 #include <TopTools_ListOfShape.hxx>
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 
 #include "modelRefine.h"
 
@@ -157,15 +160,23 @@ bool FaceTypeSplitter::hasType(const GeomAbs_SurfaceType& type) const
 
 void FaceTypeSplitter::split()
 {
+    FaceVectorType faces;
     TopExp_Explorer shellIt;
     for (shellIt.Init(shell, TopAbs_FACE); shellIt.More(); shellIt.Next()) {
-        TopoDS_Face tempFace(TopoDS::Face(shellIt.Current()));
-        GeomAbs_SurfaceType currentType = FaceTypedBase::getFaceType(tempFace);
-        SplitMapType::iterator mapIt = typeMap.find(currentType);
+        faces.push_back(TopoDS::Face(shellIt.Current()));
+    }
+
+    std::vector<GeomAbs_SurfaceType> types(faces.size());
+    Base::parallelFor(faces.size(), [&](std::size_t index) {
+        types[index] = FaceTypedBase::getFaceType(faces[index]);
+    });
+
+    for (std::size_t index = 0; index < faces.size(); ++index) {
+        SplitMapType::iterator mapIt = typeMap.find(types[index]);
         if (mapIt == typeMap.end()) {
             continue;
         }
-        (*mapIt).second.push_back(tempFace);
+        (*mapIt).second.push_back(faces[index]);
     }
 }
 
@@ -255,25 +266,58 @@ void FaceAdjacencySplitter::recursiveFind(const TopoDS_Face& face, FaceVectorTyp
 
 void FaceEqualitySplitter::split(const FaceVectorType& faces, FaceTypedBase* object)
 {
+    // Faces with a key are only compared with the groups whose first face has a close key,
+    // instead of with every group.
+    std::vector<double> keys(faces.size());
+    std::vector<double> tolerances(faces.size());
+    std::vector<char> hasKeys(faces.size());
+    Base::parallelFor(faces.size(), [&](std::size_t index) {
+        hasKeys[index] = object->getEqualityKey(faces[index], keys[index], tolerances[index]);
+    });
+
     std::vector<FaceVectorType> tempVector;
-    tempVector.reserve(faces.size());
-    FaceVectorType::const_iterator faceIt;
-    for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt) {
-        bool foundMatch(false);
-        std::vector<FaceVectorType>::iterator tempIt;
-        for (tempIt = tempVector.begin(); tempIt != tempVector.end(); ++tempIt) {
-            if (object->isEqual((*tempIt).front(), *faceIt)) {
-                (*tempIt).push_back(*faceIt);
-                foundMatch = true;
-                break;
+    std::multimap<double, std::size_t> keyedGroups;
+    std::vector<std::size_t> unkeyedGroups;
+    double maxTolerance = 0.0;
+    for (std::size_t index = 0; index < faces.size(); ++index) {
+        const TopoDS_Face& face = faces[index];
+        // as before, a face joins the first created group that matches
+        std::size_t match = tempVector.size();
+        auto checkGroup = [&](std::size_t group) {
+            if (group < match && object->isEqual(tempVector[group].front(), face)) {
+                match = group;
+            }
+        };
+        if (hasKeys[index]) {
+            double window = maxTolerance + tolerances[index];
+            auto it = keyedGroups.lower_bound(keys[index] - window);
+            auto end = keyedGroups.upper_bound(keys[index] + window);
+            for (; it != end; ++it) {
+                checkGroup(it->second);
+            }
+            for (auto group : unkeyedGroups) {
+                checkGroup(group);
+            }
+        }
+        else {
+            for (std::size_t group = 0; group < tempVector.size() && match == tempVector.size();
+                 ++group) {
+                checkGroup(group);
             }
         }
-        if (!foundMatch) {
-            FaceVectorType another;
-            another.reserve(faces.size());
-            another.push_back(*faceIt);
-            tempVector.push_back(another);
+
+        if (match < tempVector.size()) {
+            tempVector[match].push_back(face);
+            continue;
         }
+        if (hasKeys[index]) {
+            keyedGroups.emplace(keys[index], tempVector.size());
+            maxTolerance = std::max(maxTolerance, tolerances[index]);
+        }
+        else {
+            unkeyedGroups.push_back(tempVector.size());
+        }
+        tempVector.emplace_back(1, face);
     }
     std::vector<FaceVectorType>::iterator it;
     for (it = tempVector.begin(); it != tempVector.end(); ++it) {
@@ -382,6 +426,21 @@ bool FaceTypedPlane::isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& face
     );
 }
 
+bool FaceTypedPlane::getEqualityKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_Plane) planeSurface = getGeomPlane(face);
+    if (planeSurface.IsNull()) {
+        return false;
+    }
+
+    // The distance of the plane from the origin. Planes that isEqual() accepts may be tilted
+    // by the angular tolerance, so allow for that at the distance of their location.
+    gp_Pln plane(planeSurface->Pln());
+    key = plane.Distance(gp::Origin());
+    tolerance = 2.0 * Precision::Confusion() * (1.0 + plane.Location().Distance(gp::Origin()));
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedPlane::getType() const
 {
     return GeomAbs_Plane;
@@ -491,6 +550,18 @@ bool FaceTypedCylinder::isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& f
     return true;
 }
 
+bool FaceTypedCylinder::getEqualityKey(const TopoDS_Face& face, double& key, double& tolerance) const
+{
+    Handle(Geom_CylindricalSurface) cylinderSurface = getGeomCylinder(face);
+    if (cylinderSurface.IsNull()) {
+        return false;
+    }
+
+    key = cylinderSurface->Radius();
+    tolerance = Precision::Confusion();
+    return true;
+}
+
 GeomAbs_SurfaceType FaceTypedCylinder::getType() const
 {
     return GeomAbs_Cylinder;
@@ -67,6 +67,15 @@ protected:
 
 public:
     virtual bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const = 0;
+    /// Gives a key of the face geometry, such that the keys of equal faces differ by at most the
+    /// sum of their tolerances. Returns false if there is no such key for the face.
+    virtual bool getEqualityKey(const TopoDS_Face& face, double& key, double& tolerance) const
+    {
+        (void)face;
+        (void)key;
+        (void)tolerance;
+        return false;
+    }
     virtual GeomAbs_SurfaceType getType() const = 0;
     virtual TopoDS_Face buildFace(const FaceVectorType& faces) const = 0;
 
@@ -87,6 +96,7 @@ private:
 
 public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
+    bool getEqualityKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
     friend FaceTypedPlane& getPlaneObject();
@@ -100,6 +110,7 @@ private:
 
 public:
     bool isEqual(const TopoDS_Face& faceOne, const TopoDS_Face& faceTwo) const override;
+    bool getEqualityKey(const TopoDS_Face& face, double& key, double& tolerance) const override;
     GeomAbs_SurfaceType getType() const override;
     TopoDS_Face buildFace(const FaceVectorType& faces) const override;
     friend FaceTypedCylinder& getCylinderObject();
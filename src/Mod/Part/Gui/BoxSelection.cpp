@@ -24,8 +24,10 @@
 
 
 #include <sstream>
+#include <vector>
 #include <BRep_Tool.hxx>
 #include <gp_Pnt.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
@@ -174,23 +176,38 @@ void BoxSelection::addShapeToSelection(
             xp.Next();
         }
 
+        // A vertex is shared by several sub-shapes, so project and test each vertex only once
+        TopTools_IndexedMapOfShape vertexMap;
+        TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+        Base::BoundBox2d polygonBox = polygon.CalcBoundBox();
+        std::vector<bool> inside(vertexMap.Extent());
+        for (Standard_Integer i = 1; i <= vertexMap.Extent(); i++) {
+            gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(i)));
+            Base::Vector3d pt2d = proj(Base::Vector3d(p.X(), p.Y(), p.Z()));
+            Base::Vector2d pt(pt2d.x, pt2d.y);
+            inside[i - 1] = polygonBox.Contains(pt) && polygon.Contains(pt);
+        }
+
+        std::vector<std::string> subnames;
         for (Standard_Integer k = 1; k <= M.Extent(); k++) {
             const TopoDS_Shape& subshape = M(k);
 
             TopExp_Explorer xp_vertex(subshape, TopAbs_VERTEX);
             while (xp_vertex.More()) {
-                gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(xp_vertex.Current()));
-                Base::Vector3d pt2d;
-                pt2d = proj(Base::Vector3d(p.X(), p.Y(), p.Z()));
-                if (polygon.Contains(Base::Vector2d(pt2d.x, pt2d.y))) {
+                if (inside[vertexMap.FindIndex(xp_vertex.Current()) - 1]) {
                     std::stringstream str;
                     str << subname << k;
-                    Gui::Selection().addSelection(doc, obj, str.str().c_str());
+                    subnames.push_back(str.str());
                     break;
                 }
                 xp_vertex.Next();
             }
         }
+
+        // add all elements with one call, which looks up the current selection only once
+        if (!subnames.empty()) {
+            Gui::Selection().addSelections(doc, obj, subnames);
+        }
     }
     catch (...) {
     }
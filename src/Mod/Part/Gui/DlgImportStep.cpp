@@ -47,6 +47,8 @@ DlgImportStep::DlgImportStep(QWidget* parent)
     ui->checkBoxUseBaseName->setChecked(settings.getUseBaseName());
     ui->checkBoxReduceObjects->setChecked(settings.getReduceObjects());
     ui->checkBoxExpandCompound->setChecked(settings.getExpandCompound());
+    ui->checkBoxDeduplicateShapes->setChecked(settings.getDeduplicateShapes());
+    ui->checkBoxTessellationOnly->setChecked(settings.getTessellationOnly());
     ui->checkBoxShowProgress->setChecked(settings.getShowProgress());
 #if OCC_VERSION_HEX >= 0x070800
     std::list<Part::OCAF::ImportExportSettings::CodePage> codepagelist;
@@ -78,6 +80,8 @@ void DlgImportStep::saveSettings()
     ui->checkBoxUseBaseName->onSave();
     ui->checkBoxReduceObjects->onSave();
     ui->checkBoxExpandCompound->onSave();
+    ui->checkBoxDeduplicateShapes->onSave();
+    ui->checkBoxTessellationOnly->onSave();
     ui->checkBoxShowProgress->onSave();
     ui->comboBoxImportMode->onSave();
 }
@@ -94,6 +98,8 @@ void DlgImportStep::loadSettings()
     ui->checkBoxUseBaseName->onRestore();
     ui->checkBoxReduceObjects->onRestore();
     ui->checkBoxExpandCompound->onRestore();
+    ui->checkBoxDeduplicateShapes->onRestore();
+    ui->checkBoxTessellationOnly->onRestore();
     ui->checkBoxShowProgress->onRestore();
     ui->comboBoxImportMode->onRestore();
 }
@@ -109,6 +115,8 @@ StepImportSettings DlgImportStep::getSettings() const
     set.reduceObjects = settings.getReduceObjects();
     set.showProgress = settings.getShowProgress();
     set.expandCompound = settings.getExpandCompound();
+    set.deduplicateShapes = settings.getDeduplicateShapes();
+    set.tessellationOnly = settings.getTessellationOnly();
     set.mode = static_cast<int>(settings.getImportMode());
 #if OCC_VERSION_HEX >= 0x070800
     Resource_FormatType cp = settings.getImportCodePage();
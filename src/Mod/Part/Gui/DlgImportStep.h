@@ -44,6 +44,8 @@ struct StepImportSettings
     bool reduceObjects = false;
     bool showProgress = false;
     bool expandCompound = false;
+    bool deduplicateShapes = false;
+    bool tessellationOnly = false;
     int mode = 0;
     int codePage = -1;
 };
@@ -62,6 +62,60 @@
 
 using namespace PartGui;
 
+namespace
+{
+// Converts the line strips of an index list with -1 separators into pairs of indices for
+// GL_LINES. This way all edges of a shape are sent with a single draw call instead of one
+// glBegin/glEnd block per edge. A strip is interrupted at an index out of range.
+void appendLineSegments(
+    const int32_t* cindices,
+    int numcindices,
+    int numcoords,
+    std::vector<GLuint>& segments
+)
+{
+    int32_t prev = -1;
+    for (int i = 0; i < numcindices; i++) {
+        int32_t idx = cindices[i];
+        if (idx < 0 || idx >= numcoords) {
+            prev = -1;
+            continue;
+        }
+        if (prev >= 0) {
+            segments.push_back(static_cast<GLuint>(prev));
+            segments.push_back(static_cast<GLuint>(idx));
+        }
+        prev = idx;
+    }
+}
+
+void drawLineSegments(
+    const SbVec3f* coords3d,
+    const SbVec3f* normals,
+    const std::vector<GLuint>& segments
+)
+{
+    if (segments.empty()) {
+        return;
+    }
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, coords3d);
+    if (normals) {
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glNormalPointer(GL_FLOAT, 0, normals);
+    }
+    glDrawElements(
+        GL_LINES,
+        static_cast<GLsizei>(segments.size()),
+        GL_UNSIGNED_INT,
+        segments.data()
+    );
+    glPopClientAttrib();
+}
+}  // namespace
+
 SO_NODE_SOURCE(SoBrepEdgeSet)
 
 struct SoBrepEdgeSet::SelContext: Gui::SoFCSelectionContextEx
@@ -224,14 +278,18 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
         struct HighlightSegment
         {
             int startIndex;
+            int numIndices;
             Base::Color color;
         };
         std::vector<HighlightSegment> highlights;
+        std::vector<GLuint> segments;
+        const int numcoords = coords->getNum();
 
         int linecount = 0;
         int i = 0;
 
         // --- PASS 1: Render Default Lines (Lit) ---
+        // All default lines are collected and drawn with a single call
         while (i < numcindices) {
             int startIndex = i;
 
@@ -249,37 +307,25 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
                 }
             }
 
+            // Skip over the indices for this line
+            while (i < numcindices && cindices[i] >= 0) {
+                i++;
+            }
+
             if (pColor) {
                 // This is a highlighted line. Save it for Pass 2.
-                highlights.push_back({startIndex, *pColor});
-
-                // Skip over the indices for this line
-                while (i < numcindices && cindices[i] >= 0) {
-                    i++;
-                }
-                i++;  // skip the -1 separator
+                highlights.push_back({startIndex, i - startIndex, *pColor});
             }
             else {
-                // This is a default line. Render immediately with current (Lit) state.
-                glBegin(GL_LINE_STRIP);
-                while (i < numcindices) {
-                    int32_t idx = cindices[i++];
-                    if (idx < 0) {
-                        break;
-                    }
-
-                    if (idx < coords->getNum()) {
-                        if (normals) {
-                            glNormal3fv((const GLfloat*)(normals + idx));
-                        }
-                        glVertex3fv((const GLfloat*)(coords3d + idx));
-                    }
-                }
-                glEnd();
+                // This is a default line, it's rendered with the current (Lit) state.
+                appendLineSegments(cindices + startIndex, i - startIndex, numcoords, segments);
             }
+            i++;  // skip the -1 separator
             linecount++;
         }
 
+        drawLineSegments(coords3d, normals, segments);
+
         // --- PASS 2: Render Highlighted Lines (Unlit) ---
         if (!highlights.empty()) {
             // Disable lighting and textures so the color is flat and bright
@@ -287,25 +333,24 @@ void SoBrepEdgeSet::GLRender(SoGLRenderAction* action)
             glDisable(GL_LIGHTING);
             glDisable(GL_TEXTURE_2D);
 
-            for (const auto& segment : highlights) {
+            // Consecutive lines of the same color are drawn together
+            for (auto it = highlights.begin(); it != highlights.end();) {
+                const Base::Color& color = it->color;
+                segments.clear();
+                for (; it != highlights.end() && it->color == color; ++it) {
+                    appendLineSegments(
+                        cindices + it->startIndex,
+                        it->numIndices,
+                        numcoords,
+                        segments
+                    );
+                }
+
                 // Apply the explicit color from the map
                 // Note: FreeCAD Base::Color transparency is 0.0 (opaque) to 1.0 (transparent)
                 // OpenGL Alpha is 1.0 (opaque) to 0.0 (transparent)
-                glColor4f(segment.color.r, segment.color.g, segment.color.b, 1.0f - segment.color.a);
-
-                glBegin(GL_LINE_STRIP);
-                int j = segment.startIndex;
-                while (j < numcindices) {
-                    int32_t idx = cindices[j++];
-                    if (idx < 0) {
-                        break;
-                    }
-
-                    if (idx < coords->getNum()) {
-                        glVertex3fv((const GLfloat*)(coords3d + idx));
-                    }
-                }
-                glEnd();
+                glColor4f(color.r, color.g, color.b, 1.0f - color.a);
+                drawLineSegments(coords3d, nullptr, segments);
             }
             glPopAttrib();
         }
@@ -472,23 +517,10 @@ void SoBrepEdgeSet::renderShape(
 )
 {
 
-    const SbVec3f* coords3d = coords->getArrayPtr3();
-
-    int32_t i;
-    int previ;
-    const int32_t* end = cindices + numindices;
-    while (cindices < end) {
-        glBegin(GL_LINE_STRIP);
-        previ = *cindices++;
-        i = (cindices < end) ? *cindices++ : -1;
-        while (i >= 0) {
-            glVertex3fv((const GLfloat*)(coords3d + previ));
-            glVertex3fv((const GLfloat*)(coords3d + i));
-            previ = i;
-            i = cindices < end ? *cindices++ : -1;
-        }
-        glEnd();
-    }
+    std::vector<GLuint> segments;
+    segments.reserve(2 * static_cast<std::size_t>(numindices));
+    appendLineSegments(cindices, numindices, coords->getNum(), segments);
+    drawLineSegments(coords->getArrayPtr3(), nullptr, segments);
 }
 
 void SoBrepEdgeSet::renderHighlight(SoGLRenderAction* action, SelContextPtr ctx)
@@ -91,15 +91,21 @@ class SoBrepFaceSet::VBO
 public:
     struct Buffer
     {
-        uint32_t myvbo[2];
+        // vertices and normals, indices and colors
+        uint32_t myvbo[3];
         std::size_t vertex_array_size;
         std::size_t index_array_size;
         bool updateVbo;
+        bool updateColors;
         bool vboLoaded;
+        // the packed color of every part as it is in the color buffer
+        std::vector<uint32_t> partColors;
     };
 
     static SbBool vboAvailable;
     uint32_t indice_array;
+    // the first triangle of every part in the buffers followed by the number of triangles
+    std::vector<int32_t> partStart;
     std::map<uint32_t, Buffer> vbomap;
 
     VBO()
@@ -114,10 +120,10 @@ public:
         // schedule delete for all allocated GL resources
         std::map<uint32_t, Buffer>::iterator it;
         for (it = vbomap.begin(); it != vbomap.end(); ++it) {
-            void* ptr0 = (void*)((uintptr_t)it->second.myvbo[0]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr0);
-            void* ptr1 = (void*)((uintptr_t)it->second.myvbo[1]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr1);
+            for (uint32_t vbo : it->second.myvbo) {
+                void* ptr = (void*)((uintptr_t)vbo);
+                SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr);
+            }
         }
     }
 
@@ -139,6 +145,11 @@ public:
         SbBool texture
     );
 
+    bool renderPart(SoGLRenderAction* action, int32_t part, int num_partindices);
+
+    static std::vector<uint32_t> getPartColors(SoState* state, int mbind, int numParts);
+    void updateColors(uint32_t contextId, Buffer& buf, const std::vector<uint32_t>& colors);
+
     static void context_destruction_cb(uint32_t context, void* userdata)
     {
         VBO* self = static_cast<VBO*>(userdata);
@@ -151,7 +162,7 @@ public:
                 = (PFNGLDELETEBUFFERSARBPROC)cc_glglue_getprocaddress(glue, "glDeleteBuffersARB");
 #endif
             auto& buffer = it->second;
-            glDeleteBuffersARB(2, buffer.myvbo);
+            glDeleteBuffersARB(3, buffer.myvbo);
             self->vbomap.erase(it);
         }
     }
@@ -189,7 +200,46 @@ SoBrepFaceSet::SoBrepFaceSet()
     pimpl = std::make_unique<VBO>();
 }
 
-SoBrepFaceSet::~SoBrepFaceSet() = default;
+SoBrepFaceSet::~SoBrepFaceSet()
+{
+    if (coarseLevel) {
+        coarseLevel->unref();
+    }
+}
+
+void SoBrepFaceSet::setCoarseLevel(SoNode* node, const SbBox3f& box, short maxSize)
+{
+    if (node) {
+        node->ref();
+    }
+    if (coarseLevel) {
+        coarseLevel->unref();
+    }
+    coarseLevel = node;
+    coarseLevelBox = box;
+    coarseLevelSize = maxSize;
+    touch();
+}
+
+bool SoBrepFaceSet::renderCoarseLevel(SoGLRenderAction* action)
+{
+    if (!coarseLevel || coarseLevelBox.isEmpty()) {
+        return false;
+    }
+
+    // The screen size depends on the view, so the coarse level must not be part of a render cache
+    SoState* state = action->getState();
+    SoCacheElement::invalidate(state);
+
+    SbVec2s size;
+    getScreenSize(state, coarseLevelBox, size);
+    if (std::max(size[0], size[1]) > coarseLevelSize) {
+        return false;
+    }
+
+    action->traverse(coarseLevel);
+    return true;
+}
 
 void SoBrepFaceSet::doAction(SoAction* action)
 {
@@ -371,9 +421,15 @@ void SoBrepFaceSet::doAction(SoAction* action)
     // but the base class made this method private so that we can't override it.
     // So, the alternative way is to write a custom SoAction class.
     else if (action->getTypeId() == Gui::SoUpdateVBOAction::getClassTypeId()) {
+        auto vboaction = static_cast<Gui::SoUpdateVBOAction*>(action);
         for (auto& v : PRIVATE(this)->vbomap) {
-            v.second.updateVbo = true;
-            v.second.vboLoaded = false;
+            if (vboaction->getContent() == Gui::SoUpdateVBOAction::Colors) {
+                v.second.updateColors = true;
+            }
+            else {
+                v.second.updateVbo = true;
+                v.second.vboLoaded = false;
+            }
         }
     }
 
@@ -638,6 +694,11 @@ void SoBrepFaceSet::GLRender(SoGLRenderAction* action)
         }
     }
 
+    // far away shapes without any (pre)selection are rendered with the coarse tessellation
+    if (!ctx && !ctx2 && !hasOverlayFields && renderCoarseLevel(action)) {
+        return;
+    }
+
     // override material binding to PER_PART_INDEX to achieve
     // preselection/selection with transparency
     bool pushed = overrideMaterialBinding(action, ctx, ctx2);
@@ -1505,24 +1566,27 @@ void SoBrepFaceSet::renderHighlight(SoGLRenderAction* action, SelContextPtr ctx)
         mbind = OVERALL;
         doTextures = false;
 
-        renderShape(
-            action,
-            false,
-            static_cast<const SoGLCoordinateElement*>(coords),
-            &(cindices[start]),
-            length,
-            &(pindices[id]),
-            1,
-            normals,
-            nindices,
-            &mb,
-            mindices,
-            &tb,
-            tindices,
-            nbind,
-            mbind,
-            doTextures
-        );
+        // draw the part from the buffers of the shape if they are loaded
+        if (!PRIVATE(this)->renderPart(action, ctx->highlightIndex, this->partIndex.getNum())) {
+            renderShape(
+                action,
+                false,
+                static_cast<const SoGLCoordinateElement*>(coords),
+                &(cindices[start]),
+                length,
+                &(pindices[id]),
+                1,
+                normals,
+                nindices,
+                &mb,
+                mindices,
+                &tb,
+                tindices,
+                nbind,
+                mbind,
+                doTextures
+            );
+        }
     }
     state->pop();
 
@@ -1608,6 +1672,10 @@ void SoBrepFaceSet::renderSelection(SoGLRenderAction* action, SelContextPtr ctx,
         if (id >= 0 && id == ctx->highlightIndex) {
             continue;
         }
+        // with an overall material the part can be drawn from the buffers of the shape
+        if (push && PRIVATE(this)->renderPart(action, id, this->partIndex.getNum())) {
+            continue;
+        }
 
         // coords
         int length = 0;
@@ -1667,6 +1735,78 @@ void SoBrepFaceSet::renderSelection(SoGLRenderAction* action, SelContextPtr ctx,
     }
 }
 
+std::vector<uint32_t> SoBrepFaceSet::VBO::getPartColors(SoState* state, int mbind, int numParts)
+{
+    // only a color per part is supported, with any other binding the first color is used
+    std::vector<uint32_t> colors(std::max(numParts, 1));
+    int numDiffuse = std::max(SoLazyElement::getInstance(state)->getNumDiffuse(), 1);
+    for (int i = 0; i < static_cast<int>(colors.size()); i++) {
+        int index = mbind == PER_PART ? std::min(i, numDiffuse - 1) : 0;
+        colors[i] = SoLazyElement::getDiffuse(state, index).getPackedValue();
+    }
+
+    return colors;
+}
+
+void SoBrepFaceSet::VBO::updateColors(
+    uint32_t contextId,
+    Buffer& buf,
+    const std::vector<uint32_t>& colors
+)
+{
+#ifdef FC_OS_WIN32
+    const cc_glglue* glue = cc_glglue_instance(contextId);
+#else
+    (void)contextId;
+    PFNGLBINDBUFFERARBPROC glBindBufferARB
+        = (PFNGLBINDBUFFERARBPROC)cc_glglue_getprocaddress(glue, "glBindBufferARB");
+    PFNGLBUFFERSUBDATAARBPROC glBufferSubDataARB
+        = (PFNGLBUFFERSUBDATAARBPROC)cc_glglue_getprocaddress(glue, "glBufferSubDataARB");
+#endif
+    // Only upload the colors of the parts that have changed. Consecutive parts are uploaded
+    // at once because every part covers a contiguous range of the buffer.
+    std::vector<uint8_t> color_array;
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[2]);
+    int numParts = static_cast<int>(colors.size());
+    int part = 0;
+    while (part < numParts) {
+        if (colors[part] == buf.partColors[part]) {
+            part++;
+            continue;
+        }
+
+        int first = part;
+        while (part < numParts && colors[part] != buf.partColors[part]) {
+            buf.partColors[part] = colors[part];
+            part++;
+        }
+
+        int firstVertex = 3 * partStart[first];
+        int numVertices = 3 * partStart[part] - firstVertex;
+        if (numVertices > 0) {
+            color_array.resize(4 * numVertices);
+            uint8_t* ptr = color_array.data();
+            for (int i = first; i < part; i++) {
+                uint32_t RGBA = colors[i];
+                for (int j = 3 * partStart[i]; j < 3 * partStart[i + 1]; j++) {
+                    *ptr++ = (RGBA & 0xFF000000) >> 24;
+                    *ptr++ = (RGBA & 0xFF0000) >> 16;
+                    *ptr++ = (RGBA & 0xFF00) >> 8;
+                    *ptr++ = (RGBA & 0xFF);
+                }
+            }
+            glBufferSubDataARB(
+                GL_ARRAY_BUFFER_ARB,
+                4 * firstVertex,
+                4 * numVertices,
+                color_array.data()
+            );
+        }
+    }
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+    buf.updateColors = false;
+}
+
 void SoBrepFaceSet::VBO::render(
     SoGLRenderAction* action,
     const SoGLCoordinateElement* const vertexlist,
@@ -1709,13 +1849,10 @@ void SoBrepFaceSet::VBO::render(
 
     float* vertex_array = nullptr;
     GLuint* index_array = nullptr;
-    SbColor mycolor1, mycolor2, mycolor3;
     SbVec3f* mynormal1 = const_cast<SbVec3f*>(currnormal);
     SbVec3f* mynormal2 = const_cast<SbVec3f*>(currnormal);
     SbVec3f* mynormal3 = const_cast<SbVec3f*>(currnormal);
     int indice = 0;
-    uint32_t RGBA, R, G, B, A;
-    float Rf, Gf, Bf, Af;
 
     uint32_t contextId = action->getCacheContext();
     auto res = this->vbomap.insert(std::make_pair(contextId, VBO::Buffer()));
@@ -1726,14 +1863,15 @@ void SoBrepFaceSet::VBO::render(
         PFNGLGENBUFFERSPROC glGenBuffersARB
             = (PFNGLGENBUFFERSPROC)cc_glglue_getprocaddress(glue, "glGenBuffersARB");
 #endif
-        glGenBuffersARB(2, buf.myvbo);
+        glGenBuffersARB(3, buf.myvbo);
         buf.vertex_array_size = 0;
         buf.index_array_size = 0;
         buf.vboLoaded = false;
     }
 
-    if ((buf.vertex_array_size != (sizeof(float) * num_indices * 10))
-        || (buf.index_array_size != (sizeof(GLuint) * num_indices))) {
+    if ((buf.vertex_array_size != (sizeof(float) * num_indices * 6))
+        || (buf.index_array_size != (sizeof(GLuint) * num_indices))
+        || (partStart.size() != static_cast<std::size_t>(std::max(num_partindices, 1) + 1))) {
         if ((buf.vertex_array_size != 0) && (buf.index_array_size != 0)) {
             buf.updateVbo = true;
         }
@@ -1743,8 +1881,10 @@ void SoBrepFaceSet::VBO::render(
     // it means that the VBO has not been initialized
     // updateVbo is tracking the need to update the content of the VBO which act as a buffer within
     // the graphic card
-    // TODO FINISHING THE COLOR SUPPORT !
+    // The colors are kept in a buffer of their own so that they can be updated part by part
+    // without uploading the geometry again
 
+    SoState* state = action->getState();
     if (!buf.vboLoaded || buf.updateVbo) {
 #ifdef FC_OS_WIN32
         const cc_glglue* glue = cc_glglue_instance(action->getCacheContext());
@@ -1762,20 +1902,20 @@ void SoBrepFaceSet::VBO::render(
 #endif
         // We must manage buffer size increase let's clear everything and re-init to test the
         // clearing process
-        glDeleteBuffersARB(2, buf.myvbo);
-        glGenBuffersARB(2, buf.myvbo);
-        vertex_array = (float*)malloc(sizeof(float) * num_indices * 10);
+        glDeleteBuffersARB(3, buf.myvbo);
+        glGenBuffersARB(3, buf.myvbo);
+        vertex_array = (float*)malloc(sizeof(float) * num_indices * 6);
         index_array = (GLuint*)malloc(sizeof(GLuint) * num_indices);
-        buf.vertex_array_size = sizeof(float) * num_indices * 10;
+        buf.vertex_array_size = sizeof(float) * num_indices * 6;
         buf.index_array_size = sizeof(GLuint) * num_indices;
-        this->vbomap[contextId] = buf;
         this->indice_array = 0;
 
-        // Get the initial colors
-        SoState* state = action->getState();
-        mycolor1 = SoLazyElement::getDiffuse(state, 0);
-        mycolor2 = SoLazyElement::getDiffuse(state, 0);
-        mycolor3 = SoLazyElement::getDiffuse(state, 0);
+        // The parts with the number of their triangles
+        int numParts = std::max(num_partindices, 1);
+        partStart.assign(numParts + 1, 0);
+        for (int i = 0; i < num_partindices; i++) {
+            partStart[i + 1] = partStart[i] + std::max(partindices[i], 0);
+        }
 
         pi = piptr < piendptr ? *piptr++ : -1;
         while (pi == 0) {
@@ -1803,9 +1943,6 @@ void SoBrepFaceSet::VBO::render(
             if (mbind == PER_PART) {
                 if (trinr == 0) {
                     materials->send(matnr++, true);
-                    mycolor1 = SoLazyElement::getDiffuse(state, matnr - 1);
-                    mycolor2 = mycolor1;
-                    mycolor3 = mycolor1;
                 }
             }
             else if (mbind == PER_PART_INDEXED) {
@@ -1870,7 +2007,7 @@ void SoBrepFaceSet::VBO::render(
 
             /* We building the Vertex dataset there and push it to a VBO */
             /* The Vertex array shall contain per element vertex_coordinates[3],
-            normal_coordinates[3], color_value[3] (RGBA format) */
+            normal_coordinates[3], the colors are in a separate buffer */
 
             index_array[this->indice_array] = this->indice_array;
             index_array[this->indice_array + 1] = this->indice_array + 1;
@@ -1880,71 +2017,21 @@ void SoBrepFaceSet::VBO::render(
 
             ((SbVec3f*)(cur_coords3d + v1))
                 ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
-
             ((SbVec3f*)(mynormal1))
                 ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            /* We decode the Vertex1 color */
-            RGBA = mycolor1.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
+            indice += 6;
 
             ((SbVec3f*)(cur_coords3d + v2))
                 ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
             ((SbVec3f*)(mynormal2))
                 ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            RGBA = mycolor2.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
+            indice += 6;
 
             ((SbVec3f*)(cur_coords3d + v3))
                 ->getValue(vertex_array[indice + 0], vertex_array[indice + 1], vertex_array[indice + 2]);
             ((SbVec3f*)(mynormal3))
                 ->getValue(vertex_array[indice + 3], vertex_array[indice + 4], vertex_array[indice + 5]);
-
-            RGBA = mycolor3.getPackedValue();
-            R = (RGBA & 0xFF000000) >> 24;
-            G = (RGBA & 0xFF0000) >> 16;
-            B = (RGBA & 0xFF00) >> 8;
-            A = (RGBA & 0xFF);
-
-            Rf = (((float)R) / 255.0);
-            Gf = (((float)G) / 255.0);
-            Bf = (((float)B) / 255.0);
-            Af = (((float)A) / 255.0);
-
-            vertex_array[indice + 6] = Rf;
-            vertex_array[indice + 7] = Gf;
-            vertex_array[indice + 8] = Bf;
-            vertex_array[indice + 9] = Af;
-            indice += 10;
+            indice += 6;
 
             /* ============================================================ */
             trinr++;
@@ -1964,6 +2051,13 @@ void SoBrepFaceSet::VBO::render(
             }
         }
 
+        // Triangles that don't belong to any part are added to the last one
+        int numTriangles = static_cast<int>(this->indice_array / 3);
+        for (auto& start : partStart) {
+            start = std::min(start, numTriangles);
+        }
+        partStart.back() = numTriangles;
+
         glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
         glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * indice, vertex_array, GL_DYNAMIC_DRAW_ARB);
 
@@ -1975,6 +2069,16 @@ void SoBrepFaceSet::VBO::render(
             GL_DYNAMIC_DRAW_ARB
         );
 
+        // Allocate the color buffer and let updateColors() fill in all parts
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[2]);
+        glBufferDataARB(GL_ARRAY_BUFFER_ARB, 4 * this->indice_array, nullptr, GL_DYNAMIC_DRAW_ARB);
+        std::vector<uint32_t> colors = getPartColors(state, mbind, num_partindices);
+        buf.partColors.resize(colors.size());
+        std::transform(colors.begin(), colors.end(), buf.partColors.begin(), [](uint32_t color) {
+            return ~color;
+        });
+        updateColors(contextId, buf, colors);
+
         glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
         glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
 
@@ -1983,6 +2087,9 @@ void SoBrepFaceSet::VBO::render(
         free(vertex_array);
         free(index_array);
     }
+    else if (buf.updateColors) {
+        updateColors(contextId, buf, getPartColors(state, mbind, num_partindices));
+    }
 
     // This is the VBO rendering code
 #ifdef FC_OS_WIN32
@@ -1991,18 +2098,16 @@ void SoBrepFaceSet::VBO::render(
         = (PFNGLBINDBUFFERARBPROC)cc_glglue_getprocaddress(glue, "glBindBufferARB");
 #endif
 
-    if (!buf.updateVbo) {
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
-    }
-
     glEnableClientState(GL_VERTEX_ARRAY);
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_COLOR_ARRAY);
 
-    glVertexPointer(3, GL_FLOAT, 10 * sizeof(GLfloat), nullptr);
-    glNormalPointer(GL_FLOAT, 10 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glColorPointer(4, GL_FLOAT, 10 * sizeof(GLfloat), (GLvoid*)(6 * sizeof(GLfloat)));
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[2]);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
+    glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
+    glVertexPointer(3, GL_FLOAT, 6 * sizeof(GLfloat), nullptr);
+    glNormalPointer(GL_FLOAT, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
 
     glDrawElements(GL_TRIANGLES, this->indice_array, GL_UNSIGNED_INT, (void*)nullptr);
 
@@ -2011,10 +2116,73 @@ void SoBrepFaceSet::VBO::render(
     glDisableClientState(GL_VERTEX_ARRAY);
     glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
     glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
-    buf.updateVbo = false;
     // The data is within the VBO we can clear it at application level
 }
 
+bool SoBrepFaceSet::VBO::renderPart(SoGLRenderAction* action, int32_t part, int num_partindices)
+{
+    // Draws a part (or all parts if it's negative or INT_MAX) from the buffers that are already
+    // loaded, this way preselection and selection don't need to send the vertices again
+    SoState* state = action->getState();
+    SbBool hasVBO = vboAvailable;
+    if (hasVBO) {
+        Gui::SoGLVBOActivatedElement::get(state, hasVBO);
+    }
+    if (!hasVBO) {
+        return false;
+    }
+
+    auto it = this->vbomap.find(action->getCacheContext());
+    if (it == this->vbomap.end() || !it->second.vboLoaded || it->second.updateVbo) {
+        return false;
+    }
+    if (partStart.size() != static_cast<std::size_t>(std::max(num_partindices, 1) + 1)) {
+        return false;
+    }
+
+    int first = 0;
+    int last = partStart.back();
+    if (part >= 0 && part != std::numeric_limits<int>::max()) {
+        if (part >= num_partindices) {
+            return false;
+        }
+        first = partStart[part];
+        last = partStart[part + 1];
+    }
+
+#ifdef FC_OS_WIN32
+    const cc_glglue* glue = cc_glglue_instance(action->getCacheContext());
+    PFNGLBINDBUFFERARBPROC glBindBufferARB
+        = (PFNGLBINDBUFFERARBPROC)cc_glglue_getprocaddress(glue, "glBindBufferARB");
+#endif
+
+    // The material is already set, so the color buffer isn't used
+    const Buffer& buf = it->second;
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
+    glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, 6 * sizeof(GLfloat), nullptr);
+    glNormalPointer(GL_FLOAT, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
+
+    if (last > first) {
+        glDrawElements(
+            GL_TRIANGLES,
+            3 * (last - first),
+            GL_UNSIGNED_INT,
+            (GLvoid*)(sizeof(GLuint) * 3 * first)
+        );
+    }
+
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+    glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+    return true;
+}
+
 void SoBrepFaceSet::renderShape(
     SoGLRenderAction* action,
     SbBool hasVBO,
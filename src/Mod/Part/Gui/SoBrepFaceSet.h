@@ -28,6 +28,7 @@
 #include <Inventor/fields/SoSFInt32.h>
 #include <Inventor/fields/SoSFColor.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <Inventor/SbBox3f.h>
 #include <memory>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
@@ -80,6 +81,11 @@ class ViewProviderPartExt;
  * getPartIndex() to get the correct part.
  *
  * As an example how to use the class correctly see ViewProviderPartExt::updateVisual().
+ *
+ * Level of detail:
+ * A coarser tessellation of the same faces can be set with setCoarseLevel(). It is rendered instead
+ * of the faces while the shape covers less than a given number of pixels on the screen and nothing
+ * of it is preselected or selected. Picking always uses the fine tessellation.
  */
 class PartGuiExport SoBrepFaceSet: public SoIndexedFaceSet
 {
@@ -95,6 +101,12 @@ public:
     {
         viewProvider = vp;
     }
+    /**
+     * Sets the node with the coarse tessellation, \a box is the bounding box of the shape and
+     * \a maxSize the size in pixels up to which the coarse tessellation is rendered. Pass a null
+     * node to remove it.
+     */
+    void setCoarseLevel(SoNode* node, const SbBox3f& box, short maxSize);
 
     SoMFInt32 partIndex;
     // Optional overlay rendering for deterministic tests (and programmatic usage).
@@ -159,6 +171,7 @@ private:
     void renderSelection(SoGLRenderAction* action, SelContextPtr, bool push = true);
 
     bool overrideMaterialBinding(SoGLRenderAction* action, SelContextPtr ctx, SelContextPtr ctx2);
+    bool renderCoarseLevel(SoGLRenderAction* action);
 
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
@@ -183,6 +196,11 @@ private:
 
     // backreference to viewprovider that owns this node
     ViewProviderPartExt* viewProvider = nullptr;
+
+    // the coarse tessellation for shapes far away
+    SoNode* coarseLevel = nullptr;
+    SbBox3f coarseLevelBox;
+    short coarseLevelSize = 0;
 };
 
 }  // namespace PartGui
@@ -26,6 +26,7 @@
 #include <BRep_Tool.hxx>
 #include <BRepTools.hxx>
 #include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
@@ -49,8 +50,17 @@
 #include <TopTools_IndexedMapOfShape.hxx>
 
 #include <QAction>
+#include <QElapsedTimer>
+#include <QFuture>
 #include <QMenu>
+#include <QTimer>
+#include <QtConcurrentRun>
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include <Inventor/SoPickedPoint.h>
 #include <Inventor/details/SoFaceDetail.h>
@@ -72,6 +82,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 #include <Base/TimeInfo.h>
 #include <Base/Tools.h>
@@ -101,6 +112,101 @@ using namespace PartGui;
 PROPERTY_SOURCE(PartGui::ViewProviderPartExt, Gui::ViewProviderGeometryObject)
 
 
+namespace PartGui
+{
+/// The tessellation of a shape laid out like the fields of the Coin nodes. Computing it doesn't
+/// touch any node, so this can be done in a worker thread.
+struct ShapeGeometry
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    std::vector<int32_t> faceIndex;
+    std::vector<int32_t> partIndex;
+    std::vector<int32_t> lineIndex;
+    int pointStart {0};
+    /// set if the tessellation failed, it is reported when the geometry is applied
+    std::exception_ptr error;
+};
+
+/**
+ * Passes the tessellations computed in worker threads to their view providers. This happens on
+ * the main thread in time slices, so that the GUI stays responsive while the shapes of a big
+ * recompute come in.
+ */
+class VisualUpdateQueue: public QObject
+{
+public:
+    static VisualUpdateQueue& instance()
+    {
+        static VisualUpdateQueue queue;
+        return queue;
+    }
+
+    /// Adds the update of a view provider, it replaces an update that is still pending
+    void add(
+        ViewProviderPartExt* vp,
+        const TopoDS_Shape& shape,
+        const QFuture<std::shared_ptr<ShapeGeometry>>& future
+    )
+    {
+        pending[vp] = {shape, future};
+        if (!timer.isActive()) {
+            timer.start();
+        }
+    }
+
+    void remove(ViewProviderPartExt* vp)
+    {
+        pending.erase(vp);
+    }
+
+private:
+    // how often finished tessellations are looked for and how long they may be applied, in ms
+    static constexpr int PollInterval = 20;
+    static constexpr int TimeSlice = 15;
+
+    struct Update
+    {
+        TopoDS_Shape shape;
+        QFuture<std::shared_ptr<ShapeGeometry>> future;
+    };
+
+    VisualUpdateQueue()
+    {
+        timer.setInterval(PollInterval);
+        connect(&timer, &QTimer::timeout, this, &VisualUpdateQueue::process);
+    }
+
+    void process()
+    {
+        QElapsedTimer elapsed;
+        elapsed.start();
+        while (!elapsed.hasExpired(TimeSlice)) {
+            // look up the entry each time because applying an update may change the queue
+            auto it = std::find_if(pending.begin(), pending.end(), [](const auto& entry) {
+                return entry.second.future.isFinished();
+            });
+            if (it == pending.end()) {
+                break;
+            }
+
+            ViewProviderPartExt* vp = it->first;
+            Update update = it->second;
+            pending.erase(it);
+            vp->applyVisual(update.shape, *update.future.result());
+        }
+
+        if (pending.empty()) {
+            timer.stop();
+        }
+    }
+
+    std::map<ViewProviderPartExt*, Update> pending;
+    QTimer timer;
+};
+}  // namespace PartGui
+
+
 //**************************************************************************
 // Construction/Destruction
 
@@ -209,6 +315,14 @@ ViewProviderPartExt::ViewProviderPartExt()
         "the smoother the appearance in the 3D view, and the finer the mesh that will be exported."
     );
     AngularDeflection.setConstraints(&angDeflectionRange);
+    ADD_PROPERTY_TYPE(
+        MeshedAngularDeflection,
+        (-1.0),
+        osgroup,
+        App::PropertyType(App::Prop_Hidden | App::Prop_Output),
+        "Angular deflection of the triangulation that is saved with the shape"
+    );
+    MeshedAngularDeflection.setStatus(App::Property::NoModify, true);
     ADD_PROPERTY_TYPE(Lighting, (twoside), osgroup, App::Prop_None, "Set object lighting.");
     Lighting.setEnums(LightingEnums);
     ADD_PROPERTY_TYPE(
@@ -288,6 +402,7 @@ ViewProviderPartExt::ViewProviderPartExt()
 
 ViewProviderPartExt::~ViewProviderPartExt()
 {
+    VisualUpdateQueue::instance().remove(this);
     pcFaceBind->unref();
     pcLineBind->unref();
     pcPointBind->unref();
@@ -690,7 +805,7 @@ void ViewProviderPartExt::setHighlightedFaces(const std::vector<App::Material>&
         getObject()->touch(true);
     }
 
-    Gui::SoUpdateVBOAction action;
+    Gui::SoUpdateVBOAction action(Gui::SoUpdateVBOAction::Colors);
     action.apply(this->faceset);
 
     int size = static_cast<int>(materials.size());
@@ -990,6 +1105,8 @@ void ViewProviderPartExt::startRestoring()
 
 void ViewProviderPartExt::finishRestoring()
 {
+    RestoredTriangulation = true;
+
     // The ShapeAppearance property is restored after DiffuseColor
     // and currently sets a single color.
     // In case DiffuseColor has defined multiple colors they will
@@ -1044,26 +1161,41 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
-void ViewProviderPartExt::setupCoinGeometry(
+namespace
+{
+bool hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    bool hasFaces = false;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(xp.Current()), loc);
+        if (mesh.IsNull() || mesh->Deflection() > deflection) {
+            return false;
+        }
+        hasFaces = true;
+    }
+    return hasFaces;
+}
+
+bool isAsyncUpdate()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    return hGrp->GetBool("AsyncVisualUpdate", false);
+}
+
+ShapeGeometry tessellateShape(
     TopoDS_Shape shape,
-    SoCoordinate3* coords,
-    SoBrepFaceSet* faceset,
-    SoNormal* norm,
-    SoBrepEdgeSet* lineset,
-    SoBrepPointSet* nodeset,
     double deviation,
     double angularDeflection,
-    bool normalsFromUV
+    bool normalsFromUV,
+    bool reuseTriangulation
 )
 {
+    ShapeGeometry geometry;
     if (Part::Tools::isShapeEmpty(shape)) {
-        coords->point.setNum(0);
-        norm->vector.setNum(0);
-        faceset->coordIndex.setNum(0);
-        faceset->partIndex.setNum(0);
-        lineset->coordIndex.setNum(0);
-        nodeset->startIndex.setValue(0);
-        return;
+        return geometry;
     }
 
     // time measurement and book keeping
@@ -1099,14 +1231,18 @@ void ViewProviderPartExt::setupCoinGeometry(
     meshParams.InParallel = Standard_True;
     meshParams.AllowQualityDecrease = Standard_True;
 
-    // Clear triangulation and PCurves from geometry which can slow down the process
+    // A triangulation restored with the shape can be used directly if it
+    // covers all faces and is fine enough
+    if (!reuseTriangulation || !hasTriangulation(shape, deflection)) {
+        // Clear triangulation and PCurves from geometry which can slow down the process
 #if OCC_VERSION_HEX < 0x070600
-    BRepTools::Clean(shape);
+        BRepTools::Clean(shape);
 #else
-    BRepTools::Clean(shape, Standard_True);
+        BRepTools::Clean(shape, Standard_True);
 #endif
 
-    BRepMesh_IncrementalMesh(shape, meshParams);
+        BRepMesh_IncrementalMesh(shape, meshParams);
+    }
 
     // We must reset the location here because the transformation data
     // are set in the placement property
@@ -1116,15 +1252,31 @@ void ViewProviderPartExt::setupCoinGeometry(
     // count triangles and nodes in the mesh
     TopTools_IndexedMapOfShape faceMap;
     TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+
+    // the triangulation of each face and where it goes in the node and index arrays
+    struct FaceMesh
+    {
+        Handle(Poly_Triangulation) mesh;
+        TopLoc_Location loc;
+        int nodeOffset {0};
+        int triaOffset {0};
+    };
+    std::vector<FaceMesh> faceMeshes(faceMap.Extent());
+
     for (int i = 1; i <= faceMap.Extent(); i++) {
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
+        FaceMesh& faceMesh = faceMeshes[i - 1];
+        Handle(Poly_Triangulation) mesh =
+            BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), faceMesh.loc);
 
         if (mesh.IsNull()) {
             mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
         }
 
         // Note: we must also count empty faces
+        faceMesh.nodeOffset = numNodes;
+        faceMesh.triaOffset = numTriangles;
         if (!mesh.IsNull()) {
+            faceMesh.mesh = mesh;
             numTriangles += mesh->NbTriangles();
             numNodes += mesh->NbNodes();
             numNorms += mesh->NbNodes();
@@ -1136,6 +1288,7 @@ void ViewProviderPartExt::setupCoinGeometry(
         }
         numFaces++;
     }
+    const int numFaceNodes = numNodes;
 
     // get an indexed map of edges
     TopTools_IndexedMapOfShape edgeMap;
@@ -1177,47 +1330,40 @@ void ViewProviderPartExt::setupCoinGeometry(
     TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
     numNodes += vertexMap.Extent();
 
-    // create memory for the nodes and indexes
-    coords->point.setNum(numNodes);
-    norm->vector.setNum(numNorms);
-    faceset->coordIndex.setNum(numTriangles * 4);
-    faceset->partIndex.setNum(numFaces);
+    // create memory for the nodes and indexes, the normals are preset with the null vector
+    geometry.points.resize(numNodes);
+    geometry.normals.resize(numNorms, SbVec3f(0.0, 0.0, 0.0));
+    geometry.faceIndex.resize(numTriangles * 4);
+    geometry.partIndex.resize(numFaces);
 
     // get the raw memory for fast fill up
-    SbVec3f* verts = coords->point.startEditing();
-    SbVec3f* norms = norm->vector.startEditing();
-    int32_t* index = faceset->coordIndex.startEditing();
-    int32_t* parts = faceset->partIndex.startEditing();
-
-    // preset the normal vector with null vector
-    for (int i = 0; i < numNorms; i++) {
-        norms[i] = SbVec3f(0.0, 0.0, 0.0);
-    }
-
-    int ii = 0, faceNodeOffset = 0, faceTriaOffset = 0;
-    for (int i = 1; i <= faceMap.Extent(); i++, ii++) {
-        TopLoc_Location aLoc;
-        const TopoDS_Face& actFace = TopoDS::Face(faceMap(i));
-        // get the mesh of the shape
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace, aLoc);
-        if (mesh.IsNull()) {
-            mesh = Part::Tools::triangulationOfFace(actFace);
-        }
+    SbVec3f* verts = geometry.points.data();
+    SbVec3f* norms = geometry.normals.data();
+    int32_t* index = geometry.faceIndex.data();
+    int32_t* parts = geometry.partIndex.data();
+
+    // Fill in the triangles of the faces in parallel. Each face only writes to
+    // its own range of the arrays.
+    Base::parallelFor(faceMeshes.size(), [&](std::size_t ii) {
+        const FaceMesh& faceMesh = faceMeshes[ii];
+        const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
         if (mesh.IsNull()) {
             parts[ii] = 0;
-            continue;
+            return;
         }
+        const TopoDS_Face& actFace = TopoDS::Face(faceMap(static_cast<int>(ii) + 1));
+        const int faceNodeOffset = faceMesh.nodeOffset;
+        const int faceTriaOffset = faceMesh.triaOffset;
 
         // getting the transformation of the shape/face
         gp_Trsf myTransf;
         Standard_Boolean identity = true;
-        if (!aLoc.IsIdentity()) {
+        if (!faceMesh.loc.IsIdentity()) {
             identity = false;
-            myTransf = aLoc.Transformation();
+            myTransf = faceMesh.loc.Transformation();
         }
 
-        // getting size of node and triangle array of this face
-        int nbNodesInFace = mesh->NbNodes();
+        // getting size of triangle array of this face
         int nbTriInFace = mesh->NbTriangles();
         // check orientation
         TopAbs_Orientation orient = actFace.Orientation();
@@ -1306,6 +1452,25 @@ void ViewProviderPartExt::setupCoinGeometry(
         }
 
         parts[ii] = nbTriInFace;  // new part
+    });
+
+    // Collect the edges lying on the faces. This keeps the order of the faces.
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        const FaceMesh& faceMesh = faceMeshes[i - 1];
+        const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
+        if (mesh.IsNull()) {
+            continue;
+        }
+        const TopoDS_Face& actFace = TopoDS::Face(faceMap(i));
+        const int faceNodeOffset = faceMesh.nodeOffset;
+        TopLoc_Location aLoc = faceMesh.loc;
+
+        gp_Trsf myTransf;
+        Standard_Boolean identity = true;
+        if (!aLoc.IsIdentity()) {
+            identity = false;
+            myTransf = aLoc.Transformation();
+        }
 
         // handling the edges lying on this face
         TopExp_Explorer Exp;
@@ -1337,7 +1502,7 @@ void ViewProviderPartExt::setupCoinGeometry(
                     // but not by any triangle. Thus, we must apply the coordinates to
                     // make sure that everything is properly set.
 #if OCC_VERSION_HEX < 0x070600
-                    gp_Pnt p(Nodes(nodeIndex));
+                    gp_Pnt p(mesh->Nodes()(nodeIndex));
 #else
                     gp_Pnt p(mesh->Node(nodeIndex));
 #endif
@@ -1353,13 +1518,10 @@ void ViewProviderPartExt::setupCoinGeometry(
         }
 
         edgeVector.push_back(-1);
-
-        // counting up the per Face offsets
-        faceNodeOffset += nbNodesInFace;
-        faceTriaOffset += nbTriInFace;
     }
 
     // handling of the free edges
+    int faceNodeOffset = numFaceNodes;
     for (int i = 1; i <= edgeMap.Extent(); i++) {
         const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
         Standard_Boolean identity = true;
@@ -1395,7 +1557,7 @@ void ViewProviderPartExt::setupCoinGeometry(
         }
     }
 
-    nodeset->startIndex.setValue(faceNodeOffset);
+    geometry.pointStart = faceNodeOffset;
     for (int i = 0; i < vertexMap.Extent(); i++) {
         const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i + 1));
         gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
@@ -1408,28 +1570,12 @@ void ViewProviderPartExt::setupCoinGeometry(
         norms[i].normalize();
     }
 
-    std::vector<int32_t> lineSetCoords;
+    std::vector<int32_t>& lineSetCoords = geometry.lineIndex;
     for (const auto& it : lineSetMap) {
         lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
         lineSetCoords.push_back(-1);
     }
-
-    // preset the index vector size
     numLines = lineSetCoords.size();
-    lineset->coordIndex.setNum(numLines);
-    int32_t* lines = lineset->coordIndex.startEditing();
-
-    int l = 0;
-    for (auto it = lineSetCoords.begin(); it != lineSetCoords.end(); ++it, l++) {
-        lines[l] = *it;
-    }
-
-    // end the editing of the nodes
-    coords->point.finishEditing();
-    norm->vector.finishEditing();
-    faceset->coordIndex.finishEditing();
-    faceset->partIndex.finishEditing();
-    lineset->coordIndex.finishEditing();
 
 #ifdef FC_DEBUG
     Base::Console().log(
@@ -1445,6 +1591,79 @@ void ViewProviderPartExt::setupCoinGeometry(
         numLines
     );
 #endif
+
+    return geometry;
+}
+
+// Tessellates the shape and keeps a failure in the result, so this can run in a worker thread
+std::shared_ptr<ShapeGeometry> makeShapeGeometry(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV,
+    bool reuseTriangulation
+)
+{
+    try {
+        return std::make_shared<ShapeGeometry>(
+            tessellateShape(shape, deviation, angularDeflection, normalsFromUV, reuseTriangulation)
+        );
+    }
+    catch (...) {
+        auto geometry = std::make_shared<ShapeGeometry>();
+        geometry->error = std::current_exception();
+        return geometry;
+    }
+}
+
+template<typename Field, typename Value>
+void setFieldValues(Field& field, const std::vector<Value>& values)
+{
+    field.setNum(static_cast<int>(values.size()));
+    Value* data = field.startEditing();
+    std::copy(values.begin(), values.end(), data);
+    field.finishEditing();
+}
+
+void applyGeometry(
+    const ShapeGeometry& geometry,
+    SoCoordinate3* coords,
+    SoBrepFaceSet* faceset,
+    SoNormal* norm,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset
+)
+{
+    setFieldValues(coords->point, geometry.points);
+    setFieldValues(norm->vector, geometry.normals);
+    setFieldValues(faceset->coordIndex, geometry.faceIndex);
+    setFieldValues(faceset->partIndex, geometry.partIndex);
+    setFieldValues(lineset->coordIndex, geometry.lineIndex);
+    nodeset->startIndex.setValue(geometry.pointStart);
+}
+}  // namespace
+
+void ViewProviderPartExt::setupCoinGeometry(
+    TopoDS_Shape shape,
+    SoCoordinate3* coords,
+    SoBrepFaceSet* faceset,
+    SoNormal* norm,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV,
+    bool reuseTriangulation
+)
+{
+    applyGeometry(
+        tessellateShape(shape, deviation, angularDeflection, normalsFromUV, reuseTriangulation),
+        coords,
+        faceset,
+        norm,
+        lineset,
+        nodeset
+    );
 }
 
 void ViewProviderPartExt::setupCoinGeometry(
@@ -1476,6 +1695,39 @@ void ViewProviderPartExt::updateVisual()
         return;
     }
 
+    double deviation = Deviation.getValue();
+    double angularDeflection = AngularDeflection.getValue();
+    bool normalsFromUV = NormalsFromUV;
+    bool reuseTriangulation = RestoredTriangulation
+        && MeshedAngularDeflection.getValue() == AngularDeflection.getValue();
+
+    // A forced update is expected to be done when this returns
+    if (!isUpdateForced() && isAsyncUpdate()) {
+        // The worker thread meshes a copy of the topology so that it doesn't modify the shape of
+        // the document while the main thread may access it. The mesh is copied to be reused.
+        BRepBuilderAPI_Copy copy(shape, Standard_False, Standard_True);
+        TopoDS_Shape meshShape = copy.Shape();
+        QFuture<std::shared_ptr<ShapeGeometry>> future = QtConcurrent::run([=]() {
+            return makeShapeGeometry(
+                meshShape,
+                deviation,
+                angularDeflection,
+                normalsFromUV,
+                reuseTriangulation
+            );
+        });
+        VisualUpdateQueue::instance().add(this, shape, future);
+        return;
+    }
+
+    VisualUpdateQueue::instance().remove(this);
+    std::shared_ptr<ShapeGeometry> geometry
+        = makeShapeGeometry(shape, deviation, angularDeflection, normalsFromUV, reuseTriangulation);
+    applyVisual(shape, *geometry);
+}
+
+void ViewProviderPartExt::applyVisual(const TopoDS_Shape& shape, const ShapeGeometry& geometry)
+{
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
@@ -1492,21 +1744,18 @@ void ViewProviderPartExt::updateVisual()
     haction.apply(this->nodeset);
 
     try {
-        setupCoinGeometry(
-            shape,
-            coords,
-            faceset,
-            norm,
-            lineset,
-            nodeset,
-            Deviation.getValue(),
-            AngularDeflection.getValue(),
-            NormalsFromUV
-        );
+        if (geometry.error) {
+            std::rethrow_exception(geometry.error);
+        }
+        applyGeometry(geometry, coords, faceset, norm, lineset, nodeset);
 
         lastRenderedShape = shape;
+        RestoredTriangulation = false;
+        MeshedAngularDeflection.setValue(AngularDeflection.getValue());
 
         VisualTouched = false;
+
+        updateCoarseLevel(shape);
     }
     catch (const Standard_Failure& e) {
         FC_ERR(
@@ -1524,6 +1773,55 @@ void ViewProviderPartExt::updateVisual()
     setHighlightedPoints(PointColorArray.getValue());
 }
 
+void ViewProviderPartExt::updateCoarseLevel(const TopoDS_Shape& shape)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    // the size in pixels up to which the coarse level is rendered, zero disables it
+    long maxSize = hGrp->GetInt("LevelOfDetailSize", 0);
+    // a second tessellation only pays off for shapes with many triangles
+    long minTriangles = hGrp->GetInt("LevelOfDetailMinTriangles", 20000);
+    if (maxSize <= 0 || faceset->coordIndex.getNum() / 4 < minTriangles) {
+        faceset->setCoarseLevel(nullptr, SbBox3f(), 0);
+        return;
+    }
+
+    // Mesh a copy of the topology so that the fine triangulation of the shape is kept
+    BRepBuilderAPI_Copy copy(shape, Standard_False);
+    double factor = hGrp->GetFloat("LevelOfDetailFactor", 10.0);
+    Gui::CoinPtr<SoSeparator> coarse(new SoSeparator);
+    auto coarseCoords = new SoCoordinate3;
+    auto coarseNorm = new SoNormal;
+    auto coarseFaces = new SoBrepFaceSet;
+    coarse->addChild(coarseCoords);
+    coarse->addChild(coarseNorm);
+    coarse->addChild(coarseFaces);
+
+    // only the faces are rendered with the coarse level
+    Gui::CoinPtr<SoBrepEdgeSet> coarseEdges(new SoBrepEdgeSet);
+    Gui::CoinPtr<SoBrepPointSet> coarseNodes(new SoBrepPointSet);
+    setupCoinGeometry(
+        copy.Shape(),
+        coarseCoords,
+        coarseFaces,
+        coarseNorm,
+        coarseEdges,
+        coarseNodes,
+        Deviation.getValue() * factor,
+        std::min(AngularDeflection.getValue() * 2.0, 90.0),
+        NormalsFromUV
+    );
+
+    SbBox3f box;
+    const SbVec3f* points = coords->point.getValues(0);
+    for (int i = 0; i < coords->point.getNum(); i++) {
+        box.extendBy(points[i]);
+    }
+    maxSize = std::min<long>(maxSize, std::numeric_limits<short>::max());
+    faceset->setCoarseLevel(coarse, box, static_cast<short>(maxSize));
+}
+
 void ViewProviderPartExt::forceUpdate(bool enable)
 {
     if (enable) {
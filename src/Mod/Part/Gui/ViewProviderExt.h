@@ -64,6 +64,8 @@ namespace PartGui
 class SoBrepFaceSet;
 class SoBrepEdgeSet;
 class SoBrepPointSet;
+struct ShapeGeometry;
+class VisualUpdateQueue;
 
 class PartGuiExport ViewProviderPartExt: public Gui::ViewProviderGeometryObject
 {
@@ -79,6 +81,8 @@ public:
     App::PropertyFloatConstraint Deviation;
     App::PropertyBool ControlPoints;
     App::PropertyAngle AngularDeflection;
+    /// Angular deflection of the triangulation that is saved with the shape
+    App::PropertyFloat MeshedAngularDeflection;
     App::PropertyEnumeration Lighting;
     App::PropertyEnumeration DrawStyle;
     /// Property controlling visibility of the placement indicator, useful for displaying origin
@@ -192,7 +196,8 @@ public:
         SoBrepPointSet* nodeset,
         double deviation,
         double angularDeflection,
-        bool normalsFromUV = false
+        bool normalsFromUV = false,
+        bool reuseTriangulation = false
     );
 
     static void setupCoinGeometry(
@@ -213,6 +218,9 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// Passes a tessellation of the shape to the nodes
+    void applyVisual(const TopoDS_Shape& shape, const ShapeGeometry& geometry);
+    void updateCoarseLevel(const TopoDS_Shape& shape);
     void handleChangedPropertyName(
         Base::XMLReader& reader,
         const char* TypeName,
@@ -238,9 +246,13 @@ protected:
 
     bool VisualTouched;
     bool NormalsFromUV;
+    /// Set while restoring so that the first update can use the restored triangulation
+    bool RestoredTriangulation = false;
     bool faceHighlightActive = false;
 
 private:
+    friend class VisualUpdateQueue;
+
     Gui::ViewProviderFaceTexture texture;
     // settings stuff
     int forceUpdateCount;
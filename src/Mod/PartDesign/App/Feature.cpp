@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
 #include <BRep_Tool.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepCheck_Solid.hxx>
@@ -49,6 +51,9 @@
 #include "ShapeBinder.h"
 
 #include <BRep_Builder.hxx>
+#include <Base/Writer.h>
+
+#include <boost/functional/hash.hpp>
 
 FC_LOG_LEVEL_INIT("PartDesign", true, true)
 
@@ -66,6 +71,35 @@ bool getPDRefineModelParameter()
     return hGrp->GetBool("RefineModel", true);
 }
 
+namespace
+{
+/// Number of previous results kept per feature, 0 disables the cache
+std::size_t getResultCacheSize()
+{
+    Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                             .GetUserParameter()
+                                             .GetGroup("BaseApp")
+                                             ->GetGroup("Preferences")
+                                             ->GetGroup("Mod/PartDesign");
+    return static_cast<std::size_t>(std::max(0L, hGrp->GetInt("ResultCacheSize", 4)));
+}
+
+/// The shape properties set by execute(), in a fixed order
+std::vector<Part::PropertyPartShape*> getResultShapeProperties(const Feature* feature)
+{
+    std::vector<App::Property*> props;
+    feature->getPropertyList(props);
+    std::vector<Part::PropertyPartShape*> shapeProps;
+    for (auto prop : props) {
+        auto shapeProp = freecad_cast<Part::PropertyPartShape*>(prop);
+        if (shapeProp && shapeProp != &feature->SuppressedShape) {
+            shapeProps.push_back(shapeProp);
+        }
+    }
+    return shapeProps;
+}
+}  // namespace
+
 // ------------------------------------------------------------------------------------------------
 
 PROPERTY_SOURCE(PartDesign::Feature, Part::Feature)
@@ -96,7 +130,15 @@ App::DocumentObjectExecReturn* Feature::recompute()
     SuppressedShape.setValue(TopoShape());
 
     if (!Suppressed.getValue()) {
-        return Part::Feature::recompute();
+        std::size_t key = getResultCacheKey();
+        if (key && restoreCachedResult(key)) {
+            return App::DocumentObject::StdReturn;
+        }
+        auto ret = Part::Feature::recompute();
+        if (key && !ret) {
+            cacheResult(key);
+        }
+        return ret;
     }
 
     bool failed = false;
@@ -124,6 +166,108 @@ App::DocumentObjectExecReturn* Feature::recompute()
     return App::DocumentObject::StdReturn;
 }
 
+bool Feature::isResultCacheable() const
+{
+    // a Python feature may depend on anything its proxy looks at
+    return !getPropertyByName("Proxy");
+}
+
+std::size_t Feature::getResultCacheKey() const
+{
+    if (getResultCacheSize() == 0 || !isResultCacheable()) {
+        return 0;
+    }
+
+    std::size_t key = 0;
+    try {
+        std::vector<App::Property*> props;
+        getPropertyList(props);
+        for (auto prop : props) {
+            if (prop->isDerivedFrom<Part::PropertyPartShape>()
+                || (getPropertyType(prop) & (App::Prop_Output | App::Prop_Transient))
+                || prop->testStatus(App::Property::Output)
+                || prop->testStatus(App::Property::Transient)) {
+                continue;
+            }
+            Base::StringWriter writer;
+            writer.setForceXML(true);
+            prop->Save(writer);
+            if (writer.hasErrors()) {
+                return 0;
+            }
+            boost::hash_combine(key, std::string(prop->getName()));
+            boost::hash_combine(key, writer.getString());
+        }
+
+        for (auto obj : getOutList()) {
+            boost::hash_combine(key, obj->getFullName());
+            if (auto feature = freecad_cast<Part::Feature*>(obj)) {
+                const TopoShape& shape = feature->Shape.getShape();
+                boost::hash_combine(key, shape.getFingerprint());
+                boost::hash_combine(key, shape.getElementMapSize(false));
+            }
+            if (auto geoFeature = freecad_cast<App::GeoFeature*>(obj)) {
+                Base::Matrix4D mat = geoFeature->Placement.getValue().toMatrix();
+                for (int i = 0; i < 4; ++i) {
+                    for (int j = 0; j < 4; ++j) {
+                        boost::hash_combine(key, mat[i][j]);
+                    }
+                }
+            }
+        }
+    }
+    catch (Base::Exception&) {
+        return 0;
+    }
+    catch (Standard_Failure&) {
+        return 0;
+    }
+    // 0 means no key
+    return key ? key : 1;
+}
+
+bool Feature::restoreCachedResult(std::size_t key)
+{
+    auto it = std::find_if(resultCache.begin(), resultCache.end(), [key](const CachedResult& result) {
+        return result.key == key;
+    });
+    if (it == resultCache.end()) {
+        return false;
+    }
+    auto shapeProps = getResultShapeProperties(this);
+    if (shapeProps.size() != it->shapes.size()) {
+        resultCache.erase(it);
+        return false;
+    }
+
+    CachedResult result = std::move(*it);
+    resultCache.erase(it);
+    Placement.setValueIfChanged(result.placement);
+    for (std::size_t i = 0; i < shapeProps.size(); ++i) {
+        shapeProps[i]->setValue(result.shapes[i]);
+    }
+    FC_LOG("Reused cached result of " << getFullName());
+    resultCache.push_front(std::move(result));
+    return true;
+}
+
+void Feature::cacheResult(std::size_t key)
+{
+    std::size_t size = getResultCacheSize();
+    if (size == 0) {
+        resultCache.clear();
+        return;
+    }
+    CachedResult result {key, Placement.getValue(), {}};
+    for (auto prop : getResultShapeProperties(this)) {
+        result.shapes.push_back(prop->getShape());
+    }
+    resultCache.push_front(std::move(result));
+    if (resultCache.size() > size) {
+        resultCache.resize(size);
+    }
+}
+
 App::DocumentObjectExecReturn* Feature::recomputePreview()
 {
     updatePreviewShape();
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include <App/PropertyStandard.h>
 #include <App/SuppressibleExtension.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -146,6 +148,13 @@ protected:
      */
     void setMaterialToBodyMaterial();
 
+    /**
+     * Whether the result of execute() only depends on the properties of this feature and on the
+     * shapes and placements of the objects it links to, so that it can be reused from the result
+     * cache when these come back unchanged.
+     */
+    virtual bool isResultCacheable() const;
+
     /// Grab any point from the given face
     static const gp_Pnt getPointFromFace(const TopoDS_Face& f);
     /// Make a shape from a base plane (convenience method)
@@ -153,6 +162,20 @@ protected:
     // TODO: Toponaming April 2024 Deprecated in favor of TopoShape method.  Remove when possible.
     static TopoDS_Shape makeShapeFromPlane(const App::DocumentObject* obj);
     static TopoShape makeTopoShapeFromPlane(const App::DocumentObject* obj);
+
+private:
+    std::size_t getResultCacheKey() const;
+    bool restoreCachedResult(std::size_t key);
+    void cacheResult(std::size_t key);
+
+    struct CachedResult
+    {
+        std::size_t key;
+        Base::Placement placement;
+        std::vector<TopoShape> shapes;
+    };
+    /// Results of the last recomputes, most recent first
+    std::deque<CachedResult> resultCache;
 };
 
 using FeaturePython = App::FeaturePythonT<Feature>;
@@ -24,6 +24,9 @@
 
 
 #include <limits>
+#include <map>
+#include <mutex>
+#include <gp_Ax3.hxx>
 #include <gp_Circ.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Cylinder.hxx>
@@ -2127,45 +2130,6 @@ App::DocumentObjectExecReturn* Hole::execute()
     }
 }
 
-void Hole::rotateToNormal(const gp_Dir& helixAxis, const gp_Dir& normalAxis, TopoDS_Shape& helixShape) const
-{
-    auto getRotationAxis = [](const gp_Dir& dir1, const gp_Dir& dir2, gp_Dir& dir3, double& angle) {
-        if (dir1.IsEqual(dir2, Precision::Angular())) {
-            return false;
-        }
-
-        angle = acos(dir1 * dir2);
-        if (dir1.IsOpposite(dir2, Precision::Angular())) {
-            // Create a vector that is not parallel to dir1
-            gp_XYZ xyz(dir1.XYZ());
-            if (fabs(xyz.X()) <= fabs(xyz.Y()) && fabs(xyz.X()) <= fabs(xyz.Z())) {
-                xyz.SetX(1.0);
-            }
-            else if (fabs(xyz.Y()) <= fabs(xyz.X()) && fabs(xyz.Y()) <= fabs(xyz.Z())) {
-                xyz.SetY(1.0);
-            }
-            else {
-                xyz.SetZ(1.0);
-            }
-            dir3 = dir1.Crossed(gp_Dir(xyz));
-        }
-        else {
-            dir3 = dir1.Crossed(dir2);
-        }
-        return true;
-    };
-    // rotate the helixAxis so that it is pointing in the normalAxis.
-    double angle;
-    gp_Dir rotAxis;
-    if (getRotationAxis(helixAxis, normalAxis, rotAxis, angle)) {
-        gp_Pnt origo(0.0, 0.0, 0.0);
-        gp_Trsf mov = helixShape.Location().Transformation();
-        mov.SetRotation(gp_Ax1(origo, rotAxis), angle);
-        TopLoc_Location loc2(mov);
-        helixShape.Move(loc2);
-    }
-}
-
 gp_Vec Hole::computePerpendicular(const gp_Vec& zDir) const
 {
     // Define xDir
@@ -2272,7 +2236,53 @@ TopoShape Hole::findHoles(
     return TopoShape().makeElementCompound(holes);
 }
 
-TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double length)
+namespace
+{
+
+/// Everything the solid of a modeled thread depends on
+struct ThreadKey
+{
+    std::string profile;
+    double Rmaj;
+    double RmajC;
+    double pitch;
+    double helixLength;
+    double helixAngle;
+    bool leftHanded;
+
+    auto operator<=>(const ThreadKey&) const = default;
+};
+
+/// The sweep of a thread is expensive, so the solids of the recently used thread specifications
+/// are shared by all holes. They are built along the z-axis and only moved into place.
+class ThreadCache
+{
+public:
+    static TopoDS_Shape find(const ThreadKey& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = shapes.find(key);
+        return it != shapes.end() ? it->second : TopoDS_Shape();
+    }
+
+    static void add(const ThreadKey& key, const TopoDS_Shape& shape)
+    {
+        constexpr std::size_t maxSize = 64;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shapes.size() >= maxSize) {
+            shapes.clear();
+        }
+        shapes[key] = shape;
+    }
+
+private:
+    inline static std::map<ThreadKey, TopoDS_Shape> shapes;
+    inline static std::mutex mutex;
+};
+
+}  // namespace
+
+TopoDS_Shape Hole::makeThread(const gp_Vec& holeXDir, const gp_Vec& holeZDir, double length)
 {
     int threadType = ThreadType.getValue();
     int threadSize = ThreadSize.getValue();
@@ -2302,9 +2312,58 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     double RmajC = Rmaj + clearance;
     double marginZ = 0.001;
 
+    // create the helix path
+    double threadDepth = ThreadDepth.getValue();
+    double helixLength = threadDepth + Pitch / 2;
+    double holeDepth = Depth.getValue();
+    std::string threadDepthMethod(ThreadDepthType.getValueAsString());
+    std::string depthMethod(DepthType.getValueAsString());
+    if (threadDepthMethod != "Dimension") {
+        if (depthMethod == "ThroughAll") {
+            threadDepth = length;
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + 2 * Pitch;
+        }
+        else if (threadDepthMethod == "Tapped (DIN76)") {
+            threadDepth = holeDepth - getThreadRunout();
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + Pitch / 2;
+        }
+        else {  // Hole depth
+            threadDepth = holeDepth;
+            ThreadDepth.setValue(threadDepth);
+            helixLength = threadDepth + Pitch / 8;
+        }
+    }
+    else {
+        if (depthMethod == "Dimension") {
+            // the thread must not be deeper than the hole
+            // thus the max helixLength is holeDepth + P / 8;
+            if (threadDepth > (holeDepth - Pitch / 2)) {
+                helixLength = holeDepth + Pitch / 8;
+            }
+        }
+    }
+    double helixAngle = Tapered.getValue() ? TaperedAngle.getValue() - 90 : 0.0;
+
+    // The thread is built along the z-axis and then moved to the hole axis. As the sweep is a
+    // screw motion of the cross section the phase of the helix doesn't change the solid.
+    gp_Trsf toHole;
+    toHole.SetDisplacement(gp_Ax3(), gp_Ax3(gp_Pnt(), gp_Dir(holeZDir), gp_Dir(holeXDir)));
+    TopLoc_Location holeLoc(toHole);
+
+    std::string threadTypeStr = ThreadType.getValueAsString();
+    ThreadKey key {threadTypeStr, Rmaj, RmajC, Pitch, helixLength, helixAngle, leftHanded};
+    TopoDS_Shape cached = ThreadCache::find(key);
+    if (!cached.IsNull()) {
+        return cached.Moved(holeLoc);
+    }
+
+    const gp_Vec xDir(1.0, 0.0, 0.0);
+    const gp_Vec zDir(0.0, 0.0, 1.0);
+
     BRepBuilderAPI_MakeWire mkThreadWire;
     double H;
-    std::string threadTypeStr = ThreadType.getValueAsString();
     if (threadTypeStr == "BSP" || threadTypeStr == "BSW" || threadTypeStr == "BSF") {
         H = 0.960491 * Pitch;              // Height of Sharp V
         double radius = 0.137329 * Pitch;  // radius of the crest
@@ -2373,43 +2432,9 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     mkThreadWire.Build();
     TopoDS_Wire threadWire = mkThreadWire.Wire();
 
-    // create the helix path
-    double threadDepth = ThreadDepth.getValue();
-    double helixLength = threadDepth + Pitch / 2;
-    double holeDepth = Depth.getValue();
-    std::string threadDepthMethod(ThreadDepthType.getValueAsString());
-    std::string depthMethod(DepthType.getValueAsString());
-    if (threadDepthMethod != "Dimension") {
-        if (depthMethod == "ThroughAll") {
-            threadDepth = length;
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + 2 * Pitch;
-        }
-        else if (threadDepthMethod == "Tapped (DIN76)") {
-            threadDepth = holeDepth - getThreadRunout();
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + Pitch / 2;
-        }
-        else {  // Hole depth
-            threadDepth = holeDepth;
-            ThreadDepth.setValue(threadDepth);
-            helixLength = threadDepth + Pitch / 8;
-        }
-    }
-    else {
-        if (depthMethod == "Dimension") {
-            // the thread must not be deeper than the hole
-            // thus the max helixLength is holeDepth + P / 8;
-            if (threadDepth > (holeDepth - Pitch / 2)) {
-                helixLength = holeDepth + Pitch / 8;
-            }
-        }
-    }
-    double helixAngle = Tapered.getValue() ? TaperedAngle.getValue() - 90 : 0.0;
     TopoDS_Shape helix = TopoShape().makeLongHelix(Pitch, helixLength, Rmaj, helixAngle, leftHanded);
 
     gp_Pnt origo(0.0, 0.0, 0.0);
-    gp_Dir dir_axis1(0.0, 0.0, 1.0);  // pointing along the helix axis, as created.
     gp_Dir dir_axis2(1.0, 0.0, 0.0);  // pointing towards the helix start point, as created.
 
     // Reverse the direction of the helix. So that it goes into the material
@@ -2418,9 +2443,6 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
     TopLoc_Location loc1(mov);
     helix.Move(loc1);
 
-    // rotate the helix so that it is pointing in the zdir.
-    rotateToNormal(dir_axis1, zDir, helix);
-
     // create the pipe shell
     BRepOffsetAPI_MakePipeShell mkPS(TopoDS::Wire(helix));
     mkPS.SetTolerance(Precision::Confusion());
@@ -2465,8 +2487,8 @@ TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double len
         result.Reverse();
     }
 
-    // we are done
-    return result;
+    ThreadCache::add(key, result);
+    return result.Moved(holeLoc);
 }
 
 void Hole::addCutType(const CutDimensionSet& dimensions)
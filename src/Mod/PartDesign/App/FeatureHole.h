@@ -292,7 +292,6 @@ private:
     double getThreadRunout(int mode = 1) const;
     double getThreadProfileAngle();
     void findClosestDesignation();
-    void rotateToNormal(const gp_Dir& helixAxis, const gp_Dir& normalAxis, TopoDS_Shape& helixShape) const;
     gp_Vec computePerpendicular(const gp_Vec&) const;
     TopoDS_Shape makeThread(const gp_Vec&, const gp_Vec&, double);
 
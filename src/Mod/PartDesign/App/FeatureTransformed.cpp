@@ -364,18 +364,69 @@ App::DocumentObjectExecReturn* Transformed::execute()
 
     supportShape.setTransform(Base::Matrix4D());
 
-    auto getTransformedCompShape = [&](const auto& supportShape, const auto& origShape) {
+    // Transformed copies whose bounding box cannot reach the support are left out of the
+    // boolean. Cutting with them changes nothing, and fused they would only end up as rejected
+    // solids, so they are added to those right away.
+    std::vector<TopoDS_Shape> detachedShapes;
+    auto getReachingCopies = [&](const TopoShape& supportShape, const TopoShape& origShape, bool fuse) {
+        std::vector<bool> reaching(transformations.size(), true);
+        Bnd_Box supportBox;
+        BRepBndLib::Add(supportShape.getShape(), supportBox);
+        Bnd_Box origBox;
+        BRepBndLib::Add(origShape.getShape(), origBox);
+        if (supportBox.IsVoid() || origBox.IsVoid()) {
+            return reaching;
+        }
+        supportBox.Enlarge(Precision::Confusion());
+        origBox.Enlarge(Precision::Confusion());
+
+        std::vector<Bnd_Box> boxes(transformations.size());
+        std::vector<std::size_t> pending;
+        std::size_t unreached = 0;
+        for (std::size_t i = 1; i < transformations.size(); ++i) {
+            boxes[i] = origBox.Transformed(transformations[i]);
+            reaching[i] = !boxes[i].IsOut(supportBox);
+            if (reaching[i]) {
+                pending.push_back(i);
+            }
+            else {
+                ++unreached;
+            }
+        }
+        // fused copies also stay attached through other attached copies
+        while (fuse && unreached > 0 && !pending.empty()) {
+            std::size_t i = pending.back();
+            pending.pop_back();
+            for (std::size_t j = 1; j < transformations.size(); ++j) {
+                if (!reaching[j] && !boxes[j].IsOut(boxes[i])) {
+                    reaching[j] = true;
+                    pending.push_back(j);
+                    --unreached;
+                }
+            }
+        }
+        return reaching;
+    };
+
+    auto getTransformedCompShape = [&](const auto& supportShape, const auto& origShape, bool fuse) {
         std::vector<TopoShape> shapes = {supportShape};
         TopoShape shape(origShape);
+        std::vector<bool> reaching = getReachingCopies(supportShape, shape, fuse);
         int idx = 1;
-        auto transformIter = transformations.cbegin();
-        transformIter++;
-        for (; transformIter != transformations.end(); transformIter++) {
+        for (std::size_t i = 1; i < transformations.size(); ++i) {
             if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                 return std::vector<TopoShape>();
             }
+            // keep the index of every copy, so that element names do not depend on the others
             auto opName = Data::indexSuffix(idx++);
-            shapes.emplace_back(shape.makeElementTransform(*transformIter, opName.c_str()));
+            if (reaching[i]) {
+                shapes.emplace_back(shape.makeElementTransform(transformations[i], opName.c_str()));
+            }
+            else if (fuse) {
+                // mirrored copies need a real transformation, not just a location
+                detachedShapes.push_back(
+                    shape.makeElementTransform(transformations[i], opName.c_str()).getShape());
+            }
         }
         return shapes;
     };
@@ -415,14 +466,14 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, fuseShape);
+                    auto shapes = getTransformedCompShape(supportShape, fuseShape, true);
                     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
                     supportShape.makeElementFuse(shapes);
                 }
                 if (!cutShape.isNull()) {
-                    auto shapes = getTransformedCompShape(supportShape, cutShape);
+                    auto shapes = getTransformedCompShape(supportShape, cutShape, false);
                     if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                         return new App::DocumentObjectExecReturn("User aborted");
                     }
@@ -431,7 +482,7 @@ App::DocumentObjectExecReturn* Transformed::execute()
             }
             break;
         case Mode::WholeShape: {
-            auto shapes = getTransformedCompShape(supportShape, supportShape);
+            auto shapes = getTransformedCompShape(supportShape, supportShape, true);
             if (OCCTProgressIndicator::getAppIndicator().UserBreak()) {
                 return new App::DocumentObjectExecReturn("User aborted");
             }
@@ -444,6 +495,18 @@ App::DocumentObjectExecReturn* Transformed::execute()
 
     this->Shape.setValue(getSolid(supportShape));  // picking the first solid
     rejected = getRemainingSolids(supportShape.getShape());
+    if (!detachedShapes.empty()) {
+        BRep_Builder builder;
+        TopoDS_Compound compShape;
+        builder.MakeCompound(compShape);
+        builder.Add(compShape, rejected);
+        for (const auto& detached : detachedShapes) {
+            for (TopExp_Explorer xp(detached, TopAbs_SOLID); xp.More(); xp.Next()) {
+                builder.Add(compShape, xp.Current());
+            }
+        }
+        rejected = compShape;
+    }
 
     return App::DocumentObject::StdReturn;
 }
@@ -98,6 +98,12 @@ public:
 
     void onChanged(const App::Property* prop) override;
 
+    /// The rejected shapes are not kept with cached results
+    bool isResultCacheable() const override
+    {
+        return false;
+    }
+
     /** returns the compound of the shapes that were rejected during the last execute
      * because they did not overlap with the support
      */
@@ -197,6 +197,37 @@ class TestHole(unittest.TestCase):
         self.Doc.recompute()
         self.assertEqual(len(self.Hole.Shape.Faces), 7)
 
+    def testModeledThreadReuse(self):
+        self.Hole.ThreadType = "ISOMetricProfile"
+        self.Hole.ThreadSize = "M3x0.5"
+        self.Hole.Threaded = True
+        self.Hole.ModelThread = True
+        self.Hole.DepthType = "Dimension"
+        self.Hole.Depth = 6
+        self.Doc.recompute()
+        self.assertTrue(self.Hole.Shape.isValid())
+        removed = 10**3 - self.Hole.Shape.Volume
+
+        # A second hole with the same thread specification shares the thread solid
+        sketch = self.Doc.addObject("Sketcher::SketchObject", "SketchHole2")
+        sketch.AttachmentSupport = (self.Doc.XY_Plane, [""])
+        sketch.MapMode = "FlatFace"
+        sketch.MapReversed = True
+        self.Body.addObject(sketch)
+        TestSketcherApp.CreateCircleSketch(sketch, (-2, 2), 1)
+        hole = self.Doc.addObject("PartDesign::Hole", "Hole2")
+        hole.Profile = sketch
+        self.Body.addObject(hole)
+        hole.ThreadType = "ISOMetricProfile"
+        hole.ThreadSize = "M3x0.5"
+        hole.Threaded = True
+        hole.ModelThread = True
+        hole.DepthType = "Dimension"
+        hole.Depth = 6
+        self.Doc.recompute()
+        self.assertTrue(hole.Shape.isValid())
+        self.assertAlmostEqual(self.Hole.Shape.Volume - hole.Shape.Volume, removed, places=3)
+
     def testThreadEnums(self):
         """Test thread enums for correct order"""
         # Due to the savefile use of indexes and not strings
@@ -75,6 +75,15 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    double readVoxelSize() const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points");
+        return hGrp->GetFloat("ImportVoxelSize", 0.0);
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -115,6 +124,8 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            reader->setVoxelSize(readVoxelSize());
+            reader->setVoxelSize(readVoxelSize());
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().newDocument();
@@ -142,14 +153,14 @@ private:
                     pcFeature = new Points::FeatureCustom();
                 }
 
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 // add gray values
                 if (reader->hasIntensities()) {
                     Points::PropertyGreyValueList* prop = static_cast<Points::PropertyGreyValueList*>(
                         pcFeature->addDynamicProperty("Points::PropertyGreyValueList", "Intensity")
                     );
                     if (prop) {
-                        prop->setValues(reader->getIntensities());
+                        prop->setValues(reader->takeIntensities());
                     }
                 }
                 // add colors
@@ -158,7 +169,7 @@ private:
                         pcFeature->addDynamicProperty("App::PropertyColorList", "Color")
                     );
                     if (prop) {
-                        prop->setValues(reader->getColors());
+                        prop->setValues(reader->takeColors());
                     }
                 }
                 // add normals
@@ -167,7 +178,7 @@ private:
                         pcFeature->addDynamicProperty("Points::PropertyNormalList", "Normal")
                     );
                     if (prop) {
-                        prop->setValues(reader->getNormals());
+                        prop->setValues(reader->takeNormals());
                     }
                 }
 
@@ -188,7 +199,7 @@ private:
                 }
 
                 // delayed adding of the points feature
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 pcDoc->addObject(pcFeature, file.fileNamePure().c_str());
                 pcDoc->recomputeFeature(pcFeature);
                 pcFeature->purgeTouched();
@@ -272,14 +283,14 @@ private:
                     pcFeature = new Points::FeatureCustom();
                 }
 
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 // add gray values
                 if (reader->hasIntensities()) {
                     Points::PropertyGreyValueList* prop = static_cast<Points::PropertyGreyValueList*>(
                         pcFeature->addDynamicProperty("Points::PropertyGreyValueList", "Intensity")
                     );
                     if (prop) {
-                        prop->setValues(reader->getIntensities());
+                        prop->setValues(reader->takeIntensities());
                     }
                 }
                 // add colors
@@ -288,7 +299,7 @@ private:
                         pcFeature->addDynamicProperty("App::PropertyColorList", "Color")
                     );
                     if (prop) {
-                        prop->setValues(reader->getColors());
+                        prop->setValues(reader->takeColors());
                     }
                 }
                 // add normals
@@ -297,7 +308,7 @@ private:
                         pcFeature->addDynamicProperty("Points::PropertyNormalList", "Normal")
                     );
                     if (prop) {
-                        prop->setValues(reader->getNormals());
+                        prop->setValues(reader->takeNormals());
                     }
                 }
 
@@ -308,7 +319,7 @@ private:
             }
             else {
                 auto* pcFeature = pcDoc->addObject<Points::Feature>(file.fileNamePure().c_str());
-                pcFeature->Points.setValue(reader->getPoints());
+                pcFeature->Points.setValue(reader->takePoints());
                 pcDoc->recomputeFeature(pcFeature);
                 pcFeature->purgeTouched();
             }
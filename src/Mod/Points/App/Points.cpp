@@ -24,16 +24,22 @@
 
 #include <QtConcurrentMap>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <span>
 
 
 #include <Base/Matrix.h>
+#include <Base/Parallel.h>
 #include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "Points.h"
 #include "PointsAlgos.h"
+#include "PointsKDTree.h"
 
 
 #ifdef _MSC_VER
@@ -83,18 +89,15 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    // The blocks are transformed in parallel, each with the vectorized batch multiplication
     std::vector<value_type>& kernel = getBasicPoints();
-#ifdef _MSC_VER
-    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
-    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
-    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
-    // for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
+    const std::size_t blockSize = 4096;
+    std::size_t blocks = (kernel.size() + blockSize - 1) / blockSize;
+    Base::parallelFor(blocks, [&](std::size_t block) {
+        std::size_t start = block * blockSize;
+        std::size_t count = std::min(blockSize, kernel.size() - start);
+        rclMat.multVec(std::span<value_type>(kernel.data() + start, count));
     });
-#else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) { rclMat.multVec(value, value); });
-#endif
 }
 
 void PointKernel::moveGeometry(const Base::Vector3d& vec)
@@ -133,6 +136,51 @@ Base::BoundBox3d PointKernel::getBoundBox() const
     return bnd;
 }
 
+std::size_t PointKernel::fingerprint() const
+{
+    // FNV-1a over the bit patterns of the coordinates and the placement
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto add = [&hash](std::uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+
+    add(_Points.size());
+    for (const auto& pnt : _Points) {
+        std::uint32_t bits[3];
+        std::memcpy(bits, &pnt.x, sizeof(float));
+        std::memcpy(bits + 1, &pnt.y, sizeof(float));
+        std::memcpy(bits + 2, &pnt.z, sizeof(float));
+        add(bits[0]);
+        add(bits[1]);
+        add(bits[2]);
+    }
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            std::uint64_t bits {};
+            double value = _Mtrx[i][j];
+            std::memcpy(&bits, &value, sizeof(double));
+            add(bits);
+        }
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+std::shared_ptr<const PointsKDTree> PointKernel::getKDTree() const
+{
+    // The points can be modified through the non-const getBasicPoints() without notice,
+    // so a cached tree is only reused if the points still have the same fingerprint
+    std::size_t current = fingerprint();
+    std::lock_guard<std::mutex> lock(_kdTreeMutex);
+    if (!_kdTree || _kdTreeFingerprint != current) {
+        _kdTree = std::make_shared<const PointsKDTree>(_Points, _Mtrx);
+        _kdTreeFingerprint = current;
+    }
+
+    return _kdTree;
+}
+
 PointKernel& PointKernel::operator=(const PointKernel& Kernel)
 {
     if (this != &Kernel) {
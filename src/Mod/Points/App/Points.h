@@ -26,6 +26,8 @@
 #pragma once
 
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <App/ComplexGeoData.h>
@@ -40,6 +42,7 @@
 
 namespace Points
 {
+class PointsKDTree;
 
 /** Point kernel
  */
@@ -111,6 +114,12 @@ public:
     void transformGeometry(const Base::Matrix4D& rclMat) override;
     void moveGeometry(const Base::Vector3d& vec);
     Base::BoundBox3d getBoundBox() const override;
+    /**
+     * Returns a kd-tree over the points in global coordinates.
+     * The tree is built on first use and shared by later calls until the
+     * points or the placement change.
+     */
+    std::shared_ptr<const PointsKDTree> getKDTree() const;
 
     /** @name I/O */
     //@{
@@ -126,9 +135,15 @@ public:
     void load(std::istream&);
     //@}
 
+private:
+    std::size_t fingerprint() const;
+
 private:
     Base::Matrix4D _Mtrx;
     std::vector<value_type> _Points;
+    mutable std::mutex _kdTreeMutex;
+    mutable std::shared_ptr<const PointsKDTree> _kdTree;
+    mutable std::size_t _kdTreeFingerprint {0};
 
 public:
     /// number of points stored
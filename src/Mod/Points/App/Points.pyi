@@ -60,6 +60,33 @@ class Points(object):
     def fromValid(self) -> Any:
         """Get a new point object from points with valid coordinates (i.e. that are not NaN)"""
         ...
+
+    @constmethod
+    def nearest(self) -> Any:
+        """nearest(Vector, [k=1]) -> list
+        Get the indices of the k points nearest to the given point, ordered by
+        increasing distance. Points with NaN coordinates are never returned."""
+        ...
+
+    @constmethod
+    def radiusSearch(self) -> Any:
+        """radiusSearch(Vector, radius) -> list
+        Get the indices of all points within the given distance of the point
+        in ascending order."""
+        ...
+
+    @constmethod
+    def getPointArray(self) -> Any:
+        """getPointArray() -> memoryview
+        Get a read-only copy of the points as an n x 3 buffer of doubles.
+        numpy.asarray() accepts it without converting each point."""
+        ...
+
+    def setPointArray(self) -> Any:
+        """setPointArray(buffer)
+        Replace the points with the ones of an n x 3 buffer of floats or doubles,
+        e.g. a numpy array."""
+        ...
     CountPoints: Final[int]
     """Return the number of vertices of the points object."""
 
@@ -27,8 +27,18 @@
 #ifdef FC_OS_LINUX
 # include <unistd.h>
 #endif
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
+#include <utility>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
@@ -133,6 +143,7 @@ Reader::~Reader() = default;
 
 void Reader::clear()
 {
+    points.clear();
     intensity.clear();
     colors.clear();
     normals.clear();
@@ -193,6 +204,36 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setVoxelSize(double size)
+{
+    voxelSize = size;
+}
+
+double Reader::getVoxelSize() const
+{
+    return voxelSize;
+}
+
+PointKernel Reader::takePoints()
+{
+    return std::exchange(points, PointKernel());
+}
+
+std::vector<float> Reader::takeIntensities()
+{
+    return std::exchange(intensity, {});
+}
+
+std::vector<Base::Color> Reader::takeColors()
+{
+    return std::exchange(colors, {});
+}
+
+std::vector<Base::Vector3f> Reader::takeNormals()
+{
+    return std::exchange(normals, {});
+}
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
@@ -249,94 +290,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(
-        std::streambuf::off_type off,
-        std::ios_base::seekdir way,
-        std::ios_base::openmode mode = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(
-        std::streambuf::pos_type pos,
-        std::ios_base::openmode which = std::ios::in | std::ios::out
-    ) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int lzfDecompress(
@@ -554,180 +507,692 @@ unsigned int lzfDecompress(
 }  // namespace Points
 // NOLINTEND
 
-PlyReader::PlyReader() = default;
+// ----------------------------------------------------------------------------
 
-void PlyReader::read(const std::string& filename)
+namespace
 {
-    clear();
+// the number of records that are decoded at once
+constexpr std::size_t ChunkSize = 65536;
+// the number of records decoded by a single task
+constexpr std::size_t BlockSize = 4096;
+// marks a missing field
+constexpr std::size_t NoField = std::numeric_limits<std::size_t>::max();
+
+/// The decoded attributes of a number of records
+struct Chunk
+{
+    std::vector<Base::Vector3f> points;
+    std::vector<Base::Vector3f> normals;
+    std::vector<float> intensity;
+    std::vector<Base::Color> colors;
 
-    Base::FileInfo fi(filename);
-    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+    void clear()
+    {
+        points.clear();
+        normals.clear();
+        intensity.clear();
+        colors.clear();
+    }
+};
 
-    std::string format;
-    std::vector<std::string> fields;
-    std::vector<std::string> types;
-    std::vector<int> sizes;
-    std::size_t offset = 0;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
+/*
+ * Appends chunks to the output of a reader. If a voxel size is set only the first point that
+ * falls into a voxel is kept, so a cloud can be thinned out while it's read instead of afterwards.
+ */
+class ChunkWriter
+{
+public:
+    ChunkWriter(
+        std::vector<Base::Vector3f>& points,
+        std::vector<Base::Vector3f>& normals,
+        std::vector<float>& intensity,
+        std::vector<Base::Color>& colors,
+        double voxelSize
+    )
+        : points {points}
+        , normals {normals}
+        , intensity {intensity}
+        , colors {colors}
+        , voxelSize {voxelSize}
+    {}
 
-    this->width = numPoints;
-    this->height = 1;
+    void reserve(std::size_t count, bool hasNormals, bool hasIntensity, bool hasColors)
+    {
+        // with downsampling the final number of points is unknown
+        if (voxelSize > 0) {
+            return;
+        }
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
+        points.reserve(points.size() + count);
+        if (hasNormals) {
+            normals.reserve(normals.size() + count);
+        }
+        if (hasIntensity) {
+            intensity.reserve(intensity.size() + count);
+        }
+        if (hasColors) {
+            colors.reserve(colors.size() + count);
+        }
     }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
+
+    void append(const Chunk& chunk)
+    {
+        if (voxelSize <= 0) {
+            points.insert(points.end(), chunk.points.begin(), chunk.points.end());
+            normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+            intensity.insert(intensity.end(), chunk.intensity.begin(), chunk.intensity.end());
+            colors.insert(colors.end(), chunk.colors.begin(), chunk.colors.end());
+            return;
+        }
+
+        for (std::size_t index = 0; index < chunk.points.size(); index++) {
+            if (!insertVoxel(chunk.points[index])) {
+                continue;
+            }
+
+            points.push_back(chunk.points[index]);
+            if (!chunk.normals.empty()) {
+                normals.push_back(chunk.normals[index]);
+            }
+            if (!chunk.intensity.empty()) {
+                intensity.push_back(chunk.intensity[index]);
+            }
+            if (!chunk.colors.empty()) {
+                colors.push_back(chunk.colors[index]);
+            }
+        }
     }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
+
+private:
+    using VoxelKey = std::array<std::int64_t, 3>;
+    struct VoxelHash
+    {
+        std::size_t operator()(const VoxelKey& key) const
+        {
+            std::size_t hash = 0;
+            for (std::int64_t value : key) {
+                hash ^= std::hash<std::int64_t> {}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    bool insertVoxel(const Base::Vector3f& pnt)
+    {
+        VoxelKey key {
+            static_cast<std::int64_t>(std::floor(pnt.x / voxelSize)),
+            static_cast<std::int64_t>(std::floor(pnt.y / voxelSize)),
+            static_cast<std::int64_t>(std::floor(pnt.z / voxelSize))
+        };
+        return voxels.insert(key).second;
     }
 
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
+private:
+    std::vector<Base::Vector3f>& points;
+    std::vector<Base::Vector3f>& normals;
+    std::vector<float>& intensity;
+    std::vector<Base::Color>& colors;
+    double voxelSize;
+    std::unordered_set<VoxelKey, VoxelHash> voxels;
+};
+
+enum class FieldType
+{
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64
+};
+
+std::size_t sizeOf(FieldType type)
+{
+    switch (type) {
+        case FieldType::Int8:
+        case FieldType::UInt8:
+            return 1;
+        case FieldType::Int16:
+        case FieldType::UInt16:
+            return 2;
+        case FieldType::Int32:
+        case FieldType::UInt32:
+        case FieldType::Float32:
+            return 4;
+        case FieldType::Float64:
+            return 8;
+    }
+    return 0;
+}
+
+/*
+ * Describes where the values of a field are located in a block of memory, this way data that is
+ * stored record by record or field by field is handled the same way.
+ */
+struct Field
+{
+    FieldType type;
+    std::size_t offset;
+    std::size_t stride;
+};
 
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
+/// Fields that are stored record by record
+std::vector<Field> makeRowLayout(const std::vector<FieldType>& types)
+{
+    std::size_t recordSize = 0;
+    for (FieldType type : types) {
+        recordSize += sizeOf(type);
     }
 
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
+    std::vector<Field> fields;
+    std::size_t offset = 0;
+    for (FieldType type : types) {
+        fields.push_back({type, offset, recordSize});
+        offset += sizeOf(type);
     }
+    return fields;
+}
 
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
+/// Fields that are stored field by field
+std::vector<Field> makeColumnLayout(const std::vector<FieldType>& types, std::size_t numPoints)
+{
+    std::vector<Field> fields;
+    std::size_t offset = 0;
+    for (FieldType type : types) {
+        fields.push_back({type, offset, sizeOf(type)});
+        offset += sizeOf(type) * numPoints;
     }
+    return fields;
+}
 
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
+std::size_t recordSizeOf(const std::vector<FieldType>& types)
+{
+    std::size_t size = 0;
+    for (FieldType type : types) {
+        size += sizeOf(type);
     }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
+    return size;
+}
+
+template<typename T>
+double readValue(const char* ptr, bool swapByteOrder)
+{
+    std::array<char, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), ptr, sizeof(T));
+    if (swapByteOrder) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    T value;
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return static_cast<double>(value);
+}
+
+std::size_t findField(
+    const std::vector<std::string>& fields,
+    std::initializer_list<const char*> names
+)
+{
+    for (const char* name : names) {
+        auto it = std::ranges::find(fields, name);
+        if (it != fields.end()) {
+            return static_cast<std::size_t>(std::distance(fields.begin(), it));
+        }
     }
+    return NoField;
+}
+
+/// The fields that hold the attributes of a point and how its color is stored
+struct Attributes
+{
+    enum class Color
+    {
+        None,
+        Byte,          // separate channels in the range [0, 255]
+        Float,         // separate channels in the range [0, 1]
+        PackedInt,     // packed ARGB value
+        PackedFloat    // packed ARGB value in the bits of a float
+    };
+
+    std::size_t x {NoField}, y {NoField}, z {NoField};
+    std::size_t nx {NoField}, ny {NoField}, nz {NoField};
+    std::size_t grey {NoField};
+    std::size_t red {NoField}, green {NoField}, blue {NoField}, alpha {NoField};
+    std::size_t rgba {NoField};
+    Color color {Color::None};
+
+    explicit Attributes(const std::vector<std::string>& fields)
+        : x {findField(fields, {"x"})}
+        , y {findField(fields, {"y"})}
+        , z {findField(fields, {"z"})}
+        , nx {findField(fields, {"normal_x", "nx"})}
+        , ny {findField(fields, {"normal_y", "ny"})}
+        , nz {findField(fields, {"normal_z", "nz"})}
+        , grey {findField(fields, {"intensity"})}
+    {}
 
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
+    bool hasPoints() const
+    {
+        return x != NoField && y != NoField && z != NoField;
     }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
+    bool hasNormals() const
+    {
+        return hasPoints() && nx != NoField && ny != NoField && nz != NoField;
     }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
+    bool hasIntensity() const
+    {
+        return hasPoints() && grey != NoField;
     }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
+    bool hasColors() const
+    {
+        return hasPoints() && color != Color::None;
     }
+};
+
+/*
+ * Decodes records into a chunk. The records are split into blocks that are decoded in parallel
+ * and written to their final position in the chunk.
+ */
+class RecordDecoder
+{
+public:
+    RecordDecoder(std::vector<Field> fields, bool swapByteOrder, const Attributes& attr)
+        : fields {std::move(fields)}
+        , swapByteOrder {swapByteOrder}
+        , attr {attr}
+    {}
+
+    /// Decodes the records [first, first + count) of \a data
+    void decode(const char* data, std::size_t first, std::size_t count, Chunk& chunk) const
+    {
+        chunk.points.resize(attr.hasPoints() ? count : 0);
+        chunk.normals.resize(attr.hasNormals() ? count : 0);
+        chunk.intensity.resize(attr.hasIntensity() ? count : 0);
+        chunk.colors.resize(attr.hasColors() ? count : 0);
+        if (!attr.hasPoints()) {
+            return;
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t>> blocks;
+        for (std::size_t begin = 0; begin < count; begin += BlockSize) {
+            blocks.emplace_back(begin, std::min(begin + BlockSize, count));
+        }
 
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
+        QtConcurrent::blockingMap(blocks, [&](const std::pair<std::size_t, std::size_t>& block) {
+            for (std::size_t index = block.first; index < block.second; index++) {
+                decodeRecord(data, first + index, index, chunk);
+            }
+        });
     }
 
-    // rgb(a) field
-    Eigen::Index red = max_size;
-    Eigen::Index green = max_size;
-    Eigen::Index blue = max_size;
-    Eigen::Index alpha = max_size;
-    it = std::ranges::find(fields, "red");
-    if (it != fields.end()) {
-        red = std::distance(fields.begin(), it);
+private:
+    double value(const char* data, std::size_t field, std::size_t record) const
+    {
+        const Field& f = fields[field];
+        const char* ptr = data + f.offset + record * f.stride;
+        switch (f.type) {
+            case FieldType::Int8:
+                return readValue<int8_t>(ptr, swapByteOrder);
+            case FieldType::UInt8:
+                return readValue<uint8_t>(ptr, swapByteOrder);
+            case FieldType::Int16:
+                return readValue<int16_t>(ptr, swapByteOrder);
+            case FieldType::UInt16:
+                return readValue<uint16_t>(ptr, swapByteOrder);
+            case FieldType::Int32:
+                return readValue<int32_t>(ptr, swapByteOrder);
+            case FieldType::UInt32:
+                return readValue<uint32_t>(ptr, swapByteOrder);
+            case FieldType::Float32:
+                return readValue<float>(ptr, swapByteOrder);
+            case FieldType::Float64:
+                return readValue<double>(ptr, swapByteOrder);
+        }
+        return 0.0;
+    }
+
+    void decodeRecord(const char* data, std::size_t record, std::size_t index, Chunk& chunk) const
+    {
+        chunk.points[index].Set(
+            static_cast<float>(value(data, attr.x, record)),
+            static_cast<float>(value(data, attr.y, record)),
+            static_cast<float>(value(data, attr.z, record))
+        );
+
+        if (attr.hasNormals()) {
+            chunk.normals[index].Set(
+                static_cast<float>(value(data, attr.nx, record)),
+                static_cast<float>(value(data, attr.ny, record)),
+                static_cast<float>(value(data, attr.nz, record))
+            );
+        }
+
+        if (attr.hasIntensity()) {
+            chunk.intensity[index] = static_cast<float>(value(data, attr.grey, record));
+        }
+
+        if (attr.hasColors()) {
+            chunk.colors[index] = decodeColor(data, record);
+        }
+    }
+
+    Base::Color decodeColor(const char* data, std::size_t record) const
+    {
+        switch (attr.color) {
+            case Attributes::Color::Byte: {
+                float a = 1.0F;
+                if (attr.alpha != NoField) {
+                    a = static_cast<float>(value(data, attr.alpha, record));
+                }
+                return Base::Color(
+                    static_cast<float>(value(data, attr.red, record)) / 255.0F,
+                    static_cast<float>(value(data, attr.green, record)) / 255.0F,
+                    static_cast<float>(value(data, attr.blue, record)) / 255.0F,
+                    a / 255.0F
+                );
+            }
+            case Attributes::Color::Float: {
+                float a = 1.0F;
+                if (attr.alpha != NoField) {
+                    a = static_cast<float>(value(data, attr.alpha, record));
+                }
+                return Base::Color(
+                    static_cast<float>(value(data, attr.red, record)),
+                    static_cast<float>(value(data, attr.green, record)),
+                    static_cast<float>(value(data, attr.blue, record)),
+                    a
+                );
+            }
+            case Attributes::Color::PackedInt: {
+                Base::Color col;
+                col.setPackedARGB(static_cast<uint32_t>(value(data, attr.rgba, record)));
+                return col;
+            }
+            case Attributes::Color::PackedFloat: {
+                static_assert(
+                    sizeof(float) == sizeof(uint32_t),
+                    "float and uint32_t have different sizes"
+                );
+                float f = static_cast<float>(value(data, attr.rgba, record));
+                uint32_t packed {};
+                std::memcpy(&packed, &f, sizeof(packed));
+                Base::Color col;
+                col.setPackedARGB(packed);
+                return col;
+            }
+            case Attributes::Color::None:
+                break;
+        }
+        return Base::Color();
     }
 
-    it = std::ranges::find(fields, "green");
-    if (it != fields.end()) {
-        green = std::distance(fields.begin(), it);
+private:
+    std::vector<Field> fields;
+    bool swapByteOrder;
+    const Attributes& attr;
+};
+
+bool isSwapNeeded(bool bigEndian)
+{
+    return bigEndian != (std::endian::native == std::endian::big);
+}
+
+void checkRemainingSize(std::istream& inp, std::size_t needed)
+{
+    std::streambuf* buf = inp.rdbuf();
+    if (buf) {
+        std::streamoff ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
+        std::streamoff ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
+        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
+        if (ulCurr + static_cast<std::streamoff>(needed) > ulSize) {
+            throw Base::BadFormatError("File expects too many elements");
+        }
     }
+}
 
-    it = std::ranges::find(fields, "blue");
-    if (it != fields.end()) {
-        blue = std::distance(fields.begin(), it);
+FieldType plyFieldType(const std::string& t, int size)
+{
+    switch (size) {
+        case 1:
+            if (t == "char" || t == "int8") {
+                return FieldType::Int8;
+            }
+            if (t == "uchar" || t == "uint8") {
+                return FieldType::UInt8;
+            }
+            break;
+        case 2:
+            if (t == "short" || t == "int16") {
+                return FieldType::Int16;
+            }
+            if (t == "ushort" || t == "uint16") {
+                return FieldType::UInt16;
+            }
+            break;
+        case 4:
+            if (t == "int" || t == "int32") {
+                return FieldType::Int32;
+            }
+            if (t == "uint" || t == "uint32") {
+                return FieldType::UInt32;
+            }
+            if (t == "float" || t == "float32") {
+                return FieldType::Float32;
+            }
+            break;
+        case 8:
+            if (t == "double" || t == "float64") {
+                return FieldType::Float64;
+            }
+            break;
+        default:
+            break;
     }
 
-    it = std::ranges::find(fields, "alpha");
-    if (it != fields.end()) {
-        alpha = std::distance(fields.begin(), it);
+    throw Base::BadFormatError("Unexpected type");
+}
+
+FieldType pcdFieldType(const std::string& type, int size)
+{
+    char t = type.empty() ? '\0' : type[0];
+    switch (size) {
+        case 1:
+            if (t == 'I') {
+                return FieldType::Int8;
+            }
+            if (t == 'U') {
+                return FieldType::UInt8;
+            }
+            break;
+        case 2:
+            if (t == 'I') {
+                return FieldType::Int16;
+            }
+            if (t == 'U') {
+                return FieldType::UInt16;
+            }
+            break;
+        case 4:
+            if (t == 'I') {
+                return FieldType::Int32;
+            }
+            if (t == 'U') {
+                return FieldType::UInt32;
+            }
+            if (t == 'F') {
+                return FieldType::Float32;
+            }
+            break;
+        case 8:
+            if (t == 'F') {
+                return FieldType::Float64;
+            }
+            break;
+        default:
+            break;
     }
 
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (red != max_size && green != max_size && blue != max_size);
+    throw Base::BadFormatError("Unexpected type");
+}
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
+/*
+ * Reads the lines of \a numPoints records with \a numFields values each. The lines are collected
+ * chunk by chunk and then parsed in parallel, fields that are missing in a line become zero.
+ */
+void readAsciiRecords(
+    std::istream& inp,
+    std::size_t skipLines,
+    std::size_t numPoints,
+    std::size_t numFields,
+    const Attributes& attr,
+    ChunkWriter& writer
+)
+{
+    std::vector<FieldType> types(numFields, FieldType::Float64);
+    RecordDecoder decoder(makeRowLayout(types), false, attr);
+
+    std::string line;
+    std::vector<std::string> lines;
+    std::vector<double> values;
+    Chunk chunk;
+    std::size_t row = 0;
+    bool done = false;
+    while (!done && row < numPoints) {
+        lines.clear();
+        while (lines.size() < std::min(ChunkSize, numPoints - row)) {
+            if (!std::getline(inp, line)) {
+                done = true;
+                break;
+            }
+            if (line.empty()) {
+                continue;
+            }
+            if (skipLines > 0) {
+                skipLines--;
+                continue;
+            }
+            lines.push_back(line);
+        }
+
+        values.assign(lines.size() * numFields, 0.0);
+        std::vector<std::pair<std::size_t, std::size_t>> blocks;
+        for (std::size_t begin = 0; begin < lines.size(); begin += BlockSize) {
+            blocks.emplace_back(begin, std::min(begin + BlockSize, lines.size()));
         }
+
+        std::atomic<bool> failed {false};
+        QtConcurrent::blockingMap(blocks, [&](const std::pair<std::size_t, std::size_t>& block) {
+            std::vector<std::string> list;
+            for (std::size_t index = block.first; index < block.second; index++) {
+                // since the file is loaded in binary mode we may get the CR at the end
+                std::string text = boost::trim_copy(lines[index]);
+                boost::split(list, text, boost::is_any_of("\t\r "), boost::token_compress_on);
+                try {
+                    for (std::size_t col = 0; col < list.size() && col < numFields; col++) {
+                        values[index * numFields + col] = boost::lexical_cast<double>(list[col]);
+                    }
+                }
+                catch (const boost::bad_lexical_cast&) {
+                    failed = true;
+                }
+            }
+        });
+        if (failed) {
+            throw Base::BadFormatError("Invalid number in point data");
+        }
+
+        decoder.decode(reinterpret_cast<const char*>(values.data()), 0, lines.size(), chunk);
+        writer.append(chunk);
+        row += lines.size();
     }
+}
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+/// Reads \a numPoints records that are stored record by record
+void readBinaryRecords(
+    std::istream& inp,
+    std::size_t numPoints,
+    const std::vector<FieldType>& types,
+    bool swapByteOrder,
+    const Attributes& attr,
+    ChunkWriter& writer
+)
+{
+    std::size_t recordSize = recordSizeOf(types);
+    checkRemainingSize(inp, recordSize * numPoints);
+
+    RecordDecoder decoder(makeRowLayout(types), swapByteOrder, attr);
+    std::vector<char> buffer;
+    Chunk chunk;
+    for (std::size_t row = 0; row < numPoints; row += ChunkSize) {
+        std::size_t count = std::min(ChunkSize, numPoints - row);
+        buffer.resize(count * recordSize);
+        inp.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!inp) {
+            throw Base::BadFormatError("Unexpected end of file");
         }
+
+        decoder.decode(buffer.data(), 0, count, chunk);
+        writer.append(chunk);
     }
+}
+}  // namespace
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(static_cast<float>(data(i, greyvalue)));
+PlyReader::PlyReader() = default;
+
+void PlyReader::read(const std::string& filename)
+{
+    clear();
+
+    Base::FileInfo fi(filename);
+    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+
+    std::string format;
+    std::vector<std::string> fields;
+    std::vector<std::string> types;
+    std::vector<int> sizes;
+    std::size_t offset = 0;
+    std::size_t numPoints = readHeader(inp, format, offset, fields, types, sizes);
+
+    Attributes attr(fields);
+    attr.red = findField(fields, {"red"});
+    attr.green = findField(fields, {"green"});
+    attr.blue = findField(fields, {"blue"});
+    attr.alpha = findField(fields, {"alpha"});
+    if (attr.red != NoField && attr.green != NoField && attr.blue != NoField) {
+        if (types[attr.red] == "uchar") {
+            attr.color = Attributes::Color::Byte;
+        }
+        else if (types[attr.red] == "float") {
+            attr.color = Attributes::Color::Float;
         }
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(
-                    static_cast<float>(r) / 255.0F,
-                    static_cast<float>(g) / 255.0F,
-                    static_cast<float>(b) / 255.0F,
-                    static_cast<float>(a) / 255.0F
-                );
-            }
+    // the points are decoded chunk by chunk straight into the output
+    ChunkWriter writer(points.getBasicPoints(), normals, intensity, colors, voxelSize);
+    if (attr.hasPoints()) {
+        writer.reserve(numPoints, attr.hasNormals(), attr.hasIntensity(), attr.hasColors());
+    }
+
+    if (format == "ascii") {
+        readAsciiRecords(inp, offset, numPoints, fields.size(), attr, writer);
+    }
+    else if (format == "binary_little_endian" || format == "binary_big_endian") {
+        std::vector<FieldType> fieldTypes;
+        for (std::size_t j = 0; j < types.size(); j++) {
+            fieldTypes.push_back(plyFieldType(types[j], sizes[j]));
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(r, g, b, a);
-            }
+
+        std::streambuf* buf = inp.rdbuf();
+        if (buf) {
+            buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
         }
+        bool swapByteOrder = isSwapNeeded(format == "binary_big_endian");
+        readBinaryRecords(inp, numPoints, fieldTypes, swapByteOrder, attr, writer);
     }
+
+    this->width = static_cast<int>(voxelSize > 0 ? points.size() : numPoints);
+    this->height = 1;
 }
 
 std::size_t PlyReader::readHeader(
@@ -902,138 +1367,6 @@ std::size_t PlyReader::readHeader(
     return numPoints;
 }
 
-void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = Eigen::Index(data.rows());
-    Eigen::Index numFields = Eigen::Index(data.cols());
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        if (offset > 0) {
-            offset--;
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PlyReader::readBinary(
-    bool swapByteOrder,
-    std::istream& inp,
-    std::size_t offset,
-    const std::vector<std::string>& types,
-    const std::vector<int>& sizes,
-    Eigen::MatrixXd& data
-)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        const std::string& t = types[j];
-        switch (sizes[j]) {
-            case 1:
-                if (t == "char" || t == "int8") {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == "uchar" || t == "uint8") {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == "short" || t == "int16") {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == "ushort" || t == "uint16") {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == "int" || t == "int32") {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == "uint" || t == "uint32") {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == "float" || t == "float32") {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == "double" || t == "float64") {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(static_cast<std::streamoff>(offset), std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    str.setByteOrder(swapByteOrder ? Base::Stream::BigEndian : Base::Stream::LittleEndian);
-    for (Eigen::Index i = 0; i < numPoints; i++) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            double value = converters[j]->toDouble(str);
-            data(i, j) = value;
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 PcdReader::PcdReader() = default;
@@ -1051,14 +1384,37 @@ void PcdReader::read(const std::string& filename)
     std::vector<std::string> fields;
     std::vector<std::string> types;
     std::vector<int> sizes;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
+    std::size_t numPoints = readHeader(inp, format, fields, types, sizes);
+
+    Attributes attr(fields);
+    attr.rgba = findField(fields, {"rgb", "rgba"});
+    if (attr.rgba != NoField) {
+        if (types[attr.rgba] == "U") {
+            attr.color = Attributes::Color::PackedInt;
+        }
+        else if (types[attr.rgba] == "F") {
+            attr.color = Attributes::Color::PackedFloat;
+        }
+    }
+
+    // the points are decoded chunk by chunk straight into the output
+    ChunkWriter writer(points.getBasicPoints(), normals, intensity, colors, voxelSize);
+    if (attr.hasPoints()) {
+        writer.reserve(numPoints, attr.hasNormals(), attr.hasIntensity(), attr.hasColors());
+    }
+
+    std::vector<FieldType> fieldTypes;
+    if (format != "ascii") {
+        for (std::size_t j = 0; j < types.size(); j++) {
+            fieldTypes.push_back(pcdFieldType(types[j], sizes[j]));
+        }
+    }
 
-    Eigen::MatrixXd data(numPoints, fields.size());
     if (format == "ascii") {
-        readAscii(inp, data);
+        readAsciiRecords(inp, 0, numPoints, fields.size(), attr, writer);
     }
     else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+        readBinaryRecords(inp, numPoints, fieldTypes, isSwapNeeded(false), attr, writer);
     }
     else if (format == "binary_compressed") {
         unsigned int c {};
@@ -1069,136 +1425,30 @@ void PcdReader::read(const std::string& filename)
         std::vector<char> compressed(c);
         inp.read(compressed.data(), c);
         std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
+        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) != u) {
             throw Base::BadFormatError("Failed to decompress binary data");
         }
-    }
-
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
-
-    // x field
-    Eigen::Index x = max_size;
-    it = std::ranges::find(fields, "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
-    }
-
-    // y field
-    Eigen::Index y = max_size;
-    it = std::ranges::find(fields, "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
-    }
-
-    // z field
-    Eigen::Index z = max_size;
-    it = std::ranges::find(fields, "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
-    }
-
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::ranges::find(fields, "normal_x");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nx");
-    }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
-    }
-
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::ranges::find(fields, "normal_y");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "ny");
-    }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
-    }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::ranges::find(fields, "normal_z");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "nz");
-    }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
-    }
-
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::ranges::find(fields, "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
-    }
-
-    // rgb(a) field
-    Eigen::Index rgba = max_size;
-    it = std::ranges::find(fields, "rgb");
-    if (it == fields.end()) {
-        it = std::ranges::find(fields, "rgba");
-    }
-    if (it != fields.end()) {
-        rgba = std::distance(fields.begin(), it);
-    }
-
-    // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (rgba != max_size);
-
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
-    }
+        compressed.clear();
+        compressed.shrink_to_fit();
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
+        if (recordSizeOf(fieldTypes) * numPoints > uncompressed.size()) {
+            throw Base::BadFormatError("File expects too many elements");
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
+        // the compressed data is stored field by field
+        RecordDecoder decoder(makeColumnLayout(fieldTypes, numPoints), isSwapNeeded(false), attr);
+        Chunk chunk;
+        for (std::size_t row = 0; row < numPoints; row += ChunkSize) {
+            std::size_t count = std::min(ChunkSize, numPoints - row);
+            decoder.decode(uncompressed.data(), row, count, chunk);
+            writer.append(chunk);
         }
     }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
-        }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
-        }
+    // a downsampled cloud has lost its structure
+    if (voxelSize > 0) {
+        this->width = static_cast<int>(points.size());
+        this->height = 1;
     }
 }
 
@@ -1275,141 +1525,6 @@ std::size_t PcdReader::readHeader(
     return points;
 }
 
-void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
-{
-    std::string line;
-    Eigen::Index row = 0;
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-    std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
-        if (line.empty()) {
-            continue;
-        }
-
-        // since the file is loaded in binary mode we may get the CR at the end
-        boost::trim(line);
-        boost::split(list, line, boost::is_any_of("\t\r "), boost::token_compress_on);
-
-        std::istringstream str(line);
-
-        Eigen::Index size = Eigen::Index(list.size());
-        for (Eigen::Index col = 0; col < size && col < numFields; col++) {
-            double value = boost::lexical_cast<double>(list[col]);
-            data(row, col) = value;
-        }
-
-        ++row;
-    }
-}
-
-void PcdReader::readBinary(
-    bool transpose,
-    std::istream& inp,
-    const std::vector<std::string>& types,
-    const std::vector<int>& sizes,
-    Eigen::MatrixXd& data
-)
-{
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        char t = types[j][0];
-        switch (sizes[j]) {
-            case 1:
-                if (t == 'I') {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == 'I') {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == 'I') {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == 'F') {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == 'F') {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
-        }
-
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
-            throw Base::BadFormatError("File expects too many elements");
-        }
-    }
-
-    Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
-    }
-}
-
 // ----------------------------------------------------------------------------
 
 namespace
@@ -1417,11 +1532,18 @@ namespace
 class E57ReaderImp
 {
 public:
-    E57ReaderImp(const std::string& filename, bool color, bool state, double distance)
+    E57ReaderImp(
+        const std::string& filename,
+        bool color,
+        bool state,
+        double distance,
+        ChunkWriter& writer
+    )
         : imfi(filename, "r")
         , useColor {color}
         , checkState {state}
         , minDistance {distance}
+        , writer {writer}
     {}
 
     void read()
@@ -1433,26 +1555,6 @@ public:
         }
     }
 
-    std::vector<Base::Color> getColors() const
-    {
-        return colors;
-    }
-
-    std::vector<float> getItensity() const
-    {
-        return intensity;
-    }
-
-    const PointKernel& getPoints() const
-    {
-        return points;
-    }
-
-    const std::vector<Base::Vector3f>& getNormals() const
-    {
-        return normals;
-    }
-
 private:
     void readData3D(const e57::VectorNode& data3D)
     {
@@ -1733,7 +1835,12 @@ private:
         bool hasState = proto.inv_state && checkState;
         bool filter = false;
 
+        // the records are handed over block by block, so only one block is held in between
+        Chunk chunk;
+        auto numRecords = static_cast<std::size_t>(cvn.childCount());
+        writer.reserve(numRecords, hasNormal, hasItensity, hasColor);
         while ((count = cvr.read())) {
+            chunk.clear();
             for (size_t i = 0; i < count; ++i) {
                 filter = false;
                 if (hasState) {
@@ -1751,19 +1858,22 @@ private:
                 }
                 if (!filter) {
                     cnt_pts++;
-                    points.push_back(pt);
+                    chunk.points.push_back(Base::toVector<float>(pt));
                     last = pt;
                     if (hasColor) {
-                        colors.push_back(getColor(proto, i));
+                        chunk.colors.push_back(getColor(proto, i));
                     }
                     if (hasItensity) {
-                        intensity.push_back(proto.intensity[i]);
+                        chunk.intensity.push_back(static_cast<float>(proto.intensity[i]));
                     }
                     if (hasNormal) {
-                        normals.push_back(getNormal(proto, i, hasPlacement, plm.getRotation()));
+                        chunk.normals.push_back(
+                            getNormal(proto, i, hasPlacement, plm.getRotation())
+                        );
                     }
                 }
             }
+            writer.append(chunk);
         }
     }
 
@@ -1864,11 +1974,8 @@ private:
     bool useColor;
     bool checkState;
     double minDistance;
-    const size_t buf_size = 1024;
-    std::vector<Base::Color> colors;
-    std::vector<float> intensity;
-    PointKernel points;
-    std::vector<Base::Vector3f> normals;
+    const size_t buf_size = ChunkSize;
+    ChunkWriter& writer;
 };
 }  // namespace
 
@@ -1880,13 +1987,11 @@ E57Reader::E57Reader(bool Color, bool State, double Distance)
 
 void E57Reader::read(const std::string& filename)
 {
+    clear();
     try {
-        E57ReaderImp reader(filename, useColor, checkState, minDistance);
+        ChunkWriter writer(points.getBasicPoints(), normals, intensity, colors, voxelSize);
+        E57ReaderImp reader(filename, useColor, checkState, minDistance, writer);
         reader.read();
-        points = reader.getPoints();
-        normals = reader.getNormals();
-        colors = reader.getColors();
-        intensity = reader.getItensity();
         width = points.size();
         height = 1;
     }
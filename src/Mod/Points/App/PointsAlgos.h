@@ -24,8 +24,6 @@
 
 #pragma once
 
-#include <Eigen/Core>
-
 #include "Points.h"
 #include "Properties.h"
 
@@ -66,6 +64,21 @@ public:
     int getWidth() const;
     int getHeight() const;
 
+    /** Keeps only the first point that falls into each cube of edge length \a size while the
+     * file is read. A size of zero, the default, keeps all points. */
+    void setVoxelSize(double size);
+    double getVoxelSize() const;
+
+    /** @name Taking over the data
+     * Moves the data out of the reader instead of copying it, afterwards the reader is empty.
+     */
+    //@{
+    PointKernel takePoints();
+    std::vector<float> takeIntensities();
+    std::vector<Base::Color> takeColors();
+    std::vector<Base::Vector3f> takeNormals();
+    //@}
+
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
     Reader& operator=(const Reader&) = delete;
@@ -79,6 +92,7 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    double voxelSize {0.0};
     // NOLINTEND
 };
 
@@ -104,15 +118,6 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, std::size_t offset, Eigen::MatrixXd& data);
-    void readBinary(
-        bool swapByteOrder,
-        std::istream&,
-        std::size_t offset,
-        const std::vector<std::string>& types,
-        const std::vector<int>& sizes,
-        Eigen::MatrixXd& data
-    );
 };
 
 class PointsExport PcdReader: public Reader
@@ -129,14 +134,6 @@ private:
         std::vector<std::string>& types,
         std::vector<int>& sizes
     );
-    void readAscii(std::istream&, Eigen::MatrixXd& data);
-    void readBinary(
-        bool transpose,
-        std::istream&,
-        const std::vector<std::string>& types,
-        const std::vector<int>& sizes,
-        Eigen::MatrixXd& data
-    );
 };
 
 class PointsExport E57Reader: public Reader
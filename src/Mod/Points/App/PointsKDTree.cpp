@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <thread>
+#include <utility>
+
+#include <Base/BoundBox.h>
+#include <Base/Converter.h>
+
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// the number of points up to which a node becomes a leaf
+constexpr std::size_t LeafSize = 8;
+// the minimum number of points a thread builds a subtree for
+constexpr std::size_t MinPointsPerThread = 50000;
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+
+// Vector3::operator[] is not inlined, which matters in the inner loops
+float coordinate(const Base::Vector3f& pnt, unsigned short axis)
+{
+    return axis == 0 ? pnt.x : (axis == 1 ? pnt.y : pnt.z);
+}
+
+unsigned int countThreads(std::size_t count)
+{
+    std::size_t threads = std::min<std::size_t>(
+        std::thread::hardware_concurrency(),
+        count / MinPointsPerThread
+    );
+    return static_cast<unsigned int>(std::max<std::size_t>(threads, 1));
+}
+}  // namespace
+
+PointsKDTree::PointsKDTree(const std::vector<Base::Vector3f>& points)
+{
+    _entries.reserve(points.size());
+    for (std::size_t index = 0; index < points.size(); index++) {
+        if (isValid(points[index])) {
+            _entries.push_back({points[index], index});
+        }
+    }
+
+    build();
+}
+
+PointsKDTree::PointsKDTree(const std::vector<Base::Vector3f>& points, const Base::Matrix4D& mat)
+{
+    _entries.reserve(points.size());
+    for (std::size_t index = 0; index < points.size(); index++) {
+        if (isValid(points[index])) {
+            Base::Vector3d pnt = mat * Base::toVector<double>(points[index]);
+            _entries.push_back({Base::toVector<float>(pnt), index});
+        }
+    }
+
+    build();
+}
+
+void PointsKDTree::build()
+{
+    // A node is split at the middle of its range, so the right child is never smaller than the
+    // left one and the deepest inner node is found by following the right children
+    std::size_t depth = 0;
+    for (std::size_t count = _entries.size(); count > LeafSize; count -= count / 2) {
+        depth++;
+    }
+
+    _splits.resize((std::size_t(1) << depth) - 1);
+    build(0, 0, _entries.size(), countThreads(_entries.size()));
+}
+
+void PointsKDTree::build(std::size_t node, std::size_t begin, std::size_t end, unsigned int threads)
+{
+    if (end - begin <= LeafSize) {
+        return;
+    }
+
+    // split at the median along the axis with the largest extent
+    Base::BoundBox3f box;
+    for (std::size_t index = begin; index < end; index++) {
+        box.Add(_entries[index].point);
+    }
+
+    unsigned short axis = 0;
+    if (box.LengthY() > box.LengthX() && box.LengthY() >= box.LengthZ()) {
+        axis = 1;
+    }
+    else if (box.LengthZ() > box.LengthX() && box.LengthZ() > box.LengthY()) {
+        axis = 2;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    auto first = _entries.begin();
+    std::nth_element(
+        first + static_cast<std::ptrdiff_t>(begin),
+        first + static_cast<std::ptrdiff_t>(mid),
+        first + static_cast<std::ptrdiff_t>(end),
+        [axis](const Entry& lhs, const Entry& rhs) {
+            return coordinate(lhs.point, axis) < coordinate(rhs.point, axis);
+        }
+    );
+    _splits[node] = {coordinate(_entries[mid].point, axis), axis};
+
+    // the subtrees cover disjoint ranges, so they can be built at the same time
+    if (threads > 1) {
+        std::thread left([&]() { build(2 * node + 1, begin, mid, threads / 2); });
+        build(2 * node + 2, mid, end, threads - threads / 2);
+        left.join();
+    }
+    else {
+        build(2 * node + 1, begin, mid, 1);
+        build(2 * node + 2, mid, end, 1);
+    }
+}
+
+template<typename Visitor>
+void PointsKDTree::visit(
+    std::size_t node,
+    std::size_t begin,
+    std::size_t end,
+    const Base::Vector3f& pnt,
+    float& maxDist2,
+    Visitor& visitor
+) const
+{
+    if (end - begin <= LeafSize) {
+        for (std::size_t index = begin; index < end; index++) {
+            float dist2 = Base::DistanceP2(pnt, _entries[index].point);
+            if (dist2 <= maxDist2) {
+                visitor(_entries[index].index, dist2);
+            }
+        }
+        return;
+    }
+
+    // visit the side of the split plane with the point first, the other side can only hold
+    // points within the search distance if the plane itself is close enough
+    const Split& split = _splits[node];
+    std::size_t mid = begin + (end - begin) / 2;
+    float diff = coordinate(pnt, split.axis) - split.value;
+    if (diff < 0) {
+        visit(2 * node + 1, begin, mid, pnt, maxDist2, visitor);
+        if (diff * diff <= maxDist2) {
+            visit(2 * node + 2, mid, end, pnt, maxDist2, visitor);
+        }
+    }
+    else {
+        visit(2 * node + 2, mid, end, pnt, maxDist2, visitor);
+        if (diff * diff <= maxDist2) {
+            visit(2 * node + 1, begin, mid, pnt, maxDist2, visitor);
+        }
+    }
+}
+
+std::size_t PointsKDTree::findNearest(const Base::Vector3f& pnt, float maxDist) const
+{
+    std::size_t nearest = npos;
+    if (_entries.empty()) {
+        return nearest;
+    }
+
+    float maxDist2 = maxDist < std::sqrt(std::numeric_limits<float>::max())
+        ? maxDist * maxDist
+        : std::numeric_limits<float>::max();
+    float minDist2 = maxDist2;
+    auto visitor = [&](std::size_t index, float dist2) {
+        if (dist2 < minDist2 || (dist2 == minDist2 && nearest != npos && index < nearest)) {
+            nearest = index;
+            minDist2 = dist2;
+            maxDist2 = dist2;
+        }
+    };
+    visit(0, 0, _entries.size(), pnt, maxDist2, visitor);
+    return nearest;
+}
+
+std::vector<std::size_t> PointsKDTree::findKNearest(const Base::Vector3f& pnt, std::size_t k) const
+{
+    std::vector<std::size_t> result;
+    if (_entries.empty() || k == 0) {
+        return result;
+    }
+
+    // max-heap of the k nearest points found so far, ties are resolved by the index
+    using Candidate = std::pair<float, std::size_t>;
+    std::priority_queue<Candidate> heap;
+    float maxDist2 = std::numeric_limits<float>::max();
+    auto visitor = [&](std::size_t index, float dist2) {
+        Candidate candidate(dist2, index);
+        if (heap.size() < k) {
+            heap.push(candidate);
+        }
+        else if (candidate < heap.top()) {
+            heap.pop();
+            heap.push(candidate);
+        }
+        else {
+            return;
+        }
+
+        if (heap.size() == k) {
+            maxDist2 = heap.top().first;
+        }
+    };
+    visit(0, 0, _entries.size(), pnt, maxDist2, visitor);
+
+    result.resize(heap.size());
+    for (auto it = result.rbegin(); it != result.rend(); ++it) {
+        *it = heap.top().second;
+        heap.pop();
+    }
+    return result;
+}
+
+std::vector<std::size_t> PointsKDTree::findInRadius(const Base::Vector3f& pnt, float radius) const
+{
+    std::vector<std::size_t> result;
+    if (_entries.empty() || radius < 0) {
+        return result;
+    }
+
+    float maxDist2 = radius * radius;
+    auto visitor = [&result](std::size_t index, float) {
+        result.push_back(index);
+    };
+    visit(0, 0, _entries.size(), pnt, maxDist2, visitor);
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
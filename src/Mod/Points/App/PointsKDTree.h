@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <Base/Matrix.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+
+/**
+ * The PointsKDTree is a static kd-tree over a point cloud. Other than the PointsGrid it adapts
+ * to the density of the points, so it works equally well for clouds with dense and sparse regions.
+ *
+ * The points are copied into a flat array that is reordered so that every node of the tree covers
+ * a contiguous range of it. The tree is balanced and stored in heap order, so apart from the split
+ * planes there are no nodes to allocate. Points with NaN coordinates are left out, the queries
+ * return the indices of the points in the array the tree was built from.
+ */
+class PointsExport PointsKDTree
+{
+public:
+    /// Returned by findNearest() if no point was found
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /** @name Construction */
+    //@{
+    PointsKDTree() = default;
+    /// Builds the tree over \a points
+    explicit PointsKDTree(const std::vector<Base::Vector3f>& points);
+    /// Builds the tree over \a points transformed by \a mat
+    PointsKDTree(const std::vector<Base::Vector3f>& points, const Base::Matrix4D& mat);
+    //@}
+
+    /// Returns the number of points in the tree
+    std::size_t size() const
+    {
+        return _entries.size();
+    }
+    bool empty() const
+    {
+        return _entries.empty();
+    }
+
+    /** @name Queries */
+    //@{
+    /**
+     * Returns the index of the point nearest to \a pnt that is closer than \a maxDist, or npos if
+     * there is no such point.
+     */
+    std::size_t findNearest(
+        const Base::Vector3f& pnt,
+        float maxDist = std::numeric_limits<float>::max()
+    ) const;
+    /**
+     * Returns the indices of the \a k points nearest to \a pnt ordered by increasing distance.
+     * Less than \a k indices are returned if the tree has less points.
+     */
+    std::vector<std::size_t> findKNearest(const Base::Vector3f& pnt, std::size_t k) const;
+    /**
+     * Returns the indices of all points within the distance \a radius of \a pnt in ascending order.
+     */
+    std::vector<std::size_t> findInRadius(const Base::Vector3f& pnt, float radius) const;
+    //@}
+
+private:
+    struct Entry
+    {
+        Base::Vector3f point;
+        std::size_t index;
+    };
+    struct Split
+    {
+        float value;
+        unsigned short axis;
+    };
+
+    void build();
+    void build(std::size_t node, std::size_t begin, std::size_t end, unsigned int threads);
+    template<typename Visitor>
+    void visit(
+        std::size_t node,
+        std::size_t begin,
+        std::size_t end,
+        const Base::Vector3f& pnt,
+        float& maxDist2,
+        Visitor& visitor
+    ) const;
+
+private:
+    std::vector<Entry> _entries;
+    std::vector<Split> _splits;
+};
+
+}  // namespace Points
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <unordered_set>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// the depth at which coincident points end up in one leaf
+constexpr int MaxDepth = 21;
+// the number of levels of detail at which the remaining points form the last level
+constexpr int MaxLevels = 10;
+
+bool isValid(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+
+// Returns the cell of a regular grid with 2^level cells per axis over box that contains pnt
+uint32_t gridCell(const Base::BoundBox3f& box, const Base::Vector3f& pnt, int level)
+{
+    const auto cells = static_cast<uint32_t>(1) << level;
+    auto cell = [cells](float value, float min, float len) {
+        if (len <= 0) {
+            return uint32_t(0);
+        }
+        auto index = static_cast<uint32_t>((value - min) / len * static_cast<float>(cells));
+        return std::min(index, cells - 1);
+    };
+
+    uint32_t x = cell(pnt.x, box.MinX, box.LengthX());
+    uint32_t y = cell(pnt.y, box.MinY, box.LengthY());
+    uint32_t z = cell(pnt.z, box.MinZ, box.LengthZ());
+    return (x << (2 * MaxLevels)) | (y << MaxLevels) | z;
+}
+}  // namespace
+
+PointsOctree::PointsOctree(const std::vector<Base::Vector3f>& points, std::size_t maxLeafSize)
+{
+    Base::BoundBox3f box;
+    _indices.reserve(points.size());
+    for (std::size_t index = 0; index < points.size(); index++) {
+        if (isValid(points[index])) {
+            _indices.push_back(static_cast<int32_t>(index));
+            box.Add(points[index]);
+        }
+    }
+
+    if (_indices.empty()) {
+        return;
+    }
+
+    split(points, std::max<std::size_t>(maxLeafSize, 1), 0, _indices.size(), box, 0);
+
+    // the leaves cover disjoint ranges of the indices, so they can be ordered at the same time
+    QtConcurrent::blockingMap(_leaves, [this, &points](Leaf& leaf) { order(points, leaf); });
+}
+
+void PointsOctree::split(
+    const std::vector<Base::Vector3f>& points,
+    std::size_t maxLeafSize,
+    std::size_t begin,
+    std::size_t end,
+    const Base::BoundBox3f& box,
+    int depth
+)
+{
+    if (end - begin <= maxLeafSize || depth == MaxDepth) {
+        Leaf leaf;
+        leaf.begin = begin;
+        leaf.end = end;
+        for (std::size_t index = begin; index < end; index++) {
+            leaf.box.Add(points[_indices[index]]);
+        }
+        _leaves.push_back(leaf);
+        return;
+    }
+
+    // sort the points into the octants around the center of the box
+    Base::Vector3f center = box.GetCenter();
+    auto first = _indices.begin() + static_cast<std::ptrdiff_t>(begin);
+    auto last = _indices.begin() + static_cast<std::ptrdiff_t>(end);
+    auto midX = std::partition(first, last, [&](int32_t index) {
+        return points[index].x < center.x;
+    });
+    std::array<decltype(first), 9> bounds;
+    bounds[0] = first;
+    bounds[4] = midX;
+    bounds[8] = last;
+    for (int half = 0; half < 8; half += 4) {
+        auto lowerY = [&](int32_t index) {
+            return points[index].y < center.y;
+        };
+        bounds[half + 2] = std::partition(bounds[half], bounds[half + 4], lowerY);
+        for (int quarter = half; quarter < half + 4; quarter += 2) {
+            auto lowerZ = [&](int32_t index) {
+                return points[index].z < center.z;
+            };
+            bounds[quarter + 1] = std::partition(bounds[quarter], bounds[quarter + 2], lowerZ);
+        }
+    }
+
+    for (int octant = 0; octant < 8; octant++) {
+        auto childBegin = static_cast<std::size_t>(bounds[octant] - _indices.begin());
+        auto childEnd = static_cast<std::size_t>(bounds[octant + 1] - _indices.begin());
+        if (childBegin == childEnd) {
+            continue;
+        }
+
+        Base::BoundBox3f child = box;
+        (octant & 4 ? child.MinX : child.MaxX) = center.x;
+        (octant & 2 ? child.MinY : child.MaxY) = center.y;
+        (octant & 1 ? child.MinZ : child.MaxZ) = center.z;
+        split(points, maxLeafSize, childBegin, childEnd, child, depth + 1);
+    }
+}
+
+void PointsOctree::order(const std::vector<Base::Vector3f>& points, Leaf& leaf)
+{
+    std::vector<int32_t> taken;
+    taken.reserve(leaf.end - leaf.begin);
+    std::vector<int32_t> remaining(
+        _indices.begin() + static_cast<std::ptrdiff_t>(leaf.begin),
+        _indices.begin() + static_cast<std::ptrdiff_t>(leaf.end)
+    );
+    std::vector<int32_t> next;
+    std::unordered_set<uint32_t> cells;
+
+    // each level takes one point of every grid cell that is still empty
+    for (int level = 0; level < MaxLevels && !remaining.empty(); level++) {
+        cells.clear();
+        for (int32_t index : taken) {
+            cells.insert(gridCell(leaf.box, points[index], level));
+        }
+
+        next.clear();
+        for (int32_t index : remaining) {
+            if (cells.insert(gridCell(leaf.box, points[index], level)).second) {
+                taken.push_back(index);
+            }
+            else {
+                next.push_back(index);
+            }
+        }
+
+        if (leaf.levels.empty() || leaf.levels.back() != taken.size()) {
+            leaf.levels.push_back(taken.size());
+        }
+        remaining.swap(next);
+    }
+
+    if (!remaining.empty()) {
+        taken.insert(taken.end(), remaining.begin(), remaining.end());
+        leaf.levels.push_back(taken.size());
+    }
+
+    auto first = _indices.begin() + static_cast<std::ptrdiff_t>(leaf.begin);
+    std::copy(taken.begin(), taken.end(), first);
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include <Mod/Points/PointsGlobal.h>
+
+namespace Points
+{
+
+/**
+ * The PointsOctree splits a point cloud into the leaves of an octree to render it with several
+ * levels of detail.
+ *
+ * The points of a leaf are ordered from coarse to fine: each level adds the points that occupy
+ * cells of a grid over the leaf that is twice as fine as the grid of the level before. So any
+ * level is an evenly spread subsample of the leaf and a level is drawn by drawing a prefix of the
+ * leaf's indices. Points with NaN coordinates are left out.
+ */
+class PointsExport PointsOctree
+{
+public:
+    /// The maximum number of points of a leaf if not specified otherwise
+    static constexpr std::size_t DefaultLeafSize = 65536;
+
+    struct Leaf
+    {
+        Base::BoundBox3f box;
+        /// The range of the leaf's points in getIndices()
+        std::size_t begin {0};
+        std::size_t end {0};
+        /// The number of points up to each level of detail, the last one is the whole leaf
+        std::vector<std::size_t> levels;
+    };
+
+    /** @name Construction */
+    //@{
+    PointsOctree() = default;
+    /// Builds the octree over \a points with at most \a maxLeafSize points per leaf
+    explicit PointsOctree(
+        const std::vector<Base::Vector3f>& points,
+        std::size_t maxLeafSize = DefaultLeafSize
+    );
+    //@}
+
+    const std::vector<Leaf>& getLeaves() const
+    {
+        return _leaves;
+    }
+    /// Returns the indices of the points grouped by leaves
+    const std::vector<int32_t>& getIndices() const
+    {
+        return _indices;
+    }
+
+private:
+    void split(
+        const std::vector<Base::Vector3f>& points,
+        std::size_t maxLeafSize,
+        std::size_t begin,
+        std::size_t end,
+        const Base::BoundBox3f& box,
+        int depth
+    );
+    void order(const std::vector<Base::Vector3f>& points, Leaf& leaf);
+
+private:
+    std::vector<Leaf> _leaves;
+    std::vector<int32_t> _indices;
+};
+
+}  // namespace Points
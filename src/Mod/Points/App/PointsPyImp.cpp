@@ -31,6 +31,7 @@
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "PointsKDTree.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -244,11 +245,92 @@ PyObject* PointsPy::fromValid(PyObject* args) const
     }
 }
 
+PyObject* PointsPy::nearest(PyObject* args) const
+{
+    PyObject* obj {};
+    unsigned long count = 1;
+    if (!PyArg_ParseTuple(args, "O!|k", &(Base::VectorPy::Type), &obj, &count)) {
+        return nullptr;
+    }
+
+    Base::Vector3d pnt = *static_cast<Base::VectorPy*>(obj)->getVectorPtr();
+    std::shared_ptr<const PointsKDTree> tree = getPointKernelPtr()->getKDTree();
+    std::vector<std::size_t> indices = tree->findKNearest(Base::toVector<float>(pnt), count);
+
+    Py::List list;
+    for (std::size_t index : indices) {
+        list.append(Py::Long(static_cast<unsigned long>(index)));
+    }
+    return Py::new_reference_to(list);
+}
+
+PyObject* PointsPy::radiusSearch(PyObject* args) const
+{
+    PyObject* obj {};
+    double radius {};
+    if (!PyArg_ParseTuple(args, "O!d", &(Base::VectorPy::Type), &obj, &radius)) {
+        return nullptr;
+    }
+
+    Base::Vector3d pnt = *static_cast<Base::VectorPy*>(obj)->getVectorPtr();
+    std::shared_ptr<const PointsKDTree> tree = getPointKernelPtr()->getKDTree();
+    std::vector<std::size_t> indices
+        = tree->findInRadius(Base::toVector<float>(pnt), static_cast<float>(radius));
+
+    Py::List list;
+    for (std::size_t index : indices) {
+        list.append(Py::Long(static_cast<unsigned long>(index)));
+    }
+    return Py::new_reference_to(list);
+}
+
 Py::Long PointsPy::getCountPoints() const
 {
     return Py::Long((long)getPointKernelPtr()->size());
 }
 
+PyObject* PointsPy::getPointArray(PyObject* args) const
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const PointKernel* points = getPointKernelPtr();
+    std::vector<double> values;
+    values.reserve(3 * points->size());
+    for (const auto& point : *points) {
+        values.push_back(point.x);
+        values.push_back(point.y);
+        values.push_back(point.z);
+    }
+    return Base::createBufferFromValues(values, 3);
+}
+
+PyObject* PointsPy::setPointArray(PyObject* args)
+{
+    PyObject* obj {};
+    if (!PyArg_ParseTuple(args, "O", &obj)) {
+        return nullptr;
+    }
+
+    std::vector<double> values;
+    if (!Base::getValuesFromBuffer(obj, values) || values.size() % 3 != 0) {
+        PyErr_SetString(PyExc_TypeError, "expect an n x 3 buffer of floats or doubles");
+        return nullptr;
+    }
+
+    PointKernel* points = getPointKernelPtr();
+    points->resize(values.size() / 3);
+    for (std::size_t i = 0; i < points->size(); i++) {
+        points->setPoint(
+            static_cast<int>(i),
+            Base::Vector3d(values[3 * i], values[3 * i + 1], values[3 * i + 2])
+        );
+    }
+
+    Py_Return;
+}
+
 Py::List PointsPy::getPoints() const
 {
     Py::List PointList;
@@ -78,6 +78,13 @@ void PropertyGreyValueList::setValues(const std::vector<float>& values)
     hasSetValue();
 }
 
+void PropertyGreyValueList::setValues(std::vector<float>&& values)
+{
+    aboutToSetValue();
+    _lValueList = std::move(values);
+    hasSetValue();
+}
+
 PyObject* PropertyGreyValueList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
@@ -254,6 +261,13 @@ void PropertyNormalList::setValues(const std::vector<Base::Vector3f>& values)
     hasSetValue();
 }
 
+void PropertyNormalList::setValues(std::vector<Base::Vector3f>&& values)
+{
+    aboutToSetValue();
+    _lValueList = std::move(values);
+    hasSetValue();
+}
+
 PyObject* PropertyNormalList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
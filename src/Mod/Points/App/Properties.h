@@ -72,6 +72,7 @@ public:
         _lValueList[idx] = value;
     }
     void setValues(const std::vector<float>& values);
+    void setValues(std::vector<float>&& values);
 
     const std::vector<float>& getValues() const
     {
@@ -124,6 +125,7 @@ public:
     }
 
     void setValues(const std::vector<Base::Vector3f>& values);
+    void setValues(std::vector<Base::Vector3f>&& values);
 
     const std::vector<Base::Vector3f>& getValues() const
     {
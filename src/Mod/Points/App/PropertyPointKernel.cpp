@@ -43,13 +43,37 @@ PropertyPointKernel::PropertyPointKernel()
     : _cPoints(new PointKernel())
 {}
 
+void PropertyPointKernel::detachPoints(bool copyContent)
+{
+    if (_cPoints.getRefCount() <= 1) {
+        return;
+    }
+    if (copyContent) {
+        _cPoints = new PointKernel(*_cPoints);
+    }
+    else {
+        Base::Matrix4D mat = _cPoints->getTransform();
+        _cPoints = new PointKernel();
+        _cPoints->setTransform(mat);
+    }
+}
+
 void PropertyPointKernel::setValue(const PointKernel& m)
 {
     aboutToSetValue();
+    detachPoints(false);
     *_cPoints = m;
     hasSetValue();
 }
 
+void PropertyPointKernel::setValue(PointKernel&& m)
+{
+    aboutToSetValue();
+    detachPoints(false);
+    *_cPoints = std::move(m);
+    hasSetValue();
+}
+
 const PointKernel& PropertyPointKernel::getValue() const
 {
     return *_cPoints;
@@ -62,6 +86,10 @@ const Data::ComplexGeoData* PropertyPointKernel::getComplexData() const
 
 void PropertyPointKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    if (_cPoints->getTransform() == rclTrf) {
+        return;
+    }
+    detachPoints(true);
     _cPoints->setTransform(rclTrf);
 }
 
@@ -115,6 +143,7 @@ void PropertyPointKernel::Restore(Base::XMLReader& reader)
         mtrx.fromString(Matrix);
 
         aboutToSetValue();
+        detachPoints(true);
         _cPoints->setTransform(mtrx);
         hasSetValue();
     }
@@ -129,22 +158,25 @@ void PropertyPointKernel::SaveDocFile(Base::Writer& writer) const
 void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
 {
     aboutToSetValue();
+    detachPoints(false);
     _cPoints->RestoreDocFile(reader);
     hasSetValue();
 }
 
 App::Property* PropertyPointKernel::Copy() const
 {
+    // the points are copied on the first modification
     PropertyPointKernel* prop = new PropertyPointKernel();
-    (*prop->_cPoints) = (*this->_cPoints);
+    prop->_cPoints = this->_cPoints;
     return prop;
 }
 
 void PropertyPointKernel::Paste(const App::Property& from)
 {
-    aboutToSetValue();
     const PropertyPointKernel& prop = dynamic_cast<const PropertyPointKernel&>(from);
-    *(this->_cPoints) = *(prop._cPoints);
+    Base::Reference<PointKernel> points(prop._cPoints);
+    aboutToSetValue();
+    _cPoints = points;
     hasSetValue();
 }
 
@@ -156,6 +188,7 @@ unsigned int PropertyPointKernel::getMemSize() const
 PointKernel* PropertyPointKernel::startEditing()
 {
     aboutToSetValue();
+    detachPoints(true);
     return static_cast<PointKernel*>(_cPoints);
 }
 
@@ -199,6 +232,7 @@ void PropertyPointKernel::removeIndices(const std::vector<unsigned long>& uIndic
 void PropertyPointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     aboutToSetValue();
+    detachPoints(true);
     _cPoints->transformGeometry(rclMat);
     hasSetValue();
 }
@@ -43,6 +43,8 @@ public:
     //@{
     /// Sets the points to the property
     void setValue(const PointKernel& m);
+    /// Takes over the points without copying them
+    void setValue(PointKernel&& m);
     /// get the points (only const possible!)
     const PointKernel& getValue() const;
     const Data::ComplexGeoData* getComplexData() const override;
@@ -65,10 +67,15 @@ public:
     /** @name Undo/Redo */
     //@{
     /// returns a new copy of the property (mainly for Undo/Redo and transactions)
+    /// The copy shares the points until one of them gets modified (copy-on-write).
     App::Property* Copy() const override;
     /// paste the value from the property (mainly for Undo/Redo and transactions)
     void Paste(const App::Property& from) override;
     unsigned int getMemSize() const override;
+    bool canSpillToFile() const override
+    {
+        return true;
+    }
     //@}
 
     /** @name Save/restore */
@@ -88,6 +95,10 @@ public:
     void removeIndices(const std::vector<unsigned long>&);
     //@}
 
+private:
+    /// Replaces shared points by a copy, or by empty points if \a copyContent is false
+    void detachPoints(bool copyContent);
+
 private:
     Base::Reference<PointKernel> _cPoints;
 };
@@ -31,11 +31,14 @@
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoIndexedPointSet.h>
+#include <Inventor/nodes/SoLevelOfDetail.h>
 #include <Inventor/nodes/SoMaterial.h>
 #include <Inventor/nodes/SoMaterialBinding.h>
 #include <Inventor/nodes/SoNormal.h>
 #include <Inventor/nodes/SoPointSet.h>
+#include <Inventor/nodes/SoSeparator.h>
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <Base/Vector3D.h>
 #include <Gui/Application.h>
@@ -43,6 +46,7 @@
 #include <Gui/Selection/SoFCSelection.h>
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/PointsOctree.h>
 #include <Mod/Points/App/Properties.h>
 
 #include "ViewProvider.h"
@@ -155,6 +159,19 @@ void ViewProviderPoints::setVertexNormalMode(Points::PropertyNormalList* pcPrope
     pcPointsNormal->vector.finishEditing();
 }
 
+void ViewProviderPoints::shareCoordinates(const Points::PointKernel& kernel)
+{
+    // The reference keeps the points alive and makes the property copy them before it modifies
+    // them the next time, so the coordinate node can read them without owning a copy
+    static_assert(sizeof(Points::PointKernel::value_type) == 3 * sizeof(float));
+    const std::vector<Points::PointKernel::value_type>& points = kernel.getBasicPoints();
+    sharedPoints = &kernel;
+    pcPointsCoord->point.setValuesPointer(
+        static_cast<int>(points.size()),
+        reinterpret_cast<const float*>(points.data())
+    );
+}
+
 void ViewProviderPoints::setDisplayMode(const char* ModeName)
 {
     int numPoints = pcPointsCoord->point.getNum();
@@ -374,11 +391,14 @@ ViewProviderScattered::ViewProviderScattered()
 {
     pcPoints = new SoPointSet();
     pcPoints->ref();
+    pcLevelOfDetail = new SoGroup();
+    pcLevelOfDetail->ref();
 }
 
 ViewProviderScattered::~ViewProviderScattered()
 {
     pcPoints->unref();
+    pcLevelOfDetail->unref();
 }
 
 void ViewProviderScattered::attach(App::DocumentObject* pcObj)
@@ -393,6 +413,7 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     // Highlight for selection
     pcHighlight->addChild(pcPointsCoord);
     pcHighlight->addChild(pcPoints);
+    pcHighlight->addChild(pcLevelOfDetail);
 
     std::vector<std::string> modes = getDisplayModes();
 
@@ -427,12 +448,36 @@ void ViewProviderScattered::attach(App::DocumentObject* pcObj)
     }
 }
 
+void ViewProviderScattered::onChanged(const App::Property* prop)
+{
+    ViewProviderPoints::onChanged(prop);
+    if (prop == &PointSize) {
+        updateScreenArea();
+    }
+}
+
 void ViewProviderScattered::updateData(const App::Property* prop)
 {
     ViewProviderPoints::updateData(prop);
     if (prop->is<Points::PropertyPointKernel>()) {
-        ViewProviderPointsBuilder builder;
-        builder.createPoints(prop, pcPointsCoord, pcPoints);
+        const Points::PointKernel& kernel
+            = static_cast<const Points::PropertyPointKernel*>(prop)->getValue();
+        shareCoordinates(kernel);
+
+        // big clouds are drawn by the leaves of an octree, each with several levels of detail
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Points"
+        );
+        long threshold = hGrp->GetInt("LevelOfDetailThreshold", 1000000);
+        if (threshold > 0 && kernel.size() >= static_cast<std::size_t>(threshold)) {
+            pcPoints->numPoints = 0;
+            buildLevelOfDetail(kernel);
+        }
+        else {
+            pcLevelOfDetail->removeAllChildren();
+            octree.reset();
+            pcPoints->numPoints = static_cast<int>(kernel.size());
+        }
 
         // The number of points might have changed, so force also a resize of the Inventor internals
         setActiveMode();
@@ -448,6 +493,53 @@ void ViewProviderScattered::updateData(const App::Property* prop)
     }
 }
 
+void ViewProviderScattered::buildLevelOfDetail(const Points::PointKernel& kernel)
+{
+    pcLevelOfDetail->removeAllChildren();
+    auto tree = std::make_shared<Points::PointsOctree>(kernel.getBasicPoints());
+
+    // all levels of a leaf share its indices, a level only draws a prefix of them
+    const std::vector<int32_t>& indices = tree->getIndices();
+    for (const auto& leaf : tree->getLeaves()) {
+        SoSeparator* sep = new SoSeparator();
+        sep->renderCulling = SoSeparator::ON;
+        SoLevelOfDetail* lod = new SoLevelOfDetail();
+        for (auto it = leaf.levels.rbegin(); it != leaf.levels.rend(); ++it) {
+            SoIndexedPointSet* level = new SoIndexedPointSet();
+            level->coordIndex.setValuesPointer(static_cast<int>(*it), &indices[leaf.begin]);
+            lod->addChild(level);
+        }
+        sep->addChild(lod);
+        pcLevelOfDetail->addChild(sep);
+    }
+
+    octree = tree;
+    updateScreenArea();
+}
+
+void ViewProviderScattered::updateScreenArea()
+{
+    if (!octree) {
+        return;
+    }
+
+    // A level is drawn once its points are about a point size apart on the screen. The levels of
+    // a leaf are ordered from the finest to the coarsest one.
+    float pixels = PointSize.getValue() * PointSize.getValue();
+    const std::vector<Points::PointsOctree::Leaf>& leaves = octree->getLeaves();
+    for (int i = 0; i < pcLevelOfDetail->getNumChildren(); i++) {
+        SoGroup* sep = static_cast<SoGroup*>(pcLevelOfDetail->getChild(i));
+        SoLevelOfDetail* lod = static_cast<SoLevelOfDetail*>(sep->getChild(0));
+        const std::vector<std::size_t>& levels = leaves[i].levels;
+        lod->screenArea.setNum(static_cast<int>(levels.size()) - 1);
+        float* area = lod->screenArea.startEditing();
+        for (std::size_t j = 0; j + 1 < levels.size(); j++) {
+            area[j] = static_cast<float>(levels[levels.size() - 1 - j]) * pixels;
+        }
+        lod->screenArea.finishEditing();
+    }
+}
+
 void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer)
 {
     // create the polygon from the picked points
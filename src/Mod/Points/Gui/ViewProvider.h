@@ -24,14 +24,17 @@
 
 #pragma once
 
+#include <memory>
 #include <Inventor/SbVec2f.h>
 
+#include <Base/Handle.h>
 #include <Gui/ViewProviderBuilder.h>
 #include <Gui/ViewProviderGeometryObject.h>
 #include <Gui/ViewProviderFeaturePython.h>
 #include <Mod/Points/PointsGlobal.h>
 
 
+class SoGroup;
 class SoSwitch;
 class SoPointSet;
 class SoIndexedPointSet;
@@ -55,6 +58,7 @@ namespace Points
 class PropertyGreyValueList;
 class PropertyNormalList;
 class PointKernel;
+class PointsOctree;
 class Feature;
 }  // namespace Points
 
@@ -106,6 +110,8 @@ protected:
     void setVertexGreyvalueMode(Points::PropertyGreyValueList*);
     void setVertexNormalMode(Points::PropertyNormalList*);
     virtual void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) = 0;
+    /// Lets the coordinate node use the points of \a kernel instead of a copy of them
+    void shareCoordinates(const Points::PointKernel& kernel);
 
 protected:
     Gui::SoFCSelection* pcHighlight;
@@ -116,6 +122,7 @@ protected:
 
 private:
     static App::PropertyFloatConstraint::Constraints floatRange;
+    Base::Reference<const Points::PointKernel> sharedPoints;
 };
 
 /**
@@ -140,10 +147,20 @@ public:
     void updateData(const App::Property*) override;
 
 protected:
+    void onChanged(const App::Property* prop) override;
     void cut(const std::vector<SbVec2f>& picked, Gui::View3DInventorViewer& Viewer) override;
 
+private:
+    void buildLevelOfDetail(const Points::PointKernel& kernel);
+    void updateScreenArea();
+
 protected:
     SoPointSet* pcPoints;
+    /// Holds a node per octree leaf that renders a big cloud with levels of detail
+    SoGroup* pcLevelOfDetail;
+
+private:
+    std::shared_ptr<const Points::PointsOctree> octree;
 };
 
 /**
@@ -26,6 +26,7 @@
 #include <TColgp_Array1OfPnt.hxx>
 
 
+#include <App/Application.h>
 #include <Base/Console.h>
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
@@ -69,6 +70,14 @@ surface: common, kdtree, octree, search
 using namespace Reen;
 
 namespace Reen {
+// The number of threads used by the normal estimation, zero uses one per core
+static unsigned int numberOfThreads()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/ReverseEngineering");
+    return static_cast<unsigned int>(hGrp->GetUnsigned("NumberOfThreads", 0));
+}
+
 class Module : public Py::ExtensionModule<Module>
 {
 public:
@@ -124,6 +133,7 @@ public:
         add_keyword_method("filterVoxelGrid",&Module::filterVoxelGrid,
             "filterVoxelGrid(dim)."
         );
+#endif
         add_keyword_method("normalEstimation",&Module::normalEstimation,
             "normalEstimation(Points,[KSearch=0, SearchRadius=0]) -> Normals\n"
             "KSearch is an int and used to search the k-nearest neighbours in\n"
@@ -142,7 +152,6 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
             "regionGrowingSegmentation()."
@@ -793,7 +802,6 @@ Mesh.show(m)
         return Py::asObject(new Points::PointsPy(points_sample));
     }
 #endif
-#if defined(HAVE_PCL_FILTERS)
     Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
     {
         PyObject *pts;
@@ -812,6 +820,7 @@ Mesh.show(m)
         NormalEstimation estimate(*points);
         estimate.setKSearch(ksearch);
         estimate.setSearchRadius(searchRadius);
+        estimate.setNumberOfThreads(numberOfThreads());
         estimate.perform(normals);
 
         Py::List list;
@@ -821,7 +830,6 @@ Mesh.show(m)
 
         return list;
     }
-#endif
 #if defined(HAVE_PCL_SEGMENTATION)
     Py::Object regionGrowingSegmentation(const Py::Tuple& args, const Py::Dict& kwds)
     {
@@ -839,6 +847,7 @@ Mesh.show(m)
 
         std::list<std::vector<int> > clusters;
         RegionGrowing segm(*points, clusters);
+        segm.setNumberOfThreads(numberOfThreads());
         if (vec) {
             Py::Sequence list(vec);
             std::vector<Base::Vector3f> normals;
@@ -878,6 +887,7 @@ Mesh.show(m)
 
         std::list<std::vector<int> > clusters;
         Segmentation segm(*points, clusters);
+        segm.setNumberOfThreads(numberOfThreads());
         segm.perform(ksearch);
 
         Py::List lists;
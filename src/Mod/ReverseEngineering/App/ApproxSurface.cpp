@@ -22,24 +22,22 @@
  *                                                                         *
  ***************************************************************************/
 
-#include <QFuture>
-#include <QFutureWatcher>
+#include <algorithm>
 #include <QtConcurrentMap>
 
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
-#include <math_Gauss.hxx>
-#include <math_Householder.hxx>
 
 #include <Base/Sequencer.h>
-#include <Base/Tools.h>
 #include <Mod/Mesh/App/Core/Approximation.h>
 
 #include "ApproxSurface.h"
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
 
 // SplineBasisfunction
 
@@ -966,159 +964,193 @@ void BSplineParameterCorrection::SetVKnots(const std::vector<double>& afKnots)
     _clVSpline.SetKnots(_vVKnots, _vVMults, _usVOrder);
 }
 
-void BSplineParameterCorrection::DoParameterCorrection(int iIter)
+namespace
 {
-    int i = 0;
-    double fMaxDiff = 0.0, fMaxScalar = 1.0;
-    double fWeight = _fSmoothInfluence;
+// the number of points that are processed as one work item
+constexpr int BlockSize = 4096;
 
-    Base::SequencerLauncher seq(
-        "Calc surface...",
-        static_cast<size_t>(iIter) * static_cast<size_t>(_pvcPoints->Length())
-    );
-
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
-
-        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
-            _vCtrlPntsOfSurf,
-            _vUKnots,
-            _vVKnots,
-            _vUMults,
-            _vVMults,
-            _usUOrder - 1,
-            _usVOrder - 1
-        );
-
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-            double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
-            gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
-            gp_Pnt PntX;
-            gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
-            // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
-            gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
-            gp_Vec ErrorVec = X - P;
-
-            // Calculate Xu x Xv the normal in X(u,v)
-            gp_Dir clNormal = Xu ^ Xv;
-
-            // Check, if X = P
-            if (!(X.IsEqual(P, 0.001, 0.001))) {
-                ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
-                }
-            }
-
-            fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
-            if (fabs(fDeltaU) < Precision::Confusion()) {
-                fDeltaU = 0.0;
-            }
-            fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
-            if (fabs(fDeltaV) < Precision::Confusion()) {
-                fDeltaV = 0.0;
-            }
+struct Block
+{
+    int begin;
+    int end;
+};
 
-            // Replace old u/v values with new ones
-            fU = uvValue.X() - fDeltaU;
-            fV = uvValue.Y() - fDeltaV;
-            if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
-                uvValue.SetX(fU);
-                uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
-            }
+std::vector<Block> makeBlocks(int count)
+{
+    std::vector<Block> blocks;
+    blocks.reserve(static_cast<std::size_t>(count / BlockSize + 1));
+    for (int begin = 0; begin < count; begin += BlockSize) {
+        blocks.push_back({begin, std::min(begin + BlockSize, count)});
+    }
+    return blocks;
+}
 
-            seq.next();
-        }
+// The normal equations of the least squares fit of the control points
+struct NormalEquations
+{
+    Eigen::SparseMatrix<double> lhs;
+    Eigen::MatrixX3d rhs;
 
-        if (_bSmoothing) {
-            fWeight *= 0.5f;
-            SolveWithSmoothing(fWeight);
+    void operator+=(const NormalEquations& eq)
+    {
+        if (lhs.size() == 0) {
+            lhs = eq.lhs;
+            rhs = eq.rhs;
         }
         else {
-            SolveWithoutSmoothing();
+            lhs += eq.lhs;
+            rhs += eq.rhs;
         }
+    }
+};
 
-        i++;
-    } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
-}
+// The result of the parameter correction of a block of points
+struct Correction
+{
+    double maxDiff {0.0};
+    double maxScalar {1.0};
 
-bool BSplineParameterCorrection::SolveWithoutSmoothing()
+    void operator+=(const Correction& corr)
+    {
+        maxDiff = std::max(maxDiff, corr.maxDiff);
+        maxScalar = std::min(maxScalar, corr.maxScalar);
+    }
+};
+
+/**
+ * Assembles the normal equations for the control points of a B-spline surface through a point
+ * cloud. A point only lies in the support of uOrder * vOrder basis functions, so the rows of the
+ * coefficient matrix are assembled block by block in compressed form and the normal matrix is
+ * sparse, too.
+ */
+class SystemAssembler
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Matrix Xx(0, ulDim - 1, 0, 0);
-    math_Matrix Xy(0, ulDim - 1, 0, 0);
-    math_Matrix Xz(0, ulDim - 1, 0, 0);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
+public:
+    SystemAssembler(
+        BSplineBasis& uSpline,
+        BSplineBasis& vSpline,
+        int uOrder,
+        int vOrder,
+        int vCtrlpoints,
+        int dimension
+    )
+        : uSpline(uSpline)
+        , vSpline(vSpline)
+        , uOrder(uOrder)
+        , vOrder(vOrder)
+        , vCtrlpoints(vCtrlpoints)
+        , dimension(dimension)
+    {}
+
+    NormalEquations assemble(const TColgp_Array1OfPnt& points, const TColgp_Array1OfPnt2d& params)
+    {
+        std::vector<Block> blocks = makeBlocks(points.Length());
+        auto fMap = [&](const Block& block) {
+            return assemble(points, params, block);
+        };
+
+        // the blocks are summed up in order so that the result doesn't depend on the threads
+        // NOLINTBEGIN
+        NormalEquations eq = QtConcurrent::blockingMappedReduced(
+            blocks,
+            fMap,
+            &NormalEquations::operator+=,
+            QtConcurrent::OrderedReduce | QtConcurrent::SequentialReduce
+        );
+        // NOLINTEND
+        if (eq.lhs.size() == 0) {
+            eq.lhs.resize(dimension, dimension);
+            eq.rhs = Eigen::MatrixX3d::Zero(dimension, 3);
         }
+        return eq;
+    }
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
+private:
+    NormalEquations assemble(
+        const TColgp_Array1OfPnt& points,
+        const TColgp_Array1OfPnt2d& params,
+        const Block& block
+    ) const
+    {
+        const int rows = block.end - block.begin;
+        const int entries = uOrder * vOrder;
+        std::vector<int> outer(rows + 1);
+        std::vector<int> inner(static_cast<std::size_t>(rows) * entries);
+        std::vector<double> values(inner.size(), 0.0);
+        Eigen::MatrixX3d coords(rows, 3);
+        TColStd_Array1OfReal basisU(0, uOrder - 1);
+        TColStd_Array1OfReal basisV(0, vOrder - 1);
+
+        int pos = 0;
+        for (int row = 0; row < rows; row++) {
+            const gp_Pnt& pnt = points(points.Lower() + block.begin + row);
+            const gp_Pnt2d& uvValue = params(params.Lower() + block.begin + row);
+            double fU = uvValue.X();
+            double fV = uvValue.Y();
+            coords.row(row) << pnt.X(), pnt.Y(), pnt.Z();
+            outer[row] = pos;
+
+            // outside the knot range all basis functions vanish
+            bool inside = fU >= 0.0 && fU <= 1.0 && fV >= 0.0 && fV <= 1.0;
+            int firstU = 0;
+            int firstV = 0;
+            if (inside) {
+                firstU = uSpline.FindSpan(fU) - uOrder + 1;
+                firstV = vSpline.FindSpan(fV) - vOrder + 1;
+                uSpline.AllBasisFunctions(fU, basisU);
+                vSpline.AllBasisFunctions(fV, basisV);
             }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+
+            for (int j = 0; j < uOrder; j++) {
+                for (int k = 0; k < vOrder; k++) {
+                    inner[pos] = (firstU + j) * vCtrlpoints + firstV + k;
+                    if (inside) {
+                        values[pos] = basisU(j) * basisV(k);
+                    }
+                    pos++;
                 }
             }
         }
-    }
+        outer[rows] = pos;
 
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
+        Eigen::Map<const Eigen::SparseMatrix<double, Eigen::RowMajor>>
+            coeffs(rows, dimension, pos, outer.data(), inner.data(), values.data());
+        NormalEquations eq;
+        eq.lhs = coeffs.transpose() * coeffs;
+        eq.rhs = coeffs.transpose() * coords;
+        return eq;
     }
 
-    // Solve the over-determined LGS with Householder-Transformation
-    math_Householder hhX(M, bx);
-    math_Householder hhY(M, by);
-    math_Householder hhZ(M, bz);
+private:
+    // FindSpan() and AllBasisFunctions() only read the knots, so they can be used concurrently
+    BSplineBasis& uSpline;
+    BSplineBasis& vSpline;
+    int uOrder;
+    int vOrder;
+    int vCtrlpoints;
+    int dimension;
+};
 
-    if (!(hhX.IsDone() && hhY.IsDone() && hhZ.IsDone())) {
-        // LGS could not be solved
+bool solveForControlPoints(
+    const Eigen::SparseMatrix<double>& lhs,
+    const Eigen::MatrixX3d& rhs,
+    TColgp_Array2OfPnt& poles
+)
+{
+    // the normal matrix is symmetric and positive definite unless the system is under-determined
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(lhs);
+    if (solver.info() != Eigen::Success) {
+        return false;
+    }
+    Eigen::MatrixX3d x = solver.solve(rhs);
+    if (solver.info() != Eigen::Success || !x.allFinite()) {
         return false;
     }
-    Xx = hhX.AllValues();
-    Xy = hhY.AllValues();
-    Xz = hhZ.AllValues();
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx, 0), Xy(ulIdx, 0), Xz(ulIdx, 0));
+    int ulIdx = 0;
+    for (int j = poles.LowerRow(); j <= poles.UpperRow(); j++) {
+        for (int k = poles.LowerCol(); k <= poles.UpperCol(); k++) {
+            poles(j, k) = gp_Pnt(x(ulIdx, 0), x(ulIdx, 1), x(ulIdx, 2));
             ulIdx++;
         }
     }
@@ -1126,156 +1158,160 @@ bool BSplineParameterCorrection::SolveWithoutSmoothing()
     return true;
 }
 
-namespace Reen
+Eigen::SparseMatrix<double> toSparseMatrix(const math_Matrix& mat)
 {
-class ScalarProduct
-{
-public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
-    {}
-    std::vector<double> multiply(int col) const
-    {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
+    std::vector<Eigen::Triplet<double>> entries;
+    for (int i = mat.LowerRow(); i <= mat.UpperRow(); i++) {
+        for (int j = mat.LowerCol(); j <= mat.UpperCol(); j++) {
+            if (mat(i, j) != 0.0) {
+                entries.emplace_back(i - mat.LowerRow(), j - mat.LowerCol(), mat(i, j));
+            }
         }
-        return out;
     }
 
-private:
-    const math_Matrix& mat;
-};
-}  // namespace Reen
+    Eigen::SparseMatrix<double> sparse(mat.RowNumber(), mat.ColNumber());
+    sparse.setFromTriplets(entries.begin(), entries.end());
+    return sparse;
+}
 
-bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+// The integrals of the products of the (derivatives of the) basis functions of one direction
+std::vector<double> integralTable(BSplineBasis& spline, int count, int r, int s)
 {
-    unsigned ulSize = _pvcPoints->Length();
-    unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
-    math_Vector Xx(0, ulDim - 1);
-    math_Vector Xy(0, ulDim - 1);
-    math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
-    math_Vector Mbx(0, ulDim - 1);
-    math_Vector Mby(0, ulDim - 1);
-    math_Vector Mbz(0, ulDim - 1);
-
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
+    std::vector<double> table(static_cast<std::size_t>(count) * count);
+    for (int i = 0; i < count; i++) {
+        for (int k = 0; k < count; k++) {
+            table[i * count + k] = spline.GetIntegralOfProductOfBSplines(i, k, r, s);
         }
+    }
+    return table;
+}
+}  // namespace
+
+void BSplineParameterCorrection::DoParameterCorrection(int iIter)
+{
+    int i = 0;
+    double fMaxDiff = 0.0, fMaxScalar = 1.0;
+    double fWeight = _fSmoothInfluence;
+
+    Base::SequencerLauncher seq(
+        "Calc surface...",
+        static_cast<size_t>(iIter) * static_cast<size_t>(_pvcPoints->Length())
+    );
+
+    std::vector<Block> blocks = makeBlocks(_pvcPoints->Length());
+    do {
+        Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(
+            _vCtrlPntsOfSurf,
+            _vUKnots,
+            _vVKnots,
+            _vUMults,
+            _vVMults,
+            _usUOrder - 1,
+            _usVOrder - 1
+        );
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
+        // The points are corrected independently of each other. Evaluating the surface doesn't
+        // modify it, so it can be shared by all threads.
+        auto fMap = [&](const Block& block) {
+            Correction corr;
+            for (int index = block.begin; index < block.end; index++) {
+                double fDeltaU, fDeltaV, fU, fV;
+                const gp_Pnt& pnt = (*_pvcPoints)(_pvcPoints->Lower() + index);
+                gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
+                gp_Pnt PntX;
+                gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
+                // Calculate the first two derivatives and point at (u,v)
+                gp_Pnt2d& uvValue = (*_pvcUVParam)(_pvcUVParam->Lower() + index);
+                pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+                gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
+                gp_Vec ErrorVec = X - P;
+
+                // Calculate Xu x Xv the normal in X(u,v)
+                gp_Dir clNormal = Xu ^ Xv;
+
+                // Check, if X = P
+                if (!(X.IsEqual(P, 0.001, 0.001))) {
+                    ErrorVec.Normalize();
+                    if (fabs(clNormal * ErrorVec) < corr.maxScalar) {
+                        corr.maxScalar = fabs(clNormal * ErrorVec);
+                    }
                 }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
+
+                fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
+                if (fabs(fDeltaU) < Precision::Confusion()) {
+                    fDeltaU = 0.0;
+                }
+                fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
+                if (fabs(fDeltaV) < Precision::Confusion()) {
+                    fDeltaV = 0.0;
+                }
+
+                // Replace old u/v values with new ones
+                fU = uvValue.X() - fDeltaU;
+                fV = uvValue.Y() - fDeltaV;
+                if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
+                    uvValue.SetX(fU);
+                    uvValue.SetY(fV);
+                    corr.maxDiff = std::max<double>(fabs(fDeltaU), corr.maxDiff);
+                    corr.maxDiff = std::max<double>(fabs(fDeltaV), corr.maxDiff);
                 }
             }
-        }
-    }
+            return corr;
+        };
 
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
+        // NOLINTBEGIN
+        Correction corr
+            = QtConcurrent::blockingMappedReduced(blocks, fMap, &Correction::operator+=);
+        // NOLINTEND
+        fMaxDiff = corr.maxDiff;
+        fMaxScalar = corr.maxScalar;
+        seq.setProgress(static_cast<size_t>(i + 1) * static_cast<size_t>(_pvcPoints->Length()));
+
+        if (_bSmoothing) {
+            fWeight *= 0.5f;
+            SolveWithSmoothing(fWeight);
         }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future
-        = QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end(); ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
+        else {
+            SolveWithoutSmoothing();
         }
-        rowIndex++;
-    }
-#endif
-
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
-    for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
-    }
-
-    // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
 
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
-        return false;
-    }
+        i++;
+    } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
+}
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
-        return false;
-    }
+bool BSplineParameterCorrection::SolveWithoutSmoothing()
+{
+    int ulDim = static_cast<int>(_usUCtrlpoints * _usVCtrlpoints);
+    SystemAssembler assembler(
+        _clUSpline,
+        _clVSpline,
+        static_cast<int>(_usUOrder),
+        static_cast<int>(_usVOrder),
+        static_cast<int>(_usVCtrlpoints),
+        ulDim
+    );
 
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
-        return false;
-    }
+    // Solve the over-determined LGS by its normal equations
+    NormalEquations eq = assembler.assemble(*_pvcPoints, *_pvcUVParam);
+    return solveForControlPoints(eq.lhs, eq.rhs, _vCtrlPntsOfSurf);
+}
 
-    unsigned ulIdx = 0;
-    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            _vCtrlPntsOfSurf(j, k) = gp_Pnt(Xx(ulIdx), Xy(ulIdx), Xz(ulIdx));
-            ulIdx++;
-        }
-    }
+bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
+{
+    int ulDim = static_cast<int>(_usUCtrlpoints * _usVCtrlpoints);
+    SystemAssembler assembler(
+        _clUSpline,
+        _clVSpline,
+        static_cast<int>(_usUOrder),
+        static_cast<int>(_usVOrder),
+        static_cast<int>(_usVCtrlpoints),
+        ulDim
+    );
 
-    return true;
+    // Depending on the weighting, smoothing terms are added to the normal equations
+    NormalEquations eq = assembler.assemble(*_pvcPoints, *_pvcUVParam);
+    Eigen::SparseMatrix<double> lhs = eq.lhs + fWeight * toSparseMatrix(_clSmoothMatrix);
+    return solveForControlPoints(lhs, eq.rhs, _vCtrlPntsOfSurf);
 }
 
 void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc, double fFirst, double fSecond, double fThird)
@@ -1284,7 +1320,6 @@ void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc, double fFirst,
         Base::SequencerLauncher seq(
             "Initializing...",
             static_cast<size_t>(3) * static_cast<size_t>(_usUCtrlpoints)
-                * static_cast<size_t>(_usUCtrlpoints) * static_cast<size_t>(_usVCtrlpoints)
                 * static_cast<size_t>(_usVCtrlpoints)
         );
         CalcFirstSmoothMatrix(seq);
@@ -1297,21 +1332,28 @@ void BSplineParameterCorrection::CalcSmoothingTerms(bool bRecalc, double fFirst,
 
 void BSplineParameterCorrection::CalcFirstSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    // The integrals over the surface are products of integrals over the u and v directions
+    int uCount = static_cast<int>(_usUCtrlpoints);
+    int vCount = static_cast<int>(_usVCtrlpoints);
+    std::vector<double> u00 = integralTable(_clUSpline, uCount, 0, 0);
+    std::vector<double> u11 = integralTable(_clUSpline, uCount, 1, 1);
+    std::vector<double> v00 = integralTable(_clVSpline, vCount, 0, 0);
+    std::vector<double> v11 = integralTable(_clVSpline, vCount, 1, 1);
+
     unsigned m = 0;
-    for (unsigned k = 0; k < _usUCtrlpoints; k++) {
-        for (unsigned l = 0; l < _usVCtrlpoints; l++) {
+    for (int k = 0; k < uCount; k++) {
+        for (int l = 0; l < vCount; l++) {
             unsigned n = 0;
 
-            for (unsigned i = 0; i < _usUCtrlpoints; i++) {
-                for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clFirstMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1);
-                    seq.next();
+            for (int i = 0; i < uCount; i++) {
+                for (int j = 0; j < vCount; j++) {
+                    int ik = i * uCount + k;
+                    int jl = j * vCount + l;
+                    _clFirstMatrix(m, n) = u11[ik] * v00[jl] + u00[ik] * v11[jl];
                     n++;
                 }
             }
+            seq.next();
             m++;
         }
     }
@@ -1319,23 +1361,30 @@ void BSplineParameterCorrection::CalcFirstSmoothMatrix(Base::SequencerLauncher&
 
 void BSplineParameterCorrection::CalcSecondSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    int uCount = static_cast<int>(_usUCtrlpoints);
+    int vCount = static_cast<int>(_usVCtrlpoints);
+    std::vector<double> u00 = integralTable(_clUSpline, uCount, 0, 0);
+    std::vector<double> u11 = integralTable(_clUSpline, uCount, 1, 1);
+    std::vector<double> u22 = integralTable(_clUSpline, uCount, 2, 2);
+    std::vector<double> v00 = integralTable(_clVSpline, vCount, 0, 0);
+    std::vector<double> v11 = integralTable(_clVSpline, vCount, 1, 1);
+    std::vector<double> v22 = integralTable(_clVSpline, vCount, 2, 2);
+
     unsigned m = 0;
-    for (unsigned k = 0; k < _usUCtrlpoints; k++) {
-        for (unsigned l = 0; l < _usVCtrlpoints; l++) {
+    for (int k = 0; k < uCount; k++) {
+        for (int l = 0; l < vCount; l++) {
             unsigned n = 0;
 
-            for (unsigned i = 0; i < _usUCtrlpoints; i++) {
-                for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clSecondMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + 2 * _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 2);
-                    seq.next();
+            for (int i = 0; i < uCount; i++) {
+                for (int j = 0; j < vCount; j++) {
+                    int ik = i * uCount + k;
+                    int jl = j * vCount + l;
+                    _clSecondMatrix(m, n) = u22[ik] * v00[jl] + 2 * u11[ik] * v11[jl]
+                        + u00[ik] * v22[jl];
                     n++;
                 }
             }
+            seq.next();
             m++;
         }
     }
@@ -1343,33 +1392,41 @@ void BSplineParameterCorrection::CalcSecondSmoothMatrix(Base::SequencerLauncher&
 
 void BSplineParameterCorrection::CalcThirdSmoothMatrix(Base::SequencerLauncher& seq)
 {
+    int uCount = static_cast<int>(_usUCtrlpoints);
+    int vCount = static_cast<int>(_usVCtrlpoints);
+    std::vector<double> u00 = integralTable(_clUSpline, uCount, 0, 0);
+    std::vector<double> u02 = integralTable(_clUSpline, uCount, 0, 2);
+    std::vector<double> u11 = integralTable(_clUSpline, uCount, 1, 1);
+    std::vector<double> u13 = integralTable(_clUSpline, uCount, 1, 3);
+    std::vector<double> u20 = integralTable(_clUSpline, uCount, 2, 0);
+    std::vector<double> u22 = integralTable(_clUSpline, uCount, 2, 2);
+    std::vector<double> u31 = integralTable(_clUSpline, uCount, 3, 1);
+    std::vector<double> u33 = integralTable(_clUSpline, uCount, 3, 3);
+    std::vector<double> v00 = integralTable(_clVSpline, vCount, 0, 0);
+    std::vector<double> v02 = integralTable(_clVSpline, vCount, 0, 2);
+    std::vector<double> v11 = integralTable(_clVSpline, vCount, 1, 1);
+    std::vector<double> v13 = integralTable(_clVSpline, vCount, 1, 3);
+    std::vector<double> v20 = integralTable(_clVSpline, vCount, 2, 0);
+    std::vector<double> v22 = integralTable(_clVSpline, vCount, 2, 2);
+    std::vector<double> v31 = integralTable(_clVSpline, vCount, 3, 1);
+    std::vector<double> v33 = integralTable(_clVSpline, vCount, 3, 3);
+
     unsigned m = 0;
-    for (unsigned k = 0; k < _usUCtrlpoints; k++) {
-        for (unsigned l = 0; l < _usVCtrlpoints; l++) {
+    for (int k = 0; k < uCount; k++) {
+        for (int l = 0; l < vCount; l++) {
             unsigned n = 0;
 
-            for (unsigned i = 0; i < _usUCtrlpoints; i++) {
-                for (unsigned j = 0; j < _usVCtrlpoints; j++) {
-                    _clThirdMatrix(m, n) = _clUSpline.GetIntegralOfProductOfBSplines(i, k, 3, 3)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 3, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 0, 2)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 3)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 0)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 1, 1)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 2, 2)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 2)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 3, 1)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 2, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 1, 3)
-                        + _clUSpline.GetIntegralOfProductOfBSplines(i, k, 0, 0)
-                            * _clVSpline.GetIntegralOfProductOfBSplines(j, l, 3, 3);
-                    seq.next();
+            for (int i = 0; i < uCount; i++) {
+                for (int j = 0; j < vCount; j++) {
+                    int ik = i * uCount + k;
+                    int jl = j * vCount + l;
+                    _clThirdMatrix(m, n) = u33[ik] * v00[jl] + u31[ik] * v02[jl]
+                        + u13[ik] * v20[jl] + u11[ik] * v22[jl] + u22[ik] * v11[jl]
+                        + u02[ik] * v31[jl] + u20[ik] * v13[jl] + u00[ik] * v33[jl];
                     n++;
                 }
             }
+            seq.next();
             m++;
         }
     }
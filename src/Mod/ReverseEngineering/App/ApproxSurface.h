@@ -413,13 +413,13 @@ protected:
     void DoParameterCorrection(int iIter) override;
 
     /**
-     * Solve an overdetermined LGS with the help of the Householder-Tansformation
+     * Solve an overdetermined LGS by its sparse normal equations
      */
     bool SolveWithoutSmoothing() override;
 
     /**
-     * Solve a regular system of equations by LU decomposition. Depending on the weighting,
-     * smoothing terms are included
+     * Solve a regular sparse system of equations by Cholesky decomposition. Depending on the
+     * weighting, smoothing terms are included
      */
     bool SolveWithSmoothing(double fWeight) override;
 
@@ -36,7 +36,7 @@
 # include <pcl/point_types.h>
 #endif
 #if defined(HAVE_PCL_SEGMENTATION)
-# include <pcl/features/normal_3d.h>
+# include <pcl/features/normal_3d_omp.h>
 # include <pcl/filters/extract_indices.h>
 # include <pcl/search/kdtree.h>
 # include <pcl/search/search.h>
@@ -66,7 +66,7 @@ void RegionGrowing::perform(int ksearch)
     // normal estimation
     pcl::search::Search<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
     pcl::PointCloud<pcl::Normal>::Ptr normals(new pcl::PointCloud<pcl::Normal>);
-    pcl::NormalEstimation<pcl::PointXYZ, pcl::Normal> normal_estimator;
+    pcl::NormalEstimationOMP<pcl::PointXYZ, pcl::Normal> normal_estimator(numThreads);
     normal_estimator.setSearchMethod(tree);
     normal_estimator.setInputCloud(cloud);
     normal_estimator.setKSearch(ksearch);
@@ -42,6 +42,13 @@ class RegionGrowing
 {
 public:
     RegionGrowing(const Points::PointKernel&, std::list<std::vector<int>>&);
+    /** \brief Set the number of threads used for the normal estimation.
+     * \param[in] threads the number of threads, zero uses one per core
+     */
+    inline void setNumberOfThreads(unsigned int threads)
+    {
+        numThreads = threads;
+    }
     /** \brief Set the number of k nearest neighbors to use for the normal estimation.
      * \param[in] k the number of k-nearest neighbors
      */
@@ -54,6 +61,7 @@ public:
 private:
     const Points::PointKernel& myPoints;
     std::list<std::vector<int>>& myClusters;
+    unsigned int numThreads {0};
 };
 
 }  // namespace Reen
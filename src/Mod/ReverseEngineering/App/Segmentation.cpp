@@ -22,14 +22,22 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
 
+#include <Eigen/Eigenvalues>
+
+#include <Base/Exception.h>
 #include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsKDTree.h>
 
 #include "Segmentation.h"
 
 
 #if defined(HAVE_PCL_FILTERS)
-# include <pcl/features/normal_3d.h>
+# include <pcl/features/normal_3d_omp.h>
 # include <pcl/filters/extract_indices.h>
 # include <pcl/filters/passthrough.h>
 #endif
@@ -65,7 +73,7 @@ void Segmentation::perform(int ksearch)
 {
     // All the objects needed
     pcl::PassThrough<PointXYZ> pass;
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
+    pcl::NormalEstimationOMP<PointXYZ, pcl::Normal> ne(numThreads);
     pcl::SACSegmentationFromNormals<PointXYZ, pcl::Normal> seg;
     pcl::ExtractIndices<PointXYZ> extract;
     pcl::ExtractIndices<pcl::Normal> extract_normals;
@@ -161,13 +169,69 @@ void Segmentation::perform(int ksearch)
 
 // ----------------------------------------------------------------------------
 
-#if defined(HAVE_PCL_FILTERS)
+#if !defined(HAVE_PCL_FILTERS)
+namespace
+{
+// the minimum number of points a thread estimates the normals for
+constexpr std::size_t MinPointsPerThread = 10000;
+
+unsigned int countThreads(unsigned int threads, std::size_t count)
+{
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    std::size_t maxThreads = std::max<std::size_t>(count / MinPointsPerThread, 1);
+    return static_cast<unsigned int>(std::clamp<std::size_t>(threads, 1, maxThreads));
+}
+
+// Fits a plane through the neighbours of a point and returns its normal oriented towards the
+// origin, like pcl::NormalEstimation does with its default viewpoint
+Base::Vector3d fitNormal(
+    const Points::PointKernel& kernel,
+    const std::vector<std::size_t>& neighbours,
+    const Base::Vector3d& pnt
+)
+{
+    if (neighbours.size() < 3) {
+        double nan = std::numeric_limits<double>::quiet_NaN();
+        return Base::Vector3d(nan, nan, nan);
+    }
+
+    std::vector<Eigen::Vector3d> pts;
+    pts.reserve(neighbours.size());
+    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+    for (std::size_t index : neighbours) {
+        Base::Vector3d p = kernel.getPoint(static_cast<int>(index));
+        pts.emplace_back(p.x, p.y, p.z);
+        mean += pts.back();
+    }
+    mean /= static_cast<double>(pts.size());
+
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    for (const auto& p : pts) {
+        Eigen::Vector3d diff = p - mean;
+        covariance += diff * diff.transpose();
+    }
+
+    // the eigenvalues are sorted in increasing order
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+    Eigen::Vector3d normal = solver.eigenvectors().col(0);
+    Base::Vector3d result(normal.x(), normal.y(), normal.z());
+    if (result * pnt > 0) {
+        result = -result;
+    }
+    return result;
+}
+}  // namespace
+#endif
+
 NormalEstimation::NormalEstimation(const Points::PointKernel& pts)
     : myPoints(pts)
     , kSearch(0)
     , searchRadius(0)
 {}
 
+#if defined(HAVE_PCL_FILTERS)
 void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
 {
     // Copy the points
@@ -193,7 +257,7 @@ void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
     // Estimate point normals
     pcl::PointCloud<pcl::Normal>::Ptr cloud_normals(new pcl::PointCloud<pcl::Normal>);
     pcl::search::KdTree<PointXYZ>::Ptr tree(new pcl::search::KdTree<PointXYZ>());
-    pcl::NormalEstimation<PointXYZ, pcl::Normal> ne;
+    pcl::NormalEstimationOMP<PointXYZ, pcl::Normal> ne(numThreads);
     ne.setSearchMethod(tree);
     // ne.setInputCloud (cloud_filtered);
     ne.setInputCloud(cloud);
@@ -212,5 +276,45 @@ void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
         normals.push_back(Base::Vector3d(it->normal_x, it->normal_y, it->normal_z));
     }
 }
+#else
+void NormalEstimation::perform(std::vector<Base::Vector3d>& normals)
+{
+    if (kSearch <= 0 && searchRadius <= 0) {
+        throw Base::ValueError("Either the number of neighbours or the search radius must be set");
+    }
 
-#endif  // HAVE_PCL_FILTERS
+    // the kd-tree works in global coordinates and is shared with other users of the points
+    std::shared_ptr<const Points::PointsKDTree> tree = myPoints.getKDTree();
+    std::size_t numPoints = myPoints.size();
+    std::size_t offset = normals.size();
+    normals.resize(offset + numPoints);
+
+    auto estimate = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            Base::Vector3d pnt = myPoints.getPoint(static_cast<int>(index));
+            Base::Vector3f query = Base::toVector<float>(pnt);
+            std::vector<std::size_t> neighbours;
+            if (!std::isnan(query.x) && !std::isnan(query.y) && !std::isnan(query.z)) {
+                neighbours = kSearch > 0
+                    ? tree->findKNearest(query, static_cast<std::size_t>(kSearch))
+                    : tree->findInRadius(query, static_cast<float>(searchRadius));
+            }
+            normals[offset + index] = fitNormal(myPoints, neighbours, pnt);
+        }
+    };
+
+    // every thread writes the normals of its own range of points
+    unsigned int threads = countThreads(numThreads, numPoints);
+    std::size_t chunk = (numPoints + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < threads; i++) {
+        std::size_t begin = std::min(numPoints, i * chunk);
+        std::size_t end = std::min(numPoints, begin + chunk);
+        workers.emplace_back(estimate, begin, end);
+    }
+    estimate(0, std::min(numPoints, chunk));
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+#endif
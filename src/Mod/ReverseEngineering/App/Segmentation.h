@@ -42,6 +42,13 @@ class Segmentation
 {
 public:
     Segmentation(const Points::PointKernel&, std::list<std::vector<int>>& clusters);
+    /** \brief Set the number of threads used for the normal estimation.
+     * \param[in] threads the number of threads, zero uses one per core
+     */
+    inline void setNumberOfThreads(unsigned int threads)
+    {
+        numThreads = threads;
+    }
     /** \brief Set the number of k nearest neighbors to use for the normal estimation.
      * \param[in] k the number of k-nearest neighbors
      */
@@ -50,6 +57,7 @@ public:
 private:
     const Points::PointKernel& myPoints;
     std::list<std::vector<int>>& myClusters;
+    unsigned int numThreads {0};
 };
 
 class NormalEstimation
@@ -73,6 +81,14 @@ public:
         searchRadius = radius;
     }
 
+    /** \brief Set the number of threads used for the estimation.
+     * \param[in] threads the number of threads, zero uses one per core
+     */
+    inline void setNumberOfThreads(unsigned int threads)
+    {
+        numThreads = threads;
+    }
+
     /** \brief Perform the normal estimation.
      * \param[out] the estimated normals
      */
@@ -82,6 +98,7 @@ private:
     const Points::PointKernel& myPoints;
     int kSearch;
     double searchRadius;
+    unsigned int numThreads {0};
 };
 
 }  // namespace Reen
@@ -226,6 +226,25 @@ void Robot6Axis::Restore(Base::XMLReader& reader)
 }
 
 bool Robot6Axis::setTo(const Base::Placement& To)
+{
+    // Creation of jntarrays:
+    KDL::JntArray result(Kinematic.getNrOfJoints());
+
+    if (!solve(To, Actual, result)) {
+        return false;
+    }
+    else {
+        Actual = result;
+        Tcp = toFrame(To);
+        return true;
+    }
+}
+
+bool Robot6Axis::solve(
+    const Base::Placement& To,
+    const KDL::JntArray& Start,
+    KDL::JntArray& Result
+) const
 {
     // Creation of the solvers:
     KDL::ChainFkSolverPos_recursive fksolver1(Kinematic);  // Forward position solver
@@ -240,29 +259,10 @@ bool Robot6Axis::setTo(const Base::Placement& To)
         1e-6
     );  // Maximum 100 iterations, stop at accuracy 1e-6
 
-    // Creation of jntarrays:
-    KDL::JntArray result(Kinematic.getNrOfJoints());
-
-    // Set destination frame
-    KDL::Frame F_dest = KDL::Frame(
-        KDL::Rotation::Quaternion(
-            To.getRotation()[0],
-            To.getRotation()[1],
-            To.getRotation()[2],
-            To.getRotation()[3]
-        ),
-        KDL::Vector(To.getPosition()[0], To.getPosition()[1], To.getPosition()[2])
-    );
+    Result.resize(Kinematic.getNrOfJoints());
 
     // solve
-    if (iksolver1.CartToJnt(Actual, F_dest, result) < 0) {
-        return false;
-    }
-    else {
-        Actual = result;
-        Tcp = F_dest;
-        return true;
-    }
+    return iksolver1.CartToJnt(Start, toFrame(To), Result) >= 0;
 }
 
 Base::Placement Robot6Axis::getTcp()
@@ -300,7 +300,12 @@ bool Robot6Axis::setAxis(int Axis, double Value)
 
 double Robot6Axis::getAxis(int Axis)
 {
-    return RotDir[Axis] * Base::toDegrees<double>(Actual(Axis));
+    return getAxis(Actual, Axis);
+}
+
+double Robot6Axis::getAxis(const KDL::JntArray& Joints, int Axis) const
+{
+    return RotDir[Axis] * Base::toDegrees<double>(Joints(Axis));
 }
 
 } /* namespace Robot */
@@ -70,8 +70,16 @@ public:
 
     /// set the robot to that position, calculates the Axis
     bool setTo(const Base::Placement& To);
+    /// calculates the joint values for that position starting from Start, does not move the robot
+    bool solve(const Base::Placement& To, const KDL::JntArray& Start, KDL::JntArray& Result) const;
     bool setAxis(int Axis, double Value);
     double getAxis(int Axis);
+    /// the Axis value in ° of the joint values Joints
+    double getAxis(const KDL::JntArray& Joints, int Axis) const;
+    const KDL::JntArray& getJoints() const
+    {
+        return Actual;
+    }
     double getMaxAngle(int Axis);
     double getMinAngle(int Axis);
     /// calculate the new Tcp out of the Axis
@@ -25,6 +25,14 @@ class Robot6Axis(Persistence):
         """Checks the shape and report errors in the shape structure.
         This is a more detailed check as done in isValid()."""
         ...
+
+    def sampleTrajectory(self, trajectory: Any, count: int, tool: Any = None, /) -> list:
+        """sampleTrajectory(trajectory, count, [tool]) -> list
+        Samples the trajectory at count equidistant times and calculates the axis of the
+        robot for each pose, without moving the robot. Returns a list of tuples
+        (time, reachable, (Axis1, ..., Axis6)). Unreachable poses keep the axis of the
+        previous sample."""
+        ...
     Axis1: float
     """Pose of Axis 1 in degrees"""
 
@@ -28,6 +28,9 @@
 #include <Base/MatrixPy.h>
 #include <Base/PlacementPy.h>
 
+#include "Simulation.h"
+#include "TrajectoryPy.h"
+
 // clang-format off
 // inclusion of the generated files (generated out of Robot6AxisPy.xml)
 #include "Robot6AxisPy.h"
@@ -77,6 +80,50 @@ PyObject* Robot6AxisPy::check(PyObject* /*args*/)
     return nullptr;
 }
 
+PyObject* Robot6AxisPy::sampleTrajectory(PyObject* args)
+{
+    PyObject* trac;
+    int count;
+    PyObject* tool = nullptr;
+    if (!PyArg_ParseTuple(
+            args,
+            "O!i|O!",
+            &(TrajectoryPy::Type),
+            &trac,
+            &count,
+            &(Base::PlacementPy::Type),
+            &tool
+        )) {
+        return nullptr;
+    }
+    if (count < 0) {
+        PyErr_SetString(PyExc_ValueError, "count must not be negative");
+        return nullptr;
+    }
+
+    Base::Placement toolPlacement;
+    if (tool) {
+        toolPlacement = *static_cast<Base::PlacementPy*>(tool)->getPlacementPtr();
+    }
+
+    std::vector<Simulation::Sample> samples = Simulation::sampleTrajectory(
+        *static_cast<TrajectoryPy*>(trac)->getTrajectoryPtr(),
+        *getRobot6AxisPtr(),
+        toolPlacement,
+        static_cast<unsigned int>(count)
+    );
+
+    Py::List list;
+    for (const auto& sample : samples) {
+        Py::Tuple axis(6);
+        for (int i = 0; i < 6; i++) {
+            axis.setItem(i, Py::Float(sample.axis[i]));
+        }
+        list.append(Py::TupleN(Py::Float(sample.time), Py::Boolean(sample.reachable), axis));
+    }
+    return Py::new_reference_to(list);
+}
+
 
 Py::Float Robot6AxisPy::getAxis1() const
 {
@@ -23,6 +23,10 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
+#include <Base/Parallel.h>
+
 #include "Simulation.h"
 
 
@@ -96,3 +100,57 @@ void Simulation::reset()
     Axis[4] = Rob.getAxis(4);
     Axis[5] = Rob.getAxis(5);
 }
+
+std::vector<Simulation::Sample> Simulation::sampleTrajectory(
+    const Trajectory& Trac,
+    const Robot6Axis& Rob,
+    const Base::Placement& Tool,
+    unsigned int count
+)
+{
+    std::vector<Sample> samples(count);
+    if (count == 0) {
+        return samples;
+    }
+
+    Base::Placement ToolInverse = Tool.inverse();
+    double duration = Trac.getDuration();
+    for (unsigned int i = 0; i < count; i++) {
+        samples[i].time = count > 1 ? duration * i / (count - 1) : 0.0;
+    }
+
+    // The samples are solved in chunks in parallel, each sample starting from the axis of the
+    // previous one. The first sample of each chunk is solved first, one after the other from
+    // the robot position, so that all the samples stay on the same solution of the inverse
+    // kinematics as the robot.
+    const std::size_t chunkSize = 32;
+    std::size_t chunks = (count + chunkSize - 1) / chunkSize;
+    std::vector<KDL::JntArray> starts(chunks);
+    KDL::JntArray joints = Rob.getJoints();
+    for (std::size_t c = 0; c < chunks; c++) {
+        Base::Placement pos = Trac.getPosition(samples[c * chunkSize].time) * ToolInverse;
+        if (!Rob.solve(pos, joints, starts[c])) {
+            starts[c] = joints;
+        }
+        joints = starts[c];
+    }
+
+    Base::parallelFor(chunks, [&](std::size_t c) {
+        KDL::JntArray joints = starts[c];
+        KDL::JntArray result;
+        std::size_t end = std::min<std::size_t>(count, (c + 1) * chunkSize);
+        for (std::size_t i = c * chunkSize; i < end; i++) {
+            Sample& sample = samples[i];
+            Base::Placement pos = Trac.getPosition(sample.time) * ToolInverse;
+            sample.reachable = Rob.solve(pos, joints, result);
+            if (sample.reachable) {
+                joints = result;
+            }
+            for (int axis = 0; axis < 6; axis++) {
+                sample.axis[axis] = Rob.getAxis(joints, axis);
+            }
+        }
+    });
+
+    return samples;
+}
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <Base/Placement.h>
 
 #include <Mod/Robot/RobotGlobal.h>
@@ -69,6 +71,27 @@ public:
     // apply the start axis angles and set to time 0. Restores the exact start position
     void reset();
 
+    /// Axis values of the robot at one time of the trajectory
+    struct Sample
+    {
+        double time {0.0};
+        bool reachable {false};
+        double axis[6] {};
+    };
+    /** Samples the trajectory at count equidistant times and calculates the axis of each pose,
+     *  without moving the robot. Unreachable poses keep the axis of the previous sample.
+     */
+    static std::vector<Sample> sampleTrajectory(
+        const Trajectory& Trac,
+        const Robot6Axis& Rob,
+        const Base::Placement& Tool,
+        unsigned int count
+    );
+    std::vector<Sample> sampleTrajectory(unsigned int count) const
+    {
+        return sampleTrajectory(Trac, Rob, Tool, count);
+    }
+
     double Pos {0.0};
     double Axis[6] {};
     double startAxis[6] {};
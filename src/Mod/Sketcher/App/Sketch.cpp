@@ -98,6 +98,8 @@ void Sketch::clear()
     ArcsOfParabola.clear();
     BSplines.clear();
     resolveAfterGeometryUpdated = false;
+    canAppendConstraints = false;
+    setUpConstraints.clear();
 
     // deleting the doubles allocated with new
     for (auto param : Parameters) {
@@ -195,6 +197,10 @@ int Sketch::setUpSketch(
 {
     Base::TimeElapsed start_time;
 
+    if (appendConstraints(GeoList, ConstraintList, extGeoCount)) {
+        return finishSetUp(start_time);
+    }
+
     clear();
 
     // The geometries that are in groups are going to be ignored by the solver.
@@ -349,6 +355,110 @@ int Sketch::setUpSketch(
 #endif  // DEBUG_BLOCK_CONSTRAINT
     }
 
+    // Blocked geometry and groups depend on the whole constraint list, and B-splines on a second
+    // solve, so these sketches are always set up in full.
+    canAppendConstraints = !Geoms.empty() && !doesBlockAffectOtherConstraints
+        && inGroupGeoIds.empty() && !resolveAfterGeometryUpdated;
+    if (canAppendConstraints) {
+        setUpExtGeoCount = extGeoCount;
+        setUpConstraints.reserve(ConstraintList.size());
+        for (const auto& c : ConstraintList) {
+            Base::StringWriter writer;
+            c->Save(writer);
+            setUpConstraints.push_back(writer.getString());
+        }
+    }
+
+    return finishSetUp(start_time);
+}
+
+bool Sketch::appendConstraints(
+    const std::vector<Part::Geometry*>& GeoList,
+    const std::vector<Constraint*>& ConstraintList,
+    int extGeoCount
+)
+{
+    if (!canAppendConstraints || extGeoCount != setUpExtGeoCount || GeoList.size() != Geoms.size()
+        || ConstraintList.size() < setUpConstraints.size()) {
+        return false;
+    }
+
+    // The geometry must be the one the parameters currently hold, i.e. the solved one. The
+    // tolerance only absorbs the rounding of the directions compared by isSame().
+    const double tol = Precision::Confusion();
+    for (std::size_t i = 0; i < GeoList.size(); ++i) {
+        if (!Geoms[i].geo->isSame(*GeoList[i], tol, tol)
+            || GeometryFacade::getBlocked(Geoms[i].geo) != GeometryFacade::getBlocked(GeoList[i])) {
+            return false;
+        }
+    }
+
+    std::size_t oldCount = setUpConstraints.size();
+    for (std::size_t i = 0; i < oldCount; ++i) {
+        Base::StringWriter writer;
+        ConstraintList[i]->Save(writer);
+        if (writer.getString() != setUpConstraints[i]) {
+            return false;
+        }
+    }
+
+    int intGeoCount = static_cast<int>(GeoList.size()) - extGeoCount;
+    std::vector<std::string> appended;
+    for (std::size_t i = oldCount; i < ConstraintList.size(); ++i) {
+        const auto& c = ConstraintList[i];
+        // these change how the existing geometry was added
+        if (c->Type == Block || c->Type == Group || c->Type == Text
+            || c->Type == InternalAlignment) {
+            return false;
+        }
+        for (int j = 0; c->isDriving && c->hasElement(j); ++j) {
+            int geoId = c->getGeoId(j);
+            if (geoId >= 0 && geoId < intGeoCount && GeometryFacade::getBlocked(GeoList[geoId])) {
+                return false;
+            }
+        }
+        Base::StringWriter writer;
+        c->Save(writer);
+        appended.push_back(writer.getString());
+    }
+
+    // The constraint definitions still point to the replaced constraint objects.
+    std::size_t constrIndex = 0;
+    for (std::size_t i = 0; i < oldCount; ++i) {
+        const auto& c = ConstraintList[i];
+        if (c->Type != Block && c->isActive) {
+            Constrs[constrIndex].constr = c;
+            Constrs[constrIndex].driving = c->isDriving;
+            ++constrIndex;
+        }
+    }
+
+    resetInitMove();
+    clearTemporaryConstraints();
+    for (std::size_t i = oldCount; i < ConstraintList.size(); ++i) {
+        const auto& c = ConstraintList[i];
+        if (c->isActive) {
+            if (addConstraint(c) == -1) {
+                int humanConstraintId = static_cast<int>(i) + 1;
+                Base::Console().error("Sketcher constraint number %d is malformed!\n", humanConstraintId);
+                MalformedConstraints.push_back(humanConstraintId);
+            }
+        }
+        else {
+            ++ConstraintsCounter;  // For correct solver redundant reporting
+        }
+    }
+    std::ranges::move(appended, std::back_inserter(setUpConstraints));
+
+    pDependencyGroups.clear();
+    GCSsys.declareUnknowns(Parameters);
+    GCSsys.declareDrivenParams(DrivenParameters);
+    GCSsys.initSolution(defaultSolverRedundant);
+    return true;
+}
+
+int Sketch::finishSetUp(const Base::TimeElapsed& start_time)
+{
     // Now we set the Sketch status with the latest solver information
     GCSsys.getConflicting(Conflicting);
     GCSsys.getRedundant(Redundant);
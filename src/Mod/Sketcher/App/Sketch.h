@@ -583,6 +583,11 @@ private:
     // non-driving constraints)
     bool resolveAfterGeometryUpdated;
 
+    // state of the last full set up, to apply constraints appended after it without rebuilding
+    bool canAppendConstraints = false;
+    int setUpExtGeoCount = 0;
+    std::vector<std::string> setUpConstraints;  // the saved constraints
+
 private:
     /// container element to store and work with the geometric elements of this sketch
     struct GeoDef
@@ -810,6 +815,16 @@ private:
 
     void buildInternalAlignmentGeometryMap(const std::vector<Constraint*>& constraintList);
 
+    /// adds the constraints appended since the last set up to the live system, false if the
+    /// sketch changed in any other way
+    bool appendConstraints(
+        const std::vector<Part::Geometry*>& GeoList,
+        const std::vector<Constraint*>& ConstraintList,
+        int extGeoCount
+    );
+    /// reads the diagnosis of the system after a set up
+    int finishSetUp(const Base::TimeElapsed& start_time);
+
     int internalSolve(std::string& solvername, int level = 0);
 
     /// checks if the index bounds and converts negative indices to positive
@@ -26,7 +26,11 @@
 
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BndLib_Add3dCurve.hxx>
+#include <Bnd_Box.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
+#include <GeomAdaptor_Curve.hxx>
+#include <Geom_Curve.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -551,6 +555,95 @@ public:
     }
 };
 
+class SketchObject::GeoIndex
+{
+private:
+    static constexpr int bgiMaxElements = 16;
+
+    using Point = bg::model::point<double, 2, bg::cs::cartesian>;
+    using Box = bg::model::box<Point>;
+    using Value = std::pair<Box, int>;
+
+    bgi::rtree<Value, bgi::linear<bgiMaxElements>> rtree;
+
+    static bool getBoundBox(const Part::Geometry* geo, Box& box)
+    {
+        if (geo->is<Part::GeomPoint>()) {
+            auto pt = static_cast<const Part::GeomPoint*>(geo)->getPoint();
+            box = Box(Point(pt.x, pt.y), Point(pt.x, pt.y));
+            return true;
+        }
+
+        Handle(Geom_Curve) curve = Handle(Geom_Curve)::DownCast(geo->handle());
+        if (curve.IsNull()) {
+            return false;
+        }
+        Bnd_Box bndBox;
+        BndLib_Add3dCurve::Add(GeomAdaptor_Curve(curve), Precision::Confusion(), bndBox);
+        if (bndBox.IsVoid()) {
+            return false;
+        }
+        if (bndBox.IsOpen()) {
+            double inf = Precision::Infinite();
+            box = Box(Point(-inf, -inf), Point(inf, inf));
+            return true;
+        }
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        bndBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        box = Box(Point(xMin, yMin), Point(xMax, yMax));
+        return true;
+    }
+
+public:
+    explicit GeoIndex(const SketchObject &sketch) {
+        std::vector<Value> values;
+        auto add = [&values](const Part::Geometry* geo, int geoId) {
+            Box box;
+            if (getBoundBox(geo, box)) {
+                values.emplace_back(box, geoId);
+            }
+        };
+
+        const auto &geos = sketch.getInternalGeometry();
+        values.reserve(geos.size() + sketch.getExternalGeometryCount());
+        for (int i = 0; i < int(geos.size()); ++i) {
+            add(geos[i], i);
+        }
+        const auto &extGeos = sketch.getExternalGeometry();
+        for (int i = 0; i < int(extGeos.size()); ++i) {
+            add(extGeos[i], -i - 1);
+        }
+
+        // bulk loading packs the tree better than inserting one by one
+        rtree = decltype(rtree)(values);
+    }
+
+    std::vector<int> query(const Base::BoundBox2d &box) const {
+        std::vector<Value> found;
+        rtree.query(bgi::intersects(Box(Point(box.MinX, box.MinY), Point(box.MaxX, box.MaxY))),
+                    std::back_inserter(found));
+
+        std::vector<int> geoIds;
+        geoIds.reserve(found.size());
+        for (const auto &value : found) {
+            geoIds.push_back(value.second);
+        }
+        // normal geometry first, then external geometry from the last one
+        std::ranges::sort(geoIds, [](int a, int b) {
+            return (a < 0) == (b < 0) ? a < b : a >= 0;
+        });
+        return geoIds;
+    }
+};
+
+std::vector<int> SketchObject::getGeometryInBox(const Base::BoundBox2d &box) const
+{
+    if (!geoIndex) {
+        geoIndex = std::make_unique<GeoIndex>(*this);
+    }
+    return geoIndex->query(box);
+}
+
 void SketchObject::updateGeoHistory() {
     if(!geoHistoryLevel) return;
 
@@ -951,6 +1044,10 @@ static inline bool checkMigration(Part::PropertyGeometryList &prop)
 
 void SketchObject::onChanged(const App::Property* prop)
 {
+    if (prop == &Geometry || prop == &ExternalGeo) {
+        geoIndex.reset();
+    }
+
     if (prop == &Geometry) {
         onGeometryChanged();
     }
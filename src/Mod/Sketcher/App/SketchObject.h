@@ -29,6 +29,7 @@
 #include <App/PropertyFile.h>
 #include <Base/Axis.h>
 #include <Base/Bitmask.h>
+#include <Base/Tools2D.h>
 #include <Mod/Part/App/Part2DObject.h>
 #include <Mod/Part/App/PropertyGeometryList.h>
 #include <Mod/Sketcher/App/PropertyConstraintList.h>
@@ -182,6 +183,20 @@ public:
      \retval int - GeoId of last added element
      */
     int addGeometry(const std::vector<Part::Geometry*>& geoList, bool construction = false);
+    /*!
+     \brief Add multiple geometry elements and constraints to a sketch in one step, so that the
+     geometry indices and constraint checks are only updated once. The sketch is not solved.
+     \param geoList - geometry to add (copies are added)
+     \param constraintList - constraints to add (clones are added), they may refer to the geometry
+     in geoList, which gets the GeoIds following the existing geometry
+     \param construction - true for construction lines
+     \retval int - 0 if successful, -1 if a constraint has invalid indices (nothing is added)
+     */
+    int addGeometryAndConstraints(
+        const std::vector<Part::Geometry*>& geoList,
+        const std::vector<Constraint*>& constraintList,
+        bool construction = false
+    );
     /*!
      \brief Deletes indicated geometry (by geoid).
      \param GeoId - the geometry to delete
@@ -322,6 +337,11 @@ public:
 
     int getGeoIdFromCompleteGeometryIndex(int completeGeometryIndex) const;
 
+    /// returns the GeoIds of the normal and external geometry whose bounding box intersects the
+    /// given box, in the order of getCompleteGeometry(). It uses a spatial index that is rebuilt
+    /// on the first query after the geometry changed.
+    std::vector<int> getGeometryInBox(const Base::BoundBox2d& box) const;
+
     // Returns the index of the scale defining constraint if
     // there is only one and -1 otherwise
     int getSingleScaleDefiningConstraint() const;
@@ -707,8 +727,9 @@ public:
     Base::Axis getAxis(int axId) const override;
     /// verify and accept the assigned geometry
     void acceptGeometry() override;
-    /// Check if constraint has invalid indexes
-    bool evaluateConstraint(const Constraint* constraint) const;
+    /// Check if constraint has invalid indexes, allowing for pendingGeoCount geometries about to be
+    /// added
+    bool evaluateConstraint(const Constraint* constraint, int pendingGeoCount = 0) const;
     /// Check for constraints with invalid indexes
     bool evaluateConstraints() const;
     /// Remove constraints with invalid indexes
@@ -1242,6 +1263,9 @@ private:
     class GeoHistory;
     std::unique_ptr<GeoHistory> geoHistory;
 
+    class GeoIndex;
+    mutable std::unique_ptr<GeoIndex> geoIndex;
+
     mutable std::map<std::string, std::string> internalElementMap;
 };
 
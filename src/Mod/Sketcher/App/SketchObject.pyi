@@ -117,6 +117,36 @@ class SketchObject(Part2DObject):
         """
         ...
 
+    def addGeometryAndConstraints(
+        self,
+        geo: List[Geometry],
+        constraints: List[Constraint],
+        isConstruction: bool = False,
+        solve: bool = True,
+        /,
+    ) -> Tuple[Tuple[int, ...], Tuple[int, ...]]:
+        """
+        Add many geometric objects and constraints to the sketch in one step.
+
+        addGeometryAndConstraints(geo:List(Geometry), constraints:List(Constraint),
+                                  isConstruction=False, solve=True) -> Tuple(Tuple(int), Tuple(int))
+
+            The geometry indices and the constraint checks are updated only once for
+            the whole batch, which is much faster than adding the elements one by one.
+
+            Args:
+                geo: The geometry to add.
+                constraints: The constraints to add. They may refer to the geometry
+                    being added, whose indices follow the existing geometry.
+                isConstruction: Whether the added geometry is a "construction geometry".
+                solve: Whether to solve the sketch once everything is added.
+
+            Returns:
+                A tuple with the tuple of zero-based indices of the newly added geometry
+                and the tuple of zero-based indices of the newly added constraints.
+        """
+        ...
+
     def delGeometry(self, geoId: int, noSolve: bool, /) -> None:
         """
         Delete a geometric object from the sketch.
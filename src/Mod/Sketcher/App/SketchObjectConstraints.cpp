@@ -2206,7 +2206,7 @@ void SketchObject::appendConstraintsMsg(const std::vector<int>& vector,
     msg = ss.str();
 }
 
-bool SketchObject::evaluateConstraint(const Constraint* constraint) const
+bool SketchObject::evaluateConstraint(const Constraint* constraint, int pendingGeoCount) const
 {
     // if requireXXX,  GeoUndef is treated as an error. If not requireXXX,
     // GeoUndef is accepted. Index range checking is done on everything regardless.
@@ -2245,7 +2245,7 @@ bool SketchObject::evaluateConstraint(const Constraint* constraint) const
             break;
     }
 
-    int intGeoCount = getHighestCurveIndex() + 1;
+    int intGeoCount = getHighestCurveIndex() + 1 + pendingGeoCount;
     int extGeoCount = getExternalGeometryCount();
 
     // the actual checks
@@ -173,6 +173,29 @@ int SketchObject::addGeometry(const std::vector<Part::Geometry*>& geoList,
     return Geometry.getSize() - 1;
 }
 
+int SketchObject::addGeometryAndConstraints(const std::vector<Part::Geometry*>& geoList,
+                                            const std::vector<Constraint*>& constraintList,
+                                            bool construction /*=false*/)
+{
+    for (auto* constr : constraintList) {
+        if (!evaluateConstraint(constr, static_cast<int>(geoList.size()))) {
+            return -1;
+        }
+    }
+
+    // no need to check input data validity as this is an sketchobject managed operation.
+    Base::StateLocker lock(managedoperation, true);
+
+    if (!geoList.empty()) {
+        addGeometry(geoList, construction);
+    }
+    if (!constraintList.empty()) {
+        addConstraints(constraintList);
+    }
+
+    return 0;
+}
+
 int SketchObject::addGeometry(const Part::Geometry* geo, bool construction /*=false*/)
 {
     // this copy has a new random tag (see copy() vs clone())
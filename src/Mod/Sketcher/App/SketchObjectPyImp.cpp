@@ -65,6 +65,67 @@ PyObject* SketchObjectPy::solve(PyObject* args)
     return Py_BuildValue("i", ret);
 }
 
+namespace
+{
+// Collects the supported geometry of a Python sequence, converting trimmed curves to arcs. The
+// converted geometry is owned by tmpList.
+bool getGeometryList(
+    const Py::Sequence& list,
+    std::vector<Part::Geometry*>& geoList,
+    std::vector<std::shared_ptr<Part::Geometry>>& tmpList
+)
+{
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        if (PyObject_TypeCheck((*it).ptr(), &(Part::GeometryPy::Type))) {
+            Part::Geometry* geo = static_cast<Part::GeometryPy*>((*it).ptr())->getGeometryPtr();
+
+            // An arc created with Part.Arc will be converted into a Part.ArcOfCircle
+            if (geo->is<Part::GeomTrimmedCurve>()) {
+                Handle(Geom_TrimmedCurve) trim = Handle(Geom_TrimmedCurve)::DownCast(geo->handle());
+                Handle(Geom_Circle) circle = Handle(Geom_Circle)::DownCast(trim->BasisCurve());
+                Handle(Geom_Ellipse) ellipse = Handle(Geom_Ellipse)::DownCast(trim->BasisCurve());
+                if (!circle.IsNull()) {
+                    // create the definition struct for that geom
+                    std::shared_ptr<Part::GeomArcOfCircle> aoc(new Part::GeomArcOfCircle());
+                    aoc->setHandle(trim);
+                    geoList.push_back(aoc.get());
+                    tmpList.push_back(aoc);
+                }
+                else if (!ellipse.IsNull()) {
+                    // create the definition struct for that geom
+                    std::shared_ptr<Part::GeomArcOfEllipse> aoe(new Part::GeomArcOfEllipse());
+                    aoe->setHandle(trim);
+                    geoList.push_back(aoe.get());
+                    tmpList.push_back(aoe);
+                }
+                else {
+                    std::stringstream str;
+                    str << "Unsupported geometry type: " << geo->getTypeId().getName();
+                    PyErr_SetString(PyExc_TypeError, str.str().c_str());
+                    return false;
+                }
+            }
+            else if (
+                geo->is<Part::GeomPoint>() || geo->is<Part::GeomCircle>()
+                || geo->is<Part::GeomEllipse>() || geo->is<Part::GeomArcOfCircle>()
+                || geo->is<Part::GeomArcOfEllipse>() || geo->is<Part::GeomArcOfHyperbola>()
+                || geo->is<Part::GeomArcOfParabola>() || geo->is<Part::GeomBSplineCurve>()
+                || geo->is<Part::GeomLineSegment>()
+            ) {
+                geoList.push_back(geo);
+            }
+            else {
+                std::stringstream str;
+                str << "Unsupported geometry type: " << geo->getTypeId().getName();
+                PyErr_SetString(PyExc_TypeError, str.str().c_str());
+                return false;
+            }
+        }
+    }
+    return true;
+}
+}  // namespace
+
 PyObject* SketchObjectPy::addGeometry(PyObject* args)
 {
     PyObject* pcObj;
@@ -129,54 +190,8 @@ PyObject* SketchObjectPy::addGeometry(PyObject* args)
     else if (PyObject_TypeCheck(pcObj, &(PyList_Type)) || PyObject_TypeCheck(pcObj, &(PyTuple_Type))) {
         std::vector<Part::Geometry*> geoList;
         std::vector<std::shared_ptr<Part::Geometry>> tmpList;
-        Py::Sequence list(pcObj);
-        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
-            if (PyObject_TypeCheck((*it).ptr(), &(Part::GeometryPy::Type))) {
-                Part::Geometry* geo = static_cast<Part::GeometryPy*>((*it).ptr())->getGeometryPtr();
-
-                // An arc created with Part.Arc will be converted into a Part.ArcOfCircle
-                if (geo->is<Part::GeomTrimmedCurve>()) {
-                    Handle(Geom_TrimmedCurve)
-                        trim = Handle(Geom_TrimmedCurve)::DownCast(geo->handle());
-                    Handle(Geom_Circle) circle = Handle(Geom_Circle)::DownCast(trim->BasisCurve());
-                    Handle(Geom_Ellipse) ellipse = Handle(Geom_Ellipse)::DownCast(trim->BasisCurve());
-                    if (!circle.IsNull()) {
-                        // create the definition struct for that geom
-                        std::shared_ptr<Part::GeomArcOfCircle> aoc(new Part::GeomArcOfCircle());
-                        aoc->setHandle(trim);
-                        geoList.push_back(aoc.get());
-                        tmpList.push_back(aoc);
-                    }
-                    else if (!ellipse.IsNull()) {
-                        // create the definition struct for that geom
-                        std::shared_ptr<Part::GeomArcOfEllipse> aoe(new Part::GeomArcOfEllipse());
-                        aoe->setHandle(trim);
-                        geoList.push_back(aoe.get());
-                        tmpList.push_back(aoe);
-                    }
-                    else {
-                        std::stringstream str;
-                        str << "Unsupported geometry type: " << geo->getTypeId().getName();
-                        PyErr_SetString(PyExc_TypeError, str.str().c_str());
-                        return nullptr;
-                    }
-                }
-                else if (
-                    geo->is<Part::GeomPoint>() || geo->is<Part::GeomCircle>()
-                    || geo->is<Part::GeomEllipse>() || geo->is<Part::GeomArcOfCircle>()
-                    || geo->is<Part::GeomArcOfEllipse>() || geo->is<Part::GeomArcOfHyperbola>()
-                    || geo->is<Part::GeomArcOfParabola>() || geo->is<Part::GeomBSplineCurve>()
-                    || geo->is<Part::GeomLineSegment>()
-                ) {
-                    geoList.push_back(geo);
-                }
-                else {
-                    std::stringstream str;
-                    str << "Unsupported geometry type: " << geo->getTypeId().getName();
-                    PyErr_SetString(PyExc_TypeError, str.str().c_str());
-                    return nullptr;
-                }
-            }
+        if (!getGeometryList(Py::Sequence(pcObj), geoList, tmpList)) {
+            return nullptr;
         }
 
         int ret = this->getSketchObjectPtr()->addGeometry(geoList, isConstruction) + 1;
@@ -195,6 +210,74 @@ PyObject* SketchObjectPy::addGeometry(PyObject* args)
     throw Py::TypeError(error);
 }
 
+PyObject* SketchObjectPy::addGeometryAndConstraints(PyObject* args)
+{
+    PyObject* pcGeoObj;
+    PyObject* pcConstrObj;
+    PyObject* construction = Py_False;
+    PyObject* solve = Py_True;
+    if (!PyArg_ParseTuple(
+            args,
+            "OO|O!O!",
+            &pcGeoObj,
+            &pcConstrObj,
+            &PyBool_Type,
+            &construction,
+            &PyBool_Type,
+            &solve
+        )) {
+        return nullptr;
+    }
+
+    std::vector<Part::Geometry*> geoList;
+    std::vector<std::shared_ptr<Part::Geometry>> tmpList;
+    if (!getGeometryList(Py::Sequence(pcGeoObj), geoList, tmpList)) {
+        return nullptr;
+    }
+
+    std::vector<Constraint*> constraintList;
+    Py::Sequence list(pcConstrObj);
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        if (PyObject_TypeCheck((*it).ptr(), &(ConstraintPy::Type))) {
+            constraintList.push_back(static_cast<ConstraintPy*>((*it).ptr())->getConstraintPtr());
+        }
+    }
+
+    SketchObject* sketch = this->getSketchObjectPtr();
+    int firstGeoId = sketch->getHighestCurveIndex() + 1;
+    int firstConstrId = sketch->Constraints.getSize();
+    if (sketch->addGeometryAndConstraints(geoList, constraintList, Base::asBoolean(construction))) {
+        PyErr_SetString(
+            PyExc_IndexError,
+            QT_TRANSLATE_NOOP(
+                "Notifications",
+                "The constraint has invalid index information and is malformed."
+            )
+        );
+        return nullptr;
+    }
+
+    // see addConstraint for why the solve is done here
+    if (Base::asBoolean(solve)) {
+        sketch->solve();
+        if (sketch->noRecomputes) {
+            sketch->setUpSketch();
+            sketch->Constraints.touch();  // update solver information
+        }
+    }
+
+    Py::Tuple geoIds(geoList.size());
+    for (std::size_t i = 0; i < geoList.size(); ++i) {
+        geoIds.setItem(i, Py::Long(firstGeoId + int(i)));
+    }
+    Py::Tuple constrIds(constraintList.size());
+    for (std::size_t i = 0; i < constraintList.size(); ++i) {
+        constrIds.setItem(i, Py::Long(firstConstrId + int(i)));
+    }
+
+    return Py::new_reference_to(Py::TupleN(geoIds, constrIds));
+}
+
 PyObject* SketchObjectPy::delGeometry(PyObject* args)
 {
     int Index;
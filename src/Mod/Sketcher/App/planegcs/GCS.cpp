@@ -49,7 +49,6 @@
 #endif
 
 #include <algorithm>
-#include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
@@ -98,6 +97,7 @@
 #endif
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <FCConfig.h>
 
 #include <boost/graph/connected_components.hpp>
@@ -491,6 +491,7 @@ System::System()
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
+    , parallelSolve(true)
     , LM_eps(1E-10)
     , LM_eps1(1E-80)
     , LM_tau(1E-3)
@@ -523,6 +524,8 @@ void System::clear()
     pIndex.clear();
     pDependentParameters.clear();
     pDependentParametersGroups.clear();
+    dependentParametersPending = false;
+    dependencyJacobian.resize(0, 0);
     hasUnknowns = false;
     hasDiagnosis = false;
 
@@ -546,6 +549,8 @@ void System::invalidatedDiagnosis()
     hasDiagnosis = false;
     pDependentParameters.clear();
     pDependentParametersGroups.clear();
+    dependentParametersPending = false;
+    dependencyJacobian.resize(0, 0);
 }
 
 void System::clearByTag(int tagId)
@@ -1872,6 +1877,16 @@ void System::initSolution(Algorithm alg)
         }
     }
 
+    componentSolves.resize(clists.size());
+    for (std::size_t cid = 0; cid < clists.size(); ++cid) {
+        SET_pD inputs(plists[cid].begin(), plists[cid].end());
+        for (const auto constr : clists[cid]) {
+            const VEC_pD& cparams = c2p[constr];
+            inputs.insert(cparams.begin(), cparams.end());
+        }
+        componentSolves[cid].inputParams.assign(inputs.begin(), inputs.end());
+    }
+
     isInit = true;
 }
 
@@ -1908,23 +1923,38 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
+    // the components that have something to solve
+    std::vector<int> cids;
+    for (int cid = 0; cid < int(subSystems.size()); cid++) {
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            cids.push_back(cid);
+        }
+    }
+    if (!cids.empty()) {
+        resetToReference();
+    }
+
     // return success by default in order to permit coincidence constraints to be applied
     // even if no other system has to be solved
     int res = Success;
-    for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
-        }
-        if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
-        }
-        else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+    // The components share no parameters and no constraints, so they can be solved in any order.
+    // Iteration level debugging logs to Base::Console, which must stay in this thread.
+    bool parallel = parallelSolve && cids.size() > 1 && debugMode != IterationLevel;
+#ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
+    parallel = false;
+#endif
+    if (parallel) {
+        std::vector<int> results(cids.size(), Success);
+        Base::parallelFor(cids.size(), [&](std::size_t i) {
+            results[i] = solveComponent(cids[i], isFine, alg, isRedundantsolving);
+        });
+        for (int result : results) {
+            res = std::max(res, result);
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    }
+    else {
+        for (int cid : cids) {
+            res = std::max(res, solveComponent(cid, isFine, alg, isRedundantsolving));
         }
     }
     if (res == Success) {
@@ -1944,6 +1974,40 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
     return res;
 }
 
+int System::solveComponent(int cid, bool isFine, Algorithm alg, bool isRedundantsolving)
+{
+    // A component whose inputs are those of its last solve would give the same result again, and
+    // its subsystems still hold that solution. This spares untouched components while dragging.
+    ComponentSolve& last = componentSolves[cid];
+    VEC_D inputValues;
+    inputValues.reserve(last.inputParams.size());
+    for (const auto param : last.inputParams) {
+        inputValues.push_back(*param);
+    }
+    if (last.alg == alg && last.isFine == isFine && last.isRedundantsolving == isRedundantsolving
+        && last.inputValues == inputValues) {
+        return last.result;
+    }
+
+    int res;
+    if (subSystems[cid] && subSystemsAux[cid]) {
+        res = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
+    }
+    else if (subSystems[cid]) {
+        res = solve(subSystems[cid], isFine, alg, isRedundantsolving);
+    }
+    else {
+        res = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+    }
+
+    last.inputValues = std::move(inputValues);
+    last.result = res;
+    last.alg = alg;
+    last.isFine = isFine;
+    last.isRedundantsolving = isRedundantsolving;
+    return res;
+}
+
 int System::solve(SubSystem* subsys, bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (alg == BFGS) {
@@ -2087,12 +2151,93 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+// Solves the augmented normal equations A*h = g of a Levenberg-Marquardt step
+void solveNormalEquations(const Eigen::MatrixXd& A, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+{
+    h = A.fullPivLu().solve(g);
+}
+
+// Gets the Gauss-Newton step h of the DogLeg solver, i.e. solves J*h = -fx
+// https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+// https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+void calcGaussNewtonStep(
+    const Eigen::MatrixXd& J,
+    const Eigen::VectorXd& fx,
+    DogLegGaussStep gaussStep,
+    Eigen::VectorXd& h
+)
+{
+    switch (gaussStep) {
+        case FullPivLU:
+            h = J.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h = J.adjoint() * (J * J.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h = J.adjoint() * (J * J.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+void solveNormalEquations(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::VectorXd& g,
+    Eigen::VectorXd& h
+)
+{
+    // A is symmetric and, being damped, positive definite
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(A);
+    if (ldlt.info() == Eigen::Success) {
+        h = ldlt.solve(g);
+    }
+    else {
+        h.setZero();  // rejected by the caller through its residual check
+    }
+}
+
+// The sparse step is always the least norm one. Ldlt of J*J^T is tried first, as it is much
+// cheaper than a QR of J; the QR only handles rank deficient Jacobians.
+void calcGaussNewtonStep(
+    const Eigen::SparseMatrix<double>& J,
+    const Eigen::VectorXd& fx,
+    DogLegGaussStep /*gaussStep*/,
+    Eigen::VectorXd& h
+)
+{
+    Eigen::SparseMatrix<double> JJt = J * J.transpose();
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(JJt);
+    if (ldlt.info() == Eigen::Success) {
+        h = J.transpose() * ldlt.solve(-fx);
+        return;
+    }
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr(J);
+    h = qr.solve(-fx);
+}
+#endif
+}  // namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (qrAlgorithm == EigenSparseQR) {
+        return solveLM<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solveLM<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename MatrixType>
+int System::solveLM(SubSystem* subsys, bool isRedundantsolving)
+{
+
     int xsize = subsys->pSize();
     int csize = subsys->cSize();
 
@@ -2102,8 +2247,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    MatrixType J(csize, xsize);  // Jacobi of the subsystem
+    MatrixType A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2180,11 +2325,11 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         while (k < 50) {
             // augment normal equations A = A+uI
             for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
+                A.coeffRef(i, i) += mu;
             }
 
             // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
+            solveNormalEquations(A, g, h);
             double rel_error = (A * h - g).norm() / g.norm();
 
             // check if solving works
@@ -2236,7 +2381,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
             mu *= nu;
             nu *= 2.0;
             for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
+                A.coeffRef(i, i) = diag_A(i);
             }
 
             k++;
@@ -2272,6 +2417,18 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
     extractSubsystem(subsys, isRedundantsolving);
 #endif
 
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (qrAlgorithm == EigenSparseQR) {
+        return solveDL<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solveDL<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename MatrixType>
+int System::solveDL(SubSystem* subsys, bool isRedundantsolving)
+{
+
     int xsize = subsys->pSize();
     int csize = subsys->cSize();
 
@@ -2310,7 +2467,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    MatrixType Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2362,19 +2519,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        calcGaussNewtonStep(Jx, fx, dogLegGaussStep, h_gn);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -4784,6 +4929,9 @@ int System::diagnose(Algorithm alg)
     //         two high priority constraints. For this reason, tagging
     //         constraints with 0 should be used carefully.
     hasDiagnosis = false;
+    pDependentParameters.clear();
+    pDependentParametersGroups.clear();
+    dependentParametersPending = false;
     if (!hasUnknowns) {
         dofs = -1;
         return dofs;
@@ -4924,26 +5072,10 @@ int System::diagnose(Algorithm alg)
         int rank = 0;  // rank is not cheap to retrieve from qrJT in DenseQR
         Eigen::MatrixXd R;
         Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT;
-        // Here we give the system the possibility to run the two QR decompositions in parallel,
-        // depending on the load of the system so we are using the default std::launch::async |
-        // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
-        //
-        // identifyDependentParametersDenseQR(J, jacobianconstraintmap, pdiagnoselist, true)
-        //
-        auto fut = std::async(
-            &System::identifyDependentParametersDenseQR,
-            this,
-            J,
-            jacobianconstraintmap,
-            pdiagnoselist,
-            true
-        );
+        // The second QR decomposition, identifying the dependent parameters, is left for when
+        // they are asked for. The copy must be taken here, because the redundant solve below
+        // modifies pdiagnoselist.
+        deferDependentParameters(J, jacobianconstraintmap, pdiagnoselist);
 
         makeDenseQRDecomposition(J, jacobianconstraintmap, qrJT, rank, R);
 
@@ -4956,8 +5088,6 @@ int System::diagnose(Algorithm alg)
         // identifyDependentGeometryParametersInTransposedJacobianDenseQRDecomposition( qrJT,
         // pdiagnoselist, paramsNum, rank);
 
-        fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
-
         dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
 
         // Detecting conflicting or redundant constraints
@@ -4997,30 +5127,8 @@ int System::diagnose(Algorithm alg)
         int rank = 0;
         Eigen::MatrixXd R;
         Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT;
-        // Here we give the system the possibility to run the two QR decompositions in parallel,
-        // depending on the load of the system so we are using the default std::launch::async |
-        // std::launch::deferred policy, as nobody better than the system nows if it can run the
-        // task in parallel or is oversubscribed and should deferred it. Care to wait() for the
-        // future before any prospective detection of conflicting/redundant, because the
-        // redundant solve modifies pdiagnoselist and it would NOT be thread-safe. Care to call
-        // the thread with silent=true, unless the present thread does not use Base::Console, or
-        // the launch policy is set to std::launch::deferred policy, as it is not thread-safe to
-        // use them in both at the same time.
-        //
-        // identifyDependentParametersSparseQR(J, jacobianconstraintmap, pdiagnoselist, true)
-        //
-        // Debug:
-        // auto fut =
-        // std::async(std::launch::deferred,&System::identifyDependentParametersSparseQR, this,
-        // J, jacobianconstraintmap, pdiagnoselist, false);
-        auto fut = std::async(
-            &System::identifyDependentParametersSparseQR,
-            this,
-            J,
-            jacobianconstraintmap,
-            pdiagnoselist,
-            /*silent=*/true
-        );
+        // see the DenseQR case
+        deferDependentParameters(J, jacobianconstraintmap, pdiagnoselist);
 
         makeSparseQRDecomposition(
             J,
@@ -5035,8 +5143,6 @@ int System::diagnose(Algorithm alg)
         int paramsNum = SqrJT.rows();
         int constrNum = SqrJT.cols();
 
-        fut.wait();  // wait for the execution of identifyDependentParametersSparseQR to finish
-
         dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
 
         // Detecting conflicting or redundant constraints
@@ -5251,6 +5357,53 @@ void System::makeSparseQRDecomposition(
 }
 #endif  // EIGEN_SPARSEQR_COMPATIBLE
 
+void System::deferDependentParameters(
+    const Eigen::MatrixXd& J,
+    const std::map<int, int>& jacobianconstraintmap,
+    const GCS::VEC_pD& pdiagnoselist
+)
+{
+    dependencyJacobian = J;
+    dependencyConstraintMap = jacobianconstraintmap;
+    dependencyParams = pdiagnoselist;
+    dependencyQRAlgorithm = qrAlgorithm;
+    dependentParametersPending = true;
+}
+
+void System::identifyPendingDependentParameters() const
+{
+    if (!dependentParametersPending) {
+        return;
+    }
+    dependentParametersPending = false;
+
+    // only the mutable dependent parameter lists are written
+    auto self = const_cast<System*>(this);
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (dependencyQRAlgorithm == EigenSparseQR) {
+        self->identifyDependentParametersSparseQR(
+            dependencyJacobian,
+            dependencyConstraintMap,
+            dependencyParams,
+            /*silent=*/true
+        );
+    }
+    else
+#endif
+    {
+        self->identifyDependentParametersDenseQR(
+            dependencyJacobian,
+            dependencyConstraintMap,
+            dependencyParams,
+            /*silent=*/true
+        );
+    }
+
+    dependencyJacobian.resize(0, 0);
+    dependencyConstraintMap.clear();
+    dependencyParams.clear();
+}
+
 void System::identifyDependentParametersDenseQR(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
@@ -5713,6 +5866,7 @@ void System::clearSubSystems()
     deleteAllContent(subSystemsAux);
     subSystems.clear();
     subSystemsAux.clear();
+    componentSolves.clear();
 }
 
 double lineSearch(SubSystem* subsys, Eigen::VectorXd& xdir)
@@ -112,11 +112,25 @@ private:
     VEC_pD pdrivenlist;  // list of parameters of driven constraints
     MAP_pD_I pIndex;
 
-    VEC_pD pDependentParameters;  // list of dependent parameters by the system
+    mutable VEC_pD pDependentParameters;  // list of dependent parameters by the system
 
     // This is a map of primary and secondary identifiers that are found dependent by the solver
     // GCS ignores from a type point
-    std::vector<std::vector<double*>> pDependentParametersGroups;
+    mutable std::vector<std::vector<double*>> pDependentParametersGroups;
+
+    // The dependent parameters are only identified when asked for, from the reduced Jacobian of
+    // the last diagnosis. Many diagnoses, e.g. those only counting DoFs, never need them.
+    mutable bool dependentParametersPending = false;
+    mutable Eigen::MatrixXd dependencyJacobian;
+    mutable std::map<int, int> dependencyConstraintMap;
+    mutable VEC_pD dependencyParams;
+    QRAlgorithm dependencyQRAlgorithm = EigenDenseQR;
+    void deferDependentParameters(
+        const Eigen::MatrixXd& J,
+        const std::map<int, int>& jacobianconstraintmap,
+        const GCS::VEC_pD& pdiagnoselist
+    );
+    void identifyPendingDependentParameters() const;
 
     std::vector<Constraint*> clist;
     std::vector<Constraint*> drivenConstraints;
@@ -126,6 +140,19 @@ private:
     std::vector<SubSystem*> subSystems, subSystemsAux;
     void clearSubSystems();
 
+    // the last solve of each decoupled component, so that unchanged components can be skipped
+    struct ComponentSolve
+    {
+        VEC_pD inputParams;  // all parameters the constraints of the component read
+        VEC_D inputValues;   // their values at the last solve
+        int result = Failed;
+        int alg = -1;
+        bool isFine = false;
+        bool isRedundantsolving = false;
+    };
+    std::vector<ComponentSolve> componentSolves;
+    int solveComponent(int cid, bool isFine, Algorithm alg, bool isRedundantsolving);
+
     VEC_D reference;
     void setReference();      // copies the current parameter values to reference
     void resetToReference();  // reverts all parameter values to the stored reference
@@ -148,6 +175,11 @@ private:
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // the solvers with dense or, for EigenSparseQR, sparse Jacobians
+    template<typename MatrixType>
+    int solveLM(SubSystem* subsys, bool isRedundantsolving);
+    template<typename MatrixType>
+    int solveDL(SubSystem* subsys, bool isRedundantsolving);
 
     void makeReducedJacobian(
         Eigen::MatrixXd& J,
@@ -244,6 +276,7 @@ public:
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
+    bool parallelSolve;  // if true decoupled components are solved concurrently
     double LM_eps;
     double LM_eps1;
     double LM_tau;
@@ -651,10 +684,12 @@ public:
     }
     void getDependentParams(VEC_pD& pdependentparameterlist) const
     {
+        identifyPendingDependentParameters();
         pdependentparameterlist = pDependentParameters;
     }
     void getDependentParamsGroups(std::vector<std::vector<double*>>& pdependentparametergroups) const
     {
+        identifyPendingDependentParameters();
         pdependentparametergroups = pDependentParametersGroups;
     }
     bool isEmptyDiagnoseMatrix() const
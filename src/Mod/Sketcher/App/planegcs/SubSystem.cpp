@@ -269,6 +269,19 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    // columns follow pvals, as in calcJacobi(plist, jacobi)
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        for (double* param : c2p[clist[i]]) {
+            triplets.emplace_back(i, static_cast<int>(param - pvals.data()), clist[i]->grad(param));
+        }
+    }
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(triplets.begin(), triplets.end());
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
@@ -28,6 +28,7 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "Constraints.h"
 
@@ -79,6 +80,7 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
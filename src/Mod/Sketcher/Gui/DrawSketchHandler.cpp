@@ -586,16 +586,19 @@ void DrawSketchHandler::seekTangentAutoConstraint(
     // Decrease this value when a candidate is found.
     double tangDeviation = 0.1 * sketchgui->getScaleFactor();
 
-    // Get geometry list
-    const std::vector<Part::Geometry*> geomlist = obj->getCompleteGeometry();
-
     Base::Vector3d tmpPos(Pos.x, Pos.y, 0.f);                    // Current cursor point
     Base::Vector3d tmpDir(Dir.x, Dir.y, 0.f);                    // Direction of line
     Base::Vector3d tmpStart(Pos.x - Dir.x, Pos.y - Dir.y, 0.f);  // Start point
 
-    int i = -1;
-    for (auto* geo : geomlist) {
-        i++;
+    // Only curves passing within the deviation of the drawn segment are candidates
+    Base::BoundBox2d searchBox(tmpStart.x, tmpStart.y, tmpPos.x, tmpPos.y);
+    searchBox.MinX -= tangDeviation;
+    searchBox.MinY -= tangDeviation;
+    searchBox.MaxX += tangDeviation;
+    searchBox.MaxY += tangDeviation;
+
+    for (int i : obj->getGeometryInBox(searchBox)) {
+        const Part::Geometry* geo = obj->getGeometry(i);
 
         if (geo->is<Part::GeomCircle>()) {
             auto* circle = static_cast<const Part::GeomCircle*>(geo);
@@ -729,9 +732,6 @@ void DrawSketchHandler::seekTangentAutoConstraint(
     }
 
     if (tangId != GeoEnum::GeoUndef) {
-        if (tangId > getHighestCurveIndex()) {  // external Geometry
-            tangId = getHighestCurveIndex() - tangId;
-        }
         AutoConstraint constr;
         constr.Type = Tangent;
         constr.GeoId = tangId;
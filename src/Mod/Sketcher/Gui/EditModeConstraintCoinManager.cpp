@@ -1939,6 +1939,7 @@ void EditModeConstraintCoinManager::rebuildConstraintNodes(const GeoListFacade&
 
     // clean up
     Gui::coinRemoveAllChildren(editModeScenegraphNodes.constrGroup);
+    sentIconKeys.clear();
 
     vConstrType.clear();
 
@@ -2909,11 +2910,39 @@ void EditModeConstraintCoinManager::drawTypicalConstraintIcon(const constrIconQu
 {
     QColor color = constrColor(i.constraintId);
 
-    QImage image
-        = renderConstrIcon(i.type, color, QStringList(i.label), QList<QColor>() << color, i.iconRotation);
-
     i.infoPtr->string.setValue(QString::number(i.constraintId).toLatin1().data());
-    sendConstraintIconToCoin(image, i.destination);
+
+    // Most icons are unchanged between two draws, e.g. while dragging. Then skip rendering them
+    // and, more importantly, sending them to Coin, which replaces the texture of the SoImage.
+    QString key = QStringLiteral("%1|%2|%3|%4|%5")
+                      .arg(i.type)
+                      .arg(color.rgba())
+                      .arg(i.iconRotation)
+                      .arg(drawingParameters.constraintIconSize)
+                      .arg(i.label);
+    auto sent = sentIconKeys.find(i.destination);
+    if (sent != sentIconKeys.end() && sent->second == key) {
+        return;
+    }
+
+    auto rendered = renderedIcons.constFind(key);
+    if (rendered == renderedIcons.constEnd()) {
+        constexpr qsizetype maxRenderedIcons = 1000;
+        if (renderedIcons.size() >= maxRenderedIcons) {
+            renderedIcons.clear();
+        }
+        QImage image = renderConstrIcon(
+            i.type,
+            color,
+            QStringList(i.label),
+            QList<QColor>() << color,
+            i.iconRotation
+        );
+        rendered = renderedIcons.insert(key, image);
+    }
+
+    sendConstraintIconToCoin(*rendered, i.destination);
+    sentIconKeys[i.destination] = key;
 }
 
 QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constraint)
@@ -2952,6 +2981,8 @@ QString EditModeConstraintCoinManager::iconTypeFromConstraint(Constraint* constr
 
 void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon, SoImage* soImagePtr)
 {
+    sentIconKeys.erase(soImagePtr);
+
     SoSFImage icondata = SoSFImage();
 
     Gui::BitmapFactory().convert(icon, icondata);
@@ -2968,6 +2999,7 @@ void EditModeConstraintCoinManager::sendConstraintIconToCoin(const QImage& icon,
 
 void EditModeConstraintCoinManager::clearCoinImage(SoImage* soImagePtr)
 {
+    sentIconKeys.erase(soImagePtr);
     soImagePtr->setToDefaults();
 }
 
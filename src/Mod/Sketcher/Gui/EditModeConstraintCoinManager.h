@@ -25,9 +25,11 @@
 #pragma once
 
 #include <functional>
+#include <unordered_map>
 #include <vector>
 
 #include <QColor>
+#include <QHash>
 #include <QImage>
 #include <QRect>
 
@@ -274,6 +276,11 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    /// The key of the icon last sent to each SoImage, an unchanged icon is not sent again
+    std::unordered_map<SoImage*, QString> sentIconKeys;
+    /// Rendered single constraint icons by key
+    QHash<QString, QImage> renderedIcons;
 };
 
 
@@ -24,6 +24,8 @@
 
 #include <FCConfig.h>
 
+#include <algorithm>
+
 #include <Base/Console.h>
 #include <Base/Exception.h>
 
@@ -38,18 +40,60 @@
 
 using namespace SketcherGui;
 
+std::pair<CurveDiscretizationCache::Entry&, bool> CurveDiscretizationCache::find(
+    int geoId,
+    const Part::Geometry* geometry,
+    int numSegments
+)
+{
+    // well below what can be seen, but above the noise of a solver run that did not move the curve
+    constexpr double tolerance = 1e-12;
+
+    Item& item = items[geoId];
+    item.used = true;
+    if (item.geometry && item.numSegments == numSegments
+        && item.geometry->isSame(*geometry, tolerance, tolerance)) {
+        return {item.entry, true};
+    }
+
+    item.geometry.reset(geometry->copy());
+    item.numSegments = numSegments;
+    item.entry = Entry();
+    return {item.entry, false};
+}
+
+void CurveDiscretizationCache::prune()
+{
+    for (auto it = items.begin(); it != items.end();) {
+        if (!it->second.used) {
+            it = items.erase(it);
+        }
+        else {
+            it->second.used = false;
+            ++it;
+        }
+    }
+}
+
+void CurveDiscretizationCache::clear()
+{
+    items.clear();
+}
+
 EditModeGeometryCoinConverter::EditModeGeometryCoinConverter(
     ViewProviderSketch& vp,
     GeometryLayerNodes& geometrylayernodes,
     DrawingParameters& drawingparameters,
     GeometryLayerParameters& geometryLayerParams,
-    CoinMapping& coinMap
+    CoinMapping& coinMap,
+    CurveDiscretizationCache& curveCache
 )
     : viewProvider(vp)
     , geometryLayerNodes(geometrylayernodes)
     , drawingParameters(drawingparameters)
     , geometryLayerParameters(geometryLayerParams)
     , coinMapping(coinMap)
+    , curveCache(curveCache)
 {}
 
 void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geolistfacade)
@@ -276,6 +320,8 @@ void EditModeGeometryCoinConverter::convert(const Sketcher::GeoListFacade& geoli
         }
     }
 
+    curveCache.prune();
+
     // Coin Nodes Editing
     int vOrFactor = ViewProviderSketchCoinAttorney::getViewOrientationFactor(viewProvider);
     double linez = vOrFactor * static_cast<double>(drawingParameters.zLowLines);  // NOLINT
@@ -376,15 +422,20 @@ void EditModeGeometryCoinConverter::convert(
             numSegments *= geo->countKnots();
         }
 
-        double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
+        auto [cached, upToDate] = curveCache.find(geoid, geo, numSegments);
+        if (!upToDate) {
+            double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
 
-        for (int i = 0; i < numSegments; i++) {
-            Base::Vector3d pnt = geo->value(i * segment);
-            addPoint(Coords[coinLayer][subLayer], pnt);
+            for (int i = 0; i < numSegments; i++) {
+                cached.points.push_back(geo->value(i * segment));
+            }
+
+            cached.points.push_back(geo->value(0));
         }
 
-        Base::Vector3d pnt = geo->value(0);
-        addPoint(Coords[coinLayer][subLayer], pnt);
+        for (const auto& pnt : cached.points) {
+            addPoint(Coords[coinLayer][subLayer], pnt);
+        }
 
         Index[coinLayer][subLayer].push_back(numSegments + 1);
     }
@@ -394,19 +445,29 @@ void EditModeGeometryCoinConverter::convert(
             numSegments *= (geo->countKnots() - 1);  // one less segments than knots
         }
 
-        double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
+        auto [cached, upToDate] = curveCache.find(geoid, geo, numSegments);
+        if (!upToDate) {
+            double segment = (geo->getLastParameter() - geo->getFirstParameter()) / numSegments;
 
-        for (int i = 0; i < numSegments; i++) {
-            Base::Vector3d pnt = geo->value(geo->getFirstParameter() + i * segment);
-            addPoint(Coords[coinLayer][subLayer], pnt);
+            for (int i = 0; i < numSegments; i++) {
+                cached.points.push_back(geo->value(geo->getFirstParameter() + i * segment));
+            }
+
+            cached.points.push_back(geo->value(geo->getLastParameter()));
         }
 
-        Base::Vector3d pnt = geo->value(geo->getLastParameter());
-        addPoint(Coords[coinLayer][subLayer], pnt);
+        for (const auto& pnt : cached.points) {
+            addPoint(Coords[coinLayer][subLayer], pnt);
+        }
 
         Index[coinLayer][subLayer].push_back(numSegments + 1);
 
         if constexpr (analysemode == AnalyseMode::BoundingBoxMagnitudeAndBSplineCurvature) {
+            if (upToDate) {
+                combrepscale = std::max(combrepscale, cached.combRepresentationScale);
+                return;
+            }
+
             //***************************************************************************************************************
             // global information gathering for geometry information layer
 
@@ -470,6 +531,7 @@ void EditModeGeometryCoinConverter::convert(
                 temprepscale = (0.5 * maxdisttocenterofmass)
                     / maxcurv;  // just a factor to make a comb reasonably visible
             }
+            cached.combRepresentationScale = temprepscale;
 
             if (temprepscale > combrepscale) {
                 combrepscale = temprepscale;
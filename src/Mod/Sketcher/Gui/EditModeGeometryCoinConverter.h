@@ -24,8 +24,13 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <Mod/Part/App/Geometry.h>
+
 #include "ViewProviderSketch.h"
 
 
@@ -56,6 +61,44 @@ struct DrawingParameters;
 class GeometryLayerParameters;
 struct CoinMapping;
 
+/** @brief      Discretized curves of the previous conversions
+ *  @details
+ * Most curves are unchanged from one draw to the next, e.g. all but the few moved while dragging.
+ * Comparing a curve with its copy from the previous draw is much cheaper than discretizing it
+ * again, and for B-splines than the curvature analysis.
+ */
+class CurveDiscretizationCache
+{
+public:
+    struct Entry
+    {
+        std::vector<Base::Vector3d> points;
+        /// Comb representation scale of a B-spline
+        double combRepresentationScale = 0;
+    };
+
+    /** Returns the entry for the curve with @p geoId and whether it is up to date, i.e. it was
+     * computed for the same geometry and number of segments. If not, the entry is emptied, the
+     * caller must fill it in.
+     */
+    std::pair<Entry&, bool> find(int geoId, const Part::Geometry* geometry, int numSegments);
+
+    /// Removes the entries of the curves that were not looked up since the last call
+    void prune();
+
+    void clear();
+
+private:
+    struct Item
+    {
+        std::unique_ptr<Part::Geometry> geometry;
+        int numSegments = 0;
+        bool used = false;
+        Entry entry;
+    };
+    std::unordered_map<int, Item> items;
+};
+
 /** @brief      Class for creating the Geometry layer into coin nodes
  *  @details
  * Responsibility:
@@ -115,7 +158,8 @@ public:
         GeometryLayerNodes& geometrylayernodes,
         DrawingParameters& drawingparameters,
         GeometryLayerParameters& geometryLayerParams,
-        CoinMapping& coinMap
+        CoinMapping& coinMap,
+        CurveDiscretizationCache& curveCache
     );
 
     /**
@@ -186,6 +230,7 @@ private:
     GeometryLayerParameters& geometryLayerParameters;
     // Mappings coin geoId
     CoinMapping& coinMapping;
+    CurveDiscretizationCache& curveCache;
 
     // measurements
     float boundingBoxMaxMagnitude = 100;
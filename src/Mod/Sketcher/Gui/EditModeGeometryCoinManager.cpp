@@ -113,7 +113,8 @@ void EditModeGeometryCoinManager::processGeometry(const GeoListFacade& geolistfa
         geometrylayernodes,
         drawingParameters,
         geometryLayerParameters,
-        coinMapping
+        coinMapping,
+        curveCache
     );
 
     gcconv.convert(geolistfacade);
@@ -30,6 +30,7 @@
 #include <Mod/Sketcher/App/GeoList.h>
 
 #include "EditModeCoinManagerParameters.h"
+#include "EditModeGeometryCoinConverter.h"
 
 
 class SbVec3f;
@@ -125,6 +126,8 @@ private:
     EditModeScenegraphNodes& editModeScenegraphNodes;
 
     CoinMapping& coinMapping;
+
+    CurveDiscretizationCache curveCache;
 };
 
 
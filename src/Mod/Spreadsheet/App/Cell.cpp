@@ -31,6 +31,7 @@
 
 
 #include <App/ExpressionParser.h>
+#include <App/ExpressionProgram.h>
 #include <Base/Console.h>
 #include <Base/Quantity.h>
 #include <Base/Reader.h>
@@ -213,6 +214,8 @@ void Cell::setExpression(App::ExpressionPtr&& expr)
     }
 
     expression = std::move(expr);
+    program.reset();
+    programEpoch = 0;
     setUsed(EXPRESSION_SET, !!expression);
 
     /* Update dependencies */
@@ -221,6 +224,23 @@ void Cell::setExpression(App::ExpressionPtr&& expr)
     signaller.tryInvoke();
 }
 
+/**
+ * Get the compiled expression tree, see App::ExpressionProgram.
+ * The program is compiled on first use and again when the referenced
+ * properties may have changed.
+ *
+ */
+
+const App::ExpressionProgram* Cell::getProgram() const
+{
+    std::size_t epoch = App::ExpressionProgram::currentEpoch();
+    if (programEpoch != epoch) {
+        program = App::ExpressionProgram::compile(expression.get());
+        programEpoch = epoch;
+    }
+    return program.get();
+}
+
 /**
  * Get the expression tree.
  *
@@ -918,6 +938,9 @@ void Cell::visit(App::ExpressionVisitor& v)
 {
     if (expression) {
         expression->visit(v);
+        // the visitor may have changed the expression
+        program.reset();
+        programEpoch = 0;
     }
 }
 
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <set>
 #include <string>
 
@@ -36,6 +37,11 @@
 #include "Utils.h"
 
 
+namespace App
+{
+class ExpressionProgram;
+}
+
 namespace Base
 {
 class Unit;
@@ -65,6 +71,9 @@ public:
 
     const App::Expression* getExpression(bool withFormat = false) const;
 
+    /// Get the compiled expression, or nullptr if the expression can't be compiled.
+    const App::ExpressionProgram* getProgram() const;
+
     bool getStringContent(std::string& s, bool persistent = false) const;
 
     void setContent(const char* value);
@@ -199,6 +208,8 @@ private:
 
     int used;
     mutable App::ExpressionPtr expression;
+    mutable std::shared_ptr<App::ExpressionProgram> program;
+    mutable std::size_t programEpoch {0};
     int alignment;
     std::set<std::string> style;
     Base::Color foregroundColor;
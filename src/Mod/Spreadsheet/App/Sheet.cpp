@@ -23,7 +23,9 @@
  ***************************************************************************/
 
 #include <boost/tokenizer.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
 #include <deque>
 #include <memory>
 #include <sstream>
@@ -42,8 +44,10 @@
 #include <App/DynamicProperty.h>
 #include <App/ExpressionParser.h>
 #include <App/FeaturePythonPyImp.h>
+#include <App/ExpressionProgram.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Parallel.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 
@@ -781,7 +785,7 @@ struct CurrentAddressLock
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, const App::any* value)
 {
     Cell* cell = getCell(key);
 
@@ -789,7 +793,11 @@ void Sheet::updateProperty(CellAddress key)
         std::unique_ptr<Expression> output;
         const Expression* input = cell->getExpression();
 
-        if (input) {
+        if (input && value) {
+            // already evaluated by the compiled expression, see recomputeCells()
+            output = std::make_unique<NumberExpression>(this, anyToQuantity(*value));
+        }
+        else if (input) {
             CurrentAddressLock lock(currentRow, currentCol, key);
             output = input->eval();
         }
@@ -925,12 +933,63 @@ void Sheet::recomputeCells(Range range)
     } while (range.next());
 }
 
+/**
+ * @brief Recompute cells level by level.
+ *
+ * The cells of a level only depend on cells of earlier levels. The compiled
+ * expressions of a level's cells are therefore evaluated in parallel, see
+ * App::ExpressionProgram. All other cells and the updates of the cell
+ * properties are handled in the calling thread.
+ *
+ * @param levels The cells to recompute grouped into levels.
+ */
+
+void Sheet::recomputeCells(const std::vector<std::vector<CellAddress>>& levels)
+{
+    // Below this number of cells threads cost more than they gain
+    const std::size_t minParallelCells = 256;
+
+    for (const auto& level : levels) {
+        std::vector<const ExpressionProgram*> programs(level.size(), nullptr);
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < level.size(); ++i) {
+            Cell* cell = cells.getValue(level[i]);
+            if (cell && !cell->hasException()) {
+                programs[i] = cell->getProgram();
+                if (programs[i]) {
+                    ++count;
+                }
+            }
+        }
+
+        std::vector<App::any> values(level.size());
+        std::vector<char> evaluated(level.size(), 0);
+        if (count > 0) {
+            Base::parallelFor(
+                level.size(),
+                [&](std::size_t i) {
+                    if (programs[i]) {
+                        evaluated[i] = programs[i]->evaluate(values[i]) ? 1 : 0;
+                    }
+                },
+                count >= minParallelCells ? 0 : 1
+            );
+        }
+
+        for (std::size_t i = 0; i < level.size(); ++i) {
+            FC_TRACE(level[i].toString());
+            recomputeCell(level[i], evaluated[i] ? &values[i] : nullptr);
+        }
+    }
+}
+
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value The value of the cell's expression if already evaluated.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, const App::any* value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -941,7 +1000,7 @@ void Sheet::recomputeCell(CellAddress p)
             cell->setContent(content.c_str());
         }
 
-        updateProperty(p);
+        updateProperty(p, value);
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -1114,13 +1173,25 @@ DocumentObjectExecReturn* Sheet::execute()
     // Sort graph topologically to find evaluation order
     try {
         boost::topological_sort(graph, std::front_inserter(make_order));
-        // Recompute cells
-        FC_LOG("recomputing " << getFullName());
+
+        // Group the cells into levels, a cell's level is one more than the
+        // highest level of the cells it depends on
+        std::vector<std::size_t> cellLevel(num_vertices(graph), 0);
+        std::vector<std::vector<CellAddress>> levels;
         for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+            std::size_t level = cellLevel[pos];
+            for (auto dep : boost::make_iterator_range(adjacent_vertices(pos, graph))) {
+                cellLevel[dep] = std::max(cellLevel[dep], level + 1);
+            }
+            if (levels.size() <= level) {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(VertexIndexList[pos]);
         }
+
+        // Recompute cells
+        FC_LOG("recomputing " << getFullName());
+        recomputeCells(levels);
     }
     catch (std::exception&) {
         for (auto& v : VertexList) {
@@ -258,13 +258,15 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, const App::any* value = nullptr);
+
+    void recomputeCells(const std::vector<std::vector<App::CellAddress>>& levels);
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, const App::any* value = nullptr);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
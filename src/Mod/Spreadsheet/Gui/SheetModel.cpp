@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
 #include <QAbstractItemModel>
 #include <QFont>
 #include <QLocale>
@@ -92,6 +94,7 @@ bool SheetModel::insertRows(int row, int count, const QModelIndex& parent)
     if (rows + count > CellAddress::MAX_ROWS) {
         return false;
     }
+    cache.clear();
 
     beginInsertRows(parent, rows, rows + count - 1);
     rows += count;
@@ -109,6 +112,7 @@ bool SheetModel::insertColumns(int column, int count, const QModelIndex& parent)
     if (cols + count > CellAddress::MAX_COLUMNS) {
         return false;
     }
+    cache.clear();
 
     beginInsertColumns(parent, column, column + count - 1);
     cols += count;
@@ -127,6 +131,7 @@ bool SheetModel::removeRows(int row, int count, const QModelIndex& parent)
         // Prevent the header from disappearing
         return false;
     }
+    cache.clear();
     beginRemoveRows(parent, row, row + count - 1);
     rows -= count;
     endRemoveRows();
@@ -140,6 +145,7 @@ bool SheetModel::removeColumns(int column, int count, const QModelIndex& parent)
         // Prevent the header from disappearing
         return false;
     }
+    cache.clear();
     beginRemoveColumns(parent, column, column + count - 1);
     cols -= count;
     endRemoveColumns();
@@ -193,6 +199,22 @@ QVariant formatCellDisplay(QString value, const Cell* cell)
 }  // namespace
 
 QVariant SheetModel::data(const QModelIndex& index, int role) const
+{
+    if (role < 0 || role > Qt::ForegroundRole
+        || !sheet->getCell(CellAddress(index.row(), index.column()))) {
+        return cellData(index, role);
+    }
+
+    CachedCell& cached = cache[cacheKey(index.row(), index.column())];
+    unsigned int bit = 1U << role;
+    if (!(cached.known & bit)) {
+        cached.values[role] = cellData(index, role);
+        cached.known |= bit;
+    }
+    return cached.values[role];
+}
+
+QVariant SheetModel::cellData(const QModelIndex& index, int role) const
 {
     static const Cell* emptyCell = new Cell(CellAddress(0, 0), nullptr);
     int row = index.row();
@@ -341,7 +363,7 @@ QVariant SheetModel::data(const QModelIndex& index, int role) const
         return QVariant::fromValue(f);
     }
 
-    auto dirtyCells = sheet->getCells()->getDirty();
+    const auto& dirtyCells = sheet->getCells()->getDirty();
     auto dirty = (dirtyCells.find(CellAddress(row, col)) != dirtyCells.end());
 
     if (!prop || dirty) {
@@ -695,8 +717,7 @@ void SheetModel::cellUpdated(CellAddress address)
 {
     containSheetDataInView();
     if (address.row() < rows && address.col() < cols) {
-        QModelIndex i = index(address.row(), address.col());
-        Q_EMIT dataChanged(i, i);
+        invalidate(address.row(), address.col(), address.row(), address.col());
     }
 }
 
@@ -704,10 +725,59 @@ void SheetModel::rangeUpdated(const Range& range)
 {
     containSheetDataInView();
     if (range.from().row() < rows && range.from().col() < cols) {
-        QModelIndex i = index(range.from().row(), range.from().col());
-        QModelIndex j
-            = index(std::min(range.to().row(), rows - 1), std::min(range.to().col(), cols - 1));
-        Q_EMIT dataChanged(i, j);
+        invalidate(
+            range.from().row(),
+            range.from().col(),
+            std::min(range.to().row(), rows - 1),
+            std::min(range.to().col(), cols - 1)
+        );
+    }
+}
+
+void SheetModel::invalidate(int top, int left, int bottom, int right)
+{
+    auto area = std::size_t(bottom - top + 1) * std::size_t(right - left + 1);
+    if (area < cache.size()) {
+        for (int row = top; row <= bottom; ++row) {
+            for (int col = left; col <= right; ++col) {
+                cache.erase(cacheKey(row, col));
+            }
+        }
+    }
+    else {
+        std::erase_if(cache, [=](const auto& entry) {
+            int row = int(entry.first >> 32);
+            int col = int(entry.first & 0xffffffff);
+            return row >= top && row <= bottom && col >= left && col <= right;
+        });
+    }
+
+    // A recompute updates the cells one by one, so the views are only notified once control
+    // returns to the event loop, with the range covering all changed cells
+    if (!changed.pending) {
+        changed = ChangedRange {top, left, bottom, right, true};
+        QMetaObject::invokeMethod(this, &SheetModel::emitPendingChanges, Qt::QueuedConnection);
+    }
+    else {
+        changed.top = std::min(changed.top, top);
+        changed.left = std::min(changed.left, left);
+        changed.bottom = std::max(changed.bottom, bottom);
+        changed.right = std::max(changed.right, right);
+    }
+}
+
+void SheetModel::emitPendingChanges()
+{
+    if (!changed.pending) {
+        return;
+    }
+    changed.pending = false;
+
+    // rows or columns may have been removed in the meantime
+    int bottom = std::min(changed.bottom, rows - 1);
+    int right = std::min(changed.right, cols - 1);
+    if (changed.top <= bottom && changed.left <= right) {
+        Q_EMIT dataChanged(index(changed.top, changed.left), index(bottom, right));
     }
 }
 
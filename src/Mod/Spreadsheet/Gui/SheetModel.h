@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
 #include "fastsignals/connection.h"
 #include <QAbstractTableModel>
 
@@ -59,11 +63,39 @@ public:
 
 private Q_SLOTS:
     void setCellData(QModelIndex index, QString str);
+    void emitPendingChanges();
 
 private:
+    QVariant cellData(const QModelIndex& index, int role) const;
     void containSheetDataInView();
     void cellUpdated(App::CellAddress address);
     void rangeUpdated(const App::Range& range);
+    void invalidate(int top, int left, int bottom, int right);
+    static std::uint64_t cacheKey(int row, int col)
+    {
+        return (std::uint64_t(std::uint32_t(row)) << 32) | std::uint32_t(col);
+    }
+
+    /// The data of the standard roles up to Qt::ForegroundRole as far as it was requested
+    struct CachedCell
+    {
+        std::array<QVariant, Qt::ForegroundRole + 1> values;
+        unsigned int known = 0;
+    };
+    // Qt asks for every role of every visible cell on each repaint. The existing cells are
+    // cached until the sheet reports a change of them.
+    mutable std::unordered_map<std::uint64_t, CachedCell> cache;
+
+    // The cells changed since the last emitted dataChanged() signal
+    struct ChangedRange
+    {
+        int top = 0;
+        int left = 0;
+        int bottom = 0;
+        int right = 0;
+        bool pending = false;
+    };
+    ChangedRange changed;
 
     std::vector<fastsignals::scoped_connection> connections;
     Spreadsheet::Sheet* sheet;
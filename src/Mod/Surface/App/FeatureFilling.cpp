@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <string>
 
 #include <BRepBuilderAPI_MakeWire.hxx>
@@ -73,6 +74,9 @@ Filling::Filling()
     ADD_PROPERTY_TYPE(TolCurvature,(0.1), "Filling", App::Prop_None, "G2 tolerance");
     ADD_PROPERTY_TYPE(MaximumDegree,(8), "Filling", App::Prop_None, "Maximum curve degree");
     ADD_PROPERTY_TYPE(MaximumSegments,(9), "Filling", App::Prop_None, "Maximum number of segments");
+    ADD_PROPERTY_TYPE(CoarseInitialPlate,(false), "Filling", App::Prop_None,
+                      "Build a coarse plate through the boundary first and refine it with all\n"
+                      "constraints. Can be faster for many unbound, face or point constraints");
     // clang-format on
 
     BoundaryEdges.setScope(App::LinkScope::Global);
@@ -100,18 +104,32 @@ short Filling::mustExecute() const
         || InitialFace.isTouched() || Degree.isTouched() || PointsOnCurve.isTouched()
         || Iterations.isTouched() || Anisotropy.isTouched() || Tolerance2d.isTouched()
         || Tolerance3d.isTouched() || TolAngular.isTouched() || TolCurvature.isTouched()
-        || MaximumDegree.isTouched() || MaximumSegments.isTouched()) {
+        || MaximumDegree.isTouched() || MaximumSegments.isTouched()
+        || CoarseInitialPlate.isTouched()) {
         return 1;
     }
     return 0;
 }
 
+bool Filling::Input::operator==(const Input& other) const
+{
+    return values == other.values
+        && std::equal(
+               shapes.begin(),
+               shapes.end(),
+               other.shapes.begin(),
+               other.shapes.end(),
+               [](const TopoDS_Shape& s1, const TopoDS_Shape& s2) { return s1.IsEqual(s2); }
+        );
+}
+
 void Filling::addConstraints(
     BRepFill_Filling& builder,
     const App::PropertyLinkSubList& edges,
     const App::PropertyStringList& faces,
     const App::PropertyIntegerList& orders,
-    Standard_Boolean bnd
+    Standard_Boolean bnd,
+    Input* input
 )
 {
     auto edge_obj = edges.getValues();
@@ -151,6 +169,12 @@ void Filling::addConstraints(
 
                     // check for an adjacent face of the edge
                     std::string subFace = face_sub[index];
+                    if (input) {
+                        input->shapes.push_back(edge);
+                        input->values.push_back(static_cast<double>(cont));
+                        input->values.push_back(bnd ? 1.0 : 0.0);
+                        input->values.push_back(subFace.empty() ? 0.0 : 1.0);
+                    }
 
                     // edge doesn't have set an adjacent face
                     if (subFace.empty()) {
@@ -174,6 +198,9 @@ void Filling::addConstraints(
                     else {
                         TopoDS_Shape face = shape.getSubShape(subFace.c_str());
                         if (!face.IsNull() && face.ShapeType() == TopAbs_FACE) {
+                            if (input) {
+                                input->shapes.push_back(face);
+                            }
                             if (!bnd) {
                                 // not a boundary edge: safe to add it directly
                                 builder.Add(TopoDS::Edge(edge), TopoDS::Face(face), cont, bnd);
@@ -211,7 +238,8 @@ void Filling::addConstraints(
 void Filling::addConstraints(
     BRepFill_Filling& builder,
     const App::PropertyLinkSubList& faces,
-    const App::PropertyIntegerList& orders
+    const App::PropertyIntegerList& orders,
+    Input* input
 )
 {
     auto face_obj = faces.getValues();
@@ -227,6 +255,10 @@ void Filling::addConstraints(
                 TopoDS_Shape face = shape.getSubShape(sub.c_str());
                 if (!face.IsNull() && face.ShapeType() == TopAbs_FACE) {
                     GeomAbs_Shape cont = static_cast<GeomAbs_Shape>(contvals[index]);
+                    if (input) {
+                        input->shapes.push_back(face);
+                        input->values.push_back(static_cast<double>(cont));
+                    }
                     builder.Add(TopoDS::Face(face), cont);
                 }
                 else {
@@ -240,7 +272,11 @@ void Filling::addConstraints(
     }
 }
 
-void Filling::addConstraints(BRepFill_Filling& builder, const App::PropertyLinkSubList& pointsList)
+void Filling::addConstraints(
+    BRepFill_Filling& builder,
+    const App::PropertyLinkSubList& pointsList,
+    Input* input
+)
 {
     auto points = pointsList.getSubListValues();
     for (const auto& it : points) {
@@ -252,6 +288,9 @@ void Filling::addConstraints(BRepFill_Filling& builder, const App::PropertyLinkS
                 TopoDS_Shape subShape = shape.getSubShape(jt.c_str());
                 if (!subShape.IsNull() && subShape.ShapeType() == TopAbs_VERTEX) {
                     gp_Pnt pnt = BRep_Tool::Pnt(TopoDS::Vertex(subShape));
+                    if (input) {
+                        input->values.insert(input->values.end(), {pnt.X(), pnt.Y(), pnt.Z()});
+                    }
                     builder.Add(pnt);
                 }
             }
@@ -272,6 +311,22 @@ App::DocumentObjectExecReturn* Filling::execute()
     double tolG2 = TolCurvature.getValue();
     unsigned int maxdeg = MaximumDegree.getValue();
     unsigned int maxseg = MaximumSegments.getValue();
+    bool coarse = CoarseInitialPlate.getValue();
+
+    Input input;
+    input.values = {
+        static_cast<double>(degree),
+        static_cast<double>(ptsoncurve),
+        static_cast<double>(numIter),
+        static_cast<double>(anisotropy),
+        tol2d,
+        tol3d,
+        tolG1,
+        tolG2,
+        static_cast<double>(maxdeg),
+        static_cast<double>(maxseg),
+        static_cast<double>(coarse)
+    };
 
     try {
         BRepFill_Filling
@@ -282,6 +337,7 @@ App::DocumentObjectExecReturn* Filling::execute()
         }
 
         // Load the initial surface if set
+        bool hasInitFace = false;
         App::DocumentObject* initFace = InitialFace.getValue();
         if (initFace && initFace->isDerivedFrom<Part::Feature>()) {
             const Part::TopoShape& shape = static_cast<Part::Feature*>(initFace)->Shape.getShape();
@@ -290,6 +346,8 @@ App::DocumentObjectExecReturn* Filling::execute()
                 TopoDS_Shape subShape = shape.getSubShape(it.c_str());
                 if (!subShape.IsNull() && subShape.ShapeType() == TopAbs_FACE) {
                     builder.LoadInitSurface(TopoDS::Face(subShape));
+                    input.shapes.push_back(subShape);
+                    hasInitFace = true;
                     break;
                 }
             }
@@ -297,21 +355,67 @@ App::DocumentObjectExecReturn* Filling::execute()
 
         // Add the constraints of border curves/faces (bound)
         int numBoundaries = BoundaryEdges.getSize();
-        addConstraints(builder, BoundaryEdges, BoundaryFaces, BoundaryOrder, Standard_True);
+        addConstraints(builder, BoundaryEdges, BoundaryFaces, BoundaryOrder, Standard_True, &input);
 
         // Add additional edge constraints if available (unbound)
+        bool hasInnerConstraints = false;
         if (UnboundEdges.getSize() > 0) {
-            addConstraints(builder, UnboundEdges, UnboundFaces, UnboundOrder, Standard_False);
+            addConstraints(
+                builder,
+                UnboundEdges,
+                UnboundFaces,
+                UnboundOrder,
+                Standard_False,
+                &input
+            );
+            hasInnerConstraints = true;
         }
 
         // Add additional constraint on free faces
         if (FreeFaces.getSize() > 0) {
-            addConstraints(builder, FreeFaces, FreeOrder);
+            addConstraints(builder, FreeFaces, FreeOrder, &input);
+            hasInnerConstraints = true;
         }
 
         // App point constraints
         if (Points.getSize() > 0) {
-            addConstraints(builder, Points);
+            addConstraints(builder, Points, &input);
+            hasInnerConstraints = true;
+        }
+
+        // Building the plate is expensive, a recompute with the same shapes and parameters, e.g.
+        // because a linked object was touched, gives the same face
+        if (!lastFace.IsNull() && input == lastInput) {
+            this->Shape.setValue(lastFace);
+            return App::DocumentObject::StdReturn;
+        }
+
+        // A plate through the boundary alone is cheap. Used as initial surface the full plate
+        // then only has to correct it for the other constraints.
+        if (coarse && !hasInitFace && hasInnerConstraints && numBoundaries > 1) {
+            BRepFill_Filling coarseBuilder(
+                degree,
+                std::max(3U, ptsoncurve / 3),
+                1,
+                anisotropy,
+                tol2d,
+                tol3d,
+                tolG1,
+                tolG2,
+                maxdeg,
+                maxseg
+            );
+            addConstraints(
+                coarseBuilder,
+                BoundaryEdges,
+                BoundaryFaces,
+                BoundaryOrder,
+                Standard_True
+            );
+            coarseBuilder.Build();
+            if (coarseBuilder.IsDone()) {
+                builder.LoadInitSurface(coarseBuilder.Face());
+            }
         }
 
         // Build the face
@@ -325,6 +429,8 @@ App::DocumentObjectExecReturn* Filling::execute()
         // Return the face
         TopoDS_Face aFace = builder.Face();
         this->Shape.setValue(aFace);
+        lastInput = std::move(input);
+        lastFace = aFace;
         return App::DocumentObject::StdReturn;
     }
     catch (Standard_Failure& e) {
@@ -24,6 +24,10 @@
 
 #pragma once
 
+#include <vector>
+
+#include <TopoDS_Face.hxx>
+
 #include <App/PropertyLinks.h>
 #include <Mod/Part/App/FeaturePartSpline.h>
 #include <Mod/Surface/SurfaceGlobal.h>
@@ -66,6 +70,7 @@ public:
     App::PropertyFloat TolCurvature;       // G2 tolerance
     App::PropertyInteger MaximumDegree;    // Maximum curve degree
     App::PropertyInteger MaximumSegments;  // Maximum number of segments
+    App::PropertyBool CoarseInitialPlate;  // Start from a coarse plate through the boundary
 
     // recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
@@ -77,19 +82,37 @@ public:
     }
 
 private:
+    // The shapes and values a face is built from
+    struct Input
+    {
+        std::vector<TopoDS_Shape> shapes;
+        std::vector<double> values;
+        bool operator==(const Input& other) const;
+    };
+
     void addConstraints(
         BRepFill_Filling& builder,
         const App::PropertyLinkSubList& edges,
         const App::PropertyStringList& faces,
         const App::PropertyIntegerList& orders,
-        Standard_Boolean bnd
+        Standard_Boolean bnd,
+        Input* input = nullptr
     );
     void addConstraints(
         BRepFill_Filling& builder,
         const App::PropertyLinkSubList& faces,
-        const App::PropertyIntegerList& orders
+        const App::PropertyIntegerList& orders,
+        Input* input = nullptr
     );
-    void addConstraints(BRepFill_Filling& builder, const App::PropertyLinkSubList& points);
+    void addConstraints(
+        BRepFill_Filling& builder,
+        const App::PropertyLinkSubList& points,
+        Input* input = nullptr
+    );
+
+    // the input and result of the last build, reused when a recompute doesn't change the input
+    Input lastInput;
+    TopoDS_Face lastFace;
 };
 
 }  // Namespace Surface
@@ -21,22 +21,31 @@
  ***************************************************************************/
 
 
+# include <algorithm>
 # include <iomanip>
 # include <limits>
+# include <list>
+# include <mutex>
 # include <sstream>
+# include <utility>
 
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
+#include <Geom_Curve.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
 #include <Precision.hxx>
 #include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Edge.hxx>
@@ -61,11 +70,412 @@
 #include "GeometryObject.h"
 #include "HatchLine.h"
 #include "Preferences.h"
+#include "ShapeUtils.h"
 
 
 using namespace TechDraw;
 using DU = DrawUtil;
 
+namespace
+{
+
+//! one line of a hatch pattern: a point on the line and its dashes in order along the line
+struct HatchRow
+{
+    Base::Vector3d origin;
+    std::vector<std::pair<Base::Vector3d, Base::Vector3d>> dashes;
+};
+
+//! the rows of a hatch line spec that cover the box, with the total number of dashes.  The rows
+//! are empty if the spec is degenerate.
+std::vector<HatchRow> makeHatchRows(PATLineSpec hatchLine,
+                                    const Bnd_Box& bBox,
+                                    double scale,
+                                    double rotation,
+                                    Base::Vector3d& hatchDirection,
+                                    size_t& dashCount)
+{
+    const size_t MaxNumberOfEdges = Preferences::getPreferenceGroup("PAT")->GetInt("MaxSeg", 10000l);
+
+    std::vector<HatchRow> result;
+    dashCount = 0;
+    double minX, maxX, minY, maxY, minZ, maxZ;
+    bBox.Get(minX, minY, minZ, maxX, maxY, maxZ);
+    Base::Vector3d topLeft(minX, maxY, 0.);
+    Base::Vector3d topRight(maxX, maxY, 0.);
+    Base::Vector3d bottomLeft(minX, minY, 0.);
+    Base::Vector3d bottomRight(maxX, minY, 0.);
+
+    Base::Vector3d origin = hatchLine.getOrigin() * scale;
+    double interval = hatchLine.getInterval() * scale;
+    double offset = hatchLine.getOffset() * scale;
+    double angle = hatchLine.getAngle() + rotation;
+    origin.RotateZ(Base::toRadians(rotation));
+
+    if (scale == 0. || interval == 0.)
+        return {};
+
+    const double hatchAngle = Base::toRadians(angle);
+    hatchDirection = Base::Vector3d(cos(hatchAngle), sin(hatchAngle), 0.);
+    Base::Vector3d hatchPerpendicular(-hatchDirection.y, hatchDirection.x, 0.);
+    Base::Vector3d hatchIntervalAndOffset = offset * hatchDirection + interval * hatchPerpendicular;
+
+    std::array<double, 4> orthogonalProjections = {
+        (topLeft - origin).Dot(hatchPerpendicular / interval),
+        (topRight - origin).Dot(hatchPerpendicular / interval),
+        (bottomLeft - origin).Dot(hatchPerpendicular / interval),
+        (bottomRight - origin).Dot(hatchPerpendicular / interval)
+    };
+    auto minMaxIterators = std::minmax_element(orthogonalProjections.begin(), orthogonalProjections.end());
+    int firstRepeatIndex = ceil(*minMaxIterators.first);
+    int lastRepeatIndex = floor(*minMaxIterators.second);
+
+    std::vector<double> dashParams = hatchLine.getDashParms().get();
+    double globalDashStep = 0.;
+    if (dashParams.empty()) {
+        // we define a single dash with length equal to twice the diagonal of the bounding box
+        double diagonalLength = (topRight - bottomLeft).Length();
+        dashParams.push_back(2. * diagonalLength);
+        globalDashStep = diagonalLength;
+    }
+    else {
+        for (auto& x : dashParams) {
+            x *= scale;
+            globalDashStep += std::abs(x);
+        }
+    }
+    if (globalDashStep == 0.) {
+        return {};
+    }
+
+    // we handle hatch as a set of parallel lines made of dashes, here we loop on each line
+    for (int i = firstRepeatIndex ; i <= lastRepeatIndex ; ++i) {
+        Base::Vector3d currentOrigin = origin + static_cast<double>(i) * hatchIntervalAndOffset;
+        HatchRow row;
+        row.origin = currentOrigin;
+
+        int firstDashIndex, lastDashIndex;
+        if (std::abs(hatchDirection.x) > std::abs(hatchDirection.y)) {  // we compute intersections with minX and maxX
+            firstDashIndex = (hatchDirection.x > 0.)
+                    ? std::floor((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
+                    : std::floor((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
+            lastDashIndex = (hatchDirection.x > 0.)
+                    ? std::ceil((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
+                    : std::ceil((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
+        }
+        else {  // we compute intersections with minY and maxY
+            firstDashIndex = (hatchDirection.y > 0.)
+                    ? std::floor((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
+                    : std::floor((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
+            lastDashIndex = (hatchDirection.y > 0.)
+                    ? std::ceil((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
+                    : std::ceil((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
+        }
+
+        for (int j = firstDashIndex ; j < lastDashIndex ; ++j) {
+            Base::Vector3d current = currentOrigin + static_cast<double>(j) * globalDashStep * hatchDirection;
+            for (auto dashParamsIterator = dashParams.begin() ; dashParamsIterator != dashParams.end() ; ++dashParamsIterator) {
+                double len = *dashParamsIterator;
+                Base::Vector3d next = current + std::abs(len) * hatchDirection;
+                if (len > 0. && (current.x >= minX || next.x >= minX) && (current.x <= maxX || next.x <= maxX)
+                        && (current.y >= minY || next.y >= minY) && (current.y <= maxY || next.y <= maxY)) {
+                    row.dashes.emplace_back(current, next);
+                }
+                std::swap(current, next);
+            }
+        }
+
+        dashCount += row.dashes.size();
+        result.push_back(std::move(row));
+        if (dashCount > MaxNumberOfEdges) {
+            return {};
+        }
+    }
+
+    return result;
+}
+
+//! a straight piece of the boundary of a face.  Pieces of curved edges keep the curve and its
+//! parameter range so their crossings with hatch lines can be refined.
+struct BoundarySegment
+{
+    Base::Vector3d start;
+    Base::Vector3d end;
+    int curve;  // index in BoundaryPolygon::curves, -1 for straight edges
+    double firstParam;
+    double lastParam;
+};
+
+//! the boundary of a planar face approximated by straight segments, used to clip hatch lines
+//! with the even-odd rule instead of an OCC boolean per line set
+class BoundaryPolygon
+{
+public:
+    bool build(const TopoDS_Face& face, double deflection)
+    {
+        for (TopExp_Explorer expl(face, TopAbs_EDGE); expl.More(); expl.Next()) {
+            const TopoDS_Edge& edge = TopoDS::Edge(expl.Current());
+            if (BRep_Tool::Degenerated(edge)) {
+                continue;
+            }
+            BRepAdaptor_Curve adapt(edge);
+            if (adapt.GetType() == GeomAbs_Line) {
+                segments.push_back({Base::convertTo<Base::Vector3d>(adapt.Value(adapt.FirstParameter())),
+                                    Base::convertTo<Base::Vector3d>(adapt.Value(adapt.LastParameter())),
+                                    -1,
+                                    0.0,
+                                    0.0});
+                continue;
+            }
+
+            double first {0.0};
+            double last {0.0};
+            Handle(Geom_Curve) curve3d = BRep_Tool::Curve(edge, first, last);
+            GCPnts_QuasiUniformDeflection discretizer(adapt, deflection);
+            if (curve3d.IsNull() || !discretizer.IsDone() || discretizer.NbPoints() < 2) {
+                return false;
+            }
+            int curve = static_cast<int>(curves.size());
+            curves.push_back(curve3d);
+            for (int i = 1; i < discretizer.NbPoints(); i++) {
+                segments.push_back({Base::convertTo<Base::Vector3d>(discretizer.Value(i)),
+                                    Base::convertTo<Base::Vector3d>(discretizer.Value(i + 1)),
+                                    curve,
+                                    discretizer.Parameter(i),
+                                    discretizer.Parameter(i + 1)});
+            }
+        }
+        return !segments.empty();
+    }
+
+    //! the parameters along the line where it crosses the boundary, in increasing order.  Returns
+    //! false if the crossings do not pair up, which happens when the boundary is not closed.
+    bool crossings(const Base::Vector3d& origin,
+                   const Base::Vector3d& direction,
+                   std::vector<double>& params) const
+    {
+        params.clear();
+        for (auto& segment : segments) {
+            double startSide = side(origin, direction, segment.start);
+            double endSide = side(origin, direction, segment.end);
+            if ((startSide > 0.0) == (endSide > 0.0)) {
+                continue;
+            }
+            Base::Vector3d crossing = segment.start
+                + (segment.end - segment.start) * (startSide / (startSide - endSide));
+            if (segment.curve >= 0) {
+                crossing = refine(origin, direction, segment, startSide, crossing);
+            }
+            params.push_back((crossing - origin).Dot(direction));
+        }
+        std::sort(params.begin(), params.end());
+        return params.size() % 2 == 0;
+    }
+
+private:
+    //! signed distance of point from the line
+    static double side(const Base::Vector3d& origin,
+                       const Base::Vector3d& direction,
+                       const Base::Vector3d& point)
+    {
+        return direction.x * (point.y - origin.y) - direction.y * (point.x - origin.x);
+    }
+
+    //! move an approximate crossing onto the curve by bisecting the parameter range of the segment
+    Base::Vector3d refine(const Base::Vector3d& origin,
+                          const Base::Vector3d& direction,
+                          const BoundarySegment& segment,
+                          double startSide,
+                          const Base::Vector3d& approximate) const
+    {
+        const Handle(Geom_Curve)& curve = curves.at(segment.curve);
+        double low = segment.firstParam;
+        double high = segment.lastParam;
+        bool lowAbove = startSide > 0.0;
+        Base::Vector3d point = approximate;
+        for (int i = 0; i < 50; i++) {
+            double middle = 0.5 * (low + high);
+            point = Base::convertTo<Base::Vector3d>(curve->Value(middle));
+            double middleSide = side(origin, direction, point);
+            if (std::abs(middleSide) < Precision::Confusion()) {
+                break;
+            }
+            if ((middleSide > 0.0) == lowAbove) {
+                low = middle;
+            }
+            else {
+                high = middle;
+            }
+        }
+        return point;
+    }
+
+    std::vector<BoundarySegment> segments;
+    std::vector<Handle(Geom_Curve)> curves;
+};
+
+//! clip the dashes of the line set to the face with the boundary polygon.  Returns false if a
+//! hatch line could not be clipped reliably.
+bool clipToPolygon(const BoundaryPolygon& boundary,
+                   const std::vector<HatchRow>& rows,
+                   const Base::Vector3d& direction,
+                   const Base::Vector3d& hatchOffset,
+                   std::vector<TopoDS_Edge>& edges,
+                   Bnd_Box& overlayBox)
+{
+    std::vector<double> params;
+    for (auto& row : rows) {
+        Base::Vector3d origin = row.origin + hatchOffset;
+        if (!boundary.crossings(origin, direction, params)) {
+            return false;
+        }
+        // the dashes and the inside intervals are both in increasing order along the line
+        size_t first = 0;
+        for (auto& dash : row.dashes) {
+            double dashStart = (dash.first + hatchOffset - origin).Dot(direction);
+            double dashEnd = (dash.second + hatchOffset - origin).Dot(direction);
+            while (first + 1 < params.size() && params[first + 1] <= dashStart) {
+                first += 2;
+            }
+            for (size_t i = first; i + 1 < params.size() && params[i] < dashEnd; i += 2) {
+                double start = std::max(dashStart, params[i]);
+                double end = std::min(dashEnd, params[i + 1]);
+                if (end - start <= Precision::Confusion()) {
+                    continue;
+                }
+                Base::Vector3d startPoint = origin + direction * start;
+                Base::Vector3d endPoint = origin + direction * end;
+                edges.push_back(DrawGeomHatch::makeLine(startPoint, endPoint));
+                overlayBox.Add(gp_Pnt(startPoint.x, startPoint.y, 0.0));
+                overlayBox.Add(gp_Pnt(endPoint.x, endPoint.y, 0.0));
+            }
+        }
+    }
+    return true;
+}
+
+//! clip the dashes of the line set to the face with an OCC boolean.  Returns false if the boolean
+//! fails.
+bool clipWithBoolean(const TopoDS_Face& face,
+                     const std::vector<HatchRow>& rows,
+                     const Base::Vector3d& hatchOffset,
+                     std::vector<TopoDS_Edge>& edges,
+                     Bnd_Box& overlayBox)
+{
+    //make Compound for this linespec
+    BRep_Builder builder;
+    TopoDS_Compound gridComp;
+    builder.MakeCompound(gridComp);
+    for (auto& row : rows) {
+        for (auto& dash : row.dashes) {
+            builder.Add(gridComp, DrawGeomHatch::makeLine(dash.first, dash.second));
+        }
+    }
+
+    TopoDS_Shape grid = gridComp;
+    gp_Trsf xGridTranslate;
+    xGridTranslate.SetTranslation(Base::convertTo<gp_Vec>(hatchOffset));
+    BRepBuilderAPI_Transform mkTransTranslate(grid, xGridTranslate, true);
+    grid = mkTransTranslate.Shape();
+
+    //Common(Compound, Face)
+    FCBRepAlgoAPI_Common mkCommon(face, grid);
+    if (!mkCommon.IsDone() ||
+        mkCommon.Shape().IsNull()) {
+        return false;
+    }
+    TopoDS_Shape common = mkCommon.Shape();
+
+    //save the boundingBox of hatch pattern
+    BRepBndLib::AddOptimal(common, overlayBox);
+
+    //get resulting edges
+    TopTools_IndexedMapOfShape mapOfEdges;
+    TopExp::MapShapes(common, TopAbs_EDGE, mapOfEdges);
+    for ( int i = 1 ; i <= mapOfEdges.Extent() ; i++ ) {           //remember, TopExp makes no promises about the order it finds edges
+        const TopoDS_Edge& edge = TopoDS::Edge(mapOfEdges(i));
+        if (edge.IsNull()) {
+            continue;
+        }
+        edges.push_back(edge);
+    }
+    return true;
+}
+
+//! identifies the trimmed hatch of a face by the face content and the pattern placement
+struct HatchCacheKey
+{
+    std::size_t faceHash;
+    std::vector<double> values;
+
+    bool operator==(const HatchCacheKey& other) const
+    {
+        return faceHash == other.faceHash && values == other.values;
+    }
+};
+
+HatchCacheKey makeHatchCacheKey(const TopoDS_Face& face,
+                                std::vector<LineSet>& lineSets,
+                                double scale,
+                                double hatchRotation,
+                                const Base::Vector3d& hatchOffset)
+{
+    HatchCacheKey key{ShapeUtils::contentHash(face),
+                      {scale, hatchRotation, hatchOffset.x, hatchOffset.y, hatchOffset.z}};
+    for (auto& ls : lineSets) {
+        PATLineSpec spec = ls.getPATLineSpec();
+        Base::Vector3d origin = spec.getOrigin();
+        key.values.insert(key.values.end(),
+                          {spec.getAngle(), origin.x, origin.y, spec.getInterval(), spec.getOffset()});
+        std::vector<double> dashes = spec.getDashParms().get();
+        key.values.push_back(static_cast<double>(dashes.size()));
+        key.values.insert(key.values.end(), dashes.begin(), dashes.end());
+    }
+    return key;
+}
+
+//! the trimmed hatch lines of the last hatched faces, so redrawing a view does not trim them
+//! again
+class HatchCache
+{
+public:
+    bool find(const HatchCacheKey& key, std::vector<LineSet>& result)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = std::find_if(entries.begin(), entries.end(), [&key](const auto& entry) {
+            return entry.first == key;
+        });
+        if (it == entries.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it);  // most recently used first
+        result = it->second;
+        return true;
+    }
+
+    void insert(const HatchCacheKey& key, const std::vector<LineSet>& result)
+    {
+        constexpr std::size_t capacity {64};
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.emplace_front(key, result);
+        while (entries.size() > capacity) {
+            entries.pop_back();
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::list<std::pair<HatchCacheKey, std::vector<LineSet>>> entries;
+};
+
+HatchCache& hatchCache()
+{
+    static HatchCache cache;
+    return cache;
+}
+
+}  // namespace
+
 App::PropertyFloatConstraint::Constraints DrawGeomHatch::scaleRange = {
     Precision::Confusion(), std::numeric_limits<double>::max(), (0.1)}; // increment by 0.1
 
@@ -313,10 +723,24 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
     }
 
     TopoDS_Face face = f;
+    if (face.IsNull()) {
+        return result;
+    }
+
+    HatchCacheKey key = makeHatchCacheKey(face, lineSets, scale, hatchRotation, hatchOffset);
+    if (hatchCache().find(key, result)) {
+        return result;
+    }
 
     Bnd_Box bBox;
     BRepBndLib::AddOptimal(face, bBox);
     bBox.SetGap(0.0);
+
+    // the boundary is approximated finely enough that a hatch line rarely crosses a curved edge
+    // twice within one segment, the crossings themselves are refined on the curves
+    BoundaryPolygon boundary;
+    bool usePolygon = !bBox.IsVoid() && boundary.build(face, 1.0e-3 * std::sqrt(bBox.SquareExtent()));
+
     gp_Vec translateVector(hatchOffset.x, hatchOffset.y, 0.);
     auto cornerMin = bBox.CornerMin().Translated(-translateVector);
     auto cornerMax = bBox.CornerMax().Translated(-translateVector);
@@ -324,47 +748,23 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
 
     for (auto& ls: lineSets) {
         PATLineSpec hl = ls.getPATLineSpec();
-        std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale, hatchRotation);   //completely cover face bbox with lines
-
-        //make Compound for this linespec
-        BRep_Builder builder;
-        TopoDS_Compound gridComp;
-        builder.MakeCompound(gridComp);
-        for (auto& c: candidates) {
-           builder.Add(gridComp, c);
-        }
-
-        TopoDS_Shape grid = gridComp;
-        gp_Trsf xGridTranslate;
-        xGridTranslate.SetTranslation(Base::convertTo<gp_Vec>(hatchOffset));
-        BRepBuilderAPI_Transform mkTransTranslate(grid, xGridTranslate, true);
-        grid = mkTransTranslate.Shape();
-
-        //Common(Compound, Face)
-        FCBRepAlgoAPI_Common mkCommon(face, grid);
-        if (!mkCommon.IsDone() ||
-            mkCommon.Shape().IsNull()) {
-            return result;
-        }
-        TopoDS_Shape common = mkCommon.Shape();
+        Base::Vector3d direction;
+        size_t dashCount = 0;
+        //completely cover face bbox with lines
+        std::vector<HatchRow> rows = makeHatchRows(hl, bBox, scale, hatchRotation, direction, dashCount);
 
-        //save the boundingBox of hatch pattern
+        std::vector<TopoDS_Edge> resultEdges;
         Bnd_Box overlayBox;
         overlayBox.SetGap(0.0);
-        BRepBndLib::AddOptimal(common, overlayBox);
-        ls.setBBox(overlayBox);
-
-        //get resulting edges
-        std::vector<TopoDS_Edge> resultEdges;
-        TopTools_IndexedMapOfShape mapOfEdges;
-        TopExp::MapShapes(common, TopAbs_EDGE, mapOfEdges);
-        for ( int i = 1 ; i <= mapOfEdges.Extent() ; i++ ) {           //remember, TopExp makes no promises about the order it finds edges
-            const TopoDS_Edge& edge = TopoDS::Edge(mapOfEdges(i));
-            if (edge.IsNull()) {
-                continue;
+        if (!usePolygon
+            || !clipToPolygon(boundary, rows, direction, hatchOffset, resultEdges, overlayBox)) {
+            resultEdges.clear();
+            overlayBox.SetVoid();
+            if (!clipWithBoolean(face, rows, hatchOffset, resultEdges, overlayBox)) {
+                return result;
             }
-            resultEdges.push_back(edge);
         }
+        ls.setBBox(overlayBox);
 
         std::vector<TechDraw::BaseGeomPtr> resultGeoms;
         for (auto& e: resultEdges) {
@@ -378,105 +778,25 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
         ls.setGeoms(resultGeoms);
         result.push_back(ls);
     }
+
+    hatchCache().insert(key, result);
     return result;
 }
 
 /* static */
 std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox, double scale, double rotation)
 {
-    const size_t MaxNumberOfEdges = Preferences::getPreferenceGroup("PAT")->GetInt("MaxSeg", 10000l);
+    Base::Vector3d direction;
+    size_t dashCount = 0;
+    std::vector<HatchRow> rows = makeHatchRows(hatchLine, bBox, scale, rotation, direction, dashCount);
 
     std::vector<TopoDS_Edge> result;
-    double minX, maxX, minY, maxY, minZ, maxZ;
-    bBox.Get(minX, minY, minZ, maxX, maxY, maxZ);
-    Base::Vector3d topLeft(minX, maxY, 0.);
-    Base::Vector3d topRight(maxX, maxY, 0.);
-    Base::Vector3d bottomLeft(minX, minY, 0.);
-    Base::Vector3d bottomRight(maxX, minY, 0.);
-
-    Base::Vector3d origin = hatchLine.getOrigin() * scale;
-    double interval = hatchLine.getInterval() * scale;
-    double offset = hatchLine.getOffset() * scale;
-    double angle = hatchLine.getAngle() + rotation;
-    origin.RotateZ(Base::toRadians(rotation));
-
-    if (scale == 0. || interval == 0.)
-        return {};
-
-    const double hatchAngle = Base::toRadians(angle);
-    Base::Vector3d hatchDirection(cos(hatchAngle), sin(hatchAngle), 0.);
-    Base::Vector3d hatchPerpendicular(-hatchDirection.y, hatchDirection.x, 0.);
-    Base::Vector3d hatchIntervalAndOffset = offset * hatchDirection + interval * hatchPerpendicular;
-
-    std::array<double, 4> orthogonalProjections = {
-        (topLeft - origin).Dot(hatchPerpendicular / interval),
-        (topRight - origin).Dot(hatchPerpendicular / interval),
-        (bottomLeft - origin).Dot(hatchPerpendicular / interval),
-        (bottomRight - origin).Dot(hatchPerpendicular / interval)
-    };
-    auto minMaxIterators = std::minmax_element(orthogonalProjections.begin(), orthogonalProjections.end());
-    int firstRepeatIndex = ceil(*minMaxIterators.first);
-    int lastRepeatIndex = floor(*minMaxIterators.second);
-
-    std::vector<double> dashParams = hatchLine.getDashParms().get();
-    double globalDashStep = 0.;
-    if (dashParams.empty()) {
-        // we define a single dash with length equal to twice the diagonal of the bounding box
-        double diagonalLength = (topRight - bottomLeft).Length();
-        dashParams.push_back(2. * diagonalLength);
-        globalDashStep = diagonalLength;
-    }
-    else {
-        for (auto& x : dashParams) {
-            x *= scale;
-            globalDashStep += std::abs(x);
+    result.reserve(dashCount);
+    for (auto& row : rows) {
+        for (auto& dash : row.dashes) {
+            result.push_back(makeLine(dash.first, dash.second));
         }
     }
-    if (globalDashStep == 0.) {
-        return {};
-    }
-
-    // we handle hatch as a set of parallel lines made of dashes, here we loop on each line
-    for (int i = firstRepeatIndex ; i <= lastRepeatIndex ; ++i) {
-        Base::Vector3d currentOrigin = origin + static_cast<double>(i) * hatchIntervalAndOffset;
-
-        int firstDashIndex, lastDashIndex;
-        if (std::abs(hatchDirection.x) > std::abs(hatchDirection.y)) {  // we compute intersections with minX and maxX
-            firstDashIndex = (hatchDirection.x > 0.)
-                    ? std::floor((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
-                    : std::floor((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
-            lastDashIndex = (hatchDirection.x > 0.)
-                    ? std::ceil((maxX - currentOrigin.x) / (globalDashStep * hatchDirection.x))
-                    : std::ceil((minX - currentOrigin.x) / (globalDashStep * hatchDirection.x));
-        }
-        else {  // we compute intersections with minY and maxY
-            firstDashIndex = (hatchDirection.y > 0.)
-                    ? std::floor((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
-                    : std::floor((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
-            lastDashIndex = (hatchDirection.y > 0.)
-                    ? std::ceil((maxY - currentOrigin.y) / (globalDashStep * hatchDirection.y))
-                    : std::ceil((minY - currentOrigin.y) / (globalDashStep * hatchDirection.y));
-        }
-
-        for (int j = firstDashIndex ; j < lastDashIndex ; ++j) {
-            Base::Vector3d current = currentOrigin + static_cast<double>(j) * globalDashStep * hatchDirection;
-            for (auto dashParamsIterator = dashParams.begin() ; dashParamsIterator != dashParams.end() ; ++dashParamsIterator) {
-                double len = *dashParamsIterator;
-                Base::Vector3d next = current + std::abs(len) * hatchDirection;
-                if (len > 0. && (current.x >= minX || next.x >= minX) && (current.x <= maxX || next.x <= maxX)
-                        && (current.y >= minY || next.y >= minY) && (current.y <= maxY || next.y <= maxY)) {
-                    TopoDS_Edge newLine = makeLine(current, next);
-                    result.push_back(newLine);
-                }
-                std::swap(current, next);
-            }
-        }
-
-        if (result.size() > MaxNumberOfEdges) {
-            return {};
-        }
-    }
-
     return result;
 }
 
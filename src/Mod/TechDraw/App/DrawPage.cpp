@@ -358,6 +358,48 @@ void DrawPage::updateAllViews()
     }
 }
 
+//! write a table of the timings of the part views on this page to the report view, once none of
+//! them is waiting for a result
+void DrawPage::reportTimings()
+{
+    std::vector<DrawViewPart*> parts;
+    for (auto& v : getAllViews()) {
+        auto* part = freecad_cast<DrawViewPart*>(v);
+        if (!part) {
+            continue;
+        }
+        if (part->waitingForResult()) {
+            return;
+        }
+        parts.push_back(part);
+    }
+    if (parts.empty()) {
+        return;
+    }
+
+    ViewTimings total;
+    Base::Console().message("TechDraw timings for %s (seconds)\n", Label.getValue());
+    Base::Console().message("%-24s %8s %8s %8s %8s %8s %8s %8s\n",
+                            "view", "hlr", "geometry", "faces", "cosmetic", "edges", "vertexes",
+                            "faces");
+    for (auto* part : parts) {
+        const ViewTimings& t = part->getTimings();
+        Base::Console().message("%-24s %8.3f %8.3f %8.3f %8.3f %8zu %8zu %8zu\n",
+                                part->Label.getValue(), t.hlr, t.geometry, t.faces, t.cosmetics,
+                                t.edges, t.vertexes, t.faceCount);
+        total.hlr += t.hlr;
+        total.geometry += t.geometry;
+        total.faces += t.faces;
+        total.cosmetics += t.cosmetics;
+        total.edges += t.edges;
+        total.vertexes += t.vertexes;
+        total.faceCount += t.faceCount;
+    }
+    Base::Console().message("%-24s %8.3f %8.3f %8.3f %8.3f %8zu %8zu %8zu\n",
+                            "total", total.hlr, total.geometry, total.faces, total.cosmetics,
+                            total.edges, total.vertexes, total.faceCount);
+}
+
 std::vector<App::DocumentObject*> DrawPage::getViews() const
 {
     std::vector<App::DocumentObject*> views = Views.getValues();
@@ -101,6 +101,7 @@ public:
     void forceRedraw(bool b) { m_forceRedraw = b; }
     bool forceRedraw() { return m_forceRedraw; }
     void redrawCommand();
+    void reportTimings();
 
     bool canUpdate() const;
 
@@ -22,9 +22,12 @@
 
 
 # include <algorithm>
+# include <array>
 # include <limits>
 # include <sstream>
 #include <Bnd_Box.hxx>
+#include <Bnd_BoundSortBox.hxx>
+#include <Bnd_HArray1OfBox.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
@@ -45,6 +48,7 @@
 #include <BOPAlgo_Builder.hxx>
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Base/Parameter.h>
 
 #include "DrawProjectSplit.h"
@@ -161,6 +165,79 @@ bool DrawProjectSplit::isOnEdge(TopoDS_Edge e, TopoDS_Vertex v, double& param, b
     return false;
 }
 
+//find the points where an end vertex of one edge touches the interior of another edge.
+//HLR does not split edges at these points, but face finding needs them to be split.
+//Only edges with intersecting bounding boxes are compared.  The candidates are found with a
+//box sorting grid instead of checking all pairs, then the edges are checked in parallel.
+std::vector<splitPoint> DrawProjectSplit::findSplitPoints(const std::vector<TopoDS_Edge>& edges)
+{
+    std::vector<splitPoint> splits;
+    int edgeCount = edges.size();
+    if (edgeCount < 2) {
+        return splits;
+    }
+
+    //the same boxes isOnEdge uses, so a vertex outside a box is rejected without calling it
+    Handle(Bnd_HArray1OfBox) boxes = new Bnd_HArray1OfBox(1, edgeCount);
+    Bnd_Box allBoxes;
+    for (int iEdge = 0; iEdge < edgeCount; iEdge++) {
+        Bnd_Box box;
+        if (!DrawUtil::isZeroEdge(edges.at(iEdge))) {
+            BRepBndLib::AddOptimal(edges.at(iEdge), box);
+            box.SetGap(0.1);
+        }
+        boxes->SetValue(iEdge + 1, box);
+        allBoxes.Add(box);
+    }
+    if (allBoxes.IsVoid()) {
+        return splits;
+    }
+
+    //Bnd_BoundSortBox keeps its result in a member, so the candidates are collected up front
+    Bnd_BoundSortBox sorter;
+    sorter.Initialize(allBoxes, boxes);
+    std::vector<std::vector<int>> candidates(edgeCount);
+    for (int iOuter = 0; iOuter < edgeCount; iOuter++) {
+        const Bnd_Box& outerBox = boxes->Value(iOuter + 1);
+        if (outerBox.IsVoid()) {
+            continue;
+        }
+        for (int index : sorter.Compare(outerBox)) {
+            if (index - 1 != iOuter) {
+                candidates.at(iOuter).push_back(index - 1);
+            }
+        }
+        //keep the order of an all pairs check
+        std::sort(candidates.at(iOuter).begin(), candidates.at(iOuter).end());
+    }
+
+    std::vector<std::vector<splitPoint>> edgeSplits(edgeCount);
+    Base::parallelFor(edgeCount, [&](std::size_t iOuter) {
+        const TopoDS_Edge& outer = edges.at(iOuter);
+        std::array<TopoDS_Vertex, 2> ends {TopExp::FirstVertex(outer), TopExp::LastVertex(outer)};
+        for (int iInner : candidates.at(iOuter)) {
+            for (auto& end : ends) {
+                gp_Pnt pnt = BRep_Tool::Pnt(end);
+                if (boxes->Value(iInner + 1).IsOut(pnt)) {
+                    continue;
+                }
+                double param = -1;
+                if (isOnEdge(edges.at(iInner), end, param, false)) {
+                    splitPoint split;
+                    split.i = iInner;
+                    split.v = Base::Vector3d(pnt.X(), pnt.Y(), pnt.Z());
+                    split.param = param;
+                    edgeSplits.at(iOuter).push_back(split);
+                }
+            }
+        }
+    });
+
+    for (auto& found : edgeSplits) {
+        splits.insert(splits.end(), found.begin(), found.end());
+    }
+    return splits;
+}
 
 std::vector<TopoDS_Edge> DrawProjectSplit::splitEdges(std::vector<TopoDS_Edge> edges, std::vector<splitPoint> splits)
 {
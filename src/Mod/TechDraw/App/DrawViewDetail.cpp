@@ -291,13 +291,24 @@ void DrawViewDetail::makeDetailShape(const TopoDS_Shape& shape3d, DrawViewPart*
 
     //for each solid and shell in the input shape, make a common with the tool and
     //add the result to a compound.  This avoids issues with some geometry errors in the
-    //input shape.
+    //input shape.  Pieces that are clear of the tool have an empty common, so they are
+    //skipped without running a boolean.
+    Bnd_Box toolBox;
+    BRepBndLib::Add(tool, toolBox);
+    auto clearOfTool = [&toolBox](const TopoDS_Shape& piece) {
+        Bnd_Box pieceBox;
+        BRepBndLib::Add(piece, pieceBox);
+        return pieceBox.IsOut(toolBox);
+    };
     BRep_Builder builder;
     TopoDS_Compound pieces;
     builder.MakeCompound(pieces);
     TopExp_Explorer expl1(copyShape, TopAbs_SOLID);
     for (; expl1.More(); expl1.Next()) {
         const TopoDS_Solid& s = TopoDS::Solid(expl1.Current());
+        if (clearOfTool(s)) {
+            continue;
+        }
         FCBRepAlgoAPI_Common mkCommon(s, tool);
         if (!mkCommon.IsDone()) {
             continue;
@@ -317,6 +328,9 @@ void DrawViewDetail::makeDetailShape(const TopoDS_Shape& shape3d, DrawViewPart*
     TopExp_Explorer expl2(copyShape, TopAbs_SHELL, TopAbs_SOLID);
     for (; expl2.More(); expl2.Next()) {
         const TopoDS_Shell& s = TopoDS::Shell(expl2.Current());
+        if (clearOfTool(s)) {
+            continue;
+        }
         FCBRepAlgoAPI_Common mkCommon(s, tool);
         if (!mkCommon.IsDone()) {
             continue;
@@ -337,6 +351,9 @@ void DrawViewDetail::makeDetailShape(const TopoDS_Shape& shape3d, DrawViewPart*
     TopExp_Explorer expl3(copyShape, TopAbs_EDGE, TopAbs_FACE);
     for (; expl3.More(); expl3.Next()) {
         const TopoDS_Edge& e = TopoDS::Edge(expl3.Current());
+        if (clearOfTool(e)) {
+            continue;
+        }
         FCBRepAlgoAPI_Common mkCommon(e, tool);
         if (!mkCommon.IsDone()) {
             continue;
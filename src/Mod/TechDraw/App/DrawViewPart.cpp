@@ -69,6 +69,7 @@
 #include <Base/Converter.h>
 #include <Base/Exception.h>
 #include <Base/Parameter.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 
 #include "Cosmetic.h"
@@ -102,7 +103,9 @@ DrawViewPart::DrawViewPart()
       m_handleFaces(false),
       nowUnsetting(false),
       m_waitingForFaces(false),
-      m_waitingForHlr(false)
+      m_waitingForHlr(false),
+      m_geometryInputChanged(true),
+      m_sourceHash(0)
 {
     static const char* group = "Projection";
     static const char* sgroup = "HLR Parameters";
@@ -247,6 +250,15 @@ App::DocumentObjectExecReturn* DrawViewPart::execute()
         XDirection.purgeTouched();//don't trigger updates!
     }
 
+    std::size_t sourceHash = ShapeUtils::contentHash(shape);
+    if (canKeepGeometry(sourceHash)) {
+        // only cosmetics or position changed, so hlr and face finding would give the same result
+        refreshCosmeticGeometry();
+        return DrawView::execute();
+    }
+    m_sourceHash = sourceHash;
+    m_geometryInputChanged = false;
+
     partExec(shape);
 
     return DrawView::execute();
@@ -285,9 +297,42 @@ void DrawViewPart::onChanged(const App::Property* prop)
         XDirection.setValue(Base::Vector3d(1.0, 0.0, 0.0));
     }
 
+    if (!isRestoring() && !isAnnotationProperty(prop)) {
+        m_geometryInputChanged = true;
+    }
+
     DrawView::onChanged(prop);
 }
 
+//! true for the properties that do not affect the projected geometry of the view
+bool DrawViewPart::isAnnotationProperty(const App::Property* prop) const
+{
+    return prop == &X || prop == &Y || prop == &LockPosition || prop == &Caption
+        || prop == &Label || prop == &Label2 || prop == &Visibility
+        || prop == &CosmeticVertexes || prop == &CosmeticEdges || prop == &CenterLines
+        || prop == &GeomFormats;
+}
+
+//! true if the current geometry can be reused because only annotation properties changed
+//! since the last hlr run and the source shape is unchanged
+bool DrawViewPart::canKeepGeometry(std::size_t sourceHash)
+{
+    if (m_geometryInputChanged || !geometryObject || waitingForFaces()
+        || sourceHash != m_sourceHash) {
+        return false;
+    }
+    TechDraw::DrawPage* page = findParentPage();
+    return !page || !page->forceRedraw();
+}
+
+//! replace the cosmetic geometry without redoing hlr
+void DrawViewPart::refreshCosmeticGeometry()
+{
+    refreshCVGeoms();
+    refreshCEGeoms();
+    refreshCLGeoms();
+}
+
 void DrawViewPart::partExec(TopoDS_Shape& shape)
 {
     if (waitingForHlr()) {
@@ -366,6 +411,10 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         return go;
     }
 
+    if (wantsPreview(shape)) {
+        showPreview(shape, viewAxis);
+    }
+
     //projectShape (the HLR process) runs in a separate thread since it can take a long time
     //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
     //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
@@ -384,6 +433,47 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
     return go;
 }
 
+//! true if the shape is big enough that the exact hlr will keep the view blank for a while
+bool DrawViewPart::wantsPreview(const TopoDS_Shape& shape) const
+{
+    int threshold = Preferences::previewHLRFaceCount();
+    if (threshold <= 0 || shape.IsNull()) {
+        return false;
+    }
+    int faceCount = 0;
+    for (TopExp_Explorer expl(shape, TopAbs_FACE); expl.More(); expl.Next()) {
+        if (++faceCount >= threshold) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! display a polygon hlr of the shape until the exact hlr running in the background replaces it
+//! in onHlrFinished.  The preview has no faces and no cosmetic geometry.
+void DrawViewPart::showPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    TechDraw::GeometryObjectPtr preview(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    preview->setIsoCount(IsoCount.getValue());
+    preview->isPerspective(Perspective.getValue());
+    preview->setFocus(Focus.getValue());
+    preview->usePolygonHLR(true);
+    preview->setScrubCount(ScrubCount.getValue());
+    try {
+        preview->projectShapeWithPolygonAlgo(shape, viewAxis);
+    }
+    catch (Base::Exception& e) {
+        // no preview, the view keeps its old geometry until the exact result arrives
+        e.reportException();
+        return;
+    }
+
+    geometryObject = preview;
+    bbox = geometryObject->calcBoundingBox();
+    requestPaint();
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
@@ -404,6 +494,10 @@ void DrawViewPart::onHlrFinished()
     //the last hlr related task is to make a bbox of the results
     bbox = geometryObject->calcBoundingBox();
 
+    m_timings = ViewTimings();
+    m_timings.hlr = geometryObject->hlrTime();
+    m_timings.geometry = geometryObject->geometryTime();
+
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
     showProgressMessage(getNameInDocument(), "has finished finding hidden lines");
@@ -414,31 +508,34 @@ void DrawViewPart::onHlrFinished()
     //HLR method.
 
     if (handleFaces() && !DU::isGuiUp()) {
-        extractFaces();
+        extractFacesTimed();
         onFacesFinished();
         return;
     }
 
-    if (handleFaces() && !CoarseView.getValue()) {
-        try {
-            //note that &m_faceWatcher in the third parameter is not strictly required, but using the
-            //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
-            //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
-            connectFaceWatcher =
-                QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
-                                 [this] { this->onFacesFinished(); });
+    if (!handleFaces() || CoarseView.getValue()) {
+        onUpdateFinished();
+        return;
+    }
 
-            auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
-            m_faceWatcher.setFuture(m_faceFuture);
-            waitingForFaces(true);
-        }
-        catch (Standard_Failure& e) {
-            waitingForFaces(false);
-            Base::Console().error("DVP::partExec - %s - extractFaces failed - %s **\n",
-                                  getNameInDocument(), e.GetMessageString());
-            throw Base::RuntimeError("DVP::onHlrFinished - error extracting faces");
-        }
+    try {
+        //note that &m_faceWatcher in the third parameter is not strictly required, but using the
+        //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
+        //https://github.com/KDE/clazy/blob/1.11/docs/checks/README-connect-3arg-lambda.md
+        connectFaceWatcher =
+            QObject::connect(&m_faceWatcher, &QFutureWatcherBase::finished, &m_faceWatcher,
+                             [this] { this->onFacesFinished(); });
+
+        auto lambda = [this]{this->extractFacesTimed();};
+        m_faceFuture = QtConcurrent::run(std::move(lambda));
+        m_faceWatcher.setFuture(m_faceFuture);
+        waitingForFaces(true);
+    }
+    catch (Standard_Failure& e) {
+        waitingForFaces(false);
+        Base::Console().error("DVP::partExec - %s - extractFaces failed - %s **\n",
+                              getNameInDocument(), e.GetMessageString());
+        throw Base::RuntimeError("DVP::onHlrFinished - error extracting faces");
     }
 }
 
@@ -446,9 +543,11 @@ void DrawViewPart::onHlrFinished()
 void DrawViewPart::postHlrTasks()
 {
     //add geometry that doesn't come from HLR
+    Base::TimeElapsed cosmeticStart;
     addCosmeticVertexesToGeom();
     addCosmeticEdgesToGeom();
     addReferencesToGeom();
+    m_timings.cosmetics = Base::TimeElapsed::diffTimeF(cosmeticStart);
     addPoints();
 
     //balloons need to be recomputed here because their
@@ -481,7 +580,9 @@ void DrawViewPart::postHlrTasks()
 void DrawViewPart::postFaceExtractionTasks()
 {
     // Some centerlines depend on faces so we could not add CL geometry before now
+    Base::TimeElapsed cosmeticStart;
     addCenterLinesToGeom();
+    m_timings.cosmetics += Base::TimeElapsed::diffTimeF(cosmeticStart);
 
     // Dimensions need to be recomputed because their references will be invalid
     //  until all the geometry (including centerlines dependent on faces) exists.
@@ -494,6 +595,14 @@ void DrawViewPart::postFaceExtractionTasks()
 }
 
 
+//! make faces from the edge geometry and record how long it took
+void DrawViewPart::extractFacesTimed()
+{
+    Base::TimeElapsed start;
+    extractFaces();
+    m_timings.faces = Base::TimeElapsed::diffTimeF(start);
+}
+
 //! make faces from the edge geometry
 void DrawViewPart::extractFaces()
 {
@@ -607,60 +716,7 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
-            continue;                   //skip zero length edges. shouldn't happen ;)
-        }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
-                continue;
-            }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
-            }
-
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
-
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits = DrawProjectSplit::findSplitPoints(nonZero);
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
@@ -713,6 +769,26 @@ void DrawViewPart::onFacesFinished()
     postFaceExtractionTasks();
 
     requestPaint();
+    onUpdateFinished();
+}
+
+//! record the size of the new geometry and, if asked for, report the timings of the page once
+//! all its views are done
+void DrawViewPart::onUpdateFinished()
+{
+    if (geometryObject) {
+        m_timings.edges = geometryObject->getEdgeGeometry().size();
+        m_timings.vertexes = geometryObject->getVertexGeometry().size();
+        m_timings.faceCount = geometryObject->getFaceGeometry().size();
+    }
+
+    if (!Preferences::reportTimings()) {
+        return;
+    }
+    TechDraw::DrawPage* page = findParentPage();
+    if (page) {
+        page->reportTimings();
+    }
 }
 
 
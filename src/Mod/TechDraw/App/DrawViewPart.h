@@ -78,6 +78,19 @@ namespace TechDraw
 {
 class DrawViewSection;
 
+//! the cost of the last update of a view: the seconds spent in each stage and the size of the
+//! resulting geometry
+struct ViewTimings
+{
+    double hlr {0.0};
+    double geometry {0.0};
+    double faces {0.0};
+    double cosmetics {0.0};
+    std::size_t edges {0};
+    std::size_t vertexes {0};
+    std::size_t faceCount {0};
+};
+
 
 enum class ProjDirection {
     Front,
@@ -237,6 +250,7 @@ public:
     void waitingForHlr(bool s) { m_waitingForHlr = s; }
     virtual bool waitingForResult() const;
     void progressValueChanged(int v);
+    const ViewTimings& getTimings() const { return m_timings; }
 
     bool isCosmeticVertex(const std::string& element);
     bool isCosmeticEdge(const std::string& element);
@@ -259,13 +273,21 @@ protected:
     void onChanged(const App::Property* prop) override;
     void unsetupObject() override;
 
+    bool isAnnotationProperty(const App::Property* prop) const;
+    bool canKeepGeometry(std::size_t sourceHash);
+    void refreshCosmeticGeometry();
+
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
+    bool wantsPreview(const TopoDS_Shape& shape) const;
+    void showPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
     void extractFaces();
+    void extractFacesTimed();
+    void onUpdateFinished();
     void findFacesNew(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
     void findFacesOld(const std::vector<TechDraw::BaseGeomPtr>& goEdges);
 
@@ -283,6 +305,12 @@ private:
     bool m_waitingForFaces;
     bool m_waitingForHlr;
 
+    // set when anything but the annotations of the view changes, cleared when hlr starts
+    bool m_geometryInputChanged;
+    std::size_t m_sourceHash;
+
+    ViewTimings m_timings;
+
     QMetaObject::Connection connectHlrWatcher;
     QFutureWatcher<void> m_hlrWatcher;
     QFuture<void> m_hlrFuture;
@@ -172,3 +172,11 @@ class DrawViewPart(DrawView):
     def requestPaint(self) -> Any:
         """requestPaint(). Redraw the graphic for this View."""
         ...
+
+    def getTimings(self) -> Any:
+        """
+        getTimings() - returns a dict with the seconds the last update of this View spent in hlr,
+        geometry conversion, face finding and cosmetics, and the number of edges, vertexes and faces
+        it produced.
+        """
+        ...
@@ -173,6 +173,24 @@ PyObject* DrawViewPartPy::requestPaint(PyObject *args)
     Py_Return;
 }
 
+PyObject* DrawViewPartPy::getTimings(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    const TechDraw::ViewTimings& timings = getDrawViewPartPtr()->getTimings();
+    Py::Dict result;
+    result.setItem("hlr", Py::Float(timings.hlr));
+    result.setItem("geometry", Py::Float(timings.geometry));
+    result.setItem("faces", Py::Float(timings.faces));
+    result.setItem("cosmetics", Py::Float(timings.cosmetics));
+    result.setItem("edgeCount", Py::Long(static_cast<long>(timings.edges)));
+    result.setItem("vertexCount", Py::Long(static_cast<long>(timings.vertexes)));
+    result.setItem("faceCount", Py::Long(static_cast<long>(timings.faceCount)));
+    return Py::new_reference_to(result);
+}
+
 PyObject* DrawViewPartPy::getGeometricCenter(PyObject *args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -380,10 +380,12 @@ TopoDS_Shape DrawViewSection::getShapeToCut()
         dvp = static_cast<TechDraw::DrawViewPart*>(base);
         constexpr bool fuseBefore{true};
         constexpr bool allow2d{false};
-        shapeToCut = dvp->getSourceShape(!fuseBefore, allow2d);
         if (FuseBeforeCut.getValue()) {
             shapeToCut = dvp->getSourceShape(fuseBefore);
         }
+        else {
+            shapeToCut = dvp->getSourceShape(!fuseBefore, allow2d);
+        }
     }
     else {
         Base::Console().message("DVS::getShapeToCut - base is weird\n");
@@ -516,13 +518,22 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
     }
 
     // perform the cut. We cut each solid in myShape individually to avoid issues
-    // where a compound BaseShape does not cut correctly.
+    // where a compound BaseShape does not cut correctly.  Solids that are clear of the
+    // tool are kept as they are without running a boolean.
+    Bnd_Box toolBox;
+    BRepBndLib::Add(m_cuttingTool, toolBox);
     BRep_Builder builder;
     TopoDS_Compound cutPieces;
     builder.MakeCompound(cutPieces);
     TopExp_Explorer expl(myShape, TopAbs_SOLID);
     for (; expl.More(); expl.Next()) {
         const TopoDS_Solid& s = TopoDS::Solid(expl.Current());
+        Bnd_Box solidBox;
+        BRepBndLib::Add(s, solidBox);
+        if (solidBox.IsOut(toolBox)) {
+            builder.Add(cutPieces, s);
+            continue;
+        }
         FCBRepAlgoAPI_Cut mkCut(s, m_cuttingTool);
         if (!mkCut.IsDone()) {
             Base::Console().warning("DVS: Section cut has failed in %s\n", getNameInDocument());
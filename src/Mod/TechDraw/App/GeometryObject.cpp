@@ -60,9 +60,14 @@
 #include <gp_Vec.hxx>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <list>
+#include <mutex>
+#include <vector>
 
 #include <Base/Console.h>
+#include <Base/Parallel.h>
 #include <Mod/Part/App/PartFeature.h>
 
 #include "Cosmetic.h"
@@ -71,6 +76,7 @@
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
 #include "DrawProjectSplit.h"
+#include "Preferences.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -78,9 +84,245 @@ using namespace std;
 
 using DU = DrawUtil;
 
+namespace
+{
+
+//! the edge compounds of a hlr run, in the order visible hard, smooth, seam, outline, iso, then
+//! the same for the hidden edges
+using HlrCompounds = std::array<TopoDS_Shape, 10>;
+
+//! the edge compounds of all the shapes of a hlr run, or of only one of them if part is given
+HlrCompounds hlrCompounds(HLRBRep_HLRToShape& hlrToShape,
+                          const TopoDS_Shape& part = TopoDS_Shape())
+{
+    if (part.IsNull()) {
+        return {hlrToShape.VCompound(),
+                hlrToShape.Rg1LineVCompound(),
+                hlrToShape.RgNLineVCompound(),
+                hlrToShape.OutLineVCompound(),
+                hlrToShape.IsoLineVCompound(),
+                hlrToShape.HCompound(),
+                hlrToShape.Rg1LineHCompound(),
+                hlrToShape.RgNLineHCompound(),
+                hlrToShape.OutLineHCompound(),
+                hlrToShape.IsoLineHCompound()};
+    }
+    return {hlrToShape.VCompound(part),
+            hlrToShape.Rg1LineVCompound(part),
+            hlrToShape.RgNLineVCompound(part),
+            hlrToShape.OutLineVCompound(part),
+            hlrToShape.IsoLineVCompound(part),
+            hlrToShape.HCompound(part),
+            hlrToShape.Rg1LineHCompound(part),
+            hlrToShape.RgNLineHCompound(part),
+            hlrToShape.OutLineHCompound(part),
+            hlrToShape.IsoLineHCompound(part)};
+}
+
+//! split a shape into parts that can be hidden separately: the solids, the shells and faces
+//! outside of them, and one compound of all the loose edges
+std::vector<TopoDS_Shape> hlrParts(const TopoDS_Shape& shape)
+{
+    std::vector<TopoDS_Shape> parts;
+    for (TopExp_Explorer expl(shape, TopAbs_SOLID); expl.More(); expl.Next()) {
+        parts.push_back(expl.Current());
+    }
+    for (TopExp_Explorer expl(shape, TopAbs_SHELL, TopAbs_SOLID); expl.More(); expl.Next()) {
+        parts.push_back(expl.Current());
+    }
+    for (TopExp_Explorer expl(shape, TopAbs_FACE, TopAbs_SHELL); expl.More(); expl.Next()) {
+        parts.push_back(expl.Current());
+    }
+
+    BRep_Builder builder;
+    TopoDS_Compound looseEdges;
+    builder.MakeCompound(looseEdges);
+    bool hasLooseEdges = false;
+    for (TopExp_Explorer expl(shape, TopAbs_EDGE, TopAbs_FACE); expl.More(); expl.Next()) {
+        builder.Add(looseEdges, expl.Current());
+        hasLooseEdges = true;
+    }
+    if (hasLooseEdges) {
+        parts.push_back(looseEdges);
+    }
+    return parts;
+}
+
+//! hide each part against the parts whose bounding box in view coordinates overlaps it and
+//! reaches in front of it, then merge the edges of all the parts.  The parts are independent, so
+//! they are processed in parallel.  Only valid for parallel projection.
+HlrCompounds projectPartitioned(const std::vector<TopoDS_Shape>& parts,
+                                const gp_Ax2& viewAxis,
+                                int isoCount)
+{
+    // view coordinates have the view direction as Z, larger Z is closer to the viewer
+    gp_Trsf toView;
+    toView.SetTransformation(gp_Ax3(viewAxis));
+
+    struct PartBox
+    {
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        bool canHide;
+    };
+    std::vector<PartBox> boxes;
+    boxes.reserve(parts.size());
+    for (auto& part : parts) {
+        Bnd_Box box;
+        BRepBndLib::Add(part, box);
+        PartBox partBox {};
+        partBox.canHide = TopExp_Explorer(part, TopAbs_FACE).More() && !box.IsVoid();
+        if (!box.IsVoid()) {
+            box.Transformed(toView).Get(partBox.xMin,
+                                        partBox.yMin,
+                                        partBox.zMin,
+                                        partBox.xMax,
+                                        partBox.yMax,
+                                        partBox.zMax);
+        }
+        boxes.push_back(partBox);
+    }
+
+    std::vector<HlrCompounds> results(parts.size());
+    Base::parallelFor(parts.size(), [&](std::size_t index) {
+        const PartBox& target = boxes[index];
+        Handle(HLRBRep_Algo) brep_hlr = new HLRBRep_Algo();
+        brep_hlr->Add(parts[index], isoCount);
+        for (std::size_t other = 0; other < parts.size(); ++other) {
+            const PartBox& occluder = boxes[other];
+            if (other == index || !occluder.canHide) {
+                continue;
+            }
+            if (occluder.xMin > target.xMax || occluder.xMax < target.xMin
+                || occluder.yMin > target.yMax || occluder.yMax < target.yMin
+                || occluder.zMax < target.zMin) {
+                continue;
+            }
+            brep_hlr->Add(parts[other], 0);
+        }
+        HLRAlgo_Projector projector(viewAxis);
+        brep_hlr->Projector(projector);
+        brep_hlr->Update();
+        brep_hlr->Hide();
+
+        HLRBRep_HLRToShape hlrToShape(brep_hlr);
+        results[index] = hlrCompounds(hlrToShape, parts[index]);
+    });
+
+    HlrCompounds merged;
+    BRep_Builder builder;
+    for (std::size_t kind = 0; kind < merged.size(); ++kind) {
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        bool isEmpty = true;
+        for (auto& result : results) {
+            if (!result[kind].IsNull()) {
+                builder.Add(compound, result[kind]);
+                isEmpty = false;
+            }
+        }
+        if (!isEmpty) {
+            merged[kind] = compound;
+        }
+    }
+    return merged;
+}
+
+//! identifies the input of a hlr run: the shape, the projection and the hlr parameters
+struct HlrCacheKey
+{
+    std::size_t shapeHash;
+    std::array<double, 9> axis;
+    int isoCount;
+    bool isPersp;
+    double focus;
+
+    bool operator==(const HlrCacheKey& other) const
+    {
+        return shapeHash == other.shapeHash && axis == other.axis && isoCount == other.isoCount && isPersp == other.isPersp
+            && focus == other.focus;
+    }
+};
+
+//! the shape passed to projectShape is a fresh copy each time, so it is identified by its
+//! content
+HlrCacheKey makeHlrCacheKey(const TopoDS_Shape& shape,
+                            const gp_Ax2& viewAxis,
+                            int isoCount,
+                            bool isPersp,
+                            double focus)
+{
+    const gp_Pnt& location = viewAxis.Location();
+    const gp_Dir& direction = viewAxis.Direction();
+    const gp_Dir& xDirection = viewAxis.XDirection();
+    return {ShapeUtils::contentHash(shape),
+            {location.X(),
+             location.Y(),
+             location.Z(),
+             direction.X(),
+             direction.Y(),
+             direction.Z(),
+             xDirection.X(),
+             xDirection.Y(),
+             xDirection.Z()},
+            isoCount,
+            isPersp,
+            isPersp ? focus : 0.0};
+}
+
+//! the post processed hlr results of the last projections, shared by all views of all documents
+//! so that unchanged views and views with the same projection do not repeat the hlr run
+class HlrCache
+{
+public:
+    bool find(const HlrCacheKey& key, HlrCompounds& result)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = findEntry(key);
+        if (it == entries.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it);  // most recently used first
+        result = it->second;
+        return true;
+    }
+
+    void insert(const HlrCacheKey& key, const HlrCompounds& result, std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (findEntry(key) != entries.end()) {
+            return;  // another view with the same projection finished first
+        }
+        entries.emplace_front(key, result);
+        while (entries.size() > capacity) {
+            entries.pop_back();
+        }
+    }
+
+private:
+    using Entries = std::list<std::pair<HlrCacheKey, HlrCompounds>>;
+
+    Entries::iterator findEntry(const HlrCacheKey& key)
+    {
+        return std::find_if(entries.begin(), entries.end(), [&key](const auto& entry) {
+            return entry.first == key;
+        });
+    }
+
+    std::mutex mutex;
+    Entries entries;
+};
+
+HlrCache& hlrCache()
+{
+    static HlrCache cache;
+    return cache;
+}
+
+}  // namespace
+
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_hlrTime(0.0), m_geometryTime(0.0)
 
 {}
 
@@ -139,24 +381,62 @@ void GeometryObject::clear()
 
 void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
 {
+    Base::TimeElapsed start;
     clear();
 
+    // same order as HlrCompounds
+    std::array<TopoDS_Shape*, 10> targets {&visHard,
+                                           &visSmooth,
+                                           &visSeam,
+                                           &visOutline,
+                                           &visIso,
+                                           &hidHard,
+                                           &hidSmooth,
+                                           &hidSeam,
+                                           &hidOutline,
+                                           &hidIso};
+
+    int cacheSize = Preferences::hlrCacheSize();
+    HlrCacheKey cacheKey {};
+    if (cacheSize > 0) {
+        cacheKey = makeHlrCacheKey(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+        HlrCompounds cached;
+        if (hlrCache().find(cacheKey, cached)) {
+            for (std::size_t kind = 0; kind < targets.size(); ++kind) {
+                *targets[kind] = cached[kind];
+            }
+            finishProjection(start);
+            return;
+        }
+    }
+
+    std::vector<TopoDS_Shape> parts;
+    if (!m_isPersp && Preferences::partitionedHLR()) {
+        parts = hlrParts(inShape);
+    }
+
+    HlrCompounds compounds;
     Handle(HLRBRep_Algo) brep_hlr;
     try {
-        brep_hlr = new HLRBRep_Algo();
-        //        brep_hlr->Debug(true);
-        brep_hlr->Add(inShape, m_isoCount);
-        if (m_isPersp) {
-            double fLength = std::max(Precision::Confusion(), m_focus);
-            HLRAlgo_Projector projector(viewAxis, fLength);
-            brep_hlr->Projector(projector);
+        if (parts.size() > 1) {
+            compounds = projectPartitioned(parts, viewAxis, m_isoCount);
         }
         else {
-            HLRAlgo_Projector projector(viewAxis);
-            brep_hlr->Projector(projector);
+            brep_hlr = new HLRBRep_Algo();
+            //        brep_hlr->Debug(true);
+            brep_hlr->Add(inShape, m_isoCount);
+            if (m_isPersp) {
+                double fLength = std::max(Precision::Confusion(), m_focus);
+                HLRAlgo_Projector projector(viewAxis, fLength);
+                brep_hlr->Projector(projector);
+            }
+            else {
+                HLRAlgo_Projector projector(viewAxis);
+                brep_hlr->Projector(projector);
+            }
+            brep_hlr->Update();
+            brep_hlr->Hide();
         }
-        brep_hlr->Update();
-        brep_hlr->Hide();
     }
     catch (const Standard_Failure& e) {
         Base::Console().error("GO::projectShape - OCC error - %s - while projecting shape\n",
@@ -168,68 +448,17 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
     }
 
     try {
-        HLRBRep_HLRToShape hlrToShape(brep_hlr);
-
-        if (!hlrToShape.VCompound().IsNull()) {
-            visHard = hlrToShape.VCompound();
-            BRepLib::BuildCurves3d(visHard);
-            visHard =ShapeUtils::invertGeometry(visHard);
-            //            BRepTools::Write(visHard, "GOvisHard.brep");            //debug
+        if (!brep_hlr.IsNull()) {
+            HLRBRep_HLRToShape hlrToShape(brep_hlr);
+            compounds = hlrCompounds(hlrToShape);
         }
 
-        if (!hlrToShape.Rg1LineVCompound().IsNull()) {
-            visSmooth = hlrToShape.Rg1LineVCompound();
-            BRepLib::BuildCurves3d(visSmooth);
-            visSmooth =ShapeUtils::invertGeometry(visSmooth);
-        }
-
-        if (!hlrToShape.RgNLineVCompound().IsNull()) {
-            visSeam = hlrToShape.RgNLineVCompound();
-            BRepLib::BuildCurves3d(visSeam);
-            visSeam =ShapeUtils::invertGeometry(visSeam);
-        }
-
-        if (!hlrToShape.OutLineVCompound().IsNull()) {
-            //            BRepTools::Write(hlrToShape.OutLineVCompound(), "GOOutLineVCompound.brep");            //debug
-            visOutline = hlrToShape.OutLineVCompound();
-            BRepLib::BuildCurves3d(visOutline);
-            visOutline =ShapeUtils::invertGeometry(visOutline);
-        }
-
-        if (!hlrToShape.IsoLineVCompound().IsNull()) {
-            visIso = hlrToShape.IsoLineVCompound();
-            BRepLib::BuildCurves3d(visIso);
-            visIso =ShapeUtils::invertGeometry(visIso);
-        }
-
-        if (!hlrToShape.HCompound().IsNull()) {
-            hidHard = hlrToShape.HCompound();
-            BRepLib::BuildCurves3d(hidHard);
-            hidHard =ShapeUtils::invertGeometry(hidHard);
-        }
-
-        if (!hlrToShape.Rg1LineHCompound().IsNull()) {
-            hidSmooth = hlrToShape.Rg1LineHCompound();
-            BRepLib::BuildCurves3d(hidSmooth);
-            hidSmooth =ShapeUtils::invertGeometry(hidSmooth);
-        }
-
-        if (!hlrToShape.RgNLineHCompound().IsNull()) {
-            hidSeam = hlrToShape.RgNLineHCompound();
-            BRepLib::BuildCurves3d(hidSeam);
-            hidSeam =ShapeUtils::invertGeometry(hidSeam);
-        }
-
-        if (!hlrToShape.OutLineHCompound().IsNull()) {
-            hidOutline = hlrToShape.OutLineHCompound();
-            BRepLib::BuildCurves3d(hidOutline);
-            hidOutline =ShapeUtils::invertGeometry(hidOutline);
-        }
-
-        if (!hlrToShape.IsoLineHCompound().IsNull()) {
-            hidIso = hlrToShape.IsoLineHCompound();
-            BRepLib::BuildCurves3d(hidIso);
-            hidIso =ShapeUtils::invertGeometry(hidIso);
+        for (std::size_t kind = 0; kind < targets.size(); ++kind) {
+            if (!compounds[kind].IsNull()) {
+                BRepLib::BuildCurves3d(compounds[kind]);
+                compounds[kind] = ShapeUtils::invertGeometry(compounds[kind]);
+                *targets[kind] = compounds[kind];
+            }
         }
     }
     catch (const Standard_Failure&) {
@@ -241,7 +470,20 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    if (cacheSize > 0) {
+        hlrCache().insert(cacheKey, compounds, cacheSize);
+    }
+
+    finishProjection(start);
+}
+
+//! record the time the hlr took since start, then convert its output into TD Geometry
+void GeometryObject::finishProjection(const Base::TimeElapsed& start)
+{
+    m_hlrTime = Base::TimeElapsed::diffTimeF(start);
+    Base::TimeElapsed geometryStart;
     makeTDGeometry();
+    m_geometryTime = Base::TimeElapsed::diffTimeF(geometryStart);
 }
 
 //convert the hlr output into TD Geometry
@@ -287,6 +529,7 @@ void GeometryObject::makeTDGeometry()
 void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, const gp_Ax2& viewAxis)
 {
 //    Base::Console().message("GO::projectShapeWithPolygonAlgo()\n");
+    Base::TimeElapsed start;
     // Clear previous Geometry
     clear();
 
@@ -385,7 +628,7 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
                                  "occurred while extracting edges");
     }
 
-    makeTDGeometry();
+    finishProjection(start);
 }
 
 //project the edges in shape onto XY.mirrored plane of CS.  mimics the projection
@@ -37,6 +37,7 @@
 #include <gp_Pnt.hxx>
 
 #include <Base/BoundBox.h>
+#include <Base/TimeInfo.h>
 #include <Base/Vector3D.h>
 
 #include "Geometry.h"
@@ -97,6 +98,9 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
+    //! seconds spent in the last hlr run and in converting its result to TechDraw geometry
+    double hlrTime() const { return m_hlrTime; }
+    double geometryTime() const { return m_geometryTime; }
 
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -141,6 +145,7 @@ protected:
     TopoDS_Shape hidIso;
 
     void addGeomFromCompound(TopoDS_Shape edgeCompound, EdgeClass category, bool visible);
+    void finishProjection(const Base::TimeElapsed& start);
     TechDraw::DrawViewDetail* isParentDetail();
 
     //similar function in Geometry?
@@ -164,6 +169,8 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    double m_hlrTime;
+    double m_geometryTime;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -726,3 +726,31 @@ bool Preferences::fixColorAlphaOnLoad()
 {
     return getPreferenceGroup("General")->GetBool("FixColorAlphaOnLoad", true);
 }
+
+//! if true, the hidden lines of a view with several solids are removed solid by solid in
+//! parallel, each against only the solids that can cover it.  Does not apply to perspective views.
+bool Preferences::partitionedHLR()
+{
+    return getPreferenceGroup("General")->GetBool("PartitionedHLR", true);
+}
+
+//! the number of hlr results kept for reuse by views with an unchanged shape and projection.
+//! 0 turns the cache off.
+int Preferences::hlrCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("HLRCacheSize", 20);
+}
+
+//! shapes with at least this many faces are shown with a polygon hlr preview while the exact hlr
+//! runs in the background.  0 turns the preview off.
+int Preferences::previewHLRFaceCount()
+{
+    return getPreferenceGroup("General")->GetInt("PreviewHLRFaceCount", 2000);
+}
+
+//! if true, a table of the time each view of a page spent in hlr, face finding and cosmetics is
+//! written to the report view when the page has finished updating
+bool Preferences::reportTimings()
+{
+    return getPreferenceGroup("General")->GetBool("ReportTimings", false);
+}
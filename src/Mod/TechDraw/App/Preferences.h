@@ -170,6 +170,11 @@ public:
 
     static bool fixColorAlphaOnLoad();
 
+    static bool partitionedHLR();
+    static int hlrCacheSize();
+    static int previewHLRFaceCount();
+    static bool reportTimings();
+
 };
 
 
@@ -21,7 +21,11 @@
  ***************************************************************************/
 
 
+# include <algorithm>
+# include <list>
+# include <mutex>
 # include <sstream>
+# include <utility>
 # include <BRep_Builder.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
 # include <BRepTools.hxx>
@@ -58,6 +62,51 @@ using namespace Measure;
 using DU = DrawUtil;
 using SU = ShapeUtils;
 
+namespace
+{
+
+//! the fused 3d shapes of the last sources, so a view and the sections and details based on it
+//! fuse the same sources only once
+class FusedShapeCache
+{
+public:
+    bool find(std::size_t key, TopoDS_Shape& fused)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = std::find_if(entries.begin(), entries.end(), [key](const auto& entry) {
+            return entry.first == key;
+        });
+        if (it == entries.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it);  // most recently used first
+        fused = it->second;
+        return true;
+    }
+
+    void insert(std::size_t key, const TopoDS_Shape& fused)
+    {
+        constexpr std::size_t capacity {8};
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.emplace_front(key, fused);
+        while (entries.size() > capacity) {
+            entries.pop_back();
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::list<std::pair<std::size_t, TopoDS_Shape>> entries;
+};
+
+FusedShapeCache& fusedShapeCache()
+{
+    static FusedShapeCache cache;
+    return cache;
+}
+
+}  // namespace
+
 
 //! pick out the 2d document objects in the list of links and return a vector of their shapes
 //! Note that point objects will not make it through the hlr/projection process.
@@ -340,7 +389,12 @@ TopoDS_Shape ShapeExtractor::getShapesFused(const std::vector<App::DocumentObjec
 {
     // get only the 3d shapes and fuse them
     TopoDS_Shape baseShape = getShapes(links, false);
-    if (!baseShape.IsNull()) {
+    std::size_t key = baseShape.IsNull() ? 0 : SU::contentHash(baseShape);
+    TopoDS_Shape cachedShape;
+    if (!baseShape.IsNull() && fusedShapeCache().find(key, cachedShape)) {
+        baseShape = cachedShape;
+    }
+    else if (!baseShape.IsNull()) {
         TopoDS_Iterator it(baseShape);
         TopoDS_Shape fusedShape = it.Value();
         it.Next();
@@ -355,6 +409,7 @@ TopoDS_Shape ShapeExtractor::getShapesFused(const std::vector<App::DocumentObjec
             fusedShape = mkFuse.Shape();
         }
         baseShape = fusedShape;
+        fusedShapeCache().insert(key, baseShape);
     }
 
     // if there are 2d shapes in the links they will not fuse with the 3d shapes,
@@ -23,7 +23,10 @@
 //! a class to contain useful shape manipulations. these methods were originally
 //  in GeometryObject.
 
+#include <functional>
 #include <limits>
+#include <sstream>
+#include <string>
 
 #include <BRepAlgo_NormalProjection.hxx>
 #include <BRepBndLib.hxx>
@@ -409,6 +412,15 @@ bool  ShapeUtils::isShapeReallyNull(TopoDS_Shape shape)
     return shape.IsNull() || !TopoDS_Iterator(shape).More();
 }
 
+//! hash the geometry and topology of a shape, so that equal copies of a shape have the same
+//! hash.  Writing the shape out is far cheaper than hlr or face finding on it.
+std::size_t ShapeUtils::contentHash(const TopoDS_Shape& shape)
+{
+    std::ostringstream stream;
+    BRepTools::Write(shape, stream);
+    return std::hash<std::string>()(stream.str());
+}
+
 bool ShapeUtils::edgesAreParallel(TopoDS_Edge edge0, TopoDS_Edge edge1)
 {
     std::pair<Base::Vector3d, Base::Vector3d> ends0 = getEdgeEnds(edge0);
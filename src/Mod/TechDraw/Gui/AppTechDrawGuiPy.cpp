@@ -59,6 +59,9 @@ public:
         add_varargs_method("exportPageAsSvg", &Module::exportPageAsSvg,
             "exportPageAsSvg(DrawPageObject, FilePath) -- print page as Svg to file."
         );
+        add_varargs_method("exportPages", &Module::exportPages,
+            "exportPages([DrawPageObject], [FilePath]) -- print each page to the matching file, as Svg or Pdf by file suffix."
+        );
         add_varargs_method("addQGIToView", &Module::addQGIToView,
             "addQGIToView(View, QGraphicsItem) -- insert graphics item into view's graphic."
         );
@@ -241,6 +244,49 @@ private:
         return Py::None();
     }
 
+//!exportPages([PageObject], [FullPath])
+    Py::Object exportPages(const Py::Tuple& args)
+    {
+        PyObject *pagesObj;
+        PyObject *filesObj;
+        if (!PyArg_ParseTuple(args.ptr(), "OO", &pagesObj, &filesObj)) {
+            throw Py::TypeError("expected ([Page], [path])");
+        }
+
+        Py::Sequence pages(pagesObj);
+        Py::Sequence files(filesObj);
+        if (pages.size() != files.size()) {
+            throw Py::ValueError("expected as many paths as pages");
+        }
+
+        std::vector<ViewProviderPage*> vpPages;
+        std::vector<std::string> filePaths;
+        for (Py::Sequence::size_type i = 0; i < pages.size(); i++) {
+            PyObject* pageObj = pages[i].ptr();
+            if (!PyObject_TypeCheck(pageObj, &(TechDraw::DrawPagePy::Type))) {
+                throw Py::TypeError("expected a list of pages");
+            }
+            auto obj = static_cast<App::DocumentObjectPy*>(pageObj)->getDocumentObjectPtr();
+            auto vpPage = dynamic_cast<TechDrawGui::ViewProviderPage*>(
+                Gui::Application::Instance->getViewProvider(obj));
+            if (!vpPage) {
+                throw Py::TypeError("Page not available! Is it Hidden?");
+            }
+            vpPages.push_back(vpPage);
+            filePaths.push_back(Py::String(files[i]).as_std_string("utf-8"));
+        }
+
+        try {
+            PagePrinter::exportPages(vpPages, filePaths);
+        }
+        catch (Base::Exception &e) {
+            e.setPyException();
+            throw Py::Exception();
+        }
+
+        return Py::None();
+    }
+
         Py::Object addQGIToView(const Py::Tuple& args)
     {
         PyObject *viewPy = nullptr;
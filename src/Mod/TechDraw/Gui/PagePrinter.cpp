@@ -21,6 +21,8 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+
 #include <QApplication>
 #include <QMessageBox>
 #include <QPageLayout>
@@ -31,6 +33,7 @@
 #include <QPrintDialog>
 #include <QPrintPreviewDialog>
 #include <QPrinter>
+#include <QThreadPool>
 
 
 #include <App/Application.h>
@@ -49,6 +52,7 @@
 #include <Mod/TechDraw/App/DrawPagePy.h>
 #include <Mod/TechDraw/App/DrawTemplate.h>
 #include <Mod/TechDraw/App/DrawUtil.h>
+#include <Mod/TechDraw/App/DrawViewPart.h>
 #include <Mod/TechDraw/App/Preferences.h>
 
 #include "PagePrinter.h"
@@ -58,6 +62,31 @@
 #include "DrawGuiUtil.h"
 
 using namespace TechDrawGui;
+
+namespace
+{
+
+bool pageWaitingForResult(TechDraw::DrawPage* dPage)
+{
+    for (auto* obj : dPage->getAllViews()) {
+        auto* part = freecad_cast<TechDraw::DrawViewPart*>(obj);
+        if (part && part->waitingForResult()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! wait for the exact hlr and the faces of all the views on the page, so an export never
+//! contains a preview.
+void waitForPage(TechDraw::DrawPage* dPage)
+{
+    while (pageWaitingForResult(dPage)) {
+        QApplication::processEvents(QEventLoop::AllEvents, 50);
+    }
+}
+
+}  // namespace
 using namespace TechDraw;
 using DU = DrawUtil;
 
@@ -298,6 +327,8 @@ void PagePrinter::printBannerPage(QPrinter* printer, QPainter& painter, QPageLay
 void PagePrinter::renderPage(ViewProviderPage* vpp, QPainter& painter, QRectF& sourceRect,
                              QRect& targetRect)
 {
+    waitForPage(vpp->getDrawPage());
+
     // Clear selection to avoid it being rendered to the file
     vpp->getQGSPage()->clearSelection();
     vpp->setTemplateMarkers(false);
@@ -420,6 +451,8 @@ void PagePrinter::saveSVG(ViewProviderPage* vpPage, const std::string& file)
     filespec = DU::cleanFilespecBackslash(file);
     QString filename = QString::fromStdString(filespec);
 
+    waitForPage(vpPage->getDrawPage());
+
     auto ourScene = vpPage->getQGSPage();
     ourScene->setExportingSvg(true);
     auto ourDoc = vpPage->getDocument();
@@ -456,6 +489,42 @@ void PagePrinter::savePDF(ViewProviderPage* vpPage, const std::string& file)
     printPdf(vpPage, file);
 }
 
+//! export several pages, each to its own pdf or svg file depending on the file's suffix.
+//! The views of a batch of pages are recomputed together so their hidden line removal runs
+//! concurrently in the global thread pool, then the pages are rendered one after the other as
+//! their views get their results, since the scenes can only be painted in the gui thread. The
+//! batch size is the thread pool size, which bounds the number of pages whose results are pending
+//! at any time.
+void PagePrinter::exportPages(const std::vector<ViewProviderPage*>& vpPages,
+                              const std::vector<std::string>& files)
+{
+    if (vpPages.size() != files.size()) {
+        Base::Console().error("PagePrinter - %zu pages but %zu files\n",
+                              vpPages.size(),
+                              files.size());
+        return;
+    }
+
+    size_t batchSize = std::max(1, QThreadPool::globalInstance()->maxThreadCount());
+    for (size_t first = 0; first < vpPages.size(); first += batchSize) {
+        size_t last = std::min(first + batchSize, vpPages.size());
+
+        // start the hlr of every view in the batch before waiting on any of them
+        for (size_t i = first; i < last; i++) {
+            vpPages[i]->getDrawPage()->redrawCommand();
+        }
+        for (size_t i = first; i < last; i++) {
+            Base::FileInfo fi(files[i]);
+            if (fi.hasExtension("svg")) {
+                saveSVG(vpPages[i], files[i]);
+            }
+            else {
+                savePDF(vpPages[i], files[i]);
+            }
+        }
+    }
+}
+
 
 PaperAttributes::PaperAttributes() :
     m_orientation(QPageLayout::Orientation::Landscape),
@@ -112,6 +112,9 @@ public:
     static void saveSVG(ViewProviderPage* vpPage, const std::string& file);
     static void saveDXF(ViewProviderPage* vpPage, const std::string& file);
     static void savePDF(ViewProviderPage* vpPage, const std::string& file);
+
+    static void exportPages(const std::vector<ViewProviderPage*>& vpPages,
+                            const std::vector<std::string>& files);
 };
 
 }  // namespace TechDrawGui
\ No newline at end of file
@@ -21,8 +21,12 @@
  ***************************************************************************/
 
 
+# include <algorithm>
+
+# include <QPainter>
 # include <QPainterPath>
 # include <QPainterPathStroker>
+# include <QStyleOptionGraphicsItem>
 
 
 #include <App/Application.h>
@@ -89,11 +93,31 @@ QRectF QGIEdge::boundingRect() const
 
 QPainterPath QGIEdge::shape() const
 {
-    QPainterPath outline;
-    QPainterPathStroker stroker;
-    stroker.setWidth(this->m_edgeFuzz);
-    outline = stroker.createStroke(path());
-    return outline;
+    // comparing an unchanged path only compares the shared data pointers
+    if (m_shape.isEmpty() || m_shapePath != path()) {
+        QPainterPathStroker stroker;
+        stroker.setWidth(this->m_edgeFuzz);
+        m_shapePath = path();
+        m_shape = stroker.createStroke(m_shapePath);
+    }
+    return m_shape;
+}
+
+void QGIEdge::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    // zoomed out so far that the whole edge covers about a pixel, its curve details can't be seen
+    // and a line between its ends looks the same
+    const QPainterPath& edgePath = path();
+    QRectF bounds = edgePath.controlPointRect();
+    double detail = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+    if (edgePath.elementCount() > 2 && std::max(bounds.width(), bounds.height()) * detail < 1.0) {
+        setPen(m_pen);
+        painter->setPen(m_pen);
+        painter->drawLine(QPointF(edgePath.elementAt(0)),
+                          QPointF(edgePath.elementAt(edgePath.elementCount() - 1)));
+        return;
+    }
+    QGIPrimPath::paint(painter, option, widget);
 }
 
 void QGIEdge::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
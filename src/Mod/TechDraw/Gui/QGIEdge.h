@@ -42,6 +42,9 @@ public:
     int type() const override { return Type;}
     QRectF boundingRect() const override;
     QPainterPath shape() const override;
+    void paint(QPainter* painter,
+               const QStyleOptionGraphicsItem* option,
+               QWidget* widget = nullptr) override;
 
     int getProjIndex() const { return projIndex; }
 
@@ -72,6 +75,10 @@ private:
     bool isSmoothEdge;
 
     TechDraw::SourceType m_source{TechDraw::SourceType::GEOMETRY};
+
+    // the scene asks for the bounding rect often, stroking the path each time is slow
+    mutable QPainterPath m_shapePath;
+    mutable QPainterPath m_shape;
 };
 
 }
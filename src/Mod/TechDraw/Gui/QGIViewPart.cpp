@@ -405,15 +405,24 @@ void QGIViewPart::drawAllEdges()
     const TechDraw::BaseGeomPtrVector& geoms = dvp->getEdgeGeometry();
     TechDraw::BaseGeomPtrVector::const_iterator itGeom = geoms.begin();
     QGIEdge* item{};
+    // the geometry objects are replaced when the view is recomputed, so paths of the previous
+    // draw are only found while the geometry is unchanged.  Only the paths drawn now are kept.
+    std::unordered_map<TechDraw::BaseGeomPtr, QPainterPath> edgePaths;
+    edgePaths.reserve(geoms.size());
     for (int iEdge = 0; itGeom != geoms.end(); itGeom++, iEdge++) {
         bool showItem = true;
         if (!showThisEdge(*itGeom)) {
             continue;
         }
 
+        auto cached = m_edgePaths.find(*itGeom);
+        QPainterPath edgePath =
+            cached != m_edgePaths.end() ? cached->second : drawPainterPath(*itGeom);
+        edgePaths.emplace(*itGeom, edgePath);
+
         item = new QGIEdge(iEdge);
         addToGroupWithoutUpdate(item);      //item is created at scene(0, 0), not group(0, 0)
-        item->setPath(drawPainterPath(*itGeom));
+        item->setPath(edgePath);
         item->setSource((*itGeom)->source());
 
         item->setNormalColor(PreferencesGui::getAccessibleQColor(PreferencesGui::normalQColor()));
@@ -487,6 +496,7 @@ void QGIViewPart::drawAllEdges()
         //            edgeId << "QGIVP.edgePath" << i;
         //            dumpPath(edgeId.str().c_str(), edgePath);
     }
+    m_edgePaths.swap(edgePaths);
 }
 
 void QGIViewPart::drawAllVertexes()
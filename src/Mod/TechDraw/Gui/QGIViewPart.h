@@ -27,6 +27,8 @@
 #include <Mod/TechDraw/App/Geometry.h>
 #include <Mod/TechDraw/App/LineGenerator.h>
 
+#include <unordered_map>
+
 #include <QPainter>
 #include <QStyleOptionGraphicsItem>
 
@@ -159,6 +161,8 @@ protected:
 private:
     QList<QGraphicsItem*> deleteItems;
     PathBuilder* m_pathBuilder;
+    // painter paths of the edges drawn last time, reused while the geometry is unchanged
+    std::unordered_map<TechDraw::BaseGeomPtr, QPainterPath> m_edgePaths;
     TechDraw::LineGenerator* m_dashedLineGenerator;
     QMetaObject::Connection m_selectionChangedConnection;
 
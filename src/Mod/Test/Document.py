@@ -340,6 +340,41 @@ class DocumentBasicCases(unittest.TestCase):
         self.assertEqual(obj.Rot.RawAxis.y, 2)
         self.assertEqual(obj.Rot.RawAxis.z, 1)
 
+    def testAddObjects(self):
+        objs = self.Doc.addObjects("App::FeatureTest", 3, {"Integer": 7})
+        self.assertEqual(len(objs), 3)
+        self.assertEqual(len({o.Name for o in objs}), 3)
+        self.assertTrue(all(o.Integer == 7 for o in objs))
+        self.assertEqual(self.Doc.ActiveObject, objs[-1])
+
+        objs = self.Doc.addObjects(
+            "App::FeatureTest", ["Bulk", "Bulk", ""], [{"Integer": i} for i in range(3)]
+        )
+        self.assertEqual(objs[0].Name, "Bulk")
+        self.assertNotEqual(objs[1].Name, "Bulk")
+        self.assertEqual([o.Integer for o in objs], [0, 1, 2])
+
+        with self.assertRaises(ValueError):
+            self.Doc.addObjects("App::FeatureTest", 2, [{}])
+        with self.assertRaises(AttributeError):
+            self.Doc.addObjects("App::FeatureTest", 1, {"NoSuchProperty": 1})
+        with self.assertRaises(TypeError):
+            self.Doc.addObjects("App::NoSuchType", 1)
+
+    def testObjectsByLabel(self):
+        obj1 = self.Doc.addObject("App::FeatureTest", "ByLabel1")
+        obj2 = self.Doc.addObject("App::FeatureTest", "ByLabel2")
+        self.assertEqual(self.Doc.getObjectsByLabel("ByLabel1"), [obj1])
+        obj1.Label = "Renamed"
+        self.assertEqual(self.Doc.getObjectsByLabel("ByLabel1"), [])
+        self.assertEqual(self.Doc.getObjectsByLabel("Renamed"), [obj1])
+        obj2.setExpression("Integer", "<<Renamed>>.Integer + 1")
+        obj1.Integer = 4
+        self.Doc.recompute()
+        self.assertEqual(obj2.Integer, 5)
+        self.Doc.removeObject(obj1.Name)
+        self.assertEqual(self.Doc.getObjectsByLabel("Renamed"), [])
+
     def testAddRemove(self):
         L1 = self.Doc.addObject("App::FeatureTest", "Label_1")
         # must delete object
@@ -2237,6 +2272,31 @@ class DocumentObserverCases(unittest.TestCase):
         FreeCAD.closeDocument(self.Doc1.Name)
         self.Obs.clear()
 
+    def testObserverFilter(self):
+        class FilteredObserver:
+            observedProperties = ["Integer"]
+
+            def __init__(self):
+                self.changes = []
+
+            def slotChangedObject(self, obj, prop):
+                self.changes.append((obj.Name, prop))
+
+        self.Doc1 = FreeCAD.newDocument("Observer1")
+        obj1 = self.Doc1.addObject("App::FeatureTest", "Obj1")
+        obs = FilteredObserver()
+        FreeCAD.addDocumentObserver(obs)
+        try:
+            obj1.Integer = 3
+            obj1.Float = 1.5
+            obj1.Label = "Changed"
+        finally:
+            FreeCAD.removeDocumentObserver(obs)
+        self.assertEqual(obs.changes, [("Obj1", "Integer")])
+
+        FreeCAD.closeDocument(self.Doc1.Name)
+        self.Obs.clear()
+
     def testUndoDisabledDocument(self):
 
         # testing document level signals
@@ -616,6 +616,9 @@ PyObject * @self.export.Name@::staticCallback_@i.Name@ (PyObject *self, PyObject
     }
 -
 
+    // serializes calls on the same object if there is no GIL
+    Base::PyObjectLocker lock(self);
+
 -
     try { // catches all exceptions coming up from c++ and generate a python exception
 + if i.Keyword:
@@ -2,9 +2,12 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <sstream>
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObjectGroup.h"
+#include "App/Link.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +97,163 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, topologicalSortFollowsLinkChanges)
+{
+    // Arrange
+    auto child = doc()->addObject("App::DocumentObjectGroup");
+    auto group = dynamic_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup"));
+    auto sortedBefore = doc()->topologicalSort();
+
+    // Act
+    group->addObject(child);
+    auto sortedAfter = doc()->topologicalSort();
+
+    // Assert
+    EXPECT_THAT(sortedBefore, ::testing::ElementsAre(child, group));
+    EXPECT_THAT(sortedAfter, ::testing::ElementsAre(group, child));
+}
+
+TEST_F(DocumentTest, undoLimitRemovesOldestTransactions)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup");
+    doc()->setUndoMode(1);
+    doc()->setUndoLimit(25000);
+
+    // Act
+    for (char ch = 'a'; ch < 'f'; ch++) {
+        doc()->openTransaction("Change label");
+        obj->Label.setValue(std::string(10000, ch));
+        doc()->commitTransaction();
+    }
+
+    // Assert
+    EXPECT_LE(doc()->getUndoMemSize(), 25000U);
+    EXPECT_GE(doc()->getAvailableUndos(), 1);
+    EXPECT_LT(doc()->getAvailableUndos(), 5);
+    doc()->undo();
+    EXPECT_EQ(obj->Label.getStrValue(), std::string(10000, 'd'));
+}
+
+TEST_F(DocumentTest, recomputeStatsListRecomputedObjects)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup");
+    obj->Label.setValue("Changed");
+    std::ostringstream trace;
+
+    // Act
+    doc()->recompute();
+    auto stats = doc()->getRecomputeStats();
+    doc()->writeRecomputeTrace(trace);
+
+    // Assert
+    ASSERT_EQ(stats.size(), 1U);
+    EXPECT_EQ(stats[0].Name, obj->getNameInDocument());
+    EXPECT_EQ(stats[0].TypeName, "App::DocumentObjectGroup");
+    EXPECT_NE(stats[0].Reason.find("Label"), std::string::npos);
+    EXPECT_GE(stats[0].Duration, 0.0);
+    EXPECT_EQ(stats[0].Result, 0);
+    EXPECT_NE(trace.str().find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST_F(DocumentTest, batchUpdateCoalescesChangeSignals)
+{
+    // Arrange
+    auto obj = doc()->addObject("App::DocumentObjectGroup");
+    auto removed = doc()->addObject("App::DocumentObjectGroup");
+    std::vector<std::string> changes;
+    auto connection = doc()->signalChangedObject.connect(
+        [&changes](const App::DocumentObject& /*obj*/, const App::Property& prop) {
+            changes.emplace_back(prop.getName());
+        });
+
+    // Act
+    {
+        App::Document::BatchUpdate batch(doc());
+        for (int i = 0; i < 100; ++i) {
+            obj->Label.setValue(std::to_string(i));
+        }
+        obj->Label2.setValue("Description");
+        removed->Label.setValue("Removed");
+        doc()->removeObject(removed->getNameInDocument());
+        EXPECT_TRUE(changes.empty());
+    }
+    connection.disconnect();
+
+    // Assert
+    EXPECT_FALSE(doc()->isBatchUpdating());
+    ASSERT_EQ(changes.size(), 2U);
+    EXPECT_EQ(changes[0], "Label");
+    EXPECT_EQ(changes[1], "Label2");
+    EXPECT_EQ(obj->Label.getStrValue(), "99");
+}
+
+TEST_F(DocumentTest, getObjectsOfTypeKeepsCreationOrder)
+{
+    // Arrange
+    auto group1 = doc()->addObject("App::DocumentObjectGroup");
+    auto varSet = doc()->addObject("App::VarSet");
+    auto group2 = doc()->addObject("App::DocumentObjectGroup");
+    auto removed = doc()->addObject("App::DocumentObjectGroup");
+    doc()->removeObject(removed->getNameInDocument());
+
+    // Act
+    auto all = doc()->getObjectsOfType(App::DocumentObject::getClassTypeId());
+    auto groups = doc()->getObjectsOfType<App::DocumentObjectGroup>();
+    auto both = doc()->getObjectsOfType(
+        {App::DocumentObjectGroup::getClassTypeId(), App::DocumentObject::getClassTypeId()});
+
+    // Assert
+    EXPECT_EQ(all, (std::vector<App::DocumentObject*> {group1, varSet, group2}));
+    ASSERT_EQ(groups.size(), 2U);
+    EXPECT_EQ(groups[0], group1);
+    EXPECT_EQ(groups[1], group2);
+    EXPECT_EQ(both, all);
+    EXPECT_EQ(doc()->countObjectsOfType<App::DocumentObjectGroup>(), 2);
+    EXPECT_EQ(doc()->findObjects(App::DocumentObject::getClassTypeId(), nullptr, nullptr), all);
+}
+
+TEST_F(DocumentTest, exportDependenciesListsOutLinks)
+{
+    // Arrange
+    auto group = static_cast<App::DocumentObjectGroup*>(
+        doc()->addObject("App::DocumentObjectGroup"));
+    auto child = doc()->addObject("App::DocumentObjectGroup");
+    group->addObject(child);
+    std::stringstream expected;
+    expected << "{\"id\":" << group->getID() << ",\"name\":\"" << group->getNameInDocument()
+             << "\",\"type\":\"App::DocumentObjectGroup\",\"out\":[" << child->getID() << "]}";
+
+    // Act
+    std::stringstream out;
+    doc()->exportDependencies(out);
+
+    // Assert
+    EXPECT_NE(out.str().find(expected.str()), std::string::npos) << out.str();
+}
+
+TEST_F(DocumentTest, exportDependenciesCollapsesGroups)
+{
+    // Arrange
+    auto part = doc()->addObject("App::Part");
+    auto child = doc()->addObject("App::DocumentObjectGroup");
+    auto link = static_cast<App::Link*>(doc()->addObject("App::Link"));
+    part->getExtensionByType<App::GroupExtension>()->addObject(child);
+    link->LinkedObject.setValue(child);
+    std::string childName = std::string("\"") + child->getNameInDocument() + "\"";
+
+    // Act
+    std::stringstream out;
+    doc()->exportDependencies(out, 0);
+
+    // Assert
+    EXPECT_EQ(out.str().find(childName), std::string::npos) << out.str();
+    std::stringstream linkNode;
+    linkNode << "\"name\":\"" << link->getNameInDocument() << "\",\"type\":\"App::Link\",\"out\":["
+             << part->getID() << "]}";
+    EXPECT_NE(out.str().find(linkNode.str()), std::string::npos) << out.str();
+}
+
 // NOLINTEND(readability-magic-numbers)
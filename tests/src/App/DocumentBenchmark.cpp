@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Benchmarks of the document operations on procedurally generated documents. They are disabled
+// by default, run them with:
+//   App_tests_run --gtest_also_run_disabled_tests --gtest_filter='DocumentBenchmark*'
+// Each model is generated with 1k, 10k and 100k objects, FC_BENCHMARK_MAX_OBJECTS lowers the
+// largest size. The timings are printed and recorded as test properties, so
+// --gtest_output=xml:<file> keeps them for comparing two builds.
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/Expression.h"
+#include "App/FeatureTest.h"
+#include "App/Link.h"
+#include "App/ObjectIdentifier.h"
+#include "App/VarSet.h"
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+/// Changes the input of a generated model, so that a part of it must be recomputed
+using ChangeFunction = std::function<void()>;
+
+/// Generates a model with about \a count objects and returns how to change it
+using GenerateFunction = std::function<ChangeFunction(App::Document*, int count)>;
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+std::vector<int> objectCounts()
+{
+    int maxCount = 100000;
+    if (const char* env = std::getenv("FC_BENCHMARK_MAX_OBJECTS")) {
+        maxCount = std::atoi(env);
+    }
+    std::vector<int> counts;
+    for (int count : {1000, 10000, 100000}) {
+        if (count <= maxCount) {
+            counts.push_back(count);
+        }
+    }
+    return counts;
+}
+
+App::FeatureTest* addFeature(App::Document* doc)
+{
+    return static_cast<App::FeatureTest*>(doc->addObject("App::FeatureTest"));
+}
+
+/// Each feature depends on the previous one
+ChangeFunction makeChain(App::Document* doc, int count)
+{
+    App::FeatureTest* first = addFeature(doc);
+    App::FeatureTest* previous = first;
+    for (int i = 1; i < count; ++i) {
+        App::FeatureTest* feature = addFeature(doc);
+        feature->Source1.setValue(previous);
+        previous = feature;
+    }
+    return [first]() { first->Integer.setValue(first->Integer.getValue() + 1); };
+}
+
+/// All features depend on one root, and one feature collects all of them
+ChangeFunction makeFanOut(App::Document* doc, int count)
+{
+    App::FeatureTest* root = addFeature(doc);
+    std::vector<App::DocumentObject*> leaves;
+    leaves.reserve(count);
+    for (int i = 2; i < count; ++i) {
+        App::FeatureTest* feature = addFeature(doc);
+        feature->Source1.setValue(root);
+        leaves.push_back(feature);
+    }
+    addFeature(doc)->SourceN.setValues(leaves);
+    return [root]() { root->Integer.setValue(root->Integer.getValue() + 1); };
+}
+
+/// VarSets of 100 variables, each variable is an expression of the previous one and the first
+/// variable of each set refers to the last one of the previous set
+ChangeFunction makeExpressions(App::Document* doc, int count)
+{
+    constexpr int variablesPerSet = 100;
+    App::PropertyFloat* input = nullptr;
+    std::string previous;
+    for (int i = 0; i < count; i += variablesPerSet) {
+        auto varSet = static_cast<App::VarSet*>(doc->addObject("App::VarSet"));
+        for (int j = 0; j < variablesPerSet; ++j) {
+            std::string name = "Var" + std::to_string(j);
+            auto prop = static_cast<App::PropertyFloat*>(
+                varSet->addDynamicProperty("App::PropertyFloat", name.c_str(), "Variables")
+            );
+            if (previous.empty()) {
+                input = prop;
+            }
+            else {
+                std::shared_ptr<App::Expression> expr(
+                    App::Expression::parse(varSet, previous + " * 1.5 + 1")
+                );
+                varSet->setExpression(App::ObjectIdentifier(*prop), expr);
+            }
+            previous = std::string(varSet->getNameInDocument()) + "." + name;
+        }
+    }
+    return [input]() { input->setValue(input->getValue() + 1.0); };
+}
+
+/// Link arrays of 10 elements to a few base features
+ChangeFunction makeLinkArrays(App::Document* doc, int count)
+{
+    constexpr int elementsPerArray = 10;
+    constexpr int numBases = 10;
+    std::vector<App::FeatureTest*> bases;
+    for (int i = 0; i < numBases; ++i) {
+        bases.push_back(addFeature(doc));
+    }
+    for (int i = 0; i < count; i += elementsPerArray + 1) {
+        auto link = static_cast<App::Link*>(doc->addObject("App::Link"));
+        link->LinkedObject.setValue(bases[(i / (elementsPerArray + 1)) % numBases]);
+        link->ElementCount.setValue(elementsPerArray);
+    }
+    App::FeatureTest* base = bases.front();
+    return [base]() { base->Integer.setValue(base->Integer.getValue() + 1); };
+}
+
+}  // namespace
+
+class DocumentBenchmark: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    /// Runs the document operations on the model made by \a generate for each object count
+    void run(const std::string& name, const GenerateFunction& generate)
+    {
+        for (int count : objectCounts()) {
+            std::string config = name + "/" + std::to_string(count);
+            std::string docName = App::GetApplication().getUniqueDocumentName("benchmark");
+            App::Document* doc = App::GetApplication().newDocument(docName.c_str(), "benchmark");
+            doc->setUndoMode(1);
+
+            std::vector<std::pair<std::string, double>> timings;
+            auto measure = [&timings](const char* operation, const std::function<void()>& func) {
+                auto start = std::chrono::steady_clock::now();
+                func();
+                timings.emplace_back(operation, elapsedMilliseconds(start));
+            };
+
+            ChangeFunction change;
+            measure("create", [&]() { change = generate(doc, count); });
+            int numObjects = doc->countObjects();
+            measure("recompute", [&]() { doc->recompute(); });
+            measure("topologicalSort", [&]() { doc->topologicalSort(); });
+            measure("change", [&]() {
+                doc->openTransaction("change");
+                change();
+                doc->commitTransaction();
+                doc->recompute();
+            });
+            measure("undo", [&]() { doc->undo(); });
+            measure("redo", [&]() { doc->redo(); });
+            std::size_t memSize = doc->getMemSize();
+
+            std::filesystem::path file = std::filesystem::temp_directory_path()
+                / (docName + ".FCStd");
+            measure("saveAs", [&]() { EXPECT_TRUE(doc->saveAs(file.string().c_str())); });
+            App::GetApplication().closeDocument(doc->getName());
+            measure("restore", [&]() {
+                doc = App::GetApplication().openDocument(file.string().c_str());
+            });
+            ASSERT_NE(doc, nullptr) << config;
+            EXPECT_EQ(doc->countObjects(), numObjects) << config;
+            App::GetApplication().closeDocument(doc->getName());
+            std::filesystem::remove(file);
+
+            std::cout << std::left << std::setw(24) << config << " objects: " << std::setw(7)
+                      << numObjects << " memory: " << std::setw(6) << (memSize >> 20) << " MB"
+                      << std::fixed << std::setprecision(2);
+            for (const auto& [operation, time] : timings) {
+                std::cout << "  " << operation << ": " << time << " ms";
+                RecordProperty(config + "/" + operation + "_ms", std::to_string(time));
+            }
+            std::cout << '\n';
+            RecordProperty(config + "/memory_bytes", std::to_string(memSize));
+        }
+    }
+};
+
+TEST_F(DocumentBenchmark, DISABLED_chain)  // NOLINT
+{
+    run("chain", makeChain);
+}
+
+TEST_F(DocumentBenchmark, DISABLED_fanOut)  // NOLINT
+{
+    run("fanOut", makeFanOut);
+}
+
+TEST_F(DocumentBenchmark, DISABLED_expressions)  // NOLINT
+{
+    run("expressions", makeExpressions);
+}
+
+TEST_F(DocumentBenchmark, DISABLED_linkArrays)  // NOLINT
+{
+    run("linkArrays", makeLinkArrays);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -8,7 +8,9 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
+#include <App/DocumentObjectGroup.h>
 #include <App/GeoFeatureGroupExtension.h>
+#include <App/Part.h>
 #include <Base/Interpreter.h>
 
 using namespace App;
@@ -155,4 +157,64 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, getSubObjectCachedFollowsPlacementChanges)
+{
+    // Arrange
+    auto outer = freecad_cast<App::Part*>(_doc->addObject("App::Part"));
+    auto inner = freecad_cast<App::Part*>(_doc->addObject("App::Part"));
+    outer->addObject(inner);
+    outer->Placement.setValue(Base::Placement(Base::Vector3d(10, 0, 0), Base::Rotation()));
+    inner->Placement.setValue(Base::Placement(Base::Vector3d(0, 5, 0), Base::Rotation()));
+    std::string subName = std::string(inner->getNameInDocument()) + ".";
+
+    // Act
+    Base::Matrix4D first;
+    auto firstObj = outer->getSubObjectCached(subName.c_str(), &first);
+    Base::Matrix4D second;
+    auto secondObj = outer->getSubObjectCached(subName.c_str(), &second);
+    inner->Placement.setValue(Base::Placement(Base::Vector3d(0, 7, 0), Base::Rotation()));
+    Base::Matrix4D changed;
+    auto changedObj = outer->getSubObjectCached(subName.c_str(), &changed);
+    Base::Matrix4D expected;
+    outer->getSubObject(subName.c_str(), nullptr, &expected);
+
+    // Assert
+    EXPECT_EQ(firstObj, inner);
+    EXPECT_EQ(secondObj, inner);
+    EXPECT_EQ(changedObj, inner);
+    EXPECT_EQ(first.getCol(3), Base::Vector3d(10, 5, 0));
+    EXPECT_EQ(second.getCol(3), Base::Vector3d(10, 5, 0));
+    EXPECT_EQ(changed.getCol(3), Base::Vector3d(10, 7, 0));
+    EXPECT_EQ(changed, expected);
+}
+
+TEST_F(DocumentObjectTest, getGroupOfObjectFollowsGroupChanges)
+{
+    // Arrange
+    auto group =
+        freecad_cast<App::DocumentObjectGroup*>(_doc->addObject("App::DocumentObjectGroup"));
+    auto part = freecad_cast<App::Part*>(_doc->addObject("App::Part"));
+    auto otherPart = freecad_cast<App::Part*>(_doc->addObject("App::Part"));
+    auto obj = _doc->addObject("App::FeatureTest");
+
+    // Act
+    group->addObject(obj);
+    part->addObject(obj);
+    auto groupAdded = App::GroupExtension::getGroupOfObject(obj);
+    auto partAdded = App::GeoFeatureGroupExtension::getGroupOfObject(obj);
+    otherPart->addObject(obj);
+    auto partMoved = App::GeoFeatureGroupExtension::getGroupOfObject(obj);
+    group->removeObject(obj);
+    auto groupRemoved = App::GroupExtension::getGroupOfObject(obj);
+    _doc->removeObject(otherPart->getNameInDocument());
+    auto partRemoved = App::GeoFeatureGroupExtension::getGroupOfObject(obj);
+
+    // Assert
+    EXPECT_EQ(groupAdded, group);
+    EXPECT_EQ(partAdded, part);
+    EXPECT_EQ(partMoved, otherPart);
+    EXPECT_EQ(groupRemoved, nullptr);
+    EXPECT_EQ(partRemoved, nullptr);
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
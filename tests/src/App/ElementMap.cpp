@@ -265,6 +265,28 @@ TEST_F(ElementMapTest, findMappedName)
     EXPECT_EQ(findResult2, element2);
 }
 
+TEST_F(ElementMapTest, findMappedNameWithDifferentPostfixSplit)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    Data::IndexedName element("Edge", 1);
+    Data::IndexedName element2("Edge", 2);
+    elementMap.setElementName(element, Data::MappedName(Data::MappedName("TEST"), ";POSTFIX"), 0);
+    elementMap.setElementName(element2, Data::MappedName("ANOTHERTEST"), 0);
+
+    // Act
+    auto findResult = elementMap.find(Data::MappedName("TEST;POSTFIX"));
+    auto findResult2 = elementMap.find(Data::MappedName(Data::MappedName("ANOTHER"), "TEST"));
+    auto all = elementMap.getAll();
+
+    // Assert
+    EXPECT_EQ(findResult, element);
+    EXPECT_EQ(findResult2, element2);
+    ASSERT_EQ(all.size(), 2);
+    EXPECT_EQ(all[0].index, element2);
+    EXPECT_EQ(all[1].index, element);
+}
+
 TEST_F(ElementMapTest, findIndexedName)
 {
     // Arrange
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <array>
+#include <chrono>
+
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -327,4 +330,34 @@ TEST_F(ExpressionParserTest, canParseProperties)
         << "PropertyQuantity on object";
 }
 
+TEST_F(ExpressionParserTest, parseManyExpressions)
+{
+    // A micro-benchmark of the parser, the elapsed time is recorded in the test report
+    static constexpr std::array texts {
+        "1 mm + 2 mm",
+        "(5mm + 1cm) / 3",
+        "Placement.Base.x * 2",
+        "pow(2, 3) + sin(30 deg)",
+        "1 m + 25 mm",
+    };
+    constexpr int repeat = 2000;
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t parsed = 0;
+    for (int i = 0; i < repeat; ++i) {
+        for (const char* text : texts) {
+            if (parse(this_obj(), text)) {
+                ++parsed;
+            }
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty(
+        "ParseMicroseconds",
+        std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count())
+    );
+    EXPECT_EQ(parsed, repeat * texts.size());
+}
+
 }  // namespace App::ExpressionParser::Test
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <src/App/InitApplication.h>
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/DocumentObject.h"
+#include "App/ExpressionParser.h"
+#include "App/ExpressionProgram.h"
+#include "App/PropertyUnits.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class ExpressionProgramTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _doc_name = App::GetApplication().getUniqueDocumentName("test");
+        _this_doc = App::GetApplication().newDocument(_doc_name.c_str(), "testUser");
+        _this_obj = _this_doc->addObject("App::VarSet");
+        _this_obj->addDynamicProperty("App::PropertyLength", "Length");
+        _this_obj->addDynamicProperty("App::PropertyFloat", "Factor");
+        _this_obj->addDynamicProperty("App::PropertyInteger", "Count");
+        _this_obj->addDynamicProperty("App::PropertyString", "Text");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_doc_name.c_str());
+    }
+
+    App::DocumentObject* this_obj()
+    {
+        return _this_obj;
+    }
+
+    /// Evaluates the expression with the compiled program and with the interpreter
+    void expectSameValue(const char* text)
+    {
+        App::ExpressionPtr expr = App::ExpressionParser::parse(this_obj(), text);
+        auto program = App::ExpressionProgram::compile(expr.get());
+        ASSERT_TRUE(program) << text;
+
+        App::any compiled;
+        ASSERT_TRUE(program->evaluate(compiled)) << text;
+        App::any interpreted = expr->getValueAsAny();
+        EXPECT_EQ(compiled.type(), interpreted.type()) << text;
+        EXPECT_TRUE(App::isAnyEqual(compiled, interpreted)) << text;
+    }
+
+private:
+    std::string _doc_name;
+    App::Document* _this_doc {};
+    App::DocumentObject* _this_obj {};
+};
+
+TEST_F(ExpressionProgramTest, evaluateGivesSameValueAsInterpreter)
+{
+    // Arrange
+    static_cast<App::PropertyLength*>(this_obj()->getPropertyByName("Length"))->setValue(12.5);
+    static_cast<App::PropertyFloat*>(this_obj()->getPropertyByName("Factor"))->setValue(0.25);
+    static_cast<App::PropertyInteger*>(this_obj()->getPropertyByName("Count"))->setValue(3);
+
+    // Act & Assert
+    expectSameValue("1 + 2");
+    expectSameValue("7 / 2");
+    expectSameValue("2 ^ 10");
+    expectSameValue("2 ^ 0.5");
+    expectSameValue("Count ^ 2");
+    expectSameValue("-Count * 2");
+    expectSameValue("Count + Factor");
+    expectSameValue("Length * Factor + 1 mm");
+    expectSameValue("Length / 2 mm");
+    expectSameValue("Length ^ 2");
+    expectSameValue("2 * pi * Length");
+}
+
+TEST_F(ExpressionProgramTest, unsupportedExpressionsAreNotCompiled)
+{
+    // Arrange
+    const char* texts[] = {"sqrt(4)", "Text + 1", "Count > 1 ? 1 : 2", "2 ^ Count"};
+
+    for (const char* text : texts) {
+        App::ExpressionPtr expr = App::ExpressionParser::parse(this_obj(), text);
+
+        // Act
+        auto program = App::ExpressionProgram::compile(expr.get());
+
+        // Assert
+        EXPECT_FALSE(program) << text;
+    }
+}
+
+TEST_F(ExpressionProgramTest, evaluateFailsOnDivisionByZero)
+{
+    // Arrange
+    App::ExpressionPtr expr = App::ExpressionParser::parse(this_obj(), "Factor / Count");
+    auto program = App::ExpressionProgram::compile(expr.get());
+    ASSERT_TRUE(program);
+    App::any value;
+
+    // Act
+    bool ok = program->evaluate(value);
+
+    // Assert
+    EXPECT_FALSE(ok);
+}
+
+TEST_F(ExpressionProgramTest, addingPropertyStartsNewEpoch)
+{
+    // Arrange
+    auto epoch = App::ExpressionProgram::currentEpoch();
+
+    // Act
+    this_obj()->addDynamicProperty("App::PropertyFloat", "Other");
+
+    // Assert
+    EXPECT_NE(App::ExpressionProgram::currentEpoch(), epoch);
+}
+
+// NOLINTEND(readability-magic-numbers)
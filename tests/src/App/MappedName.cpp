@@ -955,9 +955,14 @@ TEST(MappedName, hash)
 {
     // Arrange
     Data::MappedName mappedName(Data::MappedName("TEST"), "POSTFIXTEST");
+    Data::MappedName splitElsewhere(Data::MappedName("TESTPOST"), "FIXTEST");
+    Data::MappedName other(Data::MappedName("TEST"), "POSTFIXTEXT");
 
     // Act & Assert
-    EXPECT_EQ(mappedName.hash(), qHash(QByteArray("TEST"), qHash(QByteArray("POSTFIXTEST"))));
+    EXPECT_EQ(mappedName, splitElsewhere);
+    EXPECT_EQ(mappedName.hash(), splitElsewhere.hash());
+    EXPECT_EQ(mappedName.hash(), Data::MappedName("TESTPOSTFIXTEST").hash());
+    EXPECT_NE(mappedName.hash(), other.hash());
 }
 
 // NOLINTEND(readability-magic-numbers)
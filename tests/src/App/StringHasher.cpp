@@ -9,6 +9,10 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1590,36 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, getIDConcurrently)  // NOLINT
+{
+    // Arrange
+    const int numStrings {200};
+    const int numThreads {4};
+    std::vector<std::vector<long>> ids(numThreads, std::vector<long>(numStrings));
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int thread = 0; thread < numThreads; ++thread) {
+        threads.emplace_back([this, thread, &ids]() {
+            // Every thread adds the same strings, starting at a different position
+            for (int i = 0; i < numStrings; ++i) {
+                int index = (i + thread * numStrings / numThreads) % numStrings;
+                std::string text = "String" + std::to_string(index);
+                ids[thread][index] = Hasher()->getID(text.c_str()).value();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(static_cast<std::size_t>(numStrings), Hasher()->size());
+    std::set<long> uniqueIDs(ids[0].begin(), ids[0].end());
+    EXPECT_EQ(static_cast<std::size_t>(numStrings), uniqueIDs.size());
+    EXPECT_EQ(numStrings, *uniqueIDs.rbegin());
+    for (int thread = 1; thread < numThreads; ++thread) {
+        EXPECT_EQ(ids[0], ids[thread]);
+    }
+}
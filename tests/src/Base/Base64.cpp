@@ -26,6 +26,8 @@ the tests into individual parts.
 
 */
 
+#include <algorithm>
+
 #include "Base/Base64.h"
 
 #include <gtest/gtest.h>
@@ -91,4 +93,39 @@ TEST(Base64, oneEqualsSignPadding)
     ASSERT_EQ(rest2_decoded, rest2_original);
 }
 
+TEST(Base64, roundTripAllByteValues)
+{
+    // Every length up to a few complete groups, so that both the bulk path and the remainder
+    // handling are covered, with all byte values
+    std::string original;
+    for (int i = 0; i < 256; i++) {
+        original.push_back(static_cast<char>(i));
+    }
+    for (std::size_t len = 0; len <= original.size(); len++) {
+        std::string encoded = base64_encode(original.c_str(), len);
+        ASSERT_EQ(encoded.size(), base64_encode_size(len));
+        std::string decoded;
+        // decoding stops at the padding
+        ASSERT_EQ(base64_decode(decoded, encoded), std::min(encoded.find('='), encoded.size()));
+        ASSERT_EQ(decoded, original.substr(0, len));
+    }
+}
+
+TEST(Base64, referenceEncoding)
+{
+    EXPECT_EQ(base64_encode("Man", 3), "TWFu");
+    EXPECT_EQ(base64_encode("\xfb\xff\xbf", 3), "+/+/");
+    EXPECT_EQ(base64_encode("abcdef", 6), "YWJjZGVm");
+    EXPECT_EQ(base64_encode("abcdefg", 7), "YWJjZGVmZw==");
+}
+
+TEST(Base64, decodeStopsAtInvalidCharacter)
+{
+    std::string decoded;
+    const std::string encoded = "YWJjZGVm*WJj";
+    // the invalid character is consumed, the data before it is decoded
+    EXPECT_EQ(base64_decode(decoded, encoded), 9U);
+    EXPECT_EQ(decoded, "abcdef");
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
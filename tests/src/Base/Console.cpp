@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include "Base/Console.h"
@@ -72,6 +73,29 @@ private:
     Base::ILogger& logger;
 };
 
+class CountingBridge final: public Base::ConsoleSingleton::Bridge
+{
+public:
+    void postEvent(
+        Base::ConsoleSingleton::FreeCAD_ConsoleMsgType /*type*/,
+        Base::IntendedRecipient /*recipient*/,
+        Base::ContentType /*content*/,
+        const std::string& /*notifiername*/,
+        const std::string& /*msg*/
+    ) const override
+    {}
+
+    void refresh() const override
+    {}
+
+    void postFlush() const override
+    {
+        ++flushes;
+    }
+
+    mutable int flushes {0};
+};
+
 }  // namespace
 
 TEST(Console, DirectModeDeliversToObserver)
@@ -151,3 +175,55 @@ TEST(Console, RefreshCallsHandlerWhenEnabled)
     Base::Console().setRefreshHandler({});
     Base::Console().enableRefresh(true);
 }
+
+TEST(Console, WorkerThreadMessagesAreDeliveredWithoutBridge)
+{
+    std::mutex mutex;
+    std::vector<CapturedLog> logs;
+    CapturingLogger logger(logs, mutex);
+    ScopedObserver scoped(logger);
+
+    const auto* previous = Base::Console().getBridge();
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().setBridge(nullptr);
+
+    std::thread worker([]() { Base::Console().message("From %s", "worker"); });
+    worker.join();
+
+    Base::Console().setBridge(previous);
+
+    ASSERT_EQ(1U, logs.size());
+    EXPECT_EQ(std::string("From worker"), logs[0].msg);
+}
+
+TEST(Console, WorkerThreadMessagesAreBatchedWithBridge)
+{
+    std::mutex mutex;
+    std::vector<CapturedLog> logs;
+    CapturingLogger logger(logs, mutex);
+    ScopedObserver scoped(logger);
+    CountingBridge bridge;
+
+    const auto* previous = Base::Console().getBridge();
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().setBridge(&bridge);
+
+    std::thread worker([]() {
+        for (int i = 0; i < 3; i++) {
+            Base::Console().warning("Same\n");
+        }
+        Base::Console().warning("Other\n");
+    });
+    worker.join();
+
+    EXPECT_TRUE(logs.empty());
+    EXPECT_EQ(1, bridge.flushes);
+
+    Base::Console().flush();
+    Base::Console().setBridge(previous);
+
+    ASSERT_EQ(3U, logs.size());
+    EXPECT_EQ(std::string("Same\n"), logs[0].msg);
+    EXPECT_EQ(std::string("(last message repeated 2 times)\n"), logs[1].msg);
+    EXPECT_EQ(std::string("Other\n"), logs[2].msg);
+}
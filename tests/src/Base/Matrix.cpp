@@ -573,5 +573,29 @@ TEST(Matrix, TestToAndFromString)
 
     EXPECT_EQ(mat, inp);
 }
+
+TEST(Matrix, TestMultVecBatch)
+{
+    Base::Matrix4D mat;
+    mat.rotX(0.3);
+    mat.rotZ(1.2);
+    mat.scale(1.0, 2.0, 3.0);
+    mat.move(Base::Vector3d(1.0, -2.0, 0.5));
+
+    std::vector<Base::Vector3d> vecd;
+    std::vector<Base::Vector3f> vecf;
+    for (int i = 0; i < 37; i++) {
+        vecd.emplace_back(i, 0.5 * i, -2.0 * i);
+        vecf.emplace_back(i, 0.5F * i, -2.0F * i);
+    }
+    std::vector<Base::Vector3d> srcd = vecd;
+    std::vector<Base::Vector3f> srcf = vecf;
+    mat.multVec(vecd);
+    mat.multVec(vecf);
+    for (std::size_t i = 0; i < vecd.size(); i++) {
+        EXPECT_TRUE(vecd[i].IsEqual(mat * srcd[i], 1e-12));
+        EXPECT_TRUE(vecf[i].IsEqual(mat * srcf[i], 1e-4F));
+    }
+}
 // clang-format on
 // NOLINTEND(cppcoreguidelines-*,readability-magic-numbers)
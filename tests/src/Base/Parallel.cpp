@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <Base/Parallel.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST(Parallel, parallelForVisitsEachIndexOnce)
+{
+    // Arrange
+    std::vector<int> visits(1000, 0);
+
+    // Act
+    Base::parallelFor(visits.size(), [&visits](std::size_t i) { ++visits[i]; }, 4);
+
+    // Assert
+    EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 1000);
+    EXPECT_EQ(*std::min_element(visits.begin(), visits.end()), 1);
+}
+
+TEST(Parallel, parallelForWithoutItems)
+{
+    // Arrange
+    std::atomic<int> calls {0};
+
+    // Act
+    Base::parallelFor(0, [&calls](std::size_t) { ++calls; });
+
+    // Assert
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(Parallel, parallelForRethrowsException)
+{
+    // Act / Assert
+    EXPECT_THROW(Base::parallelFor(
+                     100,
+                     [](std::size_t i) {
+                         if (i == 50) {
+                             throw std::runtime_error("failed");
+                         }
+                     },
+                     4),
+                 std::runtime_error);
+}
+
+TEST(Parallel, nestedParallelForCompletes)
+{
+    // Arrange
+    std::atomic<int> calls {0};
+
+    // Act
+    Base::parallelFor(
+        8,
+        [&calls](std::size_t) {
+            Base::parallelFor(100, [&calls](std::size_t) { ++calls; }, 4);
+        },
+        4
+    );
+
+    // Assert
+    EXPECT_EQ(calls, 800);
+}
+
+TEST(Parallel, setMaxThreads)
+{
+    // Arrange
+    std::thread::id caller = std::this_thread::get_id();
+    std::atomic<int> otherThreads {0};
+
+    // Act
+    Base::setMaxThreads(1);
+    Base::parallelFor(100, [&](std::size_t) {
+        if (std::this_thread::get_id() != caller) {
+            ++otherThreads;
+        }
+    });
+    unsigned single = Base::getMaxThreads();
+    Base::setMaxThreads(0);
+
+    // Assert
+    EXPECT_EQ(single, 1U);
+    EXPECT_EQ(otherThreads, 0);
+    EXPECT_GE(Base::getMaxThreads(), 1U);
+}
+
+TEST(Parallel, parallelForWithSequencer)
+{
+    // Arrange
+    std::vector<int> visits(100, 0);
+    Base::SequencerLauncher seq("Test", visits.size());
+
+    // Act
+    Base::parallelFor(visits.size(), [&visits](std::size_t i) { ++visits[i]; }, seq, 4);
+
+    // Assert
+    EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 100);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -257,6 +257,44 @@ TEST_F(ParameterTest, TestString)
     EXPECT_EQ(grp->GetASCIIs().size(), 1);
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+
+    // a missing parameter is looked up before and after it's set
+    EXPECT_EQ(grp->GetInt("Parameter", 1), 1);
+    grp->SetInt("Parameter", 2);
+    EXPECT_EQ(grp->GetInt("Parameter", 1), 2);
+    grp->SetInt("Parameter", 3);
+    EXPECT_EQ(grp->GetInt("Parameter", 1), 3);
+
+    // parameters of different types don't share their values
+    EXPECT_EQ(grp->GetUnsigned("Parameter", 4), 4);
+    EXPECT_EQ(grp->GetASCII("Parameter", "Value1"), "Value1");
+    grp->SetASCII("Parameter", "Value2");
+    EXPECT_EQ(grp->GetASCII("Parameter"), "Value2");
+
+    grp->RemoveInt("Parameter");
+    EXPECT_EQ(grp->GetInt("Parameter", 1), 1);
+
+    std::string fn = getFileName();
+    cfg->exportTo(fn.c_str());
+
+    grp->SetASCII("Parameter", "Value3");
+    grp->SetBool("Parameter", true);
+    EXPECT_EQ(grp->GetASCII("Parameter"), "Value3");
+    EXPECT_EQ(grp->GetBool("Parameter", false), true);
+
+    // importing clears the groups before the values are restored
+    cfg->importFrom(fn.c_str());
+    EXPECT_EQ(grp->GetASCII("Parameter"), "Value2");
+    EXPECT_EQ(grp->GetBool("Parameter", false), false);
+
+    grp->Clear();
+    EXPECT_EQ(grp->GetASCII("Parameter", "Value1"), "Value1");
+}
+
 TEST_F(ParameterTest, TestCopy)
 {
     auto cfg = getCreateConfig();
@@ -32,3 +32,24 @@ TEST(Persistence, ValidateXmlStringReplacesDiscouraged)
     const std::string out = Base::Persistence::validateXMLString(s);
     EXPECT_EQ(out, "x_y");
 }
+
+TEST(Persistence, ValidateXmlStringPreservesPlainAscii)
+{
+    const std::string s = "Body001\tPad <1>\r\n";
+    EXPECT_EQ(Base::Persistence::validateXMLString(s), s);
+}
+
+TEST(Persistence, EncodeAttributeWithoutSpecialCharacters)
+{
+    const std::string s = "Sketch001";
+    EXPECT_EQ(Base::Persistence::encodeAttribute(s), s);
+}
+
+TEST(Persistence, EncodeAttributeEscapesSpecialCharacters)
+{
+    const std::string s = "a<b>&\"c'\r\n\td";
+    EXPECT_EQ(
+        Base::Persistence::encodeAttribute(s),
+        "a&lt;b&gt;&amp;&quot;c&apos;&#13;&#10;&#9;d"
+    );
+}
@@ -213,3 +213,27 @@ TEST(Placement, TestSclerp)
     EXPECT_EQ(plm6.getRotation().isSame(Base::Rotation(1, 1, 0, 0), epsilon), true);
     EXPECT_EQ(plm6.getPosition().IsEqual(pos, epsilon), true);
 }
+
+TEST(Placement, TestMultVecBatch)
+{
+    Base::Placement plm(Base::Vector3d(1, 4, 6), Base::Rotation(Base::Vector3d(1, 2, 3), 0.7));
+
+    std::vector<Base::Vector3d> vecd;
+    std::vector<Base::Vector3f> vecf;
+    for (int i = 0; i < 37; i++) {
+        vecd.emplace_back(i, 0.5 * i, -2.0 * i);
+        vecf.emplace_back(i, 0.5F * i, -2.0F * i);
+    }
+    std::vector<Base::Vector3d> srcd = vecd;
+    std::vector<Base::Vector3f> srcf = vecf;
+    plm.multVec(vecd);
+    plm.multVec(vecf);
+    for (std::size_t i = 0; i < vecd.size(); i++) {
+        Base::Vector3d dstd;
+        Base::Vector3f dstf;
+        plm.multVec(srcd[i], dstd);
+        plm.multVec(srcf[i], dstf);
+        EXPECT_TRUE(vecd[i].IsEqual(dstd, 1e-12));
+        EXPECT_TRUE(vecf[i].IsEqual(dstf, 1e-4F));
+    }
+}
@@ -293,6 +293,24 @@ TEST_F(ReaderTest, readNextStartElement)
     EXPECT_TRUE(xml.Reader()->isEndOfDocument());
 }
 
+TEST_F(ReaderTest, attributesOfPreviousElementNotKept)
+{
+    auto xmlBody = "<node1 a='1' b='2' c='3'/><node2 b='\xc3\xa4'/>";
+
+    ReaderXML xml;
+    xml.givenDataAsXMLStream(xmlBody);
+
+    xml.Reader()->readElement("node1");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 3U);
+    EXPECT_STREQ(xml.Reader()->getAttribute<const char*>("c"), "3");
+
+    xml.Reader()->readElement("node2");
+    EXPECT_EQ(xml.Reader()->getAttributeCount(), 1U);
+    EXPECT_FALSE(xml.Reader()->hasAttribute("a"));
+    EXPECT_FALSE(xml.Reader()->hasAttribute("c"));
+    EXPECT_STREQ(xml.Reader()->getAttribute<const char*>("b"), "\xc3\xa4");
+}
+
 TEST_F(ReaderTest, readNextStartEndElement)
 {
     // Arrange
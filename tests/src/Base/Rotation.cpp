@@ -77,4 +77,24 @@ TEST(Rotation, TestRotationDecompose)
     // decompose rotation part
     EXPECT_TRUE(Base::Rotation {mat}.isIdentity());
 }
+
+TEST(Rotation, TestMultVecBatch)
+{
+    Base::Rotation rot(Base::Vector3d(1.0, 2.0, 3.0), 0.7);
+
+    std::vector<Base::Vector3d> vecd;
+    std::vector<Base::Vector3f> vecf;
+    for (int i = 0; i < 37; i++) {
+        vecd.emplace_back(i, 0.5 * i, -2.0 * i);
+        vecf.emplace_back(i, 0.5F * i, -2.0F * i);
+    }
+    std::vector<Base::Vector3d> srcd = vecd;
+    std::vector<Base::Vector3f> srcf = vecf;
+    rot.multVec(vecd);
+    rot.multVec(vecf);
+    for (std::size_t i = 0; i < vecd.size(); i++) {
+        EXPECT_TRUE(vecd[i].IsEqual(rot.multVec(srcd[i]), 1e-12));
+        EXPECT_TRUE(vecf[i].IsEqual(rot.multVec(srcf[i]), 1e-4F));
+    }
+}
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
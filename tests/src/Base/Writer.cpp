@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <sstream>
+#include <vector>
+
 #include "Base/Exception.h"
 #include "Base/Writer.h"
 
@@ -129,3 +133,24 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+TEST_F(WriterTest, fastDoubleSameAsStream)
+{
+    // Arrange
+    const std::vector<double> values {
+        0.0, -0.0, 1.0, -2.5, 0.1, 1.0 / 3.0, 1e-5, 123456789012345678.0, 1e300, -4.9e-324
+    };
+    std::ostringstream expected;
+    std::ostringstream actual;
+    expected.precision(std::numeric_limits<double>::digits10 + 1);
+    actual.precision(std::numeric_limits<double>::digits10 + 1);
+
+    // Act
+    for (double value : values) {
+        expected << value << " ";
+        actual << Base::FastDouble {value} << " ";
+    }
+
+    // Assert
+    EXPECT_EQ(expected.str(), actual.str());
+}
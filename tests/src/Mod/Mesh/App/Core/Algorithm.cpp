@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Base/Tools2D.h>
+#include <Base/ViewProj.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshAlgorithmTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a regular grid of 20 x 20 squares in the xy plane, each split into two triangles
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                Base::Vector3f p1(float(i), float(j), 0.F);
+                Base::Vector3f p2(float(i + 1), float(j), 0.F);
+                Base::Vector3f p3(float(i + 1), float(j + 1), 0.F);
+                Base::Vector3f p4(float(i), float(j + 1), 0.F);
+                kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+                kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p3, p4));
+            }
+        }
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+    // the facets with at least one projected corner inside of the polygon, or outside of it
+    std::vector<MeshCore::FacetIndex> NaiveCheckFacets(
+        const Base::ViewProjMethod& proj,
+        const Base::Polygon2d& poly,
+        bool inner
+    ) const
+    {
+        std::vector<MeshCore::FacetIndex> facets;
+        for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+            MeshCore::MeshGeomFacet facet = kernel.GetFacet(i);
+            for (const auto& pnt : facet._aclPoints) {
+                Base::Vector3f pt2d = proj(pnt);
+                if (poly.Contains(Base::Vector2d(pt2d.x, pt2d.y)) == inner) {
+                    facets.push_back(i);
+                    break;
+                }
+            }
+        }
+        return facets;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshAlgorithmTest, TestCheckFacetsWithPolygon)
+{
+    // the identity is an orthographic projection, it maps the grid to [0.5, 10.5]
+    Base::ViewProjMatrix proj {Base::Matrix4D()};
+
+    // a triangle covering a part of the projected grid
+    Base::Polygon2d poly;
+    poly.Add(Base::Vector2d(2.3, 2.2));
+    poly.Add(Base::Vector2d(9.7, 3.1));
+    poly.Add(Base::Vector2d(4.4, 9.6));
+
+    MeshCore::MeshAlgorithm alg(GetKernel());
+
+    std::vector<MeshCore::FacetIndex> inner;
+    alg.CheckFacets(&proj, poly, true, inner);
+    EXPECT_FALSE(inner.empty());
+    EXPECT_EQ(inner, NaiveCheckFacets(proj, poly, true));
+
+    std::vector<MeshCore::FacetIndex> outer;
+    alg.CheckFacets(&proj, poly, false, outer);
+    EXPECT_FALSE(outer.empty());
+    EXPECT_EQ(outer, NaiveCheckFacets(proj, poly, false));
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Approximation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+TEST(MeshApproximationTest, PlaneFitIncremental)
+{
+    // Arrange
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            points.emplace_back(float(i), float(j), 0.1F * float((i * 7 + j * 3) % 5));
+        }
+    }
+
+    MeshCore::PlaneFit incremental;
+    MeshCore::PlaneFit full;
+    full.AddPoints(points);
+
+    // Act
+    for (std::size_t i = 0; i < points.size(); i++) {
+        incremental.AddPoint(points[i]);
+        if (i >= 2) {
+            incremental.Fit();
+        }
+    }
+    float incrementalDev = incremental.Fit();
+    float fullDev = full.Fit();
+
+    // Assert
+    EXPECT_FLOAT_EQ(incrementalDev, fullDev);
+    EXPECT_EQ(incremental.GetBase(), full.GetBase());
+    EXPECT_EQ(incremental.GetNormal(), full.GetNormal());
+}
+
+TEST(MeshApproximationTest, PlaneFitAfterClear)
+{
+    // Arrange
+    MeshCore::PlaneFit fit;
+    fit.AddPoints(std::vector<Base::Vector3f> {{5, 5, 5}, {6, 5, 9}, {5, 7, 1}});
+    fit.Fit();
+
+    // Act
+    fit.Clear();
+    fit.AddPoints(std::vector<Base::Vector3f> {{0, 0, 1}, {1, 0, 1}, {0, 1, 1}, {1, 1, 1}});
+    fit.Fit();
+
+    // Assert
+    EXPECT_FLOAT_EQ(fit.GetBase().z, 1.0F);
+    EXPECT_FLOAT_EQ(std::fabs(fit.GetNormal().z), 1.0F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
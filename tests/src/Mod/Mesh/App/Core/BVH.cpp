@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshFacetBVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a dense patch next to a few large facets
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                Base::Vector3f p1(0.1F * float(i), 0.1F * float(j), 0.01F * float(i % 2));
+                Base::Vector3f p2(0.1F * float(i + 1), 0.1F * float(j), 0.0F);
+                Base::Vector3f p3(0.1F * float(i), 0.1F * float(j + 1), 0.0F);
+                kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+            }
+        }
+        kernel.AddFacet(MeshCore::MeshGeomFacet(
+            Base::Vector3f(5.0F, 0.0F, 1.0F),
+            Base::Vector3f(50.0F, 0.0F, 1.0F),
+            Base::Vector3f(5.0F, 50.0F, 1.0F)
+        ));
+        kernel.AddFacet(MeshCore::MeshGeomFacet(
+            Base::Vector3f(50.0F, 0.0F, 1.0F),
+            Base::Vector3f(50.0F, 50.0F, 3.0F),
+            Base::Vector3f(5.0F, 50.0F, 1.0F)
+        ));
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+    std::vector<Base::Vector3f> GetRayPoints() const
+    {
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 30; i++) {
+            points.emplace_back(0.07F * float(i), 0.05F * float(i), -1.0F);
+            points.emplace_back(1.7F * float(i), 1.3F * float(i), -1.0F);
+        }
+        return points;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshFacetBVHTest, TestEmpty)
+{
+    MeshCore::MeshFacetBVH bvh;
+    EXPECT_TRUE(bvh.IsEmpty());
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    EXPECT_FALSE(bvh.NearestFacetOnRay(Base::Vector3f(), Base::Vector3f(0, 0, 1), res, index));
+    EXPECT_EQ(bvh.NearestFacetToPoint(Base::Vector3f(), res), MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(MeshFacetBVHTest, TestNearestFacetOnRay)
+{
+    MeshCore::MeshFacetBVH bvh(GetKernel());
+    EXPECT_EQ(bvh.CountFacets(), GetKernel().CountFacets());
+
+    Base::Vector3f dir(0.01F, 0.02F, 1.0F);
+    for (const auto& pnt : GetRayPoints()) {
+        // compare with testing all facets
+        bool expected = false;
+        float fMinDist = std::numeric_limits<float>::max();
+        MeshCore::FacetIndex expectedIndex = MeshCore::FACET_INDEX_MAX;
+        MeshCore::MeshFacetIterator it(GetKernel());
+        for (it.Init(); it.More(); it.Next()) {
+            Base::Vector3f res;
+            if (it->Foraminate(pnt, dir, res) && (res - pnt) * dir >= 0.0F
+                && (res - pnt).Length() < fMinDist) {
+                expected = true;
+                fMinDist = (res - pnt).Length();
+                expectedIndex = it.Position();
+            }
+        }
+
+        Base::Vector3f res;
+        MeshCore::FacetIndex index = MeshCore::FACET_INDEX_MAX;
+        EXPECT_EQ(bvh.NearestFacetOnRay(pnt, dir, res, index), expected);
+        if (expected) {
+            EXPECT_EQ(index, expectedIndex);
+            EXPECT_NEAR((res - pnt).Length(), fMinDist, 1e-4F);
+        }
+    }
+}
+
+TEST_F(MeshFacetBVHTest, TestRayPacketsMatchSingleRays)
+{
+    MeshCore::MeshFacetBVH bvh(GetKernel());
+    std::vector<Base::Vector3f> points = GetRayPoints();
+
+    std::vector<Base::Vector3f> results;
+    std::vector<MeshCore::FacetIndex> indices;
+    bvh.NearestFacetsOnRays(points, Base::Vector3f(0, 0, 1), results, indices);
+    ASSERT_EQ(indices.size(), points.size());
+
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex index = MeshCore::FACET_INDEX_MAX;
+        bvh.NearestFacetOnRay(points[i], Base::Vector3f(0, 0, 1), res, index);
+        EXPECT_EQ(indices[i], index);
+        if (index != MeshCore::FACET_INDEX_MAX) {
+            EXPECT_EQ(results[i], res);
+        }
+    }
+}
+
+TEST_F(MeshFacetBVHTest, TestNearestFacetToPoint)
+{
+    MeshCore::MeshFacetBVH bvh(GetKernel());
+    MeshCore::MeshAlgorithm alg(GetKernel());
+
+    for (const auto& pnt : GetRayPoints()) {
+        MeshCore::FacetIndex expectedIndex {};
+        Base::Vector3f expected;
+        ASSERT_TRUE(alg.NearestPointFromPoint(pnt, expectedIndex, expected));
+
+        MeshCore::FacetIndex index {};
+        Base::Vector3f res;
+        ASSERT_TRUE(alg.NearestPointFromPoint(pnt, bvh, index, res));
+        EXPECT_NEAR(Base::Distance(res, pnt), Base::Distance(expected, pnt), 1e-5F);
+    }
+
+    // nothing within the search distance
+    Base::Vector3f res;
+    EXPECT_EQ(bvh.NearestFacetToPoint(Base::Vector3f(0, 0, -1), res, 0.5F), MeshCore::FACET_INDEX_MAX);
+}
+
+TEST_F(MeshFacetBVHTest, TestSearchFacets)
+{
+    MeshCore::MeshFacetBVH bvh(GetKernel());
+    Base::BoundBox3f box(0.45F, 0.45F, -1.0F, 0.75F, 0.65F, 1.0F);
+
+    std::vector<MeshCore::FacetIndex> expected;
+    MeshCore::MeshFacetIterator it(GetKernel());
+    for (it.Init(); it.More(); it.Next()) {
+        if (it->GetBoundBox().Intersect(box)) {
+            expected.push_back(it.Position());
+        }
+    }
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.SearchFacets(box, facets);
+    std::sort(facets.begin(), facets.end());
+    EXPECT_FALSE(facets.empty());
+    EXPECT_EQ(facets, expected);
+}
+
+TEST_F(MeshFacetBVHTest, TestSearchFacetsByPredicate)
+{
+    MeshCore::MeshFacetBVH bvh(GetKernel());
+    Base::BoundBox3f box(0.45F, 0.45F, -1.0F, 0.75F, 0.65F, 1.0F);
+
+    std::vector<MeshCore::FacetIndex> expected;
+    bvh.SearchFacets(box, expected);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<MeshCore::FacetIndex> facets;
+    bvh.SearchFacets(
+        [&box](const Base::BoundBox3f& bound) {
+            return bound.Intersect(box);
+        },
+        facets
+    );
+    std::sort(facets.begin(), facets.end());
+    EXPECT_EQ(facets, expected);
+}
+
+TEST_F(MeshFacetBVHTest, TestTransformation)
+{
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3f(0.0F, 0.0F, 10.0F));
+    MeshCore::MeshFacetBVH bvh(GetKernel(), mat);
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    ASSERT_TRUE(bvh.NearestFacetOnRay(Base::Vector3f(20, 20, 0), Base::Vector3f(0, 0, 1), res, index));
+    EXPECT_FLOAT_EQ(res.z, 11.0F);
+    EXPECT_EQ(bvh.GetBoundBox().MinZ, 10.0F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Boolean.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshBooleanTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cube1 = MakeCube(Base::Vector3f(0.0F, 0.0F, 0.0F));
+        cube2 = MakeCube(Base::Vector3f(0.3F, 0.2F, 0.1F));
+    }
+
+    static MeshCore::MeshKernel MakeCube(const Base::Vector3f& origin)
+    {
+        MeshCore::MeshPointArray points;
+        for (int i = 0; i < 8; i++) {
+            Base::Vector3f corner(float(i & 1), float((i >> 1) & 1), float(i >> 2));
+            points.push_back(origin + corner);
+        }
+
+        MeshCore::MeshFacetArray facets;
+        const int quads[6][4] = {
+            {0, 2, 3, 1},
+            {4, 5, 7, 6},
+            {0, 1, 5, 4},
+            {2, 6, 7, 3},
+            {0, 4, 6, 2},
+            {1, 3, 7, 5}
+        };
+        for (const auto& quad : quads) {
+            facets.emplace_back(quad[0], quad[1], quad[2]);
+            facets.emplace_back(quad[0], quad[2], quad[3]);
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel.Adopt(points, facets, true);
+        return kernel;
+    }
+
+    MeshCore::MeshKernel Compute(MeshCore::SetOperations::OperationType type) const
+    {
+        MeshCore::MeshKernel result;
+        MeshCore::MeshBoolean boolOp(cube1, cube2, result, type);
+        boolOp.Do();
+        return result;
+    }
+
+    static bool IsSolid(const MeshCore::MeshKernel& kernel)
+    {
+        MeshCore::MeshEvalSolid eval(kernel);
+        return eval.Evaluate();
+    }
+
+private:
+    MeshCore::MeshKernel cube1;
+    MeshCore::MeshKernel cube2;
+};
+
+TEST_F(MeshBooleanTest, TestUnion)
+{
+    MeshCore::MeshKernel result = Compute(MeshCore::SetOperations::Union);
+    EXPECT_TRUE(IsSolid(result));
+    EXPECT_NEAR(result.GetVolume(), 1.496F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, TestIntersection)
+{
+    MeshCore::MeshKernel result = Compute(MeshCore::SetOperations::Intersect);
+    EXPECT_TRUE(IsSolid(result));
+    EXPECT_NEAR(result.GetVolume(), 0.504F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, TestDifference)
+{
+    MeshCore::MeshKernel result = Compute(MeshCore::SetOperations::Difference);
+    EXPECT_TRUE(IsSolid(result));
+    EXPECT_NEAR(result.GetVolume(), 0.496F, 1e-4F);
+}
+
+TEST_F(MeshBooleanTest, TestDisjoint)
+{
+    MeshCore::MeshKernel first = MakeCube(Base::Vector3f(0.0F, 0.0F, 0.0F));
+    MeshCore::MeshKernel second = MakeCube(Base::Vector3f(2.0F, 0.0F, 0.0F));
+
+    MeshCore::MeshKernel result;
+    MeshCore::MeshBoolean unionOp(first, second, result, MeshCore::SetOperations::Union);
+    unionOp.Do();
+    EXPECT_EQ(result.CountFacets(), 24UL);
+    EXPECT_NEAR(result.GetVolume(), 2.0F, 1e-5F);
+
+    MeshCore::MeshBoolean intersectOp(first, second, result, MeshCore::SetOperations::Intersect);
+    intersectOp.Do();
+    EXPECT_EQ(result.CountFacets(), 0UL);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshCurvatureTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a sphere with 20 rings of 40 points
+        const int rings = 20;
+        const int segments = 40;
+        MeshCore::MeshPointArray points;
+        points.push_back(Base::Vector3f(0.0F, 0.0F, -radius));
+        for (int i = 1; i < rings; i++) {
+            for (int j = 0; j < segments; j++) {
+                double theta = M_PI * i / rings;
+                double phi = 2.0 * M_PI * j / segments;
+                points.push_back(Base::Vector3f(
+                    float(radius * std::sin(theta) * std::cos(phi)),
+                    float(radius * std::sin(theta) * std::sin(phi)),
+                    float(-radius * std::cos(theta))
+                ));
+            }
+        }
+        points.push_back(Base::Vector3f(0.0F, 0.0F, radius));
+
+        auto index = [segments](int i, int j) {
+            return MeshCore::PointIndex(1 + (i - 1) * segments + j % segments);
+        };
+        auto top = MeshCore::PointIndex(points.size() - 1);
+        MeshCore::MeshFacetArray facets;
+        for (int j = 0; j < segments; j++) {
+            facets.emplace_back(0, index(1, j + 1), index(1, j));
+            facets.emplace_back(index(rings - 1, j), index(rings - 1, j + 1), top);
+        }
+        for (int i = 1; i < rings - 1; i++) {
+            for (int j = 0; j < segments; j++) {
+                facets.emplace_back(index(i, j), index(i, j + 1), index(i + 1, j + 1));
+                facets.emplace_back(index(i, j), index(i + 1, j + 1), index(i + 1, j));
+            }
+        }
+
+        kernel.Adopt(points, facets, true);
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+    const float radius = 2.0F;
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshCurvatureTest, TestPerVertex)
+{
+    MeshCore::MeshCurvature meshCurv(GetKernel());
+    meshCurv.ComputePerVertex();
+    const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
+    ASSERT_EQ(curv.size(), GetKernel().CountPoints());
+
+    // the fans at the poles are too coarse
+    const MeshCore::MeshPointArray& points = GetKernel().GetPoints();
+    for (std::size_t i = 0; i < curv.size(); i++) {
+        if (std::fabs(points[i].z) < 0.8F * radius) {
+            EXPECT_NEAR(curv[i].fMinCurvature, 1.0F / radius, 0.02F);
+            EXPECT_NEAR(curv[i].fMaxCurvature, 1.0F / radius, 0.02F);
+        }
+    }
+}
+
+TEST_F(MeshCurvatureTest, TestPerFaceParallel)
+{
+    MeshCore::MeshCurvature serial(GetKernel());
+    serial.ComputePerFace(false);
+    MeshCore::MeshCurvature parallel(GetKernel());
+    parallel.ComputePerFace(true);
+
+    const std::vector<MeshCore::CurvatureInfo>& curv1 = serial.GetCurvature();
+    const std::vector<MeshCore::CurvatureInfo>& curv2 = parallel.GetCurvature();
+    ASSERT_EQ(curv1.size(), GetKernel().CountFacets());
+    ASSERT_EQ(curv1.size(), curv2.size());
+    for (std::size_t i = 0; i < curv1.size(); i++) {
+        EXPECT_EQ(curv1[i].fMinCurvature, curv2[i].fMinCurvature);
+        EXPECT_EQ(curv1[i].fMaxCurvature, curv2[i].fMaxCurvature);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
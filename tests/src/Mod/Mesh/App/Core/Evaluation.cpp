@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshEvalSelfIntersectionTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a strip of separate facets each crossed by a vertical facet, plus a facet far away
+        for (int i = 0; i < 20; i++) {
+            float x = 3.F * float(i);
+            kernel.AddFacet(MeshCore::MeshGeomFacet(
+                Base::Vector3f(x, 0.F, 0.F),
+                Base::Vector3f(x + 2.F, 0.F, 0.F),
+                Base::Vector3f(x, 2.F, 0.F)
+            ));
+            kernel.AddFacet(MeshCore::MeshGeomFacet(
+                Base::Vector3f(x + 0.5F, 0.5F, -1.F),
+                Base::Vector3f(x + 0.5F, 0.5F, 1.F),
+                Base::Vector3f(x + 0.6F, 1.0F, 1.F)
+            ));
+        }
+        kernel.AddFacet(MeshCore::MeshGeomFacet(
+            Base::Vector3f(100.F, 100.F, 100.F),
+            Base::Vector3f(101.F, 100.F, 100.F),
+            Base::Vector3f(100.F, 101.F, 100.F)
+        ));
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshEvalSelfIntersectionTest, TestGetIntersections)
+{
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    eval.GetIntersections(intersection);
+
+    // each pair is reported once with the lower index first
+    ASSERT_EQ(intersection.size(), 20);
+    for (std::size_t i = 0; i < intersection.size(); i++) {
+        EXPECT_EQ(intersection[i].first, 2 * i);
+        EXPECT_EQ(intersection[i].second, 2 * i + 1);
+    }
+}
+
+TEST_F(MeshEvalSelfIntersectionTest, TestNoIntersection)
+{
+    MeshCore::MeshKernel mesh;
+    mesh.AddFacet(kernel.GetFacet(0));
+    mesh.AddFacet(kernel.GetFacet(kernel.CountFacets() - 1));
+
+    MeshCore::MeshEvalSelfIntersection eval(mesh);
+    EXPECT_TRUE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    eval.GetIntersections(intersection);
+    EXPECT_TRUE(intersection.empty());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
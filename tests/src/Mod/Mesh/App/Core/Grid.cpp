@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/Iterator.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshGridTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a folded strip of triangles, so that the facets span over several grids
+        for (int i = 0; i < 50; i++) {
+            Base::Vector3f p1(float(i), 0.F, 0.F);
+            Base::Vector3f p2(float(i + 1), 0.F, float(i % 3));
+            Base::Vector3f p3(float(i), 1.F, float(i % 5));
+            Base::Vector3f p4(float(i + 1), 1.F, 0.F);
+            kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+            kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+        }
+    }
+
+    const MeshCore::MeshKernel& GetKernel() const
+    {
+        return kernel;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshGridTest, TestFacetGridStoresIntersectingFacets)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel(), 10, 4, 4);
+    EXPECT_TRUE(grid.Verify());
+
+    // the facets of each grid are sorted in ascending order without duplicates
+    for (unsigned long ulX = 0; ulX < 10; ulX++) {
+        for (unsigned long ulY = 0; ulY < 4; ulY++) {
+            for (unsigned long ulZ = 0; ulZ < 4; ulZ++) {
+                std::span<const MeshCore::ElementIndex> elements = grid.GetElementSpan(ulX, ulY, ulZ);
+                EXPECT_EQ(grid.GetCtElements(ulX, ulY, ulZ), elements.size());
+                auto unsorted = std::adjacent_find(elements.begin(), elements.end(), std::greater_equal<>());
+                EXPECT_TRUE(unsorted == elements.end());
+            }
+        }
+    }
+
+    // each facet can be found in the grid of its center
+    MeshCore::MeshFacetIterator it(GetKernel());
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<MeshCore::ElementIndex> elements;
+        grid.GetElements(it->GetGravityPoint(), elements);
+        EXPECT_TRUE(std::ranges::find(elements, it.Position()) != elements.end());
+    }
+}
+
+TEST_F(MeshGridTest, TestPointGridStoresEachPointOnce)
+{
+    MeshCore::MeshPointGrid grid(GetKernel(), 5);
+
+    std::vector<MeshCore::ElementIndex> points;
+    MeshCore::MeshGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        it.GetElements(points);
+    }
+
+    std::sort(points.begin(), points.end());
+    ASSERT_EQ(points.size(), GetKernel().CountPoints());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i], i);
+    }
+}
+
+TEST_F(MeshGridTest, TestInsideBoundingBox)
+{
+    MeshCore::MeshFacetGrid grid(GetKernel(), 10, 4, 4);
+
+    Base::BoundBox3f box(10.F, 0.F, 0.F, 12.F, 1.F, 1.F);
+    std::vector<MeshCore::ElementIndex> elements;
+    grid.Inside(box, elements);
+
+    std::set<MeshCore::ElementIndex> unique;
+    grid.Inside(box, unique);
+    EXPECT_EQ(std::vector<MeshCore::ElementIndex>(unique.begin(), unique.end()), elements);
+
+    // all facets in the box must have been found
+    MeshCore::MeshFacetIterator it(GetKernel());
+    for (it.Init(); it.More(); it.Next()) {
+        if (it->IntersectBoundingBox(box)) {
+            EXPECT_TRUE(unique.count(it.Position()) > 0);
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
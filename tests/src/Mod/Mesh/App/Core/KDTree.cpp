@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include <Mod/Mesh/App/Core/KDTree.h>
 
@@ -92,4 +94,71 @@ TEST_F(KDTreeTest, TestKDTreeFindRange)
     tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
     EXPECT_EQ(index, result);
 }
+
+TEST_F(KDTreeTest, TestKDTreeBuild)
+{
+    MeshCore::MeshKDTree tree;
+    tree.AddPoint(Base::Vector3f(5, 5, 5));
+    tree.Build(GetPoints());
+
+    EXPECT_EQ(tree.FindExact(Base::Vector3f(5, 5, 5)), MeshCore::POINT_INDEX_MAX);
+    for (std::size_t i = 0; i < GetPoints().size(); i++) {
+        EXPECT_EQ(tree.FindExact(GetPoints()[i]), i);
+    }
+}
+
+TEST_F(KDTreeTest, TestKDTreeBuildMatchesInsertion)
+{
+    std::vector<Base::Vector3f> points;
+    for (int i = 0; i < 1000; i++) {
+        points.emplace_back(float(i % 10), float((i / 10) % 10), float(i / 100) + 0.01F * float(i));
+    }
+    MeshCore::MeshKDTree built(points);
+    MeshCore::MeshKDTree inserted;
+    for (const auto& it : points) {
+        inserted.AddPoint(it);
+    }
+
+    Base::Vector3f nor;
+    float dist;
+    for (int i = 0; i < 100; i++) {
+        Base::Vector3f pnt(0.37F * float(i % 23), 0.41F * float(i % 19), 0.13F * float(i));
+        EXPECT_EQ(built.FindNearest(pnt, nor, dist), inserted.FindNearest(pnt, nor, dist));
+    }
+}
+
+TEST_F(KDTreeTest, TestKDTreeBatchedNearest)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+    std::vector<Base::Vector3f> queries = {
+        Base::Vector3f(0.9F, 0.1F, 0.1F),
+        Base::Vector3f(0.1F, 0.9F, 0.9F),
+        Base::Vector3f(5.0F, 5.0F, 5.0F)
+    };
+
+    std::vector<MeshCore::PointIndex> index;
+    std::vector<MeshCore::PointIndex> result = {4, 3, MeshCore::POINT_INDEX_MAX};
+    tree.FindNearest(queries, 0.5F, index);
+    EXPECT_EQ(index, result);
+}
+
+TEST_F(KDTreeTest, TestKDTreeBatchedRange)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+    std::vector<Base::Vector3f> queries = {
+        Base::Vector3f(0.5F, 0, 0),
+        Base::Vector3f(0, 0, 0.5F),
+        Base::Vector3f(5.0F, 5.0F, 5.0F)
+    };
+
+    std::vector<std::vector<MeshCore::PointIndex>> index;
+    tree.FindInRange(queries, 0.6F, index);
+    ASSERT_EQ(index.size(), 3);
+    for (auto& it : index) {
+        std::sort(it.begin(), it.end());
+    }
+    EXPECT_EQ(index[0], std::vector<MeshCore::PointIndex>({0, 4}));
+    EXPECT_EQ(index[1], std::vector<MeshCore::PointIndex>({0, 1}));
+    EXPECT_TRUE(index[2].empty());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
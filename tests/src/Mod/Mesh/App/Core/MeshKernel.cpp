@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <Base/Exception.h>
+#include <Base/Stream.h>
+#include <Mod/Mesh/App/Core/Builder.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshKernelTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // more facets than fit into one block of the bulk operations
+        for (int i = 0; i < 300; i++) {
+            Base::Vector3f p1(float(i), float(i % 7), 0.F);
+            Base::Vector3f p2(float(i + 1), float(i % 5), 1.F);
+            Base::Vector3f p3(float(i), 1.F, float(i % 3) - 5.F);
+            kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+        }
+        // a degenerated facet
+        Base::Vector3f p(1.F, 2.F, 3.F);
+        kernel.AddFacet(MeshCore::MeshGeomFacet(p, p, p));
+    }
+
+    MeshCore::MeshKernel& GetKernel()
+    {
+        return kernel;
+    }
+
+private:
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshKernelTest, TestRecalcBoundBox)
+{
+    Base::BoundBox3f box;
+    for (const auto& pnt : GetKernel().GetPoints()) {
+        box.Add(pnt);
+    }
+
+    GetKernel().RecalcBoundBox();
+    const Base::BoundBox3f& bbox = GetKernel().GetBoundBox();
+    EXPECT_EQ(bbox.MinX, box.MinX);
+    EXPECT_EQ(bbox.MinY, box.MinY);
+    EXPECT_EQ(bbox.MinZ, box.MinZ);
+    EXPECT_EQ(bbox.MaxX, box.MaxX);
+    EXPECT_EQ(bbox.MaxY, box.MaxY);
+    EXPECT_EQ(bbox.MaxZ, box.MaxZ);
+}
+
+TEST_F(MeshKernelTest, TestTransform)
+{
+    Base::Matrix4D mat;
+    mat.rotZ(0.3);
+    mat.scale(2.0, 0.5, 1.5);
+    mat.move(Base::Vector3f(1.F, -2.F, 3.F));
+
+    MeshCore::MeshPointArray points = GetKernel().GetPoints();
+    GetKernel().Transform(mat);
+
+    Base::BoundBox3f box;
+    ASSERT_EQ(points.size(), GetKernel().CountPoints());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        Base::Vector3f pnt = mat * points[i];
+        EXPECT_EQ(GetKernel().GetPoint(i), pnt);
+        box.Add(pnt);
+    }
+
+    const Base::BoundBox3f& bbox = GetKernel().GetBoundBox();
+    EXPECT_EQ(bbox.MinX, box.MinX);
+    EXPECT_EQ(bbox.MinY, box.MinY);
+    EXPECT_EQ(bbox.MinZ, box.MinZ);
+    EXPECT_EQ(bbox.MaxX, box.MaxX);
+    EXPECT_EQ(bbox.MaxY, box.MaxY);
+    EXPECT_EQ(bbox.MaxZ, box.MaxZ);
+}
+
+TEST_F(MeshKernelTest, TestGetFacetNormals)
+{
+    std::vector<MeshCore::FacetIndex> facets;
+    for (MeshCore::FacetIndex i = GetKernel().CountFacets(); i > 0; i--) {
+        facets.push_back(i - 1);
+    }
+
+    std::vector<Base::Vector3f> normals = GetKernel().GetFacetNormals(facets);
+    ASSERT_EQ(normals.size(), facets.size());
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        MeshCore::MeshGeomFacet facet = GetKernel().GetFacet(facets[i]);
+        Base::Vector3f normal = (facet._aclPoints[1] - facet._aclPoints[0])
+            % (facet._aclPoints[2] - facet._aclPoints[0]);
+        normal.Normalize();
+        EXPECT_FLOAT_EQ(normals[i].x, normal.x);
+        EXPECT_FLOAT_EQ(normals[i].y, normal.y);
+        EXPECT_FLOAT_EQ(normals[i].z, normal.z);
+    }
+
+    // the degenerated facet
+    EXPECT_EQ(normals.front(), Base::Vector3f());
+}
+
+TEST_F(MeshKernelTest, TestWriteRead)
+{
+    const MeshCore::MeshKernel& kernel = GetKernel();
+    std::stringstream str;
+    kernel.Write(str);
+
+    MeshCore::MeshKernel copy;
+    copy.Read(str);
+    EXPECT_TRUE(copy.GetPoints() == kernel.GetPoints());
+    ASSERT_EQ(copy.CountFacets(), kernel.CountFacets());
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        const MeshCore::MeshFacet& facet = kernel.GetFacets()[i];
+        const MeshCore::MeshFacet& other = copy.GetFacets()[i];
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(other._aulPoints[j], facet._aulPoints[j]);
+            EXPECT_EQ(other._aulNeighbours[j], facet._aulNeighbours[j]);
+        }
+    }
+    EXPECT_EQ(copy.GetBoundBox().MinX, kernel.GetBoundBox().MinX);
+    EXPECT_EQ(copy.GetBoundBox().MaxZ, kernel.GetBoundBox().MaxZ);
+
+    // truncated data
+    std::string data = str.str();
+    std::stringstream truncated(data.substr(0, data.size() - 5));
+    EXPECT_THROW(copy.Read(truncated), Base::BadFormatError);
+}
+
+TEST_F(MeshKernelTest, TestReadStreamFormat)
+{
+    // the format written by older versions
+    const MeshCore::MeshKernel& kernel = GetKernel();
+    std::stringstream str;
+    Base::OutputStream out(str);
+    out << uint32_t(0xA0B0C0D0) << uint32_t(0x010000);
+    str << std::string(256, '-');
+    out << uint32_t(kernel.CountPoints()) << uint32_t(kernel.CountFacets());
+    for (const auto& point : kernel.GetPoints()) {
+        out << point.x << point.y << point.z;
+    }
+    for (const auto& facet : kernel.GetFacets()) {
+        for (auto index : facet._aulPoints) {
+            out << uint32_t(index);
+        }
+        for (auto index : facet._aulNeighbours) {
+            out << uint32_t(index);
+        }
+    }
+    const Base::BoundBox3f& box = kernel.GetBoundBox();
+    out << box.MinX << box.MaxX << box.MinY << box.MaxY << box.MinZ << box.MaxZ;
+
+    MeshCore::MeshKernel copy;
+    copy.Read(str);
+    EXPECT_TRUE(copy.GetPoints() == kernel.GetPoints());
+    ASSERT_EQ(copy.CountFacets(), kernel.CountFacets());
+    EXPECT_EQ(copy.GetFacets().back()._aulNeighbours[0], MeshCore::FACET_INDEX_MAX);
+    EXPECT_EQ(copy.GetFacets().front()._aulPoints[2], kernel.GetFacets().front()._aulPoints[2]);
+}
+
+TEST(MeshFastBuilderTest, TestGridOfFacets)
+{
+    // big enough to be built with several threads
+    const int size = 100;
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshFastBuilder builder(kernel);
+    builder.Initialize(2 * size * size);
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            Base::Vector3f p1(float(i), float(j), 0.F);
+            Base::Vector3f p2(float(i + 1), float(j), 0.F);
+            Base::Vector3f p3(float(i + 1), float(j + 1), 0.F);
+            Base::Vector3f p4(float(i), float(j + 1), 0.F);
+            builder.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+            builder.AddFacet(MeshCore::MeshGeomFacet(p1, p3, p4));
+        }
+    }
+    builder.Finish();
+
+    EXPECT_EQ(kernel.CountPoints(), (size + 1) * (size + 1));
+    EXPECT_EQ(kernel.CountFacets(), 2 * size * size);
+
+    // the facets keep their points and the neighbourhood is symmetric
+    std::size_t borderEdges = 0;
+    const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
+    for (std::size_t i = 0; i < facets.size(); i++) {
+        MeshCore::MeshGeomFacet facet = kernel.GetFacet(i);
+        EXPECT_EQ(facet._aclPoints[0].x, float(i / (2 * size)));
+        for (int side = 0; side < 3; side++) {
+            MeshCore::FacetIndex neighbour = facets[i]._aulNeighbours[side];
+            if (neighbour == MeshCore::FACET_INDEX_MAX) {
+                borderEdges++;
+                continue;
+            }
+            ASSERT_LT(neighbour, facets.size());
+            unsigned short back = facets[neighbour].Side(facets[i]);
+            ASSERT_LT(back, 3);
+            EXPECT_EQ(facets[neighbour]._aulNeighbours[back], i);
+        }
+    }
+    EXPECT_EQ(borderEdges, 4 * size);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
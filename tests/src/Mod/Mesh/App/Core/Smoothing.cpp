@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Smoothing.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshSmoothingTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a flat square of 4 x 4 quads with a peak in the middle
+        auto point = [](int i, int j) {
+            return Base::Vector3f(float(i), float(j), i == 2 && j == 2 ? 1.0F : 0.0F);
+        };
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                kernel.AddFacet(
+                    MeshCore::MeshGeomFacet(point(i, j), point(i + 1, j), point(i + 1, j + 1))
+                );
+                kernel.AddFacet(
+                    MeshCore::MeshGeomFacet(point(i, j), point(i + 1, j + 1), point(i, j + 1))
+                );
+            }
+        }
+    }
+
+    MeshCore::PointIndex FindPoint(float x, float y) const
+    {
+        const MeshCore::MeshPointArray& points = kernel.GetPoints();
+        for (std::size_t i = 0; i < points.size(); i++) {
+            if (points[i].x == x && points[i].y == y) {
+                return MeshCore::PointIndex(i);
+            }
+        }
+        return MeshCore::POINT_INDEX_MAX;
+    }
+
+    float GetHeight(MeshCore::PointIndex index) const
+    {
+        return kernel.GetPoint(index).z;
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshSmoothingTest, TestLaplace)
+{
+    MeshCore::PointIndex peak = FindPoint(2.0F, 2.0F);
+    MeshCore::PointIndex border = FindPoint(0.0F, 2.0F);
+    ASSERT_NE(peak, MeshCore::POINT_INDEX_MAX);
+    ASSERT_NE(border, MeshCore::POINT_INDEX_MAX);
+
+    MeshCore::LaplaceSmoothing smooth(kernel);
+    smooth.Smooth(1);
+
+    // the peak moves by lambda towards the mean of its six neighbours
+    EXPECT_FLOAT_EQ(GetHeight(peak), float(1.0 - smooth.GetLambda()));
+    EXPECT_FLOAT_EQ(GetHeight(border), 0.0F);
+    // the neighbours are moved with the heights before the iteration
+    EXPECT_FLOAT_EQ(GetHeight(FindPoint(1.0F, 2.0F)), float(smooth.GetLambda() / 6.0));
+}
+
+TEST_F(MeshSmoothingTest, TestLaplacePoints)
+{
+    MeshCore::PointIndex peak = FindPoint(2.0F, 2.0F);
+    MeshCore::PointIndex neighbour = FindPoint(1.0F, 2.0F);
+
+    MeshCore::LaplaceSmoothing smooth(kernel);
+    smooth.SmoothPoints(1, {peak});
+
+    EXPECT_FLOAT_EQ(GetHeight(peak), float(1.0 - smooth.GetLambda()));
+    EXPECT_FLOAT_EQ(GetHeight(neighbour), 0.0F);
+}
+
+TEST_F(MeshSmoothingTest, TestTaubin)
+{
+    MeshCore::PointIndex peak = FindPoint(2.0F, 2.0F);
+    MeshCore::PointIndex border = FindPoint(4.0F, 1.0F);
+
+    MeshCore::TaubinSmoothing smooth(kernel);
+    smooth.Smooth(10);
+
+    EXPECT_LT(GetHeight(peak), 1.0F);
+    EXPECT_GT(GetHeight(peak), 0.0F);
+    EXPECT_FLOAT_EQ(GetHeight(border), 0.0F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
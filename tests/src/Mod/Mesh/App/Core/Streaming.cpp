@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <list>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Streaming.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshStreamProcessorTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        input.setFile(Base::FileInfo::getTempFileName() + ".stl");
+        output.setFile(Base::FileInfo::getTempFileName() + ".stl");
+
+        // a wavy square of 40 x 40 quads
+        MeshCore::MeshKernel kernel;
+        auto point = [](int i, int j) {
+            return Base::Vector3f(float(i), float(j), 0.1F * float((i * j) % 3));
+        };
+        for (int i = 0; i < 40; i++) {
+            for (int j = 0; j < 40; j++) {
+                kernel.AddFacet(MeshCore::MeshGeomFacet(point(i, j), point(i + 1, j), point(i + 1, j + 1)));
+                kernel.AddFacet(MeshCore::MeshGeomFacet(point(i, j), point(i + 1, j + 1), point(i, j + 1)));
+            }
+        }
+
+        MeshCore::MeshOutput writer(kernel);
+        writer.SaveAny(input.filePath().c_str(), MeshCore::MeshIO::BSTL);
+    }
+
+    void TearDown() override
+    {
+        input.deleteFile();
+        output.deleteFile();
+    }
+
+    std::string GetInput() const
+    {
+        return input.filePath();
+    }
+
+    std::string GetOutput() const
+    {
+        return output.filePath();
+    }
+
+    static MeshCore::MeshKernel Load(const std::string& fileName)
+    {
+        MeshCore::MeshKernel kernel;
+        MeshCore::MeshInput reader(kernel);
+        reader.LoadAny(fileName.c_str());
+        return kernel;
+    }
+
+    static std::size_t CountBorders(const MeshCore::MeshKernel& kernel)
+    {
+        std::list<std::vector<MeshCore::PointIndex>> borders;
+        MeshCore::MeshAlgorithm(kernel).GetMeshBorders(borders);
+        return borders.size();
+    }
+
+private:
+    Base::FileInfo input;
+    Base::FileInfo output;
+};
+
+TEST_F(MeshStreamProcessorTest, TestCopy)
+{
+    MeshCore::MeshStreamProcessor processor;
+    processor.SetBucketSize(500);
+    processor.Process(GetInput().c_str(), GetOutput().c_str());
+
+    MeshCore::MeshKernel kernel = Load(GetOutput());
+    EXPECT_EQ(kernel.CountFacets(), 3200);
+    EXPECT_EQ(kernel.CountPoints(), 41 * 41);
+    EXPECT_EQ(CountBorders(kernel), 1);
+}
+
+TEST_F(MeshStreamProcessorTest, TestDecimate)
+{
+    MeshCore::MeshStreamProcessor processor;
+    processor.SetBucketSize(500);
+    processor.AddDecimation(0.5F);
+    processor.Process(GetInput().c_str(), GetOutput().c_str());
+
+    // the buckets still fit together
+    MeshCore::MeshKernel kernel = Load(GetOutput());
+    EXPECT_LT(kernel.CountFacets(), 3200);
+    EXPECT_EQ(CountBorders(kernel), 1);
+}
+
+TEST_F(MeshStreamProcessorTest, TestSmooth)
+{
+    MeshCore::MeshStreamProcessor processor;
+    processor.SetBucketSize(500);
+    processor.AddSmoothing(3);
+    processor.Process(GetInput().c_str(), GetOutput().c_str());
+
+    MeshCore::MeshKernel kernel = Load(GetOutput());
+    EXPECT_EQ(kernel.CountFacets(), 3200);
+    EXPECT_EQ(kernel.CountPoints(), 41 * 41);
+    EXPECT_EQ(CountBorders(kernel), 1);
+}
+
+TEST_F(MeshStreamProcessorTest, TestMissingInput)
+{
+    MeshCore::MeshStreamProcessor processor;
+    EXPECT_THROW(processor.Process("no_such_file.stl", GetOutput().c_str()), Base::FileException);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
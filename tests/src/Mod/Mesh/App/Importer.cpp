@@ -4,6 +4,8 @@
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
 #include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/IO/ReaderPLY.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -14,6 +16,71 @@ protected:
     {
         XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
     }
+
+    static void expectSameFacets(const MeshCore::MeshFacetArray& f1, const MeshCore::MeshFacetArray& f2)
+    {
+        ASSERT_EQ(f1.size(), f2.size());
+        for (std::size_t i = 0; i < f1.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(f1[i]._aulPoints[j], f2[i]._aulPoints[j]);
+                EXPECT_EQ(f1[i]._aulNeighbours[j], f2[i]._aulNeighbours[j]);
+            }
+        }
+    }
+
+    template<typename T>
+    static void append(std::string& data, T value)
+    {
+        data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // a binary STL of a tetrahedron
+    static std::string binarySTL()
+    {
+        std::string data(80, ' ');
+        append<uint32_t>(data, 4);
+        const float pts[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+        const int facets[4][3] = {{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {0, 3, 2}};
+        for (const auto& facet : facets) {
+            for (int i = 0; i < 3; i++) {
+                append<float>(data, 0.0F);  // normal
+            }
+            for (int index : facet) {
+                for (float coord : pts[index]) {
+                    append<float>(data, coord);
+                }
+            }
+            append<uint16_t>(data, 0);
+        }
+        return data;
+    }
+
+    // a binary PLY of a tetrahedron with vertex colors
+    static std::string binaryPLY(const std::vector<std::array<uint32_t, 3>>& faces)
+    {
+        std::string data = "ply\nformat binary_little_endian 1.0\nelement vertex 4\n"
+                           "property float x\nproperty float y\nproperty float z\n"
+                           "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+                           "element face "
+            + std::to_string(faces.size())
+            + "\nproperty list uchar uint vertex_indices\nend_header\n";
+        const float pts[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+        for (const auto& pnt : pts) {
+            for (float coord : pnt) {
+                append<float>(data, coord);
+            }
+            append<uint8_t>(data, 255);
+            append<uint8_t>(data, 0);
+            append<uint8_t>(data, 51);
+        }
+        for (const auto& face : faces) {
+            append<uint8_t>(data, 3);
+            for (uint32_t index : face) {
+                append<uint32_t>(data, index);
+            }
+        }
+        return data;
+    }
 };
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -53,4 +120,46 @@ TEST_F(ImporterTest, TestOBJ)
     EXPECT_EQ(kernel.CountPoints(), 8);
     EXPECT_EQ(kernel.CountFacets(), 12);
 }
+
+TEST_F(ImporterTest, TestBinarySTLFromMemory)
+{
+    std::string data = binarySTL();
+
+    MeshCore::MeshKernel kernel1;
+    std::istringstream str(data);
+    EXPECT_TRUE(MeshCore::MeshInput(kernel1).LoadBinarySTL(str));
+
+    MeshCore::MeshKernel kernel2;
+    EXPECT_TRUE(MeshCore::MeshInput(kernel2).LoadBinarySTL(data.data(), data.size()));
+
+    EXPECT_EQ(kernel2.CountPoints(), 4);
+    EXPECT_EQ(kernel2.CountFacets(), 4);
+    EXPECT_EQ(kernel1.GetPoints(), kernel2.GetPoints());
+    expectSameFacets(kernel1.GetFacets(), kernel2.GetFacets());
+
+    // the number of facets doesn't match the size
+    MeshCore::MeshKernel kernel3;
+    EXPECT_FALSE(MeshCore::MeshInput(kernel3).LoadBinarySTL(data.data(), data.size() - 1));
+}
+
+TEST_F(ImporterTest, TestBinaryPLYFromMemory)
+{
+    std::string data = binaryPLY({{{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {0, 3, 2}}});
+
+    MeshCore::MeshKernel kernel1;
+    MeshCore::Material material1;
+    std::istringstream str(data);
+    EXPECT_TRUE(MeshCore::ReaderPLY(kernel1, &material1).Load(str));
+
+    MeshCore::MeshKernel kernel2;
+    MeshCore::Material material2;
+    EXPECT_TRUE(MeshCore::ReaderPLY(kernel2, &material2).Load(data.data(), data.size()));
+
+    EXPECT_EQ(kernel2.CountPoints(), 4);
+    EXPECT_EQ(kernel2.CountFacets(), 4);
+    EXPECT_EQ(kernel1.GetPoints(), kernel2.GetPoints());
+    expectSameFacets(kernel1.GetFacets(), kernel2.GetFacets());
+    EXPECT_EQ(material2.binding, MeshCore::MeshIO::PER_VERTEX);
+    EXPECT_EQ(material1.diffuseColor, material2.diffuseColor);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
 #include <src/App/InitApplication.h>
@@ -108,4 +109,32 @@ TEST_F(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST_F(MeshTest, TestFacetBVHIsShared)
+{
+    MeshCore::MeshKernel kernel;
+    Base::Vector3f p1 {0, 0, 0};
+    Base::Vector3f p2 {1, 0, 0};
+    Base::Vector3f p3 {0, 1, 0};
+    Base::Vector3f p4 {1, 1, 0};
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p1, p2, p3));
+    kernel.AddFacet(MeshCore::MeshGeomFacet(p3, p2, p4));
+
+    Mesh::MeshObject mesh(kernel);
+    auto bvh1 = mesh.getFacetBVH();
+    auto bvh2 = mesh.getFacetBVH();
+    EXPECT_EQ(bvh1, bvh2);
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(0, 0, 2));
+    mesh.setTransform(mat);
+    auto bvh3 = mesh.getFacetBVH();
+    EXPECT_NE(bvh1, bvh3);
+    EXPECT_FLOAT_EQ(bvh3->GetBoundBox().MinZ, 2.0F);
+
+    mesh.getKernel().Transform(mat);
+    auto bvh4 = mesh.getFacetBVH();
+    EXPECT_NE(bvh3, bvh4);
+    EXPECT_FLOAT_EQ(bvh4->GetBoundBox().MinZ, 4.0F);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
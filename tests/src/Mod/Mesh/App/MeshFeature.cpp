@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include "gtest/gtest.h"
+#include <memory>
 #include <src/App/InitApplication.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 
@@ -39,4 +40,29 @@ TEST_F(MeshFeatureTest, getComplexElementTypes)
     EXPECT_STREQ(types[0], "Mesh");
     EXPECT_STREQ(types[1], "Segment");
 }
+
+TEST_F(MeshFeatureTest, copyOnWrite)
+{
+    Mesh::Feature mf;
+    MeshCore::MeshKernel kernel;
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    mf.Mesh.setValue(kernel);
+
+    std::unique_ptr<App::Property> copy(mf.Mesh.Copy());
+    auto snapshot = static_cast<Mesh::PropertyMeshKernel*>(copy.get());
+    EXPECT_EQ(snapshot->getValuePtr(), mf.Mesh.getValuePtr());
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(2, 0, 0));
+    mf.Mesh.transformGeometry(mat);
+    EXPECT_NE(snapshot->getValuePtr(), mf.Mesh.getValuePtr());
+    EXPECT_EQ(snapshot->getValue().countFacets(), 1UL);
+    EXPECT_EQ(snapshot->getValue().getKernel().GetPoint(0), Base::Vector3f(0, 0, 0));
+    EXPECT_EQ(mf.Mesh.getValue().getKernel().GetPoint(0), Base::Vector3f(2, 0, 0));
+
+    mf.Mesh.Paste(*snapshot);
+    EXPECT_EQ(snapshot->getValuePtr(), mf.Mesh.getValuePtr());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -346,4 +346,33 @@ TEST_F(FaceMakerBullseyeTest, buildEssenceManyWires)
     EXPECT_NEAR(faceArea(fm.Shape()), expected, 1e-3);
 }
 
+TEST_F(FaceMakerBullseyeTest, buildEssenceIslandsInManyHoles)
+{
+    FaceMakerBullseye fm;
+    gp_Pln plane;
+    fm.setPlane(plane);
+
+    fm.addWire(makeRectWire(0, 0, 100, 100));
+
+    // Each hole gets an island, which must not be taken as a hole of the outer face
+    int count = 0;
+    for (int row = 0; row < 5; ++row) {
+        for (int col = 0; col < 5; ++col) {
+            double cx = 10.0 + (col * 20.0);
+            double cy = 10.0 + (row * 20.0);
+            fm.addWire(makeCircleWire(cx, cy, 0, 3.0));
+            fm.addWire(makeCircleWire(cx, cy, 0, 1.0));
+            ++count;
+        }
+    }
+
+    fm.Build();
+    ASSERT_TRUE(fm.IsDone());
+
+    double expected = 10000.0 - (count * std::numbers::pi * 9.0) + (count * std::numbers::pi);
+    EXPECT_NEAR(faceArea(fm.Shape()), expected, 1e-3);
+    TopoShape shape(fm.Shape());
+    EXPECT_EQ(shape.countSubShapes(TopAbs_FACE), static_cast<unsigned long>(count + 1));
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+#include "Mod/Part/App/FaceMakerCheese.h"
+#include "Mod/Part/App/TopoShape.h"
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeWire.hxx>
+#include <BRepGProp.hxx>
+#include <GC_MakeCircle.hxx>
+#include <GProp_GProps.hxx>
+#include <numbers>
+
+// NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+
+using namespace Part;
+
+class FaceMakerCheeseTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    static TopoDS_Wire makeRectWire(double x0, double y0, double x1, double y1)
+    {
+        BRepBuilderAPI_MakeWire mw;
+        mw.Add(BRepBuilderAPI_MakeEdge(gp_Pnt(x0, y0, 0), gp_Pnt(x1, y0, 0)).Edge());
+        mw.Add(BRepBuilderAPI_MakeEdge(gp_Pnt(x1, y0, 0), gp_Pnt(x1, y1, 0)).Edge());
+        mw.Add(BRepBuilderAPI_MakeEdge(gp_Pnt(x1, y1, 0), gp_Pnt(x0, y1, 0)).Edge());
+        mw.Add(BRepBuilderAPI_MakeEdge(gp_Pnt(x0, y1, 0), gp_Pnt(x0, y0, 0)).Edge());
+        return mw.Wire();
+    }
+
+    static TopoDS_Wire makeCircleWire(double cx, double cy, double radius)
+    {
+        Handle(Geom_Circle) circ = GC_MakeCircle(gp_Ax2(gp_Pnt(cx, cy, 0), gp::DZ()), radius).Value();
+        return BRepBuilderAPI_MakeWire(BRepBuilderAPI_MakeEdge(circ).Edge()).Wire();
+    }
+
+    static double faceArea(const TopoDS_Shape& shape)
+    {
+        GProp_GProps props;
+        BRepGProp::SurfaceProperties(shape, props);
+        return props.Mass();
+    }
+};
+
+TEST_F(FaceMakerCheeseTest, makeFaceSeparatesPanelsWithHoles)
+{
+    // Arrange
+    std::vector<TopoDS_Wire> wires;
+    int holeCount = 0;
+    for (int panel = 0; panel < 3; ++panel) {
+        double x0 = panel * 30.0;
+        wires.push_back(makeRectWire(x0, 0, x0 + 20.0, 20.0));
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                wires.push_back(makeCircleWire(x0 + 2.5 + (col * 5.0), 2.5 + (row * 5.0), 1.0));
+                ++holeCount;
+            }
+        }
+    }
+
+    // Act
+    TopoDS_Shape result = FaceMakerCheese::makeFace(wires);
+
+    // Assert
+    ASSERT_FALSE(result.IsNull());
+    TopoShape shape(result);
+    EXPECT_EQ(shape.countSubShapes(TopAbs_FACE), 3UL);
+    EXPECT_EQ(shape.countSubShapes(TopAbs_WIRE), static_cast<unsigned long>(3 + holeCount));
+    double expected = (3 * 400.0) - (holeCount * std::numbers::pi);
+    EXPECT_NEAR(faceArea(result), expected, 1e-3);
+}
+
+TEST_F(FaceMakerCheeseTest, isInside)
+{
+    // Arrange
+    TopoDS_Wire outer = makeRectWire(0, 0, 10, 10);
+    TopoDS_Wire inner = makeCircleWire(5, 5, 1);
+    TopoDS_Wire apart = makeCircleWire(25, 5, 1);
+
+    // Act & Assert
+    EXPECT_TRUE(FaceMakerCheese::isInside(outer, inner));
+    EXPECT_FALSE(FaceMakerCheese::isInside(inner, outer));
+    EXPECT_FALSE(FaceMakerCheese::isInside(outer, apart));
+}
+
+// NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
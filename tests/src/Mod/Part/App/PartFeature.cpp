@@ -7,7 +7,9 @@
 #include <src/App/InitApplication.h>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include "PartTestHelpers.h"
+#include "App/Link.h"
 #include "App/MappedElement.h"
+#include <TopExp_Explorer.hxx>
 
 using namespace Part;
 using namespace PartTestHelpers;
@@ -215,6 +217,33 @@ TEST_F(FeaturePartTest, getSubObject)
     EXPECT_STREQ(result->getNameInDocument(), "Part__Box001");
 }
 
+TEST_F(FeaturePartTest, getShapeOfLinkArray)
+{
+    // Arrange
+    auto link = _doc->addObject<App::Link>();
+    link->LinkedObject.setValue(_boxes[0]);
+    link->ElementCount.setValue(3);
+    auto placements = link->PlacementList.getValues();
+    ASSERT_EQ(placements.size(), 3U);
+    placements[1].setPosition(Base::Vector3d(10, 0, 0));
+    placements[2].setPosition(Base::Vector3d(0, 10, 0));
+    link->PlacementList.setValues(placements);
+    _doc->recompute();
+    // Act
+    auto shape = Feature::getShape(link, ShapeOption::NoFlag);
+    auto topoShape = Feature::getTopoShape(link, ShapeOption::NoFlag);
+    // Assert
+    int solids = 0;
+    for (TopExp_Explorer xp(shape, TopAbs_SOLID); xp.More(); xp.Next()) {
+        ++solids;
+    }
+    EXPECT_EQ(solids, 3);
+    EXPECT_FLOAT_EQ(getVolume(topoShape.getShape()), getVolume(shape));
+    EXPECT_TRUE(topoShape.getBoundBox().IsInBox(TopoShape(shape).getBoundBox()));
+    EXPECT_TRUE(TopoShape(shape).getBoundBox().IsInBox(topoShape.getBoundBox()));
+    EXPECT_GT(topoShape.getElementMapSize(), 0);
+}
+
 TEST_F(FeaturePartTest, getElementTypes)
 {
     Part::Feature pf;
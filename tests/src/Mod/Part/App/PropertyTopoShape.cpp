@@ -141,6 +141,25 @@ TEST_F(PropertyTopoShapeTest, testPropertyPartShapeTopoDSShape)
     EXPECT_EQ(topoShapeOut.getElementMapSize(), 0);  // We passed in a TopoDS_Shape so lost the map
 }
 
+TEST_F(PropertyTopoShapeTest, testPropertyPartShapeSkipsIdenticalShape)
+{
+    // Arrange
+    auto fingerprint = _common->Shape.getShape().getFingerprint();
+    _common->Shape.purgeTouched();
+    // Act
+    _common->execute();  // Same inputs, so a new but identical shape
+    bool touchedByIdentical = _common->Shape.isTouched();
+    auto identicalFingerprint = _common->Shape.getShape().getFingerprint();
+    _boxes[1]->Height.setValue(2);
+    _common->execute();
+    bool touchedByChanged = _common->Shape.isTouched();
+    // Assert
+    EXPECT_FALSE(touchedByIdentical);
+    EXPECT_EQ(identicalFingerprint, fingerprint);
+    EXPECT_TRUE(touchedByChanged);
+    EXPECT_NE(_common->Shape.getShape().getFingerprint(), fingerprint);
+}
+
 TEST_F(PropertyTopoShapeTest, testPropertyPartShapeGetPyObject)
 {
     // Arrange
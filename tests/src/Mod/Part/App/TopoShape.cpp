@@ -1,8 +1,18 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <sstream>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <GProp_GProps.hxx>
+#include <Standard_Version.hxx>
+#include <TopoDS.hxx>
 #include "PartTestHelpers.h"
+#include <Mod/Part/App/CrossSection.h>
 #include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/Tools.h>
 #include "src/App/InitApplication.h"
 
 
@@ -99,6 +109,19 @@ TEST_F(TopoShapeTest, TestElementTypeNonMatching)
     }
 }
 
+TEST_F(TopoShapeTest, TestShapeTypeAndIndex)
+{
+    EXPECT_EQ(Part::TopoShape::shapeTypeAndIndex("Face12"), std::make_pair(TopAbs_FACE, 12));
+    EXPECT_EQ(Part::TopoShape::shapeTypeAndIndex("CompSolid2"),
+              std::make_pair(TopAbs_COMPSOLID, 2));
+    EXPECT_EQ(Part::TopoShape::shapeTypeAndIndex("SubShape3"), std::make_pair(TopAbs_SHAPE, 3));
+    for (std::array elements =
+             {"Face", "Face3extra", "Face-1", "Facer", "SubShape", "", "Edge99999999999"};
+         const auto& element : elements) {
+        EXPECT_EQ(Part::TopoShape::shapeTypeAndIndex(element).second, 0) << element;
+    }
+}
+
 TEST_F(TopoShapeTest, TestTypeFace1)
 {
     EXPECT_EQ(Part::TopoShape::getTypeAndIndex("Face1"),
@@ -157,4 +180,128 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestExportBinaryRoundTrip)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    BRepMesh_IncrementalMesh(cube1.getShape(), 0.1);
+    std::stringstream withTriangles;
+    std::stringstream withoutTriangles;
+    // Act
+    cube1.exportBinary(withTriangles, true);
+    cube1.exportBinary(withoutTriangles);
+    Part::TopoShape restored;
+    restored.importBinary(withTriangles);
+    Part::TopoShape restoredNoMesh;
+    restoredNoMesh.importBinary(withoutTriangles);
+    // Assert
+    EXPECT_EQ(restored.countSubShapes(TopAbs_FACE), 6UL);
+    EXPECT_EQ(restoredNoMesh.countSubShapes(TopAbs_FACE), 6UL);
+    TopLoc_Location loc;
+    auto face = TopoDS::Face(restored.getSubShape(TopAbs_FACE, 1));
+    auto faceNoMesh = TopoDS::Face(restoredNoMesh.getSubShape(TopAbs_FACE, 1));
+#if OCC_VERSION_HEX >= 0x070600
+    EXPECT_FALSE(BRep_Tool::Triangulation(face, loc).IsNull());
+#endif
+    EXPECT_TRUE(BRep_Tool::Triangulation(faceNoMesh, loc).IsNull());
+}
+
+TEST_F(TopoShapeTest, TestMeshShapeReusesTriangulation)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    const TopoDS_Shape& shape = cube1.getShape();
+    Part::Tools::clearTriangulationCache();
+    // Act
+    bool first = Part::Tools::meshShape(shape, 0.1, 0.5);
+    bool coarser = Part::Tools::meshShape(shape, 0.2, 0.5);
+    bool finer = Part::Tools::meshShape(shape, 0.05, 0.5);
+    BRepTools::Clean(shape);
+    bool cleaned = Part::Tools::meshShape(shape, 0.2, 0.5);
+    // Assert
+    EXPECT_TRUE(first);
+    EXPECT_FALSE(coarser);
+    EXPECT_TRUE(finer);
+    EXPECT_TRUE(cleaned);
+    TopLoc_Location loc;
+    auto face = TopoDS::Face(cube1.getSubShape(TopAbs_FACE, 1));
+    EXPECT_FALSE(BRep_Tool::Triangulation(face, loc).IsNull());
+    Part::Tools::clearTriangulationCache();
+}
+
+TEST_F(TopoShapeTest, TestGetFaceTriangulationIntoBuffers)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    // Act
+    auto [nodes, triangles] = cube2.countFaceTriangulation(0.1);
+    std::vector<float> points(3 * nodes);
+    std::vector<uint32_t> facets(3 * triangles);
+    cube2.getFaceTriangulation(points.data(), facets.data());
+    std::vector<Base::Vector3d> mergedPoints;
+    std::vector<Data::ComplexGeoData::Facet> mergedFacets;
+    cube2.getFaces(mergedPoints, mergedFacets, 0.1);
+    // Assert
+    EXPECT_EQ(nodes, 24);  // Four nodes per face, not merged
+    EXPECT_EQ(triangles, mergedFacets.size());
+    for (std::size_t i = 0; i < nodes; ++i) {
+        // The second cube is located at x = 1
+        EXPECT_GE(points[3 * i], 1.0F);
+        EXPECT_LE(points[3 * i], 2.0F);
+    }
+    for (auto index : facets) {
+        EXPECT_LT(index, nodes);
+    }
+}
+
+TEST_F(TopoShapeTest, TestCrossSectionsOnlySliceCrossedShapes)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    Part::TopoShape compound;
+    compound.makeElementCompound({cube1, cube2});
+    std::vector<gp_Pln> planes {
+        gp_Pln(gp_Pnt(0, 0, 0.5), gp_Dir(0, 0, 1)),  // Crosses both cubes
+        gp_Pln(gp_Pnt(0.5, 0, 0), gp_Dir(1, 0, 0)),  // Crosses the first cube only
+        gp_Pln(gp_Pnt(5, 0, 0), gp_Dir(1, 0, 0)),    // Misses both cubes
+    };
+    // Act
+    auto sections = Part::CrossSections(compound.getShape()).slice(planes);
+    // Assert
+    ASSERT_EQ(sections.size(), 3);
+    EXPECT_EQ(sections[0].size(), 2);
+    EXPECT_EQ(sections[1].size(), 1);
+    EXPECT_TRUE(sections[2].empty());
+}
+
+TEST_F(TopoShapeTest, TestMassPropertiesOfLocatedCopies)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    gp_Trsf trsf;
+    trsf.SetRotation(gp_Ax1(gp_Pnt(1, 2, 3), gp_Dir(1, 1, 0)), 0.7);
+    Part::TopoShape located(cube2.getShape().Moved(TopLoc_Location(trsf)));
+    Part::TopoShape compound;
+    compound.makeElementCompound({cube1, located});
+    GProp_GProps expected;
+    BRepGProp::VolumeProperties(compound.getShape(), expected);
+    GProp_GProps expectedLocated;
+    BRepGProp::VolumeProperties(located.getShape(), expectedLocated);
+    // Act
+    auto props = compound.getMassProperties(Part::TopoShape::MassPropertyType::Volume);
+    auto locatedProps = located.getMassProperties(Part::TopoShape::MassPropertyType::Volume);
+    // Assert
+    EXPECT_DOUBLE_EQ(props.mass, 2.0);
+    EXPECT_NEAR(props.centerOfMass.x, expected.CentreOfMass().X(), 1e-9);
+    EXPECT_NEAR(props.centerOfMass.y, expected.CentreOfMass().Y(), 1e-9);
+    EXPECT_NEAR(props.centerOfMass.z, expected.CentreOfMass().Z(), 1e-9);
+    EXPECT_DOUBLE_EQ(locatedProps.mass, 1.0);
+    gp_Mat inertia = expectedLocated.MatrixOfInertia();
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(locatedProps.matrixOfInertia[i][j], inertia(i + 1, j + 1), 1e-9);
+        }
+    }
+}
+
 // clang-format on
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include <gtest/gtest.h>
+#include <thread>
 #include <Mod/Part/App/TopoShape.h>
 #include <Mod/Part/App/TopoShapeCache.h>
 
@@ -12,6 +13,7 @@
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <TopoDS_Edge.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 
 // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
 
@@ -289,4 +291,66 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, FindAncestorMatchesMapShapesAndAncestors)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    TopTools_IndexedDataMapOfShapeListOfShape expected;
+    TopExp::MapShapesAndAncestors(box, TopAbs_EDGE, TopAbs_FACE, expected);
+
+    for (bool parallel : {false, true}) {
+        Part::TopoShapeCache::setParallelAncestry(parallel);
+        Part::TopoShapeCache cache(box);
+
+        for (int i = 1; i <= expected.Extent(); ++i) {
+            // Act
+            std::vector<TopoDS_Shape> faces;
+            auto face = cache.findAncestor(box, expected.FindKey(i), TopAbs_FACE, &faces);
+
+            // Assert
+            const auto& expectedFaces = expected.FindFromIndex(i);
+            ASSERT_EQ(faces.size(), static_cast<std::size_t>(expectedFaces.Extent()));
+            EXPECT_TRUE(face.IsSame(expectedFaces.First()));
+            std::size_t index = 0;
+            for (TopTools_ListIteratorOfListOfShape it(expectedFaces); it.More(); it.Next()) {
+                EXPECT_TRUE(faces[index++].IsSame(it.Value()));
+            }
+        }
+        EXPECT_GT(cache.getMemSize(), sizeof(Part::TopoShapeCache));
+    }
+    Part::TopoShapeCache::setParallelAncestry(false);
+}
+
+TEST_F(TopoShapeCacheTest, ConcurrentSubShapeLookup)
+{
+    // Arrange
+    Part::TopoShape box(BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape());
+    box.initCache();  // shared by the copies in all threads
+    std::vector<std::thread> threads;
+    std::vector<int> found(4, 0);
+
+    // Act
+    for (std::size_t t = 0; t < found.size(); ++t) {
+        threads.emplace_back([&box, &found, t]() {
+            Part::TopoShape shape(box);
+            for (int i = 1; i <= 12; ++i) {
+                std::string name = "Edge" + std::to_string(i);
+                auto edge = shape.getSubTopoShape(name.c_str());
+                auto faces = shape.findAncestorsShapes(edge.getShape(), TopAbs_FACE);
+                if (!edge.isNull() && faces.size() == 2) {
+                    ++found[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    for (int count : found) {
+        EXPECT_EQ(count, 12);
+    }
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include "src/App/InitApplication.h"
 #include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
 #include "Mod/Part/App/TopoShapeMapper.h"
 #include <Mod/Part/App/TopoShapeOpCode.h>
 
@@ -1431,6 +1432,31 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanCommon)
     EXPECT_EQ(elements[IndexedName("Face", 1)], MappedName("Face3;:M;CMN;:H1:7,F"));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementShapeDeferredElementMap)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    BRepAlgoAPI_Fuse mkFuse(cube1, cube2);
+    TopoShape expected;
+    expected.makeElementShape(mkFuse, {topoShape1, topoShape2}, Part::OpCodes::Fuse);
+    bool deferred = TopoShape::isElementMapDeferred();
+    TopoShape::setElementMapDeferred(true);
+    // Act
+    TopoShape result;
+    result.makeElementShape(mkFuse, {topoShape1, topoShape2}, Part::OpCodes::Fuse);
+    TopoShape::setElementMapDeferred(deferred);
+    bool pending = result.hasPendingElementMap();
+    auto copy = result;
+    auto elements = elementMap(result);
+    // Assert the map is generated on first access, and the same as without deferring
+    EXPECT_TRUE(pending);
+    EXPECT_FALSE(result.hasPendingElementMap());
+    EXPECT_EQ(elements, elementMap(expected));
+    EXPECT_EQ(elementMap(copy), elements);
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementBooleanCut)
 {
     // Arrange
@@ -1493,6 +1519,67 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanCut)
     ));
 }
 
+TEST_F(TopoShapeExpansionTest, fuseGluesTouchingSolids)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/Boolean"
+    );
+    hGrp->SetBool("AutoGlue", true);
+    // the second cube touches the first one at x = 1
+    auto [cube1, cube2] = CreateTwoCubes();
+    gp_Trsf tr;
+    tr.SetTranslation(gp_Vec(-0.5, 0, 0));
+    auto overlapping = cube2.Moved(TopLoc_Location(tr));
+    TopTools_ListOfShape arguments;
+    arguments.Append(cube1);
+    TopTools_ListOfShape touchingTools;
+    touchingTools.Append(cube2);
+    TopTools_ListOfShape overlappingTools;
+    overlappingTools.Append(overlapping);
+    FCBRepAlgoAPI_Fuse glued;
+    glued.SetArguments(arguments);
+    glued.SetTools(touchingTools);
+    FCBRepAlgoAPI_Fuse intersected;
+    intersected.SetArguments(arguments);
+    intersected.SetTools(overlappingTools);
+    // Act
+    bool touchingGlued = FCBRepAlgoAPIHelper::setAutoGlue(&glued);
+    bool overlappingGlued = FCBRepAlgoAPIHelper::setAutoGlue(&intersected);
+    glued.Build();
+    hGrp->SetBool("AutoGlue", false);
+    // Assert
+    EXPECT_TRUE(touchingGlued);
+    EXPECT_FALSE(overlappingGlued);
+    ASSERT_TRUE(glued.IsDone());
+    EXPECT_FLOAT_EQ(getVolume(glued.Shape()), 2.0);
+}
+
+TEST_F(TopoShapeExpansionTest, makeElementBooleanClustersSeparatedShapes)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/Boolean"
+    );
+    hGrp->SetBool("ClusterBooleans", true);
+    auto [cube1, cube2] = CreateTwoCubes();
+    gp_Trsf tr;
+    tr.SetTranslation(gp_Vec(-0.5, 0, 0));
+    auto overlapping = cube2.Moved(TopLoc_Location(tr));
+    tr.SetTranslation(gp_Vec(10, 0, 0));
+    auto separated = cube1.Moved(TopLoc_Location(tr));
+    std::vector<TopoShape> fuseInputs {cube1, overlapping, separated};
+    std::vector<TopoShape> cutInputs {cube1, overlapping, separated};
+    // Act
+    TopoShape fused = TopoShape(0, _hasher).makeElementBoolean(Part::OpCodes::Fuse, fuseInputs);
+    TopoShape cut = TopoShape(0, _hasher).makeElementBoolean(Part::OpCodes::Cut, cutInputs);
+    hGrp->SetBool("ClusterBooleans", false);
+    // Assert
+    EXPECT_FLOAT_EQ(getVolume(fused.getShape()), 2.5);
+    EXPECT_EQ(fused.countSubShapes(TopAbs_SOLID), 2);
+    EXPECT_FLOAT_EQ(getVolume(cut.getShape()), 0.5);
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
 {
     // Arrange
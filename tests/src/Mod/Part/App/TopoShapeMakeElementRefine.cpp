@@ -4,6 +4,7 @@
 
 #include <src/App/InitApplication.h>
 
+#include "Mod/Part/App/TopoShapeOpCode.h"
 #include "PartTestHelpers.h"
 
 class FeaturePartMakeElementRefineTest: public ::testing::Test,
@@ -54,3 +55,22 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineRowOfBoxesFarFromOrigin)
+{
+    // Arrange
+    std::vector<Part::TopoShape> boxes;
+    for (int i = 0; i < 8; ++i) {
+        gp_Trsf trsf;
+        trsf.SetTranslation(gp_Vec(10000.0 + i, 5000.0, 0.0));
+        boxes.emplace_back(BRepPrimAPI_MakeBox(1.0, 1.0, 1.0).Shape().Moved(TopLoc_Location(trsf)));
+    }
+    Part::TopoShape fused;
+    fused.makeElementBoolean(Part::OpCodes::Fuse, boxes);
+    // Act
+    Part::TopoShape refined = fused.makeElementRefine();
+    // Assert
+    EXPECT_EQ(fused.countSubElements("Face"), 34);  // Each inner box loses two faces
+    EXPECT_EQ(refined.countSubElements("Face"), 6);
+    EXPECT_NEAR(PartTestHelpers::getVolume(refined.getShape()), 8.0, 1e-6);
+}
@@ -90,4 +90,31 @@ TEST_F(PadTest, TestMidPlaneTwoLength)
     EXPECT_DOUBLE_EQ(bbox.MinZ, -20.0);
 }
 
+TEST_F(PadTest, TestRecomputeReusesCachedResult)
+{
+    // Arrange
+    auto doc = getDocument();
+    auto body = getBody();
+    auto sketch = getSketch();
+    doc->recompute();
+    auto pad = doc->addObject<PartDesign::Pad>("Pad");
+    body->addObject(pad);
+    pad->Profile.setValue(sketch, {""});
+    pad->Length.setValue(10.0);
+    doc->recompute();
+    TopoDS_Shape first = pad->Shape.getShape().getShape();
+
+    // Act
+    pad->Length.setValue(20.0);
+    doc->recompute();
+    TopoDS_Shape second = pad->Shape.getShape().getShape();
+    pad->Length.setValue(10.0);
+    doc->recompute();
+
+    // Assert
+    EXPECT_FALSE(second.IsSame(first));
+    EXPECT_TRUE(pad->Shape.getShape().getShape().IsSame(first));
+    EXPECT_DOUBLE_EQ(pad->Shape.getBoundingBox().MaxZ, 10.0);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
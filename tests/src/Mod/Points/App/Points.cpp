@@ -240,4 +240,74 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+TEST_F(PointsTest, TestPLYValues)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.read(name);
+
+    EXPECT_EQ(reader.getPoints().getBasicPoints(), getKernel().getBasicPoints());
+    EXPECT_EQ(reader.getNormals(), getNormals());
+    EXPECT_EQ(reader.getIntensities(), getIntensity());
+}
+
+TEST_F(PointsTest, TestPCDValues)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.read(name);
+
+    EXPECT_EQ(reader.getPoints().getBasicPoints(), getKernel().getBasicPoints());
+    EXPECT_EQ(reader.getNormals(), getNormals());
+    EXPECT_EQ(reader.getIntensities(), getIntensity());
+}
+
+TEST_F(PointsTest, TestVoxelSize)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setWidth(4);
+    writer.setHeight(2);
+    writer.write(name);
+
+    // all points of the unit cube fall into the same voxel
+    Points::PcdReader reader;
+    reader.setVoxelSize(2.0);
+    reader.read(name);
+
+    EXPECT_EQ(reader.getPoints().size(), 1);
+    EXPECT_EQ(reader.getIntensities().size(), 1);
+    EXPECT_FALSE(reader.isStructured());
+    EXPECT_EQ(reader.getWidth(), 1);
+    EXPECT_EQ(reader.getHeight(), 1);
+}
+
+TEST_F(PointsTest, TestTakePoints)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.read(name);
+
+    Points::PointKernel kernel = reader.takePoints();
+    std::vector<float> intensity = reader.takeIntensities();
+    EXPECT_EQ(kernel.size(), 8);
+    EXPECT_EQ(intensity.size(), 8);
+    EXPECT_EQ(reader.getPoints().size(), 0);
+    EXPECT_FALSE(reader.hasIntensities());
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
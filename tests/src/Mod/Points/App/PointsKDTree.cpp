@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsKDTree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsKDTreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a dense cluster next to a sparse region
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dense(0.0F, 1.0F);
+        std::uniform_real_distribution<float> sparse(0.0F, 100.0F);
+        for (int i = 0; i < 5000; i++) {
+            points.emplace_back(dense(gen), dense(gen), dense(gen));
+        }
+        for (int i = 0; i < 1000; i++) {
+            points.emplace_back(sparse(gen), sparse(gen), sparse(gen));
+        }
+    }
+
+    std::vector<std::size_t> sortedByDistance(const Base::Vector3f& pnt) const
+    {
+        std::vector<std::size_t> indices(points.size());
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            indices[i] = i;
+        }
+        std::stable_sort(indices.begin(), indices.end(), [&](std::size_t lhs, std::size_t rhs) {
+            return Base::DistanceP2(pnt, points[lhs]) < Base::DistanceP2(pnt, points[rhs]);
+        });
+        return indices;
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointsKDTreeTest, TestEmpty)
+{
+    Points::PointsKDTree tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.findNearest(Base::Vector3f(0, 0, 0)), Points::PointsKDTree::npos);
+    EXPECT_TRUE(tree.findKNearest(Base::Vector3f(0, 0, 0), 3).empty());
+    EXPECT_TRUE(tree.findInRadius(Base::Vector3f(0, 0, 0), 1.0F).empty());
+}
+
+TEST_F(PointsKDTreeTest, TestNearest)
+{
+    Points::PointsKDTree tree(points);
+    EXPECT_EQ(tree.size(), points.size());
+
+    std::vector<Base::Vector3f> queries {
+        Base::Vector3f(0.5F, 0.5F, 0.5F),
+        Base::Vector3f(50, 50, 50),
+        Base::Vector3f(-10, 3, 200),
+    };
+    for (const auto& pnt : queries) {
+        std::vector<std::size_t> sorted = sortedByDistance(pnt);
+        EXPECT_EQ(tree.findNearest(pnt), sorted.front());
+
+        std::vector<std::size_t> knearest = tree.findKNearest(pnt, 10);
+        ASSERT_EQ(knearest.size(), 10);
+        EXPECT_TRUE(std::equal(knearest.begin(), knearest.end(), sorted.begin()));
+    }
+}
+
+TEST_F(PointsKDTreeTest, TestMaxDistance)
+{
+    Points::PointsKDTree tree(points);
+    Base::Vector3f pnt(-10, -10, -10);
+    std::size_t nearest = tree.findNearest(pnt);
+    float dist = Base::Distance(pnt, points[nearest]);
+    EXPECT_EQ(tree.findNearest(pnt, dist * 0.99F), Points::PointsKDTree::npos);
+    EXPECT_EQ(tree.findNearest(pnt, dist * 1.01F), nearest);
+}
+
+TEST_F(PointsKDTreeTest, TestRadius)
+{
+    Points::PointsKDTree tree(points);
+    Base::Vector3f pnt(0.2F, 0.7F, 0.4F);
+    float radius = 0.1F;
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (Base::DistanceP2(pnt, points[i]) <= radius * radius) {
+            expected.push_back(i);
+        }
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(tree.findInRadius(pnt, radius), expected);
+}
+
+TEST_F(PointsKDTreeTest, TestSkipInvalid)
+{
+    std::vector<Base::Vector3f> pts {
+        Base::Vector3f(std::numeric_limits<float>::quiet_NaN(), 0, 0),
+        Base::Vector3f(1, 1, 1),
+        Base::Vector3f(2, 2, 2),
+    };
+    Points::PointsKDTree tree(pts);
+    EXPECT_EQ(tree.size(), 2);
+    EXPECT_EQ(tree.findNearest(Base::Vector3f(0, 0, 0)), 1);
+    EXPECT_EQ(tree.findKNearest(Base::Vector3f(0, 0, 0), 5).size(), 2);
+}
+
+TEST_F(PointsKDTreeTest, TestKernelTree)
+{
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(10, 0, 0));
+    kernel.setTransform(mat);
+
+    auto tree = kernel.getKDTree();
+    EXPECT_EQ(tree, kernel.getKDTree());
+
+    // the tree works in global coordinates
+    std::size_t nearest = tree->findNearest(Base::Vector3f(10, 0, 0));
+    EXPECT_EQ(nearest, sortedByDistance(Base::Vector3f(0, 0, 0)).front());
+
+    // a changed point invalidates the tree
+    kernel.getBasicPoints()[0] = Base::Vector3f(-100, -100, -100);
+    auto changed = kernel.getKDTree();
+    EXPECT_NE(tree, changed);
+    EXPECT_EQ(changed->findNearest(Base::Vector3f(-90, -100, -100)), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <Mod/Points/App/PointsOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a dense patch on a plane next to a sparse volume
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dense(0.0F, 1.0F);
+        std::uniform_real_distribution<float> sparse(0.0F, 100.0F);
+        for (int i = 0; i < 20000; i++) {
+            points.emplace_back(dense(gen), dense(gen), 0.0F);
+        }
+        for (int i = 0; i < 5000; i++) {
+            points.emplace_back(sparse(gen), sparse(gen), sparse(gen));
+        }
+    }
+
+    std::vector<Base::Vector3f> points;
+};
+
+TEST_F(PointsOctreeTest, TestEmpty)
+{
+    Points::PointsOctree octree;
+    EXPECT_TRUE(octree.getLeaves().empty());
+    EXPECT_TRUE(octree.getIndices().empty());
+}
+
+TEST_F(PointsOctreeTest, TestLeaves)
+{
+    Points::PointsOctree octree(points, 1000);
+    const auto& leaves = octree.getLeaves();
+    const auto& indices = octree.getIndices();
+    ASSERT_EQ(indices.size(), points.size());
+    EXPECT_GT(leaves.size(), 1);
+
+    // the leaves cover all points exactly once
+    std::vector<int32_t> sorted(indices);
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); i++) {
+        EXPECT_EQ(sorted[i], static_cast<int32_t>(i));
+    }
+
+    std::size_t begin = 0;
+    for (const auto& leaf : leaves) {
+        EXPECT_EQ(leaf.begin, begin);
+        EXPECT_LE(leaf.end - leaf.begin, 1000);
+        begin = leaf.end;
+        for (std::size_t i = leaf.begin; i < leaf.end; i++) {
+            EXPECT_TRUE(leaf.box.IsInBox(points[indices[i]]));
+        }
+    }
+    EXPECT_EQ(begin, indices.size());
+}
+
+TEST_F(PointsOctreeTest, TestLevels)
+{
+    Points::PointsOctree octree(points, 1000);
+    for (const auto& leaf : octree.getLeaves()) {
+        ASSERT_FALSE(leaf.levels.empty());
+        EXPECT_EQ(leaf.levels.front(), 1);
+        EXPECT_EQ(leaf.levels.back(), leaf.end - leaf.begin);
+        EXPECT_TRUE(std::is_sorted(leaf.levels.begin(), leaf.levels.end()));
+        EXPECT_EQ(std::adjacent_find(leaf.levels.begin(), leaf.levels.end()), leaf.levels.end());
+    }
+}
+
+TEST_F(PointsOctreeTest, TestSkipInvalid)
+{
+    std::vector<Base::Vector3f> pts {
+        Base::Vector3f(std::numeric_limits<float>::quiet_NaN(), 0, 0),
+        Base::Vector3f(1, 1, 1),
+        Base::Vector3f(2, 2, 2),
+    };
+    Points::PointsOctree octree(pts);
+    ASSERT_EQ(octree.getLeaves().size(), 1);
+    EXPECT_EQ(octree.getIndices().size(), 2);
+    EXPECT_EQ(octree.getLeaves().front().levels.back(), 2);
+}
+
+TEST_F(PointsOctreeTest, TestCoincident)
+{
+    std::vector<Base::Vector3f> pts(100, Base::Vector3f(1, 2, 3));
+    Points::PointsOctree octree(pts, 10);
+    std::size_t count = 0;
+    for (const auto& leaf : octree.getLeaves()) {
+        count += leaf.end - leaf.begin;
+    }
+    EXPECT_EQ(count, pts.size());
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -723,6 +723,102 @@ TEST_F(SketchObjectTest, testDeleteOnlyUnusedInternalGeometryOfBSpline)
     EXPECT_EQ(getObject()->getHighestCurveIndex(), 2);
 }
 
+TEST_F(SketchObjectTest, testSolveWithAppendedConstraints)
+{
+    // Arrange
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(10.0, 1.0, 0.0));
+    int geoId = getObject()->addGeometry(&line);
+    getObject()->solve();
+    int freeDoF = getObject()->getLastDoF();
+    auto horizontal = std::make_unique<Sketcher::Constraint>();
+    horizontal->Type = Sketcher::ConstraintType::Horizontal;
+    horizontal->First = geoId;
+    auto distance = std::make_unique<Sketcher::Constraint>();
+    distance->Type = Sketcher::ConstraintType::DistanceX;
+    distance->First = geoId;
+    distance->setValue(5.0);
+
+    // Act
+    getObject()->addConstraint(horizontal.get());
+    getObject()->solve();
+    int horizontalDoF = getObject()->getLastDoF();
+    getObject()->addConstraint(distance.get());
+    getObject()->solve();
+    int distanceDoF = getObject()->getLastDoF();
+
+    // Assert
+    EXPECT_EQ(freeDoF, 4);
+    EXPECT_EQ(horizontalDoF, 3);
+    EXPECT_EQ(distanceDoF, 2);
+    auto solved = static_cast<const Part::GeomLineSegment*>(getObject()->getGeometry(geoId));
+    EXPECT_NEAR(solved->getStartPoint().y, solved->getEndPoint().y, 1e-8);
+    EXPECT_NEAR(solved->getEndPoint().x - solved->getStartPoint().x, 5.0, 1e-8);
+}
+
+TEST_F(SketchObjectTest, testAddGeometryAndConstraints)
+{
+    // Arrange
+    Part::GeomLineSegment line1;
+    line1.setPoints(Base::Vector3d(0.0, 0.0, 0.0), Base::Vector3d(10.0, 1.0, 0.0));
+    Part::GeomLineSegment line2;
+    line2.setPoints(Base::Vector3d(10.0, 2.0, 0.0), Base::Vector3d(-1.0, 8.0, 0.0));
+    std::vector<Part::Geometry*> geoList {&line1, &line2};
+    Sketcher::Constraint coincident;
+    coincident.Type = Sketcher::ConstraintType::Coincident;
+    coincident.First = 0;
+    coincident.FirstPos = Sketcher::PointPos::end;
+    coincident.Second = 1;
+    coincident.SecondPos = Sketcher::PointPos::start;
+    Sketcher::Constraint malformed;
+    malformed.Type = Sketcher::ConstraintType::Horizontal;
+    malformed.First = 2;
+
+    // Act
+    int invalidResult = getObject()->addGeometryAndConstraints(geoList, {&coincident, &malformed});
+    int geoCountAfterInvalid = getObject()->getHighestCurveIndex() + 1;
+    int result = getObject()->addGeometryAndConstraints(geoList, {&coincident});
+    getObject()->solve();
+
+    // Assert
+    EXPECT_EQ(invalidResult, -1);
+    EXPECT_EQ(geoCountAfterInvalid, 0);
+    EXPECT_EQ(result, 0);
+    EXPECT_EQ(getObject()->getHighestCurveIndex(), 1);
+    EXPECT_EQ(getObject()->Constraints.getSize(), 1);
+    EXPECT_EQ(getObject()->getLastDoF(), 6);
+    EXPECT_TRUE(getObject()->getPoint(0, Sketcher::PointPos::end)
+                    .IsEqual(getObject()->getPoint(1, Sketcher::PointPos::start), 1e-8));
+}
+
+TEST_F(SketchObjectTest, testGetGeometryInBox)
+{
+    // Arrange
+    Part::GeomLineSegment line;
+    line.setPoints(Base::Vector3d(10.0, 10.0, 0.0), Base::Vector3d(20.0, 10.0, 0.0));
+    Part::GeomCircle circle;
+    circle.setCenter(Base::Vector3d(50.0, 50.0, 0.0));
+    circle.setRadius(5.0);
+    getObject()->addGeometry(&line);
+    getObject()->addGeometry(&circle);
+
+    // Act
+    auto nearLine = getObject()->getGeometryInBox(Base::BoundBox2d(15.0, 5.0, 16.0, 15.0));
+    auto nearCircle = getObject()->getGeometryInBox(Base::BoundBox2d(54.0, 49.0, 56.0, 51.0));
+    auto nearOrigin = getObject()->getGeometryInBox(Base::BoundBox2d(-1.0, -1.0, 0.5, 0.5));
+    auto nothing = getObject()->getGeometryInBox(Base::BoundBox2d(30.0, 30.0, 40.0, 40.0));
+    Part::GeomPoint point(Base::Vector3d(35.0, 35.0, 0.0));
+    int pointId = getObject()->addGeometry(&point);
+    auto afterAdding = getObject()->getGeometryInBox(Base::BoundBox2d(30.0, 30.0, 40.0, 40.0));
+
+    // Assert
+    EXPECT_EQ(nearLine, std::vector<int> {0});
+    EXPECT_EQ(nearCircle, std::vector<int> {1});
+    EXPECT_EQ(nearOrigin, (std::vector<int> {-2, -1}));  // V and H axis
+    EXPECT_TRUE(nothing.empty());
+    EXPECT_EQ(afterAdding, std::vector<int> {pointId});
+}
+
 auto setupAngleConstraint(Sketcher::SketchObject* obj, const std::string& expr)
 {
     auto constraint = std::make_unique<Sketcher::Constraint>();
@@ -50,3 +50,90 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveDecoupledComponents)  // NOLINT
+{
+    // Arrange
+    const size_t numComponents {16};
+    std::vector<double> fixedValues(numComponents), unknownValues(numComponents, 0.0);
+    std::vector<double> differences(numComponents);
+    GCS::VEC_pD unknowns;
+    for (size_t i = 0; i < numComponents; ++i) {
+        fixedValues[i] = static_cast<double>(i);
+        differences[i] = 0.5;
+        System()->addConstraintDifference(&fixedValues[i], &unknownValues[i], &differences[i]);
+        unknowns.push_back(&unknownValues[i]);
+    }
+    System()->declareUnknowns(unknowns);
+    System()->initSolution();
+
+    // Act
+    int firstResult = System()->solve();
+    System()->applySolution();
+    fixedValues[0] = 10.0;
+    int secondResult = System()->solve();
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(firstResult, GCS::Success);
+    EXPECT_EQ(secondResult, GCS::Success);
+    EXPECT_NEAR(unknownValues[0], 10.5, 1e-8);
+    for (size_t i = 1; i < numComponents; ++i) {
+        EXPECT_NEAR(unknownValues[i], static_cast<double>(i) + 0.5, 1e-8);
+    }
+}
+
+TEST_F(GCSTest, solveWithSparseJacobian)  // NOLINT
+{
+    // Arrange
+    System()->qrAlgorithm = GCS::EigenSparseQR;
+    System()->autoChooseAlgorithm = false;
+    double x = 0.0, y = 0.0, z = 0.0;
+    double difference = 2.0, sum = 0.0;
+    // y - x = 2, z - y = 2 and x = 0 couple all parameters into a single component
+    System()->addConstraintDifference(&x, &y, &difference);
+    System()->addConstraintDifference(&y, &z, &difference);
+    System()->addConstraintEqual(&x, &sum);
+    GCS::VEC_pD unknowns {&x, &y, &z};
+
+    for (auto alg : {GCS::DogLeg, GCS::LevenbergMarquardt}) {
+        x = 1.0;
+        y = -3.0;
+        z = 7.0;
+        System()->declareUnknowns(unknowns);
+        System()->initSolution(alg);
+
+        // Act
+        int result = System()->solve(true, alg);
+        System()->applySolution();
+
+        // Assert
+        EXPECT_EQ(result, GCS::Success);
+        EXPECT_NEAR(x, 0.0, 1e-8);
+        EXPECT_NEAR(y, 2.0, 1e-8);
+        EXPECT_NEAR(z, 4.0, 1e-8);
+    }
+}
+
+TEST_F(GCSTest, dependentParamsAfterRepeatedDiagnosis)  // NOLINT
+{
+    // Arrange
+    double x = 0.0, y = 0.0;
+    double difference = 2.0;
+    // y - x = 2 leaves one degree of freedom shared by both parameters
+    System()->addConstraintDifference(&x, &y, &difference);
+    GCS::VEC_pD unknowns {&x, &y};
+    System()->declareUnknowns(unknowns);
+    System()->initSolution();
+    GCS::VEC_pD firstDependents, secondDependents;
+    System()->getDependentParams(firstDependents);
+
+    // Act
+    System()->diagnose();
+    System()->getDependentParams(secondDependents);
+
+    // Assert
+    EXPECT_EQ(System()->dofsNumber(), 1);
+    EXPECT_EQ(firstDependents.size(), size_t {2});
+    EXPECT_EQ(secondDependents, firstDependents);
+}
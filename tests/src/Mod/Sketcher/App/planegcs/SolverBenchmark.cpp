@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Solver benchmarks on procedurally generated sketches. They are disabled by default, run them
+// with:
+//   Sketcher_tests_run --gtest_also_run_disabled_tests --gtest_filter='SolverBenchmark*'
+// The timings are printed and recorded as test properties, so --gtest_output=xml:<file> keeps
+// them for comparing two builds.
+
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Mod/Sketcher/App/planegcs/GCS.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+/// Owns the parameters of a generated sketch, the solver keeps pointers to them
+class GeneratedSketch
+{
+public:
+    GCS::System system;
+    GCS::VEC_pD unknowns;
+
+    double* unknown(double value)
+    {
+        double* param = constant(value);
+        unknowns.push_back(param);
+        return param;
+    }
+
+    double* constant(double value)
+    {
+        return &values.emplace_back(value);
+    }
+
+    GCS::Point point(double x, double y)
+    {
+        return {unknown(x), unknown(y)};
+    }
+
+    void fix(GCS::Point& point)
+    {
+        system.addConstraintCoordinateX(point, constant(*point.x));
+        system.addConstraintCoordinateY(point, constant(*point.y));
+    }
+
+    /// moves all unknowns away from the solution, so that the solver has work to do
+    void perturb(double amount)
+    {
+        std::mt19937 generator(42);  // NOLINT(cert-msc51-cpp) reproducible on purpose
+        std::uniform_real_distribution<double> distribution(-amount, amount);
+        for (double* param : unknowns) {
+            *param += distribution(generator);
+        }
+    }
+
+private:
+    // a deque does not move its elements when growing
+    std::deque<double> values;
+};
+
+/// A chain of segments with fixed lengths and directions, fully constrained
+void makeChain(GeneratedSketch& sketch, int count)
+{
+    GCS::Point previous = sketch.point(0.0, 0.0);
+    sketch.fix(previous);
+    for (int i = 1; i <= count; ++i) {
+        double angle = 0.3 * std::sin(0.1 * i);
+        GCS::Point next = sketch.point(*previous.x + std::cos(angle), *previous.y + std::sin(angle));
+        sketch.system.addConstraintP2PDistance(previous, next, sketch.constant(1.0));
+        sketch.system.addConstraintP2PAngle(previous, next, sketch.constant(angle));
+        previous = next;
+    }
+}
+
+/// A grid of rectangles sharing their corners, whose widths and heights are fixed
+void makeGrid(GeneratedSketch& sketch, int rows, int columns)
+{
+    std::vector<std::vector<GCS::Point>> corners(rows + 1);
+    for (int row = 0; row <= rows; ++row) {
+        for (int column = 0; column <= columns; ++column) {
+            corners[row].push_back(sketch.point(2.0 * column, 1.0 * row));
+        }
+    }
+    sketch.fix(corners[0][0]);
+    for (int row = 0; row <= rows; ++row) {
+        for (int column = 0; column <= columns; ++column) {
+            GCS::Point& corner = corners[row][column];
+            if (column > 0) {
+                GCS::Point& left = corners[row][column - 1];
+                sketch.system.addConstraintHorizontal(left, corner);
+                if (row == 0) {
+                    sketch.system.addConstraintP2PDistance(left, corner, sketch.constant(2.0));
+                }
+            }
+            if (row > 0) {
+                GCS::Point& below = corners[row - 1][column];
+                sketch.system.addConstraintVertical(below, corner);
+                if (column == 0) {
+                    sketch.system.addConstraintP2PDistance(below, corner, sketch.constant(1.0));
+                }
+            }
+        }
+    }
+}
+
+/// A row of tangent arcs joined end to start
+void makeTangentArcs(GeneratedSketch& sketch, std::deque<GCS::Arc>& arcs, int count)
+{
+    using std::numbers::pi;
+    for (int i = 0; i < count; ++i) {
+        GCS::Arc& arc = arcs.emplace_back();
+        double centerX = 2.0 * i;
+        arc.center = sketch.point(centerX, 0.0);
+        arc.rad = sketch.unknown(1.0);
+        arc.startAngle = sketch.unknown(pi);
+        arc.endAngle = sketch.unknown(2.0 * pi);
+        arc.start = sketch.point(centerX - 1.0, 0.0);
+        arc.end = sketch.point(centerX + 1.0, 0.0);
+        sketch.system.addConstraintArcRules(arc);
+        sketch.system.addConstraintArcRadius(arc, sketch.constant(1.0));
+        if (i == 0) {
+            sketch.fix(arc.center);
+        }
+        else {
+            GCS::Arc& previous = arcs[i - 1];
+            sketch.system.addConstraintP2PCoincident(previous.end, arc.start);
+            sketch.system.addConstraintTangent(previous, arc);
+        }
+    }
+}
+
+/// Many small rectangles without any relation between them
+void makeClusters(GeneratedSketch& sketch, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        double x = 3.0 * i;
+        GCS::Point p0 = sketch.point(x, 0.0);
+        GCS::Point p1 = sketch.point(x + 2.0, 0.0);
+        GCS::Point p2 = sketch.point(x + 2.0, 1.0);
+        GCS::Point p3 = sketch.point(x, 1.0);
+        sketch.fix(p0);
+        sketch.system.addConstraintHorizontal(p0, p1);
+        sketch.system.addConstraintVertical(p1, p2);
+        sketch.system.addConstraintHorizontal(p2, p3);
+        sketch.system.addConstraintVertical(p3, p0);
+        sketch.system.addConstraintP2PDistance(p0, p1, sketch.constant(2.0));
+        sketch.system.addConstraintP2PDistance(p1, p2, sketch.constant(1.0));
+    }
+}
+
+const char* algorithmName(GCS::Algorithm alg)
+{
+    switch (alg) {
+        case GCS::BFGS:
+            return "BFGS";
+        case GCS::LevenbergMarquardt:
+            return "LM";
+        case GCS::DogLeg:
+            return "DogLeg";
+    }
+    return "";
+}
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+}  // namespace
+
+class SolverBenchmark: public ::testing::Test
+{
+protected:
+    /// Solves the sketch made by \a generate with every algorithm and QR decomposition
+    void run(const std::string& name, const std::function<void(GeneratedSketch&)>& generate)
+    {
+        for (auto qr : {GCS::EigenDenseQR, GCS::EigenSparseQR}) {
+            for (auto alg : {GCS::BFGS, GCS::LevenbergMarquardt, GCS::DogLeg}) {
+                GeneratedSketch sketch;
+                generate(sketch);
+                sketch.perturb(0.05);
+                sketch.system.qrAlgorithm = qr;
+                sketch.system.autoChooseAlgorithm = false;
+                sketch.system.declareUnknowns(sketch.unknowns);
+
+                auto start = std::chrono::steady_clock::now();
+                int dofs = sketch.system.diagnose(alg);
+                double diagnoseTime = elapsedMilliseconds(start);
+
+                start = std::chrono::steady_clock::now();
+                sketch.system.initSolution(alg);
+                int result = sketch.system.solve(true, alg);
+                double solveTime = elapsedMilliseconds(start);
+
+                std::string config = name + "/" + algorithmName(alg)
+                    + (qr == GCS::EigenDenseQR ? "/DenseQR" : "/SparseQR");
+                std::cout << std::left << std::setw(32) << config
+                          << " unknowns: " << std::setw(6) << sketch.unknowns.size()
+                          << " dofs: " << std::setw(4) << dofs << std::fixed
+                          << std::setprecision(2) << " diagnose: " << std::setw(10)
+                          << diagnoseTime << " ms  solve: " << std::setw(10) << solveTime
+                          << " ms  status: " << result << '\n';
+                RecordProperty(config + "/diagnose_ms", std::to_string(diagnoseTime));
+                RecordProperty(config + "/solve_ms", std::to_string(solveTime));
+
+                EXPECT_NE(result, GCS::Failed) << config;
+            }
+        }
+    }
+};
+
+TEST_F(SolverBenchmark, DISABLED_chain)  // NOLINT
+{
+    run("chain", [](GeneratedSketch& sketch) { makeChain(sketch, 200); });
+}
+
+TEST_F(SolverBenchmark, DISABLED_rectangleGrid)  // NOLINT
+{
+    run("rectangleGrid", [](GeneratedSketch& sketch) { makeGrid(sketch, 15, 15); });
+}
+
+TEST_F(SolverBenchmark, DISABLED_tangentArcs)  // NOLINT
+{
+    std::deque<GCS::Arc> arcs;
+    run("tangentArcs", [&arcs](GeneratedSketch& sketch) {
+        arcs.clear();
+        makeTangentArcs(sketch, arcs, 100);
+    });
+}
+
+TEST_F(SolverBenchmark, DISABLED_decoupledClusters)  // NOLINT
+{
+    run("decoupledClusters", [](GeneratedSketch& sketch) { makeClusters(sketch, 200); });
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <string>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, recomputeEvaluatesLevelsOfDependentCells)
+{
+    // Arrange
+    const int rows = 300;
+    sheet()->setCell("A1", "2 mm");
+    for (int row = 1; row <= rows; ++row) {
+        std::string num = std::to_string(row);
+        sheet()->setCell(("B" + num).c_str(), ("=A1 * " + num).c_str());
+        sheet()->setCell(("C" + num).c_str(), ("=B" + num + " + 1 mm").c_str());
+    }
+    sheet()->setCell("D1", "=sum(C1:C300)");
+
+    // Act
+    doc()->recompute();
+    sheet()->setCell("A1", "3 mm");
+    doc()->recompute();
+
+    // Assert
+    auto b10 = dynamic_cast<App::PropertyQuantity*>(sheet()->getPropertyByName("B10"));
+    auto c300 = dynamic_cast<App::PropertyQuantity*>(sheet()->getPropertyByName("C300"));
+    auto d1 = dynamic_cast<App::PropertyQuantity*>(sheet()->getPropertyByName("D1"));
+    ASSERT_TRUE(b10 && c300 && d1);
+    EXPECT_DOUBLE_EQ(b10->getValue(), 30.0);
+    EXPECT_DOUBLE_EQ(c300->getValue(), 901.0);
+    EXPECT_DOUBLE_EQ(d1->getValue(), 3.0 * rows * (rows + 1) / 2 + rows);
+}
+
+// NOLINTEND(readability-magic-numbers)
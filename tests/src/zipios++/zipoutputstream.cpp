@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <zlib.h>
+#include <zipios++/zipinputstream.h>
+#include <zipios++/zipoutputstream.h>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+namespace
+{
+std::string deflateRaw(const std::string& data)
+{
+    z_stream zs {};
+    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&zs, static_cast<uLong>(data.size())), '\0');
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    zs.avail_in = static_cast<uInt>(data.size());
+    zs.next_out = reinterpret_cast<Bytef*>(out.data());
+    zs.avail_out = static_cast<uInt>(out.size());
+    deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+uLong crc(const std::string& data)
+{
+    return crc32(0L, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size()));
+}
+
+std::string readEntry(std::istream& str)
+{
+    return {std::istreambuf_iterator<char>(str), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+TEST(ZipOutputStream, putRawEntryMixedWithRegularEntries)
+{
+    std::stringstream archive;
+    std::string text(10000, 'a');
+    std::string deflated = deflateRaw(text);
+    {
+        zipios::ZipOutputStream zos(archive);
+        zos.putNextEntry("first.txt");
+        zos << "hello";
+        zos.putRawEntry("second.txt",
+                        zipios::DEFLATED,
+                        deflated.data(),
+                        deflated.size(),
+                        crc(text),
+                        text.size());
+        zos.putRawEntry("third.png", zipios::STORED, "xyz", 3, crc("xyz"), 3);
+        zos.putNextEntry("fourth.txt");
+        zos << "bye";
+        zos.close();
+    }
+
+    zipios::ZipInputStream zis(archive);
+    EXPECT_EQ(readEntry(zis), "hello");
+    auto entry = zis.getNextEntry();
+    EXPECT_EQ(entry->getName(), "second.txt");
+    EXPECT_EQ(readEntry(zis), text);
+    entry = zis.getNextEntry();
+    EXPECT_EQ(entry->getName(), "third.png");
+    EXPECT_EQ(entry->getMethod(), zipios::STORED);
+    EXPECT_EQ(readEntry(zis), "xyz");
+    entry = zis.getNextEntry();
+    EXPECT_EQ(entry->getName(), "fourth.txt");
+    EXPECT_EQ(readEntry(zis), "bye");
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)